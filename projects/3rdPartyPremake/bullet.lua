@@ -9,7 +9,8 @@ project "bullet"
 		"../../src/3rdParty/bullet-2.80-rev2531/**.cpp"
 	}
 	excludes {
-		"../../src/3rdParty/bullet-2.80-rev2531/src/BulletMultiThreaded/**",
+		"../../src/3rdParty/bullet-2.80-rev2531/src/BulletMultiThreaded/GpuSoftBodySolvers/**",
+		"../../src/3rdParty/bullet-2.80-rev2531/src/BulletMultiThreaded/SpuSampleTask/**",
 		"../../src/3rdParty/bullet-2.80-rev2531/src/ibmsdk/**",
 		"../../src/3rdParty/bullet-2.80-rev2531/src/MiniCL/**",
 		"../../src/3rdParty/bullet-2.80-rev2531/src/vectormath/**"
@@ -44,6 +45,11 @@ project "bullet"
 			"mkdir ..\\..\\include\\bullet\\BulletDynamics\\Dynamics",
 			"mkdir ..\\..\\include\\bullet\\BulletDynamics\\Vehicle",
 			"mkdir ..\\..\\include\\bullet\\BulletSoftBody",
+			"mkdir ..\\..\\include\\bullet\\BulletMultiThreaded",
+			"mkdir ..\\..\\include\\bullet\\BulletMultiThreaded\\SpuNarrowPhaseCollisionTask",
+			"mkdir ..\\..\\include\\bullet\\vectormath",
+			"mkdir ..\\..\\include\\bullet\\vectormath\\scalar",
+			"mkdir ..\\..\\include\\bullet\\vectormath\\sse",
 			"mkdir ..\\..\\include\\bullet\\LinearMath",
 			"copy /Y ..\\..\\src\\3rdParty\\bullet-2.80-rev2531\\src\\*.h ..\\..\\include\\bullet",
 			"copy /Y ..\\..\\src\\3rdParty\\bullet-2.80-rev2531\\src\\BulletCollision\\*.h ..\\..\\include\\bullet\\BulletCollision",
@@ -58,6 +64,11 @@ project "bullet"
 			"copy /Y ..\\..\\src\\3rdParty\\bullet-2.80-rev2531\\src\\BulletDynamics\\Dynamics\\*.h ..\\..\\include\\bullet\\BulletDynamics\\Dynamics",
 			"copy /Y ..\\..\\src\\3rdParty\\bullet-2.80-rev2531\\src\\BulletDynamics\\Vehicle\\*.h ..\\..\\include\\bullet\\BulletDynamics\\Vehicle",
 			"copy /Y ..\\..\\src\\3rdParty\\bullet-2.80-rev2531\\src\\BulletSoftBody\\*.h ..\\..\\include\\bullet\\BulletSoftBody",
+			"copy /Y ..\\..\\src\\3rdParty\\bullet-2.80-rev2531\\src\\BulletMultiThreaded\\*.h ..\\..\\include\\bullet\\BulletMultiThreaded",
+			"copy /Y ..\\..\\src\\3rdParty\\bullet-2.80-rev2531\\src\\BulletMultiThreaded\\SpuNarrowPhaseCollisionTask\\*.h ..\\..\\include\\bullet\\BulletMultiThreaded\\SpuNarrowPhaseCollisionTask",
+			"copy /Y ..\\..\\src\\3rdParty\\bullet-2.80-rev2531\\src\\vectormath\\*.h ..\\..\\include\\bullet\\vectormath",
+			"copy /Y ..\\..\\src\\3rdParty\\bullet-2.80-rev2531\\src\\vectormath\\scalar\\*.h ..\\..\\include\\bullet\\vectormath\\scalar",
+			"copy /Y ..\\..\\src\\3rdParty\\bullet-2.80-rev2531\\src\\vectormath\\sse\\*.h ..\\..\\include\\bullet\\vectormath\\sse",
 			"copy /Y ..\\..\\src\\3rdParty\\bullet-2.80-rev2531\\src\\LinearMath\\*.h ..\\..\\include\\bullet\\LinearMath"
 		}
 	configuration "not windows"
@@ -75,6 +86,11 @@ project "bullet"
 			"[ -d \"../../include/boost/BulletDynamics/Dynamics\" ] || mkdir ../../include/bullet/BulletDynamics/Dynamics",
 			"[ -d \"../../include/boost/BulletDynamics/Vehicle\" ] || mkdir ../../include/bullet/BulletDynamics/Vehicle",
 			"[ -d \"../../include/boost/BulletSoftBody\" ] || mkdir ../../include/bullet/BulletSoftBody",
+			"[ -d \"../../include/bullet/BulletMultiThreaded\" ] || mkdir ../../include/bullet/BulletMultiThreaded",
+			"[ -d \"../../include/bullet/BulletMultiThreaded/SpuNarrowPhaseCollisionTask\" ] || mkdir ../../include/bullet/BulletMultiThreaded/SpuNarrowPhaseCollisionTask",
+			"[ -d \"../../include/bullet/vectormath\" ] || mkdir ../../include/bullet/vectormath",
+			"[ -d \"../../include/bullet/vectormath/scalar\" ] || mkdir ../../include/bullet/vectormath/scalar",
+			"[ -d \"../../include/bullet/vectormath/sse\" ] || mkdir ../../include/bullet/vectormath/sse",
 			"[ -d \"../../include/boost/LinearMath\" ] || mkdir ../../include/bullet/LinearMath",
 			"cp ../../src/3rdParty/bullet-2.80-rev2531/src/*.h ../../include/bullet",
 			--"cp ../../src/3rdParty/bullet-2.80-rev2531/src/BulletCollision/*.h ../../include/bullet/BulletCollision",
@@ -89,5 +105,10 @@ project "bullet"
 			"cp ../../src/3rdParty/bullet-2.80-rev2531/src/BulletDynamics/Dynamics/*.h ../../include/bullet/BulletDynamics/Dynamics",
 			"cp ../../src/3rdParty/bullet-2.80-rev2531/src/BulletDynamics/Vehicle/*.h ../../include/bullet/BulletDynamics/Vehicle",
 			"cp ../../src/3rdParty/bullet-2.80-rev2531/src/BulletSoftBody/*.h ../../include/bullet/BulletSoftBody",
+			"cp ../../src/3rdParty/bullet-2.80-rev2531/src/BulletMultiThreaded/*.h ../../include/bullet/BulletMultiThreaded",
+			"cp ../../src/3rdParty/bullet-2.80-rev2531/src/BulletMultiThreaded/SpuNarrowPhaseCollisionTask/*.h ../../include/bullet/BulletMultiThreaded/SpuNarrowPhaseCollisionTask",
+			"cp ../../src/3rdParty/bullet-2.80-rev2531/src/vectormath/*.h ../../include/bullet/vectormath",
+			"cp ../../src/3rdParty/bullet-2.80-rev2531/src/vectormath/scalar/*.h ../../include/bullet/vectormath/scalar",
+			"cp ../../src/3rdParty/bullet-2.80-rev2531/src/vectormath/sse/*.h ../../include/bullet/vectormath/sse",
 			"cp ../../src/3rdParty/bullet-2.80-rev2531/src/LinearMath/*.h ../../include/bullet/LinearMath"
 		}
\ No newline at end of file
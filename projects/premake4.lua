@@ -29,7 +29,18 @@ project "gameframework"
 	}
 	excludes {
 		"../src/3rdParty/**",
+		"../src/AllocaterBenchmark/**",
+		"../src/AtlasCompiler/**",
+		"../src/ContainerBenchmark/**",
 		"../src/GLSLCompiler/**",
+		"../src/ImageBenchmark/**",
+		"../src/ModelBenchmark/**",
+		"../src/PhysicsBenchmark/**",
+		"../src/PhysicsReplay/**",
+		"../src/ProcessBenchmark/**",
+		"../src/RenderBenchmark/**",
+		"../src/ShaderCacheBenchmark/**",
+		"../src/TextureCompiler/**",
 		"../src/build/**",
 		"../src/Pool3d/**",
 		"../src/TestApp/**",
@@ -113,6 +124,11 @@ project "gameframework"
 			"TARGET_OS_MAC"
 		}
 		buildoptions "-std=c++11 -stdlib=libc++"
+	configuration "linux"
+		defines {
+			"TARGET_OS_UNIX"
+		}
+		buildoptions "-std=c++11 -pthread"
 
 project "Pool3d"
 	kind "ConsoleApp"
@@ -290,6 +306,647 @@ project "glslc"
 		links { "boost_filesystem-mt", "boost_system-mt", "OpenGL.framework", "OpenAL.framework", "CoreFoundation.framework", "IOKit.framework", "AppKit.framework" }
 		buildoptions "-std=c++11 -stdlib=libc++"
 
+project "texc"
+	kind "ConsoleApp"
+	language "C++"
+	location ("tmp")
+	includedirs { BOOST_INCLUDE_DIR, "../include" }
+	libdirs { BOOST_LIB_DIR }
+	targetdir ("../bin")
+	links { "zlib", "tinyxml", "png", "jpeg", "glew", "glfw", "gameframework" }
+	files {
+		"../src/TextureCompiler/**.h",
+		"../src/TextureCompiler/**.cpp",
+		"../src/TextureCompiler/**.c"
+	}
+	excludes {
+		"../src/data/**",
+		"../src/lua/**"
+	}
+	configuration "Debug"
+		flags { "FloatStrict", "StaticRuntime", "Symbols" }
+		objdir ("../obj/Debug/" .. "texc")
+		defines {
+			"DEBUG"
+		}
+		libdirs { "../libs/Debug" }
+	configuration "Release"
+		defines {
+			"RELEASE",
+			"NDEBUG"
+		}
+		flags { "FloatFast", "OptimizeSpeed", "StaticRuntime" }
+		objdir ("../obj/Release/" .. "texc")
+		libdirs { "../libs/Release" }
+	
+	configuration "windows"
+		defines {
+			"WIN32",
+			"_WINDOWS",
+			"WIN32_LEAN_AND_MEAN",
+			"NOMINMAX"
+		}
+		links { "opengl32", "glu32" }
+	configuration { "windows", "Debug" }
+		links { "libboost_filesystem-vc100-mt-sgd-1_51", "libboost_system-vc100-mt-sgd-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmtd.lib\"" }
+	configuration { "windows", "Release" }
+		links { "libboost_filesystem-vc100-mt-s-1_51", "libboost_system-vc100-mt-s-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmt.lib\"" }
+	configuration "macosx"
+		defines {
+			"TARGET_OS_MAC"
+		}
+		links { "boost_filesystem-mt", "boost_system-mt", "OpenGL.framework", "OpenAL.framework", "CoreFoundation.framework", "IOKit.framework", "AppKit.framework" }
+		buildoptions "-std=c++11 -stdlib=libc++"
+
+project "atlasc"
+	kind "ConsoleApp"
+	language "C++"
+	location ("tmp")
+	includedirs { BOOST_INCLUDE_DIR, "../include" }
+	libdirs { BOOST_LIB_DIR }
+	targetdir ("../bin")
+	links { "zlib", "tinyxml", "png", "jpeg", "glew", "glfw", "gameframework" }
+	files {
+		"../src/AtlasCompiler/**.h",
+		"../src/AtlasCompiler/**.cpp",
+		"../src/AtlasCompiler/**.c"
+	}
+	excludes {
+		"../src/data/**",
+		"../src/lua/**"
+	}
+	configuration "Debug"
+		flags { "FloatStrict", "StaticRuntime", "Symbols" }
+		objdir ("../obj/Debug/" .. "atlasc")
+		defines {
+			"DEBUG"
+		}
+		libdirs { "../libs/Debug" }
+	configuration "Release"
+		defines {
+			"RELEASE",
+			"NDEBUG"
+		}
+		flags { "FloatFast", "OptimizeSpeed", "StaticRuntime" }
+		objdir ("../obj/Release/" .. "atlasc")
+		libdirs { "../libs/Release" }
+	
+	configuration "windows"
+		defines {
+			"WIN32",
+			"_WINDOWS",
+			"WIN32_LEAN_AND_MEAN",
+			"NOMINMAX"
+		}
+		links { "opengl32", "glu32" }
+	configuration { "windows", "Debug" }
+		links { "libboost_filesystem-vc100-mt-sgd-1_51", "libboost_system-vc100-mt-sgd-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmtd.lib\"" }
+	configuration { "windows", "Release" }
+		links { "libboost_filesystem-vc100-mt-s-1_51", "libboost_system-vc100-mt-s-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmt.lib\"" }
+	configuration "macosx"
+		defines {
+			"TARGET_OS_MAC"
+		}
+		links { "boost_filesystem-mt", "boost_system-mt", "OpenGL.framework", "OpenAL.framework", "CoreFoundation.framework", "IOKit.framework", "AppKit.framework" }
+		buildoptions "-std=c++11 -stdlib=libc++"
+
+project "PhysicsBenchmark"
+	kind "ConsoleApp"
+	language "C++"
+	location ("tmp")
+	includedirs { BOOST_INCLUDE_DIR, "../include", "../include/bullet" }
+	libdirs { BOOST_LIB_DIR }
+	targetdir ("../bin")
+	links { "zlib", "tinyxml", "bullet", "png", "jpeg", "luaplus51", "ogg", "vorbis", "glew", "glfw", "freetype", "ftgl", "freetype-gl", "gameframework" }
+	files {
+		"../src/PhysicsBenchmark/**.h",
+		"../src/PhysicsBenchmark/**.cpp"
+	}
+	-- The bullet library is linked before gameframework, so GNU ld drops the
+	-- posix thread support BulletWorldComponents needs. Build it in directly.
+	if os.is("linux") then
+		files {
+			"../src/3rdParty/bullet-2.80-rev2531/src/BulletMultiThreaded/PosixThreadSupport.h",
+			"../src/3rdParty/bullet-2.80-rev2531/src/BulletMultiThreaded/PosixThreadSupport.cpp"
+		}
+	end
+	configuration "Debug"
+		flags { "FloatStrict", "StaticRuntime", "Symbols" }
+		objdir ("../obj/Debug/" .. "PhysicsBenchmark")
+		defines {
+			"DEBUG"
+		}
+		libdirs { "../libs/Debug" }
+	configuration "Release"
+		defines {
+			"RELEASE",
+			"NDEBUG"
+		}
+		flags { "FloatFast", "OptimizeSpeed", "StaticRuntime" }
+		objdir ("../obj/Release/" .. "PhysicsBenchmark")
+		libdirs { "../libs/Release" }
+	
+	configuration "windows"
+		defines {
+			"WIN32",
+			"_WINDOWS",
+			"WIN32_LEAN_AND_MEAN",
+			"NOMINMAX",
+			"GLEW_STATIC",
+			"FTGL_LIBRARY_STATIC"
+		}
+		includedirs { OPENAL_INCLUDE_DIR }
+		libdirs { OPENAL_LIB_DIR }
+		links { "opengl32", "glu32", "dsound", "OpenAL32" }
+	configuration { "windows", "Debug" }
+		links { "libboost_filesystem-vc100-mt-sgd-1_51", "libboost_system-vc100-mt-sgd-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmtd.lib\"" }
+	configuration { "windows", "Release" }
+		links { "libboost_filesystem-vc100-mt-s-1_51", "libboost_system-vc100-mt-s-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmt.lib\"" }
+	configuration "macosx"
+		defines {
+			"TARGET_OS_MAC"
+		}
+		links { "boost_filesystem-mt", "boost_system-mt", "OpenGL.framework", "OpenAL.framework", "CoreFoundation.framework", "IOKit.framework", "AppKit.framework" }
+		buildoptions "-std=c++11 -stdlib=libc++"
+	configuration "linux"
+		defines {
+			"TARGET_OS_UNIX"
+		}
+		links { "boost_filesystem", "boost_system", "GL", "X11", "Xrandr", "pthread", "rt" }
+		buildoptions "-std=c++11 -pthread"
+		linkoptions "-pthread"
+
+project "ProcessBenchmark"
+	kind "ConsoleApp"
+	language "C++"
+	location ("tmp")
+	includedirs { BOOST_INCLUDE_DIR, "../include", "../include/bullet" }
+	libdirs { BOOST_LIB_DIR }
+	targetdir ("../bin")
+	links { "zlib", "tinyxml", "bullet", "png", "jpeg", "luaplus51", "ogg", "vorbis", "glew", "glfw", "freetype", "ftgl", "freetype-gl", "gameframework" }
+	files {
+		"../src/ProcessBenchmark/**.h",
+		"../src/ProcessBenchmark/**.cpp"
+	}
+	configuration "Debug"
+		flags { "FloatStrict", "StaticRuntime", "Symbols" }
+		objdir ("../obj/Debug/" .. "ProcessBenchmark")
+		defines {
+			"DEBUG"
+		}
+		libdirs { "../libs/Debug" }
+	configuration "Release"
+		defines {
+			"RELEASE",
+			"NDEBUG"
+		}
+		flags { "FloatFast", "OptimizeSpeed", "StaticRuntime" }
+		objdir ("../obj/Release/" .. "ProcessBenchmark")
+		libdirs { "../libs/Release" }
+	
+	configuration "windows"
+		defines {
+			"WIN32",
+			"_WINDOWS",
+			"WIN32_LEAN_AND_MEAN",
+			"NOMINMAX",
+			"GLEW_STATIC",
+			"FTGL_LIBRARY_STATIC"
+		}
+		includedirs { OPENAL_INCLUDE_DIR }
+		libdirs { OPENAL_LIB_DIR }
+		links { "opengl32", "glu32", "dsound", "OpenAL32" }
+	configuration { "windows", "Debug" }
+		links { "libboost_filesystem-vc100-mt-sgd-1_51", "libboost_system-vc100-mt-sgd-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmtd.lib\"" }
+	configuration { "windows", "Release" }
+		links { "libboost_filesystem-vc100-mt-s-1_51", "libboost_system-vc100-mt-s-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmt.lib\"" }
+	configuration "macosx"
+		defines {
+			"TARGET_OS_MAC"
+		}
+		links { "boost_filesystem-mt", "boost_system-mt", "OpenGL.framework", "OpenAL.framework", "CoreFoundation.framework", "IOKit.framework", "AppKit.framework" }
+		buildoptions "-std=c++11 -stdlib=libc++"
+
+project "PhysicsReplay"
+	kind "ConsoleApp"
+	language "C++"
+	location ("tmp")
+	includedirs { BOOST_INCLUDE_DIR, "../include", "../include/bullet" }
+	libdirs { BOOST_LIB_DIR }
+	targetdir ("../bin")
+	links { "zlib", "tinyxml", "bullet", "png", "jpeg", "luaplus51", "ogg", "vorbis", "glew", "glfw", "freetype", "ftgl", "freetype-gl", "gameframework" }
+	files {
+		"../src/PhysicsReplay/**.h",
+		"../src/PhysicsReplay/**.cpp"
+	}
+	configuration "Debug"
+		flags { "FloatStrict", "StaticRuntime", "Symbols" }
+		objdir ("../obj/Debug/" .. "PhysicsReplay")
+		defines {
+			"DEBUG"
+		}
+		libdirs { "../libs/Debug" }
+	configuration "Release"
+		defines {
+			"RELEASE",
+			"NDEBUG"
+		}
+		flags { "FloatFast", "OptimizeSpeed", "StaticRuntime" }
+		objdir ("../obj/Release/" .. "PhysicsReplay")
+		libdirs { "../libs/Release" }
+	
+	configuration "windows"
+		defines {
+			"WIN32",
+			"_WINDOWS",
+			"WIN32_LEAN_AND_MEAN",
+			"NOMINMAX",
+			"GLEW_STATIC",
+			"FTGL_LIBRARY_STATIC"
+		}
+		includedirs { OPENAL_INCLUDE_DIR }
+		libdirs { OPENAL_LIB_DIR }
+		links { "opengl32", "glu32", "dsound", "OpenAL32" }
+	configuration { "windows", "Debug" }
+		links { "libboost_filesystem-vc100-mt-sgd-1_51", "libboost_system-vc100-mt-sgd-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmtd.lib\"" }
+	configuration { "windows", "Release" }
+		links { "libboost_filesystem-vc100-mt-s-1_51", "libboost_system-vc100-mt-s-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmt.lib\"" }
+	configuration "macosx"
+		defines {
+			"TARGET_OS_MAC"
+		}
+		links { "boost_filesystem-mt", "boost_system-mt", "OpenGL.framework", "OpenAL.framework", "CoreFoundation.framework", "IOKit.framework", "AppKit.framework" }
+		buildoptions "-std=c++11 -stdlib=libc++"
+
+project "ImageBenchmark"
+	kind "ConsoleApp"
+	language "C++"
+	location ("tmp")
+	includedirs { BOOST_INCLUDE_DIR, "../include", "../include/bullet" }
+	libdirs { BOOST_LIB_DIR }
+	targetdir ("../bin")
+	links { "zlib", "tinyxml", "bullet", "png", "jpeg", "luaplus51", "ogg", "vorbis", "glew", "glfw", "freetype", "ftgl", "freetype-gl", "gameframework" }
+	files {
+		"../src/ImageBenchmark/**.h",
+		"../src/ImageBenchmark/**.cpp"
+	}
+	configuration "Debug"
+		flags { "FloatStrict", "StaticRuntime", "Symbols" }
+		objdir ("../obj/Debug/" .. "ImageBenchmark")
+		defines {
+			"DEBUG"
+		}
+		libdirs { "../libs/Debug" }
+	configuration "Release"
+		defines {
+			"RELEASE",
+			"NDEBUG"
+		}
+		flags { "FloatFast", "OptimizeSpeed", "StaticRuntime" }
+		objdir ("../obj/Release/" .. "ImageBenchmark")
+		libdirs { "../libs/Release" }
+	
+	configuration "windows"
+		defines {
+			"WIN32",
+			"_WINDOWS",
+			"WIN32_LEAN_AND_MEAN",
+			"NOMINMAX",
+			"GLEW_STATIC",
+			"FTGL_LIBRARY_STATIC"
+		}
+		includedirs { OPENAL_INCLUDE_DIR }
+		libdirs { OPENAL_LIB_DIR }
+		links { "opengl32", "glu32", "dsound", "OpenAL32" }
+	configuration { "windows", "Debug" }
+		links { "libboost_filesystem-vc100-mt-sgd-1_51", "libboost_system-vc100-mt-sgd-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmtd.lib\"" }
+	configuration { "windows", "Release" }
+		links { "libboost_filesystem-vc100-mt-s-1_51", "libboost_system-vc100-mt-s-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmt.lib\"" }
+	configuration "macosx"
+		defines {
+			"TARGET_OS_MAC"
+		}
+		links { "boost_filesystem-mt", "boost_system-mt", "OpenGL.framework", "OpenAL.framework", "CoreFoundation.framework", "IOKit.framework", "AppKit.framework" }
+		buildoptions "-std=c++11 -stdlib=libc++"
+
+project "ModelBenchmark"
+	kind "ConsoleApp"
+	language "C++"
+	location ("tmp")
+	includedirs { BOOST_INCLUDE_DIR, "../include", "../include/bullet" }
+	libdirs { BOOST_LIB_DIR }
+	targetdir ("../bin")
+	links { "zlib", "tinyxml", "bullet", "png", "jpeg", "luaplus51", "ogg", "vorbis", "glew", "glfw", "freetype", "ftgl", "freetype-gl", "gameframework" }
+	files {
+		"../src/ModelBenchmark/**.h",
+		"../src/ModelBenchmark/**.cpp"
+	}
+	configuration "Debug"
+		flags { "FloatStrict", "StaticRuntime", "Symbols" }
+		objdir ("../obj/Debug/" .. "ModelBenchmark")
+		defines {
+			"DEBUG"
+		}
+		libdirs { "../libs/Debug" }
+	configuration "Release"
+		defines {
+			"RELEASE",
+			"NDEBUG"
+		}
+		flags { "FloatFast", "OptimizeSpeed", "StaticRuntime" }
+		objdir ("../obj/Release/" .. "ModelBenchmark")
+		libdirs { "../libs/Release" }
+	
+	configuration "windows"
+		defines {
+			"WIN32",
+			"_WINDOWS",
+			"WIN32_LEAN_AND_MEAN",
+			"NOMINMAX",
+			"GLEW_STATIC",
+			"FTGL_LIBRARY_STATIC"
+		}
+		includedirs { OPENAL_INCLUDE_DIR }
+		libdirs { OPENAL_LIB_DIR }
+		links { "opengl32", "glu32", "dsound", "OpenAL32" }
+	configuration { "windows", "Debug" }
+		links { "libboost_filesystem-vc100-mt-sgd-1_51", "libboost_system-vc100-mt-sgd-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmtd.lib\"" }
+	configuration { "windows", "Release" }
+		links { "libboost_filesystem-vc100-mt-s-1_51", "libboost_system-vc100-mt-s-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmt.lib\"" }
+	configuration "macosx"
+		defines {
+			"TARGET_OS_MAC"
+		}
+		links { "boost_filesystem-mt", "boost_system-mt", "OpenGL.framework", "OpenAL.framework", "CoreFoundation.framework", "IOKit.framework", "AppKit.framework" }
+		buildoptions "-std=c++11 -stdlib=libc++"
+
+project "ContainerBenchmark"
+	kind "ConsoleApp"
+	language "C++"
+	location ("tmp")
+	includedirs { BOOST_INCLUDE_DIR, "../include", "../include/bullet" }
+	libdirs { BOOST_LIB_DIR }
+	targetdir ("../bin")
+	links { "zlib", "tinyxml", "bullet", "png", "jpeg", "luaplus51", "ogg", "vorbis", "glew", "glfw", "freetype", "ftgl", "freetype-gl", "gameframework" }
+	files {
+		"../src/ContainerBenchmark/**.h",
+		"../src/ContainerBenchmark/**.cpp"
+	}
+	configuration "Debug"
+		flags { "FloatStrict", "StaticRuntime", "Symbols" }
+		objdir ("../obj/Debug/" .. "ContainerBenchmark")
+		defines {
+			"DEBUG"
+		}
+		libdirs { "../libs/Debug" }
+	configuration "Release"
+		defines {
+			"RELEASE",
+			"NDEBUG"
+		}
+		flags { "FloatFast", "OptimizeSpeed", "StaticRuntime" }
+		objdir ("../obj/Release/" .. "ContainerBenchmark")
+		libdirs { "../libs/Release" }
+	
+	configuration "windows"
+		defines {
+			"WIN32",
+			"_WINDOWS",
+			"WIN32_LEAN_AND_MEAN",
+			"NOMINMAX",
+			"GLEW_STATIC",
+			"FTGL_LIBRARY_STATIC"
+		}
+		includedirs { OPENAL_INCLUDE_DIR }
+		libdirs { OPENAL_LIB_DIR }
+		links { "opengl32", "glu32", "dsound", "OpenAL32" }
+	configuration { "windows", "Debug" }
+		links { "libboost_filesystem-vc100-mt-sgd-1_51", "libboost_system-vc100-mt-sgd-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmtd.lib\"" }
+	configuration { "windows", "Release" }
+		links { "libboost_filesystem-vc100-mt-s-1_51", "libboost_system-vc100-mt-s-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmt.lib\"" }
+	configuration "macosx"
+		defines {
+			"TARGET_OS_MAC"
+		}
+		links { "boost_filesystem-mt", "boost_system-mt", "OpenGL.framework", "OpenAL.framework", "CoreFoundation.framework", "IOKit.framework", "AppKit.framework" }
+		buildoptions "-std=c++11 -stdlib=libc++"
+
+project "AllocaterBenchmark"
+	kind "ConsoleApp"
+	language "C++"
+	location ("tmp")
+	includedirs { BOOST_INCLUDE_DIR, "../include", "../include/bullet" }
+	libdirs { BOOST_LIB_DIR }
+	targetdir ("../bin")
+	links { "zlib", "tinyxml", "bullet", "png", "jpeg", "luaplus51", "ogg", "vorbis", "glew", "glfw", "freetype", "ftgl", "freetype-gl", "gameframework" }
+	files {
+		"../src/AllocaterBenchmark/**.h",
+		"../src/AllocaterBenchmark/**.cpp"
+	}
+	configuration "Debug"
+		flags { "FloatStrict", "StaticRuntime", "Symbols" }
+		objdir ("../obj/Debug/" .. "AllocaterBenchmark")
+		defines {
+			"DEBUG"
+		}
+		libdirs { "../libs/Debug" }
+	configuration "Release"
+		defines {
+			"RELEASE",
+			"NDEBUG"
+		}
+		flags { "FloatFast", "OptimizeSpeed", "StaticRuntime" }
+		objdir ("../obj/Release/" .. "AllocaterBenchmark")
+		libdirs { "../libs/Release" }
+	
+	configuration "windows"
+		defines {
+			"WIN32",
+			"_WINDOWS",
+			"WIN32_LEAN_AND_MEAN",
+			"NOMINMAX",
+			"GLEW_STATIC",
+			"FTGL_LIBRARY_STATIC"
+		}
+		includedirs { OPENAL_INCLUDE_DIR }
+		libdirs { OPENAL_LIB_DIR }
+		links { "opengl32", "glu32", "dsound", "OpenAL32" }
+	configuration { "windows", "Debug" }
+		links { "libboost_filesystem-vc100-mt-sgd-1_51", "libboost_system-vc100-mt-sgd-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmtd.lib\"" }
+	configuration { "windows", "Release" }
+		links { "libboost_filesystem-vc100-mt-s-1_51", "libboost_system-vc100-mt-s-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmt.lib\"" }
+	configuration "macosx"
+		defines {
+			"TARGET_OS_MAC"
+		}
+		links { "boost_filesystem-mt", "boost_system-mt", "OpenGL.framework", "OpenAL.framework", "CoreFoundation.framework", "IOKit.framework", "AppKit.framework" }
+		buildoptions "-std=c++11 -stdlib=libc++"
+
+project "ShaderCacheBenchmark"
+	kind "ConsoleApp"
+	language "C++"
+	location ("tmp")
+	includedirs { BOOST_INCLUDE_DIR, "../include", "../include/bullet" }
+	libdirs { BOOST_LIB_DIR }
+	targetdir ("../bin")
+	links { "zlib", "tinyxml", "bullet", "png", "jpeg", "luaplus51", "ogg", "vorbis", "glew", "glfw", "freetype", "ftgl", "freetype-gl", "gameframework" }
+	files {
+		"../src/ShaderCacheBenchmark/**.h",
+		"../src/ShaderCacheBenchmark/**.cpp"
+	}
+	configuration "Debug"
+		flags { "FloatStrict", "StaticRuntime", "Symbols" }
+		objdir ("../obj/Debug/" .. "ShaderCacheBenchmark")
+		defines {
+			"DEBUG"
+		}
+		libdirs { "../libs/Debug" }
+	configuration "Release"
+		defines {
+			"RELEASE",
+			"NDEBUG"
+		}
+		flags { "FloatFast", "OptimizeSpeed", "StaticRuntime" }
+		objdir ("../obj/Release/" .. "ShaderCacheBenchmark")
+		libdirs { "../libs/Release" }
+	
+	configuration "windows"
+		defines {
+			"WIN32",
+			"_WINDOWS",
+			"WIN32_LEAN_AND_MEAN",
+			"NOMINMAX",
+			"GLEW_STATIC",
+			"FTGL_LIBRARY_STATIC"
+		}
+		includedirs { OPENAL_INCLUDE_DIR }
+		libdirs { OPENAL_LIB_DIR }
+		links { "opengl32", "glu32", "dsound", "OpenAL32" }
+	configuration { "windows", "Debug" }
+		links { "libboost_filesystem-vc100-mt-sgd-1_51", "libboost_system-vc100-mt-sgd-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmtd.lib\"" }
+	configuration { "windows", "Release" }
+		links { "libboost_filesystem-vc100-mt-s-1_51", "libboost_system-vc100-mt-s-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmt.lib\"" }
+	configuration "macosx"
+		defines {
+			"TARGET_OS_MAC"
+		}
+		links { "boost_filesystem-mt", "boost_system-mt", "OpenGL.framework", "OpenAL.framework", "CoreFoundation.framework", "IOKit.framework", "AppKit.framework" }
+		buildoptions "-std=c++11 -stdlib=libc++"
+	configuration "linux"
+		defines {
+			"TARGET_OS_UNIX"
+		}
+		links { "boost_filesystem", "boost_system", "GL", "X11", "Xrandr", "pthread", "rt" }
+		buildoptions "-std=c++11 -pthread"
+		linkoptions "-pthread"
+
+project "RenderBenchmark"
+	kind "ConsoleApp"
+	language "C++"
+	location ("tmp")
+	includedirs { BOOST_INCLUDE_DIR, "../include", "../include/bullet" }
+	libdirs { BOOST_LIB_DIR }
+	targetdir ("../bin")
+	links { "zlib", "tinyxml", "bullet", "png", "jpeg", "luaplus51", "ogg", "vorbis", "glew", "glfw", "freetype", "ftgl", "freetype-gl" }
+	-- The recording build routes the framework's OpenGL and GLFW window calls
+	-- to the GLRecorder, so the framework and Pool3D sources are compiled in
+	-- with GF_GL_RECORDING rather than linking the gameframework library. The
+	-- headers are copied to ../include by the gameframework build.
+	defines {
+		"GF_GL_RECORDING"
+	}
+	files {
+		"../src/**.h",
+		"../src/**.cpp"
+	}
+	excludes {
+		"../src/3rdParty/**",
+		"../src/AllocaterBenchmark/**",
+		"../src/AtlasCompiler/**",
+		"../src/ContainerBenchmark/**",
+		"../src/GLSLCompiler/**",
+		"../src/ImageBenchmark/**",
+		"../src/ModelBenchmark/**",
+		"../src/PhysicsBenchmark/**",
+		"../src/PhysicsReplay/**",
+		"../src/ProcessBenchmark/**",
+		"../src/ShaderCacheBenchmark/**",
+		"../src/TextureCompiler/**",
+		"../src/build/**",
+		"../src/Pool3d/data/**",
+		"../src/Pool3d/lua/**",
+		"../src/Pool3d/pool3d.cpp",
+		"../src/TestApp/**",
+		"../src/unittests/**",
+		"../src/sound/DirectSoundAudio.h",
+		"../src/sound/DirectSoundAudio.cpp"
+	}
+	configuration "Debug"
+		flags { "FloatStrict", "StaticRuntime", "Symbols" }
+		objdir ("../obj/Debug/" .. "RenderBenchmark")
+		defines {
+			"DEBUG"
+		}
+	configuration "Release"
+		defines {
+			"RELEASE",
+			"NDEBUG"
+		}
+		flags { "FloatFast", "OptimizeSpeed", "StaticRuntime" }
+		objdir ("../obj/Release/" .. "RenderBenchmark")
+	
+	configuration "windows"
+		defines {
+			"WIN32",
+			"_WINDOWS",
+			"WIN32_LEAN_AND_MEAN",
+			"NOMINMAX",
+			"GLEW_STATIC",
+			"FTGL_LIBRARY_STATIC"
+		}
+		includedirs { OPENAL_INCLUDE_DIR }
+		libdirs { OPENAL_LIB_DIR }
+		links { "opengl32", "glu32", "dsound", "OpenAL32" }
+	configuration { "windows", "Debug" }
+		links { "libboost_filesystem-vc100-mt-sgd-1_51", "libboost_system-vc100-mt-sgd-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmtd.lib\"" }
+	configuration { "windows", "Release" }
+		links { "libboost_filesystem-vc100-mt-s-1_51", "libboost_system-vc100-mt-s-1_51" }
+		linkoptions { "/NODEFAULTLIB:\"libcmt.lib\"" }
+	configuration "macosx"
+		defines {
+			"TARGET_OS_MAC"
+		}
+		links { "boost_filesystem-mt", "boost_system-mt", "OpenGL.framework", "OpenAL.framework", "CoreFoundation.framework", "IOKit.framework", "AppKit.framework" }
+		buildoptions "-std=c++11 -stdlib=libc++"
+	configuration "linux"
+		defines {
+			"TARGET_OS_UNIX"
+		}
+		links { "boost_filesystem", "boost_system", "GL", "X11", "Xrandr", "pthread", "rt", "openal" }
+		buildoptions "-std=c++11 -pthread"
+		linkoptions "-pthread"
+
 local ThirdPartyMakeScripts = {
 	"3rdPartyPremake/zlib.lua",
 	"3rdPartyPremake/bullet.lua",
@@ -0,0 +1,181 @@
+// /////////////////////////////////////////////////////////////////////////////
+// @file main.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Headless small object churn benchmark.  Keeps a fixed number of live
+// blocks of 1 to SizeClassPoolAllocater::MAX_SMALL_BLOCK_SIZE bytes (the
+// sizes of events, particles and list nodes) and repeatedly frees a
+// random block and allocates a new one in its place.  Times the
+// DefaultAllocater (the OS heap) against the SizeClassPoolAllocater with
+// and without its size class locks.  Every run uses the same sequence of
+// sizes and slots.
+//
+// Usage: AllocaterBenchmark [numberOperations] [numberLiveBlocks] [numberRuns]
+//
+// /////////////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include "GameBase.h"
+#include "DefaultAllocater.h"
+#include "SizeClassPoolAllocater.h"
+
+using GameHalloran::U8;
+using GameHalloran::U32;
+using GameHalloran::U64;
+using GameHalloran::F64;
+using GameHalloran::IGameAllocater;
+using GameHalloran::DefaultAllocater;
+using GameHalloran::SizeClassPoolAllocater;
+
+namespace {
+
+    const U32 DEFAULT_NUMBER_OPERATIONS = 2000000;  ///< Frees and allocations in each run.
+    const U32 DEFAULT_NUMBER_LIVE_BLOCKS = 4096;    ///< Blocks kept allocated.
+    const U32 DEFAULT_NUMBER_RUNS = 5;              ///< Runs averaged.
+    const U32 BENCHMARK_ALLOCATER_ID = 0xBE;        ///< ID of the benchmarked SizeClassPoolAllocater.
+    const U32 BLOCKS_PER_CHUNK = 256;               ///< Blocks each size class takes from the OS at a time.
+
+    // /////////////////////////////////////////////////////////////////
+    // Get the current wall clock time in seconds.
+    //
+    // /////////////////////////////////////////////////////////////////
+    F64 GetSeconds()
+    {
+        static const boost::posix_time::ptime epoch(boost::posix_time::microsec_clock::universal_time());
+        return (F64((boost::posix_time::microsec_clock::universal_time() - epoch).total_microseconds()) / 1000000.0);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Small linear congruential generator so every run and allocater
+    // sees the same sequence.
+    //
+    // /////////////////////////////////////////////////////////////////
+    inline U32 NextRandom(U32 &seed)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        return (seed >> 8);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Churn the blocks of one allocater.
+    //
+    // @return F64 The time taken in seconds or a negative value if an
+    //              allocation failed.
+    //
+    // /////////////////////////////////////////////////////////////////
+    F64 Churn(IGameAllocater &allocater, const U32 numberOperations, const U32 numberLiveBlocks)
+    {
+        std::vector<void *> blocks(numberLiveBlocks, static_cast<void *>(NULL));
+        U32 seed = 12345;
+        bool result = true;
+
+        const F64 start = GetSeconds();
+        for(U32 i = 0; i < numberLiveBlocks; ++i) {
+            const U32 size = 1 + NextRandom(seed) % SizeClassPoolAllocater::MAX_SMALL_BLOCK_SIZE;
+            blocks[i] = allocater.VAlloc(size);
+            result = (blocks[i] != NULL) && result;
+            if(blocks[i]) {
+                *static_cast<U8 *>(blocks[i]) = U8(i);
+            }
+        }
+        for(U32 i = 0; i < numberOperations; ++i) {
+            const U32 slot = NextRandom(seed) % numberLiveBlocks;
+            const U32 size = 1 + NextRandom(seed) % SizeClassPoolAllocater::MAX_SMALL_BLOCK_SIZE;
+            allocater.VDealloc(blocks[slot]);
+            blocks[slot] = allocater.VAlloc(size);
+            result = (blocks[slot] != NULL) && result;
+            if(blocks[slot]) {
+                *static_cast<U8 *>(blocks[slot]) = U8(i);
+            }
+        }
+        for(U32 i = 0; i < numberLiveBlocks; ++i) {
+            allocater.VDealloc(blocks[i]);
+        }
+        const F64 seconds = GetSeconds() - start;
+
+        return (result ? seconds : -1.0);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Benchmark one allocater and print its average time.
+    //
+    // @return F64 The average time in seconds or a negative value on
+    //              failure.
+    //
+    // /////////////////////////////////////////////////////////////////
+    F64 BenchmarkAllocater(const char *name, IGameAllocater &allocater, const U32 numberOperations, const U32 numberLiveBlocks, \
+                           const U32 numberRuns, const F64 baselineSeconds)
+    {
+        F64 total = 0.0;
+        for(U32 run = 0; run < numberRuns; ++run) {
+            const F64 seconds = Churn(allocater, numberOperations, numberLiveBlocks);
+            if(seconds < 0.0) {
+                std::cerr << name << " failed to allocate a block" << std::endl;
+                return (-1.0);
+            }
+            total += seconds;
+        }
+
+        const F64 average = total / F64(numberRuns);
+        std::cout << std::fixed << std::setprecision(3) << "     " << std::left << std::setw(30) << name << std::right
+                  << "  " << std::setw(8) << (average * 1000.0) << "ms"
+                  << "  " << std::setw(6) << (average * 1000000000.0 / F64(numberOperations)) << "ns/op";
+        if(baselineSeconds > 0.0) {
+            std::cout << "  ratio " << std::setprecision(3) << (average / baselineSeconds);
+        }
+        std::cout << std::endl;
+
+        return (average);
+    }
+
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+int main(int args, char *argv[])
+{
+    const U32 numberOperations = (args > 1) ? U32(atoi(argv[1])) : DEFAULT_NUMBER_OPERATIONS;
+    const U32 numberLiveBlocks = (args > 2) ? U32(atoi(argv[2])) : DEFAULT_NUMBER_LIVE_BLOCKS;
+    const U32 numberRuns = (args > 3) ? U32(atoi(argv[3])) : DEFAULT_NUMBER_RUNS;
+    if(numberOperations == 0 || numberLiveBlocks == 0 || numberRuns == 0) {
+        std::cerr << "The number of operations, live blocks and runs must be greater than 0" << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    // The size class locks are GLFW mutexes.
+    if(glfwInit() != GL_TRUE) {
+        std::cerr << "Failed to initialize GLFW, the size class locks can not be created" << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    std::cout << numberOperations << " frees and allocations of 1 to " << SizeClassPoolAllocater::MAX_SMALL_BLOCK_SIZE << " bytes, "
+              << numberLiveBlocks << " live blocks, average of " << numberRuns << " runs" << std::endl;
+
+    DefaultAllocater defaultAllocater;
+    const F64 defaultSeconds = BenchmarkAllocater("DefaultAllocater", defaultAllocater, numberOperations, numberLiveBlocks, numberRuns, 0.0);
+
+    SizeClassPoolAllocater poolAllocater(BENCHMARK_ALLOCATER_ID, BLOCKS_PER_CHUNK);
+    const F64 poolSeconds = BenchmarkAllocater("SizeClassPoolAllocater", poolAllocater, numberOperations, numberLiveBlocks, numberRuns, \
+                                               defaultSeconds);
+
+    F64 lockedSeconds = -1.0;
+    if(poolAllocater.EnableThreadSafety()) {
+        lockedSeconds = BenchmarkAllocater("SizeClassPoolAllocater locked", poolAllocater, numberOperations, numberLiveBlocks, numberRuns, \
+                                           defaultSeconds);
+        poolAllocater.DisableThreadSafety();
+    } else {
+        std::cerr << "Failed to create the size class locks" << std::endl;
+    }
+
+    glfwTerminate();
+    return ((defaultSeconds >= 0.0 && poolSeconds >= 0.0 && lockedSeconds >= 0.0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
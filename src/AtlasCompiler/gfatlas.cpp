@@ -0,0 +1,504 @@
+// /////////////////////////////////////////////////////////////////
+// @file gfatlas.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Small offline application for baking the images under each
+// directory of ResPath/textures/ into a texture atlas.  For each
+// directory it writes an uncompressed TGA atlas and an xml
+// description, read by the TextureAtlasManager, to ResPath/atlases/
+// and collects every atlas in ResPath/atlases/atlasDictionary.xml and
+// in the binary dictionary ResPath/atlases/atlasDictionary.atd the
+// game loads at startup.
+//
+// Run with -d to only write the binary dictionary from the atlas xml
+// files already in ResPath/atlases/.
+//
+// Run with --benchmark N to time packing N generated sprites instead.
+//
+// /////////////////////////////////////////////////////////////////
+
+// External Headers
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+#include <boost/filesystem.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include "tinyxml/tinyxml.h"
+
+// Project Headers
+#include "ResCache2.h"
+#include "ImageResource.h"
+#include "ImageProcessing.h"
+#include "AtlasPacker.h"
+#include "AtlasDictionary.h"
+
+using GameHalloran::U8;
+using GameHalloran::U32;
+using GameHalloran::I32;
+using GameHalloran::F64;
+using GameHalloran::AtlasPacker;
+using GameHalloran::AtlasPackerOptions;
+
+namespace {
+
+    const char * const IMAGES_DIR = "textures";         ///< Directory under ResPath holding a directory of images per atlas.
+    const char * const NO_ATLAS_DIR = "NoAtlas";        ///< Directory of images which are not baked into an atlas.
+    const char * const ATLASES_DIR = "atlases";         ///< Directory under ResPath the atlases are written to.
+    const char * const DICTIONARY_FILE = "atlasDictionary.xml";
+    const char * const BINARY_DICTIONARY_FILE = "atlasDictionary.atd";
+
+    // /////////////////////////////////////////////////////////////////
+    // @class DirectoryFile
+    //
+    // Resource file serving the files of a directory by their names.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class DirectoryFile : public GameHalloran::IResourceFile {
+    private:
+        boost::filesystem::path m_path;         ///< Path of the directory.
+    public:
+        explicit DirectoryFile(const boost::filesystem::path &path) : m_path(path) {};
+        virtual bool VOpen() {
+            return (boost::filesystem::is_directory(m_path));
+        };
+        virtual boost::optional<I32> VGetResourceSize(const GameHalloran::Resource &r) {
+            const boost::filesystem::path filePath(m_path / r.GetName());
+            if(!boost::filesystem::is_regular_file(filePath)) {
+                return (boost::optional<I32>());
+            }
+            return (boost::optional<I32>(I32(boost::filesystem::file_size(filePath))));
+        };
+        virtual bool VGetResource(const GameHalloran::Resource &r, char *buffer) {
+            const boost::filesystem::path filePath(m_path / r.GetName());
+            std::ifstream in(filePath.string().c_str(), std::ios::in | std::ios::binary);
+            in.read(buffer, std::streamsize(boost::filesystem::file_size(filePath)));
+            return (!in.fail());
+        };
+        virtual bool VGetResourceListing(const std::string &, GameHalloran::ResourceListing &) {
+            return (false);
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Get the current wall clock time in seconds.
+    //
+    // /////////////////////////////////////////////////////////////////
+    F64 GetTime()
+    {
+        static const boost::posix_time::ptime epoch(boost::posix_time::microsec_clock::universal_time());
+        return (F64((boost::posix_time::microsec_clock::universal_time() - epoch).total_microseconds()) / 1000000.0);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Write RGBA texels, rows bottom up, as an uncompressed 32 bit (or
+    // 24 bit without alpha) TGA file.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool WriteTga(const boost::filesystem::path &path, const std::vector<U8> &rgbaVec, const U32 width, const U32 height, const bool alpha)
+    {
+        const U32 bytesPerTexel = alpha ? 4 : 3;
+        U8 header[18];
+        memset(header, 0, sizeof(header));
+        header[2] = 2;                                  // Uncompressed true colour.
+        header[12] = U8(width & 0xFF);
+        header[13] = U8(width >> 8);
+        header[14] = U8(height & 0xFF);
+        header[15] = U8(height >> 8);
+        header[16] = U8(bytesPerTexel * 8);
+        header[17] = alpha ? 0x08 : 0x00;               // Alpha bits, origin bottom left.
+
+        std::vector<U8> bgrVec(width * height * bytesPerTexel);
+        if(alpha) {
+            bgrVec = rgbaVec;
+        } else {
+            GameHalloran::ConvertRgbaToRgb(&rgbaVec[0], width * height, &bgrVec[0]);
+        }
+        for(U32 i = 0; i < width * height; ++i) {
+            std::swap(bgrVec[i * bytesPerTexel], bgrVec[i * bytesPerTexel + 2]);
+        }
+
+        std::ofstream out(path.string().c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char *>(header), sizeof(header));
+        out.write(reinterpret_cast<const char *>(&bgrVec[0]), std::streamsize(bgrVec.size()));
+        out.close();
+        return (!out.fail());
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Write an xml file holding a <Root> element with the given <Atlas>
+    // elements.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool WriteAtlasXml(const boost::filesystem::path &path, const std::vector<const TiXmlElement *> &atlasElemVec)
+    {
+        TiXmlDocument xmlDoc;
+        xmlDoc.LinkEndChild(new TiXmlDeclaration("1.0", "", ""));
+        TiXmlElement *rootElemPtr = new TiXmlElement("Root");
+        xmlDoc.LinkEndChild(rootElemPtr);
+        for(std::vector<const TiXmlElement *>::const_iterator i = atlasElemVec.begin(), end = atlasElemVec.end(); i != end; ++i) {
+            rootElemPtr->InsertEndChild(**i);
+        }
+        return (xmlDoc.SaveFile(path.string().c_str()));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Write the given <Atlas> elements as a binary dictionary.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool WriteAtlasDictionary(const boost::filesystem::path &path, const std::vector<const TiXmlElement *> &atlasElemVec)
+    {
+        std::vector<U8> dictionary;
+        if(!GameHalloran::EncodeAtlasDictionary(atlasElemVec, dictionary)) {
+            std::cerr << "Error: An <Atlas> element is missing a required attribute." << std::endl;
+            return (false);
+        }
+
+        std::ofstream out(path.string().c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char *>(&dictionary[0]), std::streamsize(dictionary.size()));
+        out.close();
+        return (!out.fail());
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Write the binary dictionary of the atlas xml files in a directory,
+    // other than the xml dictionary.
+    //
+    // @return bool False on failure.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ConvertAtlasXml(const boost::filesystem::path &atlasesPath)
+    {
+        if(!boost::filesystem::is_directory(atlasesPath)) {
+            std::cerr << "Error: " << atlasesPath.string() << " is not a directory." << std::endl;
+            return (false);
+        }
+
+        std::vector<boost::filesystem::path> xmlVec;
+        for(boost::filesystem::directory_iterator i(atlasesPath), end; i != end; ++i) {
+            if(boost::filesystem::is_regular_file(i->path()) && i->path().extension() == ".xml" && i->path().filename() != DICTIONARY_FILE) {
+                xmlVec.push_back(i->path());
+            }
+        }
+        std::sort(xmlVec.begin(), xmlVec.end());
+
+        std::vector<boost::shared_ptr<TiXmlDocument> > docVec;
+        std::vector<const TiXmlElement *> atlasElemVec;
+        for(std::vector<boost::filesystem::path>::const_iterator i = xmlVec.begin(), end = xmlVec.end(); i != end; ++i) {
+            boost::shared_ptr<TiXmlDocument> xmlDocPtr(new TiXmlDocument(i->string().c_str()));
+            const TiXmlElement *rootElemPtr = NULL;
+            if(!xmlDocPtr->LoadFile() || (rootElemPtr = xmlDocPtr->FirstChildElement("Root")) == NULL) {
+                std::cerr << "Error: Failed to load or parse " << i->string() << std::endl;
+                return (false);
+            }
+            docVec.push_back(xmlDocPtr);
+            for(const TiXmlElement *atlasElemPtr = rootElemPtr->FirstChildElement("Atlas"); atlasElemPtr; atlasElemPtr = atlasElemPtr->NextSiblingElement("Atlas")) {
+                atlasElemVec.push_back(atlasElemPtr);
+            }
+        }
+
+        if(atlasElemVec.empty()) {
+            std::cerr << "Error: " << atlasesPath.string() << " holds no atlas xml files." << std::endl;
+            return (false);
+        }
+
+        const boost::filesystem::path dictionaryPath(atlasesPath / BINARY_DICTIONARY_FILE);
+        if(!WriteAtlasDictionary(dictionaryPath, atlasElemVec)) {
+            std::cerr << "Error: Failed to write " << dictionaryPath.string() << std::endl;
+            return (false);
+        }
+
+        std::cout << dictionaryPath.string() << ": " << atlasElemVec.size() << " atlas(es)" << std::endl;
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Pack the images of a directory into an atlas and write it.
+    //
+    // @param atlasElemPtrRef Output <Atlas> element, owned by the caller,
+    //                          or NULL if the directory holds no images.
+    //
+    // @return bool False on failure.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool MakeAtlas(const boost::filesystem::path &imagesPath, const boost::filesystem::path &atlasesPath, \
+                   const AtlasPackerOptions &optionsRef, const bool alpha, TiXmlElement *&atlasElemPtrRef)
+    {
+        atlasElemPtrRef = NULL;
+        const std::string atlasName(imagesPath.filename().string());
+
+        std::vector<std::string> imageNameVec;
+        U32 totalBytes = 0;
+        for(boost::filesystem::directory_iterator i(imagesPath), end; i != end; ++i) {
+            const std::string fileName(i->path().filename().string());
+            const GameHalloran::ImageType type = GameHalloran::FindImageTypeFromFile(fileName);
+            if(fileName[0] == '.' || !boost::filesystem::is_regular_file(i->path()) || \
+               type == GameHalloran::IMAGE_TYPE_UNKNOWN || type == GameHalloran::IMAGE_TYPE_BCT) {
+                continue;
+            }
+            imageNameVec.push_back(fileName);
+            totalBytes += U32(boost::filesystem::file_size(i->path()));
+        }
+        if(imageNameVec.empty()) {
+            std::cout << atlasName << ": No images, skipped." << std::endl;
+            return (true);
+        }
+        std::sort(imageNameVec.begin(), imageNameVec.end());
+
+        // Cache large enough to hold every image file.
+        GameHalloran::ResCache resCache(totalBytes / (1024 * 1024) + 1, new DirectoryFile(imagesPath), boost::shared_ptr<GameHalloran::GameLog>());
+        if(!resCache.Init()) {
+            std::cerr << "Error: Failed to open " << imagesPath.string() << std::endl;
+            return (false);
+        }
+
+        AtlasPacker packer(optionsRef);
+        std::vector< std::vector<U8> > imageVec(imageNameVec.size());
+        for(size_t i = 0; i < imageNameVec.size(); ++i) {
+            GameHalloran::ImageResource imgRes(imageNameVec[i]);
+            boost::shared_ptr<GameHalloran::ImageResHandle> imagePtr = boost::static_pointer_cast<GameHalloran::ImageResHandle>(resCache.GetHandle(&imgRes));
+            if(!imagePtr || !imagePtr->VInitialize() || !GameHalloran::ConvertImageToRgba(*imagePtr, imageVec[i])) {
+                std::cerr << "Error: Failed to decode the image " << (imagesPath / imageNameVec[i]).string() << std::endl;
+                return (false);
+            }
+            packer.AddImage(imageNameVec[i], U32(imagePtr->GetImageWidth()), U32(imagePtr->GetImageHeight()));
+        }
+
+        const F64 startTime = GetTime();
+        if(!packer.Pack()) {
+            std::cerr << "Error: The images in " << imagesPath.string() << " do not fit in a " << optionsRef.m_maxSize << "x" \
+                      << optionsRef.m_maxSize << " atlas." << std::endl;
+            return (false);
+        }
+        const F64 packTime = GetTime() - startTime;
+
+        std::vector<U8> atlasVec(packer.GetWidth() * packer.GetHeight() * 4, 0);
+        for(U32 i = 0; i < packer.GetNumberImages(); ++i) {
+            packer.CopyImage(i, &imageVec[i][0], &atlasVec[0]);
+        }
+
+        const boost::filesystem::path tgaPath(atlasesPath / (atlasName + ".tga"));
+        if(!WriteTga(tgaPath, atlasVec, packer.GetWidth(), packer.GetHeight(), alpha)) {
+            std::cerr << "Error: Failed to write " << tgaPath.string() << std::endl;
+            return (false);
+        }
+
+        TiXmlElement *atlasElemPtr = packer.CreateXmlElement(atlasName, alpha ? "RGBA" : "RGB", "tga");
+        std::vector<const TiXmlElement *> atlasElemVec(1, atlasElemPtr);
+        const boost::filesystem::path xmlPath(atlasesPath / (atlasName + ".xml"));
+        if(!WriteAtlasXml(xmlPath, atlasElemVec)) {
+            std::cerr << "Error: Failed to write " << xmlPath.string() << std::endl;
+            delete atlasElemPtr;
+            return (false);
+        }
+
+        std::cout << atlasName << ": " << packer.GetNumberImages() << " image(s) in " << packer.GetWidth() << "x" << packer.GetHeight() \
+                  << std::fixed << std::setprecision(1) << ", " << (packer.GetOccupancy() * 100.0f) << "% occupied, packed in " \
+                  << std::setprecision(3) << (packTime * 1000.0) << " ms" << std::endl;
+        atlasElemPtrRef = atlasElemPtr;
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Time packing a number of generated sprites (4 to 64 texels a side,
+    // a few larger panels) with each method, with and without rotation.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void BenchmarkPacking(const U32 numberSprites, const AtlasPackerOptions &optionsRef)
+    {
+        std::vector< std::pair<U32, U32> > sizeVec(numberSprites);
+        U32 seed = 12345;
+        for(U32 i = 0; i < numberSprites; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            const U32 scale = ((seed >> 24) < 8) ? 4 : 1;
+            seed = seed * 1664525u + 1013904223u;
+            sizeVec[i].first = (4 + (seed >> 8) % 61) * scale;
+            seed = seed * 1664525u + 1013904223u;
+            sizeVec[i].second = (4 + (seed >> 8) % 61) * scale;
+        }
+
+        std::cout << "Packing " << numberSprites << " sprites, border " << optionsRef.m_border \
+                  << (optionsRef.m_powerOfTwo ? ", power of two" : "") << ":" << std::endl;
+        for(U32 method = GameHalloran::ATLAS_PACKING_FIRST; method < GameHalloran::ATLAS_PACKING_COUNT; ++method) {
+            for(U32 rotate = 0; rotate < 2; ++rotate) {
+                AtlasPackerOptions options(optionsRef);
+                options.m_method = GameHalloran::AtlasPackingMethod(method);
+                options.m_allowRotation = (rotate != 0);
+                AtlasPacker packer(options);
+                for(U32 i = 0; i < numberSprites; ++i) {
+                    packer.AddImage("sprite", sizeVec[i].first, sizeVec[i].second);
+                }
+
+                const F64 startTime = GetTime();
+                const bool packed = packer.Pack();
+                const F64 packTime = GetTime() - startTime;
+
+                std::cout << "\t" << std::setw(8) << GameHalloran::FindStringFromAtlasPackingMethod(options.m_method) \
+                          << (options.m_allowRotation ? " rotated: " : ":         ");
+                if(!packed) {
+                    std::cout << "does not fit in " << options.m_maxSize << "x" << options.m_maxSize << std::endl;
+                    continue;
+                }
+                std::cout << std::setw(5) << packer.GetWidth() << "x" << std::setw(5) << std::left << packer.GetHeight() << std::right \
+                          << std::fixed << std::setprecision(1) << std::setw(6) << (packer.GetOccupancy() * 100.0f) << "% occupied " \
+                          << std::setprecision(2) << std::setw(9) << (packTime * 1000.0) << " ms" << std::endl;
+            }
+        }
+    }
+
+}
+
+// /////////////////////////////////////////////////////////////////
+// Print out usage information.
+//
+// @param programNameStr The name of the executable.
+//
+// /////////////////////////////////////////////////////////////////
+void PrintUsage(const char *programNameStr)
+{
+    if(!programNameStr) {
+        std::cerr << "Error: Program name not supplied to PrintUsage()." << std::endl;
+        return;
+    }
+
+    std::cout << programNameStr << " [-h] [--help] [-p maxrects|skyline] [-r] [-b border] [-n] [-s maxSize] [-m RGBA|RGB] ResPath" << std::endl;
+    std::cout << programNameStr << " -d ResPath" << std::endl;
+    std::cout << programNameStr << " [-p ...] [-r] [-b ...] [-n] [-s ...] --benchmark NumberSprites" << std::endl;
+    std::cout << "\t-p = The packing method (default: maxrects)." << std::endl;
+    std::cout << "\t-r = Allow images to be rotated 90 degrees (the GUI does not support rotated images)." << std::endl;
+    std::cout << "\t-b = Texels of border around each image (default: 1)." << std::endl;
+    std::cout << "\t-n = Do not round the atlas size up to powers of two." << std::endl;
+    std::cout << "\t-s = The largest atlas width and height (default: 4096)." << std::endl;
+    std::cout << "\t-m = The atlas image mode (default: RGBA)." << std::endl;
+    std::cout << "\t-d = Only write " << BINARY_DICTIONARY_FILE << " from the atlas xml files in ResPath/" << ATLASES_DIR << "/." << std::endl;
+    std::cout << "\tResPath = The resource directory, holding a directory of images per atlas under " << IMAGES_DIR << "/." << std::endl;
+}
+
+// /////////////////////////////////////////////////////////////////
+// Main entry point.
+//
+//
+// /////////////////////////////////////////////////////////////////
+int main(int argc, char *argv[])
+{
+    AtlasPackerOptions options;                                 // How to lay out the atlases.
+    bool alpha = true;                                          // Write RGBA atlases?
+    U32 benchmarkSprites = 0;                                   // Number of sprites to benchmark, 0 to bake atlases.
+    bool convertOnly = false;                                   // Only convert the atlas xml to a binary dictionary?
+    std::vector<const char *> pathStrVec;                       // Resource path.
+
+    for(int i = 1; i < argc; ++i) {
+        if(strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+            PrintUsage(argv[0]);
+            return (0);
+        } else if(strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+            options.m_method = GameHalloran::FindAtlasPackingMethodFromString(argv[++i]);
+            if(options.m_method == GameHalloran::ATLAS_PACKING_UNKNOWN) {
+                std::cerr << "Unknown packing method " << argv[i] << ".\n" << std::endl;
+                PrintUsage(argv[0]);
+                return (-1);
+            }
+        } else if(strcmp(argv[i], "-r") == 0) {
+            options.m_allowRotation = true;
+        } else if(strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+            options.m_border = U32(atoi(argv[++i]));
+        } else if(strcmp(argv[i], "-n") == 0) {
+            options.m_powerOfTwo = false;
+        } else if(strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            options.m_maxSize = U32(atoi(argv[++i]));
+        } else if(strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+            const std::string mode(argv[++i]);
+            if(mode != "RGBA" && mode != "RGB") {
+                std::cerr << "Unknown image mode " << mode << ".\n" << std::endl;
+                PrintUsage(argv[0]);
+                return (-1);
+            }
+            alpha = (mode == "RGBA");
+        } else if(strcmp(argv[i], "-d") == 0) {
+            convertOnly = true;
+        } else if(strcmp(argv[i], "--benchmark") == 0 && i + 1 < argc) {
+            benchmarkSprites = U32(atoi(argv[++i]));
+        } else {
+            pathStrVec.push_back(argv[i]);
+        }
+    }
+
+    if(options.m_maxSize == 0 || options.m_maxSize > 0xFFFF) {
+        std::cerr << "The largest atlas size must be between 1 and 65535.\n" << std::endl;
+        PrintUsage(argv[0]);
+        return (-1);
+    }
+
+    if(benchmarkSprites != 0) {
+        BenchmarkPacking(benchmarkSprites, options);
+        return (0);
+    }
+
+    if(pathStrVec.size() != 1) {
+        std::cerr << "Incorrect arguments supplied.\n" << std::endl;
+        PrintUsage(argv[0]);
+        return (-1);
+    }
+
+    const boost::filesystem::path resPath(pathStrVec[0]);
+    const boost::filesystem::path imagesPath(resPath / IMAGES_DIR);
+    const boost::filesystem::path atlasesPath(resPath / ATLASES_DIR);
+    if(convertOnly) {
+        return (ConvertAtlasXml(atlasesPath) ? 0 : -1);
+    }
+
+    if(!boost::filesystem::is_directory(imagesPath)) {
+        std::cerr << "Error: " << resPath.string() << " does not contain an images directory named " << IMAGES_DIR << std::endl;
+        return (-1);
+    }
+    boost::system::error_code error;
+    boost::filesystem::create_directories(atlasesPath, error);
+    if(!boost::filesystem::is_directory(atlasesPath)) {
+        std::cerr << "Error: Failed to create " << atlasesPath.string() << std::endl;
+        return (-1);
+    }
+
+    std::vector<boost::filesystem::path> dirVec;
+    for(boost::filesystem::directory_iterator i(imagesPath), end; i != end; ++i) {
+        const std::string dirName(i->path().filename().string());
+        if(boost::filesystem::is_directory(i->path()) && dirName[0] != '.' && dirName != NO_ATLAS_DIR) {
+            dirVec.push_back(i->path());
+        }
+    }
+    std::sort(dirVec.begin(), dirVec.end());
+
+    std::vector<const TiXmlElement *> atlasElemVec;
+    int result = 0;
+    for(std::vector<boost::filesystem::path>::const_iterator i = dirVec.begin(), end = dirVec.end(); i != end; ++i) {
+        TiXmlElement *atlasElemPtr = NULL;
+        if(!MakeAtlas(*i, atlasesPath, options, alpha, atlasElemPtr)) {
+            result = -1;
+        } else if(atlasElemPtr) {
+            atlasElemVec.push_back(atlasElemPtr);
+        }
+    }
+
+    if(!atlasElemVec.empty() && !WriteAtlasXml(atlasesPath / DICTIONARY_FILE, atlasElemVec)) {
+        std::cerr << "Error: Failed to write " << (atlasesPath / DICTIONARY_FILE).string() << std::endl;
+        result = -1;
+    }
+
+    if(!atlasElemVec.empty() && !WriteAtlasDictionary(atlasesPath / BINARY_DICTIONARY_FILE, atlasElemVec)) {
+        std::cerr << "Error: Failed to write " << (atlasesPath / BINARY_DICTIONARY_FILE).string() << std::endl;
+        result = -1;
+    }
+
+    for(std::vector<const TiXmlElement *>::iterator i = atlasElemVec.begin(), end = atlasElemVec.end(); i != end; ++i) {
+        delete *i;
+    }
+
+    return (result);
+}
@@ -0,0 +1,442 @@
+// /////////////////////////////////////////////////////////////////////////////
+// @file main.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Headless container benchmark.  Times DynamicArray against std::vector
+// with a POD element (a 16 byte struct) and a non-POD element
+// (std::string, too long for the small string buffer): pushing onto an
+// empty array so it reallocates as it grows, pushing into a reserved
+// array, reading every element and inserting in the middle.  Checks both
+// containers end with the same contents.
+//
+// Then times pushing and popping through the pool backed LinkedList,
+// Queue and RingBufferQueue against std::list and std::deque: a queue
+// kept at a fixed depth (push one, pop one), filling and draining the
+// whole queue, and creating and destroying empty lists.
+//
+// Usage: ContainerBenchmark [numberElements] [numberRuns]
+//
+// /////////////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <deque>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include "GameBase.h"
+#include "DynamicArray.h"
+#include "LinkedList.h"
+#include "Queue.h"
+#include "RingBufferQueue.h"
+
+using GameHalloran::U32;
+using GameHalloran::U64;
+using GameHalloran::F32;
+using GameHalloran::F64;
+using GameHalloran::DynamicArray;
+using GameHalloran::LinkedList;
+using GameHalloran::Queue;
+using GameHalloran::RingBufferQueue;
+
+namespace {
+
+    const U32 DEFAULT_NUMBER_ELEMENTS = 1000000;    ///< Elements pushed in each run.
+    const U32 DEFAULT_NUMBER_RUNS = 5;              ///< Runs averaged.
+    const U32 NUMBER_INSERTS = 1000;                ///< Middle inserts, each shifts half the array.
+    const U32 QUEUE_DEPTH = 64;                     ///< Elements kept in the queue by the steady state run.
+    const U32 NUMBER_EMPTY_LISTS = 100000;          ///< Empty lists created and destroyed.
+
+    // /////////////////////////////////////////////////////////////////
+    // @struct PodElement
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct PodElement {
+        F32 m_x, m_y, m_z;
+        U32 m_id;
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Get the current wall clock time in seconds.
+    //
+    // /////////////////////////////////////////////////////////////////
+    F64 GetSeconds()
+    {
+        static const boost::posix_time::ptime epoch(boost::posix_time::microsec_clock::universal_time());
+        return (F64((boost::posix_time::microsec_clock::universal_time() - epoch).total_microseconds()) / 1000000.0);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Make the i'th element.
+    //
+    // /////////////////////////////////////////////////////////////////
+    PodElement MakeElement(const U32 i, const PodElement *)
+    {
+        PodElement e;
+        e.m_x = F32(i);
+        e.m_y = F32(i) * 0.5f;
+        e.m_z = F32(i) * 0.25f;
+        e.m_id = i;
+        return (e);
+    }
+
+    std::string MakeElement(const U32 i, const std::string *)
+    {
+        return (std::string("a string too long for the small buffer ") + std::string(1, char('a' + i % 26)));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Sum an element into a checksum.
+    //
+    // /////////////////////////////////////////////////////////////////
+    U64 Checksum(const PodElement &e)
+    {
+        return (U64(e.m_id) + U64(e.m_x));
+    }
+
+    U64 Checksum(const std::string &e)
+    {
+        return (U64(e.size()) + U64(U32(e[e.size() - 1])));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Times of each operation of one container.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct Times {
+        F64 m_push;
+        F64 m_reservedPush;
+        F64 m_read;
+        F64 m_insert;
+        U64 m_checksum;
+
+        Times() : m_push(0.0), m_reservedPush(0.0), m_read(0.0), m_insert(0.0), m_checksum(0) {};
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Run the operations on a DynamicArray.
+    //
+    // /////////////////////////////////////////////////////////////////
+    template<typename T>
+    void RunDynamicArray(const U32 numberElements, Times &times)
+    {
+        const T *tag = NULL;
+        F64 start = GetSeconds();
+        {
+            DynamicArray<T> arr(U64(0));
+            for(U32 i = 0; i < numberElements; ++i) {
+                arr.PushBack(MakeElement(i, tag));
+            }
+        }
+        times.m_push += GetSeconds() - start;
+
+        DynamicArray<T> arr(U64(0));
+        start = GetSeconds();
+        arr.Reserve(numberElements + NUMBER_INSERTS);
+        for(U32 i = 0; i < numberElements; ++i) {
+            arr.PushBack(MakeElement(i, tag));
+        }
+        times.m_reservedPush += GetSeconds() - start;
+
+        start = GetSeconds();
+        U64 checksum = 0;
+        for(U64 i = 0, size = arr.GetSize(); i < size; ++i) {
+            checksum += Checksum(arr[i]);
+        }
+        times.m_read += GetSeconds() - start;
+
+        start = GetSeconds();
+        for(U32 i = 0; i < NUMBER_INSERTS; ++i) {
+            typename DynamicArray<T>::Iterator position(arr.GetSize() / 2, &arr);
+            arr.InsertAndMove(MakeElement(i, tag), position);
+        }
+        times.m_insert += GetSeconds() - start;
+
+        for(U64 i = 0, size = arr.GetSize(); i < size; i += size / 64 + 1) {
+            checksum += Checksum(arr[i]) * i;
+        }
+        times.m_checksum = checksum;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Run the same operations on a std::vector.
+    //
+    // /////////////////////////////////////////////////////////////////
+    template<typename T>
+    void RunVector(const U32 numberElements, Times &times)
+    {
+        const T *tag = NULL;
+        F64 start = GetSeconds();
+        {
+            std::vector<T> arr;
+            for(U32 i = 0; i < numberElements; ++i) {
+                arr.push_back(MakeElement(i, tag));
+            }
+        }
+        times.m_push += GetSeconds() - start;
+
+        std::vector<T> arr;
+        start = GetSeconds();
+        arr.reserve(numberElements + NUMBER_INSERTS);
+        for(U32 i = 0; i < numberElements; ++i) {
+            arr.push_back(MakeElement(i, tag));
+        }
+        times.m_reservedPush += GetSeconds() - start;
+
+        start = GetSeconds();
+        U64 checksum = 0;
+        for(size_t i = 0, size = arr.size(); i < size; ++i) {
+            checksum += Checksum(arr[i]);
+        }
+        times.m_read += GetSeconds() - start;
+
+        start = GetSeconds();
+        for(U32 i = 0; i < NUMBER_INSERTS; ++i) {
+            arr.insert(arr.begin() + arr.size() / 2, MakeElement(i, tag));
+        }
+        times.m_insert += GetSeconds() - start;
+
+        for(U64 i = 0, size = arr.size(); i < size; i += size / 64 + 1) {
+            checksum += Checksum(arr[size_t(i)]) * i;
+        }
+        times.m_checksum = checksum;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Print one operation of both containers.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void PrintOperation(const char *name, const F64 dynamicArraySeconds, const F64 vectorSeconds, const U32 numberRuns)
+    {
+        std::cout << std::fixed << std::setprecision(3) << "     " << std::left << std::setw(14) << name << std::right
+                  << "  DynamicArray " << std::setw(8) << (dynamicArraySeconds * 1000.0 / F64(numberRuns)) << "ms"
+                  << "  std::vector " << std::setw(8) << (vectorSeconds * 1000.0 / F64(numberRuns)) << "ms"
+                  << "  ratio " << std::setw(5) << (dynamicArraySeconds / vectorSeconds) << std::endl;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Benchmark both containers with one element type.
+    //
+    // @return bool False if the containers ended with different contents.
+    //
+    // /////////////////////////////////////////////////////////////////
+    template<typename T>
+    bool BenchmarkElement(const char *name, const U32 numberElements, const U32 numberRuns)
+    {
+        Times dynamicArrayTimes, vectorTimes;
+        for(U32 run = 0; run < numberRuns; ++run) {
+            RunDynamicArray<T>(numberElements, dynamicArrayTimes);
+            RunVector<T>(numberElements, vectorTimes);
+        }
+
+        std::cout << name << ", " << numberElements << " elements, " << NUMBER_INSERTS << " middle inserts, average of " << numberRuns << " runs" << std::endl;
+        PrintOperation("push", dynamicArrayTimes.m_push, vectorTimes.m_push, numberRuns);
+        PrintOperation("reserved push", dynamicArrayTimes.m_reservedPush, vectorTimes.m_reservedPush, numberRuns);
+        PrintOperation("read", dynamicArrayTimes.m_read, vectorTimes.m_read, numberRuns);
+        PrintOperation("middle insert", dynamicArrayTimes.m_insert, vectorTimes.m_insert, numberRuns);
+
+        if(dynamicArrayTimes.m_checksum != vectorTimes.m_checksum) {
+            std::cerr << "The " << name << " contents of the containers differ" << std::endl;
+            return (false);
+        }
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Adapters giving each queue the same push to the back and pop from
+    // the front interface.  The game Queues push to the front and pop
+    // from the back.
+    //
+    // /////////////////////////////////////////////////////////////////
+    template<typename T>
+    struct LinkedListAdapter {
+        LinkedList<T> m_queue;
+        static const char *GetName() {
+            return ("LinkedList");
+        };
+        void Push(const T &val) {
+            m_queue.PushBack(val);
+        };
+        bool Pop(T &val) {
+            return (m_queue.Front(val) && m_queue.PopFront());
+        };
+    };
+
+    template<typename T>
+    struct QueueAdapter {
+        Queue<T> m_queue;
+        static const char *GetName() {
+            return ("Queue");
+        };
+        void Push(const T &val) {
+            m_queue.PushFront(val);
+        };
+        bool Pop(T &val) {
+            return (m_queue.PopBack(val));
+        };
+    };
+
+    template<typename T>
+    struct RingBufferQueueAdapter {
+        RingBufferQueue<T> m_queue;
+        static const char *GetName() {
+            return ("RingBufferQueue");
+        };
+        void Push(const T &val) {
+            m_queue.PushFront(val);
+        };
+        bool Pop(T &val) {
+            return (m_queue.PopBack(val));
+        };
+    };
+
+    template<typename T>
+    struct StdListAdapter {
+        std::list<T> m_queue;
+        static const char *GetName() {
+            return ("std::list");
+        };
+        void Push(const T &val) {
+            m_queue.push_back(val);
+        };
+        bool Pop(T &val) {
+            if(m_queue.empty()) {
+                return (false);
+            }
+            val = m_queue.front();
+            m_queue.pop_front();
+            return (true);
+        };
+    };
+
+    template<typename T>
+    struct StdDequeAdapter {
+        std::deque<T> m_queue;
+        static const char *GetName() {
+            return ("std::deque");
+        };
+        void Push(const T &val) {
+            m_queue.push_back(val);
+        };
+        bool Pop(T &val) {
+            if(m_queue.empty()) {
+                return (false);
+            }
+            val = m_queue.front();
+            m_queue.pop_front();
+            return (true);
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Time pushing and popping through one queue.
+    //
+    // @return bool False if the elements came out in the wrong order.
+    //
+    // /////////////////////////////////////////////////////////////////
+    template<typename T, typename Adapter>
+    bool BenchmarkQueue(const U32 numberElements, const U32 numberRuns)
+    {
+        const T *tag = NULL;
+        F64 steadySeconds = 0.0, fillSeconds = 0.0;
+        bool ordered = true;
+        for(U32 run = 0; run < numberRuns; ++run) {
+            Adapter steady;
+            T val;
+            F64 start = GetSeconds();
+            for(U32 i = 0; i < QUEUE_DEPTH; ++i) {
+                steady.Push(MakeElement(i, tag));
+            }
+            for(U32 i = QUEUE_DEPTH; i < numberElements; ++i) {
+                steady.Push(MakeElement(i, tag));
+                ordered = steady.Pop(val) && Checksum(val) == Checksum(MakeElement(i - QUEUE_DEPTH, tag)) && ordered;
+            }
+            steadySeconds += GetSeconds() - start;
+
+            Adapter fill;
+            start = GetSeconds();
+            for(U32 i = 0; i < numberElements; ++i) {
+                fill.Push(MakeElement(i, tag));
+            }
+            for(U32 i = 0; i < numberElements; ++i) {
+                ordered = fill.Pop(val) && Checksum(val) == Checksum(MakeElement(i, tag)) && ordered;
+            }
+            fillSeconds += GetSeconds() - start;
+        }
+
+        std::cout << std::fixed << std::setprecision(3) << "     " << std::left << std::setw(16) << Adapter::GetName() << std::right
+                  << "  steady " << std::setw(8) << (steadySeconds * 1000.0 / F64(numberRuns)) << "ms"
+                  << "  fill and drain " << std::setw(8) << (fillSeconds * 1000.0 / F64(numberRuns)) << "ms"
+                  << (ordered ? "" : "  OUT OF ORDER") << std::endl;
+        return (ordered);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Benchmark every queue with one element type.
+    //
+    // /////////////////////////////////////////////////////////////////
+    template<typename T>
+    bool BenchmarkQueues(const char *name, const U32 numberElements, const U32 numberRuns)
+    {
+        std::cout << name << ", " << numberElements << " pushes and pops, steady depth " << QUEUE_DEPTH << ", average of " << numberRuns << " runs" << std::endl;
+        bool result = BenchmarkQueue<T, LinkedListAdapter<T> >(numberElements, numberRuns);
+        result = BenchmarkQueue<T, QueueAdapter<T> >(numberElements, numberRuns) && result;
+        result = BenchmarkQueue<T, RingBufferQueueAdapter<T> >(numberElements, numberRuns) && result;
+        result = BenchmarkQueue<T, StdListAdapter<T> >(numberElements, numberRuns) && result;
+        result = BenchmarkQueue<T, StdDequeAdapter<T> >(numberElements, numberRuns) && result;
+        return (result);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Time creating and destroying empty lists.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void BenchmarkEmptyLists(const U32 numberRuns)
+    {
+        F64 listSeconds = 0.0, stdListSeconds = 0.0;
+        for(U32 run = 0; run < numberRuns; ++run) {
+            F64 start = GetSeconds();
+            for(U32 i = 0; i < NUMBER_EMPTY_LISTS; ++i) {
+                LinkedList<PodElement> list;
+            }
+            listSeconds += GetSeconds() - start;
+
+            start = GetSeconds();
+            for(U32 i = 0; i < NUMBER_EMPTY_LISTS; ++i) {
+                std::list<PodElement> list;
+            }
+            stdListSeconds += GetSeconds() - start;
+        }
+
+        std::cout << std::fixed << std::setprecision(3) << NUMBER_EMPTY_LISTS << " empty lists created and destroyed, average of " << numberRuns << " runs" << std::endl
+                  << "     " << std::left << std::setw(16) << "LinkedList" << std::right << "  " << std::setw(8) << (listSeconds * 1000.0 / F64(numberRuns)) << "ms" << std::endl
+                  << "     " << std::left << std::setw(16) << "std::list" << std::right << "  " << std::setw(8) << (stdListSeconds * 1000.0 / F64(numberRuns)) << "ms" << std::endl;
+    }
+
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+int main(int args, char *argv[])
+{
+    const U32 numberElements = (args > 1) ? U32(atoi(argv[1])) : DEFAULT_NUMBER_ELEMENTS;
+    const U32 numberRuns = (args > 2) ? U32(atoi(argv[2])) : DEFAULT_NUMBER_RUNS;
+    if(numberElements == 0 || numberRuns == 0) {
+        std::cerr << "The number of elements and runs must be greater than 0" << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    const bool result = BenchmarkElement<PodElement>("POD (16 byte struct)", numberElements, numberRuns)
+                        && BenchmarkElement<std::string>("non-POD (std::string)", numberElements, numberRuns)
+                        && BenchmarkQueues<PodElement>("POD (16 byte struct)", numberElements, numberRuns)
+                        && BenchmarkQueues<std::string>("non-POD (std::string)", numberElements, numberRuns);
+    BenchmarkEmptyLists(numberRuns);
+
+    return (result ? EXIT_SUCCESS : EXIT_FAILURE);
+}
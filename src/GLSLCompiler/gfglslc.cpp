@@ -7,11 +7,21 @@
 // geometry shaders compile and link successfully and the resulting
 // GLSL program is okay.
 //
+// Run with -m to pack every program listed in a shader manifest into
+// a shader archive (.gsa) the game loads with a single read.  Each
+// program's sources are preprocessed (#include and the defines of
+// each permutation of its options) and identical sources are stored
+// once.  Preprocessing and packing need no OpenGL context; add
+// --validate to also compile and link each distinct program.
+//
 // /////////////////////////////////////////////////////////////////
 
 // External Headers
 #include <iostream>
+#include <fstream>
 #include <string>
+#include <vector>
+#include <set>
 #include <cstring>
 
 #include <boost/filesystem.hpp>
@@ -21,6 +31,141 @@
 
 // Project Headers
 #include "GLSLShader.h"
+#include "ShaderArchive.h"
+
+using GameHalloran::U8;
+using GameHalloran::U32;
+using GameHalloran::U64;
+using GameHalloran::ShaderManifestProgram;
+using GameHalloran::ShaderManifestPermutation;
+
+namespace {
+
+    // /////////////////////////////////////////////////////////////////
+    // Create a window for the OpenGL context and initialize GLEW.  The
+    // context is the OpenGL 3.2 core one the game asks for, so shaders
+    // are checked against the GLSL version they are written for.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool InitOpenGL()
+    {
+        if(glfwInit() != GL_TRUE) {
+            std::cerr << "Failed to initialize GLFW" << std::endl;
+            return (false);
+        }
+
+        glfwOpenWindowHint(GLFW_OPENGL_VERSION_MAJOR, 3);
+        glfwOpenWindowHint(GLFW_OPENGL_VERSION_MINOR, 2);
+        glfwOpenWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        if(glfwOpenWindow(640, 480, 8, 8, 8, 8, 24, 0, GLFW_WINDOW) != GL_TRUE) {
+            std::cerr << "Failed to open an OpenGL 3.2 core window" << std::endl;
+            glfwTerminate();
+            return (false);
+        }
+
+        glewExperimental = GL_TRUE;
+        GLenum res = glewInit();
+        if(GLEW_OK != res) {
+            // Problem: glewInit failed, something is seriously wrong.
+            std::cerr << "Failed to initialize the GLEW library: " << std::string(reinterpret_cast<const char *>(glewGetErrorString(res))) << std::endl;
+            glfwTerminate();
+            return (false);
+        }
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Compile and link each distinct program, as the game would build
+    // it from the archive.
+    //
+    // @return U32 The number of programs which failed.
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 ValidatePrograms(const std::vector<ShaderManifestPermutation> &packed)
+    {
+        const GameHalloran::VSAttributeNameList nameList;
+        std::set<U64> validated;
+        U32 failures = 0;
+
+        for(std::vector<ShaderManifestPermutation>::const_iterator i = packed.begin(), end = packed.end(); i != end; ++i) {
+            const char *gsSrc = i->m_hasGs ? i->m_gsSrc.c_str() : NULL;
+            if(!validated.insert(GameHalloran::HashShaderProgramSource(i->m_vsSrc.c_str(), gsSrc, i->m_fsSrc.c_str(), nameList)).second) {
+                continue;
+            }
+
+            GameHalloran::GLSLShader shaderProg;
+            std::string errorMsg;
+            bool buildResult;
+            if(gsSrc) {
+                buildResult = shaderProg.Build(i->m_vsSrc.c_str(), gsSrc, i->m_fsSrc.c_str(), nameList, errorMsg);
+            } else {
+                buildResult = shaderProg.Build(i->m_vsSrc.c_str(), i->m_fsSrc.c_str(), nameList, errorMsg);
+            }
+
+            if(!buildResult) {
+                std::cout << "Error: " << i->m_name << ": " << errorMsg << std::endl;
+                ++failures;
+            } else if(!shaderProg.Activate()) {
+                std::cout << "Error: " << i->m_name << ": Failed to activate the shader." << std::endl;
+                ++failures;
+            }
+        }
+
+        std::cout << "Validated " << validated.size() << " distinct programs, " << failures << " failed." << std::endl;
+        return (failures);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Pack the programs of a manifest into a shader archive.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool PackManifest(const boost::filesystem::path &manifestPath, const boost::filesystem::path &archivePath, const bool validate)
+    {
+        std::vector<ShaderManifestProgram> programs;
+        std::vector<ShaderManifestPermutation> packed;
+        const boost::filesystem::path shaderDir(manifestPath.parent_path());
+        std::string message;
+        if(!GameHalloran::ReadShaderManifest(manifestPath, programs, message) || !GameHalloran::PreprocessShaderManifest(shaderDir, programs, packed, message)) {
+            std::cerr << "Error: " << message << std::endl;
+            return (false);
+        }
+
+        GameHalloran::ShaderArchiveWriter writer;
+        for(std::vector<ShaderManifestPermutation>::const_iterator i = packed.begin(), end = packed.end(); i != end; ++i) {
+            if(!writer.AddProgram(i->m_name, i->m_vsSrc.c_str(), i->m_hasGs ? i->m_gsSrc.c_str() : NULL, i->m_fsSrc.c_str())) {
+                std::cerr << "Error: " << i->m_name << " is listed twice or its name hash collides with another program" << std::endl;
+                return (false);
+            }
+        }
+
+        std::vector<U8> archive;
+        writer.Encode(archive);
+        std::ofstream out(archivePath.string().c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char *>(&archive[0]), std::streamsize(archive.size()));
+        out.close();
+        if(out.fail()) {
+            std::cerr << "Error: Failed to write " << archivePath.string() << std::endl;
+            return (false);
+        }
+
+        std::cout << "Packed " << writer.GetNumberPrograms() << " programs from " << programs.size() << " manifest entries into " \
+                  << archivePath.string() << " (" << archive.size() << " bytes): " << writer.GetNumberSourcesStored() << " of " \
+                  << writer.GetNumberSources() << " stage sources stored after removing duplicates." << std::endl;
+
+        if(validate) {
+            if(!InitOpenGL()) {
+                return (false);
+            }
+            const U32 failures = ValidatePrograms(packed);
+            glfwTerminate();
+            return (failures == 0);
+        }
+
+        return (true);
+    }
+
+}
 
 // /////////////////////////////////////////////////////////////////
 // Print out usage information.
@@ -36,10 +181,14 @@ void PrintUsage(const char *programNameStr)
     }
 
     std::cout << programNameStr << " [-h] [--help] VSFile FSFile [GSFile]" << std::endl;
+    std::cout << programNameStr << " [--validate] -m Manifest -o Archive" << std::endl;
     std::cout << "\tVSFile = The path of the vertex shader." << std::endl;
     std::cout << "\tFSFile = The path of the fragment shader." << std::endl;
     std::cout << "\tGSFile = The path of the geometry shader (optional)." << std::endl;
     std::cout << "\tPlease note the files must be specified in the order defined above." << std::endl;
+    std::cout << "\t-m = The shader manifest xml, listing each program and its options; shader files and includes are relative to it." << std::endl;
+    std::cout << "\t-o = The shader archive to write, e.g. data/shaders/shaders." << GameHalloran::SHADER_ARCHIVE_EXTENSION << "." << std::endl;
+    std::cout << "\t--validate = Also compile and link each distinct program (needs an OpenGL context)." << std::endl;
 }
 
 // /////////////////////////////////////////////////////////////////
@@ -52,40 +201,50 @@ int main(int argc, char *argv[])
     const char *vsFileStr = 0;                  // Vertex shader file path.
     const char *fsFileStr = 0;                  // Fragment shader file path.
     const char *gsFileStr = 0;                  // Geometry shader file path.
+    const char *manifestStr = 0;                // Shader manifest path.
+    const char *archiveStr = 0;                 // Shader archive path.
+    bool validate = false;                      // Validate the packed programs?
+    std::vector<const char *> fileStrVec;       // Shader files to check.
 
-    // Check if the user asked to see the help.
-    for(int i = 0; i < argc; ++i) {
+    for(int i = 1; i < argc; ++i) {
         if(strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
             PrintUsage(argv[0]);
             return (0);
+        } else if(strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+            manifestStr = argv[++i];
+        } else if(strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            archiveStr = argv[++i];
+        } else if(strcmp(argv[i], "--validate") == 0) {
+            validate = true;
+        } else {
+            fileStrVec.push_back(argv[i]);
         }
     }
 
+    if(manifestStr || archiveStr) {
+        if(!manifestStr || !archiveStr || !fileStrVec.empty()) {
+            std::cerr << "Incorrect arguments supplied.\n" << std::endl;
+            PrintUsage(argv[0]);
+            return (-1);
+        }
+        return (PackManifest(boost::filesystem::path(manifestStr), boost::filesystem::path(archiveStr), validate) ? 0 : -1);
+    }
+
     // Set file strings.
-    if(argc == 3) {
-        vsFileStr = argv[1];
-        fsFileStr = argv[2];
-    } else if(argc == 4) {
-        vsFileStr = argv[1];
-        fsFileStr = argv[2];
-        gsFileStr = argv[3];
+    if(fileStrVec.size() == 2) {
+        vsFileStr = fileStrVec[0];
+        fsFileStr = fileStrVec[1];
+    } else if(fileStrVec.size() == 3) {
+        vsFileStr = fileStrVec[0];
+        fsFileStr = fileStrVec[1];
+        gsFileStr = fileStrVec[2];
     } else {
         std::cerr << "Incorrect arguments supplied.\n" << std::endl;
         PrintUsage(argv[0]);
         return (-1);
     }
 
-    //vsFileStr = "C:/Documents and Settings/HP_Administrator/My Documents/Visual Studio 2008/Projects/gameframework/trunk/src/graphics/shaders/phong.vp";
-    //fsFileStr = "C:/Documents and Settings/HP_Administrator/My Documents/Visual Studio 2008/Projects/gameframework/trunk/src/graphics/shaders/phong.fp";
-
-    glfwInit();
-    glfwOpenWindow(640, 480, 8, 8, 8, 8, 24, 0, GLFW_WINDOW);
-
-    GLenum res = glewInit();
-    if(GLEW_OK != res) {
-        // Problem: glewInit failed, something is seriously wrong.
-        std::cerr << "Failed to initialize the GLEW library: " << std::string(reinterpret_cast<const char *>(glewGetErrorString(res))) << std::endl;
-        glfwTerminate();
+    if(!InitOpenGL()) {
         return (-1);
     }
 
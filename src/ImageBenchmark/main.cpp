@@ -0,0 +1,710 @@
+// /////////////////////////////////////////////////////////////////////////////
+// @file main.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Headless image loading benchmark.  Stores a set of TGA textures (the
+// TGA files in a directory, or generated ones) in three deflated in
+// memory archives: as TGA, re-encoded as PNG and re-encoded as JPEG.
+// Reports the size of each archive and the end to end time to load every
+// image through the ResCache (inflate and decode) with an
+// ImageLoadingPipeline, first on the calling thread and then on
+// WorkerThreadPools of a growing number of threads.  Checks the PNG
+// images decode to exactly the TGA pixels.
+//
+// Then times the CPU image processing functions (mipmap downsampling,
+// premultiplied alpha and format conversion) on a generated square
+// RGBA image, 4096x4096 by default, with the SIMD and the scalar
+// implementations and checks they give exactly the same result.
+//
+// Usage: ImageBenchmark [tgaDirectory|-] [numberRuns] [maxThreads] [processingSize (0 to skip)]
+//
+// /////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstdlib>
+#include <csetjmp>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "zlib/zlib.h"
+#include "png/png.h"
+#include "jpeg/jpeglib.h"
+
+#include "GameBase.h"
+#include "ResCache2.h"
+#include "ImageResource.h"
+#include "ImageLoadingPipeline.h"
+#include "ImageProcessing.h"
+#include "WorkerThreadPool.h"
+
+using GameHalloran::U8;
+using GameHalloran::U32;
+using GameHalloran::I32;
+using GameHalloran::F64;
+using GameHalloran::Resource;
+using GameHalloran::ResCache;
+using GameHalloran::ResourceListing;
+using GameHalloran::ImageResource;
+using GameHalloran::ImageResHandle;
+using GameHalloran::ImageLoadingPipeline;
+using GameHalloran::WorkerThreadPool;
+
+namespace {
+
+    typedef std::vector<U8> ByteVector;
+    typedef std::map<std::string, ByteVector> FileMap;
+
+    const U32 DEFAULT_NUMBER_RUNS = 5;              ///< Loads of each archive averaged.
+    const U32 DEFAULT_MAX_THREADS = 8;              ///< Largest thread count benchmarked.
+    const U32 NUMBER_GENERATED = 16;                ///< Images generated without a directory.
+    const U32 GENERATED_SIZE = 512;                 ///< Width and height of the generated images.
+    const I32 JPEG_QUALITY = 90;                    ///< Quality of the re-encoded JPEGs.
+    const U32 CACHE_SIZE_MB = 256;                  ///< Large enough that no image is evicted.
+    const U32 DEFAULT_PROCESSING_SIZE = 4096;       ///< Width and height of the image processed.
+
+    // /////////////////////////////////////////////////////////////////
+    // @class MemoryArchive
+    //
+    // Resource file of deflated entries held in memory, standing in for
+    // a ZIP archive.  Entries are inflated as the ResCache reads them.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class MemoryArchive : public GameHalloran::IResourceFile {
+    private:
+        struct Entry {
+            ByteVector m_deflated;                  ///< The deflated file.
+            U32 m_size;                             ///< Size of the inflated file.
+        };
+        std::map<std::string, Entry> m_entries;    ///< Files by name.
+        U32 m_deflatedSize;                         ///< Total size of the deflated files.
+
+    public:
+        MemoryArchive() : m_entries(), m_deflatedSize(0) {};
+
+        bool Add(const std::string &name, const ByteVector &data) {
+            Entry &entry = m_entries[name];
+            uLongf length = compressBound(uLong(data.size()));
+            entry.m_deflated.resize(length);
+            if(compress2(&entry.m_deflated[0], &length, &data[0], uLong(data.size()), Z_DEFAULT_COMPRESSION) != Z_OK) {
+                m_entries.erase(name);
+                return (false);
+            }
+            entry.m_deflated.resize(length);
+            entry.m_size = U32(data.size());
+            m_deflatedSize += U32(length);
+            return (true);
+        };
+
+        U32 GetDeflatedSize() const {
+            return (m_deflatedSize);
+        };
+
+        virtual bool VOpen() {
+            return (true);
+        };
+
+        virtual boost::optional<I32> VGetResourceSize(const Resource &r) {
+            std::map<std::string, Entry>::const_iterator i = m_entries.find(r.GetName());
+            if(i == m_entries.end()) {
+                return (boost::optional<I32>());
+            }
+            return (boost::optional<I32>(I32(i->second.m_size)));
+        };
+
+        virtual bool VGetResource(const Resource &r, char *buffer) {
+            std::map<std::string, Entry>::const_iterator i = m_entries.find(r.GetName());
+            if(i == m_entries.end()) {
+                return (false);
+            }
+            uLongf length = i->second.m_size;
+            return (uncompress(reinterpret_cast<Bytef *>(buffer), &length, &i->second.m_deflated[0], uLong(i->second.m_deflated.size())) == Z_OK);
+        };
+
+        virtual bool VGetResourceListing(const std::string &, ResourceListing &listings) {
+            listings.clear();
+            for(std::map<std::string, Entry>::const_iterator i = m_entries.begin(), end = m_entries.end(); i != end; ++i) {
+                listings.push_back(boost::filesystem::path(i->first));
+            }
+            return (!listings.empty());
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Get the current wall clock time in seconds.
+    //
+    // /////////////////////////////////////////////////////////////////
+    F64 GetSeconds()
+    {
+        static const boost::posix_time::ptime epoch(boost::posix_time::microsec_clock::universal_time());
+        return (F64((boost::posix_time::microsec_clock::universal_time() - epoch).total_microseconds()) / 1000000.0);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Build an uncompressed TGA file of smooth gradients and noise, with
+    // an alpha channel if depth is 4.
+    //
+    // /////////////////////////////////////////////////////////////////
+    ByteVector GenerateTga(const U32 seed, const U32 size, const U32 depth)
+    {
+        ByteVector tga(18, 0);
+        tga[2] = 2;
+        tga[12] = U8(size & 0xFF);
+        tga[13] = U8(size >> 8);
+        tga[14] = U8(size & 0xFF);
+        tga[15] = U8(size >> 8);
+        tga[16] = U8(depth * 8);
+
+        U32 noise = seed * 2654435761u + 1;
+        for(U32 y = 0; y < size; ++y) {
+            for(U32 x = 0; x < size; ++x) {
+                noise = noise * 1664525u + 1013904223u;
+                const U32 n = (noise >> 24) & 0x0F;
+                tga.push_back(U8((x * 255 / size + n) & 0xFF));
+                tga.push_back(U8((y * 255 / size + seed * 16 + n) & 0xFF));
+                tga.push_back(U8((((x / 32 + y / 32) & 1) ? 200 : 40) + n));
+                if(depth == 4) {
+                    tga.push_back(U8((x + y) * 255 / (2 * size)));
+                }
+            }
+        }
+
+        return (tga);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Read a file into memory.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ReadFile(const boost::filesystem::path &path, ByteVector &data)
+    {
+        FILE *fd = fopen(path.string().c_str(), "rb");
+        if(fd == NULL) {
+            return (false);
+        }
+        fseek(fd, 0, SEEK_END);
+        data.resize(size_t(ftell(fd)));
+        fseek(fd, 0, SEEK_SET);
+        const bool result = !data.empty() && fread(&data[0], data.size(), 1, fd) == 1;
+        fclose(fd);
+        return (result);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Convert a decoded TGA (BGR(A), bottom up) into top down RGB(A)
+    // rows ready for encoding.
+    //
+    // /////////////////////////////////////////////////////////////////
+    ByteVector TgaToRgbRows(const ImageResHandle &image)
+    {
+        const U32 width = U32(image.GetImageWidth());
+        const U32 height = U32(image.GetImageHeight());
+        const U32 depth = U32(image.GetImageDepth());
+        const U8 *src = reinterpret_cast<const U8 *>(image.GetImageBuffer());
+
+        ByteVector rgb(width * height * depth);
+        for(U32 y = 0; y < height; ++y) {
+            const U8 *srcRow = src + (height - 1 - y) * width * depth;
+            U8 *dstRow = &rgb[y * width * depth];
+            for(U32 x = 0; x < width * depth; x += depth) {
+                for(U32 c = 0; c < depth; ++c) {
+                    dstRow[x + c] = srcRow[x + c];
+                }
+                if(depth >= 3) {
+                    dstRow[x] = srcRow[x + 2];
+                    dstRow[x + 2] = srcRow[x];
+                }
+            }
+        }
+
+        return (rgb);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // libpng write callback appending to a ByteVector.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void PngWriteMemory(png_structp pngPtr, png_bytep data, png_size_t length)
+    {
+        ByteVector *outPtr = static_cast<ByteVector *>(png_get_io_ptr(pngPtr));
+        outPtr->insert(outPtr->end(), data, data + length);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // libpng flush callback.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void PngFlushMemory(png_structp)
+    {
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Encode top down rows as a PNG.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool EncodePng(const ByteVector &rows, const U32 width, const U32 height, const U32 depth, ByteVector &png)
+    {
+        png_structp pngPtr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+        png_infop infoPtr = pngPtr ? png_create_info_struct(pngPtr) : NULL;
+        if(!infoPtr) {
+            png_destroy_write_struct(&pngPtr, NULL);
+            return (false);
+        }
+        if(setjmp(png_jmpbuf(pngPtr))) {
+            png_destroy_write_struct(&pngPtr, &infoPtr);
+            return (false);
+        }
+
+        png_set_write_fn(pngPtr, &png, PngWriteMemory, PngFlushMemory);
+        const int colorType = (depth == 4) ? PNG_COLOR_TYPE_RGB_ALPHA : ((depth == 3) ? PNG_COLOR_TYPE_RGB : PNG_COLOR_TYPE_GRAY);
+        png_set_IHDR(pngPtr, infoPtr, width, height, 8, colorType, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+        png_write_info(pngPtr, infoPtr);
+        for(U32 y = 0; y < height; ++y) {
+            png_write_row(pngPtr, const_cast<png_bytep>(&rows[y * width * depth]));
+        }
+        png_write_end(pngPtr, NULL);
+        png_destroy_write_struct(&pngPtr, &infoPtr);
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Encode top down rows as a JPEG, dropping any alpha channel.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void EncodeJpeg(const ByteVector &rows, const U32 width, const U32 height, const U32 depth, ByteVector &jpeg)
+    {
+        jpeg_compress_struct cinfo;
+        jpeg_error_mgr errorMgr;
+        cinfo.err = jpeg_std_error(&errorMgr);
+        jpeg_create_compress(&cinfo);
+
+        unsigned char *outPtr = NULL;
+        unsigned long outSize = 0;
+        jpeg_mem_dest(&cinfo, &outPtr, &outSize);
+        cinfo.image_width = width;
+        cinfo.image_height = height;
+        cinfo.input_components = (depth == 1) ? 1 : 3;
+        cinfo.in_color_space = (depth == 1) ? JCS_GRAYSCALE : JCS_RGB;
+        jpeg_set_defaults(&cinfo);
+        jpeg_set_quality(&cinfo, JPEG_QUALITY, TRUE);
+        jpeg_start_compress(&cinfo, TRUE);
+
+        ByteVector row(width * cinfo.input_components);
+        while(cinfo.next_scanline < cinfo.image_height) {
+            const U8 *src = &rows[cinfo.next_scanline * width * depth];
+            for(U32 x = 0; x < width; ++x) {
+                for(I32 c = 0; c < cinfo.input_components; ++c) {
+                    row[x * cinfo.input_components + c] = src[x * depth + c];
+                }
+            }
+            JSAMPROW rowPtr = &row[0];
+            jpeg_write_scanlines(&cinfo, &rowPtr, 1);
+        }
+        jpeg_finish_compress(&cinfo);
+        jpeg_destroy_compress(&cinfo);
+
+        jpeg.assign(outPtr, outPtr + outSize);
+        free(outPtr);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Create an archive of the files.
+    //
+    // /////////////////////////////////////////////////////////////////
+    MemoryArchive *CreateArchive(const FileMap &files, U32 &rawSizeRef)
+    {
+        MemoryArchive *archivePtr = new MemoryArchive();
+        rawSizeRef = 0;
+        for(FileMap::const_iterator i = files.begin(), end = files.end(); i != end; ++i) {
+            archivePtr->Add(i->first, i->second);
+            rawSizeRef += U32(i->second.size());
+        }
+        return (archivePtr);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Load every file of an archive through a fresh ResCache.
+    //
+    // @param checkPtr Decoded images to compare the loaded pixels against
+    //                  (NULL to skip the check).
+    //
+    // @return F64 The time taken in seconds or a negative value if any
+    //              image failed to load or match.
+    //
+    // /////////////////////////////////////////////////////////////////
+    F64 LoadArchive(const FileMap &files, boost::shared_ptr<WorkerThreadPool> poolPtr, const std::vector<const ImageResHandle *> *checkPtr)
+    {
+        U32 rawSize = 0;
+        ResCache cache(CACHE_SIZE_MB, CreateArchive(files, rawSize), boost::shared_ptr<GameHalloran::GameLog>());
+        if(!cache.Init()) {
+            return (-1.0);
+        }
+
+        const F64 start = GetSeconds();
+        ImageLoadingPipeline pipeline(&cache, poolPtr);
+        for(FileMap::const_iterator i = files.begin(), end = files.end(); i != end; ++i) {
+            pipeline.AddImage(i->first);
+        }
+        const bool loaded = pipeline.Finish();
+        const F64 seconds = GetSeconds() - start;
+        if(!loaded) {
+            return (-1.0);
+        }
+
+        if(checkPtr) {
+            for(U32 i = 0; i < pipeline.GetNumberImages(); ++i) {
+                const ImageResHandle &image = *pipeline.GetImage(i);
+                const ImageResHandle &tga = *(*checkPtr)[i];
+                if(image.GetImageSize() != tga.GetImageSize() || image.GetImageWidth() != tga.GetImageWidth()) {
+                    return (-1.0);
+                }
+                const U8 *a = reinterpret_cast<const U8 *>(image.GetImageBuffer());
+                const U8 *b = reinterpret_cast<const U8 *>(tga.GetImageBuffer());
+                const U32 depth = U32(tga.GetImageDepth());
+                for(U32 p = 0; p < U32(tga.GetImageSize()); p += depth) {
+                    // TGA is BGR(A) and PNG is RGB(A).
+                    const bool swap = (depth >= 3);
+                    if(a[p] != b[swap ? p + 2 : p] || (swap && (a[p + 1] != b[p + 1] || a[p + 2] != b[p])) || (depth == 4 && a[p + 3] != b[p + 3])) {
+                        return (-1.0);
+                    }
+                }
+            }
+        }
+
+        return (seconds);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Print the average load time of an archive with each thread count.
+    //
+    // @return bool False if any load failed.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool BenchmarkArchive(const std::string &format, const FileMap &files, const U32 numberRuns, const U32 maxThreads, const std::vector<const ImageResHandle *> *checkPtr)
+    {
+        U32 rawSize = 0;
+        boost::shared_ptr<MemoryArchive> archivePtr(CreateArchive(files, rawSize));
+        std::cout << std::fixed << std::setprecision(2)
+                  << format << "  files " << std::setw(9) << (F64(rawSize) / 1024.0) << "KB"
+                  << "  archive " << std::setw(9) << (F64(archivePtr->GetDeflatedSize()) / 1024.0) << "KB" << std::endl;
+
+        F64 serialSeconds = 0.0;
+        for(U32 numberThreads = 0; numberThreads <= maxThreads; numberThreads = (numberThreads == 0) ? 1 : numberThreads * 2) {
+            boost::shared_ptr<WorkerThreadPool> poolPtr;
+            if(numberThreads > 0) {
+                poolPtr.reset(new WorkerThreadPool(numberThreads));
+                if(!poolPtr->IsValid()) {
+                    std::cerr << "Failed to create a worker thread pool" << std::endl;
+                    return (false);
+                }
+            }
+
+            F64 total = 0.0;
+            for(U32 run = 0; run < numberRuns; ++run) {
+                const F64 seconds = LoadArchive(files, poolPtr, checkPtr);
+                if(seconds < 0.0) {
+                    std::cerr << format << " images failed to load or did not match the TGA pixels" << std::endl;
+                    return (false);
+                }
+                total += seconds;
+            }
+            const F64 average = total / F64(numberRuns);
+            if(numberThreads == 0) {
+                serialSeconds = average;
+            }
+
+            std::cout << std::fixed << std::setprecision(3) << "     "
+                      << (numberThreads == 0 ? "in order  " : "threads ") << std::setw(2);
+            if(numberThreads > 0) {
+                std::cout << numberThreads;
+            }
+            std::cout << "  load " << std::setw(8) << (average * 1000.0) << "ms"
+                      << "  speedup " << std::setw(5) << (serialSeconds / average) << "x" << std::endl;
+        }
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // @class ProcessingOp
+    //
+    // An image processing function benchmarked with and without SIMD.
+    // Run() writes its result to m_outputs[allowSimd].
+    //
+    // /////////////////////////////////////////////////////////////////
+    class ProcessingOp {
+    protected:
+        const ByteVector &m_rgba;                   ///< The source RGBA image.
+        const U32 m_size;                           ///< Width and height of the image.
+
+    public:
+        ByteVector m_outputs[2];                    ///< Result of the scalar and SIMD runs.
+
+        ProcessingOp(const ByteVector &rgba, const U32 size) : m_rgba(rgba), m_size(size) {};
+        virtual ~ProcessingOp() {};
+        virtual const char *GetName() const = 0;
+        virtual void Run(const bool allowSimd) = 0;
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @class DownsampleOp
+    //
+    // /////////////////////////////////////////////////////////////////
+    class DownsampleOp : public ProcessingOp {
+    private:
+        const GameHalloran::ResampleFilter m_filter;
+        const bool m_gammaCorrect;
+        std::string m_name;
+
+    public:
+        DownsampleOp(const ByteVector &rgba, const U32 size, const GameHalloran::ResampleFilter filter, const bool gammaCorrect)
+            : ProcessingOp(rgba, size), m_filter(filter), m_gammaCorrect(gammaCorrect)
+            , m_name(std::string("downsample ") + GameHalloran::FindStringFromResampleFilter(filter) + (gammaCorrect ? " sRGB" : "")) {};
+        virtual const char *GetName() const {
+            return (m_name.c_str());
+        };
+        virtual void Run(const bool allowSimd) {
+            GameHalloran::DownsampleImage(&m_rgba[0], m_size, m_size, m_outputs[allowSimd], m_filter, m_gammaCorrect, allowSimd);
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @class MipChainOp
+    //
+    // /////////////////////////////////////////////////////////////////
+    class MipChainOp : public ProcessingOp {
+    public:
+        MipChainOp(const ByteVector &rgba, const U32 size) : ProcessingOp(rgba, size) {};
+        virtual const char *GetName() const {
+            return ("mip chain kaiser sRGB");
+        };
+        virtual void Run(const bool allowSimd) {
+            std::vector<ByteVector> levels;
+            GameHalloran::GenerateMipChain(&m_rgba[0], m_size, m_size, levels, GameHalloran::RESAMPLE_FILTER_KAISER, true, allowSimd);
+            m_outputs[allowSimd].clear();
+            for(U32 i = 0; i < levels.size(); ++i) {
+                m_outputs[allowSimd].insert(m_outputs[allowSimd].end(), levels[i].begin(), levels[i].end());
+            }
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @class PremultiplyOp
+    //
+    // /////////////////////////////////////////////////////////////////
+    class PremultiplyOp : public ProcessingOp {
+    public:
+        PremultiplyOp(const ByteVector &rgba, const U32 size) : ProcessingOp(rgba, size) {};
+        virtual const char *GetName() const {
+            return ("premultiply alpha");
+        };
+        virtual void Run(const bool allowSimd) {
+            m_outputs[allowSimd] = m_rgba;
+            GameHalloran::PremultiplyAlpha(&m_outputs[allowSimd][0], m_size * m_size, allowSimd);
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @class ConvertOp
+    //
+    // RGBA to RGB and back to RGBA.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class ConvertOp : public ProcessingOp {
+    private:
+        ByteVector m_rgb;
+
+    public:
+        ConvertOp(const ByteVector &rgba, const U32 size) : ProcessingOp(rgba, size), m_rgb(size * size * 3) {};
+        virtual const char *GetName() const {
+            return ("RGBA to RGB to RGBA");
+        };
+        virtual void Run(const bool allowSimd) {
+            m_outputs[allowSimd].resize(m_rgba.size());
+            GameHalloran::ConvertRgbaToRgb(&m_rgba[0], m_size * m_size, &m_rgb[0], allowSimd);
+            GameHalloran::ConvertRgbToRgba(&m_rgb[0], m_size * m_size, &m_outputs[allowSimd][0], 255, allowSimd);
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @class SwapOp
+    //
+    // /////////////////////////////////////////////////////////////////
+    class SwapOp : public ProcessingOp {
+    public:
+        SwapOp(const ByteVector &rgba, const U32 size) : ProcessingOp(rgba, size) {};
+        virtual const char *GetName() const {
+            return ("swap red and blue");
+        };
+        virtual void Run(const bool allowSimd) {
+            m_outputs[allowSimd] = m_rgba;
+            GameHalloran::SwapRedBlue(&m_outputs[allowSimd][0], m_size * m_size, allowSimd);
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Print the average time of each image processing function with
+    // and without SIMD.
+    //
+    // @return bool False if the SIMD and scalar results differ.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool BenchmarkProcessing(const U32 size, const U32 numberRuns)
+    {
+        // Smooth gradients with noise, the alpha a ramp.
+        ByteVector rgba(size * size * 4);
+        U32 noise = 1;
+        for(U32 y = 0; y < size; ++y) {
+            for(U32 x = 0; x < size; ++x) {
+                noise = noise * 1664525u + 1013904223u;
+                U8 *texelPtr = &rgba[(y * size + x) * 4];
+                texelPtr[0] = U8((x * 255 / size + (noise >> 28)) & 0xFF);
+                texelPtr[1] = U8((y * 255 / size + (noise >> 24)) & 0xFF);
+                texelPtr[2] = U8(((x / 16 + y / 16) & 1) ? 220 : 30);
+                texelPtr[3] = U8((x + y) * 255 / (2 * size));
+            }
+        }
+
+        std::vector<boost::shared_ptr<ProcessingOp> > ops;
+        ops.push_back(boost::shared_ptr<ProcessingOp>(new DownsampleOp(rgba, size, GameHalloran::RESAMPLE_FILTER_BOX, false)));
+        ops.push_back(boost::shared_ptr<ProcessingOp>(new DownsampleOp(rgba, size, GameHalloran::RESAMPLE_FILTER_BOX, true)));
+        ops.push_back(boost::shared_ptr<ProcessingOp>(new DownsampleOp(rgba, size, GameHalloran::RESAMPLE_FILTER_KAISER, false)));
+        ops.push_back(boost::shared_ptr<ProcessingOp>(new DownsampleOp(rgba, size, GameHalloran::RESAMPLE_FILTER_KAISER, true)));
+        ops.push_back(boost::shared_ptr<ProcessingOp>(new MipChainOp(rgba, size)));
+        ops.push_back(boost::shared_ptr<ProcessingOp>(new PremultiplyOp(rgba, size)));
+        ops.push_back(boost::shared_ptr<ProcessingOp>(new ConvertOp(rgba, size)));
+        ops.push_back(boost::shared_ptr<ProcessingOp>(new SwapOp(rgba, size)));
+
+        std::cout << "Processing a " << size << "x" << size << " RGBA image, average of " << numberRuns << " runs"
+                  << (GameHalloran::IsImageProcessingSimd() ? "" : " (SIMD not compiled in)") << std::endl;
+        bool result = true;
+        for(U32 i = 0; i < ops.size(); ++i) {
+            F64 seconds[2] = { 0.0, 0.0 };
+            for(U32 run = 0; run < numberRuns; ++run) {
+                for(U32 simd = 0; simd < 2; ++simd) {
+                    const F64 start = GetSeconds();
+                    ops[i]->Run(simd != 0);
+                    seconds[simd] += GetSeconds() - start;
+                }
+            }
+            const bool exact = (ops[i]->m_outputs[0] == ops[i]->m_outputs[1]);
+            result = result && exact;
+
+            std::cout << std::fixed << std::setprecision(3) << "     " << std::left << std::setw(24) << ops[i]->GetName() << std::right
+                      << "  scalar " << std::setw(8) << (seconds[0] * 1000.0 / F64(numberRuns)) << "ms"
+                      << "  simd " << std::setw(8) << (seconds[1] * 1000.0 / F64(numberRuns)) << "ms"
+                      << "  speedup " << std::setw(5) << (seconds[0] / seconds[1]) << "x"
+                      << (exact ? "  exact" : "  MISMATCH") << std::endl;
+        }
+
+        return (result);
+    }
+
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+int main(int args, char *argv[])
+{
+    const std::string tgaDirectory = (args > 1) ? std::string(argv[1]) : std::string("-");
+    const U32 numberRuns = (args > 2) ? U32(atoi(argv[2])) : DEFAULT_NUMBER_RUNS;
+    const U32 maxThreads = (args > 3) ? U32(atoi(argv[3])) : DEFAULT_MAX_THREADS;
+    const U32 processingSize = (args > 4) ? U32(atoi(argv[4])) : DEFAULT_PROCESSING_SIZE;
+    if(numberRuns == 0) {
+        std::cerr << "The number of runs must be greater than 0" << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    // The GLFW thread API needs GLFW to be initialized.
+    if(glfwInit() != GL_TRUE) {
+        std::cerr << "Failed to initialize GLFW, the worker threads can not be created" << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    FileMap tgaFiles;
+    if(tgaDirectory != "-") {
+        boost::filesystem::directory_iterator end;
+        for(boost::filesystem::directory_iterator i(tgaDirectory); i != end; ++i) {
+            ByteVector data;
+            if(i->path().extension() == ".tga" && ReadFile(i->path(), data)) {
+                tgaFiles[i->path().stem().string()] = data;
+            }
+        }
+    } else {
+        for(U32 i = 0; i < NUMBER_GENERATED; ++i) {
+            std::ostringstream name;
+            name << "generated" << std::setw(2) << std::setfill('0') << i;
+            tgaFiles[name.str()] = GenerateTga(i, GENERATED_SIZE, (i % 4 == 3) ? 4 : 3);
+        }
+    }
+    if(tgaFiles.empty()) {
+        std::cerr << "No TGA files to benchmark" << std::endl;
+        glfwTerminate();
+        return (EXIT_FAILURE);
+    }
+
+    // Decode the TGAs once to re-encode them and to check the PNGs against.
+    FileMap tgaArchiveFiles;
+    for(FileMap::const_iterator i = tgaFiles.begin(), end = tgaFiles.end(); i != end; ++i) {
+        tgaArchiveFiles[i->first + ".tga"] = i->second;
+    }
+    U32 rawSize = 0;
+    ResCache tgaCache(CACHE_SIZE_MB, CreateArchive(tgaArchiveFiles, rawSize), boost::shared_ptr<GameHalloran::GameLog>());
+    tgaCache.Init();
+
+    FileMap pngFiles;
+    FileMap jpegFiles;
+    std::vector<boost::shared_ptr<ImageResHandle> > tgaImages;
+    std::vector<const ImageResHandle *> tgaCheck;
+    for(FileMap::const_iterator i = tgaArchiveFiles.begin(), end = tgaArchiveFiles.end(); i != end; ++i) {
+        ImageResource imgRes(i->first);
+        boost::shared_ptr<ImageResHandle> imagePtr = boost::static_pointer_cast<ImageResHandle>(tgaCache.GetHandle(&imgRes));
+        if(!imagePtr || !imagePtr->VInitialize() || imagePtr->GetImageDepth() == 2) {
+            std::cerr << "Skipping unsupported TGA " << i->first << std::endl;
+            continue;
+        }
+        tgaImages.push_back(imagePtr);
+        tgaCheck.push_back(imagePtr.get());
+
+        const std::string stem = i->first.substr(0, i->first.size() - 4);
+        const U32 width = U32(imagePtr->GetImageWidth());
+        const U32 height = U32(imagePtr->GetImageHeight());
+        const U32 depth = U32(imagePtr->GetImageDepth());
+        const ByteVector rows = TgaToRgbRows(*imagePtr);
+        if(!EncodePng(rows, width, height, depth, pngFiles[stem + ".png"])) {
+            std::cerr << "Failed to encode " << stem << " as a PNG" << std::endl;
+            glfwTerminate();
+            return (EXIT_FAILURE);
+        }
+        EncodeJpeg(rows, width, height, depth, jpegFiles[stem + ".jpg"]);
+    }
+
+    // Only compare the images which were converted.
+    FileMap loadedTgaFiles;
+    for(FileMap::const_iterator i = pngFiles.begin(), end = pngFiles.end(); i != end; ++i) {
+        const std::string name = i->first.substr(0, i->first.size() - 4) + ".tga";
+        loadedTgaFiles[name] = tgaArchiveFiles[name];
+    }
+
+    std::cout << "Loading " << loadedTgaFiles.size() << " images, average of " << numberRuns << " runs (JPEG quality " << JPEG_QUALITY << ", alpha dropped)" << std::endl;
+    bool result = BenchmarkArchive("TGA ", loadedTgaFiles, numberRuns, maxThreads, NULL)
+                  && BenchmarkArchive("PNG ", pngFiles, numberRuns, maxThreads, &tgaCheck)
+                  && BenchmarkArchive("JPEG", jpegFiles, numberRuns, maxThreads, NULL);
+    if(result && processingSize > 0) {
+        result = BenchmarkProcessing(processingSize, numberRuns);
+    }
+
+    tgaImages.clear();
+    glfwTerminate();
+    return (result ? EXIT_SUCCESS : EXIT_FAILURE);
+}
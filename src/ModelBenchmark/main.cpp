@@ -0,0 +1,215 @@
+// /////////////////////////////////////////////////////////////////////////////
+// @file main.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Headless model loading benchmark.  Loads every OBJ file in a directory
+// (the Pool3D models by default) through a ModelLoadingPipeline, first
+// on the calling thread and then on WorkerThreadPools of 1, 2, 4 and 8
+// threads, and reports the average time of the CPU stages: reading the
+// files from the ResCache, parsing, measuring and welding each mesh.
+// The GL upload in Finish() needs a context so it is not timed.  Checks
+// every thread count builds the same number of vertices and indices.
+//
+// Usage: ModelBenchmark [objDirectory] [numberRuns] [maxThreads]
+//
+// /////////////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "GameBase.h"
+#include "ResCache2.h"
+#include "ModelLoadingPipeline.h"
+#include "WorkerThreadPool.h"
+
+using GameHalloran::U32;
+using GameHalloran::I32;
+using GameHalloran::F64;
+using GameHalloran::ResCache;
+using GameHalloran::ModelLoadingPipeline;
+using GameHalloran::WorkerThreadPool;
+
+namespace {
+
+    const char * const DEFAULT_OBJ_DIRECTORY = "../src/Pool3d/data/models";
+    const U32 DEFAULT_NUMBER_RUNS = 5;              ///< Loads of the models averaged.
+    const U32 DEFAULT_MAX_THREADS = 8;              ///< Largest thread count benchmarked.
+    const U32 CACHE_SIZE_MB = 64;                   ///< Large enough that no model is evicted.
+
+    // /////////////////////////////////////////////////////////////////
+    // @class DirectoryFile
+    //
+    // Resource file serving the files of a directory by their names.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class DirectoryFile : public GameHalloran::IResourceFile {
+    private:
+        boost::filesystem::path m_path;         ///< Path of the directory.
+    public:
+        explicit DirectoryFile(const boost::filesystem::path &path) : m_path(path) {};
+        virtual bool VOpen() {
+            return (boost::filesystem::is_directory(m_path));
+        };
+        virtual boost::optional<I32> VGetResourceSize(const GameHalloran::Resource &r) {
+            const boost::filesystem::path filePath(m_path / r.GetName());
+            if(!boost::filesystem::is_regular_file(filePath)) {
+                return (boost::optional<I32>());
+            }
+            return (boost::optional<I32>(I32(boost::filesystem::file_size(filePath))));
+        };
+        virtual bool VGetResource(const GameHalloran::Resource &r, char *buffer) {
+            const boost::filesystem::path filePath(m_path / r.GetName());
+            std::ifstream in(filePath.string().c_str(), std::ios::in | std::ios::binary);
+            in.read(buffer, std::streamsize(boost::filesystem::file_size(filePath)));
+            return (!in.fail());
+        };
+        virtual bool VGetResourceListing(const std::string &, GameHalloran::ResourceListing &) {
+            return (false);
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Get the current wall clock time in seconds.
+    //
+    // /////////////////////////////////////////////////////////////////
+    F64 GetSeconds()
+    {
+        static const boost::posix_time::ptime epoch(boost::posix_time::microsec_clock::universal_time());
+        return (F64((boost::posix_time::microsec_clock::universal_time() - epoch).total_microseconds()) / 1000000.0);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Run the CPU stages of the pipeline for every model through a
+    // fresh ResCache.
+    //
+    // @param totalVerticesRef Output number of welded vertices and
+    //                          indices of all the models.
+    //
+    // @return F64 The time taken in seconds or a negative value if any
+    //              model failed to load.
+    //
+    // /////////////////////////////////////////////////////////////////
+    F64 LoadModels(const boost::filesystem::path &directory, const std::vector<std::string> &files, boost::shared_ptr<WorkerThreadPool> poolPtr, \
+                   U32 &totalVerticesRef)
+    {
+        ResCache cache(CACHE_SIZE_MB, new DirectoryFile(directory), boost::shared_ptr<GameHalloran::GameLog>());
+        if(!cache.Init()) {
+            return (-1.0);
+        }
+
+        const F64 start = GetSeconds();
+        ModelLoadingPipeline pipeline(0, &cache, poolPtr);
+        for(std::vector<std::string>::const_iterator i = files.begin(), end = files.end(); i != end; ++i) {
+            pipeline.AddModel(*i);
+        }
+        pipeline.Start();
+        pipeline.WaitForCpuStages();
+        const F64 seconds = GetSeconds() - start;
+
+        totalVerticesRef = 0;
+        for(U32 i = 0; i < pipeline.GetNumberModels(); ++i) {
+            boost::shared_ptr<GameHalloran::GLTriangleBatch> batchPtr = pipeline.GetBatch(i);
+            if(!batchPtr) {
+                std::cerr << "Failed to load " << files[i] << std::endl;
+                return (-1.0);
+            }
+            totalVerticesRef += batchPtr->GetVertexCount() + batchPtr->GetIndexCount();
+        }
+
+        return (seconds);
+    }
+
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+int main(int args, char *argv[])
+{
+    const boost::filesystem::path directory((args > 1) ? std::string(argv[1]) : std::string(DEFAULT_OBJ_DIRECTORY));
+    const U32 numberRuns = (args > 2) ? U32(atoi(argv[2])) : DEFAULT_NUMBER_RUNS;
+    const U32 maxThreads = (args > 3) ? U32(atoi(argv[3])) : DEFAULT_MAX_THREADS;
+    if(numberRuns == 0) {
+        std::cerr << "The number of runs must be greater than 0" << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    std::vector<std::string> files;
+    U32 totalSize = 0;
+    if(boost::filesystem::is_directory(directory)) {
+        boost::filesystem::directory_iterator end;
+        for(boost::filesystem::directory_iterator i(directory); i != end; ++i) {
+            if(i->path().extension() == ".obj") {
+                files.push_back(i->path().filename().string());
+                totalSize += U32(boost::filesystem::file_size(i->path()));
+            }
+        }
+    }
+    if(files.empty()) {
+        std::cerr << "No OBJ files to benchmark in " << directory.string() << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    // The GLFW thread API needs GLFW to be initialized.
+    if(glfwInit() != GL_TRUE) {
+        std::cerr << "Failed to initialize GLFW, the worker threads can not be created" << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    std::cout << std::fixed << std::setprecision(2) << "Loading " << files.size() << " models, " << (F64(totalSize) / 1024.0)
+              << "KB of OBJ text, average of " << numberRuns << " runs (GL upload not timed)" << std::endl;
+
+    bool result = true;
+    F64 serialSeconds = 0.0;
+    U32 serialVertices = 0;
+    for(U32 numberThreads = 0; result && numberThreads <= maxThreads; numberThreads = (numberThreads == 0) ? 1 : numberThreads * 2) {
+        boost::shared_ptr<WorkerThreadPool> poolPtr;
+        if(numberThreads > 0) {
+            poolPtr.reset(new WorkerThreadPool(numberThreads));
+            if(!poolPtr->IsValid()) {
+                std::cerr << "Failed to create a worker thread pool" << std::endl;
+                result = false;
+                break;
+            }
+        }
+
+        F64 total = 0.0;
+        U32 vertices = 0;
+        for(U32 run = 0; result && run < numberRuns; ++run) {
+            const F64 seconds = LoadModels(directory, files, poolPtr, vertices);
+            result = (seconds >= 0.0);
+            total += seconds;
+        }
+        if(!result) {
+            break;
+        }
+        const F64 average = total / F64(numberRuns);
+        if(numberThreads == 0) {
+            serialSeconds = average;
+            serialVertices = vertices;
+        } else if(vertices != serialVertices) {
+            std::cerr << "The meshes loaded with " << numberThreads << " threads do not match those loaded in order" << std::endl;
+            result = false;
+        }
+
+        std::cout << std::fixed << std::setprecision(3) << "     "
+                  << (numberThreads == 0 ? "in order  " : "threads ") << std::setw(2);
+        if(numberThreads > 0) {
+            std::cout << numberThreads;
+        }
+        std::cout << "  load " << std::setw(8) << (average * 1000.0) << "ms"
+                  << "  speedup " << std::setw(5) << (serialSeconds / average) << "x" << std::endl;
+    }
+
+    glfwTerminate();
+    return (result ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,574 @@
+// /////////////////////////////////////////////////////////////////////////////
+// @file main.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Headless physics benchmark.  Steps a pool table with a racked set of
+// balls being broken plus a large pile of extra rigid bodies using the
+// single threaded and the multithreaded Bullet components and compares
+// the step times and the final state of each run, along with the time
+// spent tracking which pairs of bodies started or stopped touching each
+// step (the old std::set way and BulletCollisionPairTracker).  Then
+// times the actor
+// to body and body to actor lookups BulletPhysics does for contact
+// reporting, forces and removal with std::map against HashMap and the
+// rigid body user pointer, and the cost per frame of finding the bodies
+// which moved by scanning every body against only visiting the bodies
+// Bullet reported as moved, with 1000 and numberLookupBodies bodies of
+// which most are asleep.
+//
+// Usage: PhysicsBenchmark [numberBodies] [numberSteps] [maxThreads] [numberLookupBodies]
+//
+// /////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <set>
+#include <vector>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <bullet/btBulletDynamicsCommon.h>
+
+#include "GameBase.h"
+#include "BulletCollisionPairTracker.h"
+#include "BulletWorldComponents.h"
+#include "HashMap.h"
+
+using GameHalloran::U32;
+using GameHalloran::I32;
+using GameHalloran::F32;
+using GameHalloran::F64;
+using GameHalloran::BulletCollisionPairTracker;
+using GameHalloran::BulletWorldComponents;
+using GameHalloran::HashMap;
+
+namespace {
+
+    const F32 STEP_SECONDS = 1.0f / 240.0f;         ///< Fixed simulation step (the finest BulletPhysics::VOnUpdate() substep).
+    const U32 DEFAULT_NUMBER_BODIES = 4000;         ///< Extra bodies dropped next to the table.
+    const U32 DEFAULT_NUMBER_STEPS = 600;           ///< Two and a half seconds of simulation.
+    const U32 DEFAULT_MAX_THREADS = 8;              ///< Largest thread count benchmarked.
+    const U32 DEFAULT_NUMBER_LOOKUP_BODIES = 10000; ///< Bodies in the lookup benchmark.
+    const U32 LOOKUP_ROUNDS = 100;                  ///< Times every body is looked up.
+    const U32 SYNC_FRAMES = 120;                    ///< Frames stepped by the sync benchmark.
+    const U32 SYNC_AWAKE_EVERY = 50;                ///< One in this many bodies is kept awake by the sync benchmark.
+
+    const F32 BALL_RADIUS = 0.028575f;              ///< Pool ball radius (m).
+    const F32 BALL_MASS = 0.17f;                    ///< Pool ball mass (kg).
+    const U32 NUMBER_RACK_BALLS = 15;               ///< Balls in the rack.
+    const F32 TABLE_HEIGHT = 0.8f;                  ///< Height of the table bed (m).
+    const F32 CUE_BALL_SPEED = 8.0f;                ///< Speed of the break (m/s).
+
+    const F32 BODY_SIZE = 0.1f;                     ///< Radius/half extent of the extra bodies.
+    const F32 BODY_SPACING = 0.25f;                 ///< Distance between extra bodies when dropped.
+    const U32 BODIES_PER_ROW = 20;                  ///< Extra bodies per row and column of each layer.
+
+    const F32 MAX_SANE_SPEED = 50.0f;               ///< Faster than this and the simulation has exploded.
+    const F32 MIN_SANE_HEIGHT = -1.0f;              ///< Lower than this and a body has fallen through the floor.
+
+    // /////////////////////////////////////////////////////////////////
+    // @struct BenchmarkResult
+    //
+    // Timings and final state of one run.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct BenchmarkResult {
+        F64 m_totalSeconds;                         ///< Time spent stepping the world.
+        F64 m_worstStepSeconds;                     ///< Slowest single step.
+        U32 m_numberInsane;                         ///< Bodies which exploded or fell through the world.
+        F64 m_setTrackingSeconds;                   ///< Time spent tracking collision pairs with std::set.
+        F64 m_trackerSeconds;                       ///< Time spent tracking collision pairs with BulletCollisionPairTracker.
+        U32 m_maxPairs;                             ///< Most pairs touching in one step.
+        bool m_trackingMatches;                     ///< Did both ways of tracking find the same changes?
+        std::vector<btVector3> m_rackPositions;     ///< Final position of the cue ball and the rack.
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Get the current wall clock time in seconds.
+    //
+    // /////////////////////////////////////////////////////////////////
+    F64 GetSeconds()
+    {
+        static const boost::posix_time::ptime epoch(boost::posix_time::microsec_clock::universal_time());
+        return (F64((boost::posix_time::microsec_clock::universal_time() - epoch).total_microseconds()) / 1000000.0);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Add a rigid body to the world.
+    //
+    // @return btRigidBody* The body (owned by the world until
+    //                      DestroyBodies() is called).
+    //
+    // /////////////////////////////////////////////////////////////////
+    btRigidBody *AddBody(btDiscreteDynamicsWorld *worldPtr, btCollisionShape *shapePtr, const F32 mass, const btVector3 &pos, const F32 restitution, const F32 friction)
+    {
+        btVector3 inertia(0.0f, 0.0f, 0.0f);
+        if(mass > 0.0f) {
+            shapePtr->calculateLocalInertia(mass, inertia);
+        }
+
+        btRigidBody::btRigidBodyConstructionInfo info(mass, new btDefaultMotionState(btTransform(btQuaternion::getIdentity(), pos)), shapePtr, inertia);
+        info.m_restitution = restitution;
+        info.m_friction = friction;
+
+        btRigidBody *bodyPtr = new btRigidBody(info);
+        worldPtr->addRigidBody(bodyPtr);
+        return (bodyPtr);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Remove and delete all the bodies in the world.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void DestroyBodies(btDiscreteDynamicsWorld *worldPtr)
+    {
+        for(I32 i = worldPtr->getNumCollisionObjects() - 1; i >= 0; --i) {
+            btCollisionObject *objectPtr = worldPtr->getCollisionObjectArray()[i];
+            btRigidBody *bodyPtr = btRigidBody::upcast(objectPtr);
+            if(bodyPtr) {
+                delete bodyPtr->getMotionState();
+            }
+            worldPtr->removeCollisionObject(objectPtr);
+            delete objectPtr;
+        }
+    }
+
+    typedef std::pair<btCollisionObject const *, btCollisionObject const *> CollisionPair;
+    typedef std::set<CollisionPair> CollisionPairs;
+
+    // /////////////////////////////////////////////////////////////////
+    // Track the touching pairs of one step the way BulletPhysics used to:
+    // build a new set, find the removed pairs with std::set_difference and
+    // copy the set for the next step.
+    //
+    // @return U32 The number of pairs which started or stopped touching.
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 TrackPairsWithSet(btDispatcher *dispatcherPtr, CollisionPairs &previous)
+    {
+        U32 changes = 0;
+        CollisionPairs current;
+        for(I32 i = 0, numManifolds = dispatcherPtr->getNumManifolds(); i < numManifolds; ++i) {
+            btPersistentManifold const *manifoldPtr = dispatcherPtr->getManifoldByIndexInternal(i);
+            if(manifoldPtr->getNumContacts() > 0) {
+                btCollisionObject const *body0Ptr = static_cast<btCollisionObject const *>(manifoldPtr->getBody0());
+                btCollisionObject const *body1Ptr = static_cast<btCollisionObject const *>(manifoldPtr->getBody1());
+                const CollisionPair pair = (body0Ptr > body1Ptr) ? std::make_pair(body1Ptr, body0Ptr) : std::make_pair(body0Ptr, body1Ptr);
+                if(current.insert(pair).second && previous.find(pair) == previous.end()) {
+                    ++changes;
+                }
+            }
+        }
+
+        CollisionPairs removed;
+        std::set_difference(previous.begin(), previous.end(), current.begin(), current.end(), std::inserter(removed, removed.begin()));
+        changes += U32(removed.size());
+        previous = current;
+        return (changes);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Track the touching pairs of one step with a BulletCollisionPairTracker.
+    //
+    // @return U32 The number of pairs which started or stopped touching.
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 TrackPairsWithTracker(btDispatcher *dispatcherPtr, BulletCollisionPairTracker &tracker)
+    {
+        tracker.BeginTick();
+        for(I32 i = 0, numManifolds = dispatcherPtr->getNumManifolds(); i < numManifolds; ++i) {
+            btPersistentManifold const *manifoldPtr = dispatcherPtr->getManifoldByIndexInternal(i);
+            if(manifoldPtr->getNumContacts() > 0) {
+                tracker.AddContact(manifoldPtr);
+            }
+        }
+        tracker.EndTick();
+        return (U32(tracker.GetAdded().size() + tracker.GetRemoved().size()));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Run the benchmark scene once.
+    //
+    // @param numberThreads Number of threads to step the world on.
+    // @param numberBodies Number of extra bodies in the scene.
+    // @param numberSteps Number of fixed steps to simulate.
+    // @param result Holds the results on success.
+    //
+    // @return bool False if the world could not be created.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool RunBenchmark(const U32 numberThreads, const U32 numberBodies, const U32 numberSteps, BenchmarkResult &result)
+    {
+        BulletWorldComponents components(numberThreads);
+        if(!components.Initialize()) {
+            return (false);
+        }
+        btDiscreteDynamicsWorld *worldPtr = components.GetWorld();
+
+        // Shapes are shared by all the bodies of the same type.
+        btBoxShape floorShape(btVector3(50.0f, 0.5f, 50.0f));
+        btBoxShape tableShape(btVector3(1.4f, 0.05f, 0.75f));
+        btBoxShape sideCushionShape(btVector3(1.4f, 0.05f, 0.05f));
+        btBoxShape endCushionShape(btVector3(0.05f, 0.05f, 0.75f));
+        btSphereShape ballShape(BALL_RADIUS);
+        btSphereShape sphereShape(BODY_SIZE);
+        btBoxShape boxShape(btVector3(BODY_SIZE, BODY_SIZE, BODY_SIZE));
+
+        AddBody(worldPtr, &floorShape, 0.0f, btVector3(0.0f, -0.5f, 0.0f), 0.5f, 0.8f);
+        AddBody(worldPtr, &tableShape, 0.0f, btVector3(0.0f, TABLE_HEIGHT - 0.05f, 0.0f), 0.5f, 0.2f);
+        AddBody(worldPtr, &sideCushionShape, 0.0f, btVector3(0.0f, TABLE_HEIGHT + 0.05f, 0.7f), 0.8f, 0.2f);
+        AddBody(worldPtr, &sideCushionShape, 0.0f, btVector3(0.0f, TABLE_HEIGHT + 0.05f, -0.7f), 0.8f, 0.2f);
+        AddBody(worldPtr, &endCushionShape, 0.0f, btVector3(1.35f, TABLE_HEIGHT + 0.05f, 0.0f), 0.8f, 0.2f);
+        AddBody(worldPtr, &endCushionShape, 0.0f, btVector3(-1.35f, TABLE_HEIGHT + 0.05f, 0.0f), 0.8f, 0.2f);
+
+        // The cue ball and a triangular rack.
+        std::vector<btRigidBody *> rackBodies;
+        const F32 ballY = TABLE_HEIGHT + BALL_RADIUS;
+        btRigidBody *cueBallPtr = AddBody(worldPtr, &ballShape, BALL_MASS, btVector3(-0.6f, ballY, 0.0f), 0.95f, 0.2f);
+        cueBallPtr->setLinearVelocity(btVector3(CUE_BALL_SPEED, 0.0f, 0.0f));
+        rackBodies.push_back(cueBallPtr);
+        for(U32 row = 0; rackBodies.size() <= NUMBER_RACK_BALLS; ++row) {
+            for(U32 col = 0; col <= row && rackBodies.size() <= NUMBER_RACK_BALLS; ++col) {
+                const btVector3 pos(0.6f + F32(row) * BALL_RADIUS * 1.75f, ballY, (F32(col) - F32(row) * 0.5f) * BALL_RADIUS * 2.01f);
+                btRigidBody *ballPtr = AddBody(worldPtr, &ballShape, BALL_MASS, pos, 0.95f, 0.2f);
+                rackBodies.push_back(ballPtr);
+            }
+        }
+
+        // The extra bodies are dropped in layers next to the table.
+        for(U32 i = 0; i < numberBodies; ++i) {
+            const U32 layer = i / (BODIES_PER_ROW * BODIES_PER_ROW);
+            const U32 row = (i / BODIES_PER_ROW) % BODIES_PER_ROW;
+            const U32 col = i % BODIES_PER_ROW;
+            const btVector3 pos(2.0f + F32(col) * BODY_SPACING, 0.5f + F32(layer) * BODY_SPACING, -2.5f + F32(row) * BODY_SPACING);
+            AddBody(worldPtr, (i % 2) ? static_cast<btCollisionShape *>(&boxShape) : static_cast<btCollisionShape *>(&sphereShape), 1.0f, pos, 0.3f, 0.6f);
+        }
+
+        result.m_totalSeconds = 0.0;
+        result.m_worstStepSeconds = 0.0;
+        result.m_setTrackingSeconds = 0.0;
+        result.m_trackerSeconds = 0.0;
+        result.m_maxPairs = 0;
+        result.m_trackingMatches = true;
+        CollisionPairs previousPairs;
+        BulletCollisionPairTracker tracker;
+        for(U32 step = 0; step < numberSteps; ++step) {
+            F64 start = GetSeconds();
+            worldPtr->stepSimulation(STEP_SECONDS, 1, STEP_SECONDS);
+            const F64 stepSeconds = GetSeconds() - start;
+
+            result.m_totalSeconds += stepSeconds;
+            if(stepSeconds > result.m_worstStepSeconds) {
+                result.m_worstStepSeconds = stepSeconds;
+            }
+
+            start = GetSeconds();
+            const U32 setChanges = TrackPairsWithSet(worldPtr->getDispatcher(), previousPairs);
+            result.m_setTrackingSeconds += GetSeconds() - start;
+
+            start = GetSeconds();
+            const U32 trackerChanges = TrackPairsWithTracker(worldPtr->getDispatcher(), tracker);
+            result.m_trackerSeconds += GetSeconds() - start;
+
+            result.m_trackingMatches = result.m_trackingMatches && (setChanges == trackerChanges) && (previousPairs.size() == tracker.GetNumberPairs());
+            if(tracker.GetNumberPairs() > result.m_maxPairs) {
+                result.m_maxPairs = tracker.GetNumberPairs();
+            }
+        }
+
+        result.m_numberInsane = 0;
+        for(I32 i = 0; i < worldPtr->getNumCollisionObjects(); ++i) {
+            btRigidBody *bodyPtr = btRigidBody::upcast(worldPtr->getCollisionObjectArray()[i]);
+            if(!bodyPtr) {
+                continue;
+            }
+
+            const btVector3 &pos = bodyPtr->getCenterOfMassPosition();
+            const F32 speed = bodyPtr->getLinearVelocity().length();
+            if(!(speed < MAX_SANE_SPEED) || !(pos.getY() > MIN_SANE_HEIGHT) || pos.getX() != pos.getX() || pos.getZ() != pos.getZ()) {
+                ++result.m_numberInsane;
+            }
+        }
+
+        result.m_rackPositions.clear();
+        for(std::vector<btRigidBody *>::const_iterator i = rackBodies.begin(), end = rackBodies.end(); i != end; ++i) {
+            result.m_rackPositions.push_back((*i)->getCenterOfMassPosition());
+        }
+
+        DestroyBodies(worldPtr);
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Time the per body lookups of BulletPhysics with ordered maps (actor
+    // ID to body and body to actor ID) against a HashMap for the actor ID
+    // to body and the ID stored in the body's user pointer.
+    //
+    // @param numberBodies Number of bodies (and actors).
+    // @param mapSeconds Time taken using std::map.
+    // @param hashSeconds Time taken using HashMap and the user pointer.
+    //
+    // @return bool False if the two lookups disagreed.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool RunLookupBenchmark(const U32 numberBodies, F64 &mapSeconds, F64 &hashSeconds)
+    {
+        typedef U32 ActorId;
+        btSphereShape shape(BODY_SIZE);
+        std::vector<btRigidBody *> bodies;
+        std::vector<ActorId> actorIds;
+        for(U32 i = 0; i < numberBodies; ++i) {
+            bodies.push_back(new btRigidBody(1.0f, NULL, &shape));
+            actorIds.push_back(ActorId(i * 7 + 1));
+        }
+        // Set once actorIds is full so the user pointers stay valid.
+        for(U32 i = 0; i < numberBodies; ++i) {
+            bodies[i]->setUserPointer(&actorIds[i]);
+        }
+
+        std::map<ActorId, btRigidBody *> actorToBody;
+        std::map<btRigidBody const *, ActorId> bodyToActor;
+        HashMap<ActorId, btRigidBody *> actorToBodyHash;
+        for(U32 i = 0; i < numberBodies; ++i) {
+            actorToBody[actorIds[i]] = bodies[i];
+            bodyToActor[bodies[i]] = actorIds[i];
+            actorToBodyHash.Insert(actorIds[i], bodies[i]);
+        }
+
+        // Each round looks up every actor's body (forces, status) and every
+        //  body's actor (contact reports), then removes and re-adds a tenth.
+        GameHalloran::U64 mapSum = 0, hashSum = 0;
+        F64 start = GetSeconds();
+        for(U32 round = 0; round < LOOKUP_ROUNDS; ++round) {
+            for(U32 i = 0; i < numberBodies; ++i) {
+                btRigidBody *bodyPtr = actorToBody.find(actorIds[i])->second;
+                mapSum += bodyToActor.find(bodyPtr)->second;
+            }
+            for(U32 i = round % 10; i < numberBodies; i += 10) {
+                actorToBody.erase(actorIds[i]);
+                bodyToActor.erase(bodies[i]);
+                actorToBody[actorIds[i]] = bodies[i];
+                bodyToActor[bodies[i]] = actorIds[i];
+            }
+        }
+        mapSeconds = GetSeconds() - start;
+
+        start = GetSeconds();
+        for(U32 round = 0; round < LOOKUP_ROUNDS; ++round) {
+            for(U32 i = 0; i < numberBodies; ++i) {
+                btRigidBody *bodyPtr = *actorToBodyHash.Find(actorIds[i]);
+                hashSum += *static_cast<ActorId const *>(bodyPtr->getUserPointer());
+            }
+            for(U32 i = round % 10; i < numberBodies; i += 10) {
+                actorToBodyHash.Erase(actorIds[i]);
+                actorToBodyHash.Insert(actorIds[i], bodies[i]);
+            }
+        }
+        hashSeconds = GetSeconds() - start;
+
+        for(std::vector<btRigidBody *>::iterator i = bodies.begin(), end = bodies.end(); i != end; ++i) {
+            delete *i;
+        }
+        return (mapSum == hashSum);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // @class SyncMotionState
+    //
+    // Motion state which adds itself to a list of moved motion states
+    // when Bullet changes its transform (like BulletPhysics'
+    // ActorMotionState).
+    //
+    // /////////////////////////////////////////////////////////////////
+    class SyncMotionState : public btMotionState {
+    public:
+
+        btTransform m_transform;                    ///< Current transform.
+        U32 m_slot;                                 ///< Index of the body's transform in the synced array.
+        std::vector<SyncMotionState *> *m_movedListPtr;     ///< List to add this to when it moves.
+        bool m_moved;                               ///< Is this in the moved list?
+
+        SyncMotionState(const btTransform &transform, const U32 slot, std::vector<SyncMotionState *> *movedListPtr)\
+    :
+        m_transform(transform), m_slot(slot), m_movedListPtr(movedListPtr), m_moved(false) { };
+
+        virtual void getWorldTransform(btTransform &worldTrans) const {
+            worldTrans = m_transform;
+        };
+
+        virtual void setWorldTransform(const btTransform &worldTrans) {
+            if(!m_moved && !(worldTrans == m_transform)) {
+                m_movedListPtr->push_back(this);
+                m_moved = true;
+            }
+            m_transform = worldTrans;
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Time finding the moved bodies after each step.  The whole world is
+    // scanned and compared against the last synced transforms (the way
+    // VSyncVisibleScene() used to work) and then the list of motion
+    // states Bullet moved is walked instead.
+    //
+    // @param numberBodies Number of bodies (one in SYNC_AWAKE_EVERY
+    //                      spins and the rest are asleep).
+    // @param scanSeconds Time taken scanning every body.
+    // @param listSeconds Time taken walking the moved list.
+    //
+    // @return bool False if the two ways found different bodies.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool RunSyncBenchmark(const U32 numberBodies, F64 &scanSeconds, F64 &listSeconds)
+    {
+        BulletWorldComponents components(1);
+        if(!components.Initialize()) {
+            return (false);
+        }
+        btDiscreteDynamicsWorld *worldPtr = components.GetWorld();
+        worldPtr->setGravity(btVector3(0.0f, 0.0f, 0.0f));
+
+        btBoxShape shape(btVector3(BODY_SIZE, BODY_SIZE, BODY_SIZE));
+        btVector3 inertia(0.0f, 0.0f, 0.0f);
+        shape.calculateLocalInertia(1.0f, inertia);
+
+        std::vector<SyncMotionState *> movedList;
+        std::vector<btTransform> scannedTransforms, listedTransforms;
+        for(U32 i = 0; i < numberBodies; ++i) {
+            const btVector3 pos(F32(i % 100) * BODY_SPACING * 2.0f, 0.0f, F32(i / 100) * BODY_SPACING * 2.0f);
+            const btTransform transform(btQuaternion::getIdentity(), pos);
+            SyncMotionState *motionStatePtr = new SyncMotionState(transform, i, &movedList);
+            btRigidBody *bodyPtr = new btRigidBody(1.0f, motionStatePtr, &shape, inertia);
+            worldPtr->addRigidBody(bodyPtr);
+
+            if(i % SYNC_AWAKE_EVERY == 0) {
+                bodyPtr->setActivationState(DISABLE_DEACTIVATION);
+                bodyPtr->setAngularVelocity(btVector3(0.0f, 2.0f, 0.0f));
+            } else {
+                bodyPtr->setActivationState(ISLAND_SLEEPING);
+            }
+            scannedTransforms.push_back(transform);
+            listedTransforms.push_back(transform);
+        }
+
+        bool match = true;
+        scanSeconds = 0.0;
+        listSeconds = 0.0;
+        for(U32 frame = 0; frame < SYNC_FRAMES; ++frame) {
+            worldPtr->stepSimulation(STEP_SECONDS, 1, STEP_SECONDS);
+
+            F64 start = GetSeconds();
+            U32 scanned = 0;
+            btCollisionObjectArray &objects = worldPtr->getCollisionObjectArray();
+            for(I32 i = 0, size = objects.size(); i < size; ++i) {
+                btRigidBody *bodyPtr = btRigidBody::upcast(objects[i]);
+                const SyncMotionState *motionStatePtr = static_cast<const SyncMotionState *>(bodyPtr->getMotionState());
+                if(!(motionStatePtr->m_transform == scannedTransforms[motionStatePtr->m_slot])) {
+                    scannedTransforms[motionStatePtr->m_slot] = motionStatePtr->m_transform;
+                    ++scanned;
+                }
+            }
+            scanSeconds += GetSeconds() - start;
+
+            start = GetSeconds();
+            const U32 listed = U32(movedList.size());
+            for(std::vector<SyncMotionState *>::const_iterator i = movedList.begin(), end = movedList.end(); i != end; ++i) {
+                (*i)->m_moved = false;
+                listedTransforms[(*i)->m_slot] = (*i)->m_transform;
+            }
+            movedList.clear();
+            listSeconds += GetSeconds() - start;
+
+            match = match && (scanned == listed);
+        }
+
+        DestroyBodies(worldPtr);
+        return (match);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Get the largest distance between the rack ball positions of two
+    // runs.
+    //
+    // /////////////////////////////////////////////////////////////////
+    F32 GetRackDeviation(const BenchmarkResult &a, const BenchmarkResult &b)
+    {
+        F32 maxDistance = 0.0f;
+        for(size_t i = 0; i < a.m_rackPositions.size() && i < b.m_rackPositions.size(); ++i) {
+            const F32 distance = a.m_rackPositions[i].distance(b.m_rackPositions[i]);
+            if(!(distance <= maxDistance)) {
+                maxDistance = distance;
+            }
+        }
+        return (maxDistance);
+    }
+
+}
+
+int main(int args, char *argv[])
+{
+    const U32 numberBodies = (args > 1) ? U32(atoi(argv[1])) : DEFAULT_NUMBER_BODIES;
+    const U32 numberSteps = (args > 2) ? U32(atoi(argv[2])) : DEFAULT_NUMBER_STEPS;
+    const U32 maxThreads = (args > 3) ? U32(atoi(argv[3])) : DEFAULT_MAX_THREADS;
+    const U32 numberLookupBodies = (args > 4) ? U32(atoi(argv[4])) : DEFAULT_NUMBER_LOOKUP_BODIES;
+
+    std::cout << "Stepping " << numberBodies << " bodies plus a racked pool table for " << numberSteps << " steps of " << STEP_SECONDS << "s" << std::endl;
+
+    BenchmarkResult reference;
+    bool allStable = true;
+    for(U32 numberThreads = 1; numberThreads <= maxThreads; numberThreads *= 2) {
+        BenchmarkResult result;
+        if(!RunBenchmark(numberThreads, numberBodies, numberSteps, result)) {
+            std::cerr << "Failed to create the physics world with " << numberThreads << " threads" << std::endl;
+            return (EXIT_FAILURE);
+        }
+        if(numberThreads == 1) {
+            reference = result;
+        }
+
+        const bool stable = (result.m_numberInsane == 0) && result.m_trackingMatches;
+        allStable = allStable && stable;
+
+        std::cout << std::fixed << std::setprecision(3)
+                  << "threads " << std::setw(2) << numberThreads
+                  << "  total " << std::setw(8) << result.m_totalSeconds << "s"
+                  << "  avg step " << std::setw(7) << (result.m_totalSeconds * 1000.0 / F64(numberSteps ? numberSteps : 1)) << "ms"
+                  << "  worst step " << std::setw(7) << (result.m_worstStepSeconds * 1000.0) << "ms"
+                  << "  speedup " << std::setw(5) << (reference.m_totalSeconds / result.m_totalSeconds) << "x"
+                  << "  rack deviation " << std::setw(6) << GetRackDeviation(reference, result) << "m"
+                  << (stable ? "  stable" : "  UNSTABLE") << std::endl
+                  << "           pair tracking (max " << result.m_maxPairs << " pairs)"
+                  << "  std::set " << std::setw(7) << (result.m_setTrackingSeconds * 1000.0) << "ms"
+                  << "  tracker " << std::setw(7) << (result.m_trackerSeconds * 1000.0) << "ms"
+                  << (result.m_trackingMatches ? "" : "  MISMATCH") << std::endl;
+    }
+
+    F64 mapSeconds = 0.0, hashSeconds = 0.0;
+    const bool lookupsMatch = RunLookupBenchmark(numberLookupBodies, mapSeconds, hashSeconds);
+    std::cout << std::fixed << std::setprecision(3)
+              << "lookups of " << numberLookupBodies << " bodies x " << LOOKUP_ROUNDS
+              << "  std::map " << std::setw(7) << (mapSeconds * 1000.0) << "ms"
+              << "  HashMap + user pointer " << std::setw(7) << (hashSeconds * 1000.0) << "ms"
+              << "  speedup " << std::setw(5) << (mapSeconds / hashSeconds) << "x"
+              << (lookupsMatch ? "" : "  MISMATCH") << std::endl;
+
+    bool syncMatches = true;
+    const U32 syncBodies[] = { 1000, numberLookupBodies };
+    for(U32 i = 0; i < 2; ++i) {
+        F64 scanSeconds = 0.0, listSeconds = 0.0;
+        const bool match = RunSyncBenchmark(syncBodies[i], scanSeconds, listSeconds);
+        syncMatches = syncMatches && match;
+        std::cout << std::fixed << std::setprecision(3)
+                  << "sync of " << syncBodies[i] << " bodies (1 in " << SYNC_AWAKE_EVERY << " awake) per frame"
+                  << "  scan all " << std::setw(7) << (scanSeconds * 1000000.0 / F64(SYNC_FRAMES)) << "us"
+                  << "  moved list " << std::setw(7) << (listSeconds * 1000000.0 / F64(SYNC_FRAMES)) << "us"
+                  << (match ? "" : "  MISMATCH") << std::endl;
+    }
+
+    return ((allStable && lookupsMatch && syncMatches) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
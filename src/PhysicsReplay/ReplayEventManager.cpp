@@ -0,0 +1,126 @@
+// /////////////////////////////////////////////////////////////////
+// @file ReplayEventManager.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Implementation file for the ReplayEventManager class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include "ReplayEventManager.h"
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    ReplayEventManager::ReplayEventManager()\
+:
+    IEventManager("ReplayEventManager", true)
+    , m_queue()
+    , m_counts()
+    , m_totalEvents(0)
+    {
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    ReplayEventManager::~ReplayEventManager()
+    {
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ReplayEventManager::VAddListener(EventListenerPtr const & inHandler, EventType const & inType)
+    {
+        return (false);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ReplayEventManager::VDelListener(EventListenerPtr const & inHandler, EventType const & inType)
+    {
+        return (false);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ReplayEventManager::VTrigger(IEventData const & inEvent) const
+    {
+        return (false);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ReplayEventManager::VQueueEvent(IEventDataPtr const & inEvent)
+    {
+        if(!inEvent || !VValidateType(inEvent->VGetEventType())) {
+            return (false);
+        }
+
+        m_queue.push_back(inEvent);
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ReplayEventManager::VThreadSafeQueueEvent(IEventDataPtr const & inEvent)
+    {
+        return (VQueueEvent(inEvent));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ReplayEventManager::VAbortEvent(EventType const & inType, bool allOfType)
+    {
+        bool aborted = false;
+        for(std::vector<IEventDataPtr>::iterator i = m_queue.begin(); i != m_queue.end();) {
+            if((*i)->VGetEventType() == inType && (allOfType || !aborted)) {
+                i = m_queue.erase(i);
+                aborted = true;
+            } else {
+                ++i;
+            }
+        }
+        return (aborted);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ReplayEventManager::VTick(U64 maxMillis)
+    {
+        for(std::vector<IEventDataPtr>::const_iterator i = m_queue.begin(), end = m_queue.end(); i != end; ++i) {
+            ++m_counts[(*i)->VGetEventType().getStr()];
+            ++m_totalEvents;
+        }
+        m_queue.clear();
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ReplayEventManager::VValidateType(EventType const & inType) const
+    {
+        return (!inType.getStr().empty());
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ReplayEventManager::Reset()
+    {
+        m_queue.clear();
+        m_counts.clear();
+        m_totalEvents = 0;
+    }
+
+}
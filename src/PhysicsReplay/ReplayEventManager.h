@@ -0,0 +1,136 @@
+#pragma once
+#ifndef __GF_REPLAY_EVENT_MANAGER_H
+#define __GF_REPLAY_EVENT_MANAGER_H
+
+// /////////////////////////////////////////////////////////////////
+// @file ReplayEventManager.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header file for the ReplayEventManager class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "EventManager.h"
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    // @class ReplayEventManager
+    // @author PJ O Halloran
+    //
+    // Stand in for the games event manager so BulletPhysics can run
+    // without an application, a logic layer or a Lua state.  Queued
+    // events are held until VTick() and then counted by type, nothing
+    // listens to them.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class ReplayEventManager : public IEventManager {
+    public:
+
+        typedef std::map<std::string, U32> EventCountMap;
+
+    private:
+
+        std::vector<IEventDataPtr> m_queue;         ///< Events waiting for the next VTick().
+        EventCountMap m_counts;                     ///< Number of events ticked per type.
+        U32 m_totalEvents;                          ///< Number of events ticked.
+
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.  The manager becomes the global event manager.
+        //
+        // /////////////////////////////////////////////////////////////////
+        explicit ReplayEventManager();
+
+        // /////////////////////////////////////////////////////////////////
+        // Destructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual ~ReplayEventManager();
+
+        // /////////////////////////////////////////////////////////////////
+        // Listeners are not supported.
+        //
+        // @return bool Always false.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual bool VAddListener(EventListenerPtr const & inHandler, EventType const & inType);
+
+        // /////////////////////////////////////////////////////////////////
+        // Listeners are not supported.
+        //
+        // @return bool Always false.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual bool VDelListener(EventListenerPtr const & inHandler, EventType const & inType);
+
+        // /////////////////////////////////////////////////////////////////
+        // Triggered events are ignored (BulletPhysics only queues events).
+        //
+        // @return bool Always false (no listener consumes it).
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual bool VTrigger(IEventData const & inEvent) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Queue the event until the next VTick().
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual bool VQueueEvent(IEventDataPtr const & inEvent);
+
+        // /////////////////////////////////////////////////////////////////
+        // Same as VQueueEvent() (the harness is single threaded).
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual bool VThreadSafeQueueEvent(IEventDataPtr const & inEvent);
+
+        // /////////////////////////////////////////////////////////////////
+        // Remove the first (or all) queued events of a type.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual bool VAbortEvent(EventType const & inType, bool allOfType = false);
+
+        // /////////////////////////////////////////////////////////////////
+        // Count and release every queued event.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual bool VTick(U64 maxMillis = kINFINITE);
+
+        // /////////////////////////////////////////////////////////////////
+        // Any event type with a name is valid.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual bool VValidateType(EventType const & inType) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Forget the queued events and the counts.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void Reset();
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of events ticked per type.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline const EventCountMap &GetCounts() const {
+            return (m_counts);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of events ticked.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetTotalEvents() const {
+            return (m_totalEvents);
+        };
+    };
+
+}
+
+#endif
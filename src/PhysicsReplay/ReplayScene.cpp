@@ -0,0 +1,214 @@
+// /////////////////////////////////////////////////////////////////
+// @file ReplayScene.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Implementation file for the ReplayScene class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <bullet/btBulletDynamicsCommon.h>
+
+#include "tinyxml/tinyxml.h"
+
+#include "ReplayScene.h"
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    // Read a float attribute of an element.
+    //
+    // @param defaultValue Value used if the attribute is missing (if
+    //                      NULL the attribute is required).
+    //
+    // @throw GameException& If a required attribute is missing or an
+    //                      attribute is not a number.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static F32 ReadFloat(TiXmlElement *elemPtr, const char *name, const F32 *defaultValue = NULL) throw(GameException &)
+    {
+        F32 value = 0.0f;
+        const int result = elemPtr->QueryFloatAttribute(name, &value);
+        if(result == TIXML_NO_ATTRIBUTE && defaultValue) {
+            return (*defaultValue);
+        }
+        if(result != TIXML_SUCCESS) {
+            throw GameException(std::string("Missing or invalid attribute \"") + name + std::string("\" in a ") + elemPtr->Value() + std::string(" element"));
+        }
+        return (value);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Read a required unsigned attribute of an element.
+    //
+    // @throw GameException& If the attribute is missing or invalid.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static U32 ReadUnsigned(TiXmlElement *elemPtr, const char *name) throw(GameException &)
+    {
+        unsigned value = 0;
+        if(elemPtr->QueryUnsignedAttribute(name, &value) != TIXML_SUCCESS) {
+            throw GameException(std::string("Missing or invalid attribute \"") + name + std::string("\" in a ") + elemPtr->Value() + std::string(" element"));
+        }
+        return (static_cast<U32>(value));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Order impulses by frame.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static bool ImpulseFrameLess(const ReplayScene::Impulse &lhs, const ReplayScene::Impulse &rhs)
+    {
+        return (lhs.m_frame < rhs.m_frame);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    ReplayScene::ReplayScene()\
+:
+    m_numberFrames(0)
+    , m_frameSeconds(0.0f)
+    , m_bodies()
+    , m_impulses()
+    {
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    ReplayScene::~ReplayScene()
+    {
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ReplayScene::Load(const std::string &filename) throw(GameException &)
+    {
+        TiXmlDocument doc(filename.c_str());
+        if(!doc.LoadFile()) {
+            throw GameException(std::string("Failed to load the replay scene ") + filename + std::string(": ") + std::string(doc.ErrorDesc()));
+        }
+
+        TiXmlElement *rootElemPtr = TiXmlHandle(&doc).FirstChild("PhysicsReplay").ToElement();
+        if(!rootElemPtr) {
+            throw GameException(std::string("The file ") + filename + std::string(" is not a replay scene (No \"PhysicsReplay\" root node)"));
+        }
+
+        m_bodies.clear();
+        m_impulses.clear();
+        m_numberFrames = ReadUnsigned(rootElemPtr, "frames");
+        m_frameSeconds = ReadFloat(rootElemPtr, "frameSeconds");
+        if(m_frameSeconds <= 0.0f) {
+            throw GameException(std::string("The frameSeconds of the replay scene must be greater than 0"));
+        }
+
+        for(TiXmlElement *currElemPtr = rootElemPtr->FirstChildElement(); currElemPtr; currElemPtr = currElemPtr->NextSiblingElement()) {
+            const std::string name(currElemPtr->Value());
+            if(name == "Sphere") {
+                ParseBody(currElemPtr, eSphere);
+            } else if(name == "Box") {
+                ParseBody(currElemPtr, eBox);
+            } else if(name == "Impulse") {
+                ParseImpulse(currElemPtr);
+            } else {
+                throw GameException(std::string("Unknown element in the replay scene: ") + name);
+            }
+        }
+
+        // Impulses on the same frame keep the order they were recorded in.
+        std::stable_sort(m_impulses.begin(), m_impulses.end(), ImpulseFrameLess);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ReplayScene::ParseBody(TiXmlElement *elemPtr, const ShapeType shape) throw(GameException &)
+    {
+        const F32 zero = 0.0f;
+
+        Body body;
+        body.m_actorId = ReadUnsigned(elemPtr, "actor");
+        body.m_shape = shape;
+        if(shape == eSphere) {
+            body.m_dimensions = Vector3(ReadFloat(elemPtr, "radius"), 0.0f, 0.0f);
+        } else {
+            body.m_dimensions = Vector3(ReadFloat(elemPtr, "halfX"), ReadFloat(elemPtr, "halfY"), ReadFloat(elemPtr, "halfZ"));
+        }
+        body.m_position = Point3(ReadFloat(elemPtr, "x"), ReadFloat(elemPtr, "y"), ReadFloat(elemPtr, "z"));
+        body.m_specificGravity = ReadFloat(elemPtr, "specificGravity");
+        body.m_friction = ReadFloat(elemPtr, "friction", &zero);
+        body.m_restitution = ReadFloat(elemPtr, "restitution", &zero);
+        body.m_linearDamping = ReadFloat(elemPtr, "linearDamping", &zero);
+        body.m_angularDamping = ReadFloat(elemPtr, "angularDamping", &zero);
+        body.m_ccdMotionThreshold = ReadFloat(elemPtr, "ccdMotionThreshold", &zero);
+        body.m_ccdSweptSphereRadius = ReadFloat(elemPtr, "ccdSweptSphereRadius", &zero);
+        m_bodies.push_back(body);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ReplayScene::ParseImpulse(TiXmlElement *elemPtr) throw(GameException &)
+    {
+        Impulse impulse;
+        impulse.m_frame = ReadUnsigned(elemPtr, "frame");
+        impulse.m_actorId = ReadUnsigned(elemPtr, "actor");
+        impulse.m_direction = Vector3(ReadFloat(elemPtr, "dirX"), ReadFloat(elemPtr, "dirY"), ReadFloat(elemPtr, "dirZ"));
+        impulse.m_newtons = ReadFloat(elemPtr, "newtons");
+        m_impulses.push_back(impulse);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ReplayScene::AddToPhysics(IGamePhysics &physics) const
+    {
+        for(BodyVec::const_iterator i = m_bodies.begin(), end = m_bodies.end(); i != end; ++i) {
+            PhysicsObjectAttributes physicsAtt;
+            physicsAtt.m_actorId = i->m_actorId;
+            physicsAtt.m_bodyType = eRigidBody;
+            physicsAtt.m_friction = i->m_friction;
+            physicsAtt.m_restitution = i->m_restitution;
+            physicsAtt.m_linearDamping = i->m_linearDamping;
+            physicsAtt.m_angularDamping = i->m_angularDamping;
+            physicsAtt.m_ccdMotionThreshold = i->m_ccdMotionThreshold;
+            physicsAtt.m_ccdSweptSphereRadius = i->m_ccdSweptSphereRadius;
+            physicsAtt.m_objMatrix.LoadIdentity();
+            physicsAtt.m_objMatrix.SetPosition(i->m_position);
+
+            // Same collision filtering as the Pool3d table and balls.
+            if(i->m_specificGravity == 0.0f) {
+                physicsAtt.m_objectType = eStatic;
+                physicsAtt.m_collisionGroup = I32(btBroadphaseProxy::StaticFilter);
+                physicsAtt.m_collisionMask = I32(btBroadphaseProxy::AllFilter ^ btBroadphaseProxy::StaticFilter);
+            } else {
+                physicsAtt.m_objectType = eDynamic;
+                physicsAtt.m_collisionGroup = I32(btBroadphaseProxy::DefaultFilter);
+                physicsAtt.m_collisionMask = I32(btBroadphaseProxy::AllFilter);
+            }
+
+            if(i->m_shape == eSphere) {
+                physics.VAddSphere(i->m_dimensions.GetX(), i->m_specificGravity, physicsAtt);
+            } else {
+                physics.VAddBox(i->m_dimensions, i->m_specificGravity, physicsAtt);
+            }
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ReplayScene::ApplyImpulses(IGamePhysics &physics, const U32 frame, U32 &nextImpulse) const
+    {
+        while(nextImpulse < m_impulses.size() && m_impulses[nextImpulse].m_frame <= frame) {
+            const Impulse &impulse = m_impulses[nextImpulse];
+            physics.VApplyForce(impulse.m_direction, impulse.m_newtons, impulse.m_actorId);
+            ++nextImpulse;
+        }
+    }
+
+}
@@ -0,0 +1,190 @@
+#pragma once
+#ifndef __GF_REPLAY_SCENE_H
+#define __GF_REPLAY_SCENE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file ReplayScene.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header file for the ReplayScene class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "GameBase.h"
+#include "GameException.h"
+#include "IGamePhysics.h"
+
+class TiXmlElement;
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    // @class ReplayScene
+    // @author PJ O Halloran
+    //
+    // A scripted physics scene loaded from an XML file: the bodies to
+    // add to the world, the number of frames to step it for and the
+    // impulses (e.g. recorded cue shots) to apply on given frames.
+    //
+    // <PhysicsReplay frames="600" frameSeconds="0.0166667">
+    //     <Box actor="1" x="0" y="-0.1" z="0" halfX="0.5" halfY="0.1" halfZ="1.1" specificGravity="0" friction="0.5" restitution="0.5"/>
+    //     <Sphere actor="2" x="0" y="0.025" z="0.55" radius="0.025" specificGravity="1.95" friction="0.5" restitution="0.75" linearDamping="0.35" angularDamping="0.5" ccdMotionThreshold="0.025" ccdSweptSphereRadius="0.0225"/>
+    //     <Impulse frame="10" actor="2" dirX="0" dirY="0" dirZ="-1" newtons="0.001"/>
+    // </PhysicsReplay>
+    //
+    // Bodies with a specific gravity of 0 are static.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class ReplayScene {
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // @enum ShapeType
+        //
+        // Shapes a body in the scene can have.
+        //
+        // /////////////////////////////////////////////////////////////////
+        enum ShapeType {
+            eSphere = 0,
+            eBox
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct Body
+        //
+        // A body to add to the world.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct Body {
+            ActorId m_actorId;                      ///< Actor the body belongs to.
+            ShapeType m_shape;                      ///< Shape of the body.
+            Vector3 m_dimensions;                   ///< Box half extents (the radius is in X for spheres).
+            Point3 m_position;                      ///< Starting position.
+            F32 m_specificGravity;                  ///< Density of the body (0 for static bodies).
+            F32 m_friction;                         ///< Friction.
+            F32 m_restitution;                      ///< Restitution.
+            F32 m_linearDamping;                    ///< Linear damping.
+            F32 m_angularDamping;                   ///< Angular damping.
+            F32 m_ccdMotionThreshold;               ///< Continuous collision detection threshold (0 disables it).
+            F32 m_ccdSweptSphereRadius;             ///< Continuous collision detection swept sphere radius.
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct Impulse
+        //
+        // An impulse applied to an actor at the start of a frame.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct Impulse {
+            U32 m_frame;                            ///< Frame to apply the impulse on.
+            ActorId m_actorId;                      ///< Actor to push.
+            Vector3 m_direction;                    ///< Direction of the impulse.
+            F32 m_newtons;                          ///< Size of the impulse.
+        };
+
+        typedef std::vector<Body> BodyVec;
+        typedef std::vector<Impulse> ImpulseVec;
+
+    private:
+
+        U32 m_numberFrames;                         ///< Number of frames to step.
+        F32 m_frameSeconds;                         ///< Fixed time of each frame.
+        BodyVec m_bodies;                           ///< Bodies in the scene.
+        ImpulseVec m_impulses;                      ///< Impulses sorted by frame.
+
+        // /////////////////////////////////////////////////////////////////
+        // Read the attributes of a Box or Sphere element.
+        //
+        // @throw GameException& If a required attribute is missing.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void ParseBody(TiXmlElement *elemPtr, const ShapeType shape) throw(GameException &);
+
+        // /////////////////////////////////////////////////////////////////
+        // Read the attributes of an Impulse element.
+        //
+        // @throw GameException& If a required attribute is missing.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void ParseImpulse(TiXmlElement *elemPtr) throw(GameException &);
+
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        explicit ReplayScene();
+
+        // /////////////////////////////////////////////////////////////////
+        // Destructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        ~ReplayScene();
+
+        // /////////////////////////////////////////////////////////////////
+        // Load the scene from an XML file.
+        //
+        // @param filename Path of the scene file.
+        //
+        // @throw GameException& If the file cannot be read or is not a
+        //                      valid scene.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void Load(const std::string &filename) throw(GameException &);
+
+        // /////////////////////////////////////////////////////////////////
+        // Add every body in the scene to the physics world.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void AddToPhysics(IGamePhysics &physics) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Apply the impulses recorded for a frame.
+        //
+        // @param nextImpulse Index of the first impulse not yet applied,
+        //                      moved past the impulses of the frame.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void ApplyImpulses(IGamePhysics &physics, const U32 frame, U32 &nextImpulse) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of frames to step the scene for.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetNumberFrames() const {
+            return (m_numberFrames);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the fixed time of each frame.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline F32 GetFrameSeconds() const {
+            return (m_frameSeconds);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the bodies in the scene.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline const BodyVec &GetBodies() const {
+            return (m_bodies);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the impulses in the scene.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline const ImpulseVec &GetImpulses() const {
+            return (m_impulses);
+        };
+    };
+
+}
+
+#endif
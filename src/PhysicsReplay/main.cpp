@@ -0,0 +1,348 @@
+// /////////////////////////////////////////////////////////////////////////////
+// @file main.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Headless deterministic physics replay.  Loads a scripted scene (bodies
+// plus recorded impulses, e.g. a Pool3d break) into BulletPhysics running
+// without an application, logic layer or renderer (events go to a
+// ReplayEventManager), steps it for the scenes number of frames at its
+// fixed frame time and reports the percentiles of the frame step times
+// along with a hash of the final state of every body.  The scene is run
+// more than once and the hashes compared to catch nondeterminism, and the
+// hash can be compared with one from a previous build to catch changes
+// in the simulation.  The average number of physics substeps per frame is
+// reported too, and the scene is run once more with adaptive substepping
+// turned off (always stepping at 1/240s) for comparison.  After each run
+// aim lines are swept out from the first ball in every direction with the
+// batched physics queries, as the Pool3d aim line prediction would, and
+// their time reported.
+//
+// Usage: PhysicsReplay <scene.xml> [numberRuns] [numberThreads] [expectedHash]
+//
+// /////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "GameBase.h"
+#include "BulletPhysics.h"
+#include "ReplayEventManager.h"
+#include "ReplayScene.h"
+
+using GameHalloran::U32;
+using GameHalloran::U64;
+using GameHalloran::F32;
+using GameHalloran::F64;
+using GameHalloran::BulletPhysics;
+using GameHalloran::GameException;
+using GameHalloran::ModelViewProjStackManager;
+using GameHalloran::PhysicsObjectAttributes;
+using GameHalloran::PhysicsRay;
+using GameHalloran::PhysicsRayVec;
+using GameHalloran::PhysicsRayHitVec;
+using GameHalloran::Point3;
+using GameHalloran::ReplayEventManager;
+using GameHalloran::ReplayScene;
+
+namespace {
+
+    const U32 DEFAULT_NUMBER_RUNS = 3;              ///< Runs compared for determinism.
+    const U32 DEFAULT_NUMBER_THREADS = 0;           ///< Single threaded solver.
+    const U32 NUMBER_AIM_LINES = 360;               ///< Aim lines swept around the first ball after each run.
+    const F32 AIM_LINE_LENGTH = 3.0f;               ///< Length of each aim line.
+
+    const U64 FNV_OFFSET_BASIS = 14695981039346656037ULL;   ///< FNV-1a 64 bit offset basis.
+    const U64 FNV_PRIME = 1099511628211ULL;                 ///< FNV-1a 64 bit prime.
+
+    // /////////////////////////////////////////////////////////////////
+    // @struct ReplayResult
+    //
+    // Timings and final state of one run.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct ReplayResult {
+        std::vector<F64> m_frameSeconds;            ///< Time spent stepping and syncing each frame.
+        U64 m_hash;                                 ///< Hash of the final state of every body.
+        U32 m_numberEvents;                         ///< Events sent by the physics.
+        U32 m_numberSubsteps;                       ///< Physics substeps taken over every frame.
+        F64 m_aimSeconds;                           ///< Time spent sweeping and casting the aim lines.
+        U32 m_aimHits;                              ///< Aim line sweeps and rays that hit something.
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Get the current wall clock time in seconds.
+    //
+    // /////////////////////////////////////////////////////////////////
+    F64 GetSeconds()
+    {
+        static const boost::posix_time::ptime epoch(boost::posix_time::microsec_clock::universal_time());
+        return (F64((boost::posix_time::microsec_clock::universal_time() - epoch).total_microseconds()) / 1000000.0);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Add bytes to a FNV-1a hash.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void HashBytes(U64 &hash, const void *dataPtr, const size_t size)
+    {
+        const unsigned char *bytePtr = static_cast<const unsigned char *>(dataPtr);
+        for(size_t i = 0; i < size; ++i) {
+            hash ^= U64(bytePtr[i]);
+            hash *= FNV_PRIME;
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Add a float to a hash by its bits, so any difference at all in the
+    // simulation changes the hash.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void HashFloat(U64 &hash, const F32 value)
+    {
+        U32 bits = 0;
+        memcpy(&bits, &value, sizeof(bits));
+        HashBytes(hash, &bits, sizeof(bits));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Hash the transform and velocities of every body in the scene, in
+    // the order the scene lists them.
+    //
+    // /////////////////////////////////////////////////////////////////
+    U64 HashFinalState(const BulletPhysics &physics, const ReplayScene &scene)
+    {
+        U64 hash = FNV_OFFSET_BASIS;
+        for(ReplayScene::BodyVec::const_iterator i = scene.GetBodies().begin(), end = scene.GetBodies().end(); i != end; ++i) {
+            HashBytes(hash, &i->m_actorId, sizeof(i->m_actorId));
+
+            PhysicsObjectAttributes status;
+            if(!physics.VGetActorObjectStatus(i->m_actorId, status)) {
+                continue;
+            }
+
+            const F32 *matPtr = status.m_objMatrix.GetComponentsConst();
+            for(U32 j = 0; j < GameHalloran::Matrix4::NUMBER_ELEMENTS; ++j) {
+                HashFloat(hash, matPtr[j]);
+            }
+            HashFloat(hash, status.m_linearVelocity.GetX());
+            HashFloat(hash, status.m_linearVelocity.GetY());
+            HashFloat(hash, status.m_linearVelocity.GetZ());
+            HashFloat(hash, status.m_angularVelocity.GetX());
+            HashFloat(hash, status.m_angularVelocity.GetY());
+            HashFloat(hash, status.m_angularVelocity.GetZ());
+        }
+        return (hash);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Get a percentile of sorted frame times.
+    //
+    // /////////////////////////////////////////////////////////////////
+    F64 GetPercentile(const std::vector<F64> &sortedSeconds, const F64 percentile)
+    {
+        if(sortedSeconds.empty()) {
+            return (0.0);
+        }
+
+        // Nearest rank.
+        U32 rank = U32(percentile / 100.0 * F64(sortedSeconds.size()) + 0.999999);
+        rank = std::max<U32>(1, std::min<U32>(rank, U32(sortedSeconds.size())));
+        return (sortedSeconds[rank - 1]);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Format a hash as 16 hex digits.
+    //
+    // /////////////////////////////////////////////////////////////////
+    std::string HashToString(const U64 hash)
+    {
+        std::ostringstream ss;
+        ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+        return (ss.str());
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Print the timings, substeps and hash of a run.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void PrintResult(const std::string &name, const ReplayScene &scene, const ReplayResult &result)
+    {
+        F64 totalSeconds = 0.0;
+        for(std::vector<F64>::const_iterator i = result.m_frameSeconds.begin(), end = result.m_frameSeconds.end(); i != end; ++i) {
+            totalSeconds += *i;
+        }
+        std::vector<F64> sortedSeconds(result.m_frameSeconds);
+        std::sort(sortedSeconds.begin(), sortedSeconds.end());
+
+        const F64 numberFrames = F64(std::max<U32>(1, scene.GetNumberFrames()));
+        std::cout << std::fixed << std::setprecision(3)
+                  << std::left << std::setw(12) << name << std::right
+                  << "  total " << std::setw(8) << (totalSeconds * 1000.0) << "ms"
+                  << "  p50 " << std::setw(7) << (GetPercentile(sortedSeconds, 50.0) * 1000.0) << "ms"
+                  << "  p90 " << std::setw(7) << (GetPercentile(sortedSeconds, 90.0) * 1000.0) << "ms"
+                  << "  p99 " << std::setw(7) << (GetPercentile(sortedSeconds, 99.0) * 1000.0) << "ms"
+                  << "  max " << std::setw(7) << (GetPercentile(sortedSeconds, 100.0) * 1000.0) << "ms"
+                  << "  substeps/frame " << std::setw(5) << (F64(result.m_numberSubsteps) / numberFrames)
+                  << "  events " << result.m_numberEvents
+                  << "  aim " << std::setw(6) << (result.m_aimSeconds * 1000.0) << "ms (" << result.m_aimHits << " hits)"
+                  << "  hash " << HashToString(result.m_hash) << std::endl;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Sweep the first ball of the scene along aim lines in every
+    // direction around it, and cast rays along the same lines.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void RunAimQueries(const BulletPhysics &physics, const ReplayScene &scene, ReplayResult &result)
+    {
+        result.m_aimSeconds = 0.0;
+        result.m_aimHits = 0;
+
+        ReplayScene::BodyVec::const_iterator ballIter = scene.GetBodies().begin();
+        while(ballIter != scene.GetBodies().end() && ballIter->m_shape != ReplayScene::eSphere) {
+            ++ballIter;
+        }
+        PhysicsObjectAttributes status;
+        if(ballIter == scene.GetBodies().end() || !physics.VGetActorObjectStatus(ballIter->m_actorId, status)) {
+            return;
+        }
+
+        // Start the lines just outside the ball so they do not hit it.
+        const F32 radius = ballIter->m_dimensions.GetX();
+        Point3 centre;
+        status.m_objMatrix.GetPosition(centre);
+        PhysicsRayVec rays;
+        rays.reserve(NUMBER_AIM_LINES);
+        for(U32 i = 0; i < NUMBER_AIM_LINES; ++i) {
+            const F32 angle = F32(i) * F32(M3D_2PI) / F32(NUMBER_AIM_LINES);
+            const GameHalloran::Vector3 dir(std::cos(angle), 0.0f, std::sin(angle));
+            rays.push_back(PhysicsRay(centre + dir * (radius * 2.01f), centre + dir * AIM_LINE_LENGTH));
+        }
+
+        PhysicsRayHitVec sweepHits, rayHits;
+        const F64 start = GetSeconds();
+        physics.VSphereSweepBatch(rays, radius, sweepHits);
+        physics.VRayCastBatch(rays, rayHits);
+        result.m_aimSeconds = GetSeconds() - start;
+
+        for(U32 i = 0; i < NUMBER_AIM_LINES; ++i) {
+            result.m_aimHits += (sweepHits[i].m_hit ? 1 : 0) + (rayHits[i].m_hit ? 1 : 0);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Run the scene once in a new physics world.
+    //
+    // @param adaptiveSubstepping Pick the substep size from the speed of
+    //                      the fastest body (else always 1/240s).
+    //
+    // @return bool False if the physics world could not be created.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool RunReplay(const ReplayScene &scene, const U32 numberThreads, const bool adaptiveSubstepping, ReplayEventManager &eventManager, ReplayResult &result)
+    {
+        // No MVP stack so BulletPhysics runs without a debug drawer.
+        boost::shared_ptr<BulletPhysics> physicsPtr(GCC_NEW BulletPhysics(boost::shared_ptr<ModelViewProjStackManager>(), numberThreads));
+        if(!physicsPtr || !physicsPtr->VInitialize()) {
+            return (false);
+        }
+        physicsPtr->SetAdaptiveSubstepping(adaptiveSubstepping);
+        scene.AddToPhysics(*physicsPtr);
+
+        eventManager.Reset();
+        result.m_frameSeconds.clear();
+        result.m_frameSeconds.reserve(scene.GetNumberFrames());
+        result.m_numberSubsteps = 0;
+
+        U32 nextImpulse = 0;
+        for(U32 frame = 0; frame < scene.GetNumberFrames(); ++frame) {
+            scene.ApplyImpulses(*physicsPtr, frame, nextImpulse);
+
+            const F64 start = GetSeconds();
+            physicsPtr->VOnUpdate(scene.GetFrameSeconds());
+            physicsPtr->VSyncVisibleScene();
+            result.m_frameSeconds.push_back(GetSeconds() - start);
+            result.m_numberSubsteps += physicsPtr->GetLastNumberSubsteps();
+
+            eventManager.VTick();
+        }
+
+        result.m_hash = HashFinalState(*physicsPtr, scene);
+        result.m_numberEvents = eventManager.GetTotalEvents();
+        RunAimQueries(*physicsPtr, scene, result);
+        return (true);
+    }
+
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+int main(int args, char *argv[])
+{
+    if(args < 2) {
+        std::cerr << "Usage: " << argv[0] << " <scene.xml> [numberRuns] [numberThreads] [expectedHash]" << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    const U32 numberRuns = (args > 2) ? std::max<U32>(1, U32(atoi(argv[2]))) : DEFAULT_NUMBER_RUNS;
+    const U32 numberThreads = (args > 3) ? U32(atoi(argv[3])) : DEFAULT_NUMBER_THREADS;
+    const std::string expectedHash((args > 4) ? argv[4] : "");
+
+    ReplayScene scene;
+    try {
+        scene.Load(argv[1]);
+    } catch(GameException &e) {
+        std::cerr << e.what() << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    std::cout << "Replaying " << argv[1] << ": " << scene.GetBodies().size() << " bodies, " << scene.GetImpulses().size() << " impulses, "
+              << scene.GetNumberFrames() << " frames of " << scene.GetFrameSeconds() << "s" << std::endl;
+
+    ReplayEventManager eventManager;
+    U64 firstHash = 0;
+    bool deterministic = true;
+    for(U32 run = 0; run < numberRuns; ++run) {
+        ReplayResult result;
+        if(!RunReplay(scene, numberThreads, true, eventManager, result)) {
+            std::cerr << "Failed to create the physics world" << std::endl;
+            return (EXIT_FAILURE);
+        }
+        if(run == 0) {
+            firstHash = result.m_hash;
+        }
+        deterministic = deterministic && (result.m_hash == firstHash);
+
+        PrintResult(std::string("run ") + boost::lexical_cast<std::string>(run), scene, result);
+        if(result.m_hash != firstHash) {
+            std::cout << "    NONDETERMINISTIC" << std::endl;
+        }
+    }
+
+    ReplayResult fixedResult;
+    if(!RunReplay(scene, numberThreads, false, eventManager, fixedResult)) {
+        std::cerr << "Failed to create the physics world" << std::endl;
+        return (EXIT_FAILURE);
+    }
+    PrintResult("fixed 1/240s", scene, fixedResult);
+
+    bool matchesExpected = true;
+    if(!expectedHash.empty()) {
+        matchesExpected = (HashToString(firstHash) == expectedHash);
+        std::cout << "expected hash " << expectedHash << (matchesExpected ? "  match" : "  MISMATCH") << std::endl;
+    }
+
+    return ((deterministic && matchesExpected) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -27,6 +27,7 @@
 #include "LuaStateManager.h"
 #include "GameMain.h"
 #include "BulletPhysics.h"
+#include "ModelLoadingPipeline.h"
 
 
 using boost::shared_ptr;
@@ -310,11 +311,13 @@ namespace GameHalloran {
         Point3 pos(ActorParams::VGetPos());
         GameHalloran::BuildTranslationMatrix4(mat, pos.GetX(), pos.GetY(), pos.GetZ());
 
-        ObjModelFileLoader objLoader;                       // 3D mesh loading object.
-        ModelLoadingProgress loadProgressObj(ePoolCue);     // Proress update interface.
-        BoundingCube bb;                                    // BoundingBox for mesh.
+        // Parse and weld the mesh on a worker, the same as the table meshes.
+        ModelLoadingPipeline pipeline(ePoolCue, g_appPtr->GetResourceCache().get(), g_appPtr->GetWorkerThreadPoolPtr());
+        const U32 meshIndex = pipeline.AddModel(std::string(m_meshName));
+        pipeline.Start();
+        pipeline.Finish();
 
-        boost::shared_ptr<GLTriangleBatch> batchPtr = GameHalloran::LoadBatchFromResourceCache(std::string(m_meshName), &objLoader, loadProgressObj, bb);
+        boost::shared_ptr<GLTriangleBatch> batchPtr = pipeline.GetBatch(meshIndex);
 
         // Create the appropriate scene node for the actor.
         boost::shared_ptr<CommonBatchSceneNode> generalNode(GCC_NEW CommonBatchSceneNode(NULL, VGetId(), \
@@ -477,6 +480,9 @@ namespace GameHalloran {
                                              btBroadphaseProxy::CharacterFilter);
             physicsAtt.m_actorId = VGetId();
             physicsAtt.m_objMatrix = ballActorPtr->VGetMat();
+            // A hard shot can move a ball further than its radius in one physics step.
+            physicsAtt.m_ccdMotionThreshold = m_radius;
+            physicsAtt.m_ccdSweptSphereRadius = m_radius * 0.9f;
 
             // The cue ball is special, it is also affected by the Pool3d cue group.
             if(m_group == eCue) {
@@ -152,7 +152,7 @@ namespace GameHalloran {
             glFrontFace(GL_CCW);
 
             // Initialize the TextureManager last once all other OpenGL initialization is done.
-            m_texManagerPtr.reset(GCC_NEW TextureManager(10, 1024 * 1024 * 20));
+            m_texManagerPtr.reset(GCC_NEW TextureManager(10, 1024 * 1024 * 80));
             m_texManagerPtr->SetTextureFilterMode(TextureManager::eAnisotropic);
             m_texManagerPtr->SetAnisotropicLinearLevel(1.0f);
 
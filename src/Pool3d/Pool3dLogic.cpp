@@ -124,6 +124,9 @@ namespace GameHalloran {
         } else if(eventObj.VGetEventType() == EvtData_Move_Actor::sk_EventType) {
             const EvtData_Move_Actor &castEvent = static_cast<const EvtData_Move_Actor &>(eventObj);
             result = OnMoveActorEvent(castEvent);
+        } else if(eventObj.VGetEventType() == EvtData_Move_Actors::sk_EventType) {
+            const EvtData_Move_Actors &castEvent = static_cast<const EvtData_Move_Actors &>(eventObj);
+            result = OnMoveActorsEvent(castEvent);
         } else if(eventObj.VGetEventType() == EvtData_New_Actor::sk_EventType) {
             const EvtData_New_Actor &castEvent = static_cast<const EvtData_New_Actor &>(eventObj);
             result = OnNewActorEvent(castEvent);
@@ -213,6 +216,19 @@ namespace GameHalloran {
         return (false);
     }
 
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool Pool3dLogicEventListener::OnMoveActorsEvent(const EvtData_Move_Actors &eventData)
+    {
+        const EvtData_Move_Actors::ActorMovementVec &movements = eventData.GetMovements();
+        for(EvtData_Move_Actors::ActorMovementVec::const_iterator i = movements.begin(), end = movements.end(); i != end; ++i) {
+            m_logicPtr->VMoveActor(i->m_id, i->m_mat);
+        }
+        // Let View layer consume this event too.
+        return (false);
+    }
+
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
@@ -669,6 +685,7 @@ namespace GameHalloran {
         safeAddListener(m_listener, EvtData_Request_Pause_Game_Event::sk_EventType);
         safeAddListener(m_listener, EvtData_Game_State::sk_EventType);
         safeAddListener(m_listener, EvtData_Move_Actor::sk_EventType);
+        safeAddListener(m_listener, EvtData_Move_Actors::sk_EventType);
         safeAddListener(m_listener, EvtData_New_Actor::sk_EventType);
         safeAddListener(m_listener, EvtData_Request_New_Actor::sk_EventType);
         safeAddListener(m_listener, EvtData_Request_Start_Game::sk_EventType);
@@ -699,6 +716,7 @@ namespace GameHalloran {
             safeDelListener(m_listener, EvtData_Request_Pause_Game_Event::sk_EventType);
             safeDelListener(m_listener, EvtData_Game_State::sk_EventType);
             safeDelListener(m_listener, EvtData_Move_Actor::sk_EventType);
+            safeDelListener(m_listener, EvtData_Move_Actors::sk_EventType);
             safeDelListener(m_listener, EvtData_New_Actor::sk_EventType);
             safeDelListener(m_listener, EvtData_Request_New_Actor::sk_EventType);
             safeDelListener(m_listener, EvtData_Request_Start_Game::sk_EventType);
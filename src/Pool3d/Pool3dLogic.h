@@ -143,6 +143,18 @@ namespace GameHalloran {
         // /////////////////////////////////////////////////////////////////
         bool OnMoveActorEvent(const EvtData_Move_Actor &eventData);
 
+        // /////////////////////////////////////////////////////////////////
+        // Callback triggered when a EvtData_Move_Actors event
+        // is broadcast.
+        //
+        // @param eventData The event data object.
+        //
+        // @return bool True if the event is to be stopped now or false if the
+        //                  event should be propagated further.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool OnMoveActorsEvent(const EvtData_Move_Actors &eventData);
+
         // /////////////////////////////////////////////////////////////////
         // Callback triggered when a EvtData_New_Actor event
         // is broadcast.
@@ -21,6 +21,7 @@
 #include "GameMain.h"
 #include "SceneGraphManager.h"
 #include "RayCast.h"
+#include "ModelLoadingPipeline.h"
 
 namespace GameHalloran {
 
@@ -196,21 +197,23 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     void TableSceneNode::Init() throw(GameException &)
     {
-        ObjModelFileLoader objLoader;                       // 3D model parsing object.
-        ModelLoadingProgress progressObj(ePoolTable, 5);    // Model loading progress reporting interface.
-        BoundingCube tableMeshBB;                           // BoundingBoxes for the various pool table meshes.
-
-        TriangleMesh tableMesh;
-        LoadMeshFromResourceCache(m_param.GetMeshName(), &objLoader, progressObj, tableMesh);
-        CalculateTriangleListBoundingBox(tableMesh, tableMeshBB);
+        // Parse and weld all the table meshes in parallel, we need to keep the table and middle pocket triangles to measure the table.
+        ModelLoadingPipeline pipeline(ePoolTable, g_appPtr->GetResourceCache().get(), g_appPtr->GetWorkerThreadPoolPtr());
+        const U32 tableIndex = pipeline.AddModel(m_param.GetMeshName(), true, true);
+        const U32 mpIndex = pipeline.AddModel(m_param.GetMiddlePocketMeshName(), false, true);
+        const U32 cpIndex = pipeline.AddModel(m_param.GetCornerPocketMeshName());
+        const U32 fpIndex = pipeline.AddModel(m_param.GetFrontPanelMeshName());
+        const U32 spIndex = pipeline.AddModel(m_param.GetSidePanelMeshName());
+        pipeline.Start();
+        pipeline.Finish();
 
         // Create the child mesh.
-        boost::shared_ptr<GLTriangleBatch> tableBatch = ConvertTriangleListToBatch(tableMesh, &progressObj, true);
+        boost::shared_ptr<GLTriangleBatch> tableBatch = pipeline.GetBatch(tableIndex);
         if(!tableBatch) {
             throw GameException(std::string("Failed to load pool table mesh"));
         }
-
-        progressObj.NextStage();
+        const TriangleMesh &tableMesh = pipeline.GetMesh(tableIndex);
+        const BoundingCube &tableMeshBB = pipeline.GetBoundingBox(tableIndex);
 
         CommonBatchSceneNode::SetBatch(tableBatch);
         // Calculate and set the radius of the table scene node from the table mesh.
@@ -219,7 +222,7 @@ namespace GameHalloran {
         // Calculate the actual width of the pool table floor.
         F32 tableFloorWidth = 0.0f, projX = -FLT_MAX;
         Vertex currVertex;
-        for(TriangleList::iterator i = tableMesh.begin(), end = tableMesh.end(); i != end; ++i) {
+        for(TriangleList::const_iterator i = tableMesh.begin(), end = tableMesh.end(); i != end; ++i) {
             for(I32 vi = 0; vi < Triangle::eNumberVertices; ++vi) {
                 (*i)->GetVertex(Triangle::VertexId(vi), currVertex);
                 Vector3 posVec(currVertex.GetPosition());
@@ -234,10 +237,10 @@ namespace GameHalloran {
         F32 tw = tableMeshBB.GetWidth();
 
         F32 mpDepth, pr;
-        if(!InitPockets(objLoader, progressObj, tableMeshBB, mpDepth, pr)) {
+        if(!InitPockets(pipeline, mpIndex, cpIndex, tableMeshBB, mpDepth, pr)) {
             throw GameException(std::string("Failed to load pool table pocket meshes"));
         }
-        if(!InitPanels(objLoader, progressObj, tableMeshBB, mpDepth)) {
+        if(!InitPanels(pipeline, fpIndex, spIndex, tableMeshBB, mpDepth)) {
             throw GameException(std::string("Failed to load pool table panel meshes"));
         }
 
@@ -253,13 +256,13 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
-    bool TableSceneNode::InitPanels(ObjModelFileLoader &objLoader, ModelLoadingProgress &progressObj, const BoundingCube &tbb, const F32 mpDepth)
+    bool TableSceneNode::InitPanels(const ModelLoadingPipeline &pipeline, const U32 fpIndex, const U32 spIndex, const BoundingCube &tbb, const F32 mpDepth)
     {
-        BoundingCube fpBB, spBB;    // BoundingBoxes for the various pool table meshes.
+        const BoundingCube &fpBB = pipeline.GetBoundingBox(fpIndex);    // BoundingBoxes for the various pool table meshes.
+        const BoundingCube &spBB = pipeline.GetBoundingBox(spIndex);
 
-        // Load meshes into VBOs
-        boost::shared_ptr<IGLBatchBase> frontPanelBatch = LoadBatchFromResourceCache(m_param.GetFrontPanelMeshName(), &objLoader, progressObj, fpBB);
-        boost::shared_ptr<IGLBatchBase> sidePanelBatch = LoadBatchFromResourceCache(m_param.GetSidePanelMeshName(), &objLoader, progressObj, spBB);
+        boost::shared_ptr<IGLBatchBase> frontPanelBatch = pipeline.GetBatch(fpIndex);
+        boost::shared_ptr<IGLBatchBase> sidePanelBatch = pipeline.GetBatch(spIndex);
         if(!frontPanelBatch || !sidePanelBatch) {
             return (false);
         }
@@ -326,27 +329,22 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
-    bool TableSceneNode::InitPockets(ObjModelFileLoader &objLoader, ModelLoadingProgress &progressObj, const BoundingCube &tbb, F32 &mpDepth, F32 &pr)
+    bool TableSceneNode::InitPockets(const ModelLoadingPipeline &pipeline, const U32 mpIndex, const U32 cpIndex, const BoundingCube &tbb, F32 &mpDepth, F32 &pr)
     {
-        BoundingCube mpBB, cpBB;    // BoundingBoxes for the various pool table meshes.
+        const BoundingCube &mpBB = pipeline.GetBoundingBox(mpIndex);    // BoundingBoxes for the various pool table meshes.
+        const BoundingCube &cpBB = pipeline.GetBoundingBox(cpIndex);
 
-        // Parse and load the middle pocket mesh.
-        TriangleMesh mpMesh;
-        LoadMeshFromResourceCache(m_param.GetMiddlePocketMeshName(), &objLoader, progressObj, mpMesh);
+        const TriangleMesh &mpMesh = pipeline.GetMesh(mpIndex);
         if(mpMesh.empty()) {
             return (false);
         }
-
-        // Calculate the BB of the middle pocket.
-        GameHalloran::CalculateTriangleListBoundingBox(mpMesh, mpBB);
-        boost::shared_ptr<GLTriangleBatch> middlePocketBatch = ConvertTriangleListToBatch(mpMesh, &progressObj);
-        progressObj.NextStage();
+        boost::shared_ptr<GLTriangleBatch> middlePocketBatch = pipeline.GetBatch(mpIndex);
 
         F32 pocketRadius;           // Radius of a pool pocket.
         // Calculate the radius of the pool table pocket drop areas.
         Vertex currVertex;
         pocketRadius = -FLT_MAX;
-        for(TriangleList::iterator i = mpMesh.begin(), end = mpMesh.end(); i != end; ++i) {
+        for(TriangleList::const_iterator i = mpMesh.begin(), end = mpMesh.end(); i != end; ++i) {
             for(I32 vi = 0; vi < Triangle::eNumberVertices; ++vi) {
                 (*i)->GetVertex(Triangle::VertexId(vi), currVertex);
                 Vector3 posVec(currVertex.GetPosition());
@@ -359,8 +357,7 @@ namespace GameHalloran {
         }
         pr = pocketRadius;
 
-        // Load the corner and middle pocket batches into VBOs.
-        boost::shared_ptr<IGLBatchBase> cornerPocketBatch = LoadBatchFromResourceCache(m_param.GetCornerPocketMeshName(), &objLoader, progressObj, cpBB);
+        boost::shared_ptr<IGLBatchBase> cornerPocketBatch = pipeline.GetBatch(cpIndex);
         if(!cornerPocketBatch || !middlePocketBatch) {
             return (false);
         }
@@ -548,15 +545,18 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     void CueSceneNode::Init() throw(GameException &)
     {
-        ObjModelFileLoader objLoader;                       // 3D mesh loading object.
-        ModelLoadingProgress loadProgressObj(ePoolCue);     // Proress update interface.
-        BoundingCube bb;                                    // BoundingBox for cue mesh.
+        // Parse and weld the cue mesh on a worker, the same as the table meshes.
+        ModelLoadingPipeline pipeline(ePoolCue, g_appPtr->GetResourceCache().get(), g_appPtr->GetWorkerThreadPoolPtr());
+        const U32 cueIndex = pipeline.AddModel(m_param.GetMeshName());
+        pipeline.Start();
+        pipeline.Finish();
 
-        boost::shared_ptr<IGLBatchBase> cueBatch = LoadBatchFromResourceCache(m_param.GetMeshName(), &objLoader, loadProgressObj, bb);
+        boost::shared_ptr<IGLBatchBase> cueBatch = pipeline.GetBatch(cueIndex);
         if(!cueBatch) {
             throw GameException(std::string("Failed to load cue mesh"));
         }
         CommonBatchSceneNode::SetBatch(cueBatch);
+        const BoundingCube &bb = pipeline.GetBoundingBox(cueIndex);
 
         // Calculate the radius of the cue scene node.
         F32 maxWH = CmMax<F32>(bb.GetWidth(), bb.GetHeight());
@@ -32,6 +32,7 @@
 #include "CommonBatchSceneNode.h"
 #include "GameColors.h"
 #include "ObjModelFileLoader.h"
+#include "ModelLoadingPipeline.h"
 
 #include "Pool3dActors.h"
 
@@ -217,21 +218,23 @@ namespace GameHalloran {
         // /////////////////////////////////////////////////////////////////
         // Initiaize the table panel child scene nodes.
         //
-        // @param objLoader 3D mesh file loader.
-        // @param progressObj Loading progress reporting object.
+        // @param pipeline The finished table mesh loading pipeline.
+        // @param fpIndex Pipeline index of the front panel mesh.
+        // @param spIndex Pipeline index of the side panel mesh.
         // @param tbb Table mesh bounding box.
         // @param mpDepth The depth of the middle pocket
         //
         // @return bool True = success, false = failure.
         //
         // /////////////////////////////////////////////////////////////////
-        bool InitPanels(ObjModelFileLoader &objLoader, ModelLoadingProgress &progressObj, const BoundingCube &tbb, const F32 mpDepth);
+        bool InitPanels(const ModelLoadingPipeline &pipeline, const U32 fpIndex, const U32 spIndex, const BoundingCube &tbb, const F32 mpDepth);
 
         // /////////////////////////////////////////////////////////////////
         // Initialize the table pocket child scene nodes.
         //
-        // @param objLoader 3D mesh file loader.
-        // @param progressObj Loading progress reporting object.
+        // @param pipeline The finished table mesh loading pipeline.
+        // @param mpIndex Pipeline index of the middle pocket mesh.
+        // @param cpIndex Pipeline index of the corner pocket mesh.
         // @param tbb Table mesh bounding box.
         // @param mpDepth Stores the depth of the middle pocket mesh on exit.
         // @param pr Holds table pocket radius on exit.
@@ -239,7 +242,7 @@ namespace GameHalloran {
         // @return bool True = success, false = failure.
         //
         // /////////////////////////////////////////////////////////////////
-        bool InitPockets(ObjModelFileLoader &objLoader, ModelLoadingProgress &progressObj, const BoundingCube &tbb, F32 &mpDepth, F32 &pr);
+        bool InitPockets(const ModelLoadingPipeline &pipeline, const U32 mpIndex, const U32 cpIndex, const BoundingCube &tbb, F32 &mpDepth, F32 &pr);
 
     public:
 
@@ -87,6 +87,9 @@ namespace GameHalloran {
         } else if(eventObj.VGetEventType() == EvtData_Move_Actor::sk_EventType) {
             const EvtData_Move_Actor &castEvent = static_cast<const EvtData_Move_Actor &>(eventObj);
             result = OnMoveActorEvent(castEvent);
+        } else if(eventObj.VGetEventType() == EvtData_Move_Actors::sk_EventType) {
+            const EvtData_Move_Actors &castEvent = static_cast<const EvtData_Move_Actors &>(eventObj);
+            result = OnMoveActorsEvent(castEvent);
         } else if(eventObj.VGetEventType() == EvtData_New_Actor::sk_EventType) {
             const EvtData_New_Actor &castEvent = static_cast<const EvtData_New_Actor &>(eventObj);
             result = OnNewActorEvent(castEvent);
@@ -160,6 +163,19 @@ namespace GameHalloran {
         return (false);
     }
 
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool Pool3dViewEventListener::OnMoveActorsEvent(const EvtData_Move_Actors &eventData)
+    {
+        const EvtData_Move_Actors::ActorMovementVec &movements = eventData.GetMovements();
+        for(EvtData_Move_Actors::ActorMovementVec::const_iterator i = movements.begin(), end = movements.end(); i != end; ++i) {
+            m_viewPtr->MoveActor(i->m_id, i->m_mat);
+        }
+        // Allow logic layer to receieve event too.
+        return (false);
+    }
+
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
@@ -564,6 +580,12 @@ namespace GameHalloran {
 
         // TODO: 3) Make all shader attribute names and locations the same to make swapping between shaders easier and less error prone.
 
+        // The ADS shader is built with uniform blocks unless they are disabled in the options.
+        bool adsUniformBlocks = true;
+        boost::shared_ptr<GameOptions> opPtr = g_appPtr->GetGameOptions();
+        RetrieveAndConvertOption<bool>(opPtr, string("AdsUniformBlocks"), GameOptions::PROGRAMMER, adsUniformBlocks);
+        m_sgm.SetAdsUniformBlocksEnabled(adsUniformBlocks);
+
         // Create and add all required shaders to the SGM.
         std::vector<std::string> shaderNameVec;
         std::vector<VSAttributeNameList> shaderAttVec;
@@ -685,7 +707,7 @@ namespace GameHalloran {
     Pool3dView::Pool3dView(shared_ptr<GameOptions> optionsPtr, shared_ptr<GameLog> loggerPtr, shared_ptr<WindowManager> screenManPtr, shared_ptr<ModelViewProjStackManager> matStackManager, Frustrum *viewFrustrumPtr) throw(GameException &)
         : HumanView(optionsPtr, loggerPtr, screenManPtr), m_stackManager(matStackManager), m_modelViewStackPtr(), m_projStackPtr(), m_controller(), m_sgm(matStackManager), m_cameraNode(), m_viewFrustrumPtr(viewFrustrumPtr), \
         m_listenerPtr(), m_state(BGS_Initializing), m_commonPoolBallMesh(), m_ddm(eScene), m_ballCollisionFxBuf(), m_wallCollisionFxBuf(), m_cueCollisionFxBuf(), m_ballDropCollisionFxBuf(), m_tableId(0), m_cueId(0), \
-        m_playMusic(true), m_playSoundFx(true), m_skyboxNodePtr(), m_hudContainerPtr()
+        m_playMusic(true), m_playSoundFx(true), m_skyboxNodePtr(), m_ballTexturePipelinePtr(), m_hudContainerPtr()
     {
         if(!m_stackManager) {
             throw GameException(string("Matrix manager passed to Pool3dView is NULL"));
@@ -713,6 +735,7 @@ namespace GameHalloran {
         safeAddListener(m_listenerPtr, EvtData_Destroy_Actor::sk_EventType);
         safeAddListener(m_listenerPtr, EvtData_Game_State::sk_EventType);
         safeAddListener(m_listenerPtr, EvtData_Move_Actor::sk_EventType);
+        safeAddListener(m_listenerPtr, EvtData_Move_Actors::sk_EventType);
         safeAddListener(m_listenerPtr, EvtData_New_Actor::sk_EventType);
         safeAddListener(m_listenerPtr, EvtData_New_Game::sk_EventType);
         safeAddListener(m_listenerPtr, EvtData_UpdateActorParams::sk_EventType);
@@ -752,6 +775,17 @@ namespace GameHalloran {
             throw GameException(string("Failed to build the GLSL shaders for the SGM"));
         }
 
+        // Decode the ball textures on the worker threads while the rest of the view loads.  The
+        //  listing names are lower case, which matches the names used by the ball actors.
+        ResourceListing ballTextureList;
+        m_ballTexturePipelinePtr.reset(GCC_NEW ImageLoadingPipeline(g_appPtr->GetResourceCache().get(), g_appPtr->GetWorkerThreadPoolPtr()));
+        if(g_appPtr->GetResourceCache()->GetResourceListing("^textures/ball[0-9]+\\.(tga|png|jpe?g)$", ballTextureList)) {
+            for(ResourceListing::const_iterator i = ballTextureList.begin(), end = ballTextureList.end(); i != end; ++i) {
+                m_ballTexturePipelinePtr->AddImage(i->string());
+            }
+        }
+        m_ballTexturePipelinePtr->Start();
+
         // Create and add the sky box.
         std::vector<std::string> cubeMapTextureVec;
         cubeMapTextureVec.push_back(std::string("textures") + ZipFile::ZIP_PATH_SEPERATOR + std::string("clouds.tga"));
@@ -782,6 +816,11 @@ namespace GameHalloran {
         m_font.SetMatrictStack(m_stackManager);
         m_font.SetShader(m_sgm.GetShader(std::string("shaders") + ZipFile::ZIP_PATH_SEPERATOR + string("font_2d")));
         m_font.SetText(std::string("Hello World"), g_gcGreen, Point3(g_appPtr->GetWindowManager()->GetWidth() * 0.5f, (float)g_appPtr->GetWindowManager()->GetHeight() * 0.5f, 0.0f));
+
+        // The ball scene nodes may read the textures from the cache as soon as the view exists.
+        if(!m_ballTexturePipelinePtr->Finish()) {
+            GF_LOG_TRACE_ERR("Pool3dView::Pool3dView()", "Failed to decode all of the ball textures");
+        }
     }
 
     // /////////////////////////////////////////////////////////////////
@@ -805,6 +844,7 @@ namespace GameHalloran {
             safeDelListener(m_listenerPtr, EvtData_Destroy_Actor::sk_EventType);
             safeDelListener(m_listenerPtr, EvtData_Game_State::sk_EventType);
             safeDelListener(m_listenerPtr, EvtData_Move_Actor::sk_EventType);
+            safeDelListener(m_listenerPtr, EvtData_Move_Actors::sk_EventType);
             safeDelListener(m_listenerPtr, EvtData_New_Actor::sk_EventType);
             safeDelListener(m_listenerPtr, EvtData_Destroy_Actor::sk_EventType);
             safeDelListener(m_listenerPtr, EvtData_New_Game::sk_EventType);
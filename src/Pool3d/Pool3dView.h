@@ -32,6 +32,7 @@
 #include "EventManager.h"
 #include "GLTriangleBatch.h"
 #include "EnvironmentSceneNode.h"
+#include "ImageLoadingPipeline.h"
 #include "MyOpenGLUI.h"
 
 #include "OpenAlAudio.h"
@@ -123,6 +124,18 @@ namespace GameHalloran {
         // /////////////////////////////////////////////////////////////////
         bool OnMoveActorEvent(const EvtData_Move_Actor &eventData);
 
+        // /////////////////////////////////////////////////////////////////
+        // Callback triggered when a EvtData_Move_Actors event
+        // is broadcast.
+        //
+        // @param eventData The event data object.
+        //
+        // @return bool True if the event is to be stopped now or false if the
+        //                  event should be propagated further.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool OnMoveActorsEvent(const EvtData_Move_Actors &eventData);
+
         // /////////////////////////////////////////////////////////////////
         // Callback triggered when a EvtData_New_Actor event
         // is broadcast.
@@ -318,6 +331,8 @@ namespace GameHalloran {
 
         boost::shared_ptr<EnvironmentSceneNode> m_skyboxNodePtr;        ///< Pointer to the skybox scene node.
 
+        boost::shared_ptr<ImageLoadingPipeline> m_ballTexturePipelinePtr;   ///< Keeps the ball textures decoded while the view loads in the cache until the game runs.
+
         boost::shared_ptr<ContainerWidget> m_hudContainerPtr;           ///< Pointer to the HUD game status overlay widget container.
 
         FontRenderer m_font;
@@ -443,6 +458,10 @@ namespace GameHalloran {
         // /////////////////////////////////////////////////////////////////
         inline void SetState(const BaseGameState state) {
             m_state = state;
+            if(state == BGS_Running) {
+                // The ball scene nodes have loaded their textures by now.
+                m_ballTexturePipelinePtr.reset();
+            }
         };
 
         // /////////////////////////////////////////////////////////////////
@@ -1,6 +1,6 @@
 #version 150
 
-uniform sampler2D texture;
+uniform sampler2D fontTexture;
 
 smooth in vec2 tex_coord_out;
 in vec4 color_out;
@@ -9,6 +9,6 @@ out vec4 fragmentColor;
 
 void main()
 {
-    float a = texture(texture, tex_coord_out.st).r;
+    float a = texture(fontTexture, tex_coord_out.st).r;
     fragmentColor = vec4(color_out.rgb, color_out.a*a);
 }
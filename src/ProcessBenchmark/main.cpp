@@ -0,0 +1,333 @@
+// /////////////////////////////////////////////////////////////////////////////
+// @file main.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Headless process benchmark.  Updates a CProcessManager full of thread
+// safe interpolator processes (each integrating a handful of particles,
+// with every third one chaining a follow on process through SetNext()
+// when it dies) for a number of frames, first in order on the calling
+// thread and then shared with WorkerThreadPools of a growing number of
+// threads.  Reports the time per frame and speedup of each run and
+// checks every run left the processes in the same state.
+//
+// Then churns short lived interpolator processes (CHURN_LIVE_PROCESSES
+// alive, CHURN_LIFETIME frames each, so CHURN_LIVE_PROCESSES /
+// CHURN_LIFETIME replaced every frame) through the CProcessManager and
+// through LegacyProcessManager, a copy of the std::list manager it
+// replaced, and checks both finished the same processes.
+//
+// Usage: ProcessBenchmark [numberProcesses] [numberFrames] [maxThreads]
+//
+// /////////////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <vector>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "GameBase.h"
+#include "CProcess.h"
+#include "WorkerThreadPool.h"
+
+using GameHalloran::U32;
+using GameHalloran::I32;
+using GameHalloran::F32;
+using GameHalloran::F64;
+using GameHalloran::CProcess;
+using GameHalloran::CProcessManager;
+using GameHalloran::WorkerThreadPool;
+
+namespace {
+
+    const U32 DEFAULT_NUMBER_PROCESSES = 20000;     ///< Processes attached at the start.
+    const U32 DEFAULT_NUMBER_FRAMES = 300;          ///< Five seconds at 60Hz.
+    const U32 DEFAULT_MAX_THREADS = 8;              ///< Largest thread count benchmarked.
+    const F32 FRAME_SECONDS = 1.0f / 60.0f;         ///< Time passed to each update.
+    const U32 NUMBER_PARTICLES = 16;                ///< Particles integrated by each process.
+    const U32 CHAIN_EVERY = 3;                      ///< One in this many processes has a next process.
+    const U32 CHURN_LIVE_PROCESSES = 10000;         ///< Interpolators alive during the churn.
+    const U32 CHURN_LIFETIME = 25;                  ///< Frames each interpolator lives.
+
+    // /////////////////////////////////////////////////////////////////
+    // @class ParticleProcess
+    //
+    // Thread safe process which integrates its particles under gravity,
+    // bouncing them off the floor, and dies after a number of frames.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class ParticleProcess : public CProcess {
+    private:
+        F32 m_pos[NUMBER_PARTICLES * 3];            ///< Particle positions.
+        F32 m_vel[NUMBER_PARTICLES * 3];            ///< Particle velocities.
+        U32 m_framesLeft;                           ///< Frames until the process dies.
+        F32 *m_checksumPtr;                         ///< Where the final state is summed when the process dies.
+
+    public:
+        ParticleProcess(const U32 seed, const U32 lifetime, F32 *checksumPtr) : CProcess(GameHalloran::PROC_INTERPOLATOR), m_framesLeft(lifetime), m_checksumPtr(checksumPtr) {
+            for(U32 i = 0; i < NUMBER_PARTICLES * 3; ++i) {
+                m_pos[i] = F32((seed * 7 + i * 13) % 97) * 0.01f;
+                m_vel[i] = F32((seed * 11 + i * 5) % 89) * 0.02f - 0.9f;
+            }
+            SetThreadSafe(true);
+        };
+
+        virtual void VOnUpdate(const F32 elapsedTime) {
+            CProcess::VOnUpdate(elapsedTime);
+            for(U32 i = 0; i < NUMBER_PARTICLES * 3; i += 3) {
+                m_vel[i + 1] -= 9.81f * elapsedTime;
+                for(U32 axis = 0; axis < 3; ++axis) {
+                    m_pos[i + axis] += m_vel[i + axis] * elapsedTime;
+                }
+                if(m_pos[i + 1] < 0.0f) {
+                    m_pos[i + 1] = -m_pos[i + 1];
+                    m_vel[i + 1] = -m_vel[i + 1] * 0.8f;
+                }
+            }
+            if(--m_framesLeft == 0) {
+                F32 sum = 0.0f;
+                for(U32 i = 0; i < NUMBER_PARTICLES * 3; ++i) {
+                    sum += m_pos[i];
+                }
+                *m_checksumPtr = sum;
+                VKill();
+            }
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @class InterpolatorProcess
+    //
+    // Short lived process which moves a value from 0 to 1 over its
+    // lifetime and adds the final value to a sum when it dies.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class InterpolatorProcess : public CProcess {
+    private:
+        U32 m_frame;                                ///< Frames updated so far.
+        U32 m_lifetime;                             ///< Frames until the process dies.
+        F32 m_value;                                ///< Interpolated value.
+        F64 *m_sumPtr;                              ///< Where the final value is added.
+    public:
+        InterpolatorProcess(const U32 lifetime, F64 *sumPtr) : CProcess(GameHalloran::PROC_INTERPOLATOR), m_frame(0), m_lifetime(lifetime), \
+            m_value(0.0f), m_sumPtr(sumPtr) {};
+
+        virtual void VOnUpdate(const F32 elapsedTime) {
+            CProcess::VOnUpdate(elapsedTime);
+            m_value = F32(++m_frame) / F32(m_lifetime);
+            if(m_frame == m_lifetime) {
+                *m_sumPtr += F64(m_value);
+                VKill();
+            }
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @class LegacyProcessManager
+    //
+    // The std::list process manager CProcessManager replaced, kept to
+    // compare against.  Every update copies a shared_ptr per process
+    // and every dead process is removed with an O(n) list remove.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class LegacyProcessManager {
+    private:
+        typedef std::list<boost::shared_ptr<CProcess> > ProcessList;
+
+        ProcessList m_processList;                  ///< Attached processes.
+
+        void Detach(boost::shared_ptr<CProcess> pProcess) {
+            m_processList.remove(pProcess);
+            pProcess->SetAttached(false);
+        };
+
+    public:
+        ~LegacyProcessManager() {
+            for(ProcessList::iterator i = m_processList.begin(), end = m_processList.end(); i != end; ++i) {
+                (*i)->SetAttached(false);
+                (*i)->VKill();
+            }
+        };
+
+        void Attach(boost::shared_ptr<CProcess> pProcess) {
+            pProcess->SetAttached(true);
+            m_processList.push_back(pProcess);
+        };
+
+        bool IsProcessActive(const I32 nType) {
+            for(ProcessList::iterator i = m_processList.begin(), end = m_processList.end(); i != end; ++i) {
+                if((*i)->GetType() == nType && (!(*i)->IsDead() || (*i)->GetNext())) {
+                    return (true);
+                }
+            }
+            return (false);
+        };
+
+        void UpdateProcesses(const F32 elapsedTime) {
+            ProcessList::iterator i = m_processList.begin();
+            ProcessList::iterator end = m_processList.end();
+            while(i != end) {
+                boost::shared_ptr<CProcess> p(*i);
+                ++i;
+
+                if(p->IsDead()) {
+                    boost::shared_ptr<CProcess> pNext(p->GetNext());
+                    if(pNext) {
+                        p->SetNext(boost::shared_ptr<CProcess>());
+                        Attach(pNext);
+                    }
+                    Detach(p);
+                } else if(p->IsActive() && !p->IsPaused()) {
+                    p->VOnUpdate(elapsedTime);
+                }
+            }
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Get the current wall clock time in seconds.
+    //
+    // /////////////////////////////////////////////////////////////////
+    F64 GetSeconds()
+    {
+        static const boost::posix_time::ptime epoch(boost::posix_time::microsec_clock::universal_time());
+        return (F64((boost::posix_time::microsec_clock::universal_time() - epoch).total_microseconds()) / 1000000.0);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Run the benchmark once.
+    //
+    // @param poolPtr Worker threads to update the processes on (NULL to
+    //                  update them in order on the calling thread).
+    // @param checksums Final state of each process (and its next
+    //                  process) on return.
+    //
+    // @return F64 The time spent updating the processes.
+    //
+    // /////////////////////////////////////////////////////////////////
+    F64 RunBenchmark(boost::shared_ptr<WorkerThreadPool> poolPtr, const U32 numberProcesses, const U32 numberFrames, std::vector<F32> &checksums)
+    {
+        CProcessManager mgr;
+        mgr.SetWorkerThreadPool(poolPtr);
+
+        checksums.assign(numberProcesses * 2, 0.0f);
+        for(U32 i = 0; i < numberProcesses; ++i) {
+            boost::shared_ptr<CProcess> processPtr(new ParticleProcess(i, 1 + (i * 31) % numberFrames, &checksums[i * 2]));
+            if(i % CHAIN_EVERY == 0) {
+                processPtr->SetNext(boost::shared_ptr<CProcess>(new ParticleProcess(i + 1, 1 + (i * 17) % numberFrames, &checksums[i * 2 + 1])));
+            }
+            mgr.Attach(processPtr);
+        }
+
+        const F64 start = GetSeconds();
+        for(U32 frame = 0; frame < numberFrames; ++frame) {
+            mgr.UpdateProcesses(FRAME_SECONDS);
+        }
+        return (GetSeconds() - start);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Churn short lived interpolators through a process manager,
+    // replacing the ones that died each frame and checking for an
+    // active interpolator as the game logic does.
+    //
+    // @param sum Sum of the final values of the finished processes on
+    //              return.
+    //
+    // @return F64 The time spent attaching and updating the processes.
+    //
+    // /////////////////////////////////////////////////////////////////
+    template<typename Manager>
+    F64 RunChurn(const U32 numberFrames, F64 &sum)
+    {
+        const U32 attachPerFrame = CHURN_LIVE_PROCESSES / CHURN_LIFETIME;
+        Manager mgr;
+        sum = 0.0;
+
+        const F64 start = GetSeconds();
+        // Stagger the first processes so the same number die every frame.
+        for(U32 i = 0; i < CHURN_LIVE_PROCESSES; ++i) {
+            mgr.Attach(boost::shared_ptr<CProcess>(new InterpolatorProcess(1 + i % CHURN_LIFETIME, &sum)));
+        }
+        for(U32 frame = 0; frame < numberFrames; ++frame) {
+            mgr.UpdateProcesses(FRAME_SECONDS);
+            if(!mgr.IsProcessActive(GameHalloran::PROC_INTERPOLATOR)) {
+                return (-1.0);
+            }
+            for(U32 i = 0; i < attachPerFrame; ++i) {
+                mgr.Attach(boost::shared_ptr<CProcess>(new InterpolatorProcess(CHURN_LIFETIME, &sum)));
+            }
+        }
+        return (GetSeconds() - start);
+    }
+
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+int main(int args, char *argv[])
+{
+    const U32 numberProcesses = (args > 1) ? U32(atoi(argv[1])) : DEFAULT_NUMBER_PROCESSES;
+    const U32 numberFrames = (args > 2) ? U32(atoi(argv[2])) : DEFAULT_NUMBER_FRAMES;
+    const U32 maxThreads = (args > 3) ? U32(atoi(argv[3])) : DEFAULT_MAX_THREADS;
+    if(numberFrames == 0) {
+        std::cerr << "The number of frames must be greater than 0" << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    // The GLFW thread API needs GLFW to be initialized.
+    if(glfwInit() != GL_TRUE) {
+        std::cerr << "Failed to initialize GLFW, the worker threads can not be created" << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    std::cout << "Updating " << numberProcesses << " particle processes (1 in " << CHAIN_EVERY << " with a next process) for " << numberFrames << " frames" << std::endl;
+
+    std::vector<F32> reference;
+    const F64 serialSeconds = RunBenchmark(boost::shared_ptr<WorkerThreadPool>(), numberProcesses, numberFrames, reference);
+    std::cout << std::fixed << std::setprecision(3)
+              << "in order    avg frame " << std::setw(7) << (serialSeconds * 1000.0 / F64(numberFrames)) << "ms" << std::endl;
+
+    bool allMatch = true;
+    for(U32 numberThreads = 1; numberThreads <= maxThreads; numberThreads *= 2) {
+        // The calling thread updates processes too.
+        boost::shared_ptr<WorkerThreadPool> poolPtr(new WorkerThreadPool(numberThreads - 1));
+        if(!poolPtr->IsValid()) {
+            std::cerr << "Failed to create a worker thread pool" << std::endl;
+            glfwTerminate();
+            return (EXIT_FAILURE);
+        }
+
+        std::vector<F32> checksums;
+        const F64 seconds = RunBenchmark(poolPtr, numberProcesses, numberFrames, checksums);
+        const bool match = (checksums == reference);
+        allMatch = allMatch && match;
+
+        std::cout << std::fixed << std::setprecision(3)
+                  << "threads " << std::setw(2) << numberThreads
+                  << "  avg frame " << std::setw(7) << (seconds * 1000.0 / F64(numberFrames)) << "ms"
+                  << "  speedup " << std::setw(5) << (serialSeconds / seconds) << "x"
+                  << (match ? "" : "  MISMATCH") << std::endl;
+    }
+
+    std::cout << "Churning " << CHURN_LIVE_PROCESSES << " interpolator processes (" << (CHURN_LIVE_PROCESSES / CHURN_LIFETIME)
+              << " replaced a frame) for " << numberFrames << " frames" << std::endl;
+    F64 sum = 0.0, legacySum = 0.0;
+    const F64 seconds = RunChurn<CProcessManager>(numberFrames, sum);
+    const F64 legacySeconds = RunChurn<LegacyProcessManager>(numberFrames, legacySum);
+    const bool churnMatch = (seconds >= 0.0 && legacySeconds >= 0.0 && sum == legacySum);
+    allMatch = allMatch && churnMatch;
+    std::cout << std::fixed << std::setprecision(3)
+              << "std::list   avg frame " << std::setw(7) << (legacySeconds * 1000.0 / F64(numberFrames)) << "ms" << std::endl
+              << "slot array  avg frame " << std::setw(7) << (seconds * 1000.0 / F64(numberFrames)) << "ms"
+              << "  speedup " << std::setw(5) << (legacySeconds / seconds) << "x"
+              << (churnMatch ? "" : "  MISMATCH") << std::endl;
+
+    glfwTerminate();
+    return (allMatch ? EXIT_SUCCESS : EXIT_FAILURE);
+}
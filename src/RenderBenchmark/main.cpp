@@ -0,0 +1,223 @@
+// /////////////////////////////////////////////////////////////////////////////
+// @file main.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Headless render benchmark.  Built with GF_GL_RECORDING so the framework
+// renders through the GLRecorder and opens the headless window instead of
+// a real one, then starts Pool3D, renders a number of frames and reports
+// the average OpenGL call counts of a frame (draw calls, vertices, state
+// changes, binds, uniform uploads, queries and bytes uploaded) and those
+// of the last frame.  Loading is not counted.  The counts do not depend
+// on the GPU or driver, so they can be compared across changes and
+// machines.  On X11 GLFW still needs a display to initialize, so run it
+// under Xvfb on machines without one.
+//
+// The ADS shader is built with its uniform blocks unless uniformBlocks is
+// 0, when PrepareAdsShader() sets its loose uniforms one at a time.  Run
+// it both ways to compare the uniform uploads of a frame.
+//
+// Usage: RenderBenchmark [numberFrames] [gameRoot] [uniformBlocks]
+//
+// /////////////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "GameBase.h"
+#include "GameLog.h"
+#include "GameException.h"
+#include "GameOptions.h"
+#include "GLRecorder.h"
+#include "Pool3dGame.h"
+
+#ifndef GF_GL_RECORDING
+#error "The RenderBenchmark must be built with GF_GL_RECORDING defined"
+#endif
+
+using GameHalloran::U32;
+using GameHalloran::U64;
+using GameHalloran::F64;
+using GameHalloran::GameLog;
+using GameHalloran::GameOptions;
+using GameHalloran::GameException;
+using GameHalloran::GLRecorder;
+using GameHalloran::GLRecorderStats;
+
+namespace {
+
+    const U32 DEFAULT_NUMBER_FRAMES = 600;          ///< Frames rendered.
+    const bool DEFAULT_UNIFORM_BLOCKS = true;       ///< Build the ADS shader with its uniform blocks.
+
+    // /////////////////////////////////////////////////////////////////
+    // Get the current wall clock time in seconds.
+    //
+    // /////////////////////////////////////////////////////////////////
+    F64 GetSeconds()
+    {
+        static const boost::posix_time::ptime epoch(boost::posix_time::microsec_clock::universal_time());
+        return (F64((boost::posix_time::microsec_clock::universal_time() - epoch).total_microseconds()) / 1000000.0);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Add the counts of a frame to a total.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void AddStats(GLRecorderStats &totalRef, const GLRecorderStats &frame)
+    {
+        totalRef.m_calls += frame.m_calls;
+        totalRef.m_drawCalls += frame.m_drawCalls;
+        totalRef.m_verticesDrawn += frame.m_verticesDrawn;
+        totalRef.m_stateChanges += frame.m_stateChanges;
+        totalRef.m_redundantStateChanges += frame.m_redundantStateChanges;
+        totalRef.m_textureBinds += frame.m_textureBinds;
+        totalRef.m_bufferBinds += frame.m_bufferBinds;
+        totalRef.m_programBinds += frame.m_programBinds;
+        totalRef.m_uniformUploads += frame.m_uniformUploads;
+        totalRef.m_queries += frame.m_queries;
+        totalRef.m_objectsCreated += frame.m_objectsCreated;
+        totalRef.m_objectsDeleted += frame.m_objectsDeleted;
+        totalRef.m_textureBytesUploaded += frame.m_textureBytesUploaded;
+        totalRef.m_bufferBytesUploaded += frame.m_bufferBytesUploaded;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Print one count, its average per frame and its value in the last
+    // frame.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void PrintCount(const char *name, const U64 total, const U64 last, const U32 numberFrames)
+    {
+        std::cout << std::fixed << std::setprecision(2) << "     " << std::left << std::setw(26) << name << std::right
+                  << "  " << std::setw(12) << (F64(total) / F64(numberFrames))
+                  << "  " << std::setw(10) << last << std::endl;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // @class RecordingPool3dGame
+    //
+    // Pool3D game which adds up the OpenGL call counts of every frame
+    // rendered.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class RecordingPool3dGame : public GameHalloran::Pool3dGame {
+    private:
+        GLRecorderStats m_totalStats;           ///< Counts of all the frames rendered.
+        U32 m_numberFrames;                     ///< Frames rendered.
+
+    protected:
+        virtual void VRender() {
+            // GameMain::VRender() ends the recorder's frame.
+            Pool3dGame::VRender();
+            AddStats(m_totalStats, GLRecorder::GetGlobalInstance().GetLastFrameStats());
+            ++m_numberFrames;
+        };
+
+    public:
+        RecordingPool3dGame(boost::shared_ptr<GameLog> loggerPtr, boost::shared_ptr<GameOptions> optionsPtr) throw(GameException &)
+            : Pool3dGame(loggerPtr, optionsPtr), m_totalStats(), m_numberFrames(0) {};
+        inline const GLRecorderStats &GetTotalStats() const {
+            return (m_totalStats);
+        };
+        inline U32 GetNumberFramesRendered() const {
+            return (m_numberFrames);
+        };
+    };
+
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+int main(int args, char *argv[])
+{
+    const U32 numberFrames = (args > 1) ? U32(atoi(argv[1])) : DEFAULT_NUMBER_FRAMES;
+    const bool uniformBlocks = (args > 3) ? (atoi(argv[3]) != 0) : DEFAULT_UNIFORM_BLOCKS;
+    if(numberFrames == 0) {
+        std::cerr << "The number of frames must be greater than 0" << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    // The game root is found as Pool3D finds it, the parent of the working directory.
+    const std::string rootDir(((args > 2) ? boost::filesystem::path(std::string(argv[2])) : boost::filesystem::current_path().parent_path()).string() + "/");
+    const boost::filesystem::path optionsFilePath(rootDir + "data/Pool3D/options.xml");
+    const boost::filesystem::path logFilePath(rootDir + "log/RenderBenchmark.log");
+    if(!boost::filesystem::is_regular_file(optionsFilePath)) {
+        std::cerr << "No Pool3D options file at " << optionsFilePath.string() << std::endl;
+        return (EXIT_FAILURE);
+    }
+    boost::filesystem::create_directories(logFilePath.parent_path());
+
+    boost::shared_ptr<GameLog> logPtr;
+    boost::shared_ptr<GameOptions> optionsPtr;
+    boost::shared_ptr<RecordingPool3dGame> gamePtr;
+    int value = EXIT_SUCCESS;
+    try {
+        logPtr.reset(GCC_NEW GameLog(logFilePath, GameLog::ERR, true));
+        optionsPtr.reset(GCC_NEW GameOptions(logPtr, optionsFilePath));
+        if(!optionsPtr->IsOptionsFileLoaded()) {
+            optionsPtr->ParseFile(optionsFilePath);
+        }
+        // Point the game at the root being benchmarked without committing the options file.
+        optionsPtr->Edit(std::string("GameRoot"), rootDir, GameOptions::PROGRAMMER);
+        optionsPtr->Edit(std::string("AdsUniformBlocks"), std::string(uniformBlocks ? "1" : "0"), GameOptions::PROGRAMMER);
+
+        gamePtr.reset(GCC_NEW RecordingPool3dGame(logPtr, optionsPtr));
+        if(!gamePtr->Initialize()) {
+            std::cerr << "Failed to initialize Pool3D, check " << logFilePath.string() << std::endl;
+            value = EXIT_FAILURE;
+        } else {
+            // Leave the uploads made while loading out of the first frame.
+            GLRecorder::GetGlobalInstance().ResetStats();
+
+            const F64 start = GetSeconds();
+            const U32 framesRun = gamePtr->RunFrames(numberFrames);
+            const F64 seconds = GetSeconds() - start;
+            const U32 framesRendered = gamePtr->GetNumberFramesRendered();
+            if(framesRendered == 0) {
+                std::cerr << "Pool3D stopped before rendering a frame" << std::endl;
+                value = EXIT_FAILURE;
+            } else {
+                const GLRecorderStats &total = gamePtr->GetTotalStats();
+                const GLRecorderStats &last = GLRecorder::GetGlobalInstance().GetLastFrameStats();
+                std::cout << "Pool3D, " << framesRun << " frames through the GLRecorder, ADS uniform blocks "
+                          << (uniformBlocks ? "on" : "off") << std::endl;
+                std::cout << "     " << std::left << std::setw(26) << "count" << std::right << "  " << std::setw(12) << "per frame"
+                          << "  " << std::setw(10) << "last frame" << std::endl;
+                PrintCount("calls", total.m_calls, last.m_calls, framesRendered);
+                PrintCount("draw calls", total.m_drawCalls, last.m_drawCalls, framesRendered);
+                PrintCount("vertices drawn", total.m_verticesDrawn, last.m_verticesDrawn, framesRendered);
+                PrintCount("state changes", total.m_stateChanges, last.m_stateChanges, framesRendered);
+                PrintCount("redundant state changes", total.m_redundantStateChanges, last.m_redundantStateChanges, framesRendered);
+                PrintCount("texture binds", total.m_textureBinds, last.m_textureBinds, framesRendered);
+                PrintCount("buffer binds", total.m_bufferBinds, last.m_bufferBinds, framesRendered);
+                PrintCount("program binds", total.m_programBinds, last.m_programBinds, framesRendered);
+                PrintCount("uniform uploads", total.m_uniformUploads, last.m_uniformUploads, framesRendered);
+                PrintCount("queries", total.m_queries, last.m_queries, framesRendered);
+                PrintCount("texture bytes uploaded", total.m_textureBytesUploaded, last.m_textureBytesUploaded, framesRendered);
+                PrintCount("buffer bytes uploaded", total.m_bufferBytesUploaded, last.m_bufferBytesUploaded, framesRendered);
+                if(total.m_drawCalls > 0) {
+                    std::cout << std::fixed << std::setprecision(2) << "     uniform uploads per draw call "
+                              << (F64(total.m_uniformUploads) / F64(total.m_drawCalls)) << std::endl;
+                }
+                std::cout << std::fixed << std::setprecision(3) << "     CPU time " << (seconds * 1000.0 / F64(framesRun)) << "ms/frame" << std::endl;
+            }
+        }
+    } catch(GameException &ge) {
+        std::cerr << "Exception was caught in main(): " << ge.what() << std::endl;
+        value = EXIT_FAILURE;
+    }
+
+    // Free the game objects in reverse order to how they were allocated.
+    gamePtr.reset();
+    optionsPtr.reset();
+    logPtr.reset();
+
+    return (value);
+}
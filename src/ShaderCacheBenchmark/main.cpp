@@ -0,0 +1,249 @@
+// /////////////////////////////////////////////////////////////////////////////
+// @file main.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Shader program cache startup benchmark.  Opens an OpenGL 3.2 core
+// window and builds every program (.vp and .fp files, with an optional
+// .gp file) in a shader directory, the Pool3D shaders by default, through
+// a ShaderProgramCache.  The programs are first built with an empty cache,
+// as on the first run after an install or driver update, and then with
+// the cache that build filled, as on every later run.  Reports the
+// average time of both and the startup time the cache saves.
+//
+// Most drivers keep their own cache of compiled shaders, so the empty
+// cache builds are faster after the first run.  Disable it for the full
+// cost of a cold start, e.g. __GL_SHADER_DISK_CACHE=0 on NVIDIA and
+// MESA_SHADER_CACHE_DISABLE=true on Mesa.
+//
+// Usage: ShaderCacheBenchmark [shaderDirectory] [numberRuns]
+//
+// /////////////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "GameBase.h"
+#include "GLSLShader.h"
+#include "ShaderProgramCache.h"
+
+using GameHalloran::U32;
+using GameHalloran::F64;
+using GameHalloran::GLSLShader;
+using GameHalloran::ShaderProgramCache;
+using GameHalloran::ShaderProgramCacheStats;
+
+namespace {
+
+    const char * const DEFAULT_SHADER_DIRECTORY = "../src/Pool3d/data/shaders";
+    const U32 DEFAULT_NUMBER_RUNS = 5;              ///< Empty and filled cache builds averaged.
+
+    // /////////////////////////////////////////////////////////////////
+    // @struct ProgramSource
+    //
+    // The source files of a program.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct ProgramSource {
+        std::string m_name;                     ///< Name of the program, its filename without an extension.
+        std::string m_vsSrc;                    ///< Vertex shader source.
+        std::string m_gsSrc;                    ///< Geometry shader source, empty if there is none.
+        std::string m_fsSrc;                    ///< Fragment shader source.
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Get the current wall clock time in seconds.
+    //
+    // /////////////////////////////////////////////////////////////////
+    F64 GetSeconds()
+    {
+        static const boost::posix_time::ptime epoch(boost::posix_time::microsec_clock::universal_time());
+        return (F64((boost::posix_time::microsec_clock::universal_time() - epoch).total_microseconds()) / 1000000.0);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Read a text file.
+    //
+    // @return bool False if the file could not be read.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ReadFile(const boost::filesystem::path &filePath, std::string &outRef)
+    {
+        std::ifstream in(filePath.string().c_str(), std::ios::in | std::ios::binary);
+        if(!in) {
+            return (false);
+        }
+        std::ostringstream contents;
+        contents << in.rdbuf();
+        outRef = contents.str();
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Create a window for the OpenGL context and initialize GLEW.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool InitOpenGL()
+    {
+        if(glfwInit() != GL_TRUE) {
+            std::cerr << "Failed to initialize GLFW" << std::endl;
+            return (false);
+        }
+
+        // The context Pool3D asks for.
+        glfwOpenWindowHint(GLFW_OPENGL_VERSION_MAJOR, 3);
+        glfwOpenWindowHint(GLFW_OPENGL_VERSION_MINOR, 2);
+        glfwOpenWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        if(glfwOpenWindow(64, 64, 8, 8, 8, 8, 24, 0, GLFW_WINDOW) != GL_TRUE) {
+            std::cerr << "Failed to open an OpenGL 3.2 core window" << std::endl;
+            glfwTerminate();
+            return (false);
+        }
+
+        glewExperimental = GL_TRUE;
+        GLenum res = glewInit();
+        if(GLEW_OK != res) {
+            std::cerr << "Failed to initialize the GLEW library: " << std::string(reinterpret_cast<const char *>(glewGetErrorString(res))) << std::endl;
+            glfwTerminate();
+            return (false);
+        }
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Build every program through a cache in a directory.
+    //
+    // @param statsRef Output counts of the cache.
+    //
+    // @return F64 The time taken in seconds or a negative value if any
+    //              program failed to build.
+    //
+    // /////////////////////////////////////////////////////////////////
+    F64 BuildPrograms(const std::vector<ProgramSource> &programs, const boost::filesystem::path &cacheDir, const std::string &driverStr, \
+                      ShaderProgramCacheStats &statsRef)
+    {
+        boost::shared_ptr<ShaderProgramCache> cachePtr(new ShaderProgramCache(cacheDir, driverStr));
+        if(!cachePtr->IsValid()) {
+            std::cerr << "Failed to create the shader program cache in " << cacheDir.string() << std::endl;
+            return (-1.0);
+        }
+
+        const GameHalloran::VSAttributeNameList nameList;
+        const F64 start = GetSeconds();
+        for(std::vector<ProgramSource>::const_iterator i = programs.begin(), end = programs.end(); i != end; ++i) {
+            GLSLShader shaderProg;
+            std::string errorMsg;
+            bool buildResult;
+            shaderProg.SetProgramCache(cachePtr);
+            if(!i->m_gsSrc.empty()) {
+                buildResult = shaderProg.Build(i->m_vsSrc.c_str(), i->m_gsSrc.c_str(), i->m_fsSrc.c_str(), nameList, errorMsg);
+            } else {
+                buildResult = shaderProg.Build(i->m_vsSrc.c_str(), i->m_fsSrc.c_str(), nameList, errorMsg);
+            }
+            if(!buildResult || !shaderProg.Activate()) {
+                std::cerr << "Failed to build " << i->m_name << ": " << errorMsg << std::endl;
+                return (-1.0);
+            }
+        }
+        // Drivers may link in the background, so wait until the programs are ready.
+        glFinish();
+        const F64 seconds = GetSeconds() - start;
+
+        statsRef = cachePtr->GetStats();
+        return (seconds);
+    }
+
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+int main(int args, char *argv[])
+{
+    const boost::filesystem::path directory((args > 1) ? std::string(argv[1]) : std::string(DEFAULT_SHADER_DIRECTORY));
+    const U32 numberRuns = (args > 2) ? U32(atoi(argv[2])) : DEFAULT_NUMBER_RUNS;
+    if(numberRuns == 0) {
+        std::cerr << "The number of runs must be greater than 0" << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    std::vector<ProgramSource> programs;
+    if(boost::filesystem::is_directory(directory)) {
+        boost::filesystem::directory_iterator end;
+        for(boost::filesystem::directory_iterator i(directory); i != end; ++i) {
+            if(i->path().extension() != ".vp") {
+                continue;
+            }
+            boost::filesystem::path stem(i->path());
+            ProgramSource program;
+            program.m_name = i->path().stem().string();
+            if(!ReadFile(i->path(), program.m_vsSrc) || !ReadFile(stem.replace_extension(".fp"), program.m_fsSrc)) {
+                std::cerr << "Skipping " << program.m_name << " which has no fragment shader" << std::endl;
+                continue;
+            }
+            ReadFile(stem.replace_extension(".gp"), program.m_gsSrc);
+            programs.push_back(program);
+        }
+    }
+    if(programs.empty()) {
+        std::cerr << "No programs to benchmark in " << directory.string() << std::endl;
+        return (EXIT_FAILURE);
+    }
+
+    if(!InitOpenGL()) {
+        return (EXIT_FAILURE);
+    }
+    if(!ShaderProgramCache::IsSupported()) {
+        std::cerr << "The OpenGL driver cannot save program binaries" << std::endl;
+        glfwTerminate();
+        return (EXIT_FAILURE);
+    }
+
+    const std::string driverStr(ShaderProgramCache::GetDriverString());
+    const boost::filesystem::path cacheDir(boost::filesystem::temp_directory_path() / "ShaderCacheBenchmark");
+    std::cout << "Building " << programs.size() << " programs from " << directory.string() << ", average of " << numberRuns
+              << " runs" << std::endl << "     " << driverStr << std::endl;
+
+    bool result = true;
+    F64 emptySeconds = 0.0, filledSeconds = 0.0;
+    ShaderProgramCacheStats emptyStats, filledStats;
+    for(U32 run = 0; result && run < numberRuns; ++run) {
+        boost::filesystem::remove_all(cacheDir);
+        const F64 empty = BuildPrograms(programs, cacheDir, driverStr, emptyStats);
+        const F64 filled = (empty >= 0.0) ? BuildPrograms(programs, cacheDir, driverStr, filledStats) : -1.0;
+        if(empty < 0.0 || filled < 0.0) {
+            result = false;
+        } else if(filledStats.m_hits != programs.size()) {
+            // A driver which refuses its own binaries gains nothing from the cache.
+            std::cerr << "Only " << filledStats.m_hits << " programs were loaded from the filled cache, "
+                      << filledStats.m_rejected << " binaries were refused" << std::endl;
+            result = false;
+        }
+        emptySeconds += empty;
+        filledSeconds += filled;
+    }
+    boost::filesystem::remove_all(cacheDir);
+
+    if(result) {
+        emptySeconds /= F64(numberRuns);
+        filledSeconds /= F64(numberRuns);
+        std::cout << std::fixed << std::setprecision(3)
+                  << "     empty cache   " << std::setw(10) << (emptySeconds * 1000.0) << "ms" << std::endl
+                  << "     filled cache  " << std::setw(10) << (filledSeconds * 1000.0) << "ms"
+                  << "  saving " << ((emptySeconds - filledSeconds) * 1000.0) << "ms"
+                  << std::setprecision(2) << "  speedup " << (emptySeconds / filledSeconds) << "x" << std::endl;
+    }
+
+    glfwTerminate();
+    return (result ? EXIT_SUCCESS : EXIT_FAILURE);
+}
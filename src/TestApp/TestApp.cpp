@@ -53,7 +53,7 @@ namespace GameHalloran {
             glCullFace(GL_BACK);
             glFrontFace(GL_CCW);
 
-            m_texManagerPtr.reset(GCC_NEW TextureManager(10, 1024 * 1024 * 20));
+            m_texManagerPtr.reset(GCC_NEW TextureManager(10, 1024 * 1024 * 80));
             m_texManagerPtr->SetTextureFilterMode(TextureManager::eAnisotropic);
             m_texManagerPtr->SetAnisotropicLinearLevel(1.0f);
 
@@ -40,6 +40,29 @@
 //#version 330
 #version 150
 
+// Declare the frame and material data in std140 uniform blocks (1) or as
+// loose uniforms (0).  The application defines it as 0 when the blocks are
+// disabled or the GL context has no uniform buffers.
+#ifndef GF_ADS_UNIFORM_BLOCKS
+#define GF_ADS_UNIFORM_BLOCKS 1
+#endif
+
+// Compile the dynamic lights in (1) or leave them out (0).  The application
+// defines it as 0 while no light in the scene is on.
+#ifndef GF_ADS_LIGHTS
+#define GF_ADS_LIGHTS 1
+#endif
+
+// Type of fog compiled in, one of the FOG_ constants.  The application
+// defines it from the type of the SceneGraphManager's fog effect.
+#define FOG_OFF 0
+#define FOG_LINEAR 1
+#define FOG_EXPONENTIAL 2
+#define FOG_EXPONENTIAL_BY_TWO 3
+#ifndef GF_ADS_FOG
+#define GF_ADS_FOG FOG_OFF
+#endif
+
 // /////////////////////////////////////////////////////////////////
 // Program constants.
 const int MAX_NUMBER_LIGHTS = 8;							// Maximum number of lights allowed in the scene.
@@ -72,8 +95,37 @@ uniform bool u_applyTexture;								// Is there a texture being applied?
 // /////////////////////////////////////////////////////////////////
 
 // /////////////////////////////////////////////////////////////////
-// 2) Light(s) information.
+// 2) Per frame information (std140 uniform block shared with the vertex shader or loose uniforms).
+#if GF_ADS_UNIFORM_BLOCKS
+layout(std140) uniform AdsFrame
+{
+	vec4 u_globalAmbient;									// Global ambient illumination in the scene.
+	vec4 u_cameraPos;										// Camera position.
+	int u_numberLights;										// Number of lights in the scene (should be <= MAX_NUMBER_LIGHTS constant!).
+	float u_fogMin;											// Distance the linear fog starts at.
+	float u_fogMax;											// Distance the linear fog saturates at.
+	float u_fogDensity;										// Density of the exponential fogs.
+	vec3 u_fogColor;										// Color of the fog.
+	int u_lightTypesArr[MAX_NUMBER_LIGHTS];					// Array of light types.
+	vec3 u_lightPositionArr[MAX_NUMBER_LIGHTS];				// Array of light positions in the scene (Must be in camera space, else the results will be wrong).
+	vec4 u_lightAmbientArr[MAX_NUMBER_LIGHTS];				// Array of light ambient properties.
+	vec4 u_lightDiffuseArr[MAX_NUMBER_LIGHTS];				// Array of light diffuse properties.
+	vec4 u_lightSpecularArr[MAX_NUMBER_LIGHTS];				// Array of light specular properties.
+	float u_spotlightCutoffArr[MAX_NUMBER_LIGHTS];			// Spotlight cutoff factor for each light (== 180.0 if the light is not a spotlight).
+	float u_spotlightExpArr[MAX_NUMBER_LIGHTS];				// Spotlight exponent factor for each light (N/A if light is not a spotlight).
+	vec3 u_spotlightDirection[MAX_NUMBER_LIGHTS];			// Spotlight direction (N/A if light is not a spotlight).
+	float u_cAttArr[MAX_NUMBER_LIGHTS];						// Constant Attenuation value array.
+	float u_lAttArr[MAX_NUMBER_LIGHTS];						// Linear Attenuation value array.
+	float u_qAttArr[MAX_NUMBER_LIGHTS];						// Quadratic Attenuation value array.
+};
+#else
+uniform vec4 u_globalAmbient;								// Global ambient illumination in the scene.
+uniform vec4 u_cameraPos;									// Camera position.
 uniform int u_numberLights;									// Number of lights in the scene (should be <= MAX_NUMBER_LIGHTS constant!).
+uniform float u_fogMin;										// Distance the linear fog starts at.
+uniform float u_fogMax;										// Distance the linear fog saturates at.
+uniform float u_fogDensity;									// Density of the exponential fogs.
+uniform vec3 u_fogColor;									// Color of the fog.
 uniform int u_lightTypesArr[MAX_NUMBER_LIGHTS];				// Array of light types.
 uniform vec3 u_lightPositionArr[MAX_NUMBER_LIGHTS];			// Array of light positions in the scene (Must be in camera space, else the results will be wrong).
 uniform vec4 u_lightAmbientArr[MAX_NUMBER_LIGHTS];			// Array of light ambient properties.
@@ -85,29 +137,34 @@ uniform vec3 u_spotlightDirection[MAX_NUMBER_LIGHTS];		// Spotlight direction (N
 uniform float u_cAttArr[MAX_NUMBER_LIGHTS];					// Constant Attenuation value array.
 uniform float u_lAttArr[MAX_NUMBER_LIGHTS];					// Linear Attenuation value array.
 uniform float u_qAttArr[MAX_NUMBER_LIGHTS];					// Quadratic Attenuation value array.
+#endif
 // /////////////////////////////////////////////////////////////////
 
 // /////////////////////////////////////////////////////////////////
-// 3) Material information
+// 3) Material information (std140 uniform block or loose uniforms).
+#if GF_ADS_UNIFORM_BLOCKS
+layout(std140) uniform AdsMaterial
+{
+	vec4 u_materialE;										// Materials emmissive value.
+	vec4 u_materialA;										// Materials ambient value.
+	vec4 u_materialD;										// Materials diffuse value.
+	vec4 u_materialS;										// Materials specular value.
+	float u_materialExp;									// Materials exponent/shininess.
+};
+#else
 uniform vec4 u_materialE;									// Materials emmissive value.
 uniform vec4 u_materialA;									// Materials ambient value.
 uniform vec4 u_materialD;									// Materials diffuse value.
 uniform vec4 u_materialS;									// Materials specular value.
 uniform float u_materialExp;								// Materials exponent/shininess.
+#endif
 // /////////////////////////////////////////////////////////////////
 
 // /////////////////////////////////////////////////////////////////
-// 4) Global illumination
-uniform vec4 u_globalAmbient;								// Global ambient illumination in the scene.
-// /////////////////////////////////////////////////////////////////
-
-// /////////////////////////////////////////////////////////////////
-// 5) Texture map access.
+// 4) Texture map access.
 uniform sampler2D u_texture2dMap;							// The texture map sampler.
 // /////////////////////////////////////////////////////////////////
 
-uniform vec4 u_cameraPos;
-
 //struct Fog
 //{
 //    bool on;
@@ -117,17 +174,6 @@ uniform vec4 u_cameraPos;
 //};
 //uniform Fog u_fog;
 
-uniform int u_fogType;
-uniform float u_fogMin;
-uniform float u_fogMax;
-uniform float u_fogDensity;
-uniform vec3 u_fogColor;
-
-const int FOG_OFF = 0;
-const int FOG_LINEAR = 1;
-const int FOG_EXPONENTIAL = 2;
-const int FOG_EXPONENTIAL_BY_TWO = 3;
-
 // /////////////////////////////////////////////////////////////////
 
 
@@ -353,22 +399,27 @@ vec3 GetSpecularTermGlRed(vec4 lightSpecularColor, vec3 dirToLight, vec3 cameraP
 // /////////////////////////////////////////////////////////////////
 void main(void) 
 {
+#if GF_ADS_LIGHTS
 	// Calculate the number of lights defined (ensure we only process the first MAX_NUMBER_LIGHTS in the arrays).
     int numberLights = u_numberLights;
     if(numberLights > MAX_NUMBER_LIGHTS)
     {
 		numberLights = MAX_NUMBER_LIGHTS;
     }
+#endif
 
 	vec4 primaryColor;							// Color of fragment (Material emission, Global Ambient Light + Diffuse 
 												//  and Ambient components of each light in the scene as well as the texture color.)
 	vec3 secondaryColor = vec3(0.0);						// Specular highlight from each light in the scene.
+#if GF_ADS_LIGHTS
 	float attTermArr[MAX_NUMBER_LIGHTS];		// Attenuation factor array (calculated once during primary loop and used again in secondary loop).
 	float spotTermArr[MAX_NUMBER_LIGHTS];		// Spotlight factor array (calculated once during primary loop and used again in secondary loop).
+#endif
 
 	// Apply first two light independant terms.
     primaryColor = vec4(u_materialE.xyz + GetScaledGlobalAmbientLight(), 1.0);
 
+#if GF_ADS_LIGHTS
     // For each light in the scene, Apply the ambient and diffuse terms scaled by the attenuation and spotlight factors.
     for(int i = 0; i < numberLights; ++i)
     {
@@ -379,6 +430,7 @@ void main(void)
 		
 		primaryColor.xyz += (attTermArr[i] * spotTermArr[i]) * vec3(ambientTerm + diffuseTerm);
 	}
+#endif
 
 	// If we are applying a texture.
 	if(u_applyTexture)
@@ -387,6 +439,7 @@ void main(void)
 	}
 
 
+#if GF_ADS_LIGHTS
 	// For each light in the scene, Apply the specular terms scaled by the attenuation and spotlight factors.
     for(int j = 0; j < numberLights; ++j)
     {
@@ -394,33 +447,27 @@ void main(void)
         //vec3 specularTerm = GetSpecularTermGlRed(u_lightSpecularArr[j], normalize(vp_varyingLightDirArr[j]), vec3(u_cameraPos.xyz), vp_flatVertexPosition);
 		secondaryColor += (attTermArr[j] * spotTermArr[j]) * specularTerm;
 	}
+#endif
 
 	// Final fragment color is the primary color (which is combined with the tex color) + the secondary color.
 	vec3 adsColor = primaryColor.xyz + secondaryColor.xyz;
 
     
-    if(u_fogType != FOG_OFF)
-    {
-        float dist = abs(vp_varyingVertexPosition.z);
-        //float dist = length(vp_varyingVertexPosition.xyz);
-        
-        float fogFactor = 0.0f;
-        if(u_fogType == FOG_LINEAR)
-        {
-            fogFactor = (u_fogMax - dist) / (u_fogMax - u_fogMin);
-        }
-        else if(u_fogType == FOG_EXPONENTIAL)
-        {
-            fogFactor = exp(-u_fogDensity * dist);
-        }
-        else if(u_fogType == FOG_EXPONENTIAL_BY_TWO)
-        {
-            fogFactor = exp(-pow(u_fogDensity * dist, 2));
-        }
-        
-        fogFactor = clamp(fogFactor, 0.0, 1.0);
-        adsColor = mix(u_fogColor, adsColor, fogFactor);
-    }
+#if GF_ADS_FOG != FOG_OFF
+    float dist = abs(vp_varyingVertexPosition.z);
+    //float dist = length(vp_varyingVertexPosition.xyz);
+
+#if GF_ADS_FOG == FOG_LINEAR
+    float fogFactor = (u_fogMax - dist) / (u_fogMax - u_fogMin);
+#elif GF_ADS_FOG == FOG_EXPONENTIAL
+    float fogFactor = exp(-u_fogDensity * dist);
+#else
+    float fogFactor = exp(-pow(u_fogDensity * dist, 2));
+#endif
+
+    fogFactor = clamp(fogFactor, 0.0, 1.0);
+    adsColor = mix(u_fogColor, adsColor, fogFactor);
+#endif
     
     fp_colorVec = vec4(adsColor, u_materialD.a);
         
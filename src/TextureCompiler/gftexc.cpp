@@ -0,0 +1,201 @@
+// /////////////////////////////////////////////////////////////////
+// @file gftexc.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Small offline application for block compressing a TGA, BMP, PNG or
+// JPEG image into a BCT file (BC1, BC3 or BC5 blocks with a
+// precomputed mipmap chain) which the TextureManager uploads to the
+// GPU without decoding.  The mipmaps are downsampled with a box or
+// Kaiser filter, optionally in linear space for sRGB images.  Reports the size saved and the PSNR of the
+// decompressed top level against the source image.
+//
+// /////////////////////////////////////////////////////////////////
+
+// External Headers
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <algorithm>
+
+#include <boost/filesystem.hpp>
+#include <boost/shared_ptr.hpp>
+
+// Project Headers
+#include "ResCache2.h"
+#include "ImageResource.h"
+#include "TextureCompression.h"
+#include "ImageProcessing.h"
+
+using GameHalloran::U8;
+using GameHalloran::U32;
+using GameHalloran::I32;
+using GameHalloran::BlockFormat;
+using GameHalloran::ResampleFilter;
+
+namespace {
+
+    // /////////////////////////////////////////////////////////////////
+    // @class ImageFile
+    //
+    // Resource file serving the single image file being compressed.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class ImageFile : public GameHalloran::IResourceFile {
+    private:
+        boost::filesystem::path m_path;         ///< Path of the image file.
+    public:
+        explicit ImageFile(const boost::filesystem::path &path) : m_path(path) {};
+        virtual bool VOpen() {
+            return (boost::filesystem::is_regular_file(m_path));
+        };
+        virtual boost::optional<I32> VGetResourceSize(const GameHalloran::Resource &) {
+            return (boost::optional<I32>(I32(boost::filesystem::file_size(m_path))));
+        };
+        virtual bool VGetResource(const GameHalloran::Resource &, char *buffer) {
+            std::ifstream in(m_path.string().c_str(), std::ios::in | std::ios::binary);
+            in.read(buffer, std::streamsize(boost::filesystem::file_size(m_path)));
+            return (!in.fail());
+        };
+        virtual bool VGetResourceListing(const std::string &, GameHalloran::ResourceListing &) {
+            return (false);
+        };
+    };
+
+}
+
+// /////////////////////////////////////////////////////////////////
+// Print out usage information.
+//
+// @param programNameStr The name of the executable.
+//
+// /////////////////////////////////////////////////////////////////
+void PrintUsage(const char *programNameStr)
+{
+    if(!programNameStr) {
+        std::cerr << "Error: Program name not supplied to PrintUsage()." << std::endl;
+        return;
+    }
+
+    std::cout << programNameStr << " [-h] [--help] [-f bc1|bc3|bc5] [-m box|kaiser] [-g] [-n] ImageFile BctFile" << std::endl;
+    std::cout << "\t-f = The block format (default: bc3 for images with alpha, else bc1)." << std::endl;
+    std::cout << "\t-m = The mipmap filter (default: box)." << std::endl;
+    std::cout << "\t-g = The image is sRGB, filter the mipmaps in linear space." << std::endl;
+    std::cout << "\t-n = Do not store mipmaps, only the top level." << std::endl;
+    std::cout << "\tImageFile = The path of the TGA, BMP, PNG or JPEG image." << std::endl;
+    std::cout << "\tBctFile = The path of the block compressed image to write." << std::endl;
+}
+
+// /////////////////////////////////////////////////////////////////
+// Main entry point.
+//
+//
+// /////////////////////////////////////////////////////////////////
+int main(int argc, char *argv[])
+{
+    BlockFormat format = GameHalloran::BLOCK_FORMAT_UNKNOWN;    // Requested block format.
+    ResampleFilter filter = GameHalloran::RESAMPLE_FILTER_BOX;  // Mipmap filter.
+    bool gammaCorrect = false;                                  // Filter the mipmaps in linear space?
+    bool generateMipMaps = true;                                // Store the mipmap chain?
+    std::vector<const char *> fileStrVec;                       // Input and output paths.
+
+    for(int i = 1; i < argc; ++i) {
+        if(strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+            PrintUsage(argv[0]);
+            return (0);
+        } else if(strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            format = GameHalloran::FindBlockFormatFromString(argv[++i]);
+            if(format == GameHalloran::BLOCK_FORMAT_UNKNOWN) {
+                std::cerr << "Unknown block format " << argv[i] << ".\n" << std::endl;
+                PrintUsage(argv[0]);
+                return (-1);
+            }
+        } else if(strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+            filter = GameHalloran::FindResampleFilterFromString(argv[++i]);
+            if(filter == GameHalloran::RESAMPLE_FILTER_UNKNOWN) {
+                std::cerr << "Unknown mipmap filter " << argv[i] << ".\n" << std::endl;
+                PrintUsage(argv[0]);
+                return (-1);
+            }
+        } else if(strcmp(argv[i], "-g") == 0) {
+            gammaCorrect = true;
+        } else if(strcmp(argv[i], "-n") == 0) {
+            generateMipMaps = false;
+        } else {
+            fileStrVec.push_back(argv[i]);
+        }
+    }
+
+    if(fileStrVec.size() != 2) {
+        std::cerr << "Incorrect arguments supplied.\n" << std::endl;
+        PrintUsage(argv[0]);
+        return (-1);
+    }
+
+    const boost::filesystem::path imagePath(fileStrVec[0]);
+    const std::string imageName(imagePath.filename().string());
+    if(!boost::filesystem::is_regular_file(imagePath)) {
+        std::cerr << "Error: Cannot find the image " << imagePath.string() << std::endl;
+        return (-1);
+    }
+    const GameHalloran::ImageType imageType = GameHalloran::FindImageTypeFromFile(imageName);
+    if(imageType == GameHalloran::IMAGE_TYPE_UNKNOWN || imageType == GameHalloran::IMAGE_TYPE_BCT) {
+        std::cerr << "Error: The image must be a TGA, BMP, PNG or JPEG file." << std::endl;
+        return (-1);
+    }
+
+    // Cache large enough to hold the image file.
+    const U32 cacheSizeMb = U32(boost::filesystem::file_size(imagePath) / (1024 * 1024)) + 1;
+    GameHalloran::ResCache resCache(cacheSizeMb, new ImageFile(imagePath), boost::shared_ptr<GameHalloran::GameLog>());
+    if(!resCache.Init()) {
+        std::cerr << "Error: Failed to open the image " << imagePath.string() << std::endl;
+        return (-1);
+    }
+
+    GameHalloran::ImageResource imgRes(imageName);
+    boost::shared_ptr<GameHalloran::ImageResHandle> imagePtr = boost::static_pointer_cast<GameHalloran::ImageResHandle>(resCache.GetHandle(&imgRes));
+    std::vector<U8> rgbaVec;
+    if(!imagePtr || !imagePtr->VInitialize() || !GameHalloran::ConvertImageToRgba(*imagePtr, rgbaVec)) {
+        std::cerr << "Error: Failed to decode the image " << imagePath.string() << std::endl;
+        return (-1);
+    }
+
+    const U32 width = U32(imagePtr->GetImageWidth());
+    const U32 height = U32(imagePtr->GetImageHeight());
+    if(format == GameHalloran::BLOCK_FORMAT_UNKNOWN) {
+        const GLenum imageFormat = imagePtr->GetImageFormat();
+        format = (imageFormat == GL_RGBA || imageFormat == GL_BGRA) ? GameHalloran::BLOCK_FORMAT_BC3 : GameHalloran::BLOCK_FORMAT_BC1;
+    }
+
+    std::vector<U8> bctVec;
+    GameHalloran::EncodeCompressedTexture(&rgbaVec[0], width, height, format, generateMipMaps, bctVec, filter, gammaCorrect);
+
+    std::ofstream out(fileStrVec[1], std::ios::out | std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(&bctVec[0]), std::streamsize(bctVec.size()));
+    out.close();
+    if(out.fail()) {
+        std::cerr << "Error: Failed to write " << fileStrVec[1] << std::endl;
+        return (-1);
+    }
+
+    // Report the quality of the top level and the memory saved against
+    //  uploading RGBA.
+    std::vector<U8> decodedVec(width * height * 4);
+    GameHalloran::DecompressImage(&bctVec[GameHalloran::COMPRESSED_TEXTURE_HEADER_SIZE], width, height, format, &decodedVec[0]);
+    const U32 numberLevels = generateMipMaps ? GameHalloran::GetNumberMipLevels(width, height) : 1;
+    U32 rgbaSize = 0;
+    for(U32 level = 0; level < numberLevels; ++level) {
+        rgbaSize += std::max(1U, width >> level) * std::max(1U, height >> level) * 4;
+    }
+
+    std::cout << imageName << ": " << width << "x" << height << " " << GameHalloran::FindStringFromBlockFormat(format) \
+              << ", " << numberLevels << " level(s)" << std::endl;
+    std::cout << "\tSize: " << (bctVec.size() - GameHalloran::COMPRESSED_TEXTURE_HEADER_SIZE) << " bytes (RGBA " << rgbaSize << " bytes)" << std::endl;
+    std::cout << "\tPSNR: " << std::fixed << std::setprecision(2) \
+              << GameHalloran::ComputePsnr(&rgbaVec[0], &decodedVec[0], width * height, GameHalloran::GetBlockFormatChannels(format)) << " dB" << std::endl;
+
+    return (0);
+}
@@ -12,11 +12,40 @@
 // ////////////////////////////////////////////////////////////
 
 #include <cstring>
+#include <new>
+#if __cplusplus >= 201103L
+#   include <utility>
+#endif
+
+#include <boost/type_traits/has_trivial_copy.hpp>
+#include <boost/type_traits/has_trivial_destructor.hpp>
 
 #include "GameBase.h"
 
 namespace GameHalloran {
 
+    // ////////////////////////////////////////////////////////////
+    // @struct DynamicArrayTraits
+    // @author PJ O Halloran
+    //
+    // Describes how DynamicArray may move elements of a type around
+    // in memory.
+    //
+    // IS_BITWISE_MOVABLE: Elements may be relocated with memcpy/memmove
+    // instead of being copied and destroyed one at a time.  Defaults to
+    // true for types with a trivial copy constructor and destructor.
+    // Specialise it for your own types which hold no pointers to
+    // themselves to speed up reallocations.
+    //
+    // ////////////////////////////////////////////////////////////
+    template<typename ElementType>
+    struct DynamicArrayTraits {
+        enum {
+            IS_BITWISE_MOVABLE = (boost::has_trivial_copy<ElementType>::value && boost::has_trivial_destructor<ElementType>::value),
+            HAS_TRIVIAL_DESTRUCTOR = boost::has_trivial_destructor<ElementType>::value
+        };
+    };
+
     // ////////////////////////////////////////////////////////////
     // @class DynamicArray
     // @author PJ O Halloran
@@ -38,6 +67,11 @@ namespace GameHalloran {
     // - Slow insertion and removal of elements in the middle of the
     //  array.
     //
+    // Storage is allocated raw and elements are only constructed in
+    // the slots [0, size).  Reallocations relocate the elements with
+    // memcpy when DynamicArrayTraits allows it, otherwise they are
+    // moved (C++11) or copied into the new storage.
+    //
     // ////////////////////////////////////////////////////////////
     template<typename ElementType>
     class DynamicArray {
@@ -250,7 +284,9 @@ namespace GameHalloran {
 
     private:
 
-        ElementType *m_arr;                     ///< Pointer to the array of elements.
+        typedef DynamicArrayTraits<ElementType> Traits;
+
+        ElementType *m_arr;                     ///< Pointer to the array storage, only [0, m_size) is constructed.
         U64 m_size;                             ///< Number of elements in the array (not always the allocated size).
         U64 m_capacity;                         ///< Allocated size of the array.
         U32 m_id;                               ///< The ID of this instace of the DynamicArray.
@@ -261,99 +297,173 @@ namespace GameHalloran {
         static U32 DYNAMIC_ARRAY_COUNT;
 
         // ////////////////////////////////////////////////////////////
-        // Allocate an array.
+        // Allocate uninitialized storage for an array.  No element
+        // constructors are called.
         //
-        // Complexity:  O(N)
+        // Complexity:  O(1)
         //
         // TODO: Allow the programmer to define or supply their own
         // allocater here besides using new/delete.
         //
-        // @param size The size of the allocated array.
+        // @param size The number of elements to allocate room for.
         //
         // ////////////////////////////////////////////////////////////
-        ElementType *AllocateArray(const U64 size) {
+        static ElementType *AllocateArray(const U64 size) {
             if(size == 0) {
                 return (NULL);
             }
 
-            ElementType *arr = GCC_NEW ElementType[size];
-            if(arr) {
-                memset(arr, 0, size * sizeof(ElementType));
-            }
-
-            return (arr);
+            return (static_cast<ElementType *>(::operator new(size_t(size * sizeof(ElementType)))));
         };
 
         // ////////////////////////////////////////////////////////////
-        // Deallocate an array.
+        // Deallocate array storage.  All elements must already have
+        // been destroyed.
         //
         // Complexity:  O(1)
         //
         // TODO: Allow the programmer to define or supply their own
         // allocater here besides using new/delete.
         //
-        // @param arr PoI32er to the array to deallocate.
+        // @param arr Pointer to the storage to deallocate.
         //
         // ////////////////////////////////////////////////////////////
-        void DeallocateArray(ElementType *arr) {
+        static void DeallocateArray(ElementType *arr) {
             if(arr) {
-                delete [] arr;
-                arr = NULL;
+                ::operator delete(arr);
             }
         };
 
         // ////////////////////////////////////////////////////////////
-        // Constructor helper function.
+        // Call the destructor of a range of elements.
+        //
+        // Complexity:  O(N), O(1) for types with a trivial destructor.
+        //
+        // ////////////////////////////////////////////////////////////
+        static void DestroyElements(ElementType *arr, const U64 count) {
+            if(!Traits::HAS_TRIVIAL_DESTRUCTOR) {
+                for(U64 i(0); i < count; ++i) {
+                    arr[i].~ElementType();
+                }
+            }
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Move a range of elements from one block of storage into
+        // uninitialized storage.  The source elements are destroyed.
+        // The ranges must not overlap.
         //
         // Complexity:  O(N)
         //
         // ////////////////////////////////////////////////////////////
-        void Init() {
-            m_arr = AllocateArray(m_capacity);
-            m_id = DYNAMIC_ARRAY_COUNT;
-            ++DYNAMIC_ARRAY_COUNT;
+        static void RelocateElements(ElementType *src, const U64 count, ElementType *dest) {
+            if(count == 0) {
+                return;
+            }
+
+            if(Traits::IS_BITWISE_MOVABLE) {
+                memcpy(static_cast<void *>(dest), static_cast<const void *>(src), size_t(count * sizeof(ElementType)));
+                return;
+            }
+
+            for(U64 i(0); i < count; ++i) {
+#if __cplusplus >= 201103L
+                ::new(static_cast<void *>(dest + i)) ElementType(std::move(src[i]));
+#else
+                ::new(static_cast<void *>(dest + i)) ElementType(src[i]);
+#endif
+                src[i].~ElementType();
+            }
         };
 
         // ////////////////////////////////////////////////////////////
-        // Destructor helper function.
+        // Copy construct a range of elements into uninitialized storage.
         //
-        // Complexity:  O(1)
+        // Complexity:  O(N)
         //
         // ////////////////////////////////////////////////////////////
-        void Destroy() {
+        static void CopyConstructElements(const ElementType * const src, const U64 count, ElementType *dest) {
+            if(Traits::IS_BITWISE_MOVABLE) {
+                if(count > 0) {
+                    memcpy(static_cast<void *>(dest), static_cast<const void *>(src), size_t(count * sizeof(ElementType)));
+                }
+                return;
+            }
+
+            for(U64 i(0); i < count; ++i) {
+                ::new(static_cast<void *>(dest + i)) ElementType(src[i]);
+            }
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Reallocate the storage with a new capacity and relocate the
+        // existing elements into it.  The capacity must be at least
+        // the current size.
+        //
+        // Complexity:  O(N)
+        //
+        // ////////////////////////////////////////////////////////////
+        void Reallocate(const U64 capacity) {
+            ElementType *tmpArr = AllocateArray(capacity);
+            RelocateElements(m_arr, m_size, tmpArr);
             DeallocateArray(m_arr);
+            m_arr = tmpArr;
+            m_capacity = capacity;
         };
 
         // ////////////////////////////////////////////////////////////
-        // Copies contents of 1 array to another.
+        // Get the capacity the array should grow to so that it can store
+        // at least "minCapacity" elements.  Doubles the current capacity
+        // so that appending is amortised O(1).
         //
-        // Used by SetCapacity and C Array constructor.
+        // Complexity:  O(1)
         //
-        // Complexity: O(N)
+        // ////////////////////////////////////////////////////////////
+        U64 GetGrowthCapacity(const U64 minCapacity) const {
+            U64 newCapacity = (m_capacity < 4) ? 4 : m_capacity * 2;
+            return ((newCapacity < minCapacity) ? minCapacity : newCapacity);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Get a pointer to uninitialized storage at the back of the array
+        // ready for an element to be constructed into.  Grows the storage
+        // if necessary.
         //
-        // @param src The C array.
-        // @param srcSize The number of elements in the src C array.
-        // @param dest The destination C array.  The size of the dest
-        //              array should be at least "srcSize".
+        // The caller must construct the element and then increment m_size.
         //
-        // @return bool False if the C arrays are NULL or size is 0. True
-        //                  otherwise.
+        // Complexity:  O(1) average, O(N) worst case.
         //
         // ////////////////////////////////////////////////////////////
-        bool ArrayCopy(const ElementType * const src, const U64 srcSize, ElementType * const dest) {
-            if(!src || !dest || srcSize == 0) {
-                return (false);
+        void *PrepareBack() {
+            if(m_size == m_capacity) {
+                Reallocate(GetGrowthCapacity(m_size + 1));
             }
+            return (static_cast<void *>(m_arr + m_size));
+        };
 
-            // Add the C array to this array.
-            //  N.B. memcpy() is not used since we don't know the element type until
-            //   runtime.  memcpy is not safe to use with arrays of C++ objects
-            //    in general  Its only safe with POD types.
-            for(U64 i(0); i < srcSize; ++i) {
-                dest[i] = src[i];
-            }
+        // ////////////////////////////////////////////////////////////
+        // Constructor helper function.
+        //
+        // Complexity:  O(1)
+        //
+        // ////////////////////////////////////////////////////////////
+        void Init() {
+            m_arr = AllocateArray(m_capacity);
+            m_id = DYNAMIC_ARRAY_COUNT;
+            ++DYNAMIC_ARRAY_COUNT;
+        };
 
-            return (true);
+        // ////////////////////////////////////////////////////////////
+        // Destructor helper function.
+        //
+        // Complexity:  O(N), O(1) for types with a trivial destructor.
+        //
+        // ////////////////////////////////////////////////////////////
+        void Destroy() {
+            DestroyElements(m_arr, m_size);
+            m_size = 0;
+            DeallocateArray(m_arr);
+            m_arr = NULL;
         };
 
     public:
@@ -363,7 +473,7 @@ namespace GameHalloran {
         //
         // Has a default initial capacity of 10 elements!
         //
-        // Complexity:  O(N)
+        // Complexity:  O(1)
         //
         // ////////////////////////////////////////////////////////////
         explicit DynamicArray() : m_arr(NULL), m_size(0), m_capacity(10), m_id(0) {
@@ -377,7 +487,7 @@ namespace GameHalloran {
         //
         // @param capacity The initial capacity of the array.
         //
-        // Complexity:  O(N)
+        // Complexity:  O(1)
         //
         // ////////////////////////////////////////////////////////////
         explicit DynamicArray(const U64 capacity) : m_arr(NULL), m_size(0), m_capacity(capacity), m_id(0) {
@@ -395,13 +505,11 @@ namespace GameHalloran {
         // Complexity:  O(N)
         //
         // ////////////////////////////////////////////////////////////
-        explicit DynamicArray(const U64 size, const ElementType &defaultVal) : m_arr(NULL), m_size(size), m_capacity(size * 2), m_id(0) {
+        explicit DynamicArray(const U64 size, const ElementType &defaultVal) : m_arr(NULL), m_size(0), m_capacity(size * 2), m_id(0) {
             Init();
 
-            if(m_arr) {
-                for(U64 i(0); i < m_size; ++i) {
-                    m_arr[i] = defaultVal;
-                }
+            for(; m_size < size; ++m_size) {
+                ::new(static_cast<void *>(m_arr + m_size)) ElementType(defaultVal);
             }
         };
 
@@ -411,9 +519,12 @@ namespace GameHalloran {
         // Complexity:  O(N)
         //
         // ////////////////////////////////////////////////////////////
-        explicit DynamicArray(const ElementType * const arr, const U64 size) : m_arr(NULL), m_size(size), m_capacity(size * 2), m_id(0) {
+        explicit DynamicArray(const ElementType * const arr, const U64 size) : m_arr(NULL), m_size(0), m_capacity(size * 2), m_id(0) {
             Init();
-            ArrayCopy(arr, size, m_arr);
+            if(arr) {
+                CopyConstructElements(arr, size, m_arr);
+                m_size = size;
+            }
         };
 
         // ////////////////////////////////////////////////////////////
@@ -422,14 +533,10 @@ namespace GameHalloran {
         // Complexity:  O(N)
         //
         // ////////////////////////////////////////////////////////////
-        explicit DynamicArray(const DynamicArray &arrObj) : m_arr(NULL), m_size(arrObj.GetSize()), m_capacity(arrObj.GetCapacity()), m_id(0) {
-            DynamicArray &nonConstArrObj = const_cast<DynamicArray &>(arrObj);
-            Iterator begin(nonConstArrObj.Begin()), end(nonConstArrObj.End());
-
+        explicit DynamicArray(const DynamicArray &arrObj) : m_arr(NULL), m_size(0), m_capacity(arrObj.GetCapacity()), m_id(0) {
             Init();
-            if(m_capacity > 0) {
-                CopyRange(begin, end, Begin());
-            }
+            CopyConstructElements(arrObj.m_arr, arrObj.m_size, m_arr);
+            m_size = arrObj.m_size;
         };
 
         // ////////////////////////////////////////////////////////////
@@ -463,7 +570,7 @@ namespace GameHalloran {
         // ////////////////////////////////////////////////////////////
         // Assignment operator.
         //
-        // Complexity:  average O(N), worst O(N^2).
+        // Complexity:  O(N)
         //
         // ////////////////////////////////////////////////////////////
         void operator=(const DynamicArray &rhs) {
@@ -471,15 +578,14 @@ namespace GameHalloran {
                 return;
             }
 
-            // Clear the previous contents.
+            // Clear the previous contents, only reallocate if the current storage is too small.
             Clear();
+            if(rhs.m_capacity > m_capacity) {
+                Reallocate(rhs.m_capacity);
+            }
 
+            CopyConstructElements(rhs.m_arr, rhs.m_size, m_arr);
             m_size = rhs.m_size;
-            SetCapacity(rhs.m_capacity);
-            if(m_capacity > 0) {
-                DynamicArray &nonConstRhs = const_cast<DynamicArray &>(rhs);
-                CopyRange(nonConstRhs.Begin(), nonConstRhs.End(), Begin());
-            }
         };
 
         // ////////////////////////////////////////////////////////////
@@ -517,11 +623,12 @@ namespace GameHalloran {
         //
         // If the capacity is greater than the current capacity, an
         // array of the new size will be allocated and the
-        // existing data will be copied over.
+        // existing elements will be relocated into it.
         //
         // If the capacity is smaller than the prevous array, data at the
         // end of the array will be lost, however no allocations will take
-        // place and the I32ernal array will not be resized.
+        // place and the internal array will not be resized.  Use
+        // ShrinkToFit() to release the unused storage.
         //
         // Complexity:  best O(1), worst O(N)
         // - Will perform a memory allocation and an array copy in the
@@ -530,24 +637,44 @@ namespace GameHalloran {
         // ////////////////////////////////////////////////////////////
         void SetCapacity(const U64 capacity) {
             if(capacity > m_capacity) {
-                // Allocate new array, copy over data from old array and deallocate the old array.
-                m_capacity = capacity;
-
-                ElementType *tmpArr = AllocateArray(m_capacity);
-                if(m_size > 0) {
-                    ArrayCopy(m_arr, m_size, tmpArr);
-                }
-
-                DeallocateArray(m_arr);
-                m_arr = tmpArr;
+                Reallocate(capacity);
             } else if(capacity < m_capacity) {
                 // we wont allocate a smaller array in this case but we will reduce the array size.
                 if(capacity < m_size) {
+                    DestroyElements(m_arr + capacity, m_size - capacity);
                     m_size = capacity;
                 }
             }
         };
 
+        // ////////////////////////////////////////////////////////////
+        // Ensure the array has room for at least "capacity" elements
+        // without reallocating.  Never reduces the capacity or size.
+        //
+        // Complexity:  best O(1), worst O(N)
+        //
+        // @param capacity The minimum capacity required.
+        //
+        // ////////////////////////////////////////////////////////////
+        void Reserve(const U64 capacity) {
+            if(capacity > m_capacity) {
+                Reallocate(capacity);
+            }
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Reduce the capacity of the array to its size, releasing any
+        // unused storage.
+        //
+        // Complexity:  best O(1), worst O(N)
+        //
+        // ////////////////////////////////////////////////////////////
+        void ShrinkToFit() {
+            if(m_capacity > m_size) {
+                Reallocate(m_size);
+            }
+        };
+
         // ////////////////////////////////////////////////////////////
         // Get the current size of the array.
         //
@@ -563,6 +690,9 @@ namespace GameHalloran {
         // than the current capacity, then an array copy and reallocation
         // will take place.
         //
+        // New elements are value initialized (0 for POD types) and
+        // removed elements are destroyed.
+        //
         // Complexity: O(1) Best, O(N) worst
         //
         // @param size The new size of the array.
@@ -570,9 +700,17 @@ namespace GameHalloran {
         // ////////////////////////////////////////////////////////////
         void SetSize(const U64 size) {
             if(size > m_capacity) {
-                SetCapacity(size * 2);
+                Reallocate(size * 2);
+            }
+
+            if(size < m_size) {
+                DestroyElements(m_arr + size, m_size - size);
+                m_size = size;
+            } else {
+                for(; m_size < size; ++m_size) {
+                    ::new(static_cast<void *>(m_arr + m_size)) ElementType();
+                }
             }
-            m_size = size;
         };
 
         // ////////////////////////////////////////////////////////////
@@ -590,19 +728,82 @@ namespace GameHalloran {
         //
         // Complexity: O(1) average, O(N) worst case.
         // - Will perform a memory allocation and an array copy in the
-        // worst case.  Prevent this with proper usage of SetCapacity()!
+        // worst case.  Prevent this with proper usage of Reserve()!
         //
-        // @param val The new value to append.
+        // @param val The new value to append.  May be an element of
+        //              this array.
         //
         // @return n/a
         //
         // ////////////////////////////////////////////////////////////
         void PushBack(const ElementType &val) {
-            ++m_size;
-            if(m_size >= m_capacity) {
-                SetCapacity(m_capacity * 2);
+            if(m_size == m_capacity) {
+                // Construct the new element before the old storage (which may hold val) is released.
+                const U64 newCapacity = GetGrowthCapacity(m_size + 1);
+                ElementType *tmpArr = AllocateArray(newCapacity);
+                ::new(static_cast<void *>(tmpArr + m_size)) ElementType(val);
+                RelocateElements(m_arr, m_size, tmpArr);
+                DeallocateArray(m_arr);
+                m_arr = tmpArr;
+                m_capacity = newCapacity;
+            } else {
+                ::new(static_cast<void *>(m_arr + m_size)) ElementType(val);
             }
-            m_arr[m_size - 1] = val;
+            ++m_size;
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Construct a new element in place at the end of the array with
+        // its default constructor.
+        //
+        // Complexity: O(1) average, O(N) worst case.
+        //
+        // @return ElementType& The new element.
+        //
+        // ////////////////////////////////////////////////////////////
+        ElementType &EmplaceBack() {
+            ElementType *elemPtr = ::new(PrepareBack()) ElementType();
+            ++m_size;
+            return (*elemPtr);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Construct a new element in place at the end of the array,
+        // passing the arguments to the elements constructor.
+        //
+        // The arguments must not refer to elements of this array.
+        //
+        // Complexity: O(1) average, O(N) worst case.
+        //
+        // @return ElementType& The new element.
+        //
+        // ////////////////////////////////////////////////////////////
+        template<typename A1>
+        ElementType &EmplaceBack(const A1 &a1) {
+            ElementType *elemPtr = ::new(PrepareBack()) ElementType(a1);
+            ++m_size;
+            return (*elemPtr);
+        };
+
+        template<typename A1, typename A2>
+        ElementType &EmplaceBack(const A1 &a1, const A2 &a2) {
+            ElementType *elemPtr = ::new(PrepareBack()) ElementType(a1, a2);
+            ++m_size;
+            return (*elemPtr);
+        };
+
+        template<typename A1, typename A2, typename A3>
+        ElementType &EmplaceBack(const A1 &a1, const A2 &a2, const A3 &a3) {
+            ElementType *elemPtr = ::new(PrepareBack()) ElementType(a1, a2, a3);
+            ++m_size;
+            return (*elemPtr);
+        };
+
+        template<typename A1, typename A2, typename A3, typename A4>
+        ElementType &EmplaceBack(const A1 &a1, const A2 &a2, const A3 &a3, const A4 &a4) {
+            ElementType *elemPtr = ::new(PrepareBack()) ElementType(a1, a2, a3, a4);
+            ++m_size;
+            return (*elemPtr);
         };
 
         // ////////////////////////////////////////////////////////////
@@ -614,6 +815,7 @@ namespace GameHalloran {
         void PopBack() {
             if(m_size > 0) {
                 --m_size;
+                DestroyElements(m_arr + m_size, 1);
             }
         };
 
@@ -678,10 +880,11 @@ namespace GameHalloran {
         // ////////////////////////////////////////////////////////////
         // Clears the array.  Does not modify the capacity!
         //
-        // Complexity:  O(1)
+        // Complexity:  O(N), O(1) for types with a trivial destructor.
         //
         // ////////////////////////////////////////////////////////////
         void Clear() {
+            DestroyElements(m_arr, m_size);
             m_size = 0;
         };
 
@@ -723,26 +926,27 @@ namespace GameHalloran {
                 return (false);
             }
 
-            bool result(false);
-            if(position < End()) {
-                ElementType prevVal = *position;
-                *position = val;
-                PushBack(prevVal);
-                result = true;
+            if(position.m_index < m_size) {
+                // Push the displaced element first as the push may reallocate and val may be an element of this array.
+                const ElementType newVal(val);
+                PushBack(m_arr[position.m_index]);
+                m_arr[position.m_index] = newVal;
             }
-            // Insert element at the end, no swap or memmove required.
+            // Insert element at the end, no swap required.
             else {
                 PushBack(val);
-                result = true;
             }
 
-            return (result);
+            return (true);
         };
 
         // ////////////////////////////////////////////////////////////
         // Inserts the element into the array at the requested position
         // and moves all the following elements up by 1 place.
         //
+        // The elements are shifted in place, a reallocation only takes
+        // place when the array is full.
+        //
         // Consider using Insert() instead if you don't need to preserve
         // the current order of elements.
         //
@@ -762,36 +966,48 @@ namespace GameHalloran {
                 return (false);
             }
 
-            bool result(false);
-            Iterator end(End());
-            if(position < end) {
-                // Allow room for 1 more element in the current array (resizes array capacity if nessecary).
-                SetSize(m_size + 1);
-
-                // Create a new array of the required size.
-                ElementType *arrCopy = AllocateArray(m_capacity);
-
-                U64 firstHalfSize = position.m_index - Begin().m_index + 1;
-                U64 secondHalfSize = end.m_index - position.m_index;
-
-                // Copy all elements from old array to the new from Begin() to "position"-1
-                ArrayCopy(m_arr, firstHalfSize, arrCopy);
-
-                // Copy all elements from old array to the new from "position" to End().
-                ArrayCopy(m_arr + (firstHalfSize - 1), secondHalfSize, arrCopy + (firstHalfSize));
-
-                // Insert new element at position, "position"
-                arrCopy[position.m_index] = val;
+            const U64 index = position.m_index;
+            if(index >= m_size) {
+                PushBack(val);
+                return (true);
+            }
 
+            if(m_size == m_capacity) {
+                // Full, relocate both halves straight into their final place in the new storage.
+                const U64 newCapacity = GetGrowthCapacity(m_size + 1);
+                ElementType *tmpArr = AllocateArray(newCapacity);
+                ::new(static_cast<void *>(tmpArr + index)) ElementType(val);
+                RelocateElements(m_arr, index, tmpArr);
+                RelocateElements(m_arr + index, m_size - index, tmpArr + index + 1);
                 DeallocateArray(m_arr);
-                m_arr = arrCopy;
-                result = true;
+                m_arr = tmpArr;
+                m_capacity = newCapacity;
+                ++m_size;
+            } else if(Traits::IS_BITWISE_MOVABLE) {
+                const ElementType newVal(val);
+                memmove(static_cast<void *>(m_arr + index + 1), static_cast<const void *>(m_arr + index), size_t((m_size - index) * sizeof(ElementType)));
+                ::new(static_cast<void *>(m_arr + index)) ElementType(newVal);
+                ++m_size;
             } else {
-                PushBack(val);
-                result = true;
+                // Construct the new last element from the current last one and shift the rest up by assignment.
+                const ElementType newVal(val);
+#if __cplusplus >= 201103L
+                ::new(static_cast<void *>(m_arr + m_size)) ElementType(std::move(m_arr[m_size - 1]));
+                ++m_size;
+                for(U64 i(m_size - 2); i > index; --i) {
+                    m_arr[i] = std::move(m_arr[i - 1]);
+                }
+#else
+                ::new(static_cast<void *>(m_arr + m_size)) ElementType(m_arr[m_size - 1]);
+                ++m_size;
+                for(U64 i(m_size - 2); i > index; --i) {
+                    m_arr[i] = m_arr[i - 1];
+                }
+#endif
+                m_arr[index] = newVal;
             }
 
-            return (result);
+            return (true);
         };
 
         // ////////////////////////////////////////////////////////////
@@ -808,10 +1024,8 @@ namespace GameHalloran {
         //
         // ////////////////////////////////////////////////////////////
         bool Remove(Iterator &position) {
-            if(position < End()) {
-                ElementType tmp;
+            if(position.m_index < m_size) {
                 for(U64 i(position.m_index), end(m_size - 1); i < end; ++i) {
-                    ElementType a = m_arr[i], b = m_arr[i + 1];
                     m_arr[i] = m_arr[i + 1];
                 }
             }
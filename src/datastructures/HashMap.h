@@ -0,0 +1,402 @@
+#pragma once
+#ifndef _GF_HASH_MAP_H
+#define _GF_HASH_MAP_H
+
+// ////////////////////////////////////////////////////////////
+// @file HashMap.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header for the template HashMap container class.
+//
+// ////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <new>
+
+#include "GameBase.h"
+
+// ////////////////////////////////////////////////////////////
+//
+//
+// ////////////////////////////////////////////////////////////
+namespace GameHalloran {
+
+    // ////////////////////////////////////////////////////////////
+    // Mix the bits of an integer key so consecutive keys (actor
+    // IDs, aligned pointers) spread over the whole table.
+    //
+    // ////////////////////////////////////////////////////////////
+    inline U64 HashMapMixBits(U64 key)
+    {
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        key *= 0xc4ceb9fe1a85ec53ULL;
+        key ^= key >> 33;
+        return (key);
+    }
+
+    // ////////////////////////////////////////////////////////////
+    // @struct HashMapHash
+    //
+    // Default hash function for integer keys.
+    //
+    // ////////////////////////////////////////////////////////////
+    template<typename KeyType>
+    struct HashMapHash {
+        U64 operator()(const KeyType &key) const {
+            return (HashMapMixBits(static_cast<U64>(key)));
+        };
+    };
+
+    // ////////////////////////////////////////////////////////////
+    // @struct HashMapHash
+    //
+    // Default hash function for pointer keys.
+    //
+    // ////////////////////////////////////////////////////////////
+    template<typename PointeeType>
+    struct HashMapHash<PointeeType *> {
+        U64 operator()(PointeeType * const &key) const {
+            return (HashMapMixBits(static_cast<U64>(reinterpret_cast<size_t>(key))));
+        };
+    };
+
+    // ////////////////////////////////////////////////////////////
+    // @class HashMap
+    // @author PJ O Halloran
+    //
+    // An unordered map using open addressing (linear probing).  The
+    // keys and values live in a single contiguous array of slots so
+    // lookups touch one or two cache lines and inserting or erasing
+    // never allocates unless the table has to grow.  The capacity is
+    // always a power of two and the table grows when it is more than
+    // 70% full.  Erased slots are filled by shifting the following
+    // entries back so there are no tombstones.
+    //
+    // KeyType and ValueType must be default constructible and
+    // assignable.  Inserting into or erasing from the map invalidates
+    // its iterators and any pointers returned by Find().
+    //
+    // ////////////////////////////////////////////////////////////
+    template<typename KeyType, typename ValueType, typename HashType = HashMapHash<KeyType> >
+    class HashMap : private NonCopyable {
+    private:
+
+        enum { MIN_CAPACITY = 16 };             ///< Smallest capacity allocated.
+
+        // ////////////////////////////////////////////////////////////
+        // @struct Slot
+        //
+        // A key value pair in the table.
+        //
+        // ////////////////////////////////////////////////////////////
+        struct Slot {
+            KeyType m_key;                      ///< The key (only valid when used).
+            ValueType m_value;                  ///< The value (only valid when used).
+            bool m_used;                        ///< Is the slot holding a key value pair?
+
+            Slot() : m_key(), m_value(), m_used(false) {};
+        };
+
+        Slot *m_slotsPtr;                       ///< The table (NULL until the first insert).
+        U64 m_capacity;                         ///< Number of slots (0 or a power of two).
+        U64 m_size;                             ///< Number of key value pairs in the table.
+        HashType m_hash;                        ///< Hash function.
+
+        // ////////////////////////////////////////////////////////////
+        // Get the slot a key would like to be in.
+        //
+        // ////////////////////////////////////////////////////////////
+        U64 HomeSlot(const KeyType &key) const {
+            return (m_hash(key) & (m_capacity - 1));
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Find the slot holding a key.
+        //
+        // @return U64 The slot index or m_capacity if not found.
+        //
+        // ////////////////////////////////////////////////////////////
+        U64 FindSlot(const KeyType &key) const {
+            if(m_size == 0) {
+                return (m_capacity);
+            }
+
+            const U64 mask = m_capacity - 1;
+            for(U64 i = HomeSlot(key); m_slotsPtr[i].m_used; i = (i + 1) & mask) {
+                if(m_slotsPtr[i].m_key == key) {
+                    return (i);
+                }
+            }
+            return (m_capacity);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Should the table grow before another pair is inserted?
+        //
+        // ////////////////////////////////////////////////////////////
+        bool IsFull() const {
+            return ((m_size + 1) * 10 > m_capacity * 7);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Move every pair into a new table.
+        //
+        // @param newCapacity Power of two large enough to hold the
+        //                      pairs under the load limit.
+        //
+        // @return bool False if the allocation failed (the table is
+        //              left unchanged).
+        //
+        // ////////////////////////////////////////////////////////////
+        bool Rehash(const U64 newCapacity) {
+            Slot *newSlotsPtr = new(std::nothrow) Slot[size_t(newCapacity)];
+            if(!newSlotsPtr) {
+                return (false);
+            }
+
+            Slot *oldSlotsPtr = m_slotsPtr;
+            const U64 oldCapacity = m_capacity;
+            m_slotsPtr = newSlotsPtr;
+            m_capacity = newCapacity;
+
+            const U64 mask = m_capacity - 1;
+            for(U64 i = 0; i < oldCapacity; ++i) {
+                if(oldSlotsPtr[i].m_used) {
+                    U64 j = HomeSlot(oldSlotsPtr[i].m_key);
+                    while(m_slotsPtr[j].m_used) {
+                        j = (j + 1) & mask;
+                    }
+                    m_slotsPtr[j].m_key = oldSlotsPtr[i].m_key;
+                    m_slotsPtr[j].m_value = oldSlotsPtr[i].m_value;
+                    m_slotsPtr[j].m_used = true;
+                }
+            }
+
+            delete [] oldSlotsPtr;
+            return (true);
+        };
+
+    public:
+
+        // ////////////////////////////////////////////////////////////
+        // @class Iterator
+        //
+        // Visits every key value pair in the map in no particular
+        // order.
+        //
+        // ////////////////////////////////////////////////////////////
+        class Iterator {
+        private:
+
+            HashMap *m_mapPtr;                  ///< The map being iterated.
+            U64 m_index;                        ///< Current slot.
+
+            // Skip over unused slots.
+            void SkipUnused() {
+                while(m_index < m_mapPtr->m_capacity && !m_mapPtr->m_slotsPtr[m_index].m_used) {
+                    ++m_index;
+                }
+            };
+
+        public:
+
+            Iterator(HashMap *mapPtr, const U64 index) : m_mapPtr(mapPtr), m_index(index) {
+                SkipUnused();
+            };
+
+            bool operator==(const Iterator &rhs) const {
+                return (m_mapPtr == rhs.m_mapPtr && m_index == rhs.m_index);
+            };
+
+            bool operator!=(const Iterator &rhs) const {
+                return (!(*this == rhs));
+            };
+
+            Iterator &operator++() {
+                ++m_index;
+                SkipUnused();
+                return (*this);
+            };
+
+            const KeyType &GetKey() const {
+                return (m_mapPtr->m_slotsPtr[m_index].m_key);
+            };
+
+            ValueType &GetValue() const {
+                return (m_mapPtr->m_slotsPtr[m_index].m_value);
+            };
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Constructor.  No memory is allocated until the first insert.
+        //
+        // ////////////////////////////////////////////////////////////
+        explicit HashMap() : m_slotsPtr(NULL), m_capacity(0), m_size(0), m_hash() {};
+
+        // ////////////////////////////////////////////////////////////
+        // Destructor.
+        //
+        // ////////////////////////////////////////////////////////////
+        ~HashMap() {
+            delete [] m_slotsPtr;
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Get the number of key value pairs in the map.
+        //
+        // ////////////////////////////////////////////////////////////
+        U64 GetSize() const {
+            return (m_size);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Is the map empty?
+        //
+        // ////////////////////////////////////////////////////////////
+        bool IsEmpty() const {
+            return (m_size == 0);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Get the number of slots in the table.
+        //
+        // ////////////////////////////////////////////////////////////
+        U64 GetCapacity() const {
+            return (m_capacity);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Make room for count pairs without growing the table again.
+        //
+        // @return bool False if the allocation failed.
+        //
+        // ////////////////////////////////////////////////////////////
+        bool Reserve(const U64 count) {
+            U64 capacity = MIN_CAPACITY;
+            while(count * 10 > capacity * 7) {
+                capacity <<= 1;
+            }
+            return (capacity <= m_capacity || Rehash(capacity));
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Find the value for a key.
+        //
+        // @return ValueType* NULL if the key is not in the map.
+        //
+        // ////////////////////////////////////////////////////////////
+        ValueType *Find(const KeyType &key) {
+            const U64 i = FindSlot(key);
+            return ((i < m_capacity) ? &m_slotsPtr[i].m_value : NULL);
+        };
+
+        const ValueType *Find(const KeyType &key) const {
+            const U64 i = FindSlot(key);
+            return ((i < m_capacity) ? &m_slotsPtr[i].m_value : NULL);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Is a key in the map?
+        //
+        // ////////////////////////////////////////////////////////////
+        bool Contains(const KeyType &key) const {
+            return (FindSlot(key) < m_capacity);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Insert a key value pair.
+        //
+        // @return bool False if the key is already in the map (its
+        //              value is not changed) or the table could not
+        //              grow.
+        //
+        // ////////////////////////////////////////////////////////////
+        bool Insert(const KeyType &key, const ValueType &value) {
+            if(Contains(key)) {
+                return (false);
+            }
+            if(IsFull() && !Rehash((m_capacity == 0) ? U64(MIN_CAPACITY) : m_capacity * 2)) {
+                return (false);
+            }
+
+            const U64 mask = m_capacity - 1;
+            U64 i = HomeSlot(key);
+            while(m_slotsPtr[i].m_used) {
+                i = (i + 1) & mask;
+            }
+            m_slotsPtr[i].m_key = key;
+            m_slotsPtr[i].m_value = value;
+            m_slotsPtr[i].m_used = true;
+            ++m_size;
+            return (true);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Remove a key and its value from the map.
+        //
+        // @return bool False if the key was not in the map.
+        //
+        // ////////////////////////////////////////////////////////////
+        bool Erase(const KeyType &key) {
+            U64 hole = FindSlot(key);
+            if(hole >= m_capacity) {
+                return (false);
+            }
+
+            // Shift back every following pair in the probe run that may
+            //  occupy the hole (its home slot is not between the hole and it).
+            const U64 mask = m_capacity - 1;
+            for(U64 next = (hole + 1) & mask; m_slotsPtr[next].m_used; next = (next + 1) & mask) {
+                const U64 home = HomeSlot(m_slotsPtr[next].m_key);
+                if(((next - home) & mask) >= ((next - hole) & mask)) {
+                    m_slotsPtr[hole].m_key = m_slotsPtr[next].m_key;
+                    m_slotsPtr[hole].m_value = m_slotsPtr[next].m_value;
+                    hole = next;
+                }
+            }
+
+            m_slotsPtr[hole].m_key = KeyType();
+            m_slotsPtr[hole].m_value = ValueType();
+            m_slotsPtr[hole].m_used = false;
+            --m_size;
+            return (true);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Remove every pair.  The table is kept for reuse.
+        //
+        // ////////////////////////////////////////////////////////////
+        void Clear() {
+            for(U64 i = 0; i < m_capacity; ++i) {
+                if(m_slotsPtr[i].m_used) {
+                    m_slotsPtr[i].m_key = KeyType();
+                    m_slotsPtr[i].m_value = ValueType();
+                    m_slotsPtr[i].m_used = false;
+                }
+            }
+            m_size = 0;
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Get an iterator to the first pair.
+        //
+        // ////////////////////////////////////////////////////////////
+        Iterator Begin() {
+            return (Iterator(this, 0));
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Get the iterator one past the last pair.
+        //
+        // ////////////////////////////////////////////////////////////
+        Iterator End() {
+            return (Iterator(this, m_capacity));
+        };
+    };
+
+}
+
+#endif
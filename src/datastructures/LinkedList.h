@@ -11,7 +11,10 @@
 //
 // ////////////////////////////////////////////////////////////
 
+#include <new>
+
 #include "GameBase.h"
+#include "PoolAllocater.h"
 
 // ////////////////////////////////////////////////////////////
 //
@@ -36,6 +39,12 @@ namespace GameHalloran {
     // - Requires a little extra memory to manage the elements
     // in the list per list element.
     //
+    // Nodes are allocated from a PoolAllocater owned by the list.
+    // Pass your own allocater to the constructor to share a pool
+    // between several lists (see GetNodeSize()).  The head and tail
+    // nodes are members of the list, so an empty list allocates
+    // nothing.
+    //
     // ////////////////////////////////////////////////////////////
     template<typename ElementType>
     class LinkedList {
@@ -59,6 +68,14 @@ namespace GameHalloran {
             //
             // ////////////////////////////////////////////////////////////
             ListNode() : m_prev(NULL), m_next(NULL), m_elem(), m_listId(0) {};
+
+            // ////////////////////////////////////////////////////////////
+            // Constructor.
+            //
+            // @param elem The element to store in the node.
+            //
+            // ////////////////////////////////////////////////////////////
+            explicit ListNode(const ElementType &elem) : m_prev(NULL), m_next(NULL), m_elem(elem), m_listId(0) {};
         };
 
     public:
@@ -320,37 +337,45 @@ namespace GameHalloran {
 
     private:
 
-        ListNode *m_headPtr;                    ///< The first node of the list (special node - no element value).
-        ListNode *m_tailPtr;                    ///< The last node of the list (special node - no element value).
+        static const U32 NODES_PER_CHUNK = 32;  ///< Number of nodes the default pool allocates at a time.
+
+        PoolAllocater m_nodePool;               ///< Default node pool, unused when an allocater is supplied.
+        IGameAllocater *m_allocaterPtr;         ///< Allocater the nodes are allocated from.
+        ListNode m_headNode;                    ///< Head node of the list (special node - no element value).
+        ListNode m_tailNode;                    ///< Tail node of the list (special node - no element value).
+        ListNode *m_headPtr;                    ///< The first node of the list, points at m_headNode.
+        ListNode *m_tailPtr;                    ///< The last node of the list, points at m_tailNode.
         U32 m_id;                                           ///< Unique id of this list instance.
 
         static U32 LINKED_LIST_COUNT;                       ///< Count of the number of instances of LinkedList objects.
 
         // ////////////////////////////////////////////////////////////
-        // Allocate memory for a node.
+        // Allocate memory for a node from the node allocater and
+        // construct it.
         //
-        // (Right now we allocate off the global OS heap, later we will
-        // define a custom allocater to use here - a pool type allocater
-        // would be ideal for a linked list).
+        // @param elem The element to copy into the node.
         //
         // ////////////////////////////////////////////////////////////
-        ListNode *AllocateNode() const {
-            ListNode *nodePtr = GCC_NEW ListNode();
-            if(nodePtr) {
-                nodePtr->m_elem = ElementType();
-                nodePtr->m_listId = m_id;
+        ListNode *AllocateNode(const ElementType &elem) {
+            void *memPtr = m_allocaterPtr->VAlloc(sizeof(ListNode));
+            if(!memPtr) {
+                return (NULL);
             }
+
+            ListNode *nodePtr = ::new(memPtr) ListNode(elem);
+            nodePtr->m_listId = m_id;
             return (nodePtr);
         };
 
         // ////////////////////////////////////////////////////////////
-        // Free the memory for a node.
+        // Destroy a node and return its memory to the node allocater.
+        // The head and tail nodes are never freed.
         //
         // ////////////////////////////////////////////////////////////
-        void DeallocateNode(ListNode *nodePtr) const {
-            if(nodePtr && nodePtr->m_listId == m_id) {
-                delete nodePtr;
-                nodePtr = NULL;
+        void DeallocateNode(ListNode *nodePtr) {
+            if(nodePtr && nodePtr->m_listId == m_id && nodePtr != m_headPtr && nodePtr != m_tailPtr) {
+                nodePtr->~ListNode();
+                m_allocaterPtr->VDealloc(nodePtr);
             }
         };
 
@@ -358,12 +383,16 @@ namespace GameHalloran {
         // Constructor helper function.
         //
         // ////////////////////////////////////////////////////////////
-        void Init() {
+        void Init(IGameAllocater *nodeAllocaterPtr) {
+            m_allocaterPtr = nodeAllocaterPtr ? nodeAllocaterPtr : &m_nodePool;
+
             m_id = LINKED_LIST_COUNT;
             ++LINKED_LIST_COUNT;
 
-            m_headPtr = AllocateNode();
-            m_tailPtr = AllocateNode();
+            m_headPtr = &m_headNode;
+            m_tailPtr = &m_tailNode;
+            m_headPtr->m_listId = m_id;
+            m_tailPtr->m_listId = m_id;
 
             m_headPtr->m_prev = NULL;
             m_headPtr->m_next = m_tailPtr;
@@ -378,9 +407,6 @@ namespace GameHalloran {
         // ////////////////////////////////////////////////////////////
         void Destroy() {
             Clear();
-
-            DeallocateNode(m_headPtr);
-            DeallocateNode(m_tailPtr);
         };
 
         // ////////////////////////////////////////////////////////////
@@ -390,7 +416,7 @@ namespace GameHalloran {
         // @param position Position to insert the new value at.
         //
         // ////////////////////////////////////////////////////////////
-        void InsertHelper(ListNode *nodePtr, Iterator &position) {
+        void InsertHelper(ListNode *nodePtr, const Iterator &position) {
             if(!nodePtr) {
                 return;
             }
@@ -411,7 +437,7 @@ namespace GameHalloran {
         //
         // ////////////////////////////////////////////////////////////
         void RemoveHelper(ListNode *nodeToRemovePtr) {
-            if(IsEmpty() || !nodeToRemovePtr || nodeToRemovePtr->m_listId != m_id) {
+            if(IsEmpty() || !nodeToRemovePtr || nodeToRemovePtr->m_listId != m_id || nodeToRemovePtr == m_headPtr || nodeToRemovePtr == m_tailPtr) {
                 return;
             }
 
@@ -428,8 +454,25 @@ namespace GameHalloran {
         // Default constructor.
         //
         // ////////////////////////////////////////////////////////////
-        explicit LinkedList() : m_headPtr(NULL), m_tailPtr(NULL) {
-            Init();
+        explicit LinkedList() : m_nodePool(sizeof(ListNode), NODES_PER_CHUNK), m_allocaterPtr(NULL), m_headNode(), m_tailNode(), \
+            m_headPtr(NULL), m_tailPtr(NULL) {
+            Init(NULL);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // Create an empty list which allocates its nodes from a
+        // supplied allocater.  The allocater must outlive the list and
+        // must be able to allocate blocks of GetNodeSize() bytes.
+        //
+        // @param nodeAllocaterPtr The node allocater or NULL to use the
+        //                          lists own pool.
+        //
+        // ////////////////////////////////////////////////////////////
+        explicit LinkedList(IGameAllocater *nodeAllocaterPtr) : m_nodePool(sizeof(ListNode), NODES_PER_CHUNK), m_allocaterPtr(NULL), m_headNode(), m_tailNode(), \
+            m_headPtr(NULL), m_tailPtr(NULL) {
+            Init(nodeAllocaterPtr);
         };
 
         // ////////////////////////////////////////////////////////////
@@ -438,11 +481,13 @@ namespace GameHalloran {
         // Complexity: O(N).
         //
         // ////////////////////////////////////////////////////////////
-        explicit LinkedList(const LinkedList &listObj) : m_headPtr(NULL), m_tailPtr(NULL) {
-            Init();
+        explicit LinkedList(const LinkedList &listObj) : m_nodePool(sizeof(ListNode), NODES_PER_CHUNK), m_allocaterPtr(NULL), m_headNode(), m_tailNode(), \
+            m_headPtr(NULL), m_tailPtr(NULL) {
+            Init(NULL);
 
             LinkedList<ElementType> &nonConstList = const_cast<LinkedList &>(listObj);
-            InsertRange(nonConstList.Begin(), nonConstList.End(), Begin());
+            Iterator begin(nonConstList.Begin()), end(nonConstList.End()), position(Begin());
+            InsertRange(begin, end, position);
         };
 
         // ////////////////////////////////////////////////////////////
@@ -452,9 +497,11 @@ namespace GameHalloran {
         /// Complexity: O(N).
         //
         // ////////////////////////////////////////////////////////////
-        explicit LinkedList(Iterator &begin, Iterator &end) : m_headPtr(NULL), m_tailPtr(NULL) {
-            Init();
-            InsertRange(begin, end, Begin());
+        explicit LinkedList(Iterator &begin, Iterator &end) : m_nodePool(sizeof(ListNode), NODES_PER_CHUNK), m_allocaterPtr(NULL), m_headNode(), m_tailNode(), \
+            m_headPtr(NULL), m_tailPtr(NULL) {
+            Init(NULL);
+            Iterator position(Begin());
+            InsertRange(begin, end, position);
         };
 
         // ////////////////////////////////////////////////////////////
@@ -476,7 +523,8 @@ namespace GameHalloran {
         void operator=(const LinkedList &rhs) {
             Clear();
             LinkedList<ElementType> &nonConstList = const_cast<LinkedList &>(rhs);
-            InsertRange(nonConstList.Begin(), nonConstList.End(), Begin());
+            Iterator begin(nonConstList.Begin()), end(nonConstList.End()), position(Begin());
+            InsertRange(begin, end, position);
         };
 
         // ////////////////////////////////////////////////////////////
@@ -518,11 +566,10 @@ namespace GameHalloran {
             }
 
             // Create the new element.
-            ListNode *nodePtr = AllocateNode();
+            ListNode *nodePtr = AllocateNode(element);
             if(!nodePtr) {
                 return (false);
             }
-            nodePtr->m_elem = element;
 
             InsertHelper(nodePtr, position);
 
@@ -619,15 +666,12 @@ namespace GameHalloran {
         //
         // ////////////////////////////////////////////////////////////
         bool PushBack(const ElementType val) {
-            ListNode *newEndPtr(AllocateNode());
+            ListNode *newEndPtr(AllocateNode(val));
             if(!newEndPtr) {
                 // Alloc error!
                 return (false);
             }
 
-            // Assign the value to the new node.
-            newEndPtr->m_elem = val;
-
             InsertHelper(newEndPtr, End());
 
             return (true);
@@ -663,15 +707,12 @@ namespace GameHalloran {
         //
         // ////////////////////////////////////////////////////////////
         bool PushFront(const ElementType val) {
-            ListNode *newNodePtr(AllocateNode());
+            ListNode *newNodePtr(AllocateNode(val));
             if(!newNodePtr) {
                 // Alloc error!
                 return (false);
             }
 
-            // Assign the value to the new node.
-            newNodePtr->m_elem = val;
-
             InsertHelper(newNodePtr, Begin());
 
             return (true);
@@ -766,6 +807,15 @@ namespace GameHalloran {
             return (m_headPtr->m_next == m_tailPtr && m_tailPtr->m_prev == m_headPtr);
         };
 
+        // ////////////////////////////////////////////////////////////
+        // Get the size of the memory blocks the list allocates for each
+        // node.  Use this to size a PoolAllocater shared between lists.
+        //
+        // ////////////////////////////////////////////////////////////
+        static U64 GetNodeSize() {
+            return (U64(sizeof(ListNode)));
+        };
+
     };
 
     template<typename ElementName>
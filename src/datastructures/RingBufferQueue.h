@@ -0,0 +1,288 @@
+#pragma once
+#ifndef _GF_RING_BUFFER_QUEUE_H
+#define _GF_RING_BUFFER_QUEUE_H
+
+// ////////////////////////////////////////////////////////////
+// @file RingBufferQueue.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header for the template RingBufferQueue container class.
+//
+// ////////////////////////////////////////////////////////////
+
+#include <new>
+#include <cstring>
+
+#include "GameBase.h"
+#include "DynamicArray.h"
+
+// ////////////////////////////////////////////////////////////
+//
+//
+// ////////////////////////////////////////////////////////////
+namespace GameHalloran {
+
+    // ////////////////////////////////////////////////////////////
+    // @class RingBufferQueue
+    // @author PJ O Halloran
+    //
+    // A Queue (FIFO first in first out) data structure with the same
+    // interface as Queue.
+    //
+    // The elements are stored contiguously in a circular buffer so
+    // pushing and popping elements never allocates once the buffer
+    // is large enough.  When the buffer is full its capacity is
+    // doubled (amortized O(1) insertion).  The capacity is always a
+    // power of two so wrapping an index is a single mask.
+    //
+    // Prefer it to Queue for hot FIFO's (events, messages, jobs)
+    // which are pushed and popped every frame.
+    //
+    // ////////////////////////////////////////////////////////////
+    template<typename ElementType>
+    class RingBufferQueue {
+    private:
+
+        typedef DynamicArrayTraits<ElementType> Traits;
+
+        enum { MIN_CAPACITY = 8 };              ///< Smallest capacity allocated.
+
+        ElementType *m_bufferPtr;               ///< Raw storage, only the queued elements are constructed.
+        U64 m_capacity;                         ///< Number of elements the storage can hold (0 or a power of two).
+        U64 m_head;                             ///< Index of the oldest element (the back of the queue).
+        U64 m_size;                             ///< Number of elements in the queue.
+
+        // ////////////////////////////////////////////////////////////
+        // Get the physical index of the i'th oldest element.
+        //
+        // ////////////////////////////////////////////////////////////
+        U64 PhysicalIndex(const U64 i) const {
+            return ((m_head + i) & (m_capacity - 1));
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Get the smallest power of two capacity which holds count
+        // elements.
+        //
+        // ////////////////////////////////////////////////////////////
+        static U64 RoundUpCapacity(const U64 count) {
+            U64 capacity = MIN_CAPACITY;
+            while(capacity < count) {
+                capacity <<= 1;
+            }
+            return (capacity);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Reallocate the storage and relocate the elements to the start
+        // of the new buffer (oldest first).
+        //
+        // @param newCapacity Power of two capacity >= Size().
+        //
+        // @return bool False if the allocation failed (the queue is
+        //              left unchanged).
+        //
+        // ////////////////////////////////////////////////////////////
+        bool Reallocate(const U64 newCapacity) {
+            ElementType *newBufferPtr = static_cast<ElementType *>(::operator new(size_t(newCapacity * sizeof(ElementType)), std::nothrow));
+            if(!newBufferPtr) {
+                return (false);
+            }
+
+            if(m_size > 0) {
+                if(Traits::IS_BITWISE_MOVABLE) {
+                    // At most two contiguous runs either side of the wrap point.
+                    const U64 firstRun = (m_head + m_size <= m_capacity) ? m_size : (m_capacity - m_head);
+                    memcpy(static_cast<void *>(newBufferPtr), static_cast<const void *>(m_bufferPtr + m_head), size_t(firstRun * sizeof(ElementType)));
+                    memcpy(static_cast<void *>(newBufferPtr + firstRun), static_cast<const void *>(m_bufferPtr), size_t((m_size - firstRun) * sizeof(ElementType)));
+                } else {
+                    for(U64 i(0); i < m_size; ++i) {
+                        ElementType &src = m_bufferPtr[PhysicalIndex(i)];
+#if __cplusplus >= 201103L
+                        ::new(static_cast<void *>(newBufferPtr + i)) ElementType(std::move(src));
+#else
+                        ::new(static_cast<void *>(newBufferPtr + i)) ElementType(src);
+#endif
+                        src.~ElementType();
+                    }
+                }
+            }
+
+            ::operator delete(static_cast<void *>(m_bufferPtr));
+            m_bufferPtr = newBufferPtr;
+            m_capacity = newCapacity;
+            m_head = 0;
+            return (true);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Copy the elements of another queue into this (empty) queue.
+        //
+        // ////////////////////////////////////////////////////////////
+        void CopyFrom(const RingBufferQueue &rhs) {
+            if(rhs.m_size == 0 || (m_capacity < rhs.m_size && !Reallocate(RoundUpCapacity(rhs.m_size)))) {
+                return;
+            }
+
+            for(U64 i(0); i < rhs.m_size; ++i) {
+                ::new(static_cast<void *>(m_bufferPtr + PhysicalIndex(i))) ElementType(rhs.m_bufferPtr[rhs.PhysicalIndex(i)]);
+                ++m_size;
+            }
+        };
+
+    public:
+
+        // ////////////////////////////////////////////////////////////
+        // Default constructor.  No memory is allocated until the first
+        // element is pushed.
+        //
+        // ////////////////////////////////////////////////////////////
+        explicit RingBufferQueue() : m_bufferPtr(NULL), m_capacity(0), m_head(0), m_size(0) { };
+
+        // ////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // @param capacity Number of elements to reserve space for.
+        //
+        // ////////////////////////////////////////////////////////////
+        explicit RingBufferQueue(const U64 capacity) : m_bufferPtr(NULL), m_capacity(0), m_head(0), m_size(0) {
+            Reserve(capacity);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Copy constructor.
+        //
+        // ////////////////////////////////////////////////////////////
+        explicit RingBufferQueue(const RingBufferQueue &queueObj) : m_bufferPtr(NULL), m_capacity(0), m_head(0), m_size(0) {
+            CopyFrom(queueObj);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Destructor.
+        //
+        // ////////////////////////////////////////////////////////////
+        ~RingBufferQueue() {
+            Clear();
+            ::operator delete(static_cast<void *>(m_bufferPtr));
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Assign the contents of a RingBufferQueue to this queue.
+        //
+        // ////////////////////////////////////////////////////////////
+        void operator=(const RingBufferQueue &rhs) {
+            if(this == &rhs) {
+                return;
+            }
+
+            Clear();
+            CopyFrom(rhs);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Clear the queue.  The storage is kept for reuse.
+        //
+        // ////////////////////////////////////////////////////////////
+        void Clear() {
+            if(!Traits::HAS_TRIVIAL_DESTRUCTOR) {
+                for(U64 i(0); i < m_size; ++i) {
+                    m_bufferPtr[PhysicalIndex(i)].~ElementType();
+                }
+            }
+            m_head = 0;
+            m_size = 0;
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Get the size of the queue.
+        //
+        // ////////////////////////////////////////////////////////////
+        U64 Size() const {
+            return (m_size);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Check if the queue is empty.
+        //
+        // ////////////////////////////////////////////////////////////
+        bool IsEmpty() const {
+            return (m_size == 0);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Get the number of elements the queue can hold before it has
+        // to grow.
+        //
+        // ////////////////////////////////////////////////////////////
+        U64 GetCapacity() const {
+            return (m_capacity);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Make sure the queue can hold at least capacity elements
+        // without allocating.
+        //
+        // @return bool False if the allocation failed.
+        //
+        // ////////////////////////////////////////////////////////////
+        bool Reserve(const U64 capacity) {
+            if(capacity <= m_capacity) {
+                return (true);
+            }
+            return (Reallocate(RoundUpCapacity(capacity)));
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Insert an element into the queue.
+        //
+        // @param val The element to insert.
+        //
+        // @return bool True|False on success|failure.
+        //
+        // ////////////////////////////////////////////////////////////
+        bool PushFront(const ElementType &val) {
+            if(m_size == m_capacity) {
+                // Copy first in case val refers to an element of this queue.
+                ElementType tmp(val);
+                if(!Reallocate((m_capacity == 0) ? U64(MIN_CAPACITY) : (m_capacity << 1))) {
+                    return (false);
+                }
+                ::new(static_cast<void *>(m_bufferPtr + PhysicalIndex(m_size))) ElementType(tmp);
+            } else {
+                ::new(static_cast<void *>(m_bufferPtr + PhysicalIndex(m_size))) ElementType(val);
+            }
+            ++m_size;
+            return (true);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Remove an element from the back of the queue.
+        //
+        // @param val Will hold the element removed from the queue (on
+        //              success).
+        //
+        // @return bool True|False on success|failure.
+        //
+        // ////////////////////////////////////////////////////////////
+        bool PopBack(ElementType &val) {
+            if(m_size == 0) {
+                return (false);
+            }
+
+            ElementType &oldest = m_bufferPtr[m_head];
+#if __cplusplus >= 201103L
+            val = std::move(oldest);
+#else
+            val = oldest;
+#endif
+            oldest.~ElementType();
+            m_head = PhysicalIndex(1);
+            --m_size;
+            return (true);
+        };
+
+    };
+}
+
+#endif
@@ -45,6 +45,15 @@ namespace GameHalloran {
         // ////////////////////////////////////////////////////////////
         explicit Stack() : m_list() { };
 
+        // ////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // @param nodeAllocaterPtr Allocater for the underlying list
+        //                          nodes (see LinkedList::GetNodeSize()).
+        //
+        // ////////////////////////////////////////////////////////////
+        explicit Stack(IGameAllocater *nodeAllocaterPtr) : m_list(nodeAllocaterPtr) { };
+
         // ////////////////////////////////////////////////////////////
         // Copy constructor.
         //
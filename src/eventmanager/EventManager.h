@@ -67,6 +67,7 @@
 #include "LuaStateManager.h"
 #include "HashedString.h"
 #include "GameException.h"
+#include "PoolObject.h"
 
 // Disable exception throw specification warning VS complains about.
 //  It doesn't like "throw (somexception)", it likes either "throw()"
@@ -200,10 +201,10 @@ namespace GameHalloran {
     // @author Mike McShaffry
     //
     // Base event data class.  All event data types MUST inherit from
-    // this.
+    // this.  Events are allocated from the games small object pool.
     //
     // /////////////////////////////////////////////////////////////////
-    class BaseEventData : public IEventData {
+    class BaseEventData : public IEventData, public PoolObject {
     protected:
         const F32 m_TimeStamp;          ///< The time th event occcurred.
         bool m_bHasLuaEventData;            ///< We will build that *only if necessary* (i.e., there is a script-side listener).
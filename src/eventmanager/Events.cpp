@@ -61,6 +61,7 @@ namespace GameHalloran {
     const EventType EvtData_End_Game::sk_EventType("end_game");
     const EventType EvtData_New_Actor::sk_EventType("new_actor");
     const EventType EvtData_Move_Actor::sk_EventType("move_actor");
+    const EventType EvtData_Move_Actors::sk_EventType("move_actors");
     const EventType EvtData_Destroy_Actor::sk_EventType("destroy_actor");
     const EventType EvtData_Game_State::sk_EventType("game_state");
     const EventType EvtData_Request_Start_Game::sk_EventType("game_request_start");
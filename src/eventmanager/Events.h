@@ -60,6 +60,7 @@
 // /////////////////////////////////////////////////////////////////
 
 #include <sstream>
+#include <vector>
 
 #include "GameBase.h"
 #include "EventManager.h"
@@ -419,6 +420,156 @@ namespace GameHalloran {
         LuaPlus::LuaObject m_LuaEventData;                  ///< The LUA event data.
     };
 
+    // /////////////////////////////////////////////////////////////////
+    // @class EvtData_Move_Actors
+    // @author PJ O Halloran
+    //
+    // This event is sent out once per frame by the physics system with
+    // the new position and orientation of every actor which moved
+    // (instead of an EvtData_Move_Actor per actor).
+    //
+    // /////////////////////////////////////////////////////////////////
+    class EvtData_Move_Actors : public BaseEventData {
+    public:
+        static const EventType sk_EventType;
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct ActorMovement
+        //
+        // The movement of one actor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct ActorMovement {
+            ActorId m_id;                                   ///< The ID of the actor.
+            Matrix4 m_mat;                                  ///< The movement the actor made.
+
+            ActorMovement(const ActorId id, const Matrix4 &mat) : m_id(id), m_mat(mat) { };
+        };
+
+        typedef std::vector<ActorMovement> ActorMovementVec;
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the event type.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual const EventType & VGetEventType(void) const {
+            return sk_EventType;
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // @param reserve Number of movements to make room for.
+        //
+        // /////////////////////////////////////////////////////////////////
+        explicit EvtData_Move_Actors(const U32 reserve = 0) : m_movements() {
+            m_movements.reserve(reserve);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // @param in The string stream used to create the event.
+        //
+        // /////////////////////////////////////////////////////////////////
+        explicit EvtData_Move_Actors(std::istringstream &in) : m_movements() {
+            U32 count = 0;
+            in >> count;
+            for(U32 i = 0; i < count && in.good(); ++i) {
+                ActorId id;
+                Matrix4 mat;
+                in >> id;
+                for(I32 j = 0; j < Matrix4::NUMBER_ELEMENTS; ++j) {
+                    in >> mat[j];
+                }
+                m_movements.push_back(ActorMovement(id, mat));
+            }
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the LUA event data.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual LuaPlus::LuaObject VGetLuaEventData(void) const {
+            assert((true == m_bHasLuaEventData) && "Can't get lua event data because it hasn't been built yet!  Call BulidLuaEventData() first!");
+            return m_LuaEventData;
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Build the LUA event data.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual void VBuildLuaEventData(void) {
+            assert((false == m_bHasLuaEventData) && "Already built lua event data!");
+
+            //Get the global state.
+            LuaPlus::LuaState * pState = g_appPtr->GetLuaStateManager()->GetGlobalState().Get();
+            m_LuaEventData.AssignNewTable(pState);
+
+            //An array of the actor IDs and positions, like EvtData_Move_Actor.
+            for(U32 i = 0; i < m_movements.size(); ++i) {
+                LuaPlus::LuaObject actorTable = m_LuaEventData.CreateTable(I32(i + 1));
+                actorTable.SetInteger("ActorId", m_movements[i].m_id);
+
+                Vector4 srcPos;
+                m_movements[i].m_mat.GetPosition(srcPos);
+                LuaPlus::LuaObject posTable = actorTable.CreateTable("Pos", 3);
+                posTable.SetNumber(1, srcPos.GetX());
+                posTable.SetNumber(2, srcPos.GetY());
+                posTable.SetNumber(3, srcPos.GetZ());
+            }
+
+            m_bHasLuaEventData = true;
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Serialize the event to a stream.
+        //
+        // @param out The stream to serialize the event to.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual void VSerialize(std::ostringstream &out) const {
+            out << m_movements.size() << " ";
+            for(ActorMovementVec::const_iterator i = m_movements.begin(), end = m_movements.end(); i != end; ++i) {
+                Matrix4 copy(i->m_mat);
+                out << i->m_id << " ";
+                for(I32 j = 0; j < Matrix4::NUMBER_ELEMENTS; ++j) {
+                    out << copy[j] << " ";
+                }
+            }
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Make a copy of the event.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual IEventDataPtr VCopy() const {
+            boost::shared_ptr<EvtData_Move_Actors> copyPtr(GCC_NEW EvtData_Move_Actors());
+            copyPtr->m_movements = m_movements;
+            return (copyPtr);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Add the movement of an actor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void AddMovement(const ActorId id, const Matrix4 &mat) {
+            m_movements.push_back(ActorMovement(id, mat));
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the movements of all the actors which moved.
+        //
+        // /////////////////////////////////////////////////////////////////
+        const ActorMovementVec &GetMovements() const {
+            return (m_movements);
+        };
+
+    private:
+        ActorMovementVec m_movements;                       ///< The actors which moved and their movements.
+        LuaPlus::LuaObject m_LuaEventData;                  ///< The LUA event data.
+    };
+
     // /////////////////////////////////////////////////////////////////
     // @class EvtData_New_Game
     // @author Mike McShaffry
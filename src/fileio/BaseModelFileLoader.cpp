@@ -149,6 +149,23 @@ namespace GameHalloran {
     //
     // /////////////////////////////////////////////////////////////////
     boost::shared_ptr<GLTriangleBatch> ConvertTriangleListToBatch(const TriangleList &tList, IModelLoadProgressCallback *progressCallbackPtr, const bool retainData)
+    {
+        boost::shared_ptr<GLTriangleBatch> tBatch = BuildTriangleListBatch(tList, progressCallbackPtr);
+        if(!tBatch) {
+            return (tBatch);
+        }
+
+        //tBatch->PrintDebugInfo();
+
+        tBatch->End(!retainData);
+
+        return (tBatch);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    boost::shared_ptr<GLTriangleBatch> BuildTriangleListBatch(const TriangleList &tList, IModelLoadProgressCallback *progressCallbackPtr)
     {
         if(tList.empty()) {
             return (boost::shared_ptr<GLTriangleBatch>());
@@ -198,10 +215,6 @@ namespace GameHalloran {
             }
         }
 
-        //tBatch->PrintDebugInfo();
-
-        tBatch->End(!retainData);
-
         return (tBatch);
     }
 
@@ -271,6 +271,25 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     boost::shared_ptr<GLTriangleBatch> ConvertTriangleListToBatch(const TriangleList &tList, IModelLoadProgressCallback *progressCallbackPtr = NULL, const bool retainData = false);
 
+    // /////////////////////////////////////////////////////////////////
+    // Given a list of triangles, weld them into an indexed
+    // GLTriangleBatch but do not submit the batch to OpenGL.  Call
+    // GLTriangleBatch::End() on the main thread to upload it.
+    //
+    // Makes no OpenGL calls so it is safe to call from a worker thread.
+    //
+    // @param tList List of triangles.
+    // @param progressCallbackPtr Pointer to a progress callback object.
+    //                              If it is NULL then no progress is
+    //                              reported.
+    //
+    // @return boost::shared_ptr<GLTriangleBatch> Null on error or a
+    //                                              batch of triangles
+    //                                              ready for End().
+    //
+    // /////////////////////////////////////////////////////////////////
+    boost::shared_ptr<GLTriangleBatch> BuildTriangleListBatch(const TriangleList &tList, IModelLoadProgressCallback *progressCallbackPtr = NULL);
+
     // /////////////////////////////////////////////////////////////////
     // Loads a 3D mesh from a file stored in the RC file and loads the
     // mesh into a GL VBO.
@@ -0,0 +1,309 @@
+// /////////////////////////////////////////////////////////////////
+// @file ModelLoadingPipeline.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Implementation of the ModelLoadingPipeline class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <string>
+
+#include "ModelLoadingPipeline.h"
+#include "ObjModelFileLoader.h"
+#include "BaseModelFileLoader.h"
+#include "TextResource.h"
+#include "GameMain.h"
+#include "Events.h"
+
+namespace GameHalloran {
+
+    const U32 ModelLoadingPipeline::INVALID_MODEL_INDEX;
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ModelLoadingPipeline::ProcessModel(const U32 index)
+    {
+        ModelEntry &entry = m_models[index];
+
+        // Parse the OBJ text, no progress callback as it is not thread safe.
+        if(!entry.m_failed) {
+            // Errors are kept in the entry and logged by Finish() as the
+            // logger is not thread safe.
+            ObjModelFileLoader objLoader;
+            std::string errorMsg;
+            if(!objLoader.LoadFromText(entry.m_fileText, errorMsg)) {
+                entry.m_failed = true;
+                entry.m_errorMsg = std::string("Failed to parse mesh ") + entry.m_meshId + std::string(": ") + errorMsg;
+            } else if(objLoader.VGetNumberObjects() == 0 || !objLoader.VGetTriangleList(entry.m_mesh) || entry.m_mesh.empty()) {
+                entry.m_failed = true;
+                entry.m_errorMsg = std::string("No triangles were loaded from the mesh: ") + entry.m_meshId;
+            }
+            std::string().swap(entry.m_fileText);
+        }
+        StageCompleted(false);
+
+        // Measure and weld the mesh ready for the GL upload.
+        if(!entry.m_failed) {
+            CalculateTriangleListBoundingBox(entry.m_mesh, entry.m_bb);
+            entry.m_batchPtr = BuildTriangleListBatch(entry.m_mesh);
+            if(!entry.m_batchPtr) {
+                entry.m_failed = true;
+                entry.m_errorMsg = std::string("Failed to build mesh: ") + entry.m_meshId;
+            }
+        }
+        if(!entry.m_keepMesh) {
+            entry.m_mesh.clear();
+        }
+        StageCompleted(true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ModelLoadingPipeline::StageCompleted(const bool taskComplete)
+    {
+        if(!m_mutex) {
+            // Single threaded fallback.
+            ++m_stagesCompleted;
+            if(taskComplete) {
+                --m_tasksPending;
+            }
+            return;
+        }
+
+        glfwLockMutex(m_mutex);
+        ++m_stagesCompleted;
+        if(taskComplete) {
+            --m_tasksPending;
+            if(m_tasksPending == 0) {
+                glfwBroadcastCond(m_cpuDoneCond);
+            }
+        }
+        glfwUnlockMutex(m_mutex);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ModelLoadingPipeline::WaitForCpuStages()
+    {
+        if(!m_started || !m_poolPtr) {
+            // Nothing runs on the workers.
+            return;
+        }
+
+        glfwLockMutex(m_mutex);
+        while(m_tasksPending > 0) {
+            glfwWaitCond(m_cpuDoneCond, m_mutex, GLFW_INFINITY);
+        }
+        glfwUnlockMutex(m_mutex);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ModelLoadingPipeline::QueueProgressEvent()
+    {
+        IEventDataPtr eventDataPtr(GCC_NEW EvtData_Loading_Progress(m_loadId, GetProgress()));
+        safeQueEvent(eventDataPtr);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    ModelLoadingPipeline::ModelLoadingPipeline(const I32 loadId, ResCache *resCachePtr, boost::shared_ptr<WorkerThreadPool> poolPtr) : m_loadId(loadId), \
+        m_resCachePtr(resCachePtr), m_poolPtr(poolPtr), \
+        m_models(), m_mutex(NULL), m_cpuDoneCond(NULL), m_stagesCompleted(0), m_tasksPending(0), m_started(false), m_finished(false)
+    {
+        m_mutex = glfwCreateMutex();
+        m_cpuDoneCond = glfwCreateCond();
+        if(!m_mutex || !m_cpuDoneCond) {
+            // Fall back to loading everything on the calling thread.
+            GF_LOG_TRACE_ERR("ModelLoadingPipeline::ModelLoadingPipeline()", "Failed to create the thread synchronization objects");
+            m_poolPtr.reset();
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    ModelLoadingPipeline::~ModelLoadingPipeline()
+    {
+        try {
+            WaitForCpuStages();
+            if(m_cpuDoneCond) {
+                glfwDestroyCond(m_cpuDoneCond);
+            }
+            if(m_mutex) {
+                glfwDestroyMutex(m_mutex);
+            }
+        } catch(...) {}
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 ModelLoadingPipeline::AddModel(const std::string &meshId, const bool retainData, const bool keepMesh)
+    {
+        if(m_started) {
+            GF_LOG_TRACE_ERR("ModelLoadingPipeline::AddModel()", std::string("Cannot add a model after the pipeline has started: ") + meshId);
+            return (INVALID_MODEL_INDEX);
+        }
+
+        m_models.push_back(ModelEntry(meshId, retainData, keepMesh));
+        return (U32(m_models.size() - 1));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ModelLoadingPipeline::Start()
+    {
+        if(m_started) {
+            GF_LOG_TRACE_ERR("ModelLoadingPipeline::Start()", "The pipeline has already been started");
+            return (false);
+        }
+        m_started = true;
+
+        // Read all the files up front as the resource cache is not thread safe.
+        for(std::vector<ModelEntry>::iterator i = m_models.begin(), end = m_models.end(); i != end; ++i) {
+            TextResource tr(i->m_meshId);
+            boost::shared_ptr<TextResHandle> thPtr = boost::static_pointer_cast<TextResHandle>(m_resCachePtr->GetHandle(&tr));
+            if(!thPtr || !thPtr->VInitialize()) {
+                i->m_failed = true;
+                i->m_errorMsg = std::string("Failed to find and initialize the text resource from the resource cache: ") + i->m_meshId;
+            } else {
+                i->m_fileText.assign(thPtr->GetTextBuffer());
+            }
+        }
+
+        if(m_mutex) {
+            glfwLockMutex(m_mutex);
+            m_tasksPending = U32(m_models.size());
+            glfwUnlockMutex(m_mutex);
+        } else {
+            m_tasksPending = U32(m_models.size());
+        }
+
+        for(U32 i = 0; i < m_models.size(); ++i) {
+            if(!m_poolPtr || !m_poolPtr->AddTask(WorkerTaskPtr(GCC_NEW ModelLoadTask(this, i)))) {
+                ProcessModel(i);
+            }
+        }
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ModelLoadingPipeline::Finish()
+    {
+        if(!m_started && !Start()) {
+            return (false);
+        }
+        if(m_finished) {
+            GF_LOG_TRACE_ERR("ModelLoadingPipeline::Finish()", "The pipeline has already finished");
+            return (false);
+        }
+        m_finished = true;
+
+        WaitForCpuStages();
+
+        QueueProgressEvent();
+
+        bool result = true;
+        for(std::vector<ModelEntry>::iterator i = m_models.begin(), end = m_models.end(); i != end; ++i) {
+            if(i->m_failed) {
+                GF_LOG_TRACE_ERR("ModelLoadingPipeline::Finish()", i->m_errorMsg);
+                if(result) {
+                    IEventDataPtr eventDataPtr(GCC_NEW EvtData_Loading_Progress(m_loadId, -1.0f, boost::optional<std::string>(i->m_errorMsg)));
+                    safeQueEvent(eventDataPtr);
+                }
+                result = false;
+                continue;
+            }
+
+            i->m_batchPtr->End(!i->m_retainData);
+            StageCompleted(false);
+            if(result) {
+                QueueProgressEvent();
+            }
+        }
+
+        return (result);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    F32 ModelLoadingPipeline::GetProgress()
+    {
+        if(m_models.empty()) {
+            return (1.0f);
+        }
+
+        U32 stagesCompleted;
+        if(m_mutex) {
+            glfwLockMutex(m_mutex);
+            stagesCompleted = m_stagesCompleted;
+            glfwUnlockMutex(m_mutex);
+        } else {
+            stagesCompleted = m_stagesCompleted;
+        }
+
+        return (F32(stagesCompleted) / F32(m_models.size() * eNumberStages));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ModelLoadingPipeline::IsCpuWorkComplete()
+    {
+        if(!m_started) {
+            return (false);
+        }
+
+        bool complete;
+        if(m_mutex) {
+            glfwLockMutex(m_mutex);
+            complete = (m_tasksPending == 0);
+            glfwUnlockMutex(m_mutex);
+        } else {
+            complete = (m_tasksPending == 0);
+        }
+
+        return (complete);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    boost::shared_ptr<GLTriangleBatch> ModelLoadingPipeline::GetBatch(const U32 index) const
+    {
+        if(index >= m_models.size() || m_models[index].m_failed) {
+            return (boost::shared_ptr<GLTriangleBatch>());
+        }
+
+        return (m_models[index].m_batchPtr);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    const TriangleMesh &ModelLoadingPipeline::GetMesh(const U32 index) const
+    {
+        return (m_models.at(index).m_mesh);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    const BoundingCube &ModelLoadingPipeline::GetBoundingBox(const U32 index) const
+    {
+        return (m_models.at(index).m_bb);
+    }
+
+}
@@ -0,0 +1,267 @@
+#pragma once
+#ifndef __GF_MODEL_LOADING_PIPELINE_H
+#define __GF_MODEL_LOADING_PIPELINE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file ModelLoadingPipeline.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header for the ModelLoadingPipeline class which loads a group of
+// 3D models in parallel on the WorkerThreadPool.
+//
+// /////////////////////////////////////////////////////////////////
+
+#ifdef WIN32
+#   pragma warning( push )
+#   pragma warning( disable:4290 )
+#endif
+
+// External Headers
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+// Project Headers
+#include "GameBase.h"
+#include "Triangle.h"
+#include "BoundingCube.h"
+#include "GLTriangleBatch.h"
+#include "WorkerThreadPool.h"
+#include "ResCache2.h"
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    // @class ModelLoadingPipeline
+    // @author PJ O Halloran
+    //
+    // Loads a group of OBJ meshes from the resource cache, parsing,
+    // measuring and welding each model on a worker thread.
+    //
+    // The work is split so that only thread safe stages run on the
+    // workers:
+    //
+    //  Main thread:    Read the file text from the resource cache (Start()).
+    //  Worker thread:  Parse the OBJ text into a triangle mesh.
+    //  Worker thread:  Calculate the bounding box and weld the mesh into
+    //                  an indexed GLTriangleBatch.
+    //  Main thread:    Upload the batch into OpenGL and report progress
+    //                  events (Finish()).
+    //
+    // Call AddModel() for each mesh, Start() and then Finish() on the
+    // main thread.  GetProgress() may be polled between Start() and
+    // Finish() to drive a loading screen.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class ModelLoadingPipeline : public NonCopyable {
+    public:
+
+        static const U32 INVALID_MODEL_INDEX = 0xFFFFFFFF;  ///< Returned by AddModel() when the model was not added.
+
+        // /////////////////////////////////////////////////////////////////
+        // @enum LoadingStage
+        //
+        // Stages each model passes through, used to calculate progress.
+        //
+        // eMeshParsing:    Parsing a model from the OBJ text.
+        // eMeshBuilding:   Bounding box and welding the batch.
+        // eMeshUploading:  Uploading the batch into a GL VBO.
+        //
+        // /////////////////////////////////////////////////////////////////
+        enum LoadingStage {
+            eMeshParsing = 0,
+            eMeshBuilding,
+            eMeshUploading,
+            eNumberStages
+        };
+
+    private:
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct ModelEntry
+        //
+        // Input and output of a single model.  Only the worker processing
+        // the model writes to an entry until the pipeline has finished.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct ModelEntry {
+            std::string m_meshId;                           ///< RC ID of the mesh.
+            bool m_retainData;                              ///< Retain the CPU side batch data after upload?
+            bool m_keepMesh;                                ///< Keep the triangle mesh after the batch is built?
+            std::string m_fileText;                         ///< OBJ file text, released after parsing.
+            TriangleMesh m_mesh;                            ///< Parsed triangles.
+            BoundingCube m_bb;                              ///< Bounding box of the mesh.
+            boost::shared_ptr<GLTriangleBatch> m_batchPtr;  ///< Welded batch.
+            bool m_failed;                                  ///< Did loading the model fail?
+            std::string m_errorMsg;                         ///< Reason for the failure.
+
+            ModelEntry(const std::string &meshId, const bool retainData, const bool keepMesh) : m_meshId(meshId), m_retainData(retainData), \
+                m_keepMesh(keepMesh), m_fileText(), m_mesh(), m_bb(), m_batchPtr(), m_failed(false), m_errorMsg() {};
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // @class ModelLoadTask
+        //
+        // Worker task which runs the CPU stages for one model.
+        //
+        // /////////////////////////////////////////////////////////////////
+        class ModelLoadTask : public IWorkerTask {
+        private:
+            ModelLoadingPipeline *m_pipelinePtr;            ///< Owning pipeline.
+            const U32 m_index;                              ///< Index of the model to load.
+        public:
+            ModelLoadTask(ModelLoadingPipeline *pipelinePtr, const U32 index) : m_pipelinePtr(pipelinePtr), m_index(index) {};
+            virtual void VExecute() {
+                m_pipelinePtr->ProcessModel(m_index);
+            };
+        };
+
+        const I32 m_loadId;                                 ///< ID of the loading operation reported in the progress events.
+        ResCache *m_resCachePtr;                            ///< Cache the model files are read from.
+        boost::shared_ptr<WorkerThreadPool> m_poolPtr;      ///< Pool to run the CPU stages on, may be NULL.
+        std::vector<ModelEntry> m_models;                   ///< The models to load.
+        GLFWmutex m_mutex;                                  ///< Guards the counters below.
+        GLFWcond m_cpuDoneCond;                             ///< Signalled when the last model finishes its CPU stages.
+        U32 m_stagesCompleted;                              ///< Number of stages completed for all models.
+        U32 m_tasksPending;                                 ///< Number of models still being processed on the workers.
+        bool m_started;                                     ///< Has Start() been called?
+        bool m_finished;                                    ///< Has Finish() been called?
+
+        // /////////////////////////////////////////////////////////////////
+        // Run the CPU stages for a model.  Called on a worker thread.
+        //
+        // @param index The index of the model.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void ProcessModel(const U32 index);
+
+        // /////////////////////////////////////////////////////////////////
+        // Record that a stage has been completed for one model.
+        //
+        // @param taskComplete Is this the last CPU stage of the model?
+        //
+        // /////////////////////////////////////////////////////////////////
+        void StageCompleted(const bool taskComplete);
+
+        // /////////////////////////////////////////////////////////////////
+        // Queue a loading progress event with the current progress.  Main
+        // thread only.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void QueueProgressEvent();
+
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // @param loadId The ID of the loading process.
+        // @param resCachePtr The resource cache to read the models from.
+        //                      Must outlive the pipeline.
+        // @param poolPtr The worker pool to use.  If NULL then all stages
+        //                  are run on the calling thread.
+        //
+        // /////////////////////////////////////////////////////////////////
+        ModelLoadingPipeline(const I32 loadId, ResCache *resCachePtr, boost::shared_ptr<WorkerThreadPool> poolPtr);
+
+        // /////////////////////////////////////////////////////////////////
+        // Destructor.  Waits for any models still being processed.
+        //
+        // /////////////////////////////////////////////////////////////////
+        ~ModelLoadingPipeline();
+
+        // /////////////////////////////////////////////////////////////////
+        // Add a model to be loaded.  Must be called before Start().
+        //
+        // @param meshId The RC ID/name of the 3D mesh file.
+        // @param retainData Retain the CPU side batch vertex and index data?
+        // @param keepMesh Keep the parsed triangle mesh (see GetMesh())?
+        //
+        // @return U32 Index of the model used to retrieve the results, or
+        //              INVALID_MODEL_INDEX if the pipeline has already been
+        //              started.  GetBatch() returns NULL for the invalid
+        //              index.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U32 AddModel(const std::string &meshId, const bool retainData = false, const bool keepMesh = false);
+
+        // /////////////////////////////////////////////////////////////////
+        // Read all the model files from the resource cache and hand them
+        // to the worker threads.  Main thread only.
+        //
+        // @return bool False if the pipeline was already started.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool Start();
+
+        // /////////////////////////////////////////////////////////////////
+        // Wait for the workers, upload each batch into OpenGL and report
+        // the progress of the load.  Main thread only.
+        //
+        // @return bool True if every model was loaded and false if any
+        //              failed (check log file).
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool Finish();
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the progress of the load (0.0 to 1.0).
+        //
+        // /////////////////////////////////////////////////////////////////
+        F32 GetProgress();
+
+        // /////////////////////////////////////////////////////////////////
+        // Have all the models finished their worker thread stages?  When
+        // true Finish() will not block.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool IsCpuWorkComplete();
+
+        // /////////////////////////////////////////////////////////////////
+        // Block until all the models have completed their CPU stages.
+        // Finish() calls this first.  Needs no GL context, so the CPU
+        // stages can be timed on their own.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void WaitForCpuStages();
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of models added to the pipeline.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetNumberModels() const {
+            return (U32(m_models.size()));
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the batch of a model after Finish().
+        //
+        // @return boost::shared_ptr<GLTriangleBatch> NULL if the model
+        //                                              failed to load.
+        //
+        // /////////////////////////////////////////////////////////////////
+        boost::shared_ptr<GLTriangleBatch> GetBatch(const U32 index) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the triangle mesh of a model after Finish().  Empty unless
+        // the model was added with keepMesh set.
+        //
+        // /////////////////////////////////////////////////////////////////
+        const TriangleMesh &GetMesh(const U32 index) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the bounding box of a model after Finish().
+        //
+        // /////////////////////////////////////////////////////////////////
+        const BoundingCube &GetBoundingBox(const U32 index) const;
+    };
+
+}
+
+#ifdef WIN32
+#   pragma warning( pop )
+#endif
+
+#endif
@@ -86,7 +86,7 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
-    bool ObjModelFileLoader::BuildTriangleLists(std::vector<std::string> &linesVec)
+    bool ObjModelFileLoader::BuildTriangleLists(std::vector<std::string> &linesVec, std::string &errorRef)
     {
         U64 count, groups, vertices, normals, texCoords, triangles;
         GenerateFileStatistics(linesVec, count, groups, vertices, normals, texCoords, triangles, true);
@@ -137,7 +137,7 @@ namespace GameHalloran {
                 validLine = true;
             }
         } catch(GameException &ge) {
-            GF_LOG_TRACE_ERR("ObjModelFileLoader::BuildTriangleLists()", std::string("Failed to build the triangle lists: ") + std::string(ge.what()));
+            errorRef.assign(std::string("Failed to build the triangle lists: ") + std::string(ge.what()));
             return (false);
         }
 
@@ -352,8 +352,20 @@ namespace GameHalloran {
             return (false);
         }
 
-        std::string objFileData(thPtr->GetTextBuffer());
+        std::string errorMsg;
+        if(!LoadFromText(std::string(thPtr->GetTextBuffer()), errorMsg)) {
+            GF_LOG_TRACE_ERR("ObjModelFileLoader::VLoad(RC)", errorMsg + std::string(": ") + resourceFileKey);
+            return (false);
+        }
+
+        return (true);
+    }
 
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ObjModelFileLoader::LoadFromText(const std::string &objFileData, std::string &errorRef)
+    {
 #if defined(_WINDOWS)
         std::string newLine("\n");
 #else
@@ -370,7 +382,7 @@ namespace GameHalloran {
         RemoveTrailingCr fo;
         std::for_each(linesVec.begin(), linesVec.end(), fo);
 
-        if(!BuildTriangleLists(linesVec)) {
+        if(!BuildTriangleLists(linesVec, errorRef)) {
             return (false);
         }
 
@@ -412,7 +424,9 @@ namespace GameHalloran {
         // Trim excess vector capacity
         std::vector<std::string>(linesVec.begin(), linesVec.end()).swap(linesVec);
 
-        if(!BuildTriangleLists(linesVec)) {
+        std::string errorMsg;
+        if(!BuildTriangleLists(linesVec, errorMsg)) {
+            GF_LOG_TRACE_ERR("ObjModelFileLoader::VLoad(FS)", errorMsg + std::string(": ") + filePath.string());
             return (false);
         }
 
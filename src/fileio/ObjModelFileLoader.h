@@ -85,11 +85,12 @@ namespace GameHalloran {
         // Build up the triangle list for all the 3D models in the file.
         //
         // @param linesVec The obj file split into a vector by lines.
+        // @param errorRef Reason for the failure (not logged here).
         //
         // @return bool True on success or false on failure.
         //
         // /////////////////////////////////////////////////////////////////
-        bool BuildTriangleLists(std::vector<std::string> &linesVec);
+        bool BuildTriangleLists(std::vector<std::string> &linesVec, std::string &errorRef);
 
         // /////////////////////////////////////////////////////////////////
         // Parses a new line of the file and deals with it appropriately
@@ -194,6 +195,21 @@ namespace GameHalloran {
         // /////////////////////////////////////////////////////////////////
         virtual bool VLoad(const boost::filesystem::path &filePath);
 
+        // /////////////////////////////////////////////////////////////////
+        // Parse the contents of an OBJ file which has already been read
+        // into memory.
+        //
+        // Does not touch the resource cache or the logger so it may be
+        // called from a worker thread once the file data has been fetched.
+        //
+        // @param objFileData The complete text of the OBJ file.
+        // @param errorRef Reason for the failure, for the caller to log.
+        //
+        // @return bool True on success or false on failure.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool LoadFromText(const std::string &objFileData, std::string &errorRef);
+
         // /////////////////////////////////////////////////////////////////
         // Clear any and all previously loaded data.
         //
@@ -48,6 +48,8 @@
 // /////////////////////////////////////////////////////////////////
 
 #include "CProcess.h"
+#include "ProcessJobScheduler.h"
+#include "GameMain.h"
 
 // Namespace Declarations
 using boost::shared_ptr;
@@ -70,6 +72,10 @@ namespace GameHalloran {
         , m_bPaused(false)
         , m_bInitialUpdate(true)
         , m_pNext()
+        , m_managerPtr(NULL)
+        , m_slotIndex(0)
+        , m_countedType(0)
+        , m_counted(false)
     {
     }
 
@@ -94,6 +100,7 @@ namespace GameHalloran {
     void CProcess::VKill()
     {
         m_bKill = true;
+        ActiveStateChanged();
     }
 
     // /////////////////////////////////////////////////////////////////
@@ -110,6 +117,7 @@ namespace GameHalloran {
     void CProcess::SetType(const I32 type)
     {
         m_iType = type;
+        ActiveStateChanged();
     }
 
     // /////////////////////////////////////////////////////////////////
@@ -136,6 +144,26 @@ namespace GameHalloran {
         return (m_uProcessFlags & PROCESS_FLAG_ATTACHED) ? true : false;
     }
 
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool CProcess::IsThreadSafe() const
+    {
+        return (m_uProcessFlags & PROCESS_FLAG_THREAD_SAFE) ? true : false;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void CProcess::SetThreadSafe(const bool threadSafe)
+    {
+        if(threadSafe) {
+            m_uProcessFlags |= CProcess::PROCESS_FLAG_THREAD_SAFE;
+        } else {
+            m_uProcessFlags &= ~CProcess::PROCESS_FLAG_THREAD_SAFE;
+        }
+    }
+
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
@@ -186,6 +214,18 @@ namespace GameHalloran {
     void CProcess::SetNext(shared_ptr<CProcess> nextProcessPtr)
     {
         m_pNext = nextProcessPtr;
+        ActiveStateChanged();
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void CProcess::ActiveStateChanged()
+    {
+        // The manager recounts processes updated on the worker threads once they finish.
+        if(m_managerPtr && !m_managerPtr->m_parallelUpdate) {
+            m_managerPtr->UpdateActiveCount(*this);
+        }
     }
 
     // /////////////////////////////////////////////////////////////////
@@ -213,18 +253,103 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
-    void CProcessManager::Detach(shared_ptr<CProcess> pProcess)
+    bool CProcessManager::IsSlotAttached(const U32 slotIndex) const
     {
-        if(pProcess) {
-            m_processList.remove(pProcess);
-            pProcess->SetAttached(false);
+        const CProcess *processPtr = m_slots[slotIndex].m_processPtr.get();
+        return (processPtr && processPtr->m_managerPtr == this && processPtr->m_slotIndex == slotIndex);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void CProcessManager::Detach(CProcess &process)
+    {
+        process.SetAttached(false);
+        UpdateActiveCount(process);
+        process.m_managerPtr = NULL;
+        --m_numberAttached;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void CProcessManager::ReleaseSlot(const U32 slotIndex)
+    {
+        ProcessSlot &slot = m_slots[slotIndex];
+        if(++slot.m_generation == 0) {
+            slot.m_generation = 1;
         }
+        m_freeSlots.push_back(slotIndex);
+
+        // Last as this may destroy the process.
+        slot.m_processPtr.reset();
     }
 
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
-    CProcessManager::CProcessManager() : m_processList()
+    void CProcessManager::UpdateActiveCount(CProcess &process)
+    {
+        if(process.m_counted) {
+            --m_activeCounts[process.m_countedType];
+            process.m_counted = false;
+        }
+
+        const I32 type = process.GetType();
+        if(process.IsAttached() && (!process.IsDead() || process.m_pNext) && type >= 0) {
+            if(U32(type) >= m_activeCounts.size()) {
+                m_activeCounts.resize(type + 1, 0);
+            }
+            ++m_activeCounts[type];
+            process.m_countedType = type;
+            process.m_counted = true;
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void CProcessManager::UpdateGathered(const F32 elapsedTime)
+    {
+        const U32 numberJobs = m_schedulerPtr->GetNumberJobs();
+        if(numberJobs > 0) {
+            m_parallelUpdate = true;
+            m_schedulerPtr->Run(elapsedTime);
+            m_parallelUpdate = false;
+
+            for(U32 i = 0; i < numberJobs; ++i) {
+                UpdateActiveCount(*m_schedulerPtr->GetJob(i));
+            }
+            m_schedulerPtr->Clear();
+        }
+
+        // These may clear the manager, so check each is still attached.
+        for(SlotIndexVec::const_iterator i = m_serial.begin(), end = m_serial.end(); i != end; ++i) {
+            if(IsSlotAttached(*i)) {
+                CProcess *processPtr = m_slots[*i].m_processPtr.get();
+                if(processPtr->IsActive() && !processPtr->IsPaused()) {
+                    processPtr->VOnUpdate(elapsedTime);
+                }
+            }
+        }
+        m_serial.clear();
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    CProcessManager::CProcessManager()\
+:
+    m_slots()
+    , m_freeSlots()
+    , m_running()
+    , m_pending()
+    , m_activeCounts(NUMBER_PROCESS_TYPES, 0)
+    , m_numberAttached(0)
+    , m_updating(false)
+    , m_schedulerPtr()
+    , m_serial()
+    , m_parallelUpdate(false)
     {
     }
 
@@ -244,62 +369,122 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     void CProcessManager::UpdateProcesses(const F32 elapsedTime)
     {
-        ProcessList::iterator i = m_processList.begin();        // Current position in list.
-        ProcessList::iterator end = m_processList.end();        // End of list.
-        shared_ptr<CProcess> pNext;                             // The current processes NEXT process
-        //  to run after it has completed.
+        m_updating = true;
+
+        // Start the processes attached since the last update.
+        for(SlotIndexVec::const_iterator i = m_pending.begin(), end = m_pending.end(); i != end; ++i) {
+            if(IsSlotAttached(*i)) {
+                m_running.push_back(*i);
+            } else {
+                ReleaseSlot(*i);
+            }
+        }
+        m_pending.clear();
+
+        // Update the processes and compact the survivors to the front.  Anything
+        //  attached in here goes to m_pending so m_running does not grow.  With a
+        //  scheduler the processes are only gathered here and updated after.
+        const U32 numberRunning = U32(m_running.size());
+        U32 numberKept = 0;
+        for(U32 i = 0; i < numberRunning; ++i) {
+            const U32 slotIndex = m_running[i];
+            if(!IsSlotAttached(slotIndex)) {
+                ReleaseSlot(slotIndex);
+                continue;
+            }
 
-        while(i != end) {
-            shared_ptr<CProcess> p(*i);
-            ++i;
+            CProcess *processPtr = m_slots[slotIndex].m_processPtr.get();
+            if(processPtr->IsDead()) {
+                if(processPtr->m_pNext) {
+                    shared_ptr<CProcess> nextPtr;
+                    nextPtr.swap(processPtr->m_pNext);
+                    Attach(nextPtr);
+                }
+                Detach(*processPtr);
+                ReleaseSlot(slotIndex);
+                continue;
+            }
 
-            if(p->IsDead()) {
-                pNext = p->GetNext();
-                if(pNext) {
-                    p->SetNext(shared_ptr<CProcess>((CProcess *)NULL));
-                    Attach(pNext);
+            if(processPtr->IsActive() && !processPtr->IsPaused()) {
+                if(!m_schedulerPtr) {
+                    processPtr->VOnUpdate(elapsedTime);
+                } else if(processPtr->IsThreadSafe()) {
+                    m_schedulerPtr->AddJob(processPtr);
+                } else {
+                    m_serial.push_back(slotIndex);
                 }
-                Detach(p);
-            } else if(p->IsActive() && !p->IsPaused()) {
-                p->VOnUpdate(elapsedTime);
             }
+            m_running[numberKept++] = slotIndex;
+        }
+        m_running.resize(numberKept);
+
+        if(m_schedulerPtr) {
+            UpdateGathered(elapsedTime);
         }
+
+        m_updating = false;
     }
 
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
-    bool CProcessManager::IsProcessActive(const I32 nType)
+    bool CProcessManager::IsProcessActive(const I32 nType) const
     {
-        bool foundActiveProcess = false;
+        return (nType >= 0 && U32(nType) < m_activeCounts.size() && m_activeCounts[nType] > 0);
+    }
 
-        for(ProcessList::iterator i = m_processList.begin(); ((!foundActiveProcess) && (i != m_processList.end())); ++i) {
-            if((*i)->GetType() == nType &&
-                    (((*i)->IsDead() == false) || (*i)->GetNext())) {
-                foundActiveProcess = true;
-            }
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    ProcessHandle CProcessManager::Attach(shared_ptr<CProcess> pProcess)
+    {
+        if(!pProcess) {
+            return (ProcessHandle());
         }
+        if(pProcess->m_managerPtr == this) {
+            return (ProcessHandle(pProcess->m_slotIndex, m_slots[pProcess->m_slotIndex].m_generation));
+        }
+        if(pProcess->m_managerPtr) {
+            return (ProcessHandle());
+        }
+
+        U32 slotIndex = 0;
+        if(m_freeSlots.empty()) {
+            slotIndex = U32(m_slots.size());
+            m_slots.push_back(ProcessSlot());
+        } else {
+            slotIndex = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        m_slots[slotIndex].m_processPtr = pProcess;
+
+        pProcess->m_managerPtr = this;
+        pProcess->m_slotIndex = slotIndex;
+        pProcess->SetAttached(true);
+        UpdateActiveCount(*pProcess);
+        ++m_numberAttached;
+        m_pending.push_back(slotIndex);
 
-        return (foundActiveProcess);
+        return (ProcessHandle(slotIndex, m_slots[slotIndex].m_generation));
     }
 
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
-    void CProcessManager::Attach(shared_ptr<CProcess> pProcess)
+    shared_ptr<CProcess> CProcessManager::GetProcess(const ProcessHandle handle) const
     {
-        if(pProcess) {
-            pProcess->SetAttached(true);
-            m_processList.push_back(pProcess);
+        if(!handle.IsValid() || handle.m_slotIndex >= m_slots.size() || m_slots[handle.m_slotIndex].m_generation != handle.m_generation || !IsSlotAttached(handle.m_slotIndex)) {
+            return (shared_ptr<CProcess>());
         }
+        return (m_slots[handle.m_slotIndex].m_processPtr);
     }
 
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
-    bool CProcessManager::HasProcesses()
+    bool CProcessManager::HasProcesses() const
     {
-        return (!m_processList.empty());
+        return (m_numberAttached > 0);
     }
 
     // /////////////////////////////////////////////////////////////////
@@ -307,12 +492,53 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     void CProcessManager::ClearAll(const bool killAll)
     {
-        for(ProcessList::iterator i = m_processList.begin(); i != m_processList.end(); ++i) {
-            Detach(*i);
-            if(killAll) {
-                (*i)->VKill();
+        SlotIndexVec *lists[] = { &m_running, &m_pending };
+        for(U32 l = 0; l < 2; ++l) {
+            for(SlotIndexVec::const_iterator i = lists[l]->begin(), end = lists[l]->end(); i != end; ++i) {
+                if(IsSlotAttached(*i)) {
+                    CProcess &process = *m_slots[*i].m_processPtr;
+                    if(killAll) {
+                        process.VKill();
+                    }
+                    Detach(process);
+                }
+            }
+        }
+
+        // During an update the loop frees the slots as it reaches them.
+        if(!m_updating) {
+            for(U32 l = 0; l < 2; ++l) {
+                for(SlotIndexVec::const_iterator i = lists[l]->begin(), end = lists[l]->end(); i != end; ++i) {
+                    ReleaseSlot(*i);
+                }
+                lists[l]->clear();
             }
         }
     }
 
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool CProcessManager::SetWorkerThreadPool(shared_ptr<WorkerThreadPool> poolPtr)
+    {
+        if(m_updating) {
+            GF_LOG_TRACE_ERR("CProcessManager::SetWorkerThreadPool()", "The worker threads can not be changed while the processes are being updated");
+            return (false);
+        }
+
+        m_schedulerPtr.reset();
+        if(!poolPtr) {
+            return (true);
+        }
+
+        m_schedulerPtr.reset(GCC_NEW ProcessJobScheduler(poolPtr));
+        if(!m_schedulerPtr || !m_schedulerPtr->IsValid()) {
+            GF_LOG_TRACE_ERR("CProcessManager::SetWorkerThreadPool()", "Failed to create the process job scheduler, the processes will be updated on the calling thread");
+            m_schedulerPtr.reset();
+            return (false);
+        }
+
+        return (true);
+    }
+
 }
@@ -60,15 +60,50 @@
 // - I put the PROCESS_FLAG_ATTACHED as a private member of CProcess.
 // - I put the ProcessList tpedef inside in CProcessManager in the
 //      private section so it is known only to that class.
+// - CProcessManager keeps the processes in a slot array rather than a
+//      std::list.  Attach() returns a stable handle to the process,
+//      processes attached during an update (including chained next
+//      processes) start running on the following update and
+//      IsProcessActive() reads a count kept per process type.
+// - Processes may declare themselves thread safe with SetThreadSafe()
+//      and are then updated in parallel once the manager is given a
+//      WorkerThreadPool.
 //
 // /////////////////////////////////////////////////////////////////
 
-#include <list>
+#include <vector>
 
 #include "GameBase.h"
 
 namespace GameHalloran {
 
+    class CProcessManager;
+    class ProcessJobScheduler;
+    class WorkerThreadPool;
+
+    // /////////////////////////////////////////////////////////////////
+    // @struct ProcessHandle
+    //
+    // Handle to a process attached to a CProcessManager.  It goes stale
+    // (and CProcessManager::GetProcess() returns NULL) once the process
+    // is removed from the manager.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct ProcessHandle {
+        U32 m_slotIndex;                                ///< Slot of the process in the manager.
+        U32 m_generation;                               ///< Generation of the slot when the process was attached (0 for an invalid handle).
+
+        ProcessHandle(const U32 slotIndex = 0, const U32 generation = 0) : m_slotIndex(slotIndex), m_generation(generation) {};
+
+        // /////////////////////////////////////////////////////////////////
+        // Was the handle returned for an attached process?
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool IsValid() const {
+            return (m_generation != 0);
+        };
+    };
+
     enum PROCESS_TYPE {
         PROC_NONE,
         PROC_WAIT,
@@ -91,7 +126,10 @@ namespace GameHalloran {
     class CProcess : public NonCopyable {
     private:
 
+        friend class CProcessManager;
+
         static const I32 PROCESS_FLAG_ATTACHED = 0x00000001;    ///< Flag to indicate the process is currently attached or not to the manager.
+        static const I32 PROCESS_FLAG_THREAD_SAFE = 0x00000002; ///< Flag to indicate the process may be updated on a worker thread.
 
         U32 m_uProcessFlags;                            ///< The current value of the process flags.
         I32 m_iType;                                            ///< Type of process running
@@ -101,6 +139,17 @@ namespace GameHalloran {
         bool m_bInitialUpdate;                                  ///< Initial update?
         boost::shared_ptr<CProcess> m_pNext;                    ///< A pointer to the process that will run directly
         ///<  after this process.
+        CProcessManager *m_managerPtr;                          ///< Manager the process is attached to (NULL if none).
+        U32 m_slotIndex;                                        ///< Slot of the process in the manager.
+        I32 m_countedType;                                      ///< Type the process is counted as active under by the manager.
+        bool m_counted;                                         ///< Is the process counted as active by the manager?
+
+        // /////////////////////////////////////////////////////////////////
+        // Tell the manager the process is attached to that its type, next
+        // process or dead state changed.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void ActiveStateChanged();
 
     protected:
 
@@ -115,6 +164,19 @@ namespace GameHalloran {
             return (m_bInitialUpdate);
         };
 
+        // /////////////////////////////////////////////////////////////////
+        // Declare that VOnUpdate() (and VOnInitialize()) may run on a worker
+        // thread at the same time as other thread safe processes.
+        //
+        // A thread safe process may only change its own state and data
+        // that no other process touches.  It may kill itself and set its
+        // next process, but must not attach processes, queue events, play
+        // sounds or call OpenGL.  It is updated before the processes that
+        // are not thread safe each frame.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void SetThreadSafe(const bool threadSafe);
+
     public:
 
         // /////////////////////////////////////////////////////////////////
@@ -181,6 +243,12 @@ namespace GameHalloran {
         // /////////////////////////////////////////////////////////////////
         bool IsAttached() const;
 
+        // /////////////////////////////////////////////////////////////////
+        // Can the process be updated on a worker thread?
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool IsThreadSafe() const;
+
         // /////////////////////////////////////////////////////////////////
         // Sets if the process should currently be attached to the process
         // manager.
@@ -249,21 +317,90 @@ namespace GameHalloran {
     //
     // CProcessManager is a container for CProcess objects.
     //
+    // The processes are held in a slot array and updated through a
+    // dense array of slot indices in the order they were attached, so
+    // the update loop touches no reference counts and allocates nothing
+    // once the arrays have grown.  Freed slots are reused and each slot
+    // has a generation so handles to removed processes go stale.
+    //
+    // Processes attached while UpdateProcesses() is running, such as the
+    // next process of a process that has died, are held back until the
+    // next update.  Processes cleared during an update are removed from
+    // the arrays at the end of it.
+    //
+    // Once SetWorkerThreadPool() is called the thread safe processes
+    // are updated together on the pool and the calling thread first,
+    // then the rest are updated in order on the calling thread.  A chain
+    // of next processes still runs in order as each one only starts on
+    // the update after the one before it died.
+    //
     // /////////////////////////////////////////////////////////////////
     class CProcessManager {
     private:
 
-        typedef std::list<boost::shared_ptr<CProcess> > ProcessList;
-        ProcessList m_processList;                          ///< A list of CProcess objects.
+        friend class CProcess;
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct ProcessSlot
+        //
+        // A slot holding an attached process.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct ProcessSlot {
+            boost::shared_ptr<CProcess> m_processPtr;       ///< The process (NULL when the slot is free).
+            U32 m_generation;                               ///< Bumped every time the slot is freed.
+
+            ProcessSlot() : m_processPtr(), m_generation(1) {};
+        };
+
+        typedef std::vector<ProcessSlot> ProcessSlotVec;
+        typedef std::vector<U32> SlotIndexVec;
+
+        ProcessSlotVec m_slots;                             ///< Every slot, free or in use.
+        SlotIndexVec m_freeSlots;                           ///< Slots free for reuse.
+        SlotIndexVec m_running;                             ///< Slots updated each frame, in the order they were attached.
+        SlotIndexVec m_pending;                             ///< Slots attached since the last update started.
+        std::vector<U32> m_activeCounts;                    ///< Number of attached processes per type which are alive or have a next process.
+        U32 m_numberAttached;                               ///< Number of attached processes.
+        bool m_updating;                                    ///< Is UpdateProcesses() running?
+        boost::shared_ptr<ProcessJobScheduler> m_schedulerPtr;  ///< Updates the thread safe processes (NULL to update every process in order).
+        SlotIndexVec m_serial;                              ///< Slots of the processes which are not thread safe, filled while m_schedulerPtr is running.
+        bool m_parallelUpdate;                              ///< Are processes being updated on the worker threads?
+
+        // /////////////////////////////////////////////////////////////////
+        // Does a slot still hold the process attached to it?  (False once
+        // the process has been detached, e.g. by ClearAll()).
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool IsSlotAttached(const U32 slotIndex) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Removes a process from the manager.  Its slot is freed later by
+        // ReleaseSlot().
+        //
+        // @param process The CProcess object to remove.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void Detach(CProcess &process);
 
         // /////////////////////////////////////////////////////////////////
-        // Removes a process from the list.
+        // Free a slot, releasing the managers reference to its process.
         //
-        // @param pProcess A pointer to the CProcess object to remove from
-        //                  the list.
+        // /////////////////////////////////////////////////////////////////
+        void ReleaseSlot(const U32 slotIndex);
+
+        // /////////////////////////////////////////////////////////////////
+        // Recount a process as active or not for its type.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void UpdateActiveCount(CProcess &process);
+
+        // /////////////////////////////////////////////////////////////////
+        // Update the thread safe processes gathered by the scheduler on
+        // the worker threads and then the processes in m_serial in order.
         //
         // /////////////////////////////////////////////////////////////////
-        void Detach(boost::shared_ptr<CProcess> pProcess);
+        void UpdateGathered(const F32 elapsedTime);
 
     public:
 
@@ -293,19 +430,40 @@ namespace GameHalloran {
         // running or active.
         //
         // /////////////////////////////////////////////////////////////////
-        bool IsProcessActive(const I32 nType);
+        bool IsProcessActive(const I32 nType) const;
 
         // /////////////////////////////////////////////////////////////////
-        // Attach a process to the list.
+        // Attach a process to the manager.  It is first updated on the
+        // next call to UpdateProcesses() that starts after this.
+        //
+        // @return ProcessHandle Handle to the process (invalid if pProcess
+        //                      is NULL or attached to another manager).
         //
         // /////////////////////////////////////////////////////////////////
-        void Attach(boost::shared_ptr<CProcess> pProcess);
+        ProcessHandle Attach(boost::shared_ptr<CProcess> pProcess);
+
+        // /////////////////////////////////////////////////////////////////
+        // Get an attached process from its handle.
+        //
+        // @return boost::shared_ptr<CProcess> NULL if the process has been
+        //                                      removed from the manager.
+        //
+        // /////////////////////////////////////////////////////////////////
+        boost::shared_ptr<CProcess> GetProcess(const ProcessHandle handle) const;
 
         // /////////////////////////////////////////////////////////////////
         // Does the manager have any processes?
         //
         // /////////////////////////////////////////////////////////////////
-        bool HasProcesses();
+        bool HasProcesses() const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of attached processes.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetNumberProcesses() const {
+            return (m_numberAttached);
+        };
 
         // /////////////////////////////////////////////////////////////////
         // Clear all currently running processes.
@@ -316,6 +474,21 @@ namespace GameHalloran {
         // /////////////////////////////////////////////////////////////////
         void ClearAll(const bool killAll = true);
 
+        // /////////////////////////////////////////////////////////////////
+        // Set the worker threads the thread safe processes are updated on.
+        // The pool should not be busy with long tasks while the processes
+        // are updated as the update waits for its tasks to start.
+        //
+        // @param poolPtr The worker threads (NULL to update every process
+        //                  in order on the calling thread).
+        //
+        // @return bool False if called from a process update or the
+        //              scheduler could not be created, the processes are
+        //              then updated on the calling thread.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool SetWorkerThreadPool(boost::shared_ptr<WorkerThreadPool> poolPtr);
+
     };
 
 }
@@ -8,6 +8,7 @@
 // /////////////////////////////////////////////////////////////////
 
 // External headers
+#include <cassert>
 #include <cstring>
 #include <string>
 #include <iostream>
@@ -27,6 +28,9 @@
 #include "ResCache2.h"
 #include "TextureManager.h"
 #include "TextureAtlas.h"
+#include "ShaderProgramCache.h"
+#include "ShaderArchive.h"
+#include "GameMemory.h"
 
 // Namespace Declarations
 using std::string;
@@ -287,6 +291,7 @@ namespace GameHalloran {
         m_eventManagerPtr->RegisterCodeOnlyEvent(EvtData_New_Actor::sk_EventType);
         m_eventManagerPtr->RegisterCodeOnlyEvent(EvtData_Destroy_Actor::sk_EventType);
         m_eventManagerPtr->RegisterCodeOnlyEvent(EvtData_Move_Actor::sk_EventType);
+        m_eventManagerPtr->RegisterCodeOnlyEvent(EvtData_Move_Actors::sk_EventType);
         m_eventManagerPtr->RegisterCodeOnlyEvent(EvtData_Move_Kinematic_Actor::sk_EventType);
         m_eventManagerPtr->RegisterEvent<EvtData_Request_New_Actor>(EvtData_Request_New_Actor::sk_EventType);
         m_eventManagerPtr->RegisterEvent<EvtData_UpdateActorParams>(EvtData_UpdateActorParams::sk_EventType);
@@ -462,6 +467,93 @@ namespace GameHalloran {
         return (result);
     }
 
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool GameMain::SetUpWorkerThreadPool()
+    {
+        I32 numberThreads = -1;                 // Number of worker threads requested.
+
+        if(!RetrieveAndConvertOption<I32>(m_optionsPtr, string("WorkerThreads"), GameOptions::PROGRAMMER, numberThreads) || numberThreads < 0) {
+            // Leave one processor free for the main thread.
+            numberThreads = I32(WorkerThreadPool::GetNumberProcessors()) - 1;
+        }
+
+        m_workerPoolPtr.reset(GCC_NEW WorkerThreadPool(U32(numberThreads)));
+        if(!m_workerPoolPtr || !m_workerPoolPtr->IsValid()) {
+            GF_LOG_ERR("Failed to create the worker thread pool");
+            m_workerPoolPtr.reset();
+            return (false);
+        }
+
+        ostringstream conv;
+        conv << m_workerPoolPtr->GetNumberThreads();
+        GF_LOG_INF(string("Created ") + conv.str() + string(" worker threads"));
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool GameMain::SetUpShaderProgramCache()
+    {
+        bool enabled = true;                    // Is the cache enabled in the options?
+
+        if(RetrieveAndConvertOption<bool>(m_optionsPtr, string("ShaderCache"), GameOptions::PROGRAMMER, enabled) && !enabled) {
+            GF_LOG_INF("The shader program cache is disabled in the options");
+            return (false);
+        }
+        if(m_saveGameDir.empty()) {
+            GF_LOG_INF("There is no save game directory for the shader program cache");
+            return (false);
+        }
+        if(!ShaderProgramCache::IsSupported()) {
+            GF_LOG_INF("The OpenGL driver cannot save program binaries so shaders will be built from source");
+            return (false);
+        }
+
+        const boost::filesystem::path cacheDir(m_saveGameDir / "shadercache");
+        m_shaderCachePtr.reset(GCC_NEW ShaderProgramCache(cacheDir, ShaderProgramCache::GetDriverString()));
+        if(!m_shaderCachePtr || !m_shaderCachePtr->IsValid()) {
+            GF_LOG_ERR(string("Failed to create the shader program cache in ") + cacheDir.string());
+            m_shaderCachePtr.reset();
+            return (false);
+        }
+
+        GF_LOG_INF(string("Using the shader program cache in ") + cacheDir.string() + string(" for ") + m_shaderCachePtr->GetDriver());
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool GameMain::SetUpShaderArchive()
+    {
+        ResourceListing archiveList;
+        if(!m_resourceCachePtr->GetResourceListing(string("shaders/shaders\\.") + SHADER_ARCHIVE_EXTENSION, archiveList) || archiveList.empty()) {
+            GF_LOG_INF("There is no shader archive so shaders will be read from their source files");
+            return (false);
+        }
+
+        Resource archiveRes(archiveList.front().string());
+        shared_ptr<ResHandle> archiveHandle = m_resourceCachePtr->GetHandle(&archiveRes);
+        m_shaderArchivePtr.reset(GCC_NEW ShaderArchive());
+        if(!archiveHandle || !m_shaderArchivePtr \
+                || !m_shaderArchivePtr->Load(reinterpret_cast<const U8 *>(archiveHandle->Buffer()), archiveHandle->Size())) {
+            GF_LOG_ERR(string("Failed to load the shader archive ") + archiveRes.GetName());
+            m_shaderArchivePtr.reset();
+            return (false);
+        }
+
+        ostringstream ss;
+        ss << "Loaded " << m_shaderArchivePtr->GetPrograms().size() << " shader programs from " << archiveRes.GetName();
+        GF_LOG_INF(ss.str());
+
+        return (true);
+    }
+
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
@@ -557,9 +649,24 @@ namespace GameHalloran {
         if(result) {
             result = SetUpWindowManager();
         }
+        if(result) {
+            // GLFW is initialised, make the small object pool thread safe before the workers start.
+            result = GameMemoryInit();
+            if(!result) {
+                GF_LOG_TRACE_FAT("GameMain::Initialize()", "Failed to initialize the game memory pools");
+            }
+        }
+        if(result) {
+            result = SetUpWorkerThreadPool();
+        }
         if(result) {
             result = VInitOpenGL();
         }
+        if(result) {
+            // The cache and archive are optional, shaders are built from their source files without them.
+            SetUpShaderProgramCache();
+            SetUpShaderArchive();
+        }
         if(result) {
             m_logicPtr = VCreateLogicAndViews();
             if(!m_logicPtr) {
@@ -567,6 +674,9 @@ namespace GameHalloran {
                 result = false;
             }
         }
+        if(result && m_shaderCachePtr) {
+            GF_LOG_INF(m_shaderCachePtr->GetStatsReport());
+        }
 
         return (result);
     }
@@ -590,6 +700,9 @@ namespace GameHalloran {
         , m_eventManagerPtr()
         , m_logicPtr()
         , m_atlasPtr()
+        , m_workerPoolPtr()
+        , m_shaderCachePtr()
+        , m_shaderArchivePtr()
         , m_loggerPtr(loggerPtr)
         , m_windowManagerPtr()
         , m_optionsPtr(optionsPtr)
@@ -623,6 +736,17 @@ namespace GameHalloran {
     GameMain::~GameMain()
     {
         try {
+            // The process manager and views of the logic layer and a texture
+            // prefetch share the worker threads.  Release them so resetting
+            // the pool joins the workers, before the window manager terminates
+            // GLFW and the allocater locks are freed.
+            m_logicPtr.reset();
+            if(m_texManagerPtr) {
+                m_texManagerPtr->FreeAll();
+            }
+            assert(!m_workerPoolPtr || m_workerPoolPtr.unique());
+            m_workerPoolPtr.reset();
+            GameMemoryShutdown();
         } catch(...) {}
     }
 
@@ -818,6 +942,11 @@ namespace GameHalloran {
         // allow event queue to process for a maximum of 20 ms to deal with game events.
         safeTickEventManager(20);
 
+        // Upload any prefetched textures which have finished decoding.
+        if(m_texManagerPtr) {
+            m_texManagerPtr->UpdatePrefetch();
+        }
+
         m_logicPtr->VOnUpdate(time, elapsedTime);
         m_lastUpdateTime = m_appTimer->GetTime();
     }
@@ -835,6 +964,11 @@ namespace GameHalloran {
             (*i)->VOnRender(time, elapsedTime);
         }
 
+#ifdef GF_GL_RECORDING
+        // Keep the GL call counts of the frame for the benchmarks.
+        GLRecorder::GetGlobalInstance().EndFrame();
+#endif
+
         m_lastRenderTime = m_appTimer->GetTime();
     }
 
@@ -921,6 +1055,31 @@ namespace GameHalloran {
         GF_LOG_INF("Leaving the main game loop now");
     }
 
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 GameMain::RunFrames(const U32 numberFrames)
+    {
+        if(!m_logicPtr) {
+            GF_LOG_FAT("Cannot run the game loop as the logic layer does not exist");
+            return (0);
+        }
+
+        m_appTimer->Start();
+        m_startTime = m_appTimer->GetTime();
+
+        U32 frames = 0;
+        while(m_isRunning && frames < numberFrames) {
+            VUpdate();
+            VRender();
+            m_windowManagerPtr->SwapBuffers();
+            VPollEvents();
+            ++frames;
+        }
+
+        return (frames);
+    }
+
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
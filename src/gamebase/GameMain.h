@@ -32,6 +32,7 @@
 #include "Timer.h"
 #include "Point.h"
 #include "OsInputEvents.h"
+#include "WorkerThreadPool.h"
 
 // /////////////////////////////////////////////////////////////////
 //
@@ -45,6 +46,8 @@ namespace GameHalloran {
     class GameOptions;
     class GameLog;
     class FontBufferCache;
+    class ShaderProgramCache;
+    class ShaderArchive;
 
     // /////////////////////////////////////////////////////////////////
     // @class GameMain
@@ -77,6 +80,9 @@ namespace GameHalloran {
         boost::shared_ptr<EventManager> m_eventManagerPtr;          ///< Event framework.
         boost::shared_ptr<BaseGameLogic> m_logicPtr;                ///< Pointer to the logic layer.
         boost::shared_ptr<TextureAtlasManager> m_atlasPtr;          ///< TextureAtlas manager.
+        boost::shared_ptr<WorkerThreadPool> m_workerPoolPtr;        ///< Background worker threads for CPU bound loading tasks.
+        boost::shared_ptr<ShaderProgramCache> m_shaderCachePtr;     ///< Cache of linked shader program binaries.
+        boost::shared_ptr<ShaderArchive> m_shaderArchivePtr;        ///< Packed shader sources built by glslc.
 
         // GLFW/OS event data.
         GfEventFactory m_eventFactoryObj;                           ///< Global OS input/window event factory object.
@@ -140,6 +146,41 @@ namespace GameHalloran {
         // /////////////////////////////////////////////////////////////////
         bool SetUpWindowManager();
 
+        // /////////////////////////////////////////////////////////////////
+        // Setup the pool of background worker threads.  The number of
+        // threads is read from the "WorkerThreads" option and defaults to
+        // one less than the number of processors.
+        //
+        // Must be called after the window manager has initialized GLFW.
+        //
+        // @return bool True on success and false on failure.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool SetUpWorkerThreadPool();
+
+        // /////////////////////////////////////////////////////////////////
+        // Setup the cache of linked shader program binaries in the
+        // "shadercache" folder of the save game directory.  The cache is
+        // disabled by setting the "ShaderCache" option to 0 and when the
+        // driver cannot save program binaries.
+        //
+        // Must be called after the OpenGL context and GLEW are initialized.
+        //
+        // @return bool True if the cache is in use.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool SetUpShaderProgramCache();
+
+        // /////////////////////////////////////////////////////////////////
+        // Load the shader archive "shaders/shaders.gsa" from the resource
+        // cache, if the data file has one, so the programs packed in it
+        // are built without reading each shader source file.
+        //
+        // @return bool True if the archive is in use.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool SetUpShaderArchive();
+
         // /////////////////////////////////////////////////////////////////
         // Get the minimum window/OpenGL context system parameters defined
         // for this application in the user configuration file.
@@ -339,6 +380,18 @@ namespace GameHalloran {
         // /////////////////////////////////////////////////////////////////
         void Main();
 
+        // /////////////////////////////////////////////////////////////////
+        // Run a number of frames of the game loop as fast as possible, for
+        // the benchmarks.  Unlike Main() the frame rate is not regulated.
+        // Returns early if the running flag is unset.
+        //
+        // @param numberFrames The number of frames to run.
+        //
+        // @return U32 The number of frames run.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U32 RunFrames(const U32 numberFrames);
+
         // /////////////////////////////////////////////////////////////////
         // Get a pointer to the WindowManager.
         //
@@ -415,6 +468,31 @@ namespace GameHalloran {
             return (m_atlasPtr);
         };
 
+        // /////////////////////////////////////////////////////////////////
+        // Get the cache of linked shader program binaries.  NULL if the
+        // cache is not in use.
+        //
+        // /////////////////////////////////////////////////////////////////
+        boost::shared_ptr<ShaderProgramCache> GetShaderProgramCachePtr() {
+            return (m_shaderCachePtr);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the shader archive.  NULL if there is none.
+        //
+        // /////////////////////////////////////////////////////////////////
+        boost::shared_ptr<ShaderArchive> GetShaderArchivePtr() {
+            return (m_shaderArchivePtr);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the background worker thread pool.
+        //
+        // /////////////////////////////////////////////////////////////////
+        boost::shared_ptr<WorkerThreadPool> GetWorkerThreadPoolPtr() {
+            return (m_workerPoolPtr);
+        };
+
         // /////////////////////////////////////////////////////////////////
         // Parses a directory and returns a list of all the game files that
         // may be used to load a previously saved game state.
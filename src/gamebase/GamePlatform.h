@@ -74,10 +74,26 @@
 #endif
 
 #elif TARGET_OS_UNIX
-// TODO: ...
+
+#include <GL/glew.h>
+#include <GL/gl.h>
+#ifdef USE_NEW_GLFW
+#include <GL/glfw3.h>
+#define GLFW_FUNC_PRE GLFWAPI
+#else
+#include <GL/glfw.h>
+#define GLFW_FUNC_PRE GLFWCALL
+#endif
+#include <assert.h>
+
 #else
 #error "Platform not yet supported!"
 #endif
 #endif
 
+// Route the OpenGL calls to the headless recording backend.
+#ifdef GF_GL_RECORDING
+#include "GLRecorder.h"
+#endif
+
 #endif
@@ -0,0 +1,233 @@
+// /////////////////////////////////////////////////////////////////
+// @file ProcessJobScheduler.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the implementation of the ProcessJobScheduler class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include "ProcessJobScheduler.h"
+#include "CProcess.h"
+#include "GameMain.h"
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ProcessJobScheduler::PopJobs(const U32 queueIndex, U32 &begin, U32 &end)
+    {
+        JobQueue &queue = m_queues[queueIndex];
+
+        glfwLockMutex(queue.m_mutex);
+        begin = queue.m_begin;
+        end = std::min(queue.m_end, queue.m_begin + JOBS_PER_POP);
+        queue.m_begin = end;
+        glfwUnlockMutex(queue.m_mutex);
+
+        return (begin < end);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ProcessJobScheduler::StealJobs(const U32 queueIndex)
+    {
+        while(true) {
+            // The victims size may change before it is locked again below.
+            U32 victim = queueIndex;
+            U32 victimSize = 0;
+            for(U32 i = 0; i < m_queues.size(); ++i) {
+                if(i == queueIndex) {
+                    continue;
+                }
+                glfwLockMutex(m_queues[i].m_mutex);
+                const U32 size = m_queues[i].m_end - m_queues[i].m_begin;
+                glfwUnlockMutex(m_queues[i].m_mutex);
+                if(size > victimSize) {
+                    victim = i;
+                    victimSize = size;
+                }
+            }
+            if(victim == queueIndex) {
+                return (false);
+            }
+
+            JobQueue &victimQueue = m_queues[victim];
+            U32 begin = 0;
+            U32 end = 0;
+            glfwLockMutex(victimQueue.m_mutex);
+            if(victimQueue.m_begin < victimQueue.m_end) {
+                end = victimQueue.m_end;
+                begin = end - (end - victimQueue.m_begin) / 2;
+                if(begin == end) {
+                    // One job left, take it rather than leave the owner to finish alone.
+                    begin = victimQueue.m_begin;
+                }
+                victimQueue.m_end = begin;
+            }
+            glfwUnlockMutex(victimQueue.m_mutex);
+
+            if(begin < end) {
+                JobQueue &queue = m_queues[queueIndex];
+                glfwLockMutex(queue.m_mutex);
+                queue.m_begin = begin;
+                queue.m_end = end;
+                glfwUnlockMutex(queue.m_mutex);
+
+                glfwLockMutex(m_mutex);
+                ++m_numberStolen;
+                glfwUnlockMutex(m_mutex);
+                return (true);
+            }
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ProcessJobScheduler::RunJobs(const U32 begin, const U32 end)
+    {
+        for(U32 i = begin; i < end; ++i) {
+            try {
+                m_jobs[i]->VOnUpdate(m_elapsedTime);
+            } catch(...) {
+                // Keep going so the rest of the batch is updated and the waiter wakes.
+            }
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ProcessJobScheduler::RunQueue(const U32 queueIndex)
+    {
+        U32 begin = 0;
+        U32 end = 0;
+        do {
+            while(PopJobs(queueIndex, begin, end)) {
+                RunJobs(begin, end);
+            }
+        } while(StealJobs(queueIndex));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ProcessJobScheduler::WorkerCompleted()
+    {
+        glfwLockMutex(m_mutex);
+        if(--m_workersPending == 0) {
+            glfwBroadcastCond(m_workersDoneCond);
+        }
+        glfwUnlockMutex(m_mutex);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    ProcessJobScheduler::ProcessJobScheduler(boost::shared_ptr<WorkerThreadPool> poolPtr)\
+:
+    m_poolPtr(poolPtr)
+    , m_jobs()
+    , m_queues()
+    , m_workerJobs()
+    , m_elapsedTime(0.0f)
+    , m_mutex(NULL)
+    , m_workersDoneCond(NULL)
+    , m_workersPending(0)
+    , m_numberStolen(0)
+    {
+        m_mutex = glfwCreateMutex();
+        m_workersDoneCond = glfwCreateCond();
+        if(!m_mutex || !m_workersDoneCond) {
+            GF_LOG_TRACE_ERR("ProcessJobScheduler::ProcessJobScheduler()", "Failed to create the thread synchronization objects");
+            return;
+        }
+
+        const U32 numberQueues = (m_poolPtr ? m_poolPtr->GetNumberThreads() : 0) + 1;
+        m_queues.resize(numberQueues);
+        for(U32 i = 0; i < numberQueues; ++i) {
+            m_queues[i].m_mutex = glfwCreateMutex();
+            if(!m_queues[i].m_mutex) {
+                GF_LOG_TRACE_ERR("ProcessJobScheduler::ProcessJobScheduler()", "Failed to create a job queue mutex");
+                m_queues.resize(i);
+                break;
+            }
+            if(i > 0) {
+                m_workerJobs.push_back(WorkerTaskPtr(GCC_NEW WorkerJob(this, i)));
+            }
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    ProcessJobScheduler::~ProcessJobScheduler()
+    {
+        try {
+            for(std::vector<JobQueue>::iterator i = m_queues.begin(), end = m_queues.end(); i != end; ++i) {
+                glfwDestroyMutex(i->m_mutex);
+            }
+            if(m_workersDoneCond) {
+                glfwDestroyCond(m_workersDoneCond);
+            }
+            if(m_mutex) {
+                glfwDestroyMutex(m_mutex);
+            }
+        } catch(...) {}
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ProcessJobScheduler::IsValid() const
+    {
+        return (m_mutex != NULL && m_workersDoneCond != NULL && !m_queues.empty());
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ProcessJobScheduler::Run(const F32 elapsedTime)
+    {
+        const U32 numberJobs = U32(m_jobs.size());
+        m_elapsedTime = elapsedTime;
+        m_numberStolen = 0;
+
+        const U32 numberQueues = IsValid() ? std::min<U32>(U32(m_queues.size()), numberJobs / MIN_JOBS_PER_QUEUE) : 0;
+        if(numberQueues <= 1) {
+            RunJobs(0, numberJobs);
+            return;
+        }
+
+        for(U32 i = 0; i < U32(m_queues.size()); ++i) {
+            // No workers are running so the queues can be set without locking.
+            m_queues[i].m_begin = (i < numberQueues) ? (i * numberJobs) / numberQueues : 0;
+            m_queues[i].m_end = (i < numberQueues) ? ((i + 1) * numberJobs) / numberQueues : 0;
+        }
+
+        glfwLockMutex(m_mutex);
+        m_workersPending = numberQueues - 1;
+        glfwUnlockMutex(m_mutex);
+
+        for(U32 i = 1; i < numberQueues; ++i) {
+            if(!m_poolPtr->AddTask(m_workerJobs[i - 1])) {
+                RunQueue(i);
+                WorkerCompleted();
+            }
+        }
+
+        RunQueue(0);
+
+        glfwLockMutex(m_mutex);
+        while(m_workersPending > 0) {
+            glfwWaitCond(m_workersDoneCond, m_mutex, GLFW_INFINITY);
+        }
+        glfwUnlockMutex(m_mutex);
+    }
+
+}
@@ -0,0 +1,202 @@
+#pragma once
+#ifndef __GF_PROCESS_JOB_SCHEDULER_H
+#define __GF_PROCESS_JOB_SCHEDULER_H
+
+// /////////////////////////////////////////////////////////////////
+// @file ProcessJobScheduler.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the header for the ProcessJobScheduler class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include "GameBase.h"
+#include "WorkerThreadPool.h"
+
+namespace GameHalloran {
+
+    class CProcess;
+
+    // /////////////////////////////////////////////////////////////////
+    // @class ProcessJobScheduler
+    // @author PJ O Halloran
+    //
+    // Updates a batch of thread safe processes on the threads of a
+    // WorkerThreadPool and the calling thread.
+    //
+    // The batch is split into one contiguous queue per thread.  Each
+    // thread updates the processes at the front of its own queue and,
+    // once that is empty, steals the back half of the fullest queue, so
+    // a few slow processes do not leave the other threads idle.  Every
+    // queue has its own lock which is only contended while stealing.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class ProcessJobScheduler : private NonCopyable {
+    private:
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct JobQueue
+        //
+        // The range [m_begin, m_end) of m_jobs still to be run by a thread.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct JobQueue {
+            GLFWmutex m_mutex;                          ///< Guards the range.
+            U32 m_begin;                                ///< Next job to run.
+            U32 m_end;                                  ///< One past the last job.
+
+            JobQueue() : m_mutex(NULL), m_begin(0), m_end(0) {};
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // @class WorkerJob
+        //
+        // Worker task which drains (and steals into) one queue.
+        //
+        // /////////////////////////////////////////////////////////////////
+        class WorkerJob : public IWorkerTask {
+        private:
+            ProcessJobScheduler *m_schedulerPtr;        ///< Owning scheduler.
+            const U32 m_queueIndex;                     ///< Queue owned by the task.
+        public:
+            WorkerJob(ProcessJobScheduler *schedulerPtr, const U32 queueIndex) : m_schedulerPtr(schedulerPtr), m_queueIndex(queueIndex) {};
+            virtual void VExecute() {
+                m_schedulerPtr->RunQueue(m_queueIndex);
+                m_schedulerPtr->WorkerCompleted();
+            };
+        };
+
+        static const U32 MIN_JOBS_PER_QUEUE = 4;        ///< Smaller batches are not worth waking a worker for.
+        static const U32 JOBS_PER_POP = 8;              ///< Jobs taken from a queue per lock.
+
+        boost::shared_ptr<WorkerThreadPool> m_poolPtr;  ///< Threads to share the batch with.
+        std::vector<CProcess *> m_jobs;                 ///< Processes to update.
+        std::vector<JobQueue> m_queues;                 ///< One queue per thread, the calling thread owns queue 0.
+        std::vector<WorkerTaskPtr> m_workerJobs;        ///< Reused task for each worker queue.
+        F32 m_elapsedTime;                              ///< Time passed to the processes.
+        GLFWmutex m_mutex;                              ///< Guards m_workersPending.
+        GLFWcond m_workersDoneCond;                     ///< Signalled when the last worker task completes.
+        U32 m_workersPending;                           ///< Number of worker tasks still running.
+        U32 m_numberStolen;                             ///< Number of steals during the last Run().
+
+        // /////////////////////////////////////////////////////////////////
+        // Pop the next few jobs [begin, end) from the front of a queue.
+        //
+        // @return bool False if the queue is empty.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool PopJobs(const U32 queueIndex, U32 &begin, U32 &end);
+
+        // /////////////////////////////////////////////////////////////////
+        // Move the back half of the fullest other queue to an empty queue.
+        //
+        // @return bool False if there was nothing left to steal.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool StealJobs(const U32 queueIndex);
+
+        // /////////////////////////////////////////////////////////////////
+        // Update the processes of the jobs [begin, end).
+        //
+        // /////////////////////////////////////////////////////////////////
+        void RunJobs(const U32 begin, const U32 end);
+
+        // /////////////////////////////////////////////////////////////////
+        // Run jobs from a queue, stealing more until every queue is empty.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void RunQueue(const U32 queueIndex);
+
+        // /////////////////////////////////////////////////////////////////
+        // Record that a worker task has finished.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void WorkerCompleted();
+
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // Ensure to check if the scheduler was created with IsValid()
+        // after.
+        //
+        // @param poolPtr Worker threads to share the processes with.
+        //
+        // /////////////////////////////////////////////////////////////////
+        explicit ProcessJobScheduler(boost::shared_ptr<WorkerThreadPool> poolPtr);
+
+        // /////////////////////////////////////////////////////////////////
+        // Destructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        ~ProcessJobScheduler();
+
+        // /////////////////////////////////////////////////////////////////
+        // Were the synchronization objects created?
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool IsValid() const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Add a process to the next batch.  The process must stay alive
+        // until Run() returns.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline void AddJob(CProcess *processPtr) {
+            m_jobs.push_back(processPtr);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of processes in the next batch.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetNumberJobs() const {
+            return (U32(m_jobs.size()));
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the process of a job in the batch.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline CProcess *GetJob(const U32 index) const {
+            return (m_jobs[index]);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of times a thread ran out of work and stole from
+        // another during the last Run().
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetNumberStolen() const {
+            return (m_numberStolen);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Remove every process from the batch.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline void Clear() {
+            m_jobs.clear();
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Call VOnUpdate() on every process in the batch and wait for them
+        // to finish.  The calling thread updates a share of them too.
+        // An exception thrown by a process is swallowed so the rest of the
+        // batch still runs.
+        //
+        // @param elapsedTime The time passed to each process.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void Run(const F32 elapsedTime);
+    };
+
+}
+
+#endif
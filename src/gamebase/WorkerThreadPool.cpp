@@ -0,0 +1,199 @@
+// /////////////////////////////////////////////////////////////////
+// @file WorkerThreadPool.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the implementation of the WorkerThreadPool class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include "WorkerThreadPool.h"
+#include "GameMain.h"
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void GLFWCALL WorkerThreadPool::WorkerThreadMain(void *arg)
+    {
+        WorkerThreadPool *poolPtr = static_cast<WorkerThreadPool *>(arg);
+        if(poolPtr) {
+            poolPtr->RunWorker();
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void WorkerThreadPool::RunWorker()
+    {
+        while(true) {
+            WorkerTaskPtr taskPtr;
+
+            glfwLockMutex(m_mutex);
+            while(m_taskQueue.empty() && !m_shutdown) {
+                glfwWaitCond(m_taskAvailableCond, m_mutex, GLFW_INFINITY);
+            }
+            if(m_taskQueue.empty()) {
+                // Shutdown requested and nothing left to do.
+                glfwUnlockMutex(m_mutex);
+                return;
+            }
+            taskPtr = m_taskQueue.front();
+            m_taskQueue.pop_front();
+            glfwUnlockMutex(m_mutex);
+
+            try {
+                taskPtr->VExecute();
+            } catch(...) {
+                // Tasks report their own errors, never let an exception kill the worker.
+            }
+
+            // Release the task before signalling so its resources are freed when the waiter wakes.
+            taskPtr.reset();
+
+            glfwLockMutex(m_mutex);
+            --m_outstandingTasks;
+            if(m_outstandingTasks == 0) {
+                glfwBroadcastCond(m_tasksDoneCond);
+            }
+            glfwUnlockMutex(m_mutex);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    WorkerThreadPool::WorkerThreadPool(const U32 numberThreads) : m_threads(), m_taskQueue(), m_mutex(NULL), m_taskAvailableCond(NULL), \
+        m_tasksDoneCond(NULL), m_outstandingTasks(0), m_shutdown(false)
+    {
+        m_mutex = glfwCreateMutex();
+        m_taskAvailableCond = glfwCreateCond();
+        m_tasksDoneCond = glfwCreateCond();
+        if(!m_mutex || !m_taskAvailableCond || !m_tasksDoneCond) {
+            GF_LOG_TRACE_ERR("WorkerThreadPool::WorkerThreadPool()", "Failed to create the thread synchronization objects");
+            return;
+        }
+
+        m_threads.reserve(numberThreads);
+        for(U32 i = 0; i < numberThreads; ++i) {
+            GLFWthread tid = glfwCreateThread(WorkerThreadMain, this);
+            if(tid < 0) {
+                GF_LOG_TRACE_ERR("WorkerThreadPool::WorkerThreadPool()", "Failed to create a worker thread");
+                break;
+            }
+            m_threads.push_back(tid);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    WorkerThreadPool::~WorkerThreadPool()
+    {
+        try {
+            if(m_mutex) {
+                WaitForAllTasks();
+
+                glfwLockMutex(m_mutex);
+                m_shutdown = true;
+                glfwBroadcastCond(m_taskAvailableCond);
+                glfwUnlockMutex(m_mutex);
+
+                for(std::vector<GLFWthread>::iterator i = m_threads.begin(), end = m_threads.end(); i != end; ++i) {
+                    glfwWaitThread(*i, GLFW_WAIT);
+                }
+                m_threads.clear();
+            }
+
+            if(m_tasksDoneCond) {
+                glfwDestroyCond(m_tasksDoneCond);
+            }
+            if(m_taskAvailableCond) {
+                glfwDestroyCond(m_taskAvailableCond);
+            }
+            if(m_mutex) {
+                glfwDestroyMutex(m_mutex);
+            }
+        } catch(...) {}
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool WorkerThreadPool::IsValid() const
+    {
+        return (m_mutex != NULL && m_taskAvailableCond != NULL && m_tasksDoneCond != NULL);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool WorkerThreadPool::AddTask(WorkerTaskPtr taskPtr)
+    {
+        if(!taskPtr || !IsValid()) {
+            return (false);
+        }
+
+        // No workers, run the task on the callers thread.
+        if(m_threads.empty()) {
+            taskPtr->VExecute();
+            return (true);
+        }
+
+        glfwLockMutex(m_mutex);
+        if(m_shutdown) {
+            glfwUnlockMutex(m_mutex);
+            return (false);
+        }
+        m_taskQueue.push_back(taskPtr);
+        ++m_outstandingTasks;
+        glfwSignalCond(m_taskAvailableCond);
+        glfwUnlockMutex(m_mutex);
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void WorkerThreadPool::WaitForAllTasks()
+    {
+        if(!IsValid()) {
+            return;
+        }
+
+        glfwLockMutex(m_mutex);
+        while(m_outstandingTasks > 0) {
+            glfwWaitCond(m_tasksDoneCond, m_mutex, GLFW_INFINITY);
+        }
+        glfwUnlockMutex(m_mutex);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 WorkerThreadPool::GetOutstandingTaskCount()
+    {
+        if(!IsValid()) {
+            return (0);
+        }
+
+        glfwLockMutex(m_mutex);
+        U32 count = m_outstandingTasks;
+        glfwUnlockMutex(m_mutex);
+
+        return (count);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 WorkerThreadPool::GetNumberProcessors()
+    {
+        I32 numCpus = glfwGetNumberOfProcessors();
+        return ((numCpus > 0) ? U32(numCpus) : 1);
+    }
+
+}
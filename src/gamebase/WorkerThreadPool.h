@@ -0,0 +1,158 @@
+#pragma once
+#ifndef __GF_WORKER_THREAD_POOL_H
+#define __GF_WORKER_THREAD_POOL_H
+
+// /////////////////////////////////////////////////////////////////
+// @file WorkerThreadPool.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the header for the WorkerThreadPool class which
+// runs independent tasks on a fixed group of background threads.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <vector>
+#include <deque>
+
+#include <boost/shared_ptr.hpp>
+
+#include "GameBase.h"
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    // @class IWorkerTask
+    // @author PJ O Halloran
+    //
+    // Interface for a unit of work which can be executed on one of the
+    // WorkerThreadPool threads.
+    //
+    // Tasks must not call OpenGL, queue events or access the resource
+    // cache as none of those systems are thread safe.  Do any such work
+    // on the main thread before submitting or after waiting on the task.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class IWorkerTask {
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Destructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual ~IWorkerTask() {};
+
+        // /////////////////////////////////////////////////////////////////
+        // Run the task.  Called once from a worker thread.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual void VExecute() = 0;
+    };
+
+    typedef boost::shared_ptr<IWorkerTask> WorkerTaskPtr;
+
+    // /////////////////////////////////////////////////////////////////
+    // @class WorkerThreadPool
+    // @author PJ O Halloran
+    //
+    // A fixed size pool of worker threads which pull tasks from a
+    // shared FIFO queue.  Built on the GLFW thread, mutex and condition
+    // variable API so it works on every platform we link GLFW on.
+    //
+    // A pool created with 0 threads executes each task immediately on
+    // the calling thread inside AddTask().  This is useful for
+    // comparing against the single threaded behaviour.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class WorkerThreadPool : public NonCopyable {
+    private:
+
+        std::vector<GLFWthread> m_threads;              ///< Worker thread IDs.
+        std::deque<WorkerTaskPtr> m_taskQueue;          ///< Tasks waiting for a free worker.
+        GLFWmutex m_mutex;                              ///< Guards the queue, counters and shutdown flag.
+        GLFWcond m_taskAvailableCond;                   ///< Signalled when a task is queued or on shutdown.
+        GLFWcond m_tasksDoneCond;                       ///< Signalled when the last outstanding task completes.
+        U32 m_outstandingTasks;                         ///< Number of queued plus currently running tasks.
+        bool m_shutdown;                                ///< Set to tell the workers to exit.
+
+        // /////////////////////////////////////////////////////////////////
+        // Entry point for each worker thread.
+        //
+        // @param arg Pointer to the owning WorkerThreadPool.
+        //
+        // /////////////////////////////////////////////////////////////////
+        static void GLFWCALL WorkerThreadMain(void *arg);
+
+        // /////////////////////////////////////////////////////////////////
+        // Worker loop, waits for tasks and runs them until shutdown.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void RunWorker();
+
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.  Spawns the worker threads immediately.
+        //
+        // Ensure to check if the pool was created with IsValid() after.
+        //
+        // @param numberThreads The number of worker threads to create.
+        //
+        // /////////////////////////////////////////////////////////////////
+        explicit WorkerThreadPool(const U32 numberThreads);
+
+        // /////////////////////////////////////////////////////////////////
+        // Destructor.  Waits for all outstanding tasks and then joins the
+        // worker threads.
+        //
+        // /////////////////////////////////////////////////////////////////
+        ~WorkerThreadPool();
+
+        // /////////////////////////////////////////////////////////////////
+        // Were the pools' threads and synchronization objects created?
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool IsValid() const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of worker threads in the pool.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetNumberThreads() const {
+            return (U32(m_threads.size()));
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Queue a task to be run on the next free worker.
+        //
+        // @param taskPtr The task to run.
+        //
+        // @return bool False if the task is NULL or the pool is shutting
+        //              down.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool AddTask(WorkerTaskPtr taskPtr);
+
+        // /////////////////////////////////////////////////////////////////
+        // Block the calling thread until every queued task has completed.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void WaitForAllTasks();
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of queued and running tasks.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U32 GetOutstandingTaskCount();
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of processors reported by the OS, a sensible
+        // default thread count for CPU bound work.
+        //
+        // /////////////////////////////////////////////////////////////////
+        static U32 GetNumberProcessors();
+    };
+
+}
+
+#endif
@@ -0,0 +1,241 @@
+// /////////////////////////////////////////////////////////////////
+// @file AtlasDictionary.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Implementation of the binary texture atlas dictionary.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "tinyxml/tinyxml.h"
+
+#include "AtlasDictionary.h"
+#include "HashedString.h"
+#include "ByteOrder.h"
+
+namespace GameHalloran {
+
+    namespace {
+
+        const U8 ATLAS_DICTIONARY_MAGIC[4] = { 'G', 'F', 'A', 'D' };
+        const U32 ATLAS_DICTIONARY_VERSION = 1;
+        const U32 HEADER_SIZE = 20;                             ///< Magic, version, number of atlases and images, size of the names.
+        const U32 ATLAS_RECORD_SIZE = 32;                       ///< 3 name offsets, border, width, height, first image, number of images.
+        const U32 IMAGE_RECORD_SIZE = 32;                       ///< Hash, rectangle, name offset, flags.
+        const U32 IMAGE_FLAG_FLIPPED = 0x1;
+
+        // /////////////////////////////////////////////////////////////////
+        // An image read from an <Image> element.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct ImageEntry {
+            U64 m_hash;
+            U32 m_nameOffset;
+            F32 m_rect[4];
+            bool m_flipped;
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Order images by their hash.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool ImageEntryLess(const ImageEntry &lhs, const ImageEntry &rhs)
+        {
+            return (lhs.m_hash < rhs.m_hash);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Add a string to the name table.
+        //
+        // @return U32 The offset of the string in the table.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U32 AddName(const char *nameStr, std::vector<char> &namesRef)
+        {
+            const U32 offset = U32(namesRef.size());
+            namesRef.insert(namesRef.end(), nameStr, nameStr + strlen(nameStr) + 1);
+            return (offset);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Get a string from the name table.
+        //
+        // @return const char* NULL if the offset is outside the table.
+        //
+        // /////////////////////////////////////////////////////////////////
+        const char *GetName(const char *namesPtr, const U32 namesSize, const U32 offset)
+        {
+            return ((offset < namesSize) ? namesPtr + offset : NULL);
+        }
+
+    }
+
+    // File extension of binary atlas dictionaries.
+    const char * const ATLAS_DICTIONARY_EXTENSION = "atd";
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool EncodeAtlasDictionary(const std::vector<const TiXmlElement *> &atlasElemVec, std::vector<U8> &outRef)
+    {
+        std::vector<char> names;
+        std::vector<U32> atlasRecords;
+        std::vector<ImageEntry> images;
+
+        for(std::vector<const TiXmlElement *>::const_iterator i = atlasElemVec.begin(), end = atlasElemVec.end(); i != end; ++i) {
+            const TiXmlElement *atlasElemPtr = *i;
+            const char *nameStr = atlasElemPtr->Attribute("name");
+            const char *modeStr = atlasElemPtr->Attribute("mode");
+            const char *typeStr = atlasElemPtr->Attribute("type");
+            int border(0), width(0), height(0);
+            if(!nameStr || !modeStr || !typeStr || !atlasElemPtr->Attribute("width", &width) || !atlasElemPtr->Attribute("height", &height) \
+                    || width <= 0 || height <= 0) {
+                return (false);
+            }
+            atlasElemPtr->Attribute("border", &border);
+
+            std::vector<ImageEntry> atlasImages;
+            for(const TiXmlElement *imageElemPtr = atlasElemPtr->FirstChildElement("Image"); imageElemPtr; imageElemPtr = imageElemPtr->NextSiblingElement("Image")) {
+                const char *imageNameStr = imageElemPtr->Attribute("name");
+                double x(0.0), y(0.0), w(0.0), h(0.0);
+                if(!imageNameStr || !imageElemPtr->Attribute("x", &x) || !imageElemPtr->Attribute("y", &y) \
+                        || !imageElemPtr->Attribute("width", &w) || !imageElemPtr->Attribute("height", &h)) {
+                    return (false);
+                }
+                const char *flippedStr = imageElemPtr->Attribute("flipped");
+
+                ImageEntry entry;
+                entry.m_hash = reinterpret_cast<U64>(HashedString::hash_name(imageNameStr));
+                entry.m_nameOffset = AddName(imageNameStr, names);
+                entry.m_rect[0] = F32(x) / width;
+                entry.m_rect[1] = 1.0f - F32(y) / height;
+                entry.m_rect[2] = F32(w) / width;
+                entry.m_rect[3] = F32(h) / height;
+                entry.m_flipped = (flippedStr && strcmp(flippedStr, "True") == 0);
+                atlasImages.push_back(entry);
+            }
+
+            // Sort by hash, keeping the last of the images with the same hash.
+            std::stable_sort(atlasImages.begin(), atlasImages.end(), ImageEntryLess);
+            const U32 firstImage = U32(images.size());
+            for(size_t j = 0; j < atlasImages.size(); ++j) {
+                if(j + 1 == atlasImages.size() || atlasImages[j].m_hash != atlasImages[j + 1].m_hash) {
+                    images.push_back(atlasImages[j]);
+                }
+            }
+
+            atlasRecords.push_back(AddName(nameStr, names));
+            atlasRecords.push_back(AddName(modeStr, names));
+            atlasRecords.push_back(AddName(typeStr, names));
+            atlasRecords.push_back(U32(border));
+            atlasRecords.push_back(U32(width));
+            atlasRecords.push_back(U32(height));
+            atlasRecords.push_back(firstImage);
+            atlasRecords.push_back(U32(images.size()) - firstImage);
+        }
+
+        const U32 numberAtlases = U32(atlasElemVec.size());
+        outRef.resize(HEADER_SIZE + numberAtlases * ATLAS_RECORD_SIZE + images.size() * IMAGE_RECORD_SIZE + names.size());
+        U8 *outPtr = &outRef[0];
+        memcpy(outPtr, ATLAS_DICTIONARY_MAGIC, 4);
+        WriteU32(outPtr + 4, ATLAS_DICTIONARY_VERSION);
+        WriteU32(outPtr + 8, numberAtlases);
+        WriteU32(outPtr + 12, U32(images.size()));
+        WriteU32(outPtr + 16, U32(names.size()));
+        outPtr += HEADER_SIZE;
+
+        for(std::vector<U32>::const_iterator i = atlasRecords.begin(), end = atlasRecords.end(); i != end; ++i, outPtr += 4) {
+            WriteU32(outPtr, *i);
+        }
+
+        for(std::vector<ImageEntry>::const_iterator i = images.begin(), end = images.end(); i != end; ++i, outPtr += IMAGE_RECORD_SIZE) {
+            WriteU64(outPtr, i->m_hash);
+            for(U32 j = 0; j < 4; ++j) {
+                WriteF32(outPtr + 8 + j * 4, i->m_rect[j]);
+            }
+            WriteU32(outPtr + 24, i->m_nameOffset);
+            WriteU32(outPtr + 28, i->m_flipped ? IMAGE_FLAG_FLIPPED : 0);
+        }
+
+        if(!names.empty()) {
+            memcpy(outPtr, &names[0], names.size());
+        }
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ParseAtlasDictionary(const U8 *dataPtr, const size_t length, std::vector<AtlasDictionaryAtlas> &atlasesRef, \
+                              std::vector<AtlasDictionaryImage> &imagesRef)
+    {
+        atlasesRef.clear();
+        imagesRef.clear();
+        if(dataPtr == NULL || length < HEADER_SIZE || memcmp(dataPtr, ATLAS_DICTIONARY_MAGIC, 4) != 0 \
+                || ReadU32(dataPtr + 4) != ATLAS_DICTIONARY_VERSION) {
+            return (false);
+        }
+
+        // Sizes are checked as 64 bit values so a corrupt count cannot wrap.
+        const U32 numberAtlases = ReadU32(dataPtr + 8);
+        const U32 numberImages = ReadU32(dataPtr + 12);
+        const U32 namesSize = ReadU32(dataPtr + 16);
+        const U64 imagesOffset = HEADER_SIZE + U64(numberAtlases) * ATLAS_RECORD_SIZE;
+        const U64 namesOffset = imagesOffset + U64(numberImages) * IMAGE_RECORD_SIZE;
+        if(namesOffset + namesSize != length || (namesSize != 0 && dataPtr[length - 1] != '\0')) {
+            return (false);
+        }
+        const char *namesPtr = reinterpret_cast<const char *>(dataPtr + namesOffset);
+
+        imagesRef.resize(numberImages);
+        const U8 *inPtr = dataPtr + imagesOffset;
+        for(U32 i = 0; i < numberImages; ++i, inPtr += IMAGE_RECORD_SIZE) {
+            AtlasDictionaryImage &imageRef = imagesRef[i];
+            imageRef.m_hash = ReadU64(inPtr);
+            imageRef.m_x = ReadF32(inPtr + 8);
+            imageRef.m_y = ReadF32(inPtr + 12);
+            imageRef.m_width = ReadF32(inPtr + 16);
+            imageRef.m_height = ReadF32(inPtr + 20);
+            imageRef.m_name = GetName(namesPtr, namesSize, ReadU32(inPtr + 24));
+            imageRef.m_flipped = ((ReadU32(inPtr + 28) & IMAGE_FLAG_FLIPPED) != 0);
+
+            // The lookups trust the hash, so it must be the hash of the name.
+            if(!imageRef.m_name || reinterpret_cast<U64>(HashedString::hash_name(imageRef.m_name)) != imageRef.m_hash) {
+                return (false);
+            }
+        }
+
+        atlasesRef.resize(numberAtlases);
+        inPtr = dataPtr + HEADER_SIZE;
+        for(U32 i = 0; i < numberAtlases; ++i, inPtr += ATLAS_RECORD_SIZE) {
+            AtlasDictionaryAtlas &atlasRef = atlasesRef[i];
+            atlasRef.m_name = GetName(namesPtr, namesSize, ReadU32(inPtr));
+            atlasRef.m_mode = GetName(namesPtr, namesSize, ReadU32(inPtr + 4));
+            atlasRef.m_type = GetName(namesPtr, namesSize, ReadU32(inPtr + 8));
+            atlasRef.m_border = ReadU32(inPtr + 12);
+            atlasRef.m_width = ReadU32(inPtr + 16);
+            atlasRef.m_height = ReadU32(inPtr + 20);
+            atlasRef.m_firstImage = ReadU32(inPtr + 24);
+            atlasRef.m_numberImages = ReadU32(inPtr + 28);
+            if(!atlasRef.m_name || !atlasRef.m_mode || !atlasRef.m_type \
+                    || U64(atlasRef.m_firstImage) + atlasRef.m_numberImages > numberImages) {
+                return (false);
+            }
+
+            // Lookups binary search the images, so they must be in order.
+            for(U32 j = atlasRef.m_firstImage + 1; j < atlasRef.m_firstImage + atlasRef.m_numberImages; ++j) {
+                if(imagesRef[j - 1].m_hash >= imagesRef[j].m_hash) {
+                    return (false);
+                }
+            }
+        }
+
+        return (true);
+    }
+
+}
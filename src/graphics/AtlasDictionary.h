@@ -0,0 +1,103 @@
+#pragma once
+#ifndef __GF_ATLAS_DICTIONARY_H
+#define __GF_ATLAS_DICTIONARY_H
+
+// /////////////////////////////////////////////////////////////////
+// @file AtlasDictionary.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header for the binary texture atlas dictionary (.atd), a compact
+// form of the atlas xml read with a single resource read and no xml
+// parsing.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <vector>
+
+#include "GameBase.h"
+
+class TiXmlElement;
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    // @struct AtlasDictionaryAtlas
+    // @author PJ O Halloran
+    //
+    // An atlas in a binary dictionary.  The strings point into the
+    // dictionary data and are only valid while it is.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct AtlasDictionaryAtlas {
+        const char *m_name;                     ///< The name of the atlas.
+        const char *m_mode;                     ///< The image mode ("RGBA" or "RGB").
+        const char *m_type;                     ///< The image file type extension ("tga").
+        U32 m_border;                           ///< Texels of border around each image.
+        U32 m_width;                            ///< Width of the atlas.
+        U32 m_height;                           ///< Height of the atlas.
+        U32 m_firstImage;                       ///< Index of the atlas's first image.
+        U32 m_numberImages;                     ///< Number of images in the atlas.
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @struct AtlasDictionaryImage
+    // @author PJ O Halloran
+    //
+    // An image in a binary dictionary.  The rectangle is in texture
+    // coordinates, as held by an AtlasImage: m_y is the top edge of
+    // the image measured up from the bottom of the atlas.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct AtlasDictionaryImage {
+        U64 m_hash;                             ///< HashedString hash of the name.
+        const char *m_name;                     ///< The name of the image.
+        F32 m_x;                                ///< Left edge of the image.
+        F32 m_y;                                ///< Top edge of the image.
+        F32 m_width;                            ///< Width of the image.
+        F32 m_height;                           ///< Height of the image.
+        bool m_flipped;                         ///< Is the image rotated 90 degrees?
+    };
+
+    // File extension of binary atlas dictionaries.
+    extern const char * const ATLAS_DICTIONARY_EXTENSION;
+
+    // /////////////////////////////////////////////////////////////////
+    // Convert <Atlas> elements (as written by the atlasc build tool) to
+    // a binary dictionary.
+    //
+    // The dictionary is a header, a record per atlas, a record per
+    // image and a table of the names.  The images of each atlas are
+    // stored sorted by their hash so they can be binary searched; of
+    // images with the same hash only the last is kept, as when the xml
+    // was read into a map.  All the values are stored little endian.
+    //
+    // @param atlasElemVec The <Atlas> elements.
+    // @param outRef Output dictionary.
+    //
+    // @return bool False if an element is missing a required attribute.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool EncodeAtlasDictionary(const std::vector<const TiXmlElement *> &atlasElemVec, std::vector<U8> &outRef);
+
+    // /////////////////////////////////////////////////////////////////
+    // Read a binary dictionary without copying its strings.  The images
+    // of atlas a are imagesRef[a.m_firstImage] onwards, sorted by hash.
+    //
+    // @param dataPtr The dictionary.
+    // @param length Size of the dictionary in bytes.
+    // @param atlasesRef Output atlases.
+    // @param imagesRef Output images.
+    //
+    // @return bool False if the data is not a valid dictionary,
+    //              including when an image's hash is not the hash of
+    //              its name.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ParseAtlasDictionary(const U8 *dataPtr, const size_t length, std::vector<AtlasDictionaryAtlas> &atlasesRef, \
+                              std::vector<AtlasDictionaryImage> &imagesRef);
+
+}
+
+#endif
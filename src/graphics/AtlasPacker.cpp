@@ -0,0 +1,634 @@
+// /////////////////////////////////////////////////////////////////
+// @file AtlasPacker.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Implementation of the AtlasPacker class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+#include <boost/algorithm/string/case_conv.hpp>
+
+#include "tinyxml/tinyxml.h"
+
+#include "AtlasPacker.h"
+
+namespace GameHalloran {
+
+    namespace {
+
+        // Global array of packing method names.
+        const char * const gAtlasPackingMethodNames[] = {
+            "maxrects",
+            "skyline"
+        };
+
+        const U32 NUMBER_WIDTH_STEPS = 16;              ///< Widths tried between the square root of the total area and twice it (no power of two).
+        const U32 NUMBER_MAX_RECTS_WIDTHS = 3;          ///< Widths packed with MaxRects, chosen by a skyline pack of every width.
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct Rect
+        //
+        // A rectangle in texels, y pointing down.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct Rect {
+            U32 m_x;
+            U32 m_y;
+            U32 m_w;
+            U32 m_h;
+
+            Rect(const U32 x = 0, const U32 y = 0, const U32 w = 0, const U32 h = 0) : m_x(x), m_y(y), m_w(w), m_h(h) {};
+
+            bool Contains(const Rect &otherRef) const {
+                return (otherRef.m_x >= m_x && otherRef.m_y >= m_y && otherRef.m_x + otherRef.m_w <= m_x + m_w && otherRef.m_y + otherRef.m_h <= m_y + m_h);
+            };
+
+            bool Intersects(const Rect &otherRef) const {
+                return (otherRef.m_x < m_x + m_w && m_x < otherRef.m_x + otherRef.m_w && otherRef.m_y < m_y + m_h && m_y < otherRef.m_y + otherRef.m_h);
+            };
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct Placement
+        //
+        // Where an item (an image plus its border) was put.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct Placement {
+            U32 m_x;
+            U32 m_y;
+            bool m_flipped;
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct Layout
+        //
+        // The result of packing every item into a bin of a given width.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct Layout {
+            std::vector<Placement> m_placements;        ///< Indexed as the images.
+            U32 m_usedWidth;                            ///< Right edge of the rightmost item.
+            U32 m_usedHeight;                           ///< Bottom edge of the lowest item.
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct Item
+        //
+        // An image plus its border, in packing order.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct Item {
+            U32 m_index;
+            U32 m_w;
+            U32 m_h;
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Sort the largest items first, they are the hardest to fit.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool PackFirst(const Item &lhsRef, const Item &rhsRef)
+        {
+            const U32 lhsMax = std::max(lhsRef.m_w, lhsRef.m_h), rhsMax = std::max(rhsRef.m_w, rhsRef.m_h);
+            if(lhsMax != rhsMax) {
+                return (lhsMax > rhsMax);
+            }
+            const U32 lhsArea = lhsRef.m_w * lhsRef.m_h, rhsArea = rhsRef.m_w * rhsRef.m_h;
+            if(lhsArea != rhsArea) {
+                return (lhsArea > rhsArea);
+            }
+            return (lhsRef.m_index < rhsRef.m_index);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Round up to a power of two.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U32 NextPowerOfTwo(const U32 value)
+        {
+            U32 result = 1;
+            while(result < value) {
+                result <<= 1;
+            }
+            return (result);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Is the first placement score (bottom edge, then left edge)
+        // better than the second?
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline bool IsLower(const U32 bottom, const U32 x, const U32 bestBottom, const U32 bestX)
+        {
+            return (bottom < bestBottom || (bottom == bestBottom && x < bestX));
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // @class MaxRectsBin
+        //
+        // Keeps every maximal rectangle of free space.  Each item goes in
+        // the free rectangle where its bottom edge is highest, which lets
+        // small items fill the holes left beside large ones.
+        //
+        // /////////////////////////////////////////////////////////////////
+        class MaxRectsBin {
+        private:
+
+            std::vector<Rect> m_free;
+
+            // Split every free rectangle overlapping usedRef into the
+            // free rectangles left around it.
+            void SplitFree(const Rect &usedRef) {
+                const size_t numberFree = m_free.size();
+                for(size_t i = 0; i < numberFree; ++i) {
+                    const Rect freeRect = m_free[i];
+                    if(!freeRect.Intersects(usedRef)) {
+                        continue;
+                    }
+                    if(usedRef.m_x > freeRect.m_x) {
+                        m_free.push_back(Rect(freeRect.m_x, freeRect.m_y, usedRef.m_x - freeRect.m_x, freeRect.m_h));
+                    }
+                    if(usedRef.m_x + usedRef.m_w < freeRect.m_x + freeRect.m_w) {
+                        m_free.push_back(Rect(usedRef.m_x + usedRef.m_w, freeRect.m_y, freeRect.m_x + freeRect.m_w - usedRef.m_x - usedRef.m_w, freeRect.m_h));
+                    }
+                    if(usedRef.m_y > freeRect.m_y) {
+                        m_free.push_back(Rect(freeRect.m_x, freeRect.m_y, freeRect.m_w, usedRef.m_y - freeRect.m_y));
+                    }
+                    if(usedRef.m_y + usedRef.m_h < freeRect.m_y + freeRect.m_h) {
+                        m_free.push_back(Rect(freeRect.m_x, usedRef.m_y + usedRef.m_h, freeRect.m_w, freeRect.m_y + freeRect.m_h - usedRef.m_y - usedRef.m_h));
+                    }
+                    m_free[i].m_w = 0;
+                }
+
+                // Drop the split rectangles and any new rectangle contained
+                // in another.  The untouched rectangles were already
+                // maximal and cannot lie inside a piece of a split one.
+                size_t count = 0;
+                for(size_t i = 0; i < numberFree; ++i) {
+                    if(m_free[i].m_w != 0) {
+                        m_free[count++] = m_free[i];
+                    }
+                }
+                for(size_t i = numberFree; i < m_free.size(); ++i) {
+                    bool contained = false;
+                    for(size_t j = 0; j < m_free.size() && !contained; ++j) {
+                        // Of two equal new rectangles keep the first.
+                        contained = (j != i && m_free[j].m_w != 0 && m_free[j].Contains(m_free[i]) && \
+                                     !(j > i && m_free[i].Contains(m_free[j])));
+                    }
+                    if(contained) {
+                        m_free[i].m_w = 0;
+                    }
+                }
+                for(size_t i = numberFree; i < m_free.size(); ++i) {
+                    if(m_free[i].m_w != 0) {
+                        m_free[count++] = m_free[i];
+                    }
+                }
+                m_free.resize(count);
+            };
+
+        public:
+
+            MaxRectsBin(const U32 width, const U32 height) : m_free(1, Rect(0, 0, width, height)) {};
+
+            bool Insert(const U32 width, const U32 height, const bool allowRotation, Placement &placementRef) {
+                U32 bestBottom = ~0u, bestX = ~0u;
+                for(size_t i = 0; i < m_free.size(); ++i) {
+                    const Rect &freeRef = m_free[i];
+                    if(width <= freeRef.m_w && height <= freeRef.m_h && IsLower(freeRef.m_y + height, freeRef.m_x, bestBottom, bestX)) {
+                        bestBottom = freeRef.m_y + height;
+                        bestX = freeRef.m_x;
+                        placementRef.m_x = freeRef.m_x;
+                        placementRef.m_y = freeRef.m_y;
+                        placementRef.m_flipped = false;
+                    }
+                    if(allowRotation && height <= freeRef.m_w && width <= freeRef.m_h && IsLower(freeRef.m_y + width, freeRef.m_x, bestBottom, bestX)) {
+                        bestBottom = freeRef.m_y + width;
+                        bestX = freeRef.m_x;
+                        placementRef.m_x = freeRef.m_x;
+                        placementRef.m_y = freeRef.m_y;
+                        placementRef.m_flipped = true;
+                    }
+                }
+                if(bestBottom == ~0u) {
+                    return (false);
+                }
+
+                SplitFree(placementRef.m_flipped ? Rect(placementRef.m_x, placementRef.m_y, height, width) : Rect(placementRef.m_x, placementRef.m_y, width, height));
+                return (true);
+            };
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // @class SkylineBin
+        //
+        // Keeps the bottom edge of the packed items as a list of
+        // horizontal segments.  Each item goes where its bottom edge is
+        // highest, resting on the segments below it.  Space under an
+        // overhang is lost.
+        //
+        // /////////////////////////////////////////////////////////////////
+        class SkylineBin {
+        private:
+
+            struct Segment {
+                U32 m_x;
+                U32 m_y;
+                U32 m_w;
+            };
+
+            U32 m_width;
+            U32 m_height;
+            std::vector<Segment> m_segments;
+
+            // Can an item of the given width rest with its left edge on
+            // segment index?  If so get the top edge it would have.
+            bool Fit(const size_t index, const U32 width, const U32 height, U32 &yRef) const {
+                if(m_segments[index].m_x + width > m_width) {
+                    return (false);
+                }
+                yRef = 0;
+                U32 remaining = width;
+                for(size_t i = index; remaining > 0; ++i) {
+                    yRef = std::max(yRef, m_segments[i].m_y);
+                    if(yRef + height > m_height) {
+                        return (false);
+                    }
+                    remaining -= std::min(remaining, m_segments[i].m_w);
+                }
+                return (true);
+            };
+
+        public:
+
+            SkylineBin(const U32 width, const U32 height) : m_width(width), m_height(height), m_segments() {
+                const Segment floor = { 0, 0, width };
+                m_segments.push_back(floor);
+            };
+
+            bool Insert(const U32 width, const U32 height, const bool allowRotation, Placement &placementRef) {
+                U32 bestBottom = ~0u, bestX = ~0u, y = 0;
+                size_t bestIndex = 0;
+                for(size_t i = 0; i < m_segments.size(); ++i) {
+                    if(Fit(i, width, height, y) && IsLower(y + height, m_segments[i].m_x, bestBottom, bestX)) {
+                        bestBottom = y + height;
+                        bestX = m_segments[i].m_x;
+                        bestIndex = i;
+                        placementRef.m_x = bestX;
+                        placementRef.m_y = y;
+                        placementRef.m_flipped = false;
+                    }
+                    if(allowRotation && Fit(i, height, width, y) && IsLower(y + width, m_segments[i].m_x, bestBottom, bestX)) {
+                        bestBottom = y + width;
+                        bestX = m_segments[i].m_x;
+                        bestIndex = i;
+                        placementRef.m_x = bestX;
+                        placementRef.m_y = y;
+                        placementRef.m_flipped = true;
+                    }
+                }
+                if(bestBottom == ~0u) {
+                    return (false);
+                }
+
+                // Raise the skyline under the item.
+                const U32 itemWidth = placementRef.m_flipped ? height : width;
+                const Segment top = { placementRef.m_x, bestBottom, itemWidth };
+                m_segments.insert(m_segments.begin() + bestIndex, top);
+                const U32 right = top.m_x + top.m_w;
+                size_t i = bestIndex + 1;
+                while(i < m_segments.size() && m_segments[i].m_x < right) {
+                    const U32 segmentRight = m_segments[i].m_x + m_segments[i].m_w;
+                    if(segmentRight <= right) {
+                        m_segments.erase(m_segments.begin() + i);
+                    } else {
+                        m_segments[i].m_w = segmentRight - right;
+                        m_segments[i].m_x = right;
+                        break;
+                    }
+                }
+
+                // Merge neighbours at the same height.
+                for(size_t j = 0; j + 1 < m_segments.size();) {
+                    if(m_segments[j].m_y == m_segments[j + 1].m_y) {
+                        m_segments[j].m_w += m_segments[j + 1].m_w;
+                        m_segments.erase(m_segments.begin() + j + 1);
+                    } else {
+                        ++j;
+                    }
+                }
+                return (true);
+            };
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Pack every item into a bin of the given width.
+        //
+        // /////////////////////////////////////////////////////////////////
+        template <class Bin>
+        bool PackItems(const std::vector<Item> &itemsRef, const U32 binWidth, const U32 binHeight, const bool allowRotation, Layout &layoutRef)
+        {
+            Bin bin(binWidth, binHeight);
+            layoutRef.m_usedWidth = layoutRef.m_usedHeight = 0;
+            for(std::vector<Item>::const_iterator i = itemsRef.begin(), end = itemsRef.end(); i != end; ++i) {
+                Placement &placementRef = layoutRef.m_placements[i->m_index];
+                if(!bin.Insert(i->m_w, i->m_h, allowRotation, placementRef)) {
+                    return (false);
+                }
+                layoutRef.m_usedWidth = std::max(layoutRef.m_usedWidth, placementRef.m_x + (placementRef.m_flipped ? i->m_h : i->m_w));
+                layoutRef.m_usedHeight = std::max(layoutRef.m_usedHeight, placementRef.m_y + (placementRef.m_flipped ? i->m_w : i->m_h));
+            }
+            return (true);
+        }
+
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the size of the atlas holding a layout.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U64 GetAtlasSize(const Layout &layoutRef, const bool powerOfTwo, U32 &widthRef, U32 &heightRef)
+        {
+            widthRef = powerOfTwo ? NextPowerOfTwo(layoutRef.m_usedWidth) : layoutRef.m_usedWidth;
+            heightRef = powerOfTwo ? NextPowerOfTwo(layoutRef.m_usedHeight) : layoutRef.m_usedHeight;
+            return (U64(widthRef) * U64(heightRef));
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Pack every item into bins of each width and keep the layout
+        // needing the smallest atlas (the squarest of equal size).
+        //
+        // @return U64 The area of the best atlas, ~0 if none fit.
+        //
+        // /////////////////////////////////////////////////////////////////
+        template <class Bin>
+        U64 PackSmallest(const std::vector<Item> &itemsRef, const std::vector<U32> &widthsRef, const U32 maxSize, const U32 narrowest, \
+                         const F64 totalArea, const AtlasPackerOptions &optionsRef, Layout &bestRef, U32 &bestWidthRef, U32 &bestHeightRef)
+        {
+            Layout layout;
+            layout.m_placements.resize(itemsRef.size());
+            U64 bestArea = ~U64(0);
+            for(std::vector<U32>::const_iterator i = widthsRef.begin(), end = widthsRef.end(); i != end; ++i) {
+                // Skip this width if it cannot beat the best atlas found and
+                // otherwise give up as soon as it grows taller than needed.
+                if(U64(*i) * U64(std::max(narrowest, U32(totalArea / *i))) > bestArea) {
+                    continue;
+                }
+                const U32 binHeight = U32(std::min(U64(maxSize), bestArea / *i));
+                if(!PackItems<Bin>(itemsRef, *i, binHeight, optionsRef.m_allowRotation, layout)) {
+                    continue;
+                }
+
+                U32 width, height;
+                const U64 area = GetAtlasSize(layout, optionsRef.m_powerOfTwo, width, height);
+                if(area < bestArea || (area == bestArea && std::max(width, height) < std::max(bestWidthRef, bestHeightRef))) {
+                    bestArea = area;
+                    bestWidthRef = width;
+                    bestHeightRef = height;
+                    bestRef.m_placements.swap(layout.m_placements);
+                    layout.m_placements.resize(itemsRef.size());
+                }
+            }
+            return (bestArea);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    const char *FindStringFromAtlasPackingMethod(const AtlasPackingMethod method)
+    {
+        if(method < ATLAS_PACKING_FIRST || method >= ATLAS_PACKING_COUNT) {
+            return ("");
+        }
+
+        return (gAtlasPackingMethodNames[method]);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    AtlasPackingMethod FindAtlasPackingMethodFromString(const std::string &methodRef)
+    {
+        const std::string lower(boost::algorithm::to_lower_copy(methodRef));
+        for(U32 i = ATLAS_PACKING_FIRST; i < ATLAS_PACKING_COUNT; ++i) {
+            if(lower == gAtlasPackingMethodNames[i]) {
+                return (AtlasPackingMethod(i));
+            }
+        }
+
+        return (ATLAS_PACKING_UNKNOWN);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    AtlasPacker::AtlasPacker(const AtlasPackerOptions &optionsRef)
+        : m_options(optionsRef)
+        , m_images()
+        , m_width(0)
+        , m_height(0)
+        , m_packed(false)
+    {
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void AtlasPacker::Clear()
+    {
+        m_images.clear();
+        m_width = m_height = 0;
+        m_packed = false;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 AtlasPacker::AddImage(const std::string &nameRef, const U32 width, const U32 height)
+    {
+        AtlasPackedImage image;
+        image.m_name = nameRef;
+        image.m_width = width;
+        image.m_height = height;
+        image.m_x = image.m_y = 0;
+        image.m_flipped = false;
+        m_images.push_back(image);
+        m_packed = false;
+        return (U32(m_images.size() - 1));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool AtlasPacker::Pack()
+    {
+        m_packed = false;
+        m_width = m_height = 0;
+        if(m_images.empty()) {
+            return (false);
+        }
+
+        const U32 padding = m_options.m_border * 2;
+        const U32 maxSize = m_options.m_maxSize;
+        std::vector<Item> items(m_images.size());
+        U32 narrowest = 1;
+        F64 totalArea = 0.0;
+        for(size_t i = 0; i < m_images.size(); ++i) {
+            items[i].m_index = U32(i);
+            items[i].m_w = m_images[i].m_width + padding;
+            items[i].m_h = m_images[i].m_height + padding;
+            if(m_images[i].m_width == 0 || m_images[i].m_height == 0) {
+                return (false);
+            }
+            narrowest = std::max(narrowest, m_options.m_allowRotation ? std::min(items[i].m_w, items[i].m_h) : items[i].m_w);
+            totalArea += F64(items[i].m_w) * F64(items[i].m_h);
+        }
+        if(narrowest > maxSize) {
+            return (false);
+        }
+        std::sort(items.begin(), items.end(), PackFirst);
+
+        // The widths to try.  Each is packed as tall as needed and the
+        // smallest atlas wins.
+        std::vector<U32> widths;
+        if(m_options.m_powerOfTwo) {
+            for(U32 w = NextPowerOfTwo(narrowest); w <= maxSize; w <<= 1) {
+                widths.push_back(w);
+            }
+        } else {
+            const U32 start = std::max(narrowest, U32(std::sqrt(totalArea)));
+            for(U32 step = 0; step <= NUMBER_WIDTH_STEPS; ++step) {
+                const U32 w = start + U32(F64(start) * step / NUMBER_WIDTH_STEPS);
+                if(w > maxSize) {
+                    break;
+                }
+                widths.push_back(w);
+            }
+            if(widths.empty() || widths.back() < maxSize) {
+                widths.push_back(maxSize);
+            }
+        }
+
+        // MaxRects is much slower than skyline, so it only packs the
+        // widths where a skyline pack needed the smallest atlases.
+        if(m_options.m_method == ATLAS_PACKING_MAX_RECTS && widths.size() > NUMBER_MAX_RECTS_WIDTHS) {
+            std::vector< std::pair<U64, U32> > rankedWidths;
+            Layout layout;
+            layout.m_placements.resize(m_images.size());
+            for(std::vector<U32>::const_iterator i = widths.begin(), end = widths.end(); i != end; ++i) {
+                U32 width, height;
+                if(PackItems<SkylineBin>(items, *i, maxSize, m_options.m_allowRotation, layout)) {
+                    rankedWidths.push_back(std::make_pair(GetAtlasSize(layout, m_options.m_powerOfTwo, width, height), *i));
+                }
+            }
+            if(!rankedWidths.empty()) {
+                std::sort(rankedWidths.begin(), rankedWidths.end());
+                widths.clear();
+                for(size_t i = 0; i < rankedWidths.size() && i < NUMBER_MAX_RECTS_WIDTHS; ++i) {
+                    widths.push_back(rankedWidths[i].second);
+                }
+                std::sort(widths.begin(), widths.end());
+            }
+        }
+
+        Layout best;
+        U32 bestWidth = 0, bestHeight = 0;
+        const U64 bestArea = (m_options.m_method == ATLAS_PACKING_SKYLINE) ?
+            PackSmallest<SkylineBin>(items, widths, maxSize, narrowest, totalArea, m_options, best, bestWidth, bestHeight) :
+            PackSmallest<MaxRectsBin>(items, widths, maxSize, narrowest, totalArea, m_options, best, bestWidth, bestHeight);
+        if(bestArea == ~U64(0)) {
+            return (false);
+        }
+
+        for(size_t i = 0; i < m_images.size(); ++i) {
+            m_images[i].m_x = best.m_placements[i].m_x + m_options.m_border;
+            m_images[i].m_y = best.m_placements[i].m_y + m_options.m_border;
+            m_images[i].m_flipped = best.m_placements[i].m_flipped;
+        }
+        m_width = bestWidth;
+        m_height = bestHeight;
+        m_packed = true;
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    F32 AtlasPacker::GetOccupancy() const
+    {
+        if(!m_packed || m_width == 0 || m_height == 0) {
+            return (0.0f);
+        }
+
+        F64 used = 0.0;
+        for(std::vector<AtlasPackedImage>::const_iterator i = m_images.begin(), end = m_images.end(); i != end; ++i) {
+            used += F64(i->m_width) * F64(i->m_height);
+        }
+        return (F32(used / (F64(m_width) * F64(m_height))));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void AtlasPacker::CopyImage(const U32 index, const U8 *rgbaPtr, U8 *atlasPtr) const
+    {
+        assert(m_packed && index < m_images.size() && rgbaPtr && atlasPtr);
+
+        const AtlasPackedImage &imageRef = m_images[index];
+        const I32 border = I32(m_options.m_border);
+        const I32 srcWidth = I32(imageRef.m_width), srcHeight = I32(imageRef.m_height);
+        const I32 dstWidth = imageRef.m_flipped ? srcHeight : srcWidth;
+        const I32 dstHeight = imageRef.m_flipped ? srcWidth : srcHeight;
+
+        // dx and dy run top down across the image and its border, the
+        // border repeating the nearest edge texel.
+        for(I32 dy = -border; dy < dstHeight + border; ++dy) {
+            const I32 cy = std::min(std::max(dy, 0), dstHeight - 1);
+            const U32 atlasRow = m_height - 1 - U32(I32(imageRef.m_y) + dy);
+            U32 *dstPtr = reinterpret_cast<U32 *>(atlasPtr) + atlasRow * m_width + U32(I32(imageRef.m_x) - border);
+            for(I32 dx = -border; dx < dstWidth + border; ++dx) {
+                const I32 cx = std::min(std::max(dx, 0), dstWidth - 1);
+                // Rotated clockwise the image's left column becomes the
+                // atlas region's top row.
+                const U32 srcTexel = imageRef.m_flipped ? U32(cx * srcWidth + cy) : U32((srcHeight - 1 - cy) * srcWidth + cx);
+                memcpy(dstPtr++, rgbaPtr + srcTexel * 4, 4);
+            }
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    TiXmlElement *AtlasPacker::CreateXmlElement(const std::string &nameRef, const std::string &modeRef, const std::string &typeRef) const
+    {
+        TiXmlElement *atlasElemPtr = new TiXmlElement("Atlas");
+        atlasElemPtr->SetAttribute("border", I32(m_options.m_border));
+        atlasElemPtr->SetAttribute("height", I32(m_height));
+        atlasElemPtr->SetAttribute("mode", modeRef.c_str());
+        atlasElemPtr->SetAttribute("name", nameRef.c_str());
+        atlasElemPtr->SetAttribute("type", typeRef.c_str());
+        atlasElemPtr->SetAttribute("width", I32(m_width));
+
+        for(std::vector<AtlasPackedImage>::const_iterator i = m_images.begin(), end = m_images.end(); i != end; ++i) {
+            TiXmlElement *imageElemPtr = new TiXmlElement("Image");
+            imageElemPtr->SetAttribute("flipped", i->m_flipped ? "True" : "False");
+            imageElemPtr->SetAttribute("height", I32(i->m_height));
+            imageElemPtr->SetAttribute("name", i->m_name.c_str());
+            imageElemPtr->SetAttribute("width", I32(i->m_width));
+            imageElemPtr->SetAttribute("x", I32(i->m_x));
+            imageElemPtr->SetAttribute("y", I32(i->m_y));
+            atlasElemPtr->LinkEndChild(imageElemPtr);
+        }
+
+        return (atlasElemPtr);
+    }
+
+}
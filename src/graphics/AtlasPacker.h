@@ -0,0 +1,243 @@
+#pragma once
+#ifndef __GF_ATLAS_PACKER_H
+#define __GF_ATLAS_PACKER_H
+
+// /////////////////////////////////////////////////////////////////
+// @file AtlasPacker.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header for the AtlasPacker class which packs images into a texture
+// atlas and describes the atlas with the xml schema the
+// TextureAtlasManager reads.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "GameBase.h"
+
+class TiXmlElement;
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    // @enum AtlasPackingMethod
+    // @author PJ O Halloran
+    //
+    // The algorithms for placing images in an atlas.
+    // - ATLAS_PACKING_MAX_RECTS    Tracks every maximal free rectangle
+    //                              so small images fill the holes left
+    //                              beside large ones.  Densest.
+    // - ATLAS_PACKING_SKYLINE      Tracks only the outline of the packed
+    //                              images.  Fastest.
+    // Both place each image as near the top left as they can.
+    //
+    // /////////////////////////////////////////////////////////////////
+    enum AtlasPackingMethod {
+        ATLAS_PACKING_FIRST,
+        ATLAS_PACKING_MAX_RECTS = ATLAS_PACKING_FIRST,
+        ATLAS_PACKING_SKYLINE,
+        ATLAS_PACKING_COUNT,
+        ATLAS_PACKING_UNKNOWN
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Convert a packing method to a string ("maxrects" or "skyline").
+    //
+    // /////////////////////////////////////////////////////////////////
+    const char *FindStringFromAtlasPackingMethod(const AtlasPackingMethod method);
+
+    // /////////////////////////////////////////////////////////////////
+    // Convert a string ("maxrects" or "skyline", any case) to a packing
+    // method.
+    //
+    // @return AtlasPackingMethod ATLAS_PACKING_UNKNOWN if not recognized.
+    //
+    // /////////////////////////////////////////////////////////////////
+    AtlasPackingMethod FindAtlasPackingMethodFromString(const std::string &methodRef);
+
+    // /////////////////////////////////////////////////////////////////
+    // @struct AtlasPackerOptions
+    // @author PJ O Halloran
+    //
+    // How an AtlasPacker lays out an atlas.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct AtlasPackerOptions {
+        AtlasPackingMethod m_method;            ///< The placement algorithm.
+        bool m_allowRotation;                   ///< May images be rotated 90 degrees to fit better?
+        U32 m_border;                           ///< Texels of border around each image (2 * m_border between images).
+        bool m_powerOfTwo;                      ///< Round the atlas width and height up to powers of two?
+        U32 m_maxSize;                          ///< Largest atlas width and height.
+
+        // /////////////////////////////////////////////////////////////////
+        // Default to the layout of the shipped atlases (1 texel border,
+        // power of two, no rotation as the GUI does not rotate texture
+        // coordinates).
+        //
+        // /////////////////////////////////////////////////////////////////
+        AtlasPackerOptions() : m_method(ATLAS_PACKING_MAX_RECTS), m_allowRotation(false), m_border(1), m_powerOfTwo(true), m_maxSize(4096) {};
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @struct AtlasPackedImage
+    // @author PJ O Halloran
+    //
+    // Where an image was placed in an atlas.  Coordinates are in texels
+    // from the top left corner of the atlas, as in the atlas xml.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct AtlasPackedImage {
+        std::string m_name;                     ///< The name of the image.
+        U32 m_width;                            ///< Width of the image.
+        U32 m_height;                           ///< Height of the image.
+        U32 m_x;                                ///< Left edge of the image in the atlas.
+        U32 m_y;                                ///< Top edge of the image in the atlas.
+        bool m_flipped;                         ///< Rotated 90 degrees clockwise, covering m_height by m_width texels?
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @class AtlasPacker
+    // @author PJ O Halloran
+    //
+    // Packs a set of images into as small an atlas as it can.  Used by
+    // the atlasc build tool and at runtime by the TextureAtlasManager to
+    // build atlases from images loaded on demand.
+    //
+    // Usage:
+    //  AddImage() each image, Pack(), then CopyImage() each image's
+    //  texels into a GetWidth() by GetHeight() RGBA buffer and describe
+    //  the atlas with CreateXmlElement().
+    //
+    // /////////////////////////////////////////////////////////////////
+    class AtlasPacker : public NonCopyable {
+    private:
+
+        AtlasPackerOptions m_options;           ///< How to lay out the atlas.
+        std::vector<AtlasPackedImage> m_images; ///< The images in the order they were added.
+        U32 m_width;                            ///< Width of the packed atlas.
+        U32 m_height;                           ///< Height of the packed atlas.
+        bool m_packed;                          ///< Have the images been packed?
+
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        explicit AtlasPacker(const AtlasPackerOptions &optionsRef = AtlasPackerOptions());
+
+        // /////////////////////////////////////////////////////////////////
+        // Remove all the images.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void Clear();
+
+        // /////////////////////////////////////////////////////////////////
+        // Add an image to be packed.
+        //
+        // @return U32 The index of the image.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U32 AddImage(const std::string &nameRef, const U32 width, const U32 height);
+
+        // /////////////////////////////////////////////////////////////////
+        // Place every image.  Tries a range of atlas widths and keeps the
+        // layout with the smallest area.
+        //
+        // @return bool False if the images do not fit in an atlas of
+        //              m_maxSize by m_maxSize texels (or there are none).
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool Pack();
+
+        // /////////////////////////////////////////////////////////////////
+        // Have the images been packed?
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline bool IsPacked() const {
+            return (m_packed);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the width of the packed atlas.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetWidth() const {
+            return (m_width);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the height of the packed atlas.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetHeight() const {
+            return (m_height);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the options.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline const AtlasPackerOptions &GetOptions() const {
+            return (m_options);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of images.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetNumberImages() const {
+            return (U32(m_images.size()));
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get an image by its index.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline const AtlasPackedImage &GetImage(const U32 index) const {
+            return (m_images[index]);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the fraction of the atlas covered by images (borders
+        // excluded).
+        //
+        // /////////////////////////////////////////////////////////////////
+        F32 GetOccupancy() const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Copy a packed image into the atlas, rotating it if it is
+        // flipped and repeating its edge texels into its border so
+        // filtering does not bleed in neighbouring images.
+        //
+        // Both buffers hold 8 bit RGBA rows bottom up, as they are
+        // uploaded into OpenGL and stored in TGA files.
+        //
+        // @param index The index of the image.
+        // @param rgbaPtr The image's texels.
+        // @param atlasPtr The atlas, GetWidth() * GetHeight() * 4 bytes.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void CopyImage(const U32 index, const U8 *rgbaPtr, U8 *atlasPtr) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Describe the packed atlas as an <Atlas> element holding an
+        // <Image> element for each image.
+        //
+        // @param nameRef The name of the atlas.
+        // @param modeRef The image mode ("RGBA" or "RGB").
+        // @param typeRef The image file type extension ("tga").
+        //
+        // @return TiXmlElement* A new element owned by the caller.
+        //
+        // /////////////////////////////////////////////////////////////////
+        TiXmlElement *CreateXmlElement(const std::string &nameRef, const std::string &modeRef, const std::string &typeRef) const;
+
+    };
+
+}
+
+#endif
@@ -0,0 +1,105 @@
+#pragma once
+#ifndef __GF_BYTE_ORDER_H
+#define __GF_BYTE_ORDER_H
+
+// /////////////////////////////////////////////////////////////////
+// @file ByteOrder.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Little endian readers and writers for the binary files the tools
+// write and the game loads (BCT textures, atlas dictionaries and
+// shader archives), so they are the same on every platform.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <cstring>
+
+#include "GameBase.h"
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    // Write a U16 as 2 little endian bytes.
+    //
+    // /////////////////////////////////////////////////////////////////
+    inline void WriteU16(U8 *outPtr, const U16 value)
+    {
+        outPtr[0] = U8(value & 0xFF);
+        outPtr[1] = U8(value >> 8);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Read a U16 from 2 little endian bytes.
+    //
+    // /////////////////////////////////////////////////////////////////
+    inline U16 ReadU16(const U8 *inPtr)
+    {
+        return (U16(inPtr[0] | (inPtr[1] << 8)));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Write a U32 as 4 little endian bytes.
+    //
+    // /////////////////////////////////////////////////////////////////
+    inline void WriteU32(U8 *outPtr, const U32 value)
+    {
+        for(U32 i = 0; i < 4; ++i) {
+            outPtr[i] = U8((value >> (i * 8)) & 0xFF);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Read a U32 from 4 little endian bytes.
+    //
+    // /////////////////////////////////////////////////////////////////
+    inline U32 ReadU32(const U8 *inPtr)
+    {
+        return (U32(inPtr[0]) | (U32(inPtr[1]) << 8) | (U32(inPtr[2]) << 16) | (U32(inPtr[3]) << 24));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Write a U64 as 8 little endian bytes.
+    //
+    // /////////////////////////////////////////////////////////////////
+    inline void WriteU64(U8 *outPtr, const U64 value)
+    {
+        WriteU32(outPtr, U32(value & 0xFFFFFFFF));
+        WriteU32(outPtr + 4, U32(value >> 32));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Read a U64 from 8 little endian bytes.
+    //
+    // /////////////////////////////////////////////////////////////////
+    inline U64 ReadU64(const U8 *inPtr)
+    {
+        return (U64(ReadU32(inPtr)) | (U64(ReadU32(inPtr + 4)) << 32));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Write the bits of an F32 as 4 little endian bytes.
+    //
+    // /////////////////////////////////////////////////////////////////
+    inline void WriteF32(U8 *outPtr, const F32 value)
+    {
+        U32 bits;
+        memcpy(&bits, &value, 4);
+        WriteU32(outPtr, bits);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Read the bits of an F32 from 4 little endian bytes.
+    //
+    // /////////////////////////////////////////////////////////////////
+    inline F32 ReadF32(const U8 *inPtr)
+    {
+        const U32 bits = ReadU32(inPtr);
+        F32 value;
+        memcpy(&value, &bits, 4);
+        return (value);
+    }
+
+}
+
+#endif
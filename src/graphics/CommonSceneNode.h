@@ -52,6 +52,7 @@
 
 #include "Matrix.h"
 #include "ISceneNode.h"
+#include "PoolObject.h"
 
 namespace GameHalloran {
 
@@ -89,9 +90,11 @@ namespace GameHalloran {
     // @author Mike McShaffry & PJ O Halloran.
     //
     // A list of scene nodes that need to be drawn in the alpha pass.
+    // Created every frame so allocated from the games small object
+    // pool.
     //
     // /////////////////////////////////////////////////////////////////
-    class AlphaSceneNode {
+    class AlphaSceneNode : public PoolObject {
     private:
 
         boost::shared_ptr<ISceneNode> m_node;           ///< Pointer to the node.
@@ -0,0 +1,1490 @@
+// /////////////////////////////////////////////////////////////////
+// @file GLRecorder.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Implementation of the headless recording OpenGL backend.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstring>
+
+#include "GLRecorder.h"
+
+namespace GameHalloran {
+
+    namespace {
+
+        // Values returned for the implementation limits queried by the framework.
+        const GLint RECORDER_MAX_TEXTURE_UNITS = 16;
+        const GLint RECORDER_MAX_TEXTURE_SIZE = 4096;
+        const GLint RECORDER_MAX_VERTEX_ATTRIBS = 16;
+        const GLint RECORDER_MAX_UNIFORM_BUFFER_BINDINGS = 36;
+        const GLint RECORDER_UNIFORM_BUFFER_OFFSET_ALIGNMENT = 256;
+
+        // The one program binary format and the binary handed out for every program.
+        const GLenum RECORDER_PROGRAM_BINARY_FORMAT = 0x6766;
+        const char RECORDER_PROGRAM_BINARY[] = "GLRecorder program binary";
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of bytes in a pixel of client data.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U64 GetPixelSize(const GLenum format, const GLenum type)
+        {
+            U64 components(4);
+            switch(format) {
+                case GL_RED:
+                case GL_ALPHA:
+                case GL_LUMINANCE:
+                case GL_DEPTH_COMPONENT:
+                    components = 1;
+                    break;
+                case GL_RG:
+                case GL_LUMINANCE_ALPHA:
+                    components = 2;
+                    break;
+                case GL_RGB:
+                case GL_BGR:
+                    components = 3;
+                    break;
+                default:
+                    break;
+            }
+
+            switch(type) {
+                case GL_SHORT:
+                case GL_UNSIGNED_SHORT:
+                case GL_HALF_FLOAT:
+                    return (components * 2);
+                case GL_INT:
+                case GL_UNSIGNED_INT:
+                case GL_FLOAT:
+                    return (components * 4);
+                case GL_UNSIGNED_SHORT_5_6_5:
+                case GL_UNSIGNED_SHORT_4_4_4_4:
+                case GL_UNSIGNED_SHORT_5_5_5_1:
+                    return (2);
+                default:
+                    return (components);
+            }
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Record a call and get the recorder.
+        //
+        // /////////////////////////////////////////////////////////////////
+        GLRecorder &Record(const char *nameStr)
+        {
+            GLRecorder &recorder = GLRecorder::GetGlobalInstance();
+            recorder.RecordCall(nameStr);
+            return (recorder);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Record a call which creates objects.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void GenObjects(const char *nameStr, const GLsizei n, GLuint *namesPtr)
+        {
+            GLRecorder &recorder = Record(nameStr);
+            for(GLsizei i = 0; i < n; ++i) {
+                namesPtr[i] = recorder.CreateObject();
+            }
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Record a call which deletes objects.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void DeleteObjects(const char *nameStr, const GLsizei n, const GLuint *namesPtr)
+        {
+            GLRecorder &recorder = Record(nameStr);
+            for(GLsizei i = 0; i < n; ++i) {
+                recorder.DeleteObject(namesPtr[i]);
+            }
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Record a state change.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void ChangeState(const char *nameStr, const GLRecorder::StateCategory category, const U64 key, const U64 value)
+        {
+            Record(nameStr).SetState(category, key, value);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Record a query.
+        //
+        // /////////////////////////////////////////////////////////////////
+        GLRecorder &Query(const char *nameStr)
+        {
+            GLRecorder &recorder = Record(nameStr);
+            ++recorder.GetMutableStats().m_queries;
+            return (recorder);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Record setting a uniform of the current program.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void SetUniform(const char *nameStr, const GLint location, const void *valuePtr, const size_t size)
+        {
+            GLRecorder &recorder = Record(nameStr);
+            ++recorder.GetMutableStats().m_uniformUploads;
+            const U64 program = recorder.GetState(GLRecorder::eUseProgram, 0, 0);
+            recorder.SetState(GLRecorder::eUniform, (program << 32) | U32(location), HashGLRecorderData(valuePtr, size));
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Record uploading texels.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void UploadTexels(const char *nameStr, const U64 size)
+        {
+            GLRecorder &recorder = Record(nameStr);
+            recorder.GetMutableStats().m_textureBytesUploaded += size;
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Record a draw call.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void Draw(const char *nameStr, const GLsizei count)
+        {
+            GLRecorderStats &statsRef = Record(nameStr).GetMutableStats();
+            ++statsRef.m_drawCalls;
+            statsRef.m_verticesDrawn += U64(count);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Copy a string into a client buffer as glGet*InfoLog() does.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void CopyInfoLog(const char *logStr, const GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+        {
+            GLsizei copied(0);
+            if(infoLog && bufSize > 0) {
+                copied = std::min(GLsizei(strlen(logStr)), bufSize - 1);
+                memcpy(infoLog, logStr, copied);
+                infoLog[copied] = '\0';
+            }
+            if(length) {
+                *length = copied;
+            }
+        }
+
+#ifndef USE_NEW_GLFW
+        // Size and bits of the headless window's desktop.
+        const int HEADLESS_DESKTOP_WIDTH = 1920;
+        const int HEADLESS_DESKTOP_HEIGHT = 1080;
+        const int HEADLESS_DEFAULT_WIDTH = 640;
+        const int HEADLESS_DEFAULT_HEIGHT = 480;
+        const int HEADLESS_COLOR_BITS = 8;
+        const int HEADLESS_DEPTH_BITS = 24;
+        const int HEADLESS_STENCIL_BITS = 8;
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct HeadlessWindow
+        //
+        // The state of the window the headless window functions pretend
+        // to open.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct HeadlessWindow {
+            bool m_opened;                          ///< Has the window been opened?
+            bool m_iconified;                       ///< Is the window iconified?
+            int m_width;                            ///< Width of the window.
+            int m_height;                           ///< Height of the window.
+            std::map<int, int> m_hints;             ///< Hints for the next window opened.
+            std::map<int, int> m_params;            ///< Parameters of the open window, by GLFW token.
+            GLFWwindowsizefun m_sizeFun;            ///< Window size callback.
+
+            HeadlessWindow() : m_opened(false), m_iconified(false), m_width(0), m_height(0), m_hints(), m_params(), m_sizeFun(NULL) {};
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the headless window.
+        //
+        // /////////////////////////////////////////////////////////////////
+        HeadlessWindow &GetHeadlessWindow()
+        {
+            static HeadlessWindow window;
+            return (window);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Get a hint for the next window, or its default.
+        //
+        // /////////////////////////////////////////////////////////////////
+        int GetHeadlessHint(const int target, const int defaultValue)
+        {
+            const std::map<int, int> &hints = GetHeadlessWindow().m_hints;
+            std::map<int, int>::const_iterator i = hints.find(target);
+            return ((i != hints.end() && i->second != 0) ? i->second : defaultValue);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Fill in the video mode of the headless window's desktop.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void GetHeadlessDesktopMode(GLFWvidmode &mode)
+        {
+            mode.Width = HEADLESS_DESKTOP_WIDTH;
+            mode.Height = HEADLESS_DESKTOP_HEIGHT;
+            mode.RedBits = HEADLESS_COLOR_BITS;
+            mode.GreenBits = HEADLESS_COLOR_BITS;
+            mode.BlueBits = HEADLESS_COLOR_BITS;
+        }
+#endif
+
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    U64 HashGLRecorderData(const void *dataPtr, const size_t size)
+    {
+        // 64 bit FNV-1a.
+        U64 hash = 14695981039346656037ULL;
+        const U8 *bytePtr = static_cast<const U8 *>(dataPtr);
+        for(size_t i = 0; i < size; ++i) {
+            hash = (hash ^ bytePtr[i]) * 1099511628211ULL;
+        }
+        return (hash);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    GLRecorder::GLRecorder()
+        : m_stats()
+        , m_lastFrameStats()
+        , m_numberFrames(0)
+        , m_callLogEnabled(false)
+        , m_callLog()
+        , m_nextName(1)
+        , m_objects()
+        , m_state()
+        , m_bufferData()
+        , m_uniformLocations()
+        , m_nextUniformLocation(0)
+        , m_unlinkedPrograms()
+    {
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    GLRecorder &GLRecorder::GetGlobalInstance()
+    {
+        static GLRecorder gRecorder;
+        return (gRecorder);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void GLRecorder::Reset()
+    {
+        m_stats = GLRecorderStats();
+        m_lastFrameStats = GLRecorderStats();
+        m_numberFrames = 0;
+        m_callLog.clear();
+        m_nextName = 1;
+        m_objects.clear();
+        m_state.clear();
+        m_bufferData.clear();
+        m_uniformLocations.clear();
+        m_nextUniformLocation = 0;
+        m_unlinkedPrograms.clear();
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void GLRecorder::EndFrame()
+    {
+        m_lastFrameStats = m_stats;
+        m_stats = GLRecorderStats();
+        ++m_numberFrames;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void GLRecorder::RecordCall(const char *nameStr)
+    {
+        ++m_stats.m_calls;
+        if(m_callLogEnabled) {
+            m_callLog.push_back(nameStr);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool GLRecorder::SetState(const StateCategory category, const U64 key, const U64 value)
+    {
+        ++m_stats.m_stateChanges;
+
+        std::pair<StateMap::iterator, bool> result = m_state.insert(StateMap::value_type(StateKey(U32(category), key), value));
+        if(!result.second) {
+            if(result.first->second == value) {
+                ++m_stats.m_redundantStateChanges;
+                return (false);
+            }
+            result.first->second = value;
+        }
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    U64 GLRecorder::GetState(const StateCategory category, const U64 key, const U64 defaultValue) const
+    {
+        StateMap::const_iterator i = m_state.find(StateKey(U32(category), key));
+        return ((i == m_state.end()) ? defaultValue : i->second);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    GLuint GLRecorder::CreateObject()
+    {
+        ++m_stats.m_objectsCreated;
+        m_objects.insert(m_nextName);
+        return (m_nextName++);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void GLRecorder::DeleteObject(const GLuint name)
+    {
+        if(m_objects.erase(name) != 0) {
+            ++m_stats.m_objectsDeleted;
+            m_bufferData.erase(name);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    std::vector<U8> &GLRecorder::GetBufferData(const GLuint name)
+    {
+        return (m_bufferData[name]);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    GLint GLRecorder::GetUniformLocation(const GLuint program, const std::string &name)
+    {
+        std::pair<UniformLocationMap::iterator, bool> result = m_uniformLocations.insert( \
+                UniformLocationMap::value_type(std::make_pair(program, name), m_nextUniformLocation));
+        if(result.second) {
+            ++m_nextUniformLocation;
+        }
+        return (result.first->second);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void GLRecorder::SetProgramLinked(const GLuint program, const bool linked)
+    {
+        if(linked) {
+            m_unlinkedPrograms.erase(program);
+        } else {
+            m_unlinkedPrograms.insert(program);
+        }
+    }
+
+}
+
+using namespace GameHalloran;
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecActiveTexture(GLenum texture)
+{
+    ChangeState("glActiveTexture", GLRecorder::eActiveTexture, 0, texture);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecAttachShader(GLuint, GLuint)
+{
+    Record("glAttachShader");
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecBindAttribLocation(GLuint, GLuint, const GLchar *)
+{
+    Record("glBindAttribLocation");
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecBindBuffer(GLenum target, GLuint buffer)
+{
+    GLRecorder &recorder = Record("glBindBuffer");
+    ++recorder.GetMutableStats().m_bufferBinds;
+    recorder.SetState(GLRecorder::eBindBuffer, target, buffer);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecBindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+    GLRecorder &recorder = Record("glBindBufferBase");
+    ++recorder.GetMutableStats().m_bufferBinds;
+    recorder.SetState(GLRecorder::eBindBufferBase, (U64(index) << 32) | target, buffer);
+
+    // Binding an indexed target binds the generic target also.
+    if(recorder.GetState(GLRecorder::eBindBuffer, target, 0) != buffer) {
+        recorder.SetState(GLRecorder::eBindBuffer, target, buffer);
+    }
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecBindTexture(GLenum target, GLuint texture)
+{
+    GLRecorder &recorder = Record("glBindTexture");
+    ++recorder.GetMutableStats().m_textureBinds;
+    const U64 unit = recorder.GetState(GLRecorder::eActiveTexture, 0, GL_TEXTURE0);
+    recorder.SetState(GLRecorder::eBindTexture, (unit << 32) | target, texture);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecBindVertexArray(GLuint array)
+{
+    GLRecorder &recorder = Record("glBindVertexArray");
+    ++recorder.GetMutableStats().m_bufferBinds;
+    recorder.SetState(GLRecorder::eBindVertexArray, 0, array);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecBlendFunc(GLenum sfactor, GLenum dfactor)
+{
+    ChangeState("glBlendFunc", GLRecorder::eBlendFunc, 0, (U64(sfactor) << 32) | dfactor);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecBufferData(GLenum target, GLsizeiptr size, const GLvoid *data, GLenum)
+{
+    GLRecorder &recorder = Record("glBufferData");
+    const GLuint buffer = GLuint(recorder.GetState(GLRecorder::eBindBuffer, target, 0));
+    std::vector<U8> &dataRef = recorder.GetBufferData(buffer);
+    dataRef.assign(size_t(size), 0);
+    if(data && size > 0) {
+        memcpy(&dataRef[0], data, size_t(size));
+        recorder.GetMutableStats().m_bufferBytesUploaded += U64(size);
+    }
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid *data)
+{
+    GLRecorder &recorder = Record("glBufferSubData");
+    const GLuint buffer = GLuint(recorder.GetState(GLRecorder::eBindBuffer, target, 0));
+    std::vector<U8> &dataRef = recorder.GetBufferData(buffer);
+    if(data && size > 0 && size_t(offset + size) <= dataRef.size()) {
+        memcpy(&dataRef[offset], data, size_t(size));
+    }
+    recorder.GetMutableStats().m_bufferBytesUploaded += U64(size);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+GLenum GLAPIENTRY GfRecCheckFramebufferStatus(GLenum)
+{
+    Query("glCheckFramebufferStatus");
+    return (GL_FRAMEBUFFER_COMPLETE);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecClear(GLbitfield)
+{
+    Record("glClear");
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
+{
+    const GLclampf color[4] = { red, green, blue, alpha };
+    ChangeState("glClearColor", GLRecorder::eClearColor, 0, HashGLRecorderData(color, sizeof(color)));
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecCompileShader(GLuint)
+{
+    Record("glCompileShader");
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecCompressedTexImage2D(GLenum, GLint, GLenum, GLsizei, GLsizei, GLint, GLsizei imageSize, const GLvoid *)
+{
+    UploadTexels("glCompressedTexImage2D", U64(imageSize));
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+GLuint GLAPIENTRY GfRecCreateProgram(void)
+{
+    return (Record("glCreateProgram").CreateObject());
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+GLuint GLAPIENTRY GfRecCreateShader(GLenum)
+{
+    return (Record("glCreateShader").CreateObject());
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecCullFace(GLenum mode)
+{
+    ChangeState("glCullFace", GLRecorder::eCullFace, 0, mode);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecDeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+    DeleteObjects("glDeleteBuffers", n, buffers);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecDeleteProgram(GLuint program)
+{
+    DeleteObjects("glDeleteProgram", 1, &program);
+    GLRecorder::GetGlobalInstance().SetProgramLinked(program, true);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecDeleteShader(GLuint shader)
+{
+    DeleteObjects("glDeleteShader", 1, &shader);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecDeleteTextures(GLsizei n, const GLuint *textures)
+{
+    DeleteObjects("glDeleteTextures", n, textures);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecDeleteVertexArrays(GLsizei n, const GLuint *arrays)
+{
+    DeleteObjects("glDeleteVertexArrays", n, arrays);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecDisable(GLenum cap)
+{
+    ChangeState("glDisable", GLRecorder::eCapability, cap, GL_FALSE);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecDisableVertexAttribArray(GLuint)
+{
+    ++Record("glDisableVertexAttribArray").GetMutableStats().m_stateChanges;
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecDrawArrays(GLenum, GLint, GLsizei count)
+{
+    Draw("glDrawArrays", count);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecDrawBuffers(GLsizei n, const GLenum *bufs)
+{
+    ChangeState("glDrawBuffers", GLRecorder::eDrawBuffers, 0, HashGLRecorderData(bufs, n * sizeof(GLenum)));
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecDrawElements(GLenum, GLsizei count, GLenum, const GLvoid *)
+{
+    Draw("glDrawElements", count);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecEnable(GLenum cap)
+{
+    ChangeState("glEnable", GLRecorder::eCapability, cap, GL_TRUE);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecEnableVertexAttribArray(GLuint)
+{
+    ++Record("glEnableVertexAttribArray").GetMutableStats().m_stateChanges;
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecFinish(void)
+{
+    Record("glFinish");
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecFrontFace(GLenum mode)
+{
+    ChangeState("glFrontFace", GLRecorder::eFrontFace, 0, mode);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecGenBuffers(GLsizei n, GLuint *buffers)
+{
+    GenObjects("glGenBuffers", n, buffers);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecGenerateMipmap(GLenum)
+{
+    Record("glGenerateMipmap");
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecGenTextures(GLsizei n, GLuint *textures)
+{
+    GenObjects("glGenTextures", n, textures);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecGenVertexArrays(GLsizei n, GLuint *arrays)
+{
+    GenObjects("glGenVertexArrays", n, arrays);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+GLenum GLAPIENTRY GfRecGetError(void)
+{
+    Query("glGetError");
+    return (GL_NO_ERROR);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecGetFloatv(GLenum, GLfloat *params)
+{
+    Query("glGetFloatv");
+    *params = 0.0f;
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecGetIntegerv(GLenum pname, GLint *params)
+{
+    GLRecorder &recorder = Query("glGetIntegerv");
+    switch(pname) {
+        case GL_ACTIVE_TEXTURE:
+            *params = GLint(recorder.GetState(GLRecorder::eActiveTexture, 0, GL_TEXTURE0));
+            break;
+        case GL_CURRENT_PROGRAM:
+            *params = GLint(recorder.GetState(GLRecorder::eUseProgram, 0, 0));
+            break;
+        case GL_PACK_ALIGNMENT:
+        case GL_UNPACK_ALIGNMENT:
+            *params = GLint(recorder.GetState(GLRecorder::ePixelStore, pname, 4));
+            break;
+        case GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS:
+        case GL_MAX_TEXTURE_IMAGE_UNITS:
+        case GL_MAX_TEXTURE_UNITS:
+            *params = RECORDER_MAX_TEXTURE_UNITS;
+            break;
+        case GL_MAX_TEXTURE_SIZE:
+        case GL_MAX_CUBE_MAP_TEXTURE_SIZE:
+            *params = RECORDER_MAX_TEXTURE_SIZE;
+            break;
+        case GL_MAX_VERTEX_ATTRIBS:
+            *params = RECORDER_MAX_VERTEX_ATTRIBS;
+            break;
+        case GL_MAX_UNIFORM_BUFFER_BINDINGS:
+            *params = RECORDER_MAX_UNIFORM_BUFFER_BINDINGS;
+            break;
+        case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT:
+            *params = RECORDER_UNIFORM_BUFFER_OFFSET_ALIGNMENT;
+            break;
+        case GL_NUM_PROGRAM_BINARY_FORMATS:
+            *params = 1;
+            break;
+        case GL_PROGRAM_BINARY_FORMATS:
+            *params = GLint(RECORDER_PROGRAM_BINARY_FORMAT);
+            break;
+        case GL_MAJOR_VERSION:
+            *params = 3;
+            break;
+        case GL_MINOR_VERSION:
+            *params = 2;
+            break;
+        default:
+            *params = 0;
+            break;
+    }
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecGetProgramBinary(GLuint, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, GLvoid *binary)
+{
+    Query("glGetProgramBinary");
+    const GLsizei copied = std::min(GLsizei(sizeof(RECORDER_PROGRAM_BINARY)), bufSize);
+    if(binary && copied > 0) {
+        memcpy(binary, RECORDER_PROGRAM_BINARY, copied);
+    }
+    if(length) {
+        *length = copied;
+    }
+    if(binaryFormat) {
+        *binaryFormat = RECORDER_PROGRAM_BINARY_FORMAT;
+    }
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecGetProgramInfoLog(GLuint, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    Query("glGetProgramInfoLog");
+    CopyInfoLog("", bufSize, length, infoLog);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecGetProgramiv(GLuint program, GLenum pname, GLint *param)
+{
+    GLRecorder &recorder = Query("glGetProgramiv");
+    switch(pname) {
+        case GL_LINK_STATUS:
+            *param = recorder.IsProgramLinked(program) ? GL_TRUE : GL_FALSE;
+            break;
+        case GL_VALIDATE_STATUS:
+            *param = GL_TRUE;
+            break;
+        case GL_PROGRAM_BINARY_LENGTH:
+            *param = GLint(sizeof(RECORDER_PROGRAM_BINARY));
+            break;
+        default:
+            *param = 0;
+            break;
+    }
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecGetShaderInfoLog(GLuint, GLsizei bufSize, GLsizei *length, GLchar *infoLog)
+{
+    Query("glGetShaderInfoLog");
+    CopyInfoLog("", bufSize, length, infoLog);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecGetShaderiv(GLuint, GLenum pname, GLint *param)
+{
+    Query("glGetShaderiv");
+    *param = (pname == GL_COMPILE_STATUS) ? GL_TRUE : 0;
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+const GLubyte *GLAPIENTRY GfRecGetString(GLenum name)
+{
+    Query("glGetString");
+    switch(name) {
+        case GL_VENDOR:
+            return (reinterpret_cast<const GLubyte *>("GameFramework"));
+        case GL_RENDERER:
+            return (reinterpret_cast<const GLubyte *>("GLRecorder"));
+        case GL_VERSION:
+            return (reinterpret_cast<const GLubyte *>("3.2 GLRecorder"));
+        case GL_SHADING_LANGUAGE_VERSION:
+            return (reinterpret_cast<const GLubyte *>("1.50"));
+        default:
+            return (reinterpret_cast<const GLubyte *>(""));
+    }
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+const GLubyte *GLAPIENTRY GfRecGetStringi(GLenum, GLuint)
+{
+    Query("glGetStringi");
+    return (reinterpret_cast<const GLubyte *>(""));
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+GLuint GLAPIENTRY GfRecGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName)
+{
+    // Block indices are handed out as uniform locations are.
+    return (GLuint(Query("glGetUniformBlockIndex").GetUniformLocation(program, std::string("block:") + uniformBlockName)));
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+GLint GLAPIENTRY GfRecGetUniformLocation(GLuint program, const GLchar *name)
+{
+    return (Query("glGetUniformLocation").GetUniformLocation(program, name));
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecHint(GLenum target, GLenum mode)
+{
+    ChangeState("glHint", GLRecorder::eHint, target, mode);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+GLboolean GLAPIENTRY GfRecIsBuffer(GLuint buffer)
+{
+    return (Query("glIsBuffer").IsObject(buffer) ? GL_TRUE : GL_FALSE);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+GLboolean GLAPIENTRY GfRecIsProgram(GLuint program)
+{
+    return (Query("glIsProgram").IsObject(program) ? GL_TRUE : GL_FALSE);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+GLboolean GLAPIENTRY GfRecIsTexture(GLuint texture)
+{
+    return (Query("glIsTexture").IsObject(texture) ? GL_TRUE : GL_FALSE);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+GLboolean GLAPIENTRY GfRecIsVertexArray(GLuint array)
+{
+    return (Query("glIsVertexArray").IsObject(array) ? GL_TRUE : GL_FALSE);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecLinkProgram(GLuint program)
+{
+    Record("glLinkProgram").SetProgramLinked(program, true);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecLoadIdentity(void)
+{
+    Record("glLoadIdentity");
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecLoadMatrixf(const GLfloat *)
+{
+    Record("glLoadMatrixf");
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+GLvoid *GLAPIENTRY GfRecMapBuffer(GLenum target, GLenum)
+{
+    GLRecorder &recorder = Record("glMapBuffer");
+    const GLuint buffer = GLuint(recorder.GetState(GLRecorder::eBindBuffer, target, 0));
+    std::vector<U8> &dataRef = recorder.GetBufferData(buffer);
+    return (dataRef.empty() ? NULL : &dataRef[0]);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecMatrixMode(GLenum mode)
+{
+    ChangeState("glMatrixMode", GLRecorder::eMatrixMode, 0, mode);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecPixelStorei(GLenum pname, GLint param)
+{
+    ChangeState("glPixelStorei", GLRecorder::ePixelStore, pname, U64(param));
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecPolygonMode(GLenum face, GLenum mode)
+{
+    ChangeState("glPolygonMode", GLRecorder::ePolygonMode, face, mode);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecProgramBinary(GLuint program, GLenum binaryFormat, const GLvoid *binary, GLsizei length)
+{
+    const bool known = (binaryFormat == RECORDER_PROGRAM_BINARY_FORMAT) && (length == GLsizei(sizeof(RECORDER_PROGRAM_BINARY))) && \
+                       binary && (memcmp(binary, RECORDER_PROGRAM_BINARY, sizeof(RECORDER_PROGRAM_BINARY)) == 0);
+    Record("glProgramBinary").SetProgramLinked(program, known);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecProgramParameteri(GLuint, GLenum, GLint)
+{
+    Record("glProgramParameteri");
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecReadBuffer(GLenum mode)
+{
+    ChangeState("glReadBuffer", GLRecorder::eReadBuffer, 0, mode);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecReadPixels(GLint, GLint, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid *pixels)
+{
+    Query("glReadPixels");
+    if(pixels && width > 0 && height > 0) {
+        memset(pixels, 0, size_t(U64(width) * height * GetPixelSize(format, type)));
+    }
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecShaderSource(GLuint, GLsizei, const GLchar **, const GLint *)
+{
+    Record("glShaderSource");
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecTexImage1D(GLenum, GLint, GLint, GLsizei width, GLint, GLenum format, GLenum type, const GLvoid *pixels)
+{
+    UploadTexels("glTexImage1D", pixels ? U64(width) * GetPixelSize(format, type) : 0);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecTexImage2D(GLenum, GLint, GLint, GLsizei width, GLsizei height, GLint, GLenum format, GLenum type, const GLvoid *pixels)
+{
+    UploadTexels("glTexImage2D", pixels ? U64(width) * height * GetPixelSize(format, type) : 0);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecTexParameterf(GLenum, GLenum, GLfloat)
+{
+    ++Record("glTexParameterf").GetMutableStats().m_stateChanges;
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecTexParameteri(GLenum, GLenum, GLint)
+{
+    ++Record("glTexParameteri").GetMutableStats().m_stateChanges;
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecUniform1f(GLint location, GLfloat v0)
+{
+    SetUniform("glUniform1f", location, &v0, sizeof(v0));
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecUniform1fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    SetUniform("glUniform1fv", location, value, count * sizeof(GLfloat));
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecUniform1i(GLint location, GLint v0)
+{
+    SetUniform("glUniform1i", location, &v0, sizeof(v0));
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecUniform1iv(GLint location, GLsizei count, const GLint *value)
+{
+    SetUniform("glUniform1iv", location, value, count * sizeof(GLint));
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecUniform2fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    SetUniform("glUniform2fv", location, value, count * 2 * sizeof(GLfloat));
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecUniform2iv(GLint location, GLsizei count, const GLint *value)
+{
+    SetUniform("glUniform2iv", location, value, count * 2 * sizeof(GLint));
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecUniform3fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    SetUniform("glUniform3fv", location, value, count * 3 * sizeof(GLfloat));
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecUniform3iv(GLint location, GLsizei count, const GLint *value)
+{
+    SetUniform("glUniform3iv", location, value, count * 3 * sizeof(GLint));
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecUniform4fv(GLint location, GLsizei count, const GLfloat *value)
+{
+    SetUniform("glUniform4fv", location, value, count * 4 * sizeof(GLfloat));
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecUniform4iv(GLint location, GLsizei count, const GLint *value)
+{
+    SetUniform("glUniform4iv", location, value, count * 4 * sizeof(GLint));
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+{
+    ChangeState("glUniformBlockBinding", GLRecorder::eUniformBlockBinding, (U64(program) << 32) | uniformBlockIndex, uniformBlockBinding);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecUniformMatrix3fv(GLint location, GLsizei count, GLboolean, const GLfloat *value)
+{
+    SetUniform("glUniformMatrix3fv", location, value, count * 9 * sizeof(GLfloat));
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecUniformMatrix4fv(GLint location, GLsizei count, GLboolean, const GLfloat *value)
+{
+    SetUniform("glUniformMatrix4fv", location, value, count * 16 * sizeof(GLfloat));
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+GLboolean GLAPIENTRY GfRecUnmapBuffer(GLenum target)
+{
+    // The whole buffer counts as uploaded as what was written is not known.
+    GLRecorder &recorder = Record("glUnmapBuffer");
+    const GLuint buffer = GLuint(recorder.GetState(GLRecorder::eBindBuffer, target, 0));
+    recorder.GetMutableStats().m_bufferBytesUploaded += recorder.GetBufferData(buffer).size();
+    return (GL_TRUE);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecUseProgram(GLuint program)
+{
+    GLRecorder &recorder = Record("glUseProgram");
+    ++recorder.GetMutableStats().m_programBinds;
+    recorder.SetState(GLRecorder::eUseProgram, 0, program);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecValidateProgram(GLuint)
+{
+    Record("glValidateProgram");
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecVertexAttribPointer(GLuint, GLint, GLenum, GLboolean, GLsizei, const GLvoid *)
+{
+    ++Record("glVertexAttribPointer").GetMutableStats().m_stateChanges;
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    const GLint viewport[4] = { x, y, width, height };
+    ChangeState("glViewport", GLRecorder::eViewport, 0, HashGLRecorderData(viewport, sizeof(viewport)));
+}
+
+#ifndef USE_NEW_GLFW
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+int GLFWAPIENTRY GfRecGlfwOpenWindow(int width, int height, int redbits, int greenbits, int bluebits, int alphabits, int depthbits, int stencilbits, int mode)
+{
+    HeadlessWindow &window = GetHeadlessWindow();
+    if(window.m_opened) {
+        return (GL_FALSE);
+    }
+
+    // Bits of 0 get the defaults, as GLFW does.
+    window.m_opened = true;
+    window.m_iconified = false;
+    window.m_width = (width > 0) ? width : HEADLESS_DEFAULT_WIDTH;
+    window.m_height = (height > 0) ? height : HEADLESS_DEFAULT_HEIGHT;
+    window.m_params.clear();
+    window.m_params[GLFW_RED_BITS] = (redbits > 0) ? redbits : HEADLESS_COLOR_BITS;
+    window.m_params[GLFW_GREEN_BITS] = (greenbits > 0) ? greenbits : HEADLESS_COLOR_BITS;
+    window.m_params[GLFW_BLUE_BITS] = (bluebits > 0) ? bluebits : HEADLESS_COLOR_BITS;
+    window.m_params[GLFW_ALPHA_BITS] = alphabits;
+    window.m_params[GLFW_DEPTH_BITS] = (depthbits > 0) ? depthbits : HEADLESS_DEPTH_BITS;
+    window.m_params[GLFW_STENCIL_BITS] = (stencilbits > 0) ? stencilbits : HEADLESS_STENCIL_BITS;
+    window.m_params[GLFW_ACCELERATED] = GL_TRUE;
+    window.m_params[GLFW_STEREO] = GetHeadlessHint(GLFW_STEREO, 0);
+    window.m_params[GLFW_FSAA_SAMPLES] = GetHeadlessHint(GLFW_FSAA_SAMPLES, 0);
+    window.m_params[GLFW_OPENGL_VERSION_MAJOR] = GetHeadlessHint(GLFW_OPENGL_VERSION_MAJOR, 3);
+    window.m_params[GLFW_OPENGL_VERSION_MINOR] = GetHeadlessHint(GLFW_OPENGL_VERSION_MINOR, 2);
+    window.m_params[GLFW_OPENGL_PROFILE] = GetHeadlessHint(GLFW_OPENGL_PROFILE, 0);
+    window.m_params[GLFW_OPENGL_DEBUG_CONTEXT] = GetHeadlessHint(GLFW_OPENGL_DEBUG_CONTEXT, 0);
+    if(mode == GLFW_FULLSCREEN) {
+        window.m_width = HEADLESS_DESKTOP_WIDTH;
+        window.m_height = HEADLESS_DESKTOP_HEIGHT;
+    }
+
+    // The hints only apply to the next window opened.
+    window.m_hints.clear();
+    return (GL_TRUE);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLFWAPIENTRY GfRecGlfwOpenWindowHint(int target, int hint)
+{
+    GetHeadlessWindow().m_hints[target] = hint;
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLFWAPIENTRY GfRecGlfwCloseWindow(void)
+{
+    HeadlessWindow &window = GetHeadlessWindow();
+    window.m_opened = false;
+    window.m_params.clear();
+    window.m_sizeFun = NULL;
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLFWAPIENTRY GfRecGlfwSetWindowTitle(const char *)
+{
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLFWAPIENTRY GfRecGlfwGetWindowSize(int *width, int *height)
+{
+    const HeadlessWindow &window = GetHeadlessWindow();
+    if(width) {
+        *width = window.m_width;
+    }
+    if(height) {
+        *height = window.m_height;
+    }
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLFWAPIENTRY GfRecGlfwSetWindowSize(int width, int height)
+{
+    HeadlessWindow &window = GetHeadlessWindow();
+    if(!window.m_opened || width <= 0 || height <= 0) {
+        return;
+    }
+    window.m_width = width;
+    window.m_height = height;
+    if(window.m_sizeFun) {
+        window.m_sizeFun(width, height);
+    }
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLFWAPIENTRY GfRecGlfwSetWindowPos(int, int)
+{
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLFWAPIENTRY GfRecGlfwIconifyWindow(void)
+{
+    GetHeadlessWindow().m_iconified = true;
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLFWAPIENTRY GfRecGlfwRestoreWindow(void)
+{
+    GetHeadlessWindow().m_iconified = false;
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLFWAPIENTRY GfRecGlfwSwapBuffers(void)
+{
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLFWAPIENTRY GfRecGlfwSwapInterval(int)
+{
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+int GLFWAPIENTRY GfRecGlfwGetWindowParam(int param)
+{
+    const HeadlessWindow &window = GetHeadlessWindow();
+    switch(param) {
+        case GLFW_OPENED:
+            return (window.m_opened ? GL_TRUE : GL_FALSE);
+        case GLFW_ACTIVE:
+            return ((window.m_opened && !window.m_iconified) ? GL_TRUE : GL_FALSE);
+        case GLFW_ICONIFIED:
+            return (window.m_iconified ? GL_TRUE : GL_FALSE);
+        default:
+            break;
+    }
+
+    std::map<int, int>::const_iterator i = window.m_params.find(param);
+    return ((i != window.m_params.end()) ? i->second : 0);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLFWAPIENTRY GfRecGlfwSetWindowSizeCallback(GLFWwindowsizefun cbfun)
+{
+    // GLFW calls the callback straight away with the size of the open window.
+    HeadlessWindow &window = GetHeadlessWindow();
+    window.m_sizeFun = cbfun;
+    if(window.m_opened && cbfun) {
+        cbfun(window.m_width, window.m_height);
+    }
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+int GLFWAPIENTRY GfRecGlfwGetVideoModes(GLFWvidmode *list, int maxcount)
+{
+    if(!list || maxcount < 1) {
+        return (0);
+    }
+    GetHeadlessDesktopMode(list[0]);
+    return (1);
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLFWAPIENTRY GfRecGlfwGetDesktopMode(GLFWvidmode *mode)
+{
+    if(mode) {
+        GetHeadlessDesktopMode(*mode);
+    }
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLFWAPIENTRY GfRecGlfwPollEvents(void)
+{
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLFWAPIENTRY GfRecGlfwGetMousePos(int *xpos, int *ypos)
+{
+    if(xpos) {
+        *xpos = 0;
+    }
+    if(ypos) {
+        *ypos = 0;
+    }
+}
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+void GLFWAPIENTRY GfRecGlfwGetGLVersion(int *major, int *minor, int *rev)
+{
+    const HeadlessWindow &window = GetHeadlessWindow();
+    if(major) {
+        *major = window.m_opened ? window.m_params.find(GLFW_OPENGL_VERSION_MAJOR)->second : 0;
+    }
+    if(minor) {
+        *minor = window.m_opened ? window.m_params.find(GLFW_OPENGL_VERSION_MINOR)->second : 0;
+    }
+    if(rev) {
+        *rev = 0;
+    }
+}
+#endif
+
+// /////////////////////////////////////////////////////////////////
+//
+// /////////////////////////////////////////////////////////////////
+GLenum GfRecGlewInit(void)
+{
+    // The version and extensions the framework checks for.
+    __GLEW_VERSION_1_1 = GL_TRUE;
+    __GLEW_VERSION_1_2 = GL_TRUE;
+    __GLEW_VERSION_1_3 = GL_TRUE;
+    __GLEW_VERSION_1_4 = GL_TRUE;
+    __GLEW_VERSION_1_5 = GL_TRUE;
+    __GLEW_VERSION_2_0 = GL_TRUE;
+    __GLEW_VERSION_2_1 = GL_TRUE;
+    __GLEW_VERSION_3_0 = GL_TRUE;
+    __GLEW_VERSION_3_1 = GL_TRUE;
+    __GLEW_VERSION_3_2 = GL_TRUE;
+    __GLEW_ARB_get_program_binary = GL_TRUE;
+    __GLEW_ARB_texture_compression_rgtc = GL_TRUE;
+    __GLEW_ARB_uniform_buffer_object = GL_TRUE;
+    __GLEW_EXT_texture_compression_s3tc = GL_TRUE;
+    __GLEW_EXT_texture_filter_anisotropic = GL_TRUE;
+    return (GLEW_OK);
+}
@@ -0,0 +1,656 @@
+#pragma once
+#ifndef __GF_GL_RECORDER_H
+#define __GF_GL_RECORDER_H
+
+// /////////////////////////////////////////////////////////////////
+// @file GLRecorder.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header for the headless recording OpenGL backend.
+//
+// When the framework is built with GF_GL_RECORDING defined every
+// OpenGL function it calls is routed to a recording function here
+// instead of the driver (GamePlatform.h includes this header after
+// the OpenGL headers).  The recording functions need no GPU or
+// context: they log the calls, count draw calls, state changes and
+// bytes uploaded, hand out fake object names and answer queries with
+// plausible values.  This lets the render code be unit tested and
+// benchmarked on machines without a GPU, and the per-frame call
+// counts tracked as a performance metric.
+//
+// The recording functions are always compiled so they can be called
+// directly, such as by unit tests of the recorder itself.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "GamePlatform.h"
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    // @struct GLRecorderStats
+    // @author PJ O Halloran
+    //
+    // Counts of the OpenGL calls recorded.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct GLRecorderStats {
+        U32 m_calls;                            ///< OpenGL calls of any kind.
+        U32 m_drawCalls;                        ///< glDrawArrays() and glDrawElements() calls.
+        U64 m_verticesDrawn;                    ///< Vertices (or indices) submitted by the draw calls.
+        U32 m_stateChanges;                     ///< Calls setting pipeline state: binds, enables, blending, uniforms, etc.
+        U32 m_redundantStateChanges;            ///< State changes which set the value already set.
+        U32 m_textureBinds;                     ///< glBindTexture() calls.
+        U32 m_bufferBinds;                      ///< glBindBuffer() and glBindVertexArray() calls.
+        U32 m_programBinds;                     ///< glUseProgram() calls.
+        U32 m_uniformUploads;                   ///< glUniform*() calls.
+        U32 m_queries;                          ///< glGet*() calls, which stall a real pipeline.
+        U32 m_objectsCreated;                   ///< Textures, buffers, vertex arrays, shaders and programs created.
+        U32 m_objectsDeleted;                   ///< Objects deleted.
+        U64 m_textureBytesUploaded;             ///< Bytes of texel data sent to textures.
+        U64 m_bufferBytesUploaded;              ///< Bytes of data sent to buffers.
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        GLRecorderStats() : m_calls(0), m_drawCalls(0), m_verticesDrawn(0), m_stateChanges(0), m_redundantStateChanges(0), \
+            m_textureBinds(0), m_bufferBinds(0), m_programBinds(0), m_uniformUploads(0), m_queries(0), m_objectsCreated(0), \
+            m_objectsDeleted(0), m_textureBytesUploaded(0), m_bufferBytesUploaded(0) {};
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @class GLRecorder
+    // @author PJ O Halloran
+    //
+    // The state of the recording OpenGL backend.  The recording
+    // functions shadow the OpenGL state they set so redundant state
+    // changes, such as binding the texture already bound, can be
+    // counted.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class GLRecorder {
+    public:
+
+        // Categories of OpenGL state shadowed by the recorder.
+        enum StateCategory {
+            eActiveTexture = 0,
+            eBindTexture,
+            eBindBuffer,
+            eBindVertexArray,
+            eUseProgram,
+            eCapability,
+            eBlendFunc,
+            eCullFace,
+            eFrontFace,
+            ePolygonMode,
+            ePixelStore,
+            eViewport,
+            eClearColor,
+            eUniform,
+            eDrawBuffers,
+            eReadBuffer,
+            eHint,
+            eMatrixMode,
+            eBindBufferBase,
+            eUniformBlockBinding
+        };
+
+    private:
+
+        typedef std::pair<U32, U64> StateKey;
+        typedef std::map<StateKey, U64> StateMap;
+        typedef std::map<GLuint, std::vector<U8> > BufferDataMap;
+        typedef std::map<std::pair<GLuint, std::string>, GLint> UniformLocationMap;
+
+        GLRecorderStats m_stats;                ///< Counts since the last EndFrame() or ResetStats().
+        GLRecorderStats m_lastFrameStats;       ///< Counts of the last frame.
+        U32 m_numberFrames;                     ///< Frames ended.
+        bool m_callLogEnabled;                  ///< Are the calls logged?
+        std::vector<const char *> m_callLog;    ///< Names of the calls, in order.
+        GLuint m_nextName;                      ///< The next object name to hand out.
+        std::set<GLuint> m_objects;             ///< Live object names.
+        StateMap m_state;                       ///< Shadowed state, by category and key.
+        BufferDataMap m_bufferData;             ///< Contents of the buffers, so they can be mapped.
+        UniformLocationMap m_uniformLocations;  ///< Uniform locations handed out.
+        GLint m_nextUniformLocation;            ///< The next uniform location to hand out.
+        std::set<GLuint> m_unlinkedPrograms;    ///< Programs whose binary was refused.
+
+        // Non copyable.
+        GLRecorder(const GLRecorder &);
+        GLRecorder &operator=(const GLRecorder &);
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        GLRecorder();
+
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the recorder used by the recording OpenGL functions.
+        //
+        // /////////////////////////////////////////////////////////////////
+        static GLRecorder &GetGlobalInstance();
+
+        // /////////////////////////////////////////////////////////////////
+        // Forget all objects, state, counts and logged calls, as if a new
+        // context had been created.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void Reset();
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the counts since the last EndFrame() or ResetStats().
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline const GLRecorderStats &GetStats() const {
+            return (m_stats);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Zero the counts.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline void ResetStats() {
+            m_stats = GLRecorderStats();
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // End a frame, keeping its counts in GetLastFrameStats() and
+        // zeroing the counts.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void EndFrame();
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the counts of the last frame ended.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline const GLRecorderStats &GetLastFrameStats() const {
+            return (m_lastFrameStats);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of frames ended.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetNumberFrames() const {
+            return (m_numberFrames);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Enable or disable logging the names of the calls.  Disabled by
+        // default as the log grows every frame.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline void SetCallLogEnabled(const bool enabled) {
+            m_callLogEnabled = enabled;
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the names of the calls logged, in order.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline const std::vector<const char *> &GetCallLog() const {
+            return (m_callLog);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Clear the names of the calls logged.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline void ClearCallLog() {
+            m_callLog.clear();
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Is the name that of a live object?
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline bool IsObject(const GLuint name) const {
+            return (m_objects.count(name) != 0);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of live objects.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetNumberObjects() const {
+            return (U32(m_objects.size()));
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // The methods below are used by the recording OpenGL functions.
+        //
+        // /////////////////////////////////////////////////////////////////
+
+        // /////////////////////////////////////////////////////////////////
+        // Record a call.
+        //
+        // @param nameStr The OpenGL function name, a string literal.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void RecordCall(const char *nameStr);
+
+        // /////////////////////////////////////////////////////////////////
+        // Record a state change.
+        //
+        // @return bool False if the state already had the value.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool SetState(const StateCategory category, const U64 key, const U64 value);
+
+        // /////////////////////////////////////////////////////////////////
+        // Get a shadowed state value.
+        //
+        // @param defaultValue The value if the state has not been set.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U64 GetState(const StateCategory category, const U64 key, const U64 defaultValue) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Hand out a new object name.
+        //
+        // /////////////////////////////////////////////////////////////////
+        GLuint CreateObject();
+
+        // /////////////////////////////////////////////////////////////////
+        // Delete an object.  Name 0 and unknown names are ignored, as
+        // OpenGL does.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void DeleteObject(const GLuint name);
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the storage of a buffer, for glBufferData() and
+        // glMapBuffer().
+        //
+        // /////////////////////////////////////////////////////////////////
+        std::vector<U8> &GetBufferData(const GLuint name);
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the location of a uniform, handing out a new one the first
+        // time the name is asked for.
+        //
+        // /////////////////////////////////////////////////////////////////
+        GLint GetUniformLocation(const GLuint program, const std::string &name);
+
+        // /////////////////////////////////////////////////////////////////
+        // Set whether a program is linked.  Programs link unless given a
+        // binary the recorder did not hand out, which it refuses as a
+        // driver refuses the binaries of another driver.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void SetProgramLinked(const GLuint program, const bool linked);
+
+        // /////////////////////////////////////////////////////////////////
+        // Is the program linked?
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline bool IsProgramLinked(const GLuint program) const {
+            return (m_unlinkedPrograms.count(program) == 0);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the counts to update.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline GLRecorderStats &GetMutableStats() {
+            return (m_stats);
+        };
+    };
+
+    // Hash the bytes of a uniform value or other state so changes can be detected.
+    U64 HashGLRecorderData(const void *dataPtr, const size_t size);
+
+}
+
+// /////////////////////////////////////////////////////////////////
+// The recording OpenGL functions, with the signatures of the
+// functions they replace.
+//
+// /////////////////////////////////////////////////////////////////
+void GLAPIENTRY GfRecActiveTexture(GLenum texture);
+void GLAPIENTRY GfRecAttachShader(GLuint program, GLuint shader);
+void GLAPIENTRY GfRecBindAttribLocation(GLuint program, GLuint index, const GLchar *name);
+void GLAPIENTRY GfRecBindBuffer(GLenum target, GLuint buffer);
+void GLAPIENTRY GfRecBindBufferBase(GLenum target, GLuint index, GLuint buffer);
+void GLAPIENTRY GfRecBindTexture(GLenum target, GLuint texture);
+void GLAPIENTRY GfRecBindVertexArray(GLuint array);
+void GLAPIENTRY GfRecBlendFunc(GLenum sfactor, GLenum dfactor);
+void GLAPIENTRY GfRecBufferData(GLenum target, GLsizeiptr size, const GLvoid *data, GLenum usage);
+void GLAPIENTRY GfRecBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid *data);
+GLenum GLAPIENTRY GfRecCheckFramebufferStatus(GLenum target);
+void GLAPIENTRY GfRecClear(GLbitfield mask);
+void GLAPIENTRY GfRecClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha);
+void GLAPIENTRY GfRecCompileShader(GLuint shader);
+void GLAPIENTRY GfRecCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, \
+        GLsizei imageSize, const GLvoid *data);
+GLuint GLAPIENTRY GfRecCreateProgram(void);
+GLuint GLAPIENTRY GfRecCreateShader(GLenum type);
+void GLAPIENTRY GfRecCullFace(GLenum mode);
+void GLAPIENTRY GfRecDeleteBuffers(GLsizei n, const GLuint *buffers);
+void GLAPIENTRY GfRecDeleteProgram(GLuint program);
+void GLAPIENTRY GfRecDeleteShader(GLuint shader);
+void GLAPIENTRY GfRecDeleteTextures(GLsizei n, const GLuint *textures);
+void GLAPIENTRY GfRecDeleteVertexArrays(GLsizei n, const GLuint *arrays);
+void GLAPIENTRY GfRecDisable(GLenum cap);
+void GLAPIENTRY GfRecDisableVertexAttribArray(GLuint index);
+void GLAPIENTRY GfRecDrawArrays(GLenum mode, GLint first, GLsizei count);
+void GLAPIENTRY GfRecDrawBuffers(GLsizei n, const GLenum *bufs);
+void GLAPIENTRY GfRecDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid *indices);
+void GLAPIENTRY GfRecEnable(GLenum cap);
+void GLAPIENTRY GfRecEnableVertexAttribArray(GLuint index);
+void GLAPIENTRY GfRecFinish(void);
+void GLAPIENTRY GfRecFrontFace(GLenum mode);
+void GLAPIENTRY GfRecGenBuffers(GLsizei n, GLuint *buffers);
+void GLAPIENTRY GfRecGenerateMipmap(GLenum target);
+void GLAPIENTRY GfRecGenTextures(GLsizei n, GLuint *textures);
+void GLAPIENTRY GfRecGenVertexArrays(GLsizei n, GLuint *arrays);
+GLenum GLAPIENTRY GfRecGetError(void);
+void GLAPIENTRY GfRecGetFloatv(GLenum pname, GLfloat *params);
+void GLAPIENTRY GfRecGetIntegerv(GLenum pname, GLint *params);
+void GLAPIENTRY GfRecGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, GLvoid *binary);
+void GLAPIENTRY GfRecGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
+void GLAPIENTRY GfRecGetProgramiv(GLuint program, GLenum pname, GLint *param);
+void GLAPIENTRY GfRecGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog);
+void GLAPIENTRY GfRecGetShaderiv(GLuint shader, GLenum pname, GLint *param);
+const GLubyte *GLAPIENTRY GfRecGetString(GLenum name);
+const GLubyte *GLAPIENTRY GfRecGetStringi(GLenum name, GLuint index);
+GLuint GLAPIENTRY GfRecGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName);
+GLint GLAPIENTRY GfRecGetUniformLocation(GLuint program, const GLchar *name);
+void GLAPIENTRY GfRecHint(GLenum target, GLenum mode);
+GLboolean GLAPIENTRY GfRecIsBuffer(GLuint buffer);
+GLboolean GLAPIENTRY GfRecIsProgram(GLuint program);
+GLboolean GLAPIENTRY GfRecIsTexture(GLuint texture);
+GLboolean GLAPIENTRY GfRecIsVertexArray(GLuint array);
+void GLAPIENTRY GfRecLinkProgram(GLuint program);
+void GLAPIENTRY GfRecLoadIdentity(void);
+void GLAPIENTRY GfRecLoadMatrixf(const GLfloat *m);
+GLvoid *GLAPIENTRY GfRecMapBuffer(GLenum target, GLenum access);
+void GLAPIENTRY GfRecMatrixMode(GLenum mode);
+void GLAPIENTRY GfRecPixelStorei(GLenum pname, GLint param);
+void GLAPIENTRY GfRecPolygonMode(GLenum face, GLenum mode);
+void GLAPIENTRY GfRecProgramBinary(GLuint program, GLenum binaryFormat, const GLvoid *binary, GLsizei length);
+void GLAPIENTRY GfRecProgramParameteri(GLuint program, GLenum pname, GLint value);
+void GLAPIENTRY GfRecReadBuffer(GLenum mode);
+void GLAPIENTRY GfRecReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLvoid *pixels);
+void GLAPIENTRY GfRecShaderSource(GLuint shader, GLsizei count, const GLchar **strings, const GLint *lengths);
+void GLAPIENTRY GfRecTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, \
+                                const GLvoid *pixels);
+void GLAPIENTRY GfRecTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, \
+                                GLenum type, const GLvoid *pixels);
+void GLAPIENTRY GfRecTexParameterf(GLenum target, GLenum pname, GLfloat param);
+void GLAPIENTRY GfRecTexParameteri(GLenum target, GLenum pname, GLint param);
+void GLAPIENTRY GfRecUniform1f(GLint location, GLfloat v0);
+void GLAPIENTRY GfRecUniform1fv(GLint location, GLsizei count, const GLfloat *value);
+void GLAPIENTRY GfRecUniform1i(GLint location, GLint v0);
+void GLAPIENTRY GfRecUniform1iv(GLint location, GLsizei count, const GLint *value);
+void GLAPIENTRY GfRecUniform2fv(GLint location, GLsizei count, const GLfloat *value);
+void GLAPIENTRY GfRecUniform2iv(GLint location, GLsizei count, const GLint *value);
+void GLAPIENTRY GfRecUniform3fv(GLint location, GLsizei count, const GLfloat *value);
+void GLAPIENTRY GfRecUniform3iv(GLint location, GLsizei count, const GLint *value);
+void GLAPIENTRY GfRecUniform4fv(GLint location, GLsizei count, const GLfloat *value);
+void GLAPIENTRY GfRecUniform4iv(GLint location, GLsizei count, const GLint *value);
+void GLAPIENTRY GfRecUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding);
+void GLAPIENTRY GfRecUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+void GLAPIENTRY GfRecUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value);
+GLboolean GLAPIENTRY GfRecUnmapBuffer(GLenum target);
+void GLAPIENTRY GfRecUseProgram(GLuint program);
+void GLAPIENTRY GfRecValidateProgram(GLuint program);
+void GLAPIENTRY GfRecVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const GLvoid *pointer);
+void GLAPIENTRY GfRecViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+
+// /////////////////////////////////////////////////////////////////
+// The headless window functions, with the signatures of the GLFW 2
+// window functions they replace.  The window is never shown: it keeps
+// the size, bits and hints it was opened with so the WindowManager's
+// checks pass, and the window size callback is called as GLFW calls
+// it.  glfwInit() is not replaced as the GLFW thread and timer
+// functions need it, so on X11 a display (such as Xvfb) is still
+// needed.  GfRecGlewInit() replaces glewInit(), which needs a context,
+// and reports the OpenGL 3.2 version and extensions the framework
+// checks for as supported.
+//
+// /////////////////////////////////////////////////////////////////
+#ifndef USE_NEW_GLFW
+int GLFWAPIENTRY GfRecGlfwOpenWindow(int width, int height, int redbits, int greenbits, int bluebits, int alphabits, int depthbits, int stencilbits, int mode);
+void GLFWAPIENTRY GfRecGlfwOpenWindowHint(int target, int hint);
+void GLFWAPIENTRY GfRecGlfwCloseWindow(void);
+void GLFWAPIENTRY GfRecGlfwSetWindowTitle(const char *title);
+void GLFWAPIENTRY GfRecGlfwGetWindowSize(int *width, int *height);
+void GLFWAPIENTRY GfRecGlfwSetWindowSize(int width, int height);
+void GLFWAPIENTRY GfRecGlfwSetWindowPos(int x, int y);
+void GLFWAPIENTRY GfRecGlfwIconifyWindow(void);
+void GLFWAPIENTRY GfRecGlfwRestoreWindow(void);
+void GLFWAPIENTRY GfRecGlfwSwapBuffers(void);
+void GLFWAPIENTRY GfRecGlfwSwapInterval(int interval);
+int GLFWAPIENTRY GfRecGlfwGetWindowParam(int param);
+void GLFWAPIENTRY GfRecGlfwSetWindowSizeCallback(GLFWwindowsizefun cbfun);
+int GLFWAPIENTRY GfRecGlfwGetVideoModes(GLFWvidmode *list, int maxcount);
+void GLFWAPIENTRY GfRecGlfwGetDesktopMode(GLFWvidmode *mode);
+void GLFWAPIENTRY GfRecGlfwPollEvents(void);
+void GLFWAPIENTRY GfRecGlfwGetMousePos(int *xpos, int *ypos);
+void GLFWAPIENTRY GfRecGlfwGetGLVersion(int *major, int *minor, int *rev);
+#endif
+GLenum GfRecGlewInit(void);
+
+// Route the OpenGL calls to the recording functions.  GLEW defines the functions
+//  newer than OpenGL 1.1 as macros so they are undefined first.
+#ifdef GF_GL_RECORDING
+#undef glActiveTexture
+#define glActiveTexture GfRecActiveTexture
+#undef glAttachShader
+#define glAttachShader GfRecAttachShader
+#undef glBindAttribLocation
+#define glBindAttribLocation GfRecBindAttribLocation
+#undef glBindBuffer
+#define glBindBuffer GfRecBindBuffer
+#undef glBindBufferBase
+#define glBindBufferBase GfRecBindBufferBase
+#undef glBindTexture
+#define glBindTexture GfRecBindTexture
+#undef glBindVertexArray
+#define glBindVertexArray GfRecBindVertexArray
+#undef glBindVertexArrayAPPLE
+#define glBindVertexArrayAPPLE GfRecBindVertexArray
+#undef glBlendFunc
+#define glBlendFunc GfRecBlendFunc
+#undef glBufferData
+#define glBufferData GfRecBufferData
+#undef glBufferSubData
+#define glBufferSubData GfRecBufferSubData
+#undef glCheckFramebufferStatus
+#define glCheckFramebufferStatus GfRecCheckFramebufferStatus
+#undef glClear
+#define glClear GfRecClear
+#undef glClearColor
+#define glClearColor GfRecClearColor
+#undef glCompileShader
+#define glCompileShader GfRecCompileShader
+#undef glCompressedTexImage2D
+#define glCompressedTexImage2D GfRecCompressedTexImage2D
+#undef glCreateProgram
+#define glCreateProgram GfRecCreateProgram
+#undef glCreateShader
+#define glCreateShader GfRecCreateShader
+#undef glCullFace
+#define glCullFace GfRecCullFace
+#undef glDeleteBuffers
+#define glDeleteBuffers GfRecDeleteBuffers
+#undef glDeleteProgram
+#define glDeleteProgram GfRecDeleteProgram
+#undef glDeleteShader
+#define glDeleteShader GfRecDeleteShader
+#undef glDeleteTextures
+#define glDeleteTextures GfRecDeleteTextures
+#undef glDeleteVertexArrays
+#define glDeleteVertexArrays GfRecDeleteVertexArrays
+#undef glDeleteVertexArraysAPPLE
+#define glDeleteVertexArraysAPPLE GfRecDeleteVertexArrays
+#undef glDisable
+#define glDisable GfRecDisable
+#undef glDisableVertexAttribArray
+#define glDisableVertexAttribArray GfRecDisableVertexAttribArray
+#undef glDrawArrays
+#define glDrawArrays GfRecDrawArrays
+#undef glDrawBuffers
+#define glDrawBuffers GfRecDrawBuffers
+#undef glDrawElements
+#define glDrawElements GfRecDrawElements
+#undef glEnable
+#define glEnable GfRecEnable
+#undef glEnableVertexAttribArray
+#define glEnableVertexAttribArray GfRecEnableVertexAttribArray
+#undef glFinish
+#define glFinish GfRecFinish
+#undef glFrontFace
+#define glFrontFace GfRecFrontFace
+#undef glGenBuffers
+#define glGenBuffers GfRecGenBuffers
+#undef glGenerateMipmap
+#define glGenerateMipmap GfRecGenerateMipmap
+#undef glGenerateMipmapEXT
+#define glGenerateMipmapEXT GfRecGenerateMipmap
+#undef glGenTextures
+#define glGenTextures GfRecGenTextures
+#undef glGenVertexArrays
+#define glGenVertexArrays GfRecGenVertexArrays
+#undef glGenVertexArraysAPPLE
+#define glGenVertexArraysAPPLE GfRecGenVertexArrays
+#undef glGetError
+#define glGetError GfRecGetError
+#undef glGetFloatv
+#define glGetFloatv GfRecGetFloatv
+#undef glGetIntegerv
+#define glGetIntegerv GfRecGetIntegerv
+#undef glGetProgramBinary
+#define glGetProgramBinary GfRecGetProgramBinary
+#undef glGetProgramInfoLog
+#define glGetProgramInfoLog GfRecGetProgramInfoLog
+#undef glGetProgramiv
+#define glGetProgramiv GfRecGetProgramiv
+#undef glGetShaderInfoLog
+#define glGetShaderInfoLog GfRecGetShaderInfoLog
+#undef glGetShaderiv
+#define glGetShaderiv GfRecGetShaderiv
+#undef glGetString
+#define glGetString GfRecGetString
+#undef glGetStringi
+#define glGetStringi GfRecGetStringi
+#undef glGetUniformBlockIndex
+#define glGetUniformBlockIndex GfRecGetUniformBlockIndex
+#undef glGetUniformLocation
+#define glGetUniformLocation GfRecGetUniformLocation
+#undef glHint
+#define glHint GfRecHint
+#undef glIsBuffer
+#define glIsBuffer GfRecIsBuffer
+#undef glIsProgram
+#define glIsProgram GfRecIsProgram
+#undef glIsTexture
+#define glIsTexture GfRecIsTexture
+#undef glIsVertexArray
+#define glIsVertexArray GfRecIsVertexArray
+#undef glLinkProgram
+#define glLinkProgram GfRecLinkProgram
+#undef glLoadIdentity
+#define glLoadIdentity GfRecLoadIdentity
+#undef glLoadMatrixf
+#define glLoadMatrixf GfRecLoadMatrixf
+#undef glMapBuffer
+#define glMapBuffer GfRecMapBuffer
+#undef glMatrixMode
+#define glMatrixMode GfRecMatrixMode
+#undef glPixelStorei
+#define glPixelStorei GfRecPixelStorei
+#undef glPolygonMode
+#define glPolygonMode GfRecPolygonMode
+#undef glProgramBinary
+#define glProgramBinary GfRecProgramBinary
+#undef glProgramParameteri
+#define glProgramParameteri GfRecProgramParameteri
+#undef glReadBuffer
+#define glReadBuffer GfRecReadBuffer
+#undef glReadPixels
+#define glReadPixels GfRecReadPixels
+#undef glShaderSource
+#define glShaderSource GfRecShaderSource
+#undef glTexImage1D
+#define glTexImage1D GfRecTexImage1D
+#undef glTexImage2D
+#define glTexImage2D GfRecTexImage2D
+#undef glTexParameterf
+#define glTexParameterf GfRecTexParameterf
+#undef glTexParameteri
+#define glTexParameteri GfRecTexParameteri
+#undef glUniform1f
+#define glUniform1f GfRecUniform1f
+#undef glUniform1fv
+#define glUniform1fv GfRecUniform1fv
+#undef glUniform1i
+#define glUniform1i GfRecUniform1i
+#undef glUniform1iv
+#define glUniform1iv GfRecUniform1iv
+#undef glUniform2fv
+#define glUniform2fv GfRecUniform2fv
+#undef glUniform2iv
+#define glUniform2iv GfRecUniform2iv
+#undef glUniform3fv
+#define glUniform3fv GfRecUniform3fv
+#undef glUniform3iv
+#define glUniform3iv GfRecUniform3iv
+#undef glUniform4fv
+#define glUniform4fv GfRecUniform4fv
+#undef glUniform4iv
+#define glUniform4iv GfRecUniform4iv
+#undef glUniformBlockBinding
+#define glUniformBlockBinding GfRecUniformBlockBinding
+#undef glUniformMatrix3fv
+#define glUniformMatrix3fv GfRecUniformMatrix3fv
+#undef glUniformMatrix4fv
+#define glUniformMatrix4fv GfRecUniformMatrix4fv
+#undef glUnmapBuffer
+#define glUnmapBuffer GfRecUnmapBuffer
+#undef glUseProgram
+#define glUseProgram GfRecUseProgram
+#undef glValidateProgram
+#define glValidateProgram GfRecValidateProgram
+#undef glVertexAttribPointer
+#define glVertexAttribPointer GfRecVertexAttribPointer
+#undef glViewport
+#define glViewport GfRecViewport
+#ifndef USE_NEW_GLFW
+#define glfwOpenWindow GfRecGlfwOpenWindow
+#define glfwOpenWindowHint GfRecGlfwOpenWindowHint
+#define glfwCloseWindow GfRecGlfwCloseWindow
+#define glfwSetWindowTitle GfRecGlfwSetWindowTitle
+#define glfwGetWindowSize GfRecGlfwGetWindowSize
+#define glfwSetWindowSize GfRecGlfwSetWindowSize
+#define glfwSetWindowPos GfRecGlfwSetWindowPos
+#define glfwIconifyWindow GfRecGlfwIconifyWindow
+#define glfwRestoreWindow GfRecGlfwRestoreWindow
+#define glfwSwapBuffers GfRecGlfwSwapBuffers
+#define glfwSwapInterval GfRecGlfwSwapInterval
+#define glfwGetWindowParam GfRecGlfwGetWindowParam
+#define glfwSetWindowSizeCallback GfRecGlfwSetWindowSizeCallback
+#define glfwGetVideoModes GfRecGlfwGetVideoModes
+#define glfwGetDesktopMode GfRecGlfwGetDesktopMode
+#define glfwPollEvents GfRecGlfwPollEvents
+#define glfwGetMousePos GfRecGlfwGetMousePos
+#define glfwGetGLVersion GfRecGlfwGetGLVersion
+#endif
+#undef glewInit
+#define glewInit GfRecGlewInit
+#endif
+
+#endif
@@ -11,8 +11,6 @@
 #include <iostream>
 #include <fstream>
 
-#include <boost/algorithm/string.hpp>
-
 #include "GLSLShader.h"
 #include "GameBase.h"
 #include "GameMain.h"
@@ -23,6 +21,25 @@ using std::string;
 
 namespace GameHalloran {
 
+    namespace {
+
+        // /////////////////////////////////////////////////////////////////
+        // Read the shader source from a file.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool ReadSrcFile(const boost::filesystem::path &filenameRef, std::string &srcRef)
+        {
+            std::ifstream inputStream(filenameRef.string().c_str());
+            if(!inputStream.is_open()) {
+                return (false);
+            }
+
+            srcRef.assign((std::istreambuf_iterator<char>(inputStream)), std::istreambuf_iterator<char>());
+            return (!inputStream.bad());
+        }
+
+    }
+
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
@@ -35,6 +52,7 @@ namespace GameHalloran {
             GF_CHECK_GL_ERROR_TRC("GLSLShader::FreeProgram(): ");
 
             m_id = 0;
+            m_uniformBlockMap.clear();
         }
     }
 
@@ -103,64 +121,6 @@ namespace GameHalloran {
         }
     }
 
-    // /////////////////////////////////////////////////////////////////
-    //
-    // /////////////////////////////////////////////////////////////////
-    bool GLSLShader::LoadSrcFromFile(const boost::filesystem::path &filenameRef, const GLuint shaderId) const
-    {
-        bool result = true;             // Result of method.
-        GLint fileSize = 0;             // Length of the shader source file.
-        FILE *fp;                       // File pointer.
-        GLubyte *shaderSrc = NULL;      // Pointer to the buffer allocated for the shader.
-
-        // Open the shader file
-        fp = fopen(filenameRef.string().c_str(), "r");
-        if(fp != NULL) {
-            // See how long the file is
-            while(fgetc(fp) != EOF) {
-                ++fileSize;
-            }
-
-            // Allocate a block of memory to send in the shader (+1 for an extra NULL terminated character at end.)
-            shaderSrc = GCC_NEW GLubyte[fileSize + 1];
-            if(!shaderSrc) {
-                result = false;
-            }
-
-            if(result) {
-                // Go back to beginning of file
-                rewind(fp);
-                fread(shaderSrc, 1, fileSize, fp);
-                shaderSrc[fileSize] = '\0';
-            }
-        } else {
-            result = false;
-        }
-
-        // Load the string into the shader program.
-        if(result) {
-            GLchar *fsStringPtr[1];
-            fsStringPtr[0] = reinterpret_cast<GLchar *>(shaderSrc);
-
-            GF_CLEAR_GL_ERROR();
-
-            glShaderSource(shaderId, 1, (const GLchar **)fsStringPtr, NULL);
-
-            result = GF_CHECK_GL_ERROR_TRC("GLSLShader::LoadSrcFromFile(): ");
-        }
-
-        // Close file, free memory and return result.
-        if(fp) {
-            fclose(fp);
-            fp = NULL;
-        }
-        if(shaderSrc) {
-            delete [] shaderSrc;
-            shaderSrc = NULL;
-        }
-        return (result);
-    }
-
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
@@ -184,130 +144,58 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
-    bool GLSLShader::ParseSrcForUniforms(const char *src)
+    bool GLSLShader::QueryUniformLocations(ShaderUniformTable &tableRef)
     {
-        // Ensure input is valid and GLSL program is built and activated.
-        if(!src || !IsBuilt()) {
+        // Ensure the GLSL program is built and activated.
+        if(!IsBuilt()) {
             return (false);
         }
         if(!IsActivated()) {
             Activate();
         }
 
-        std::istringstream inputStream(src);
-
-        // NB. Max supported shader line size is set to 1024 for to find uniforms automatically.
-        const U32 SIZE = 1024;
-        char buffer[SIZE];
-        memset(buffer, 0, sizeof(char) * SIZE);
-        std::vector<std::string> linesVec;
-        linesVec.reserve(10000);
-
-        while(!inputStream.eof()) {
-            inputStream.getline(buffer, SIZE);
-            linesVec.push_back(std::string(buffer));
-        }
-
-        // Trim excess vector capacity
-        std::vector<std::string>(linesVec.begin(), linesVec.end()).swap(linesVec);
-        return (LocateUniforms(linesVec));
-    }
-
-    // /////////////////////////////////////////////////////////////////
-    //
-    // /////////////////////////////////////////////////////////////////
-    bool GLSLShader::ParseFileForUniforms(const boost::filesystem::path &filenameRef)
-    {
-        // Ensure input is valid and GLSL program is built and activated.
-        if(!boost::filesystem::exists(filenameRef) || !IsBuilt()) {
-            return (false);
-        }
-        if(!IsActivated()) {
-            Activate();
-        }
+        GF_CLEAR_GL_ERROR();
 
-        std::ifstream inputStream(filenameRef.string().c_str());
-        if(!inputStream.is_open()) {
-            return (false);
+        for(ShaderUniformTable::UniformList::iterator i = tableRef.m_uniforms.begin(), end = tableRef.m_uniforms.end(); i != end; ++i) {
+            // Get the location of the uniform in the compiled shader source according to the uniform name.
+            (*i).second = glGetUniformLocation(m_id, static_cast<const GLchar *>((*i).first.c_str()));
+#if DEBUG
+            GLenum errCode = glGetError();
+            if(errCode != GL_NO_ERROR) {
+                GF_LOG_ERR(std::string("Error finding the uniform location for \"") + (*i).first + std::string("\":") + GameHalloran::GetOpenGLError(errCode));
+                return (false);
+            }
+#endif
         }
-
-        // NB. Max supported shader line size is set to 1024 for to find uniforms automatically.
-        const U32 SIZE = 1024;
-        char buffer[SIZE];
-        memset(buffer, 0, sizeof(char) * SIZE);
-        std::vector<std::string> linesVec;
-        linesVec.reserve(256);
-
-        while(!inputStream.eof()) {
-            inputStream.getline(buffer, SIZE);
-            linesVec.push_back(std::string(buffer));
+        for(ShaderUniformTable::BlockList::iterator i = tableRef.m_blocks.begin(), end = tableRef.m_blocks.end(); i != end; ++i) {
+            (*i).second = glGetUniformBlockIndex(m_id, static_cast<const GLchar *>((*i).first.c_str()));
         }
 
-        // Trim excess vector capacity
-        std::vector<std::string>(linesVec.begin(), linesVec.end()).swap(linesVec);
-        return (LocateUniforms(linesVec));
+        return (true);
     }
 
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
-    bool GLSLShader::LocateUniforms(const std::vector<std::string> &linesVec)
+    void GLSLShader::LocateUniforms(const ShaderUniformTable &tableRef)
     {
-        const std::string SEMICOLON_STR(";");
-        const std::string WHITESPACE_STR(" ");
-        const std::string ARRAY_LEFT_BRACKET_STR("[");
-        const std::string UNIFORM_KEYWORD_STR("uniform");
-        std::vector<std::string> statements, uniformSections, arraySections;
-        std::string currVariableName;
-
-        GF_CLEAR_GL_ERROR();
+        // The uniforms of any program built before are gone.
+        m_dirtyList.clear();
+        m_uniforms.clear();
+        m_uniformMap.clear();
+        m_uniformBlockMap.clear();
 
-        // Iterate through each line in the source file looking for uniform declarations.
-        for(std::vector<std::string>::const_iterator i = linesVec.begin(), end = linesVec.end(); i != end; ++i) {
-            // A line might have many GLSL statements...
-            boost::algorithm::split(statements, *i, boost::algorithm::is_any_of(SEMICOLON_STR));
-
-            // Parse through all statements in the current line.
-            for(std::vector<std::string>::iterator stateIter = statements.begin(), stateEnd = statements.end(); stateIter != stateEnd; ++stateIter) {
-                // Only consider lines beginning with the uniform keyword.
-                if(boost::algorithm::starts_with(*stateIter, UNIFORM_KEYWORD_STR)) {
-                    // We found a uniform declaration!
-                    boost::algorithm::split(uniformSections, *stateIter, boost::algorithm::is_any_of(WHITESPACE_STR));
-                    if(uniformSections.size() == 3) {
-                        // Handle variable names that are arrays
-                        boost::algorithm::split(arraySections, uniformSections[2], boost::algorithm::is_any_of(ARRAY_LEFT_BRACKET_STR));
-
-                        if(arraySections.size() == 2) {
-                            currVariableName = arraySections[0];
-                            arraySections.clear();
-                        } else {
-                            currVariableName = uniformSections[2];
-                        }
-
-                        // Get the location of the uniform in the compiled shader source according to the uniform name.
-                        GLint loc = glGetUniformLocation(m_id, static_cast<const GLchar *>(currVariableName.c_str()));
-                        m_uniformMap[currVariableName] = loc;
-#if DEBUG
-                        GLenum errCode = glGetError();
-                        if(errCode != GL_NO_ERROR) {
-                            GF_LOG_ERR(std::string("Error finding the uniform location for \"") + currVariableName + std::string("\":") + GameHalloran::GetOpenGLError(errCode));
-                            return (false);
-                        }
-#endif
-                        m_uniforms.push_back(boost::shared_ptr<ShaderUniform>(new ShaderUniform(loc, currVariableName, this)));
-                    } else {
-                        // compile error - should never happen if OpenGL says the program has already been compiled.
-                        return (false);
-                    }
+        for(ShaderUniformTable::UniformList::const_iterator i = tableRef.m_uniforms.begin(), end = tableRef.m_uniforms.end(); i != end; ++i) {
+            m_uniformMap[(*i).first] = (*i).second;
+            m_uniforms.push_back(boost::shared_ptr<ShaderUniform>(new ShaderUniform((*i).second, (*i).first, this)));
+        }
 
-                    uniformSections.clear();
-                }
+        // Uniform blocks are fed from uniform buffers rather than by location.
+        for(ShaderUniformTable::BlockList::const_iterator i = tableRef.m_blocks.begin(), end = tableRef.m_blocks.end(); i != end; ++i) {
+            if((*i).second != GL_INVALID_INDEX) {
+                m_uniformBlockMap[(*i).first] = (*i).second;
             }
-
-            statements.clear();
         }
-
-        return (true);
     }
 
     // /////////////////////////////////////////////////////////////////
@@ -316,6 +204,7 @@ namespace GameHalloran {
     bool GLSLShader::BuildProgramFromFiles(const boost::filesystem::path &vsFilename, const boost::filesystem::path &gsFilename, const boost::filesystem::path &fsFilename, const VSAttributeNameList &vsAttList, std::string &messageRef, const bool includeGeometryShader)
     {
         bool result = true;
+        std::string vsSrc, gsSrc, fsSrc;
 
         // Clear error message on entry.
         if(!messageRef.empty()) {
@@ -336,21 +225,49 @@ namespace GameHalloran {
             result = false;
         }
 
+        // Read the source once, it is used to build the program and to find its uniforms.
+        if(result && !ReadSrcFile(vsFilename, vsSrc)) {
+            messageRef.assign(string("Failed to load the vertex shader source."));
+            result = false;
+        }
+        if(result && includeGeometryShader && !ReadSrcFile(gsFilename, gsSrc)) {
+            messageRef.assign(string("Failed to load the geometry shader source."));
+            result = false;
+        }
+        if(result && !ReadSrcFile(fsFilename, fsSrc)) {
+            messageRef.assign(string("Failed to load the fragment shader source."));
+            result = false;
+        }
+
+        if(result) {
+            result = BuildProgramFromSrc(vsSrc.c_str(), includeGeometryShader ? gsSrc.c_str() : NULL, fsSrc.c_str(), vsAttList, messageRef, includeGeometryShader);
+        }
+
+        return (result);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool GLSLShader::CompileAndLinkProgram(const char *vsSrc, const char *gsSrc, const char *fsSrc, const VSAttributeNameList &vsAttList, std::string &messageRef, const bool includeGeometryShader)
+    {
+        bool result = true;
+
         if(result) {
             ShaderProgram vsProg(GL_VERTEX_SHADER);         // Vertex shader program.
             ShaderProgram gsProg(GL_GEOMETRY_SHADER);       // Gemoetry shader.
             ShaderProgram fsProg(GL_FRAGMENT_SHADER);       // Fragment shader program.
 
             // A) Load the shader programs from a file.
-            if(!LoadSrcFromFile(vsFilename, vsProg.GetShaderId())) {
+            if(!LoadSrc(vsSrc, vsProg.GetShaderId())) {
                 messageRef.assign(string("Failed to load the vertex shader source."));
                 result = false;
             }
-            if(result && includeGeometryShader && !LoadSrcFromFile(gsFilename, gsProg.GetShaderId())) {
+            if(result && includeGeometryShader && !LoadSrc(gsSrc, gsProg.GetShaderId())) {
                 messageRef.assign(string("Failed to load the geometry shader source."));
                 result = false;
             }
-            if(result && !LoadSrcFromFile(fsFilename, fsProg.GetShaderId())) {
+            if(result && !LoadSrc(fsSrc, fsProg.GetShaderId())) {
                 messageRef.assign(string("Failed to load the fragment shader source."));
                 result = false;
             }
@@ -414,6 +331,8 @@ namespace GameHalloran {
             if(result) {
                 // Create the final program object, and attach the shaders
                 GLuint tmpGlslProgId = glCreateProgram();
+                GF_CHECK_GL_ERROR();
+
                 glAttachShader(tmpGlslProgId, vsProg.GetShaderId());
                 GF_CHECK_GL_ERROR();
                 if(includeGeometryShader) {
@@ -423,7 +342,6 @@ namespace GameHalloran {
                 glAttachShader(tmpGlslProgId, fsProg.GetShaderId());
                 GF_CHECK_GL_ERROR();
 
-
                 // Bind the attribute names to their specific locations.
                 I32 index = 0;
                 for(VSAttributeNameList::const_iterator curr = vsAttList.begin(), end = vsAttList.end(); curr != end; ++curr, ++index) {
@@ -435,6 +353,12 @@ namespace GameHalloran {
                     }
                 }
 
+                // Ask for a binary which can be saved to the program cache.
+                if(m_programCachePtr) {
+                    glProgramParameteri(tmpGlslProgId, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+                    GF_CHECK_GL_ERROR();
+                }
+
                 // Attempt to link and check result.
                 GLint linkStatus;
                 glLinkProgram(tmpGlslProgId);
@@ -447,7 +371,7 @@ namespace GameHalloran {
 
                 glGetProgramiv(tmpGlslProgId, GL_LINK_STATUS, &linkStatus);
 
-                // NB: Leave following in all build modes to cleanup shader resources on any errors!
+                // NB - Leave check in on all builds to clean up GPU resources on any error..
                 errCode = glGetError();
                 if(linkStatus == GL_FALSE || errCode != GL_NO_ERROR) {
                     const I32 bufSize = 1024;
@@ -458,21 +382,10 @@ namespace GameHalloran {
                     result = false;
                 }
 
-                // Set the new GLSL program ID and search for shader uniform locations before exit.
+                // Set the new GLSL program ID.
                 if(result) {
                     FreeProgram();
                     m_id = tmpGlslProgId;
-
-                    // Search for the shader uniforms now that the GLSL program has been compiled and linked.
-                    if(!ParseFileForUniforms(vsFilename)) {
-                        result = false;
-                    }
-                    if(result && includeGeometryShader && !ParseFileForUniforms(gsFilename)) {
-                        result = false;
-                    }
-                    if(result && !ParseFileForUniforms(fsFilename)) {
-                        result = false;
-                    }
                 }
             }
         }
@@ -480,6 +393,62 @@ namespace GameHalloran {
         return (result);
     }
 
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool GLSLShader::LoadProgramBinary(const ShaderProgramBinary &binaryRef)
+    {
+        GF_CLEAR_GL_ERROR();
+
+        GLuint tmpGlslProgId = glCreateProgram();
+        glProgramBinary(tmpGlslProgId, binaryRef.m_format, &binaryRef.m_binary[0], GLsizei(binaryRef.m_binary.size()));
+
+        // The driver refuses binaries it can no longer load (e.g. after an update) by failing the link.
+        GLint linkStatus(GL_FALSE);
+        glGetProgramiv(tmpGlslProgId, GL_LINK_STATUS, &linkStatus);
+        if(!GF_CHECK_GL_ERROR_TRC("GLSLShader::LoadProgramBinary(): ") || linkStatus == GL_FALSE) {
+            glDeleteProgram(tmpGlslProgId);
+            return (false);
+        }
+
+        FreeProgram();
+        m_id = tmpGlslProgId;
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void GLSLShader::StoreProgramBinary(const U64 sourceHash, const ShaderUniformTable &tableRef, const F64 buildSeconds)
+    {
+        GLint length(0);
+
+        GF_CLEAR_GL_ERROR();
+
+        glGetProgramiv(m_id, GL_PROGRAM_BINARY_LENGTH, &length);
+        if(length <= 0) {
+            GF_CHECK_GL_ERROR_TRC("GLSLShader::StoreProgramBinary(): ");
+            return;
+        }
+
+        ShaderProgramBinary binary;
+        GLsizei written(0);
+        binary.m_sourceHash = sourceHash;
+        binary.m_buildSeconds = F32(buildSeconds);
+        binary.m_uniformTable = tableRef;
+        binary.m_binary.resize(length);
+        glGetProgramBinary(m_id, length, &written, &binary.m_format, &binary.m_binary[0]);
+        if(!GF_CHECK_GL_ERROR_TRC("GLSLShader::StoreProgramBinary(): ") || written <= 0) {
+            return;
+        }
+        binary.m_binary.resize(written);
+
+        if(!m_programCachePtr->Store(binary)) {
+            GF_LOG_TRACE_ERR("GLSLShader::StoreProgramBinary()", std::string("Failed to write the program binary to ") + m_programCachePtr->GetEntryPath(sourceHash).string());
+        }
+    }
+
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
@@ -507,144 +476,56 @@ namespace GameHalloran {
         }
 
         if(result) {
-            ShaderProgram vsProg(GL_VERTEX_SHADER);         // Vertex shader program.
-            ShaderProgram gsProg(GL_GEOMETRY_SHADER);       // Gemoetry shader.
-            ShaderProgram fsProg(GL_FRAGMENT_SHADER);       // Fragment shader program.
-
-            // A) Load the shader programs from a file.
-            if(!LoadSrc(vsSrc, vsProg.GetShaderId())) {
-                messageRef.assign(string("Failed to load the vertex shader source."));
-                result = false;
-            }
-            if(result && includeGeometryShader && !LoadSrc(gsSrc, gsProg.GetShaderId())) {
-                messageRef.assign(string("Failed to load the geometry shader source."));
-                result = false;
-            }
-            if(result && !LoadSrc(fsSrc, fsProg.GetShaderId())) {
-                messageRef.assign(string("Failed to load the fragment shader source."));
-                result = false;
-            }
-
-            // B) Compile shader programs and check for errors.
-            if(result) {
-                GF_CLEAR_GL_ERROR();
-
-                glCompileShader(vsProg.GetShaderId());
-                GF_CHECK_GL_ERROR();
-                if(includeGeometryShader) {
-                    glCompileShader(gsProg.GetShaderId());
-                    GF_CHECK_GL_ERROR();
-                }
-                glCompileShader(fsProg.GetShaderId());
-                GF_CHECK_GL_ERROR();
-
-                // Check for errors in all shaders
-                GLint compileStatus;
-
-                // 1) Vertex shader.
-                glGetShaderiv(vsProg.GetShaderId(), GL_COMPILE_STATUS, &compileStatus);
-                if(compileStatus == GL_FALSE) {
-                    const I32 bufSize = 1024;
-                    char buf[bufSize];
-                    glGetShaderInfoLog(vsProg.GetShaderId(), bufSize, NULL, buf);
-                    messageRef.assign(string("The vertex shader failed to compile, error: ") + string(buf));
-                    result = false;
+            Timer buildTimer;
+            ShaderProgramBinary binary;
+            bool loaded = false;
+            const U64 sourceHash = m_programCachePtr ? HashShaderProgramSource(vsSrc, includeGeometryShader ? gsSrc : NULL, fsSrc, vsAttList) : 0;
+
+            buildTimer.Start();
+
+            // A) Create the program from the binary and uniform table saved by an earlier run.
+            if(m_programCachePtr && m_programCachePtr->Load(sourceHash, binary)) {
+                loaded = LoadProgramBinary(binary);
+                if(loaded) {
+                    // Leave the program active, as building from source does.
+                    Activate();
+                    LocateUniforms(binary.m_uniformTable);
+                    m_programCachePtr->RecordHit(buildTimer.GetTime(), binary.m_buildSeconds);
+                } else {
+                    // Rebuild from source, which replaces the entry.
+                    m_programCachePtr->RecordRejected();
                 }
-                GF_CHECK_GL_ERROR();
+            }
 
-                // 2) Geometry shader.
-                if(result && includeGeometryShader) {
-                    glGetShaderiv(gsProg.GetShaderId(), GL_COMPILE_STATUS, &compileStatus);
-                    if(compileStatus == GL_FALSE) {
-                        const I32 bufSize = 1024;
-                        char buf[bufSize];
-                        glGetShaderInfoLog(gsProg.GetShaderId(), bufSize, NULL, buf);
-                        messageRef.assign(string("The geometry shader failed to compile, error: ") + string(buf));
-                        result = false;
-                    }
-                    GF_CHECK_GL_ERROR();
-                }
+            // B) Build the program from source and search for the uniforms it declares.
+            if(!loaded) {
+                ShaderUniformTable uniformTable;
 
-                // 3) Fragment shader.
+                result = CompileAndLinkProgram(vsSrc, gsSrc, fsSrc, vsAttList, messageRef, includeGeometryShader);
                 if(result) {
-                    glGetShaderiv(fsProg.GetShaderId(), GL_COMPILE_STATUS, &compileStatus);
-                    if(compileStatus == GL_FALSE) {
-                        const I32 bufSize = 1024;
-                        char buf[bufSize];
-                        glGetShaderInfoLog(fsProg.GetShaderId(), bufSize, NULL, buf);
-                        messageRef.assign(string("The fragment shader failed to compile, error: ") + string(buf));
+                    if(!ParseShaderUniforms(vsSrc, uniformTable)) {
                         result = false;
                     }
-                    GF_CHECK_GL_ERROR();
-                }
-            }
-
-            // C) Create GLSL program and link shader programs. Bind attribute names
-            //      for the vertex shader. Check for linking errors.
-            if(result) {
-                // Create the final program object, and attach the shaders
-                GLuint tmpGlslProgId = glCreateProgram();
-                GF_CHECK_GL_ERROR();
-
-                glAttachShader(tmpGlslProgId, vsProg.GetShaderId());
-                GF_CHECK_GL_ERROR();
-                if(includeGeometryShader) {
-                    glAttachShader(tmpGlslProgId, gsProg.GetShaderId());
-                    GF_CHECK_GL_ERROR();
-                }
-                glAttachShader(tmpGlslProgId, fsProg.GetShaderId());
-                GF_CHECK_GL_ERROR();
-
-                // Bind the attribute names to their specific locations.
-                I32 index = 0;
-                for(VSAttributeNameList::const_iterator curr = vsAttList.begin(), end = vsAttList.end(); curr != end; ++curr, ++index) {
-                    // If we are not supposed to ignore this slot.
-                    if((*curr).compare(g_ignoreShaderSlot.c_str()) != 0) {
-                        // Bind the attribute to the current slot index.
-                        glBindAttribLocation(tmpGlslProgId, index, const_cast<char *>((*curr).c_str()));
-                        GF_CHECK_GL_ERROR();
-                    }
-                }
-
-                // Attempt to link and check result.
-                GLint linkStatus;
-                glLinkProgram(tmpGlslProgId);
-
-                // Clear out GL error on release builds first...
-                GLenum errCode;
-                do {
-                    errCode = glGetError();
-                } while(errCode != GL_NO_ERROR);
-
-                glGetProgramiv(tmpGlslProgId, GL_LINK_STATUS, &linkStatus);
-
-                // NB - Leave check in on all builds to clean up GPU resources on any error..
-                errCode = glGetError();
-                if(linkStatus == GL_FALSE || errCode != GL_NO_ERROR) {
-                    const I32 bufSize = 1024;
-                    char buf[bufSize];
-                    glGetProgramInfoLog(tmpGlslProgId, bufSize, NULL, buf);
-                    messageRef.assign(string("Failed to link GLSL program, error: ") + string(buf));
-                    glDeleteProgram(tmpGlslProgId);
-                    result = false;
-                }
-
-                // Set the new GLSL program ID and search for uniform locations before exit.
-                if(result) {
-                    FreeProgram();
-                    m_id = tmpGlslProgId;
-
-                    // Search for the shader uniforms now that the GLSL program has been compiled and linked.
-                    if(!ParseSrcForUniforms(vsSrc)) {
+                    if(result && includeGeometryShader && !ParseShaderUniforms(gsSrc, uniformTable)) {
                         result = false;
                     }
-                    if(result && includeGeometryShader && !ParseSrcForUniforms(gsSrc)) {
+                    if(result && !ParseShaderUniforms(fsSrc, uniformTable)) {
                         result = false;
                     }
-                    if(result && !ParseSrcForUniforms(fsSrc)) {
+                    if(result && !QueryUniformLocations(uniformTable)) {
                         result = false;
                     }
                 }
+                if(result) {
+                    LocateUniforms(uniformTable);
+                }
+
+                // C) Save the program for the next run.
+                if(result && m_programCachePtr) {
+                    const F64 buildSeconds = buildTimer.GetTime();
+                    m_programCachePtr->RecordMiss(buildSeconds);
+                    StoreProgramBinary(sourceHash, uniformTable, buildSeconds);
+                }
             }
         }
 
@@ -703,6 +584,33 @@ namespace GameHalloran {
         return ((*i).second);
     }
 
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    GLuint GLSLShader::GetUniformBlockIndex(const std::string &blockName) const
+    {
+        UniformBlockIndexMap::const_iterator i = m_uniformBlockMap.find(blockName);
+        if(i == m_uniformBlockMap.end()) {
+            return (GL_INVALID_INDEX);
+        }
+        return ((*i).second);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool GLSLShader::BindUniformBlock(const std::string &blockName, const GLuint bindingPoint)
+    {
+        const GLuint index = GetUniformBlockIndex(blockName);
+        if(index == GL_INVALID_INDEX) {
+            return (false);
+        }
+
+        GF_CLEAR_GL_ERROR();
+        glUniformBlockBinding(m_id, index, bindingPoint);
+        return (GF_CHECK_GL_ERROR_TRC("GLSLShader::BindUniformBlock(): "));
+    }
+
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
@@ -808,7 +716,8 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
-    boost::shared_ptr<GLSLShader> BuildShaderFromResourceCache(const std::string &shaderName, const VSAttributeNameList &vsNameList)
+    boost::shared_ptr<GLSLShader> BuildShaderFromResourceCache(const std::string &shaderName, const VSAttributeNameList &vsNameList, \
+                                                               const ShaderDefineList &defines)
     {
         boost::shared_ptr<GLSLShader> null;
         boost::shared_ptr<GLSLShader> shaderObj;
@@ -823,10 +732,18 @@ namespace GameHalloran {
             return (null);
         }
 
+        // Programs packed in the shader archive are built without reading their source files.
+        const std::string programName(GetShaderPermutationName(shaderName, defines));
+        boost::shared_ptr<ShaderArchive> archivePtr(g_appPtr->GetShaderArchivePtr());
+        if(archivePtr && archivePtr->Find(programName)) {
+            return (BuildShaderFromArchive(*archivePtr, programName, vsNameList));
+        }
+
         const U32 SIZE = 3;                         // Number of shader types.
         const U32 optionalI = 1;                        // Index of the optional (geometry) shader.
         std::string shaderExt[SIZE];                            // Array of shader extensions.
         boost::shared_ptr<TextResHandle> shaderTextArr[SIZE];   // Array of shader text data.
+        std::string shaderSrcArr[SIZE];                         // Array of shader source with the defines inserted.
         bool error = false;                                     // Error flag.
 
         // Initialize the arrays
@@ -858,26 +775,41 @@ namespace GameHalloran {
             }
         }
 
+        // Insert the defines of the permutation.  The sources in the resource cache have no includes to expand.
+        for(U32 index = 0; ((!error) && (!defines.empty()) && (index < SIZE)); ++index) {
+            std::string message;
+            if(shaderTextArr[index] && !PreprocessShaderSource(shaderTextArr[index]->GetTextBuffer(), boost::filesystem::path(), defines, shaderSrcArr[index], message)) {
+                GF_LOG_TRACE_ERR("BuildShaderFromResourceCache()", std::string("Failed to preprocess ") + shaderName + shaderExt[index] + std::string(": ") + message);
+                error = true;
+            }
+        }
+
         // Build the shader if we got the required shader source files from the resource cache.
         if(!error) {
             shaderObj.reset(GCC_NEW GLSLShader());
             if(!shaderObj) {
                 GF_LOG_TRACE_ERR("BuildShaderFromResourceCache()", "Failed to allocate memory for the new GLSLShader object");
             } else {
+                shaderObj->SetProgramCache(g_appPtr->GetShaderProgramCachePtr());
+
                 std::string errorMsg;                   // Error messages from GLSL compiler.
                 bool buildResult = true;                // Result of GLSL program build.
+                const char *srcArr[SIZE];               // Source of each shader to build.
+                for(U32 index = 0; index < SIZE; ++index) {
+                    srcArr[index] = !shaderTextArr[index] ? NULL : (defines.empty() ? shaderTextArr[index]->GetTextBuffer() : shaderSrcArr[index].c_str());
+                }
 
                 // Case 1: The program has a geometry shader.
                 if(shaderTextArr[optionalI]) {
-                    buildResult = shaderObj->Build(shaderTextArr[0]->GetTextBuffer(), shaderTextArr[1]->GetTextBuffer(), shaderTextArr[2]->GetTextBuffer(), vsNameList, errorMsg);
+                    buildResult = shaderObj->Build(srcArr[0], srcArr[1], srcArr[2], vsNameList, errorMsg);
                 }
                 // Case 2: The program has just a vertex and fragment shader.
                 else {
-                    buildResult = shaderObj->Build(shaderTextArr[0]->GetTextBuffer(), shaderTextArr[2]->GetTextBuffer(), vsNameList, errorMsg);
+                    buildResult = shaderObj->Build(srcArr[0], srcArr[2], vsNameList, errorMsg);
                 }
 
                 if(!buildResult) {
-                    GF_LOG_TRACE_ERR("BuildShaderFromResourceCache()", std::string("Failed to build the ") + shaderName + std::string(" shader: ") + errorMsg);
+                    GF_LOG_TRACE_ERR("BuildShaderFromResourceCache()", std::string("Failed to build the ") + programName + std::string(" shader: ") + errorMsg);
                     error = true;
                 }
             }
@@ -886,4 +818,41 @@ namespace GameHalloran {
         return (error ? null : shaderObj);
     }
 
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    boost::shared_ptr<GLSLShader> BuildShaderFromArchive(const ShaderArchive &archiveRef, const std::string &programName, const VSAttributeNameList &vsNameList)
+    {
+        boost::shared_ptr<GLSLShader> null;
+
+        const ShaderArchiveProgram *programPtr = archiveRef.Find(programName);
+        if(!programPtr) {
+            GF_LOG_TRACE_ERR("BuildShaderFromArchive()", std::string("The ") + programName + std::string(" program is not in the shader archive"));
+            return (null);
+        }
+
+        boost::shared_ptr<GLSLShader> shaderObj(GCC_NEW GLSLShader());
+        if(!shaderObj) {
+            GF_LOG_TRACE_ERR("BuildShaderFromArchive()", "Failed to allocate memory for the new GLSLShader object");
+            return (null);
+        }
+        shaderObj->SetProgramCache(g_appPtr->GetShaderProgramCachePtr());
+
+        // Built as BuildShaderFromResourceCache() builds the program from its source files.
+        std::string errorMsg;                   // Error messages from GLSL compiler.
+        bool buildResult = true;                // Result of GLSL program build.
+        if(programPtr->m_gsSrc) {
+            buildResult = shaderObj->Build(programPtr->m_vsSrc, programPtr->m_gsSrc, programPtr->m_fsSrc, vsNameList, errorMsg);
+        } else {
+            buildResult = shaderObj->Build(programPtr->m_vsSrc, programPtr->m_fsSrc, vsNameList, errorMsg);
+        }
+
+        if(!buildResult) {
+            GF_LOG_TRACE_ERR("BuildShaderFromArchive()", std::string("Failed to build the ") + programName + std::string(" shader: ") + errorMsg);
+            return (null);
+        }
+
+        return (shaderObj);
+    }
+
 }
@@ -22,6 +22,8 @@
 #include "GameBase.h"
 #include "ICleanableObserver.h"
 #include "ShaderUniform.h"
+#include "ShaderProgramCache.h"
+#include "ShaderArchive.h"
 #include "Vector.h"
 #include "Matrix.h"
 
@@ -59,6 +61,9 @@ namespace GameHalloran {
 
         typedef std::map<std::string, GLint> UniformLocationMap;
         UniformLocationMap m_uniformMap;            ///< Map of uniform variable names to their locations in the shader program.
+        typedef std::map<std::string, GLuint> UniformBlockIndexMap;
+        UniformBlockIndexMap m_uniformBlockMap;     ///< Map of uniform block names to their indices in the shader program.
+        boost::shared_ptr<ShaderProgramCache> m_programCachePtr;    ///< Cache of program binaries, NULL to always build from source.
 
         // /////////////////////////////////////////////////////////////////
         // Uses OpenGL to validate the program.
@@ -68,17 +73,6 @@ namespace GameHalloran {
         // /////////////////////////////////////////////////////////////////
         bool ValidateProgram() const;
 
-        // /////////////////////////////////////////////////////////////////
-        // Load the shader source from a file.
-        //
-        // @param filenameRef The name of the file on the filesystem.
-        // @param The ID of the shader object.
-        //
-        // @bool True on sucess.
-        //
-        // /////////////////////////////////////////////////////////////////
-        bool LoadSrcFromFile(const boost::filesystem::path &filenameRef, const GLuint shaderId) const;
-
         // /////////////////////////////////////////////////////////////////
         // Load the shader source from a char array.
         //
@@ -91,42 +85,53 @@ namespace GameHalloran {
         bool LoadSrc(const char *src, const GLuint shaderId) const;
 
         // /////////////////////////////////////////////////////////////////
-        // Parse through the shader source for the uniform variable names
-        // so we may get their locations.
-        //
-        // The shader must have been succesfully compiled and activated
-        // for this call to work successfully.
+        // Get the locations of the uniforms and the indices of the uniform
+        // blocks in the table from the linked program.
         //
-        // @param src The shader source code.
+        // @param tableRef The uniforms parsed from the program source.
         //
         // @return bool True|False on success or failure.
         //
         // /////////////////////////////////////////////////////////////////
-        bool ParseSrcForUniforms(const char *src);
+        bool QueryUniformLocations(ShaderUniformTable &tableRef);
 
         // /////////////////////////////////////////////////////////////////
-        // Parse through the shader source for the uniform variable names
-        // so we may get their locations.
+        // Create the program uniforms and cache the uniform locations and
+        // block indices from the table.
         //
-        // The shader must have been succesfully compiled and activated
-        // for this call to work successfully.
+        // @param tableRef The uniforms of the program and their locations.
         //
-        // @param src The shader source code.
+        // /////////////////////////////////////////////////////////////////
+        void LocateUniforms(const ShaderUniformTable &tableRef);
+
+        // /////////////////////////////////////////////////////////////////
+        // Compile the shaders and link them into the program.
         //
-        // @return bool True|False on success or failure.
+        // The parameters are as for BuildProgramFromSrc().
+        //
+        // @return bool False if we fail to build or link the shaders.
         //
         // /////////////////////////////////////////////////////////////////
-        bool ParseFileForUniforms(const boost::filesystem::path &filenameRef);
+        bool CompileAndLinkProgram(const char *vsSrc, const char *gsSrc, const char *fsSrc, const VSAttributeNameList &vsAttList, std::string &messageRef, const bool includeGeometryShader);
 
         // /////////////////////////////////////////////////////////////////
-        // Locate the program uniforms from the vector of program source lines.
+        // Create the program from a binary saved by the program cache.
         //
-        // @param linesVec Container of source code lines.
+        // @return bool False if the driver refuses the binary.
         //
-        // @return bool True|False on success or failure.
+        // /////////////////////////////////////////////////////////////////
+        bool LoadProgramBinary(const ShaderProgramBinary &binaryRef);
+
+        // /////////////////////////////////////////////////////////////////
+        // Save the binary of the program and its uniform table to the
+        // program cache.
+        //
+        // @param sourceHash HashShaderProgramSource() of the program.
+        // @param tableRef The uniforms of the program.
+        // @param buildSeconds Time taken to build the program from source.
         //
         // /////////////////////////////////////////////////////////////////
-        bool LocateUniforms(const std::vector<std::string> &linesVec);
+        void StoreProgramBinary(const U64 sourceHash, const ShaderUniformTable &tableRef, const F64 buildSeconds);
 
         // /////////////////////////////////////////////////////////////////
         // Build the GLSL program.
@@ -238,7 +243,7 @@ namespace GameHalloran {
         // Default constructor.
         //
         // /////////////////////////////////////////////////////////////////
-        GLSLShader() : m_id(0), m_uniforms(), m_dirtyList(), m_uniformMap() { };
+        GLSLShader() : m_id(0), m_uniforms(), m_dirtyList(), m_uniformMap(), m_uniformBlockMap(), m_programCachePtr() { };
 
         // /////////////////////////////////////////////////////////////////
         // Destructor.
@@ -362,6 +367,18 @@ namespace GameHalloran {
             return (BuildProgramFromSrc(vsSrc, NULL, fsSrc, vsAttList, messageRef));
         };
 
+        // /////////////////////////////////////////////////////////////////
+        // Set the cache of program binaries used by the next builds.  On a
+        // cache hit the program is created from its binary and uniform
+        // table without compiling, linking or parsing the source.
+        //
+        // @param cachePtr The cache, or NULL to always build from source.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline void SetProgramCache(const boost::shared_ptr<ShaderProgramCache> &cachePtr) {
+            m_programCachePtr = cachePtr;
+        };
+
         // /////////////////////////////////////////////////////////////////
         // Make this shader program the current GL rendering shader program.
         //
@@ -411,6 +428,38 @@ namespace GameHalloran {
         // /////////////////////////////////////////////////////////////////
         GLint GetUniformLocation(const std::string &uniformName);
 
+        // /////////////////////////////////////////////////////////////////
+        // Get the index of a uniform block from the blocks cached earlier
+        // on program build.
+        //
+        // @param blockName The name of the uniform block.
+        //
+        // @return GLuint GL_INVALID_INDEX if not found or the block index.
+        //
+        // /////////////////////////////////////////////////////////////////
+        GLuint GetUniformBlockIndex(const std::string &blockName) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Does the program declare the uniform block?
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline bool HasUniformBlock(const std::string &blockName) const {
+            return (GetUniformBlockIndex(blockName) != GL_INVALID_INDEX);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Connect a uniform block of the program to a uniform buffer
+        // binding point, so the UniformBlock bound there feeds it.
+        //
+        // @param blockName The name of the uniform block.
+        // @param bindingPoint The uniform buffer binding point.
+        //
+        // @return bool False if the program has no such block or on a GL
+        //              error.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool BindUniformBlock(const std::string &blockName, const GLuint bindingPoint);
+
         // /////////////////////////////////////////////////////////////////
         // Frees the GLSL program.
         //
@@ -512,19 +561,41 @@ namespace GameHalloran {
 
     // /////////////////////////////////////////////////////////////////
     // Builds a shader after retrieving its source from the global
-    // ResourceCache manager.
+    // ResourceCache manager.  Programs in the shader archive loaded by
+    // the application are built from the archive instead, using the
+    // permutation named by GetShaderPermutationName().
     //
     // @param shaderName The ID/path of the shaders to retrieve from the
     //                      resource cache manager (excluding the final
     //                      shader extension, e.g. "shaders\\flat" or
     //                      "flat").
     // @param vsNameList List of vertex attributes order information.
+    // @param defines The defines of the permutation to build, inserted
+    //                  after the #version line of the source files
+    //                  [optional].
+    //
+    // @return boost::shared_ptr<GLSLShader> A pointer to a GLSLShader
+    //                                          object or NULL on failure.
+    //
+    // /////////////////////////////////////////////////////////////////
+    boost::shared_ptr<GLSLShader> BuildShaderFromResourceCache(const std::string &shaderName, const VSAttributeNameList &vsNameList, \
+                                                               const ShaderDefineList &defines = ShaderDefineList());
+
+    // /////////////////////////////////////////////////////////////////
+    // Builds a shader from the source packed in a shader archive by the
+    // glslc build tool.
+    //
+    // @param archiveRef The shader archive.
+    // @param programName The name of the program in the archive, as
+    //                      given to BuildShaderFromResourceCache() or
+    //                      from GetShaderPermutationName().
+    // @param vsNameList List of vertex attributes order information.
     //
     // @return boost::shared_ptr<GLSLShader> A pointer to a GLSLShader
     //                                          object or NULL on failure.
     //
     // /////////////////////////////////////////////////////////////////
-    boost::shared_ptr<GLSLShader> BuildShaderFromResourceCache(const std::string &shaderName, const VSAttributeNameList &vsNameList);
+    boost::shared_ptr<GLSLShader> BuildShaderFromArchive(const ShaderArchive &archiveRef, const std::string &programName, const VSAttributeNameList &vsNameList);
 
 }
 
@@ -74,8 +74,9 @@ namespace GameHalloran {
     {
         Clear();
 
-        // Delete buffer objects
-        if(resetGlBuffers) {
+        // Delete buffer objects (only if End() created them, so a batch can be
+        //  built on a thread without a GL context).
+        if(resetGlBuffers && m_bufferObjects[VERTEX_DATA] != 0) {
             glDeleteBuffers(4, m_bufferObjects);
             memset(m_bufferObjects, 0, sizeof(GLuint) * 4);
 #ifndef OPENGL_ES
@@ -178,7 +178,11 @@ namespace GameHalloran {
         // /////////////////////////////////////////////////////////////////
         // Check if the ray intersects with this SceneNode.
         //
-        // @param scenePtr SceneGraph manager pointer.
+        // Picking tests the bounding volumes of what is drawn, including
+        // nodes with no physics body, on the thread that owns the scene
+        // graph.  To find the actors a ray hits in the simulation use
+        // IGamePhysics::VRayCastBatch() instead.
+        //
         // @param ray Raycast.
         //
         // /////////////////////////////////////////////////////////////////
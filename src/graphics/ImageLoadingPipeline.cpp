@@ -0,0 +1,229 @@
+// /////////////////////////////////////////////////////////////////
+// @file ImageLoadingPipeline.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Implementation of the ImageLoadingPipeline class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <string>
+
+#include "ImageLoadingPipeline.h"
+#include "ResCache2.h"
+#include "GameMain.h"
+
+namespace GameHalloran {
+
+    const U32 ImageLoadingPipeline::INVALID_IMAGE_INDEX;
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ImageLoadingPipeline::DecodeImage(const U32 index)
+    {
+        ImageEntry &entry = m_images[index];
+
+        // No logging here, the logger is not thread safe.
+        if(!entry.m_failed && !entry.m_handlePtr->Decode(entry.m_errorMsg)) {
+            entry.m_failed = true;
+        }
+
+        if(!m_mutex) {
+            --m_tasksPending;
+            return;
+        }
+
+        glfwLockMutex(m_mutex);
+        if(--m_tasksPending == 0) {
+            glfwBroadcastCond(m_decodeDoneCond);
+        }
+        glfwUnlockMutex(m_mutex);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ImageLoadingPipeline::WaitForDecodes()
+    {
+        glfwLockMutex(m_mutex);
+        while(m_tasksPending > 0) {
+            glfwWaitCond(m_decodeDoneCond, m_mutex, GLFW_INFINITY);
+        }
+        glfwUnlockMutex(m_mutex);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    ImageLoadingPipeline::ImageLoadingPipeline(ResCache *resCachePtr, boost::shared_ptr<WorkerThreadPool> poolPtr)\
+:
+    m_resCachePtr(resCachePtr)
+    , m_poolPtr(poolPtr)
+    , m_images()
+    , m_mutex(NULL)
+    , m_decodeDoneCond(NULL)
+    , m_tasksPending(0)
+    , m_started(false)
+    , m_finished(false)
+    {
+        m_mutex = glfwCreateMutex();
+        m_decodeDoneCond = glfwCreateCond();
+        if(!m_mutex || !m_decodeDoneCond) {
+            // Fall back to decoding everything on the calling thread.
+            GF_LOG_TRACE_ERR("ImageLoadingPipeline::ImageLoadingPipeline()", "Failed to create the thread synchronization objects");
+            m_poolPtr.reset();
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    ImageLoadingPipeline::~ImageLoadingPipeline()
+    {
+        try {
+            if(m_started && m_poolPtr) {
+                WaitForDecodes();
+            }
+            if(m_decodeDoneCond) {
+                glfwDestroyCond(m_decodeDoneCond);
+            }
+            if(m_mutex) {
+                glfwDestroyMutex(m_mutex);
+            }
+        } catch(...) {}
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 ImageLoadingPipeline::AddImage(const std::string &imageName)
+    {
+        for(U32 i = 0; i < m_images.size(); ++i) {
+            // Two tasks must not decode the same cached handle.
+            if(m_images[i].m_imageName == imageName) {
+                return (i);
+            }
+        }
+
+        if(m_started) {
+            GF_LOG_TRACE_ERR("ImageLoadingPipeline::AddImage()", std::string("Cannot add an image after the pipeline has started: ") + imageName);
+            return (INVALID_IMAGE_INDEX);
+        }
+        m_images.push_back(ImageEntry(imageName));
+
+        return (U32(m_images.size() - 1));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ImageLoadingPipeline::Start()
+    {
+        if(m_started) {
+            GF_LOG_TRACE_ERR("ImageLoadingPipeline::Start()", "The pipeline has already been started");
+            return (false);
+        }
+        m_started = true;
+
+        // Read all the files up front as the resource cache is not thread safe.
+        for(std::vector<ImageEntry>::iterator i = m_images.begin(), end = m_images.end(); i != end; ++i) {
+            if(FindImageTypeFromFile(i->m_imageName) == IMAGE_TYPE_UNKNOWN) {
+                GF_LOG_TRACE_ERR("ImageLoadingPipeline::Start()", std::string("Image type not supported: ") + i->m_imageName);
+                i->m_failed = true;
+                continue;
+            }
+
+            ImageResource imgRes(i->m_imageName);
+            if(m_resCachePtr) {
+                i->m_handlePtr = boost::static_pointer_cast<ImageResHandle>(m_resCachePtr->GetHandle(&imgRes));
+            }
+            if(!i->m_handlePtr) {
+                GF_LOG_TRACE_ERR("ImageLoadingPipeline::Start()", std::string("Failed to retrieve the resource ") + i->m_imageName);
+                i->m_failed = true;
+            }
+        }
+
+        if(m_mutex) {
+            glfwLockMutex(m_mutex);
+            m_tasksPending = U32(m_images.size());
+            glfwUnlockMutex(m_mutex);
+        } else {
+            m_tasksPending = U32(m_images.size());
+        }
+
+        for(U32 i = 0; i < m_images.size(); ++i) {
+            if(!m_poolPtr || !m_poolPtr->AddTask(WorkerTaskPtr(GCC_NEW ImageDecodeTask(this, i)))) {
+                DecodeImage(i);
+            }
+        }
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ImageLoadingPipeline::Finish()
+    {
+        if(!m_started && !Start()) {
+            return (false);
+        }
+        if(m_finished) {
+            GF_LOG_TRACE_ERR("ImageLoadingPipeline::Finish()", "The pipeline has already finished");
+            return (false);
+        }
+        m_finished = true;
+
+        if(m_poolPtr) {
+            WaitForDecodes();
+        }
+
+        bool result = true;
+        for(std::vector<ImageEntry>::iterator i = m_images.begin(), end = m_images.end(); i != end; ++i) {
+            if(i->m_failed) {
+                if(i->m_handlePtr) {
+                    GF_LOG_TRACE_ERR("ImageLoadingPipeline::Finish()", i->m_errorMsg.empty() ? \
+                                     std::string("Failed to decode the image ") + i->m_imageName : i->m_errorMsg);
+                }
+                result = false;
+            }
+        }
+
+        return (result);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ImageLoadingPipeline::IsDecodeComplete()
+    {
+        if(!m_started) {
+            return (false);
+        }
+
+        bool complete;
+        if(m_mutex) {
+            glfwLockMutex(m_mutex);
+            complete = (m_tasksPending == 0);
+            glfwUnlockMutex(m_mutex);
+        } else {
+            complete = (m_tasksPending == 0);
+        }
+
+        return (complete);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    boost::shared_ptr<ImageResHandle> ImageLoadingPipeline::GetImage(const U32 index) const
+    {
+        if(index >= m_images.size() || m_images[index].m_failed) {
+            return (boost::shared_ptr<ImageResHandle>());
+        }
+
+        return (m_images[index].m_handlePtr);
+    }
+
+}
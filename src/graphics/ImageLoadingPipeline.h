@@ -0,0 +1,184 @@
+#pragma once
+#ifndef __GF_IMAGE_LOADING_PIPELINE_H
+#define __GF_IMAGE_LOADING_PIPELINE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file ImageLoadingPipeline.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header for the ImageLoadingPipeline class which decodes a group of
+// images in parallel on the WorkerThreadPool.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include "GameBase.h"
+#include "ImageResource.h"
+#include "WorkerThreadPool.h"
+
+namespace GameHalloran {
+
+    class ResCache;
+
+    // /////////////////////////////////////////////////////////////////
+    // @class ImageLoadingPipeline
+    // @author PJ O Halloran
+    //
+    // Reads a group of images from the resource cache and decodes each
+    // one on a worker thread.
+    //
+    //  Main thread:    Read the image files from the resource cache
+    //                  (Start()).
+    //  Worker thread:  Decode the image (ImageResHandle::Decode()).
+    //  Main thread:    Wait for the workers and report failures
+    //                  (Finish()).
+    //
+    // The decoded handles stay in the resource cache, so the
+    // TextureManager finds them already initialized when the textures
+    // are created later in the load.  Keep the pipeline alive until then
+    // to stop the cache releasing them.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class ImageLoadingPipeline : public NonCopyable {
+    private:
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct ImageEntry
+        //
+        // Input and output of a single image.  Only the worker decoding
+        // the image uses an entry until the pipeline has finished.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct ImageEntry {
+            std::string m_imageName;                        ///< RC ID of the image.
+            boost::shared_ptr<ImageResHandle> m_handlePtr;  ///< The image resource.
+            bool m_failed;                                  ///< Did loading the image fail?
+            std::string m_errorMsg;                         ///< Why decoding failed, logged by Finish().
+
+            explicit ImageEntry(const std::string &imageName) : m_imageName(imageName), m_handlePtr(), m_failed(false), m_errorMsg() {};
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // @class ImageDecodeTask
+        //
+        // Worker task which decodes one image.
+        //
+        // /////////////////////////////////////////////////////////////////
+        class ImageDecodeTask : public IWorkerTask {
+        private:
+            ImageLoadingPipeline *m_pipelinePtr;            ///< Owning pipeline.
+            const U32 m_index;                              ///< Index of the image to decode.
+        public:
+            ImageDecodeTask(ImageLoadingPipeline *pipelinePtr, const U32 index) : m_pipelinePtr(pipelinePtr), m_index(index) {};
+            virtual void VExecute() {
+                m_pipelinePtr->DecodeImage(m_index);
+            };
+        };
+
+        ResCache *m_resCachePtr;                            ///< Cache the images are read from.
+        boost::shared_ptr<WorkerThreadPool> m_poolPtr;      ///< Pool to decode on, may be NULL.
+        std::vector<ImageEntry> m_images;                   ///< The images to load.
+        GLFWmutex m_mutex;                                  ///< Guards m_tasksPending.
+        GLFWcond m_decodeDoneCond;                          ///< Signalled when the last image is decoded.
+        U32 m_tasksPending;                                 ///< Number of images still being decoded on the workers.
+        bool m_started;                                     ///< Has Start() been called?
+        bool m_finished;                                    ///< Has Finish() been called?
+
+        // /////////////////////////////////////////////////////////////////
+        // Decode an image.  Called on a worker thread.
+        //
+        // @param index The index of the image.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void DecodeImage(const U32 index);
+
+        // /////////////////////////////////////////////////////////////////
+        // Block until all the images have been decoded.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void WaitForDecodes();
+
+    public:
+
+        static const U32 INVALID_IMAGE_INDEX = 0xFFFFFFFF;  ///< Index returned when an image cannot be added.
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // @param resCachePtr The resource cache to read the images from.
+        //                      Must outlive the pipeline.
+        // @param poolPtr The worker pool to use.  If NULL then the images
+        //                  are decoded on the calling thread.
+        //
+        // /////////////////////////////////////////////////////////////////
+        ImageLoadingPipeline(ResCache *resCachePtr, boost::shared_ptr<WorkerThreadPool> poolPtr);
+
+        // /////////////////////////////////////////////////////////////////
+        // Destructor.  Waits for any images still being decoded.
+        //
+        // /////////////////////////////////////////////////////////////////
+        ~ImageLoadingPipeline();
+
+        // /////////////////////////////////////////////////////////////////
+        // Add an image to be loaded.  Must be called before Start().
+        // Adding the same image twice returns the first index.
+        //
+        // @param imageName The RC ID/name of the image file.
+        //
+        // @return U32 Index of the image used to retrieve the result or
+        //              INVALID_IMAGE_INDEX if the pipeline has started.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U32 AddImage(const std::string &imageName);
+
+        // /////////////////////////////////////////////////////////////////
+        // Read all the image files from the resource cache and hand them
+        // to the worker threads.  Main thread only.
+        //
+        // @return bool False if the pipeline was already started.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool Start();
+
+        // /////////////////////////////////////////////////////////////////
+        // Wait for the workers to decode every image.  Main thread only.
+        //
+        // @return bool True if every image was loaded and false if any
+        //              failed (check log file).
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool Finish();
+
+        // /////////////////////////////////////////////////////////////////
+        // Have all the images been decoded?  When true Finish() will not
+        // block.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool IsDecodeComplete();
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of images added to the pipeline.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetNumberImages() const {
+            return (U32(m_images.size()));
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the decoded image after Finish().
+        //
+        // @return boost::shared_ptr<ImageResHandle> NULL if the image
+        //                                              failed to load.
+        //
+        // /////////////////////////////////////////////////////////////////
+        boost::shared_ptr<ImageResHandle> GetImage(const U32 index) const;
+    };
+
+}
+
+#endif
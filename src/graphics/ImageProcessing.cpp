@@ -0,0 +1,642 @@
+// /////////////////////////////////////////////////////////////////
+// @file ImageProcessing.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Implementation of the CPU image processing functions.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <boost/algorithm/string/case_conv.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GF_IMAGE_PROCESSING_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "ImageProcessing.h"
+#include "ImageResource.h"
+
+namespace GameHalloran {
+
+    namespace {
+
+        const U32 MAX_FILTER_TAPS = 8;                  ///< Taps of the widest filter.
+        const F32 KAISER_ALPHA = 4.0f;                  ///< Kaiser window shape.
+        const F32 KAISER_HALF_WIDTH = 2.0f;             ///< Kaiser window half width in output texels.
+        const U32 SRGB_ENCODE_TABLE_SIZE = 4096;        ///< Linear values quantized when encoding to sRGB.
+
+        // Global array of resample filter names.
+        const char * const gResampleFilterNames[] = {
+            "box",
+            "kaiser"
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct Kernel
+        //
+        // A separable filter halving an image.  Output texel x is the sum
+        // of weights[k] * input[2x + offset + k].
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct Kernel {
+            U32 m_taps;                                 ///< Number of input texels.
+            I32 m_offset;                               ///< First input texel relative to 2x.
+            F32 m_weights[MAX_FILTER_TAPS];             ///< Weight of each input texel.
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct Tables
+        //
+        // Look up tables converting between 8 bit channels and the floats
+        // (0 to 255) the filters work on.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct Tables {
+            F32 m_linear[256];                          ///< 8 bit value as is.
+            F32 m_srgbToLinear[256];                    ///< sRGB 8 bit value to linear.
+            U8 m_linearToSrgb[SRGB_ENCODE_TABLE_SIZE];  ///< Quantized linear value to sRGB 8 bit.
+            Kernel m_box;                               ///< 2x2 box filter.
+            Kernel m_kaiser;                            ///< 8x8 Kaiser filter.
+
+            Tables();
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Zeroth order modified Bessel function of the first kind.
+        //
+        // /////////////////////////////////////////////////////////////////
+        F64 BesselI0(const F64 x)
+        {
+            F64 sum = 1.0;
+            F64 term = 1.0;
+            for(U32 k = 1; k < 32; ++k) {
+                term *= (x / (2.0 * F64(k))) * (x / (2.0 * F64(k)));
+                sum += term;
+            }
+            return (sum);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        //
+        // /////////////////////////////////////////////////////////////////
+        Tables::Tables()
+        {
+            for(U32 i = 0; i < 256; ++i) {
+                const F64 v = F64(i) / 255.0;
+                m_linear[i] = F32(i);
+                m_srgbToLinear[i] = F32(255.0 * ((v <= 0.04045) ? (v / 12.92) : std::pow((v + 0.055) / 1.055, 2.4)));
+            }
+            for(U32 i = 0; i < SRGB_ENCODE_TABLE_SIZE; ++i) {
+                const F64 v = F64(i) / F64(SRGB_ENCODE_TABLE_SIZE - 1);
+                const F64 s = (v <= 0.0031308) ? (v * 12.92) : (1.055 * std::pow(v, 1.0 / 2.4) - 0.055);
+                m_linearToSrgb[i] = U8(std::min(255.0, std::floor(s * 255.0 + 0.5)));
+            }
+
+            m_box.m_taps = 2;
+            m_box.m_offset = 0;
+            m_box.m_weights[0] = m_box.m_weights[1] = 0.5f;
+
+            // Input texel 2x + offset + k is (offset + k - 0.5) input texels
+            //  from the centre of output texel x.
+            m_kaiser.m_taps = MAX_FILTER_TAPS;
+            m_kaiser.m_offset = -I32(MAX_FILTER_TAPS / 2) + 1;
+            F64 weights[MAX_FILTER_TAPS];
+            F64 total = 0.0;
+            for(U32 k = 0; k < MAX_FILTER_TAPS; ++k) {
+                const F64 t = (F64(m_kaiser.m_offset + I32(k)) - 0.5) / 2.0;
+                const F64 pt = 3.14159265358979323846 * t;
+                const F64 sinc = (t == 0.0) ? 1.0 : std::sin(pt) / pt;
+                const F64 w = t / KAISER_HALF_WIDTH;
+                weights[k] = sinc * BesselI0(KAISER_ALPHA * std::sqrt(std::max(0.0, 1.0 - w * w))) / BesselI0(KAISER_ALPHA);
+                total += weights[k];
+            }
+            for(U32 k = 0; k < MAX_FILTER_TAPS; ++k) {
+                m_kaiser.m_weights[k] = F32(weights[k] / total);
+            }
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the look up tables, built on first use.
+        //
+        // /////////////////////////////////////////////////////////////////
+        const Tables &GetTables()
+        {
+            static const Tables tables;
+            return (tables);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Repeat the edge texels of a decoded row padLeft times before and
+        // padRight times after the row.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void PadRow(const U32 width, const U32 padLeft, const U32 padRight, F32 *rowPtr)
+        {
+            for(U32 x = 0; x < padLeft; ++x) {
+                memcpy(rowPtr + x * 4, rowPtr + padLeft * 4, 4 * sizeof(F32));
+            }
+            for(U32 x = 0; x < padRight; ++x) {
+                memcpy(rowPtr + (padLeft + width + x) * 4, rowPtr + (padLeft + width - 1) * 4, 4 * sizeof(F32));
+            }
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Decode a row of 8 bit RGBA texels to floats, leaving padLeft
+        // texels free before the row for PadRow().
+        //
+        // /////////////////////////////////////////////////////////////////
+        void DecodeRowScalar(const U8 *rgbaPtr, const U32 width, const bool gammaCorrect, const Tables &tables, \
+                             const U32 padLeft, F32 *outPtr)
+        {
+            const F32 *colourTable = gammaCorrect ? tables.m_srgbToLinear : tables.m_linear;
+            outPtr += padLeft * 4;
+            for(U32 x = 0; x < width; ++x) {
+                outPtr[x * 4] = colourTable[rgbaPtr[x * 4]];
+                outPtr[x * 4 + 1] = colourTable[rgbaPtr[x * 4 + 1]];
+                outPtr[x * 4 + 2] = colourTable[rgbaPtr[x * 4 + 2]];
+                outPtr[x * 4 + 3] = tables.m_linear[rgbaPtr[x * 4 + 3]];
+            }
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Horizontally filter a decoded, padded row.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void FilterRowScalar(const F32 *rowPtr, const U32 outWidth, const Kernel &kernel, F32 *outPtr)
+        {
+            for(U32 x = 0; x < outWidth; ++x) {
+                const F32 *srcPtr = rowPtr + x * 8;
+                for(U32 c = 0; c < 4; ++c) {
+                    F32 acc = 0.0f;
+                    for(U32 k = 0; k < kernel.m_taps; ++k) {
+                        acc += kernel.m_weights[k] * srcPtr[k * 4 + c];
+                    }
+                    outPtr[x * 4 + c] = acc;
+                }
+            }
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Vertically filter horizontally filtered rows to an output row.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void FilterColumnsScalar(const F32 * const rowPtrs[MAX_FILTER_TAPS], const U32 outWidth, const Kernel &kernel, F32 *outPtr)
+        {
+            for(U32 i = 0; i < outWidth * 4; ++i) {
+                F32 acc = 0.0f;
+                for(U32 k = 0; k < kernel.m_taps; ++k) {
+                    acc += kernel.m_weights[k] * rowPtrs[k][i];
+                }
+                outPtr[i] = acc;
+            }
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Encode a filtered row of floats to 8 bit RGBA texels.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void EncodeRowScalar(const F32 *rowPtr, const U32 width, const bool gammaCorrect, const Tables &tables, U8 *outPtr)
+        {
+            const F32 srgbScale = F32(SRGB_ENCODE_TABLE_SIZE - 1) / 255.0f;
+            for(U32 i = 0; i < width * 4; ++i) {
+                const F32 v = std::min(std::max(rowPtr[i], 0.0f), 255.0f);
+                if(gammaCorrect && (i & 3) != 3) {
+                    outPtr[i] = tables.m_linearToSrgb[I32(v * srgbScale + 0.5f)];
+                } else {
+                    outPtr[i] = U8(I32(v + 0.5f));
+                }
+            }
+        }
+
+#ifdef GF_IMAGE_PROCESSING_SSE2
+
+        // /////////////////////////////////////////////////////////////////
+        //
+        // /////////////////////////////////////////////////////////////////
+        void DecodeRowSse2(const U8 *rgbaPtr, const U32 width, const bool gammaCorrect, const Tables &tables, \
+                           const U32 padLeft, F32 *outPtr)
+        {
+            // The sRGB table look ups are scalar.
+            if(gammaCorrect) {
+                DecodeRowScalar(rgbaPtr, width, gammaCorrect, tables, padLeft, outPtr);
+                return;
+            }
+
+            const __m128i zero = _mm_setzero_si128();
+            F32 *rowPtr = outPtr + padLeft * 4;
+            U32 x = 0;
+            for(; x + 4 <= width; x += 4) {
+                const __m128i texels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rgbaPtr + x * 4));
+                const __m128i lo = _mm_unpacklo_epi8(texels, zero);
+                const __m128i hi = _mm_unpackhi_epi8(texels, zero);
+                _mm_storeu_ps(rowPtr + x * 4, _mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)));
+                _mm_storeu_ps(rowPtr + x * 4 + 4, _mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)));
+                _mm_storeu_ps(rowPtr + x * 4 + 8, _mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)));
+                _mm_storeu_ps(rowPtr + x * 4 + 12, _mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)));
+            }
+            DecodeRowScalar(rgbaPtr + x * 4, width - x, false, tables, 0, rowPtr + x * 4);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        //
+        // /////////////////////////////////////////////////////////////////
+        void FilterRowSse2(const F32 *rowPtr, const U32 outWidth, const Kernel &kernel, F32 *outPtr)
+        {
+            __m128 weights[MAX_FILTER_TAPS];
+            for(U32 k = 0; k < kernel.m_taps; ++k) {
+                weights[k] = _mm_set1_ps(kernel.m_weights[k]);
+            }
+
+            if(kernel.m_taps == 2) {
+                for(U32 x = 0; x < outWidth; ++x) {
+                    __m128 acc = _mm_setzero_ps();
+                    acc = _mm_add_ps(acc, _mm_mul_ps(weights[0], _mm_loadu_ps(rowPtr + x * 8)));
+                    acc = _mm_add_ps(acc, _mm_mul_ps(weights[1], _mm_loadu_ps(rowPtr + x * 8 + 4)));
+                    _mm_storeu_ps(outPtr + x * 4, acc);
+                }
+            } else {
+                for(U32 x = 0; x < outWidth; ++x) {
+                    const F32 *srcPtr = rowPtr + x * 8;
+                    __m128 acc = _mm_setzero_ps();
+                    for(U32 k = 0; k < kernel.m_taps; ++k) {
+                        acc = _mm_add_ps(acc, _mm_mul_ps(weights[k], _mm_loadu_ps(srcPtr + k * 4)));
+                    }
+                    _mm_storeu_ps(outPtr + x * 4, acc);
+                }
+            }
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        //
+        // /////////////////////////////////////////////////////////////////
+        void FilterColumnsSse2(const F32 * const rowPtrs[MAX_FILTER_TAPS], const U32 outWidth, const Kernel &kernel, F32 *outPtr)
+        {
+            __m128 weights[MAX_FILTER_TAPS];
+            for(U32 k = 0; k < kernel.m_taps; ++k) {
+                weights[k] = _mm_set1_ps(kernel.m_weights[k]);
+            }
+
+            for(U32 i = 0; i < outWidth * 4; i += 4) {
+                __m128 acc = _mm_setzero_ps();
+                for(U32 k = 0; k < kernel.m_taps; ++k) {
+                    acc = _mm_add_ps(acc, _mm_mul_ps(weights[k], _mm_loadu_ps(rowPtrs[k] + i)));
+                }
+                _mm_storeu_ps(outPtr + i, acc);
+            }
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        //
+        // /////////////////////////////////////////////////////////////////
+        void EncodeRowSse2(const F32 *rowPtr, const U32 width, const bool gammaCorrect, const Tables &tables, U8 *outPtr)
+        {
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 max = _mm_set1_ps(255.0f);
+            const __m128 half = _mm_set1_ps(0.5f);
+
+            if(!gammaCorrect) {
+                U32 i = 0;
+                for(; i + 16 <= width * 4; i += 16) {
+                    __m128i a = _mm_cvttps_epi32(_mm_add_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(rowPtr + i), zero), max), half));
+                    __m128i b = _mm_cvttps_epi32(_mm_add_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(rowPtr + i + 4), zero), max), half));
+                    __m128i c = _mm_cvttps_epi32(_mm_add_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(rowPtr + i + 8), zero), max), half));
+                    __m128i d = _mm_cvttps_epi32(_mm_add_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(rowPtr + i + 12), zero), max), half));
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(outPtr + i), _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+                }
+                EncodeRowScalar(rowPtr + i, width - i / 4, false, tables, outPtr + i);
+                return;
+            }
+
+            // The sRGB table look ups are scalar.
+            const __m128 scale = _mm_set_ps(1.0f, F32(SRGB_ENCODE_TABLE_SIZE - 1) / 255.0f, \
+                                            F32(SRGB_ENCODE_TABLE_SIZE - 1) / 255.0f, F32(SRGB_ENCODE_TABLE_SIZE - 1) / 255.0f);
+            I32 indices[4];
+            for(U32 i = 0; i < width * 4; i += 4) {
+                const __m128 v = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(rowPtr + i), zero), max);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(indices), _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(v, scale), half)));
+                outPtr[i] = tables.m_linearToSrgb[indices[0]];
+                outPtr[i + 1] = tables.m_linearToSrgb[indices[1]];
+                outPtr[i + 2] = tables.m_linearToSrgb[indices[2]];
+                outPtr[i + 3] = U8(indices[3]);
+            }
+        }
+
+#endif
+
+        // /////////////////////////////////////////////////////////////////
+        // Round the product of two 8 bit values divided by 255 to the
+        // nearest integer.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U8 MultiplyU8(const U32 a, const U32 b)
+        {
+            const U32 t = a * b + 128;
+            return (U8((t + (t >> 8)) >> 8));
+        }
+
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    const char *FindStringFromResampleFilter(const ResampleFilter filter)
+    {
+        if(filter >= RESAMPLE_FILTER_FIRST && filter < RESAMPLE_FILTER_COUNT) {
+            return (gResampleFilterNames[filter]);
+        }
+        return ("");
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    ResampleFilter FindResampleFilterFromString(const std::string &filterRef)
+    {
+        const std::string lowerStr(boost::algorithm::to_lower_copy(filterRef));
+        for(I32 i = RESAMPLE_FILTER_FIRST; i < RESAMPLE_FILTER_COUNT; ++i) {
+            if(lowerStr == gResampleFilterNames[i]) {
+                return (static_cast<ResampleFilter>(i));
+            }
+        }
+        return (RESAMPLE_FILTER_UNKNOWN);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool IsImageProcessingSimd()
+    {
+#ifdef GF_IMAGE_PROCESSING_SSE2
+        return (true);
+#else
+        return (false);
+#endif
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void DownsampleImage(const U8 *rgbaPtr, const U32 width, const U32 height, std::vector<U8> &outRef, \
+                         const ResampleFilter filter, const bool gammaCorrect, const bool allowSimd)
+    {
+        const Tables &tables = GetTables();
+        const Kernel &kernel = (filter == RESAMPLE_FILTER_KAISER) ? tables.m_kaiser : tables.m_box;
+        const U32 outWidth = std::max(1U, width / 2);
+        const U32 outHeight = std::max(1U, height / 2);
+        outRef.resize(outWidth * outHeight * 4);
+
+        void (*decodeRow)(const U8 *, const U32, const bool, const Tables &, const U32, F32 *) = DecodeRowScalar;
+        void (*filterRow)(const F32 *, const U32, const Kernel &, F32 *) = FilterRowScalar;
+        void (*filterColumns)(const F32 * const [MAX_FILTER_TAPS], const U32, const Kernel &, F32 *) = FilterColumnsScalar;
+        void (*encodeRow)(const F32 *, const U32, const bool, const Tables &, U8 *) = EncodeRowScalar;
+#ifdef GF_IMAGE_PROCESSING_SSE2
+        if(allowSimd) {
+            decodeRow = DecodeRowSse2;
+            filterRow = FilterRowSse2;
+            filterColumns = FilterColumnsSse2;
+            encodeRow = EncodeRowSse2;
+        }
+#endif
+
+        // Input rows are decoded with the edge texels repeated so the
+        //  horizontal filter never reads outside the row.  The horizontally
+        //  filtered rows are kept in a ring, one slot per tap, as
+        //  consecutive output rows share most of their input rows.
+        const U32 padLeft = U32(std::max(0, -kernel.m_offset));
+        const U32 padRight = kernel.m_taps;
+        std::vector<F32> decoded((padLeft + width + padRight) * 4);
+        std::vector<F32> ring(kernel.m_taps * outWidth * 4);
+        std::vector<I32> ringRows(kernel.m_taps, -1);
+        std::vector<F32> filtered(outWidth * 4);
+        const F32 *rowPtrs[MAX_FILTER_TAPS];
+
+        for(U32 y = 0; y < outHeight; ++y) {
+            for(U32 k = 0; k < kernel.m_taps; ++k) {
+                const I32 row = std::min(std::max(I32(y * 2) + kernel.m_offset + I32(k), 0), I32(height) - 1);
+                const U32 slot = U32(row) % kernel.m_taps;
+                if(ringRows[slot] != row) {
+                    decodeRow(rgbaPtr + U32(row) * width * 4, width, gammaCorrect, tables, padLeft, &decoded[0]);
+                    PadRow(width, padLeft, padRight, &decoded[0]);
+                    filterRow(&decoded[0] + (I32(padLeft) + kernel.m_offset) * 4, outWidth, kernel, &ring[slot * outWidth * 4]);
+                    ringRows[slot] = row;
+                }
+                rowPtrs[k] = &ring[slot * outWidth * 4];
+            }
+
+            filterColumns(rowPtrs, outWidth, kernel, &filtered[0]);
+            encodeRow(&filtered[0], outWidth, gammaCorrect, tables, &outRef[y * outWidth * 4]);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void GenerateMipChain(const U8 *rgbaPtr, const U32 width, const U32 height, std::vector< std::vector<U8> > &levelsRef, \
+                          const ResampleFilter filter, const bool gammaCorrect, const bool allowSimd)
+    {
+        levelsRef.clear();
+        U32 levelWidth = width;
+        U32 levelHeight = height;
+        while(levelWidth > 1 || levelHeight > 1) {
+            const U8 *levelPtr = levelsRef.empty() ? rgbaPtr : &levelsRef.back()[0];
+            levelsRef.push_back(std::vector<U8>());
+            DownsampleImage(levelPtr, levelWidth, levelHeight, levelsRef.back(), filter, gammaCorrect, allowSimd);
+            levelWidth = std::max(1U, levelWidth / 2);
+            levelHeight = std::max(1U, levelHeight / 2);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void PremultiplyAlpha(U8 *rgbaPtr, const U32 numberTexels, const bool allowSimd)
+    {
+        U32 t = 0;
+
+#ifdef GF_IMAGE_PROCESSING_SSE2
+        if(allowSimd) {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i round = _mm_set1_epi16(128);
+            const __m128i alphaMask = _mm_set1_epi32(I32(0xFF000000));
+            for(; t + 4 <= numberTexels; t += 4) {
+                const __m128i texels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rgbaPtr + t * 4));
+                __m128i lo = _mm_unpacklo_epi8(texels, zero);
+                __m128i hi = _mm_unpackhi_epi8(texels, zero);
+                const __m128i loAlpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(lo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+                const __m128i hiAlpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(hi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+                lo = _mm_add_epi16(_mm_mullo_epi16(lo, loAlpha), round);
+                hi = _mm_add_epi16(_mm_mullo_epi16(hi, hiAlpha), round);
+                lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+                hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+                const __m128i result = _mm_or_si128(_mm_andnot_si128(alphaMask, _mm_packus_epi16(lo, hi)), _mm_and_si128(alphaMask, texels));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(rgbaPtr + t * 4), result);
+            }
+        }
+#endif
+
+        for(; t < numberTexels; ++t) {
+            U8 *texelPtr = rgbaPtr + t * 4;
+            texelPtr[0] = MultiplyU8(texelPtr[0], texelPtr[3]);
+            texelPtr[1] = MultiplyU8(texelPtr[1], texelPtr[3]);
+            texelPtr[2] = MultiplyU8(texelPtr[2], texelPtr[3]);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ConvertRgbToRgba(const U8 *rgbPtr, const U32 numberTexels, U8 *rgbaPtr, const U8 alpha, const bool allowSimd)
+    {
+        U32 t = 0;
+
+#ifdef GF_IMAGE_PROCESSING_SSE2
+        if(allowSimd) {
+            // Each 16 byte load holds 4 texels and 4 bytes of the next, so
+            //  stop while there are still 16 bytes to read.
+            const __m128i colourMask = _mm_set1_epi32(0x00FFFFFF);
+            const __m128i alphaBits = _mm_set1_epi32(I32(U32(alpha) << 24));
+            for(; (t + 4) * 3 + 4 <= numberTexels * 3; t += 4) {
+                const __m128i texels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rgbPtr + t * 3));
+                const __m128i t01 = _mm_unpacklo_epi32(texels, _mm_srli_si128(texels, 3));
+                const __m128i t23 = _mm_unpacklo_epi32(_mm_srli_si128(texels, 6), _mm_srli_si128(texels, 9));
+                const __m128i result = _mm_or_si128(_mm_and_si128(_mm_unpacklo_epi64(t01, t23), colourMask), alphaBits);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(rgbaPtr + t * 4), result);
+            }
+        }
+#endif
+
+        for(; t < numberTexels; ++t) {
+            rgbaPtr[t * 4] = rgbPtr[t * 3];
+            rgbaPtr[t * 4 + 1] = rgbPtr[t * 3 + 1];
+            rgbaPtr[t * 4 + 2] = rgbPtr[t * 3 + 2];
+            rgbaPtr[t * 4 + 3] = alpha;
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ConvertRgbaToRgb(const U8 *rgbaPtr, const U32 numberTexels, U8 *rgbPtr, const bool allowSimd)
+    {
+        U32 t = 0;
+
+#ifdef GF_IMAGE_PROCESSING_SSE2
+        if(allowSimd) {
+            // Pack each pair of texels into 6 bytes of their 64 bit half,
+            //  then the two halves into 12 bytes.
+            const __m128i lowMask = _mm_set_epi32(0, 0x00FFFFFF, 0, 0x00FFFFFF);
+            const __m128i highMask = _mm_set_epi32(0x0000FFFF, I32(0xFF000000), 0x0000FFFF, I32(0xFF000000));
+            const __m128i halfMask = _mm_set_epi32(0, 0, I32(0xFFFFFFFF), I32(0xFFFFFFFF));
+            for(; t + 4 <= numberTexels; t += 4) {
+                const __m128i texels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rgbaPtr + t * 4));
+                const __m128i pairs = _mm_or_si128(_mm_and_si128(texels, lowMask), _mm_and_si128(_mm_srli_epi64(texels, 8), highMask));
+                const __m128i result = _mm_or_si128(_mm_and_si128(pairs, halfMask), _mm_slli_si128(_mm_srli_si128(pairs, 8), 6));
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(rgbPtr + t * 3), result);
+                const I32 last = _mm_cvtsi128_si32(_mm_srli_si128(result, 8));
+                memcpy(rgbPtr + t * 3 + 8, &last, 4);
+            }
+        }
+#endif
+
+        for(; t < numberTexels; ++t) {
+            rgbPtr[t * 3] = rgbaPtr[t * 4];
+            rgbPtr[t * 3 + 1] = rgbaPtr[t * 4 + 1];
+            rgbPtr[t * 3 + 2] = rgbaPtr[t * 4 + 2];
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void SwapRedBlue(U8 *rgbaPtr, const U32 numberTexels, const bool allowSimd)
+    {
+        U32 t = 0;
+
+#ifdef GF_IMAGE_PROCESSING_SSE2
+        if(allowSimd) {
+            const __m128i keepMask = _mm_set1_epi32(I32(0xFF00FF00));
+            const __m128i byteMask = _mm_set1_epi32(0x000000FF);
+            for(; t + 4 <= numberTexels; t += 4) {
+                const __m128i texels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rgbaPtr + t * 4));
+                const __m128i result = _mm_or_si128(_mm_and_si128(texels, keepMask), \
+                                                    _mm_or_si128(_mm_and_si128(_mm_srli_epi32(texels, 16), byteMask), \
+                                                            _mm_slli_epi32(_mm_and_si128(texels, byteMask), 16)));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(rgbaPtr + t * 4), result);
+            }
+        }
+#endif
+
+        for(; t < numberTexels; ++t) {
+            std::swap(rgbaPtr[t * 4], rgbaPtr[t * 4 + 2]);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void FlipImageVertical(U8 *pixelsPtr, const U32 rowStride, const U32 height)
+    {
+        std::vector<U8> row(rowStride);
+        for(U32 y = 0; y < height / 2; ++y) {
+            U8 *topPtr = pixelsPtr + y * rowStride;
+            U8 *bottomPtr = pixelsPtr + (height - 1 - y) * rowStride;
+            memcpy(&row[0], topPtr, rowStride);
+            memcpy(topPtr, bottomPtr, rowStride);
+            memcpy(bottomPtr, &row[0], rowStride);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ConvertImageToRgba(const ImageResHandle &imageRef, std::vector<U8> &rgbaRef)
+    {
+        const U8 *srcPtr = reinterpret_cast<const U8 *>(imageRef.GetImageBuffer());
+        if(!srcPtr || imageRef.IsCompressed()) {
+            return (false);
+        }
+
+        const U32 width = U32(imageRef.GetImageWidth());
+        const U32 height = U32(imageRef.GetImageHeight());
+        const U32 depth = U32(imageRef.GetImageDepth());
+        const U32 rowSize = width * depth;
+        const U32 rowStride = IsImageTypePacked(FindImageTypeFromFile(imageRef.GetImageFilename())) ? rowSize : ((rowSize + 3) & ~3U);
+        const GLenum format = imageRef.GetImageFormat();
+        rgbaRef.resize(width * height * 4);
+
+        for(U32 y = 0; y < height; ++y) {
+            const U8 *rowPtr = srcPtr + y * rowStride;
+            U8 *outPtr = &rgbaRef[y * width * 4];
+            switch(format) {
+                case GL_LUMINANCE:
+                    for(U32 x = 0; x < width; ++x) {
+                        outPtr[x * 4] = outPtr[x * 4 + 1] = outPtr[x * 4 + 2] = rowPtr[x];
+                        outPtr[x * 4 + 3] = 255;
+                    }
+                    break;
+                case GL_RGB:
+                case GL_BGR:
+                    ConvertRgbToRgba(rowPtr, width, outPtr);
+                    break;
+                case GL_RGBA:
+                case GL_BGRA:
+                    memcpy(outPtr, rowPtr, width * 4);
+                    break;
+                default:
+                    return (false);
+            }
+        }
+
+        if(format == GL_BGR || format == GL_BGRA) {
+            SwapRedBlue(&rgbaRef[0], width * height);
+        }
+
+        return (true);
+    }
+
+}
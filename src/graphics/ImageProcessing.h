@@ -0,0 +1,151 @@
+#pragma once
+#ifndef __GF_IMAGE_PROCESSING_H
+#define __GF_IMAGE_PROCESSING_H
+
+// /////////////////////////////////////////////////////////////////
+// @file ImageProcessing.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header for the CPU image processing functions: mipmap downsampling
+// (box or Kaiser, optionally gamma correct), premultiplied alpha,
+// RGB/RGBA conversion and vertical flips of 8 bit images.
+//
+// Each function has an SSE2 implementation, used where the compiler
+// targets SSE2, and a scalar reference implementation which gives
+// exactly the same result.  Passing allowSimd = false forces the
+// scalar implementation.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include "GameBase.h"
+
+namespace GameHalloran {
+
+    class ImageResHandle;
+
+    // /////////////////////////////////////////////////////////////////
+    // @enum ResampleFilter
+    // @author PJ O Halloran
+    //
+    // The filters used to halve an image.
+    // - RESAMPLE_FILTER_BOX    Average of each 2x2 texels.  Fast but
+    //                          blurs and aliases.
+    // - RESAMPLE_FILTER_KAISER Kaiser windowed sinc over 8x8 texels.
+    //                          Sharper mipmaps with less aliasing.
+    //
+    // /////////////////////////////////////////////////////////////////
+    enum ResampleFilter {
+        RESAMPLE_FILTER_FIRST,
+        RESAMPLE_FILTER_BOX = RESAMPLE_FILTER_FIRST,
+        RESAMPLE_FILTER_KAISER,
+        RESAMPLE_FILTER_COUNT,
+        RESAMPLE_FILTER_UNKNOWN
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Convert a resample filter to a string ("box" or "kaiser").
+    //
+    // /////////////////////////////////////////////////////////////////
+    const char *FindStringFromResampleFilter(const ResampleFilter filter);
+
+    // /////////////////////////////////////////////////////////////////
+    // Convert a string ("box" or "kaiser", any case) to a resample
+    // filter.
+    //
+    // @return ResampleFilter RESAMPLE_FILTER_UNKNOWN if not recognized.
+    //
+    // /////////////////////////////////////////////////////////////////
+    ResampleFilter FindResampleFilterFromString(const std::string &filterRef);
+
+    // /////////////////////////////////////////////////////////////////
+    // Is the SSE2 implementation compiled in?
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool IsImageProcessingSimd();
+
+    // /////////////////////////////////////////////////////////////////
+    // Halve an 8 bit RGBA image to max(1, width / 2) by
+    // max(1, height / 2) texels.  Edge texels are repeated.
+    //
+    // @param filter The filter to use.
+    // @param gammaCorrect Are the RGB channels sRGB encoded?  If so
+    //                      they are filtered in linear space.  Alpha
+    //                      is always filtered as is.
+    // @param allowSimd Use the SSE2 implementation if compiled in?
+    //
+    // Note: Colour and alpha are filtered separately.  Premultiply the
+    // alpha first (see PremultiplyAlpha()) if transparent texels may
+    // hold colours which should not bleed into their neighbours.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void DownsampleImage(const U8 *rgbaPtr, const U32 width, const U32 height, std::vector<U8> &outRef, \
+                         const ResampleFilter filter = RESAMPLE_FILTER_BOX, const bool gammaCorrect = false, \
+                         const bool allowSimd = true);
+
+    // /////////////////////////////////////////////////////////////////
+    // Build the mipmap chain of an 8 bit RGBA image down to 1x1, each
+    // level halving the one before it with DownsampleImage().
+    //
+    // @param levelsRef Output levels.  levelsRef[i] is mipmap level
+    //                  i + 1, the image itself (level 0) is not copied.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void GenerateMipChain(const U8 *rgbaPtr, const U32 width, const U32 height, std::vector< std::vector<U8> > &levelsRef, \
+                          const ResampleFilter filter = RESAMPLE_FILTER_BOX, const bool gammaCorrect = false, \
+                          const bool allowSimd = true);
+
+    // /////////////////////////////////////////////////////////////////
+    // Multiply the RGB channels of 8 bit RGBA texels by their alpha,
+    // rounding to the nearest value.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void PremultiplyAlpha(U8 *rgbaPtr, const U32 numberTexels, const bool allowSimd = true);
+
+    // /////////////////////////////////////////////////////////////////
+    // Expand packed 3 byte texels to 4 byte texels.
+    //
+    // @param alpha The value of the added fourth byte.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ConvertRgbToRgba(const U8 *rgbPtr, const U32 numberTexels, U8 *rgbaPtr, const U8 alpha = 255, const bool allowSimd = true);
+
+    // /////////////////////////////////////////////////////////////////
+    // Drop the fourth byte of packed 4 byte texels.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ConvertRgbaToRgb(const U8 *rgbaPtr, const U32 numberTexels, U8 *rgbPtr, const bool allowSimd = true);
+
+    // /////////////////////////////////////////////////////////////////
+    // Swap the first and third bytes of packed 4 byte texels, converting
+    // BGRA to RGBA and back.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void SwapRedBlue(U8 *rgbaPtr, const U32 numberTexels, const bool allowSimd = true);
+
+    // /////////////////////////////////////////////////////////////////
+    // Flip an image upside down in place.
+    //
+    // @param rowStride The size of each row in bytes, including any
+    //                  padding.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void FlipImageVertical(U8 *pixelsPtr, const U32 rowStride, const U32 height);
+
+    // /////////////////////////////////////////////////////////////////
+    // Convert a parsed (uncompressed) image to packed 8 bit RGBA texels
+    // in the same row order.  Luminance is copied to RGB and images
+    // without alpha get an alpha of 255.
+    //
+    // @return bool False if the image is block compressed, has not been
+    //              initialized or has an unsupported format.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ConvertImageToRgba(const ImageResHandle &imageRef, std::vector<U8> &rgbaRef);
+
+}
+
+#endif
@@ -5,16 +5,276 @@
 //
 // ////////////////////////////////////////////////////////////////////
 
+#include <csetjmp>
+#include <cstdio>
+#include <climits>
+#include <algorithm>
+#include <vector>
+
 #include <boost/algorithm/string/case_conv.hpp>
 
+#include "png/png.h"
+#include "jpeg/jpeglib.h"
+#include "jpeg/jerror.h"
+
 #include "ImageResource.h"
 #include "GLTools.h"
 #include "GameMain.h"
 
 namespace GameHalloran {
 
+    namespace {
+
+        // ////////////////////////////////////////////////////////////////////
+        // @struct ImageMemoryStream
+        //
+        // Read cursor over an image file held in memory.
+        //
+        // ////////////////////////////////////////////////////////////////////
+        struct ImageMemoryStream {
+            const png_byte *m_data;                 ///< The image file.
+            size_t m_length;                        ///< Length of the image file.
+            size_t m_pos;                           ///< Next byte to read.
+        };
+
+        // ////////////////////////////////////////////////////////////////////
+        // @struct JpegErrorManager
+        //
+        // libjpeg error manager which jumps back to the decoder rather than
+        // exiting the process.
+        //
+        // ////////////////////////////////////////////////////////////////////
+        struct JpegErrorManager {
+            jpeg_error_mgr m_pub;                   ///< Must be first, libjpeg casts to it.
+            jmp_buf m_jmpBuf;                       ///< Where to return to on an error.
+        };
+
+        // ////////////////////////////////////////////////////////////////////
+        // libpng read callback for an ImageMemoryStream.
+        //
+        // ////////////////////////////////////////////////////////////////////
+        void PngReadMemory(png_structp pngPtr, png_bytep outPtr, png_size_t count)
+        {
+            ImageMemoryStream *streamPtr = static_cast<ImageMemoryStream *>(png_get_io_ptr(pngPtr));
+            if(count > streamPtr->m_length - streamPtr->m_pos) {
+                png_error(pngPtr, "Read past the end of the PNG stream");
+            }
+            memcpy(outPtr, streamPtr->m_data + streamPtr->m_pos, count);
+            streamPtr->m_pos += count;
+        }
+
+        // ////////////////////////////////////////////////////////////////////
+        // libpng error callback.  The default prints to stderr.
+        //
+        // ////////////////////////////////////////////////////////////////////
+        void PngError(png_structp pngPtr, png_const_charp)
+        {
+            png_longjmp(pngPtr, 1);
+        }
+
+        // ////////////////////////////////////////////////////////////////////
+        // libpng warning callback.  Warnings are ignored.
+        //
+        // ////////////////////////////////////////////////////////////////////
+        void PngWarning(png_structp, png_const_charp)
+        {
+        }
+
+        // ////////////////////////////////////////////////////////////////////
+        // libjpeg fatal error callback.
+        //
+        // ////////////////////////////////////////////////////////////////////
+        void JpegErrorExit(j_common_ptr cinfo)
+        {
+            longjmp(reinterpret_cast<JpegErrorManager *>(cinfo->err)->m_jmpBuf, 1);
+        }
+
+        // ////////////////////////////////////////////////////////////////////
+        // libjpeg message callback.  Warnings and traces are ignored.
+        //
+        // ////////////////////////////////////////////////////////////////////
+        void JpegOutputMessage(j_common_ptr)
+        {
+        }
+
+        // ////////////////////////////////////////////////////////////////////
+        // Get the OpenGL format of an 8 bit per channel image with the
+        // number of channels.
+        //
+        // @return bool False if there is no matching format.
+        //
+        // ////////////////////////////////////////////////////////////////////
+        bool FindChannelFormat(const GLint channels, GLenum &formatRef, GLint &componentsRef)
+        {
+            switch(channels) {
+                case 1:
+                    formatRef = GL_LUMINANCE;
+                    componentsRef = GL_LUMINANCE;
+                    return (true);
+                case 3:
+                    formatRef = GL_RGB;
+                    componentsRef = GL_RGB;
+                    return (true);
+                case 4:
+                    formatRef = GL_RGBA;
+                    componentsRef = GL_RGBA;
+                    return (true);
+                default:
+                    return (false);
+            }
+        }
+
+        // ////////////////////////////////////////////////////////////////////
+        // Decode a PNG from a file or a memory stream into an 8 bit per
+        // channel image with the rows stored bottom up, as OpenGL (and
+        // TGA) expects.
+        //
+        // The C++ objects are kept out of this function as libpng reports
+        // errors with longjmp.
+        //
+        // @param fd The file to read from or NULL.
+        // @param streamPtr The stream to read from if fd is NULL.
+        // @param bufferRef The decoded image on success, allocated with
+        //                  GCC_NEW[].
+        //
+        // @return bool True on success or false on failure.
+        //
+        // ////////////////////////////////////////////////////////////////////
+        bool DecodePng(FILE *fd, ImageMemoryStream *streamPtr, GLbyte *&bufferRef, GLint &widthRef, GLint &heightRef, GLint &channelsRef)
+        {
+            png_structp pngPtr = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, PngError, PngWarning);
+            if(!pngPtr) {
+                return (false);
+            }
+            png_infop infoPtr = png_create_info_struct(pngPtr);
+            if(!infoPtr) {
+                png_destroy_read_struct(&pngPtr, NULL, NULL);
+                return (false);
+            }
+
+            // Modified after setjmp() so must be volatile.
+            png_bytep * volatile rowsPtr = NULL;
+            GLbyte * volatile imagePtr = NULL;
+
+            if(setjmp(png_jmpbuf(pngPtr))) {
+                delete [] rowsPtr;
+                delete [] imagePtr;
+                png_destroy_read_struct(&pngPtr, &infoPtr, NULL);
+                return (false);
+            }
+
+            if(fd) {
+                png_init_io(pngPtr, fd);
+            } else {
+                png_set_read_fn(pngPtr, streamPtr, PngReadMemory);
+            }
+            png_read_info(pngPtr, infoPtr);
+
+            // Expand everything to 8 bit luminance, RGB or RGBA.  Grey scale
+            // with a tRNS chunk expands to grey and alpha, so is made RGBA.
+            const png_byte colorType = png_get_color_type(pngPtr, infoPtr);
+            png_set_expand(pngPtr);
+            png_set_strip_16(pngPtr);
+            if(colorType == PNG_COLOR_TYPE_GRAY_ALPHA || \
+               (colorType == PNG_COLOR_TYPE_GRAY && png_get_valid(pngPtr, infoPtr, PNG_INFO_tRNS))) {
+                png_set_gray_to_rgb(pngPtr);
+            }
+            png_set_interlace_handling(pngPtr);
+            png_read_update_info(pngPtr, infoPtr);
+
+            const png_uint_32 width = png_get_image_width(pngPtr, infoPtr);
+            const png_uint_32 height = png_get_image_height(pngPtr, infoPtr);
+            const png_size_t rowBytes = png_get_rowbytes(pngPtr, infoPtr);
+            if(width == 0 || height == 0 || height > png_uint_32(INT_MAX / rowBytes)) {
+                png_error(pngPtr, "Invalid PNG image size");
+            }
+
+            imagePtr = GCC_NEW GLbyte[rowBytes * height];
+            rowsPtr = GCC_NEW png_bytep[height];
+            for(png_uint_32 i = 0; i < height; ++i) {
+                rowsPtr[i] = reinterpret_cast<png_bytep>(imagePtr) + (height - 1 - i) * rowBytes;
+            }
+            png_read_image(pngPtr, rowsPtr);
+            png_read_end(pngPtr, NULL);
+
+            widthRef = GLint(width);
+            heightRef = GLint(height);
+            channelsRef = GLint(png_get_channels(pngPtr, infoPtr));
+            bufferRef = imagePtr;
+
+            delete [] rowsPtr;
+            png_destroy_read_struct(&pngPtr, &infoPtr, NULL);
+            return (true);
+        }
+
+        // ////////////////////////////////////////////////////////////////////
+        // Decode a JPEG from a file or a memory stream into an 8 bit per
+        // channel image with the rows stored bottom up.
+        //
+        // The C++ objects are kept out of this function as the error
+        // manager reports errors with longjmp.
+        //
+        // @param fd The file to read from or NULL.
+        // @param stream The stream to read from if fd is NULL.
+        // @param length The length of the stream.
+        // @param bufferRef The decoded image on success, allocated with
+        //                  GCC_NEW[].
+        //
+        // @return bool True on success or false on failure.
+        //
+        // ////////////////////////////////////////////////////////////////////
+        bool DecodeJpeg(FILE *fd, const char *stream, const size_t length, GLbyte *&bufferRef, GLint &widthRef, GLint &heightRef, GLint &channelsRef)
+        {
+            jpeg_decompress_struct cinfo;
+            JpegErrorManager errorMgr;
+            cinfo.err = jpeg_std_error(&errorMgr.m_pub);
+            errorMgr.m_pub.error_exit = JpegErrorExit;
+            errorMgr.m_pub.output_message = JpegOutputMessage;
+
+            // Modified after setjmp() so must be volatile.
+            GLbyte * volatile imagePtr = NULL;
+
+            if(setjmp(errorMgr.m_jmpBuf)) {
+                delete [] imagePtr;
+                jpeg_destroy_decompress(&cinfo);
+                return (false);
+            }
+
+            jpeg_create_decompress(&cinfo);
+            if(fd) {
+                jpeg_stdio_src(&cinfo, fd);
+            } else {
+                jpeg_mem_src(&cinfo, reinterpret_cast<unsigned char *>(const_cast<char *>(stream)), static_cast<unsigned long>(length));
+            }
+            jpeg_read_header(&cinfo, TRUE);
+            cinfo.out_color_space = (cinfo.jpeg_color_space == JCS_GRAYSCALE) ? JCS_GRAYSCALE : JCS_RGB;
+            jpeg_start_decompress(&cinfo);
+
+            const size_t rowBytes = size_t(cinfo.output_width) * size_t(cinfo.output_components);
+            if(rowBytes == 0 || cinfo.output_height == 0 || cinfo.output_height > INT_MAX / rowBytes) {
+                ERREXIT(&cinfo, JERR_EMPTY_IMAGE);
+            }
+
+            imagePtr = GCC_NEW GLbyte[rowBytes * cinfo.output_height];
+            while(cinfo.output_scanline < cinfo.output_height) {
+                JSAMPROW row = reinterpret_cast<JSAMPROW>(imagePtr) + (cinfo.output_height - 1 - cinfo.output_scanline) * rowBytes;
+                jpeg_read_scanlines(&cinfo, &row, 1);
+            }
+            jpeg_finish_decompress(&cinfo);
+
+            widthRef = GLint(cinfo.output_width);
+            heightRef = GLint(cinfo.output_height);
+            channelsRef = GLint(cinfo.output_components);
+            bufferRef = imagePtr;
+
+            jpeg_destroy_decompress(&cinfo);
+            return (true);
+        }
+
+    }
+
     // Global array of image extensions.
-    const char * const gImageExtentions[] = { ".tga", ".bmp", ".png", ".jpeg" };
+    const char * const gImageExtentions[] = { ".tga", ".bmp", ".png", ".jpeg", ".bct" };
 
     //////////////////////////////////////////////////////////////////////
     //
@@ -48,9 +308,22 @@ namespace GameHalloran {
             ++type;
         }
 
+        // Common short form of the JPEG extension.
+        if(strstr(filenameRef.c_str(), ".jpg")) {
+            return (IMAGE_TYPE_JPEG);
+        }
+
         return (IMAGE_TYPE_UNKNOWN);
     }
 
+    // ////////////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////////////
+    bool IsImageTypePacked(const ImageType type)
+    {
+        return (type != IMAGE_TYPE_BMP);
+    }
+
     // ////////////////////////////////////////////////////////////////////
     //
     // ////////////////////////////////////////////////////////////////////
@@ -239,8 +512,22 @@ namespace GameHalloran {
     // ////////////////////////////////////////////////////////////////////
     bool ImageResHandle::ParsePng(FILE *fd)
     {
-        // TODO:
-        return (false);
+        if(fd == NULL) {
+            return (false);
+        }
+
+        GLbyte *buffer = NULL;
+        if(!DecodePng(fd, NULL, buffer, m_width, m_height, m_depth)) {
+            return (false);
+        }
+        if(!FindChannelFormat(m_depth, m_format, m_components)) {
+            delete [] buffer;
+            return (false);
+        }
+        m_imageBuffer = buffer;
+        m_imageSize = m_width * m_height * m_depth;
+
+        return (true);
     }
 
     // ////////////////////////////////////////////////////////////////////
@@ -248,8 +535,43 @@ namespace GameHalloran {
     // ////////////////////////////////////////////////////////////////////
     bool ImageResHandle::ParseJpeg(FILE *fd)
     {
-        // TODO:
-        return (false);
+        if(fd == NULL) {
+            return (false);
+        }
+
+        GLbyte *buffer = NULL;
+        if(!DecodeJpeg(fd, NULL, 0, buffer, m_width, m_height, m_depth)) {
+            return (false);
+        }
+        if(!FindChannelFormat(m_depth, m_format, m_components)) {
+            delete [] buffer;
+            return (false);
+        }
+        m_imageBuffer = buffer;
+        m_imageSize = m_width * m_height * m_depth;
+
+        return (true);
+    }
+
+    // ////////////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////////////
+    bool ImageResHandle::ParseBct(FILE *fd)
+    {
+        if(fd == NULL || fseek(fd, 0, SEEK_END) != 0) {
+            return (false);
+        }
+        const long length = ftell(fd);
+        if(length <= 0 || fseek(fd, 0, SEEK_SET) != 0) {
+            return (false);
+        }
+
+        std::vector<char> bctFile(length);
+        if(fread(&bctFile[0], 1, size_t(length), fd) != size_t(length)) {
+            return (false);
+        }
+
+        return (ParseBct(&bctFile[0], bctFile.size()));
     }
 
     // ////////////////////////////////////////////////////////////////////
@@ -438,8 +760,27 @@ namespace GameHalloran {
     // ////////////////////////////////////////////////////////////////////
     bool ImageResHandle::ParsePng(char *pngStream, const size_t length)
     {
-        // TODO:
-        return (false);
+        if(pngStream == NULL || length < 8 || png_sig_cmp(reinterpret_cast<png_const_bytep>(pngStream), 0, 8) != 0) {
+            return (false);
+        }
+
+        ImageMemoryStream stream;
+        stream.m_data = reinterpret_cast<const png_byte *>(pngStream);
+        stream.m_length = length;
+        stream.m_pos = 0;
+
+        GLbyte *buffer = NULL;
+        if(!DecodePng(NULL, &stream, buffer, m_width, m_height, m_depth)) {
+            return (false);
+        }
+        if(!FindChannelFormat(m_depth, m_format, m_components)) {
+            delete [] buffer;
+            return (false);
+        }
+        m_imageBuffer = buffer;
+        m_imageSize = m_width * m_height * m_depth;
+
+        return (true);
     }
 
     // ////////////////////////////////////////////////////////////////////
@@ -447,8 +788,47 @@ namespace GameHalloran {
     // ////////////////////////////////////////////////////////////////////
     bool ImageResHandle::ParseJpeg(char *jpegStream, const size_t length)
     {
-        // TODO:
-        return (false);
+        if(jpegStream == NULL || length == 0) {
+            return (false);
+        }
+
+        GLbyte *buffer = NULL;
+        if(!DecodeJpeg(NULL, jpegStream, length, buffer, m_width, m_height, m_depth)) {
+            return (false);
+        }
+        if(!FindChannelFormat(m_depth, m_format, m_components)) {
+            delete [] buffer;
+            return (false);
+        }
+        m_imageBuffer = buffer;
+        m_imageSize = m_width * m_height * m_depth;
+
+        return (true);
+    }
+
+    // ////////////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////////////
+    bool ImageResHandle::ParseBct(char *bctStream, const size_t length)
+    {
+        CompressedTextureHeader header;
+        if(!ParseCompressedTextureHeader(reinterpret_cast<const U8 *>(bctStream), length, header)) {
+            return (false);
+        }
+
+        m_imageSize = GetCompressedTextureDataSize(header);
+        m_imageBuffer = GCC_NEW GLbyte[m_imageSize];
+        memcpy(m_imageBuffer, bctStream + COMPRESSED_TEXTURE_HEADER_SIZE, m_imageSize);
+
+        m_width = header.m_width;
+        m_height = header.m_height;
+        m_depth = 0;
+        m_format = GetBlockFormatGLFormat(header.m_format);
+        m_components = m_format;
+        m_blockFormat = header.m_format;
+        m_numberMipLevels = header.m_numberMipLevels;
+
+        return (true);
     }
 
     // ////////////////////////////////////////////////////////////////////
@@ -458,7 +838,7 @@ namespace GameHalloran {
 :
     ResHandle(r, buffer, size, pResCache), m_imageType(IMAGE_TYPE_UNKNOWN), m_initialized(false), m_fromFile(false), \
     m_imageBuffer(NULL), m_imageSize(0), m_width(0), m_height(0), m_depth(0), m_format(GL_RGB), m_components(GL_RGB), \
-    m_imageFilename(r.GetName())
+    m_blockFormat(BLOCK_FORMAT_UNKNOWN), m_numberMipLevels(1), m_imageFilename(r.GetName())
     {
         m_fromFile = (buffer == NULL);
     }
@@ -541,6 +921,28 @@ namespace GameHalloran {
         return (m_format);
     }
 
+    // ////////////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////////////
+    const GLbyte *ImageResHandle::GetMipLevelBuffer(const U32 level, GLint &widthRef, GLint &heightRef, GLint &sizeRef) const
+    {
+        if(!IsCompressed() || m_imageBuffer == NULL || level >= m_numberMipLevels) {
+            return (NULL);
+        }
+
+        const GLbyte *levelPtr = m_imageBuffer;
+        for(U32 i = 0; i <= level; ++i) {
+            widthRef = std::max(1, m_width >> i);
+            heightRef = std::max(1, m_height >> i);
+            sizeRef = GetCompressedImageSize(m_blockFormat, widthRef, heightRef);
+            if(i < level) {
+                levelPtr += sizeRef;
+            }
+        }
+
+        return (levelPtr);
+    }
+
     // ////////////////////////////////////////////////////////////////////
     //
     // ////////////////////////////////////////////////////////////////////
@@ -552,7 +954,7 @@ namespace GameHalloran {
     // ////////////////////////////////////////////////////////////////////
     //
     // ////////////////////////////////////////////////////////////////////
-    bool ImageResHandle::VInitialize()
+    bool ImageResHandle::Decode(std::string &errorRef)
     {
         bool result = true;
 
@@ -562,6 +964,7 @@ namespace GameHalloran {
                 FILE *file = NULL;
                 file = fopen(m_imageFilename.c_str(), "rb");
                 if(file == NULL) {
+                    errorRef = std::string("Failed to open the image file ") + m_imageFilename;
                     result = false;
                 }
 
@@ -576,10 +979,18 @@ namespace GameHalloran {
                             break;
 
                         case IMAGE_TYPE_PNG:
+                            result = ParsePng(file);
+                            break;
+
                         case IMAGE_TYPE_JPEG:
-                            // TODO:
+                            result = ParseJpeg(file);
+                            break;
+
+                        case IMAGE_TYPE_BCT:
+                            result = ParseBct(file);
+                            break;
+
                         default:
-                            GF_LOG_ERR("Image Type Not Supported");
                             result = false;
                             break;
                     }
@@ -598,16 +1009,44 @@ namespace GameHalloran {
                         break;
 
                     case IMAGE_TYPE_PNG:
+                        result = ParsePng(ResHandle::Buffer(), ResHandle::Size());
+                        break;
+
                     case IMAGE_TYPE_JPEG:
-                        // TODO:
+                        result = ParseJpeg(ResHandle::Buffer(), ResHandle::Size());
+                        break;
+
+                    case IMAGE_TYPE_BCT:
+                        result = ParseBct(ResHandle::Buffer(), ResHandle::Size());
+                        break;
+
                     default:
                         result = false;
-                        GF_LOG_ERR("Image Type Not Supported");
                         break;
                 }
 
             }
+            if(!result && errorRef.empty()) {
+                errorRef = (m_imageType == IMAGE_TYPE_UNKNOWN) ? std::string("Image type not supported: ") : std::string("Failed to decode the image ");
+                errorRef += m_imageFilename;
+            }
             m_initialized = true;
+        } else {
+            result = (m_imageBuffer != NULL);
+        }
+
+        return (result);
+    }
+
+    // ////////////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////////////
+    bool ImageResHandle::VInitialize()
+    {
+        std::string message;
+        const bool result = Decode(message);
+        if(!message.empty()) {
+            GF_LOG_ERR(message);
         }
 
         return (result);
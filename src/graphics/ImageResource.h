@@ -16,6 +16,7 @@
 
 #include "GameBase.h"
 #include "ResCache2.h"
+#include "TextureCompression.h"
 
 namespace GameHalloran {
 
@@ -47,6 +48,7 @@ namespace GameHalloran {
         IMAGE_TYPE_BMP,
         IMAGE_TYPE_PNG,
         IMAGE_TYPE_JPEG,
+        IMAGE_TYPE_BCT,
         IMAGE_TYPE_COUNT,
         IMAGE_TYPE_UNKNOWN
     };
@@ -68,7 +70,7 @@ namespace GameHalloran {
 
     // ////////////////////////////////////////////////////////////////////
     // Given a filename determine the image type from the enum from the
-    // file extension.
+    // file extension.  ".jpg" is accepted as well as ".jpeg".
     //
     // @param filenameRef The name of the file.
     //
@@ -79,6 +81,15 @@ namespace GameHalloran {
     // ////////////////////////////////////////////////////////////////////
     ImageType FindImageTypeFromFile(const std::string &filenameRef);
 
+    // ////////////////////////////////////////////////////////////////////
+    // Are the rows of a parsed image of this type tightly packed?  If so
+    // the GL_UNPACK_ALIGNMENT must be 1 when uploading it into OpenGL.
+    // BMP rows are padded to 4 bytes, every other type is packed.
+    // Block compressed (BCT) images are not affected by the alignment.
+    //
+    // ////////////////////////////////////////////////////////////////////
+    bool IsImageTypePacked(const ImageType type);
+
     // ////////////////////////////////////////////////////////////////////
     // Convert to ImageMode type from a string.
     //
@@ -138,6 +149,8 @@ namespace GameHalloran {
         GLint m_depth;                      ///< The depth of the image data.
         GLenum m_format;                    ///< The format of the image data.
         GLint m_components;                 ///< The number of components in the image data.
+        BlockFormat m_blockFormat;          ///< The block format of a compressed image or BLOCK_FORMAT_UNKNOWN.
+        U32 m_numberMipLevels;              ///< The number of mipmap levels in the image data.
         std::string m_imageFilename;        ///< The name of the file or resource
 
         // ////////////////////////////////////////////////////////////////////
@@ -168,6 +181,10 @@ namespace GameHalloran {
         // ////////////////////////////////////////////////////////////////////
         // Parse a PNG type image file from a file.
         //
+        // Note: Palette, grey scale and 16 bit PNGs are expanded to 8 bit
+        // luminance, RGB or RGBA.  Grey scale images with alpha are
+        // expanded to RGBA.
+        //
         // @param fd The file descriptor of the image file.
         //
         // @return bool True on success or false on failure.
@@ -178,6 +195,9 @@ namespace GameHalloran {
         // ////////////////////////////////////////////////////////////////////
         // Parse a JPEG type image file from a file.
         //
+        // Note: Grey scale JPEGs are loaded as luminance and everything
+        // else as RGB.
+        //
         // @param fd The file descriptor of the image file.
         //
         // @return bool True on success or false on failure.
@@ -185,6 +205,16 @@ namespace GameHalloran {
         // ////////////////////////////////////////////////////////////////////
         bool ParseJpeg(FILE *fd);
 
+        // ////////////////////////////////////////////////////////////////////
+        // Parse a block compressed BCT image file from a file.
+        //
+        // @param fd The file descriptor of the image file.
+        //
+        // @return bool True on success or false on failure.
+        //
+        // ////////////////////////////////////////////////////////////////////
+        bool ParseBct(FILE *fd);
+
         // ////////////////////////////////////////////////////////////////////
         // Parse a TGA type image file from a memory stream.
         //
@@ -213,7 +243,8 @@ namespace GameHalloran {
         bool ParseBmp(char *bmpStream, const size_t length);
 
         // ////////////////////////////////////////////////////////////////////
-        // Parse a PNG type image file from a memory stream.
+        // Parse a PNG type image file from a memory stream.  The stream is
+        // decoded in place without a temporary file.
         //
         // @param pngStream The image file stream in memory.
         // @param length The length of the image file stream.
@@ -224,7 +255,8 @@ namespace GameHalloran {
         bool ParsePng(char *pngStream, const size_t length);
 
         // ////////////////////////////////////////////////////////////////////
-        // Parse a JPEG type image file from a memory stream.
+        // Parse a JPEG type image file from a memory stream.  The stream is
+        // decoded in place without a temporary file.
         //
         // @param jpegStream The image file stream in memory.
         // @param length The length of the image file stream.
@@ -234,6 +266,20 @@ namespace GameHalloran {
         // ////////////////////////////////////////////////////////////////////
         bool ParseJpeg(char *jpegStream, const size_t length);
 
+        // ////////////////////////////////////////////////////////////////////
+        // Parse a block compressed BCT image file from a memory stream.
+        //
+        // Note: The image buffer holds the blocks of every mipmap level,
+        // largest first, as they are uploaded into OpenGL.
+        //
+        // @param bctStream The image file stream in memory.
+        // @param length The length of the image file stream.
+        //
+        // @return bool True on success or false on failure.
+        //
+        // ////////////////////////////////////////////////////////////////////
+        bool ParseBct(char *bctStream, const size_t length);
+
     public:
         // ////////////////////////////////////////////////////////////////////
         // Constructor.
@@ -283,7 +329,7 @@ namespace GameHalloran {
         GLint GetImageHeight() const;
 
         // ////////////////////////////////////////////////////////////////////
-        // Get image depth.
+        // Get image depth.  0 for block compressed images.
         //
         // ////////////////////////////////////////////////////////////////////
         GLint GetImageDepth() const;
@@ -295,11 +341,51 @@ namespace GameHalloran {
         GLint GetImageComponents() const;
 
         // ////////////////////////////////////////////////////////////////////
-        // Get the image format.
+        // Get the image format.  For block compressed images this is the
+        // compressed internal format (e.g. GL_COMPRESSED_RGB_S3TC_DXT1_EXT).
         //
         // ////////////////////////////////////////////////////////////////////
         GLenum GetImageFormat() const;
 
+        // ////////////////////////////////////////////////////////////////////
+        // Is the image data block compressed?
+        //
+        // ////////////////////////////////////////////////////////////////////
+        inline bool IsCompressed() const {
+            return (m_blockFormat != BLOCK_FORMAT_UNKNOWN);
+        };
+
+        // ////////////////////////////////////////////////////////////////////
+        // Get the block format of a compressed image.
+        //
+        // ////////////////////////////////////////////////////////////////////
+        inline BlockFormat GetBlockFormat() const {
+            return (m_blockFormat);
+        };
+
+        // ////////////////////////////////////////////////////////////////////
+        // Get the number of mipmap levels in the image data.  Always 1 for
+        // uncompressed images.
+        //
+        // ////////////////////////////////////////////////////////////////////
+        inline U32 GetNumberMipLevels() const {
+            return (m_numberMipLevels);
+        };
+
+        // ////////////////////////////////////////////////////////////////////
+        // Get a mipmap level of a block compressed image.
+        //
+        // @param level The mipmap level, 0 is the largest.
+        // @param widthRef The width of the level in texels.
+        // @param heightRef The height of the level in texels.
+        // @param sizeRef The size of the level in bytes.
+        //
+        // @return const GLbyte* The level's blocks or NULL if the image is
+        //                          not compressed or has no such level.
+        //
+        // ////////////////////////////////////////////////////////////////////
+        const GLbyte *GetMipLevelBuffer(const U32 level, GLint &widthRef, GLint &heightRef, GLint &sizeRef) const;
+
         // ////////////////////////////////////////////////////////////////////
         // Get the filename of the image.
         //
@@ -318,11 +404,30 @@ namespace GameHalloran {
         // 2) Image files are relatively large and a an init method gives more
         //      control over when they are loaded into RAM.
         //
-        // @return bool True on success or false on failure.
+        // Logs the reason on failure so must be called on the main thread,
+        // use Decode() on the other threads.
+        //
+        // @return bool True on success or false on failure.  Calling the
+        //              method again returns the result of the first call.
         //
         // ////////////////////////////////////////////////////////////////////
         virtual bool VInitialize();
 
+        // ////////////////////////////////////////////////////////////////////
+        // Initialize the image without logging.  Parsing does not touch the
+        // resource cache, OpenGL or the log, so different images may be
+        // decoded on different threads at the same time (see
+        // ImageLoadingPipeline).  The same image must not be.
+        //
+        // @param errorRef Set to the reason the first call failed, left
+        //                  untouched otherwise.
+        //
+        // @return bool True on success or false on failure.  Calling the
+        //              method again returns the result of the first call.
+        //
+        // ////////////////////////////////////////////////////////////////////
+        bool Decode(std::string &errorRef);
+
     };
 }
 
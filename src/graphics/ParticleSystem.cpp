@@ -154,20 +154,27 @@ namespace GameHalloran {
                 glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
                 GF_CHECK_GL_ERROR();
 
-                if(FindImageTypeFromFile(m_textureResource.GetName()) == IMAGE_TYPE_TGA) {
+                if(IsImageTypePacked(FindImageTypeFromFile(m_textureResource.GetName()))) {
                     glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
                     GF_CHECK_GL_ERROR();
                 }
 
-                glTexImage2D(GL_TEXTURE_2D,
-                             0,
-                             imgH->GetImageComponents(),
-                             imgH->GetImageWidth(),
-                             imgH->GetImageHeight(),
-                             0,
-                             imgH->GetImageFormat(),
-                             GL_UNSIGNED_BYTE,
-                             imgH->GetImageBuffer());
+                if(imgH->IsCompressed()) {
+                    // Only the top level is sampled with GL_LINEAR.
+                    GLint width, height, size;
+                    const GLbyte *levelPtr = imgH->GetMipLevelBuffer(0, width, height, size);
+                    glCompressedTexImage2D(GL_TEXTURE_2D, 0, imgH->GetImageFormat(), width, height, 0, size, levelPtr);
+                } else {
+                    glTexImage2D(GL_TEXTURE_2D,
+                                 0,
+                                 imgH->GetImageComponents(),
+                                 imgH->GetImageWidth(),
+                                 imgH->GetImageHeight(),
+                                 0,
+                                 imgH->GetImageFormat(),
+                                 GL_UNSIGNED_BYTE,
+                                 imgH->GetImageBuffer());
+                }
                 result = GF_CHECK_GL_ERROR();
             }
         }
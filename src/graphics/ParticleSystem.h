@@ -26,6 +26,7 @@
 #include "GameColors.h"
 #include "ImageResource.h"
 #include "CRandom.h"
+#include "PoolObject.h"
 
 namespace GameHalloran {
 
@@ -34,9 +35,10 @@ namespace GameHalloran {
     // @author PJ O Halloran
     //
     // Base class that represents attributes common to a single particle.
+    // Particles are allocated from the games small object pool.
     //
     // /////////////////////////////////////////////////////////////////
-    class Particle {
+    class Particle : public PoolObject {
     private:
         Point3 m_position;                      ///< Current position of the particle.
         Vector3 m_velocity;                     ///< Current velocity.
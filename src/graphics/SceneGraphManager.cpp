@@ -52,6 +52,38 @@
 
 namespace GameHalloran {
 
+    namespace {
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the name of the ProgrammablePhongAds shader, which the SGM
+        // uses as its global shader.
+        //
+        // /////////////////////////////////////////////////////////////////
+        std::string GetAdsShaderName()
+        {
+            return (std::string("shaders") + ZipFile::ZIP_PATH_SEPERATOR + std::string("ProgrammablePhongAds"));
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Is the shader the ProgrammablePhongAds shader, which the SGM
+        // uses as its global shader?
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool IsAdsShaderName(const std::string &shaderNameRef)
+        {
+            return (shaderNameRef == GetAdsShaderName());
+        }
+
+        // Values of the ADS shader's GF_ADS_FOG define for each fog type.
+        const char * const ADS_FOG_DEFINES[SceneGraphManager::FogEffectAttributes::eTYPE_COUNT] = {
+            "FOG_OFF",
+            "FOG_LINEAR",
+            "FOG_EXPONENTIAL",
+            "FOG_EXPONENTIAL_BY_TWO"
+        };
+
+    }
+
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
@@ -59,6 +91,7 @@ namespace GameHalloran {
     {
         if(!m_globalShaderPtr) {
             m_adsUniformCache.Reset();
+            SetupAdsUniformBlocks();
             return;
         }
 
@@ -91,11 +124,146 @@ namespace GameHalloran {
 
         m_adsUniformCache.m_cameraPos = m_globalShaderPtr->GetUniform("u_cameraPos");
 
-        m_adsUniformCache.m_fogType = m_globalShaderPtr->GetUniform("u_fogType");
         m_adsUniformCache.m_fogMinDist = m_globalShaderPtr->GetUniform("u_fogMin");
         m_adsUniformCache.m_fogMaxDist = m_globalShaderPtr->GetUniform("u_fogMax");
         m_adsUniformCache.m_fogDensity = m_globalShaderPtr->GetUniform("u_fogDensity");
         m_adsUniformCache.m_fogColor = m_globalShaderPtr->GetUniform("u_fogColor");
+
+        SetupAdsUniformBlocks();
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void SceneGraphManager::SetupAdsUniformBlocks()
+    {
+        m_adsFrameBlockPtr.reset();
+        m_adsMaterialBlockPtr.reset();
+
+        if(!m_adsUniformBlocksEnabled || !m_globalShaderPtr || !m_globalShaderPtr->HasUniformBlock("AdsFrame") || !m_globalShaderPtr->HasUniformBlock("AdsMaterial")) {
+            return;
+        }
+        if(!UniformBlock::IsSupported()) {
+            GF_LOG_TRACE_ERR("SceneGraphManager::SetupAdsUniformBlocks()", "The ADS shader has uniform blocks but the GL context does not support uniform buffers");
+            return;
+        }
+
+        // The members must be added in the order the shader declares them.
+        boost::shared_ptr<UniformBlock> frameBlockPtr(GCC_NEW UniformBlock("AdsFrame"));
+        frameBlockPtr->AddMember("u_globalAmbient", UniformBlock::eVec4);
+        frameBlockPtr->AddMember("u_cameraPos", UniformBlock::eVec4);
+        frameBlockPtr->AddMember("u_numberLights", UniformBlock::eInt);
+        frameBlockPtr->AddMember("u_fogMin", UniformBlock::eFloat);
+        frameBlockPtr->AddMember("u_fogMax", UniformBlock::eFloat);
+        frameBlockPtr->AddMember("u_fogDensity", UniformBlock::eFloat);
+        frameBlockPtr->AddMember("u_fogColor", UniformBlock::eVec3);
+        frameBlockPtr->AddMember("u_lightTypesArr", UniformBlock::eInt, MAX_LIGHTS);
+        frameBlockPtr->AddMember("u_lightPositionArr", UniformBlock::eVec3, MAX_LIGHTS);
+        frameBlockPtr->AddMember("u_lightAmbientArr", UniformBlock::eVec4, MAX_LIGHTS);
+        frameBlockPtr->AddMember("u_lightDiffuseArr", UniformBlock::eVec4, MAX_LIGHTS);
+        frameBlockPtr->AddMember("u_lightSpecularArr", UniformBlock::eVec4, MAX_LIGHTS);
+        frameBlockPtr->AddMember("u_spotlightCutoffArr", UniformBlock::eFloat, MAX_LIGHTS);
+        frameBlockPtr->AddMember("u_spotlightExpArr", UniformBlock::eFloat, MAX_LIGHTS);
+        frameBlockPtr->AddMember("u_spotlightDirection", UniformBlock::eVec3, MAX_LIGHTS);
+        frameBlockPtr->AddMember("u_cAttArr", UniformBlock::eFloat, MAX_LIGHTS);
+        frameBlockPtr->AddMember("u_lAttArr", UniformBlock::eFloat, MAX_LIGHTS);
+        frameBlockPtr->AddMember("u_qAttArr", UniformBlock::eFloat, MAX_LIGHTS);
+        assert(frameBlockPtr->GetNumberMembers() == eFrameQuadAtt + 1);
+
+        boost::shared_ptr<UniformBlock> materialBlockPtr(GCC_NEW UniformBlock("AdsMaterial"));
+        materialBlockPtr->AddMember("u_materialE", UniformBlock::eVec4);
+        materialBlockPtr->AddMember("u_materialA", UniformBlock::eVec4);
+        materialBlockPtr->AddMember("u_materialD", UniformBlock::eVec4);
+        materialBlockPtr->AddMember("u_materialS", UniformBlock::eVec4);
+        materialBlockPtr->AddMember("u_materialExp", UniformBlock::eFloat);
+        assert(materialBlockPtr->GetNumberMembers() == eMaterialExp + 1);
+
+        if(!m_globalShaderPtr->BindUniformBlock(frameBlockPtr->GetName(), ADS_FRAME_BINDING) || \
+                !m_globalShaderPtr->BindUniformBlock(materialBlockPtr->GetName(), ADS_MATERIAL_BINDING)) {
+            GF_LOG_TRACE_ERR("SceneGraphManager::SetupAdsUniformBlocks()", "Failed to bind the ADS shader uniform blocks");
+            return;
+        }
+
+        m_adsFrameBlockPtr = frameBlockPtr;
+        m_adsMaterialBlockPtr = materialBlockPtr;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void SceneGraphManager::FillAdsLightArrays(AdsLightArrays &arraysRef) const
+    {
+        // Lights which are off are left zeroed so unchanged frames pack to the same bytes.
+        memset(&arraysRef, 0, sizeof(AdsLightArrays));
+        arraysRef.m_number = std::min(static_cast<GLint>(m_dynamicLights.size()), static_cast<GLint>(MAX_LIGHTS));
+
+        I32 index = 0;
+        Matrix4 viewMat(m_camera->VGet()->GetToWorld());
+        for(LightVector::const_iterator i = m_dynamicLights.begin(), end = m_dynamicLights.end(); ((index < MAX_LIGHTS) && (i != end)); ++i, ++index) {
+            boost::shared_ptr<Light> currLight = *i;
+            if(currLight->IsOn()) {
+                arraysRef.m_types[index][0] = currLight->GetLightType();
+                arraysRef.m_cutoff[index][0] = currLight->GetSpotlightCutoff();
+                arraysRef.m_exp[index][0] = currLight->GetSpotlightExponent();
+                arraysRef.m_cAtt[index][0] = currLight->GetConstantAttenuation();
+                arraysRef.m_lAtt[index][0] = currLight->GetLinearAttenuation();
+                arraysRef.m_qAtt[index][0] = currLight->GetQuadraticAttenuation();
+
+                // Translate light position and direction vectors into View/Camera space.
+                Vector4 lightWorldPos(currLight->GetPosition());
+                Vector4 lightWorldDir(currLight->GetDirection());
+                Vector4 lightViewPos(viewMat * lightWorldPos);
+                Vector4 lightViewDir(viewMat * lightWorldDir);
+                lightViewDir.Normalize();
+                Vector3 lightViewPos3(lightViewPos);
+                Vector3 lightViewDir3(lightViewDir);
+
+                memcpy(arraysRef.m_position[index], lightViewPos3.GetComponentsConst(), m_adsUniformCache.FLOAT_SIZE * 3);
+                memcpy(arraysRef.m_direction[index], lightViewDir3.GetComponentsConst(), m_adsUniformCache.FLOAT_SIZE * 3);
+                memcpy(arraysRef.m_ambient[index], currLight->GetAmbient().GetComponentsConst(), m_adsUniformCache.FLOAT_ARR_SIZE);
+                memcpy(arraysRef.m_diffuse[index], currLight->GetDiffuse().GetComponentsConst(), m_adsUniformCache.FLOAT_ARR_SIZE);
+                memcpy(arraysRef.m_specular[index], currLight->GetSpecular().GetComponentsConst(), m_adsUniformCache.FLOAT_ARR_SIZE);
+            }
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void SceneGraphManager::UpdateAdsFrameBlock()
+    {
+        UniformBlock &frameRef = *m_adsFrameBlockPtr;
+
+        frameRef.SetValue(eFrameGlobalAmbient, m_ambientLightSrc.GetAmbient().GetComponentsConst());
+        Vector4 camPos(m_camera->GetPosition());
+        frameRef.SetValue(eFrameCameraPos, camPos.GetComponentsConst());
+
+        AdsLightArrays lights;
+        FillAdsLightArrays(lights);
+        frameRef.SetValue(eFrameNumberLights, lights.m_number);
+        if(lights.m_number > 0) {
+            const U32 numberLights = static_cast<U32>(lights.m_number);
+            frameRef.SetValue(eFrameLightTypes, &lights.m_types[0][0], numberLights);
+            frameRef.SetValue(eFrameLightPos, &lights.m_position[0][0], numberLights);
+            frameRef.SetValue(eFrameLightAmb, &lights.m_ambient[0][0], numberLights);
+            frameRef.SetValue(eFrameLightDiff, &lights.m_diffuse[0][0], numberLights);
+            frameRef.SetValue(eFrameLightSpec, &lights.m_specular[0][0], numberLights);
+            frameRef.SetValue(eFrameSpotCutoff, &lights.m_cutoff[0][0], numberLights);
+            frameRef.SetValue(eFrameSpotExp, &lights.m_exp[0][0], numberLights);
+            frameRef.SetValue(eFrameSpotDir, &lights.m_direction[0][0], numberLights);
+            frameRef.SetValue(eFrameConstantAtt, &lights.m_cAtt[0][0], numberLights);
+            frameRef.SetValue(eFrameLinearAtt, &lights.m_lAtt[0][0], numberLights);
+            frameRef.SetValue(eFrameQuadAtt, &lights.m_qAtt[0][0], numberLights);
+        }
+
+        frameRef.SetValue(eFrameFogMin, static_cast<GLfloat>(m_fogAtt.m_minDistance));
+        frameRef.SetValue(eFrameFogMax, static_cast<GLfloat>(m_fogAtt.m_maxDistance));
+        frameRef.SetValue(eFrameFogDensity, static_cast<GLfloat>(m_fogAtt.m_density));
+        frameRef.SetValue(eFrameFogColor, m_fogAtt.m_color.GetComponentsConst());
+
+        // Uploads the changed bytes of the frame block.
+        frameRef.Bind(ADS_FRAME_BINDING);
+        m_adsMaterialBlockPtr->Bind(ADS_MATERIAL_BINDING);
     }
 
     // /////////////////////////////////////////////////////////////////
@@ -170,6 +338,12 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     SceneGraphManager::SceneGraphManager(boost::shared_ptr<ModelViewProjStackManager> stackManagerPtr)
         : m_adsUniformCache()
+        , m_adsFrameBlockPtr()
+        , m_adsMaterialBlockPtr()
+        , m_adsUniformBlocksEnabled(true)
+        , m_adsAttNameList()
+        , m_adsPermutationMap()
+        , m_adsPermutationName()
         , m_root()
         , m_camera()
         , m_stackManagerPtr(stackManagerPtr)
@@ -258,67 +432,42 @@ namespace GameHalloran {
         m_adsUniformCache.m_mvMatrix->SetValue((GLfloat * const)mvMat.GetComponentsConst(), 16);
         m_adsUniformCache.m_normalMatrix->SetValue(normalMat3, 9, 1, true);
 
-        Matrix4 camMatrix(m_camera->VGet()->GetToWorld());
+        // The per frame values and the material are in uniform blocks when the shader declares them.
+        if(m_adsMaterialBlockPtr) {
+            m_adsMaterialBlockPtr->SetValue(eMaterialEmiss, objectMaterial.GetEmissive().GetComponentsConst());
+            m_adsMaterialBlockPtr->SetValue(eMaterialAmb, objectMaterial.GetAmbient().GetComponentsConst());
+            m_adsMaterialBlockPtr->SetValue(eMaterialDiff, objectMaterial.GetDiffuse().GetComponentsConst());
+            m_adsMaterialBlockPtr->SetValue(eMaterialSpec, objectMaterial.GetSpecular().GetComponentsConst());
+            m_adsMaterialBlockPtr->SetValue(eMaterialExp, (GLfloat)objectMaterial.GetSpecularPower());
+            m_adsMaterialBlockPtr->Upload();
+
+            // Activate the shader.
+            m_globalShaderPtr->Activate();
+
+            return (true);
+        }
+
         Vector4 camPos(m_camera->GetPosition());
-        Vector4 camEyePos(camMatrix * camPos);
         m_adsUniformCache.m_cameraPos->SetValue((GLfloat * const)camPos.GetComponentsConst(), 4);
 
         // Set up Light uniforms.
         if(!m_dynamicLights.empty()) {
-            const GLint numberLights(m_dynamicLights.size());
-
-            GLint lightTypesArr[MAX_LIGHTS][1];
-            GLfloat lightPositionArr[MAX_LIGHTS][3];
-            GLfloat lightAmbientArr[MAX_LIGHTS][4];
-            GLfloat lightDiffuseArr[MAX_LIGHTS][4];
-            GLfloat lightSpecularArr[MAX_LIGHTS][4];
-            GLfloat lightCutoffArr[MAX_LIGHTS][1];
-            GLfloat lightExpArr[MAX_LIGHTS][1];
-            GLfloat lightDirectionArr[MAX_LIGHTS][3];
-            GLfloat lightCAttArr[MAX_LIGHTS][1];
-            GLfloat lightLAttArr[MAX_LIGHTS][1];
-            GLfloat lightQAttArr[MAX_LIGHTS][1];
-            I32 index = 0;
-            Matrix4 viewMat(m_camera->VGet()->GetToWorld());
-            for(LightVector::iterator i = m_dynamicLights.begin(), end = m_dynamicLights.end(); ((index < MAX_LIGHTS) && (i != end)); ++i, ++index) {
-                boost::shared_ptr<Light> currLight = *i;
-                if(currLight->IsOn()) {
-                    lightTypesArr[index][0] = currLight->GetLightType();
-                    lightCutoffArr[index][0] = currLight->GetSpotlightCutoff();
-                    lightExpArr[index][0] = currLight->GetSpotlightExponent();
-                    lightCAttArr[index][0] = currLight->GetConstantAttenuation();
-                    lightLAttArr[index][0] = currLight->GetLinearAttenuation();
-                    lightQAttArr[index][0] = currLight->GetQuadraticAttenuation();
-
-                    // Translate light position and direction vectors into View/Camera space.
-                    Vector4 lightWorldPos(currLight->GetPosition());
-                    Vector4 lightWorldDir(currLight->GetDirection());
-                    Vector4 lightViewPos(viewMat * lightWorldPos);
-                    Vector4 lightViewDir(viewMat * lightWorldDir);
-                    lightViewDir.Normalize();
-                    Vector3 lightViewPos3(lightViewPos);
-                    Vector3 lightViewDir3(lightViewDir);
-
-                    memcpy(lightPositionArr[index], lightViewPos3.GetComponentsConst(), m_adsUniformCache.FLOAT_SIZE * 3);
-                    memcpy(lightDirectionArr[index], lightViewDir3.GetComponentsConst(), m_adsUniformCache.FLOAT_SIZE * 3);
-                    memcpy(lightAmbientArr[index], currLight->GetAmbient().GetComponentsConst(), m_adsUniformCache.FLOAT_ARR_SIZE);
-                    memcpy(lightDiffuseArr[index], currLight->GetDiffuse().GetComponentsConst(), m_adsUniformCache.FLOAT_ARR_SIZE);
-                    memcpy(lightSpecularArr[index], currLight->GetSpecular().GetComponentsConst(), m_adsUniformCache.FLOAT_ARR_SIZE);
-                }
-            }
+            AdsLightArrays lights;
+            FillAdsLightArrays(lights);
 
+            const GLint numberLights(lights.m_number);
             m_adsUniformCache.m_numLights->SetValue(numberLights);
-            m_adsUniformCache.m_lightTypes->SetValue((GLint * const)lightTypesArr, 1, numberLights);
-            m_adsUniformCache.m_lightPos->SetValue((GLfloat * const)lightPositionArr, 3, numberLights);
-            m_adsUniformCache.m_lightAmb->SetValue((GLfloat * const)lightAmbientArr, 4, numberLights);
-            m_adsUniformCache.m_lightDiff->SetValue((GLfloat * const)lightDiffuseArr, 4, numberLights);
-            m_adsUniformCache.m_lightSpec->SetValue((GLfloat * const)lightSpecularArr, 4, numberLights);
-            m_adsUniformCache.m_spotCutoff->SetValue((GLfloat * const)lightCutoffArr, 1, numberLights);
-            m_adsUniformCache.m_spotExp->SetValue((GLfloat * const)lightExpArr, 1, numberLights);
-            m_adsUniformCache.m_spotDir->SetValue((GLfloat * const)lightDirectionArr, 3, numberLights);
-            m_adsUniformCache.m_constantAtt->SetValue((GLfloat * const)lightCAttArr, 1, numberLights);
-            m_adsUniformCache.m_linearAtt->SetValue((GLfloat * const)lightLAttArr, 1, numberLights);
-            m_adsUniformCache.m_quadAtt->SetValue((GLfloat * const)lightQAttArr, 1, numberLights);
+            m_adsUniformCache.m_lightTypes->SetValue((GLint * const)lights.m_types, 1, numberLights);
+            m_adsUniformCache.m_lightPos->SetValue((GLfloat * const)lights.m_position, 3, numberLights);
+            m_adsUniformCache.m_lightAmb->SetValue((GLfloat * const)lights.m_ambient, 4, numberLights);
+            m_adsUniformCache.m_lightDiff->SetValue((GLfloat * const)lights.m_diffuse, 4, numberLights);
+            m_adsUniformCache.m_lightSpec->SetValue((GLfloat * const)lights.m_specular, 4, numberLights);
+            m_adsUniformCache.m_spotCutoff->SetValue((GLfloat * const)lights.m_cutoff, 1, numberLights);
+            m_adsUniformCache.m_spotExp->SetValue((GLfloat * const)lights.m_exp, 1, numberLights);
+            m_adsUniformCache.m_spotDir->SetValue((GLfloat * const)lights.m_direction, 3, numberLights);
+            m_adsUniformCache.m_constantAtt->SetValue((GLfloat * const)lights.m_cAtt, 1, numberLights);
+            m_adsUniformCache.m_linearAtt->SetValue((GLfloat * const)lights.m_lAtt, 1, numberLights);
+            m_adsUniformCache.m_quadAtt->SetValue((GLfloat * const)lights.m_qAtt, 1, numberLights);
         }
 
         m_adsUniformCache.m_globalAmb->SetValue((GLfloat * const)m_ambientLightSrc.GetAmbient().GetComponentsConst(), 4, 1);
@@ -330,7 +479,6 @@ namespace GameHalloran {
         m_adsUniformCache.m_materialSpec->SetValue((GLfloat * const)objectMaterial.GetSpecular().GetComponentsConst(), 4);
         m_adsUniformCache.m_materialExp->SetValue((GLfloat)objectMaterial.GetSpecularPower());
 
-        m_adsUniformCache.m_fogType->SetValue(m_fogAtt.m_type);
         switch(m_fogAtt.m_type) {
             case FogEffectAttributes::eLinear: {
                 m_adsUniformCache.m_fogMinDist->SetValue(m_fogAtt.m_minDistance);
@@ -365,6 +513,11 @@ namespace GameHalloran {
         // 4. Anything with Alpha
 
         if(m_root && m_camera) {
+            SelectAdsShaderPermutation();
+            if(m_adsFrameBlockPtr) {
+                UpdateAdsFrameBlock();
+            }
+
             if(m_root->VPreRender()) {
                 m_root->VRender();
                 m_root->VRenderChildren();
@@ -492,9 +645,12 @@ namespace GameHalloran {
         }
 
         // Set the global shader for rendering SG nodes to use the ProgrammablePhongAds shader.
-        std::string tmpStr(std::string("shaders") + ZipFile::ZIP_PATH_SEPERATOR + std::string("ProgrammablePhongAds"));
-        if(shaderNameRef.compare(tmpStr.c_str()) == 0) {
+        if(IsAdsShaderName(shaderNameRef)) {
+            ShaderDefineList defines;
+            GetAdsShaderDefines(defines);
             m_globalShaderPtr = shaderPtr;
+            m_adsPermutationName = GetShaderPermutationName(shaderNameRef, defines);
+            m_adsPermutationMap[m_adsPermutationName] = shaderPtr;
             SetupGlobalShaderUniformCache();
         }
 
@@ -503,6 +659,75 @@ namespace GameHalloran {
         return (true);
     }
 
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void SceneGraphManager::GetShaderDefines(const std::string &shaderNameRef, ShaderDefineList &definesRef) const
+    {
+        definesRef.clear();
+
+        if(IsAdsShaderName(shaderNameRef)) {
+            GetAdsShaderDefines(definesRef);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void SceneGraphManager::GetAdsShaderDefines(ShaderDefineList &definesRef) const
+    {
+        definesRef.clear();
+
+        // Without uniform buffers the ADS shader falls back to loose uniforms.
+        const bool useBlocks = m_adsUniformBlocksEnabled && UniformBlock::IsSupported();
+        definesRef.push_back(std::make_pair(std::string("GF_ADS_UNIFORM_BLOCKS"), std::string(useBlocks ? "1" : "0")));
+
+        bool lightsOn = false;
+        for(LightVector::const_iterator i = m_dynamicLights.begin(), end = m_dynamicLights.end(); !lightsOn && i != end; ++i) {
+            lightsOn = (*i)->IsOn();
+        }
+        definesRef.push_back(std::make_pair(std::string("GF_ADS_LIGHTS"), std::string(lightsOn ? "1" : "0")));
+
+        const bool validFog = (m_fogAtt.m_type >= 0 && m_fogAtt.m_type < FogEffectAttributes::eTYPE_COUNT);
+        definesRef.push_back(std::make_pair(std::string("GF_ADS_FOG"), std::string(ADS_FOG_DEFINES[validFog ? m_fogAtt.m_type : FogEffectAttributes::eOff])));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void SceneGraphManager::SelectAdsShaderPermutation()
+    {
+        if(!m_globalShaderPtr) {
+            return;
+        }
+
+        ShaderDefineList defines;
+        GetAdsShaderDefines(defines);
+        const std::string adsName(GetAdsShaderName());
+        const std::string permutationName(GetShaderPermutationName(adsName, defines));
+        if(permutationName == m_adsPermutationName) {
+            return;
+        }
+
+        std::map<std::string, boost::shared_ptr<GLSLShader> >::iterator i = m_adsPermutationMap.find(permutationName);
+        if(i == m_adsPermutationMap.end()) {
+            // Read from the shader archive when it has the permutation.
+            boost::shared_ptr<GLSLShader> shaderPtr(BuildShaderFromResourceCache(adsName, m_adsAttNameList, defines));
+            if(!shaderPtr) {
+                GF_LOG_TRACE_ERR("SceneGraphManager::SelectAdsShaderPermutation()", std::string("Failed to build ") + permutationName + std::string(", rendering with ") + m_adsPermutationName);
+            }
+            i = m_adsPermutationMap.insert(std::make_pair(permutationName, shaderPtr)).first;
+        }
+        if(!i->second) {
+            return;
+        }
+
+        m_globalShaderPtr = i->second;
+        m_adsPermutationName = permutationName;
+        m_shaderMap[adsName] = m_globalShaderPtr;
+        SetupGlobalShaderUniformCache();
+    }
+
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
@@ -524,7 +749,12 @@ namespace GameHalloran {
         bool error = false;
         std::vector<VSAttributeNameList>::const_iterator currentAttIter = vsAttNameListVec.begin();
         for(std::vector<std::string>::const_iterator i = shaderNameVec.begin(), end = shaderNameVec.end(); i != end; ++i, ++currentAttIter) {
-            boost::shared_ptr<GLSLShader> shaderObj(BuildShaderFromResourceCache(*i, *currentAttIter));
+            if(IsAdsShaderName(*i)) {
+                sgm.SetAdsAttributeNameList(*currentAttIter);
+            }
+            ShaderDefineList defines;
+            sgm.GetShaderDefines(*i, defines);
+            boost::shared_ptr<GLSLShader> shaderObj(BuildShaderFromResourceCache(*i, *currentAttIter, defines));
             if(shaderObj && !sgm.AddShader(shaderObj, *i)) {
                 GF_LOG_TRACE_ERR("AddShadersToSceneGraphManager()", std::string("Failed to add the ") + *i + std::string(" shader to the SceneGraphManager"));
                 error = true;
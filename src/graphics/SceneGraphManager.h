@@ -71,6 +71,7 @@
 #include "GameColors.h"
 #include "LuaStateManager.h"
 #include "TextureManager.h"
+#include "UniformBlock.h"
 
 namespace GameHalloran {
 
@@ -160,7 +161,6 @@ namespace GameHalloran {
             ShaderUniformSPtr m_materialDiff;               ///< Location for the uniform "u_materialD".
             ShaderUniformSPtr m_materialSpec;               ///< Location for the uniform "u_materialS".
             ShaderUniformSPtr m_materialExp;                ///< Location for the uniform "u_materialExp".
-            ShaderUniformSPtr m_fogType;                    ///< "Fog.type" uniform.
             ShaderUniformSPtr m_fogMinDist;                 ///< "Fog.minDistance" uniform.
             ShaderUniformSPtr m_fogMaxDist;                 ///< "Fog.maxDistance" uniform.
             ShaderUniformSPtr m_fogColor;                   ///< "Fog.color" uniform.
@@ -209,7 +209,6 @@ namespace GameHalloran {
                 m_materialSpec.reset();
                 m_materialExp.reset();
                 m_cameraPos.reset();
-                m_fogType.reset();
                 m_fogColor.reset();
                 m_fogMinDist.reset();
                 m_fogMaxDist.reset();
@@ -217,7 +216,71 @@ namespace GameHalloran {
             };
         };
 
+        // Uniform buffer binding points of the ADS shader uniform blocks.
+        static const GLuint ADS_FRAME_BINDING = 0;
+        static const GLuint ADS_MATERIAL_BINDING = 1;
+
+        // Members of the "AdsFrame" uniform block, in the order the shader declares them.
+        enum AdsFrameMember {
+            eFrameGlobalAmbient = 0,
+            eFrameCameraPos,
+            eFrameNumberLights,
+            eFrameFogMin,
+            eFrameFogMax,
+            eFrameFogDensity,
+            eFrameFogColor,
+            eFrameLightTypes,
+            eFrameLightPos,
+            eFrameLightAmb,
+            eFrameLightDiff,
+            eFrameLightSpec,
+            eFrameSpotCutoff,
+            eFrameSpotExp,
+            eFrameSpotDir,
+            eFrameConstantAtt,
+            eFrameLinearAtt,
+            eFrameQuadAtt
+        };
+
+        // Members of the "AdsMaterial" uniform block, in the order the shader declares them.
+        enum AdsMaterialMember {
+            eMaterialEmiss = 0,
+            eMaterialAmb,
+            eMaterialDiff,
+            eMaterialSpec,
+            eMaterialExp
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct AdsLightArrays
+        // @author PJ O Halloran
+        //
+        // The dynamic lights in camera space, packed as the ADS shader
+        // takes them.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct AdsLightArrays {
+            GLint m_number;                                 ///< Number of lights in the arrays.
+            GLint m_types[MAX_LIGHTS][1];                   ///< Light types.
+            GLfloat m_position[MAX_LIGHTS][3];              ///< Light positions.
+            GLfloat m_ambient[MAX_LIGHTS][4];               ///< Light ambient colors.
+            GLfloat m_diffuse[MAX_LIGHTS][4];               ///< Light diffuse colors.
+            GLfloat m_specular[MAX_LIGHTS][4];              ///< Light specular colors.
+            GLfloat m_cutoff[MAX_LIGHTS][1];                ///< Spotlight cutoffs.
+            GLfloat m_exp[MAX_LIGHTS][1];                   ///< Spotlight exponents.
+            GLfloat m_direction[MAX_LIGHTS][3];             ///< Spotlight directions.
+            GLfloat m_cAtt[MAX_LIGHTS][1];                  ///< Constant attenuations.
+            GLfloat m_lAtt[MAX_LIGHTS][1];                  ///< Linear attenuations.
+            GLfloat m_qAtt[MAX_LIGHTS][1];                  ///< Quadratic attenuations.
+        };
+
         AdsUniformLocCache m_adsUniformCache;                                   ///< Cache of uniforms for the global ADS shader.
+        boost::shared_ptr<UniformBlock> m_adsFrameBlockPtr;                     ///< Per frame uniform block of the ADS shader, NULL when the shader has no uniform blocks.
+        boost::shared_ptr<UniformBlock> m_adsMaterialBlockPtr;                  ///< Per material uniform block of the ADS shader, NULL when the shader has no uniform blocks.
+        bool m_adsUniformBlocksEnabled;                                         ///< Build the ADS shader with its uniform blocks when the context supports them.
+        VSAttributeNameList m_adsAttNameList;                                   ///< Attributes the ADS shader permutations are built with.
+        std::map<std::string, boost::shared_ptr<GLSLShader> > m_adsPermutationMap;  ///< ADS shader permutations built so far by permutation name, NULL if the build failed.
+        std::string m_adsPermutationName;                                       ///< Permutation name of the global shader.
         boost::shared_ptr<SceneNode> m_root;                                    ///< The root node of the SG.
         boost::shared_ptr<CameraSceneNode> m_camera;                            ///< The node acting as the camera.
         boost::shared_ptr<ModelViewProjStackManager> m_stackManagerPtr;         ///< Pointer to the modelview/proj stack manager.
@@ -237,6 +300,45 @@ namespace GameHalloran {
         // /////////////////////////////////////////////////////////////////
         void SetupGlobalShaderUniformCache();
 
+        // /////////////////////////////////////////////////////////////////
+        // Create the uniform blocks for the global ADS shader if it
+        // declares them and the GL context supports uniform buffers.
+        // Otherwise the uniforms are set one at a time.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void SetupAdsUniformBlocks();
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the defines of the ADS shader permutation for the uniform
+        // block setting, the lights which are on and the fog type.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void GetAdsShaderDefines(ShaderDefineList &definesRef) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Make the global shader the ADS shader permutation for the lights
+        // and fog of the scene.  A permutation is built the first time it
+        // is needed and kept.  If it fails to build the global shader is
+        // left unchanged.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void SelectAdsShaderPermutation();
+
+        // /////////////////////////////////////////////////////////////////
+        // Transform the dynamic lights into camera space and pack them
+        // into arrays for the ADS shader.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void FillAdsLightArrays(AdsLightArrays &arraysRef) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Pack the per frame values of the ADS shader (camera, lights and
+        // fog) into its uniform block and bind the blocks.  Only the bytes
+        // which changed since the last frame are uploaded.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void UpdateAdsFrameBlock();
+
         // /////////////////////////////////////////////////////////////////
         // Render all the blended scene nodes in reverse Z sorted order.
         //
@@ -345,6 +447,47 @@ namespace GameHalloran {
             return (m_globalShaderPtr);
         };
 
+        // /////////////////////////////////////////////////////////////////
+        // Enable or disable the uniform blocks of the ADS shader.  When
+        // disabled the ADS shader is built with loose uniforms, which
+        // PrepareAdsShader() sets one at a time.  Call it before the ADS
+        // shader is added, otherwise the next OnRender() builds the other
+        // permutation.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void SetAdsUniformBlocksEnabled(const bool enabled) {
+            m_adsUniformBlocksEnabled = enabled;
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Are the uniform blocks of the ADS shader enabled?
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool AreAdsUniformBlocksEnabled() const {
+            return (m_adsUniformBlocksEnabled);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Set the attributes the permutations of the ADS shader are built
+        // with, as OnRender() builds them when the lights or fog change.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void SetAdsAttributeNameList(const VSAttributeNameList &attNameListRef) {
+            m_adsAttNameList = attNameListRef;
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the defines of the permutation of a shader the SGM renders
+        // with.  Shaders without permutations get no defines.  The ADS
+        // shader permutation depends on the uniform block setting, whether
+        // any light is on and the fog type.
+        //
+        // @param shaderNameRef The name of the shader.
+        // @param definesRef Output defines.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void GetShaderDefines(const std::string &shaderNameRef, ShaderDefineList &definesRef) const;
+
         // /////////////////////////////////////////////////////////////////
         // Set all the required program uniforms for the ADS shader.
         //
@@ -454,7 +597,8 @@ namespace GameHalloran {
 
         // /////////////////////////////////////////////////////////////////
         // Check if the ray intersects with any of the nodes being managed
-        // by the SGM.
+        // by the SGM (see ISceneNode::VPick() for how this differs from
+        // the physics ray queries).
         //
         // @param ray The raycast.
         //
@@ -491,7 +635,8 @@ namespace GameHalloran {
         };
 
         // /////////////////////////////////////////////////////////////////
-        // Adds a pre built shader to the SceneGraphManager.
+        // Adds a pre built shader to the SceneGraphManager.  The ADS shader
+        // must be the permutation GetShaderDefines() returns.
         //
         // @param shaderPtr Pointer to the shader program.
         // @param shaderNameRef The name of the shader, hereafter used to
@@ -555,7 +700,8 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     // Utility function that loads a group of shaders from the resource
     // cache and adds them to the SceneGraphManager object also
-    // supplied.
+    // supplied.  Each shader is built with the defines returned by
+    // SceneGraphManager::GetShaderDefines().
     //
     // @param sgm The SceneGraphManager that should manage the loaded
     //              shaders.
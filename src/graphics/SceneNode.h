@@ -249,8 +249,7 @@ namespace GameHalloran {
         // Check if the ray intersects with any of the children of this
         // node.
         //
-        // @param scenePtr SceneGraph manager pointer.
-        // @param rayCastPtr Pointer to the RayCast class.
+        // @param ray Raycast.
         //
         // /////////////////////////////////////////////////////////////////
         virtual bool VPick(const RayCast &ray);
@@ -0,0 +1,512 @@
+// /////////////////////////////////////////////////////////////////
+// @file ShaderArchive.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Implementation of the packed shader archive.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "tinyxml/tinyxml.h"
+
+#include "ShaderArchive.h"
+#include "HashedString.h"
+#include "ByteOrder.h"
+
+namespace GameHalloran {
+
+    namespace {
+
+        const U8 SHADER_ARCHIVE_MAGIC[4] = { 'G', 'F', 'S', 'A' };
+        const U32 SHADER_ARCHIVE_VERSION = 1;
+        const U32 HEADER_SIZE = 16;                             ///< Magic, version, number of programs, size of the strings.
+        const U32 PROGRAM_RECORD_SIZE = 24;                     ///< Hash, name, vertex, geometry and fragment source offsets.
+        const U32 NO_SOURCE = 0xFFFFFFFF;                       ///< Source offset of a missing geometry shader.
+        const U32 MAX_INCLUDE_DEPTH = 16;
+        const U64 FNV_OFFSET_BASIS = 14695981039346656037ULL;
+        const U64 FNV_PRIME = 1099511628211ULL;
+
+        // /////////////////////////////////////////////////////////////////
+        // 64 bit FNV-1a of a string, used to find identical strings.  The
+        // names use the HashedString hash instead, as it is case blind.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U64 HashContents(const std::string &str)
+        {
+            U64 hash = FNV_OFFSET_BASIS;
+            for(std::string::const_iterator i = str.begin(), end = str.end(); i != end; ++i) {
+                hash = (hash ^ U8(*i)) * FNV_PRIME;
+            }
+            return (hash);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Order programs by their hash.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool ProgramLess(const ShaderArchiveProgram &lhs, const ShaderArchiveProgram &rhs)
+        {
+            return (lhs.m_hash < rhs.m_hash);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Get a string from the string table.
+        //
+        // @return const char* NULL if the offset is outside the table.
+        //
+        // /////////////////////////////////////////////////////////////////
+        const char *GetString(const char *stringsPtr, const U32 stringsSize, const U32 offset)
+        {
+            return ((offset < stringsSize) ? stringsPtr + offset : NULL);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Is the character part of a GLSL identifier?
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool IsIdentifierChar(const char c)
+        {
+            return (isalnum(static_cast<unsigned char>(c)) || c == '_');
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Does the identifier appear in the source as a whole word?
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool UsesIdentifier(const std::string &src, const std::string &identifier)
+        {
+            for(size_t pos = src.find(identifier); pos != std::string::npos; pos = src.find(identifier, pos + 1)) {
+                const size_t endPos = pos + identifier.size();
+                if((pos == 0 || !IsIdentifierChar(src[pos - 1])) && (endPos == src.size() || !IsIdentifierChar(src[endPos]))) {
+                    return (true);
+                }
+            }
+            return (false);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the file named by an #include line.
+        //
+        // @return bool False if the line is not an #include.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool GetIncludeFile(const std::string &line, std::string &fileRef)
+        {
+            const size_t directivePos = line.find_first_not_of(" \t");
+            if(directivePos == std::string::npos || line.compare(directivePos, 8, "#include") != 0) {
+                return (false);
+            }
+
+            const size_t openPos = line.find('"', directivePos + 8);
+            const size_t closePos = (openPos == std::string::npos) ? std::string::npos : line.find('"', openPos + 1);
+            if(closePos == std::string::npos) {
+                fileRef.clear();
+            } else {
+                fileRef = line.substr(openPos + 1, closePos - openPos - 1);
+            }
+            return (true);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Read a whole file.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool ReadFile(const boost::filesystem::path &path, std::string &contentsRef)
+        {
+            std::ifstream inputStream(path.string().c_str(), std::ios::in | std::ios::binary);
+            if(!inputStream.is_open()) {
+                return (false);
+            }
+            contentsRef.assign((std::istreambuf_iterator<char>(inputStream)), std::istreambuf_iterator<char>());
+            return (!inputStream.bad());
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Replace the #include lines of the source with their files.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool ResolveIncludes(const std::string &src, const boost::filesystem::path &includeDir, const U32 depth, \
+                             std::string &outRef, std::string &messageRef)
+        {
+            size_t lineStart = 0;
+            while(lineStart < src.size()) {
+                size_t lineEnd = src.find('\n', lineStart);
+                lineEnd = (lineEnd == std::string::npos) ? src.size() : lineEnd + 1;
+                const std::string line(src, lineStart, lineEnd - lineStart);
+                lineStart = lineEnd;
+
+                std::string includeFile;
+                if(!GetIncludeFile(line, includeFile)) {
+                    outRef += line;
+                    continue;
+                }
+
+                if(includeFile.empty()) {
+                    messageRef = std::string("Malformed include: ") + line;
+                    return (false);
+                }
+                if(depth >= MAX_INCLUDE_DEPTH) {
+                    messageRef = std::string("Includes nested too deeply at ") + includeFile;
+                    return (false);
+                }
+
+                const boost::filesystem::path includePath(includeDir / includeFile);
+                std::string includeSrc;
+                if(!ReadFile(includePath, includeSrc)) {
+                    messageRef = std::string("Failed to read the include ") + includePath.string();
+                    return (false);
+                }
+                if(!ResolveIncludes(includeSrc, includeDir, depth + 1, outRef, messageRef)) {
+                    return (false);
+                }
+                if(!outRef.empty() && outRef[outRef.size() - 1] != '\n') {
+                    outRef += '\n';
+                }
+            }
+
+            return (true);
+        }
+
+    }
+
+    // File extension of shader archives.
+    const char * const SHADER_ARCHIVE_EXTENSION = "gsa";
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool PreprocessShaderSource(const std::string &src, const boost::filesystem::path &includeDir, const ShaderDefineList &defines, \
+                                std::string &outRef, std::string &messageRef)
+    {
+        std::string resolved;
+        if(!ResolveIncludes(src, includeDir, 0, resolved, messageRef)) {
+            return (false);
+        }
+
+        std::string defineLines;
+        for(ShaderDefineList::const_iterator i = defines.begin(), end = defines.end(); i != end; ++i) {
+            if(UsesIdentifier(resolved, i->first)) {
+                defineLines += std::string("#define ") + i->first + (i->second.empty() ? std::string() : std::string(" ") + i->second) + std::string("\n");
+            }
+        }
+
+        // The defines go after the #version line, or first if there is none.
+        size_t insertPos = 0;
+        for(size_t lineStart = 0; lineStart < resolved.size();) {
+            size_t lineEnd = resolved.find('\n', lineStart);
+            lineEnd = (lineEnd == std::string::npos) ? resolved.size() : lineEnd + 1;
+            const size_t directivePos = resolved.find_first_not_of(" \t", lineStart);
+            if(directivePos < lineEnd && resolved.compare(directivePos, 8, "#version") == 0) {
+                insertPos = lineEnd;
+                if(insertPos == resolved.size() && resolved[insertPos - 1] != '\n') {
+                    resolved += '\n';
+                    ++insertPos;
+                }
+                break;
+            }
+            lineStart = lineEnd;
+        }
+
+        outRef = resolved.substr(0, insertPos) + defineLines + resolved.substr(insertPos);
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    std::string GetShaderPermutationName(const std::string &programName, const ShaderDefineList &defines)
+    {
+        if(defines.empty()) {
+            return (programName);
+        }
+
+        // Sorted so the name does not depend on the order of the defines.
+        ShaderDefineList sorted(defines);
+        std::sort(sorted.begin(), sorted.end());
+
+        std::string name(programName + std::string("["));
+        for(ShaderDefineList::const_iterator i = sorted.begin(), end = sorted.end(); i != end; ++i) {
+            if(i != sorted.begin()) {
+                name += ',';
+            }
+            name += i->first + std::string("=") + i->second;
+        }
+        return (name + std::string("]"));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void GetShaderPermutations(const ShaderOptionList &options, std::vector<ShaderDefineList> &permutationsRef)
+    {
+        permutationsRef.assign(1, ShaderDefineList());
+        for(ShaderOptionList::const_iterator i = options.begin(), end = options.end(); i != end; ++i) {
+            if(i->second.empty()) {
+                continue;
+            }
+
+            // Extend each permutation so far with every value of the option.
+            std::vector<ShaderDefineList> extended;
+            extended.reserve(permutationsRef.size() * i->second.size());
+            for(std::vector<ShaderDefineList>::const_iterator j = permutationsRef.begin(), jEnd = permutationsRef.end(); j != jEnd; ++j) {
+                for(std::vector<std::string>::const_iterator value = i->second.begin(), valueEnd = i->second.end(); value != valueEnd; ++value) {
+                    extended.push_back(*j);
+                    extended.back().push_back(std::make_pair(i->first, *value));
+                }
+            }
+            permutationsRef.swap(extended);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ReadShaderManifest(const boost::filesystem::path &manifestPath, std::vector<ShaderManifestProgram> &programsRef, std::string &messageRef)
+    {
+        TiXmlDocument doc;
+        if(!doc.LoadFile(manifestPath.string().c_str())) {
+            messageRef = std::string("Failed to parse ") + manifestPath.string() + std::string(": ") + std::string(doc.ErrorDesc());
+            return (false);
+        }
+        const TiXmlElement *rootElemPtr = doc.RootElement();
+        if(!rootElemPtr || std::string(rootElemPtr->Value()) != "ShaderManifest") {
+            messageRef = manifestPath.string() + std::string(" has no ShaderManifest element");
+            return (false);
+        }
+
+        for(const TiXmlElement *progElemPtr = rootElemPtr->FirstChildElement("Program"); progElemPtr; progElemPtr = progElemPtr->NextSiblingElement("Program")) {
+            const char *nameStr = progElemPtr->Attribute("name");
+            const char *vsStr = progElemPtr->Attribute("vs");
+            const char *fsStr = progElemPtr->Attribute("fs");
+            const char *gsStr = progElemPtr->Attribute("gs");
+            if(!nameStr || !vsStr || !fsStr) {
+                messageRef = std::string("A Program of ") + manifestPath.string() + std::string(" is missing its name, vs or fs attribute");
+                return (false);
+            }
+
+            ShaderManifestProgram program;
+            program.m_name = nameStr;
+            program.m_vsFile = vsStr;
+            program.m_fsFile = fsStr;
+            program.m_gsFile = gsStr ? gsStr : "";
+
+            for(const TiXmlElement *optElemPtr = progElemPtr->FirstChildElement("Option"); optElemPtr; optElemPtr = optElemPtr->NextSiblingElement("Option")) {
+                const char *optNameStr = optElemPtr->Attribute("name");
+                const char *valuesStr = optElemPtr->Attribute("values");
+                if(!optNameStr || !valuesStr) {
+                    messageRef = std::string("An Option of ") + program.m_name + std::string(" is missing its name or values attribute");
+                    return (false);
+                }
+
+                std::vector<std::string> values;
+                std::istringstream valueStream(valuesStr);
+                for(std::string value; valueStream >> value;) {
+                    values.push_back(value);
+                }
+                program.m_options.push_back(std::make_pair(std::string(optNameStr), values));
+            }
+
+            programsRef.push_back(program);
+        }
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool PreprocessShaderManifest(const boost::filesystem::path &shaderDir, const std::vector<ShaderManifestProgram> &programs, \
+                                  std::vector<ShaderManifestPermutation> &permutationsRef, std::string &messageRef)
+    {
+        for(std::vector<ShaderManifestProgram>::const_iterator i = programs.begin(), end = programs.end(); i != end; ++i) {
+            std::string vsFileSrc, gsFileSrc, fsFileSrc;
+            const bool hasGs = !i->m_gsFile.empty();
+            if(!ReadFile(shaderDir / i->m_vsFile, vsFileSrc) || !ReadFile(shaderDir / i->m_fsFile, fsFileSrc) \
+                    || (hasGs && !ReadFile(shaderDir / i->m_gsFile, gsFileSrc))) {
+                messageRef = std::string("Failed to read the shader files of ") + i->m_name;
+                return (false);
+            }
+
+            std::vector<ShaderDefineList> permutations;
+            GetShaderPermutations(i->m_options, permutations);
+            for(std::vector<ShaderDefineList>::const_iterator j = permutations.begin(), jEnd = permutations.end(); j != jEnd; ++j) {
+                ShaderManifestPermutation permutation;
+                permutation.m_name = GetShaderPermutationName(i->m_name, *j);
+                permutation.m_hasGs = hasGs;
+
+                std::string message;
+                if(!PreprocessShaderSource(vsFileSrc, shaderDir, *j, permutation.m_vsSrc, message) \
+                        || !PreprocessShaderSource(fsFileSrc, shaderDir, *j, permutation.m_fsSrc, message) \
+                        || (hasGs && !PreprocessShaderSource(gsFileSrc, shaderDir, *j, permutation.m_gsSrc, message))) {
+                    messageRef = std::string("Failed to preprocess ") + permutation.m_name + std::string(": ") + message;
+                    return (false);
+                }
+
+                if(j == permutations.begin() && permutation.m_name != i->m_name) {
+                    ShaderManifestPermutation defaultPermutation(permutation);
+                    defaultPermutation.m_name = i->m_name;
+                    permutationsRef.push_back(defaultPermutation);
+                }
+                permutationsRef.push_back(permutation);
+            }
+        }
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 ShaderArchiveWriter::AddString(const std::string &str, bool &addedRef)
+    {
+        const U64 hash = HashContents(str);
+        for(StringOffsetMap::const_iterator i = m_stringMap.lower_bound(hash), end = m_stringMap.upper_bound(hash); i != end; ++i) {
+            if(m_strings.size() - i->second > str.size() && memcmp(&m_strings[i->second], str.c_str(), str.size() + 1) == 0) {
+                addedRef = false;
+                return (i->second);
+            }
+        }
+
+        const U32 offset = U32(m_strings.size());
+        m_strings.insert(m_strings.end(), str.c_str(), str.c_str() + str.size() + 1);
+        m_stringMap.insert(std::make_pair(hash, offset));
+        addedRef = true;
+        return (offset);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ShaderArchiveWriter::AddProgram(const std::string &name, const char *vsSrc, const char *gsSrc, const char *fsSrc)
+    {
+        if(name.empty() || !vsSrc || !fsSrc) {
+            return (false);
+        }
+
+        const U64 hash = reinterpret_cast<U64>(HashedString::hash_name(name.c_str()));
+        for(std::vector<ProgramRecord>::const_iterator i = m_programs.begin(), end = m_programs.end(); i != end; ++i) {
+            if(i->m_hash == hash) {
+                return (false);
+            }
+        }
+
+        bool added = false;
+        ProgramRecord record;
+        record.m_hash = hash;
+        record.m_nameOffset = AddString(name, added);
+        record.m_vsOffset = AddString(vsSrc, added);
+        m_numberSourcesStored += added ? 1 : 0;
+        record.m_gsOffset = NO_SOURCE;
+        if(gsSrc) {
+            record.m_gsOffset = AddString(gsSrc, added);
+            m_numberSourcesStored += added ? 1 : 0;
+            ++m_numberSources;
+        }
+        record.m_fsOffset = AddString(fsSrc, added);
+        m_numberSourcesStored += added ? 1 : 0;
+        m_numberSources += 2;
+
+        m_programs.push_back(record);
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ShaderArchiveWriter::Encode(std::vector<U8> &outRef) const
+    {
+        // Sort the records by hash through a list of their indices.
+        std::vector< std::pair<U64, U32> > order;
+        for(U32 i = 0; i < m_programs.size(); ++i) {
+            order.push_back(std::make_pair(m_programs[i].m_hash, i));
+        }
+        std::sort(order.begin(), order.end());
+
+        outRef.resize(HEADER_SIZE + m_programs.size() * PROGRAM_RECORD_SIZE + m_strings.size());
+        U8 *outPtr = &outRef[0];
+        memcpy(outPtr, SHADER_ARCHIVE_MAGIC, 4);
+        WriteU32(outPtr + 4, SHADER_ARCHIVE_VERSION);
+        WriteU32(outPtr + 8, U32(m_programs.size()));
+        WriteU32(outPtr + 12, U32(m_strings.size()));
+        outPtr += HEADER_SIZE;
+
+        for(std::vector< std::pair<U64, U32> >::const_iterator i = order.begin(), end = order.end(); i != end; ++i, outPtr += PROGRAM_RECORD_SIZE) {
+            const ProgramRecord &recordRef = m_programs[i->second];
+            WriteU64(outPtr, recordRef.m_hash);
+            WriteU32(outPtr + 8, recordRef.m_nameOffset);
+            WriteU32(outPtr + 12, recordRef.m_vsOffset);
+            WriteU32(outPtr + 16, recordRef.m_gsOffset);
+            WriteU32(outPtr + 20, recordRef.m_fsOffset);
+        }
+
+        if(!m_strings.empty()) {
+            memcpy(outPtr, &m_strings[0], m_strings.size());
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ShaderArchive::Load(const U8 *dataPtr, const size_t length)
+    {
+        m_data.clear();
+        m_programs.clear();
+        if(dataPtr == NULL || length < HEADER_SIZE || memcmp(dataPtr, SHADER_ARCHIVE_MAGIC, 4) != 0 \
+                || ReadU32(dataPtr + 4) != SHADER_ARCHIVE_VERSION) {
+            return (false);
+        }
+
+        const U32 numberPrograms = ReadU32(dataPtr + 8);
+        const U32 stringsSize = ReadU32(dataPtr + 12);
+        const U64 stringsOffset = HEADER_SIZE + U64(numberPrograms) * PROGRAM_RECORD_SIZE;
+        if(stringsOffset + stringsSize != length || (stringsSize != 0 && dataPtr[length - 1] != '\0')) {
+            return (false);
+        }
+
+        m_data.assign(dataPtr, dataPtr + length);
+        const char *stringsPtr = reinterpret_cast<const char *>(&m_data[0] + stringsOffset);
+
+        m_programs.resize(numberPrograms);
+        const U8 *inPtr = &m_data[0] + HEADER_SIZE;
+        for(U32 i = 0; i < numberPrograms; ++i, inPtr += PROGRAM_RECORD_SIZE) {
+            ShaderArchiveProgram &programRef = m_programs[i];
+            programRef.m_hash = ReadU64(inPtr);
+            programRef.m_name = GetString(stringsPtr, stringsSize, ReadU32(inPtr + 8));
+            programRef.m_vsSrc = GetString(stringsPtr, stringsSize, ReadU32(inPtr + 12));
+            programRef.m_fsSrc = GetString(stringsPtr, stringsSize, ReadU32(inPtr + 20));
+            const U32 gsOffset = ReadU32(inPtr + 16);
+            programRef.m_gsSrc = (gsOffset == NO_SOURCE) ? NULL : GetString(stringsPtr, stringsSize, gsOffset);
+
+            if(!programRef.m_name || !programRef.m_vsSrc || !programRef.m_fsSrc || (gsOffset != NO_SOURCE && !programRef.m_gsSrc) \
+                    || (i != 0 && m_programs[i - 1].m_hash >= programRef.m_hash)) {
+                m_data.clear();
+                m_programs.clear();
+                return (false);
+            }
+        }
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    const ShaderArchiveProgram *ShaderArchive::Find(const std::string &name) const
+    {
+        ShaderArchiveProgram key;
+        key.m_hash = reinterpret_cast<U64>(HashedString::hash_name(name.c_str()));
+
+        std::vector<ShaderArchiveProgram>::const_iterator i = std::lower_bound(m_programs.begin(), m_programs.end(), key, ProgramLess);
+        if(i == m_programs.end() || i->m_hash != key.m_hash || name.compare(i->m_name) != 0) {
+            return (NULL);
+        }
+        return (&(*i));
+    }
+
+}
@@ -0,0 +1,313 @@
+#pragma once
+#ifndef __GF_SHADER_ARCHIVE_H
+#define __GF_SHADER_ARCHIVE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file ShaderArchive.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header for the packed shader archive (.gsa) written by the glslc
+// build tool, which holds the preprocessed source of every program
+// and its permutations so they are read with a single resource read.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "GameBase.h"
+
+namespace GameHalloran {
+
+    // A list of preprocessor defines as name and value pairs.
+    typedef std::vector< std::pair<std::string, std::string> > ShaderDefineList;
+    // A list of the defines a program is built with and the values each can take.
+    typedef std::vector< std::pair< std::string, std::vector<std::string> > > ShaderOptionList;
+
+    // File extension of shader archives.
+    extern const char * const SHADER_ARCHIVE_EXTENSION;
+
+    // /////////////////////////////////////////////////////////////////
+    // Preprocess shader source for the archive.
+    //
+    // Lines of the form #include "file" are replaced by the file, read
+    // from the include directory, and the files it includes in turn.
+    // The defines are then inserted after the #version line, which GLSL
+    // requires to come first.  Only defines whose name appears in the
+    // source are inserted, so a stage unaffected by a permutation keeps
+    // the same source and is stored once in the archive.
+    //
+    // @param src The shader source code.
+    // @param includeDir Directory of the included files.
+    // @param defines The defines of the permutation.
+    // @param outRef Output preprocessed source.
+    // @param messageRef Details of any error.
+    //
+    // @return bool False if an included file could not be read or the
+    //              includes nest too deeply (as an include cycle would).
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool PreprocessShaderSource(const std::string &src, const boost::filesystem::path &includeDir, const ShaderDefineList &defines, \
+                                std::string &outRef, std::string &messageRef);
+
+    // /////////////////////////////////////////////////////////////////
+    // Get the archive name of a permutation of a program, e.g.
+    // "shaders/ProgrammablePhongAds[GF_ADS_FOG=FOG_LINEAR,GF_ADS_LIGHTS=1]".
+    // A program without defines keeps its own name.
+    //
+    // /////////////////////////////////////////////////////////////////
+    std::string GetShaderPermutationName(const std::string &programName, const ShaderDefineList &defines);
+
+    // /////////////////////////////////////////////////////////////////
+    // Get every combination of the values of the options.  The first
+    // permutation takes the first value of each option, and is the
+    // default of the program.  Options without values are skipped.
+    //
+    // @param options The options of a program.
+    // @param permutationsRef Output defines of each permutation.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void GetShaderPermutations(const ShaderOptionList &options, std::vector<ShaderDefineList> &permutationsRef);
+
+    // /////////////////////////////////////////////////////////////////
+    // @struct ShaderManifestProgram
+    // @author PJ O Halloran
+    //
+    // A <Program> of a shader manifest.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct ShaderManifestProgram {
+        std::string m_name;                     ///< The program name, as given to BuildShaderFromResourceCache().
+        std::string m_vsFile;                   ///< The vertex shader file.
+        std::string m_gsFile;                   ///< The geometry shader file, empty if there is none.
+        std::string m_fsFile;                   ///< The fragment shader file.
+        ShaderOptionList m_options;             ///< The defines the program is built with.
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @struct ShaderManifestPermutation
+    // @author PJ O Halloran
+    //
+    // A permutation of a manifest program after preprocessing.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct ShaderManifestPermutation {
+        std::string m_name;                     ///< The permutation name.
+        std::string m_vsSrc;                    ///< The vertex shader source.
+        std::string m_gsSrc;                    ///< The geometry shader source.
+        std::string m_fsSrc;                    ///< The fragment shader source.
+        bool m_hasGs;                           ///< Is there a geometry shader?
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Read the programs of a shader manifest:
+    //
+    // <ShaderManifest>
+    //     <Program name="shaders/flat" vs="flat.vp" fs="flat.fp" [gs="flat.gp"]>
+    //         <Option name="GF_FOG" values="NONE LINEAR EXP" />
+    //     </Program>
+    // </ShaderManifest>
+    //
+    // @param manifestPath Path of the manifest.
+    // @param programsRef Output programs, in the order listed.
+    // @param messageRef Details of any error.
+    //
+    // @return bool False if the manifest could not be parsed or a
+    //              Program or Option is missing an attribute.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ReadShaderManifest(const boost::filesystem::path &manifestPath, std::vector<ShaderManifestProgram> &programsRef, std::string &messageRef);
+
+    // /////////////////////////////////////////////////////////////////
+    // Read and preprocess every permutation of the manifest's programs.
+    // The default permutation of a program with options is also added
+    // under the program's own name, costing only a record in the archive
+    // as its sources are shared.
+    //
+    // @param shaderDir Directory of the shader files and includes.
+    // @param programs The programs of the manifest.
+    // @param permutationsRef Output permutations.
+    // @param messageRef Details of any error.
+    //
+    // @return bool False if a shader file could not be read or
+    //              preprocessed.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool PreprocessShaderManifest(const boost::filesystem::path &shaderDir, const std::vector<ShaderManifestProgram> &programs, \
+                                  std::vector<ShaderManifestPermutation> &permutationsRef, std::string &messageRef);
+
+    // /////////////////////////////////////////////////////////////////
+    // @struct ShaderArchiveProgram
+    // @author PJ O Halloran
+    //
+    // A program in a shader archive.  The strings point into the archive
+    // data and are only valid while it is.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct ShaderArchiveProgram {
+        U64 m_hash;                             ///< HashedString hash of the name.
+        const char *m_name;                     ///< The name of the program.
+        const char *m_vsSrc;                    ///< The vertex shader source.
+        const char *m_gsSrc;                    ///< The geometry shader source, NULL if there is none.
+        const char *m_fsSrc;                    ///< The fragment shader source.
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @class ShaderArchiveWriter
+    // @author PJ O Halloran
+    //
+    // Collects programs and encodes them as an archive.  The names and
+    // sources are stored in one string table, and a string identical to
+    // one already in the table (found by its hash) is stored once.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class ShaderArchiveWriter {
+    private:
+
+        // A program as offsets into the string table.
+        struct ProgramRecord {
+            U64 m_hash;
+            U32 m_nameOffset;
+            U32 m_vsOffset;
+            U32 m_gsOffset;
+            U32 m_fsOffset;
+        };
+
+        typedef std::multimap<U64, U32> StringOffsetMap;
+
+        std::vector<ProgramRecord> m_programs;  ///< The programs added.
+        std::vector<char> m_strings;            ///< The string table.
+        StringOffsetMap m_stringMap;            ///< Hash of each string in the table to its offset.
+        U32 m_numberSources;                    ///< Stage sources added.
+        U32 m_numberSourcesStored;              ///< Stage sources stored in the table.
+
+        // /////////////////////////////////////////////////////////////////
+        // Add a string to the table, unless it is already there.
+        //
+        // @return U32 The offset of the string in the table.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U32 AddString(const std::string &str, bool &addedRef);
+
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        ShaderArchiveWriter() : m_programs(), m_strings(), m_stringMap(), m_numberSources(0), m_numberSourcesStored(0) {};
+
+        // /////////////////////////////////////////////////////////////////
+        // Add a program.
+        //
+        // @param name The program name (see GetShaderPermutationName()).
+        // @param vsSrc The vertex shader source.
+        // @param gsSrc The geometry shader source or NULL if there is none.
+        // @param fsSrc The fragment shader source.
+        //
+        // @return bool False if the name or its hash is already in the
+        //              archive, or a required source is NULL.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool AddProgram(const std::string &name, const char *vsSrc, const char *gsSrc, const char *fsSrc);
+
+        // /////////////////////////////////////////////////////////////////
+        // Encode the archive: a header, a record per program sorted by the
+        // hash of its name and the string table.  All the values are
+        // stored little endian.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void Encode(std::vector<U8> &outRef) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of programs added.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetNumberPrograms() const {
+            return (U32(m_programs.size()));
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of stage sources added.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetNumberSources() const {
+            return (m_numberSources);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of stage sources stored after removing those
+        // identical to another.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetNumberSourcesStored() const {
+            return (m_numberSourcesStored);
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @class ShaderArchive
+    // @author PJ O Halloran
+    //
+    // An archive loaded for use.  The archive data is copied once and
+    // the programs point into it, so programs are found with a binary
+    // search of the hash of their name.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class ShaderArchive {
+    private:
+
+        std::vector<U8> m_data;                 ///< The archive data.
+        std::vector<ShaderArchiveProgram> m_programs;   ///< The programs, sorted by hash.
+
+        // The programs point into the data, so archives are not copied.
+        ShaderArchive(const ShaderArchive &);
+        ShaderArchive &operator=(const ShaderArchive &);
+
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        ShaderArchive() : m_data(), m_programs() {};
+
+        // /////////////////////////////////////////////////////////////////
+        // Load the archive from its data, replacing any archive loaded.
+        //
+        // @param dataPtr The archive.
+        // @param length Size of the archive in bytes.
+        //
+        // @return bool False if the data is not a valid archive, in which
+        //              case the archive is left empty.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool Load(const U8 *dataPtr, const size_t length);
+
+        // /////////////////////////////////////////////////////////////////
+        // Find a program.
+        //
+        // @return const ShaderArchiveProgram* NULL if the program is not in
+        //                                      the archive.
+        //
+        // /////////////////////////////////////////////////////////////////
+        const ShaderArchiveProgram *Find(const std::string &name) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the programs in the archive, sorted by hash.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline const std::vector<ShaderArchiveProgram> &GetPrograms() const {
+            return (m_programs);
+        };
+    };
+
+}
+
+#endif
@@ -0,0 +1,494 @@
+// /////////////////////////////////////////////////////////////////
+// @file ShaderProgramCache.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Implementation of the persistent shader program cache.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <boost/algorithm/string.hpp>
+
+#include "ShaderProgramCache.h"
+
+namespace GameHalloran {
+
+    namespace {
+
+        const U8 PROGRAM_BINARY_MAGIC[4] = { 'G', 'F', 'P', 'B' };
+        const U32 PROGRAM_BINARY_VERSION = 1;
+        const char * const PROGRAM_BINARY_EXTENSION = ".gpb";
+
+        // /////////////////////////////////////////////////////////////////
+        // 64 bit FNV-1a, continued from a previous hash.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U64 HashBytes(U64 hash, const void *dataPtr, const size_t size)
+        {
+            const U8 *bytePtr = static_cast<const U8 *>(dataPtr);
+            for(size_t i = 0; i < size; ++i) {
+                hash = (hash ^ bytePtr[i]) * 1099511628211ULL;
+            }
+            return (hash);
+        }
+
+        const U64 HASH_SEED = 14695981039346656037ULL;
+
+        // /////////////////////////////////////////////////////////////////
+        // Hash a string and its terminator, so the boundaries of strings
+        // hashed in turn change the hash.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U64 HashString(const U64 hash, const char *str)
+        {
+            return (HashBytes(hash, str, strlen(str) + 1));
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Little endian writers for the cache entries.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void AppendU32(std::vector<U8> &outRef, const U32 value)
+        {
+            for(U32 i = 0; i < 4; ++i) {
+                outRef.push_back(U8((value >> (i * 8)) & 0xFF));
+            }
+        }
+
+        void AppendBytes(std::vector<U8> &outRef, const void *dataPtr, const size_t size)
+        {
+            const U8 *bytePtr = static_cast<const U8 *>(dataPtr);
+            outRef.insert(outRef.end(), bytePtr, bytePtr + size);
+        }
+
+        void AppendString(std::vector<U8> &outRef, const std::string &str)
+        {
+            AppendU32(outRef, U32(str.size()));
+            AppendBytes(outRef, str.data(), str.size());
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // @class EntryReader
+        //
+        // Reads the values of a cache entry, failing rather than reading
+        // past its end.
+        //
+        // /////////////////////////////////////////////////////////////////
+        class EntryReader {
+        private:
+
+            const U8 *m_ptr;                    ///< The next byte to read.
+            size_t m_remaining;                 ///< Bytes left to read.
+
+        public:
+
+            EntryReader(const U8 *dataPtr, const size_t length) : m_ptr(dataPtr), m_remaining(length) {};
+
+            bool ReadBytes(void *outPtr, const size_t size) {
+                if(size > m_remaining) {
+                    return (false);
+                }
+                if(size > 0) {
+                    memcpy(outPtr, m_ptr, size);
+                }
+                m_ptr += size;
+                m_remaining -= size;
+                return (true);
+            };
+
+            bool ReadU32(U32 &valueRef) {
+                U8 bytes[4];
+                if(!ReadBytes(bytes, 4)) {
+                    return (false);
+                }
+                valueRef = U32(bytes[0]) | (U32(bytes[1]) << 8) | (U32(bytes[2]) << 16) | (U32(bytes[3]) << 24);
+                return (true);
+            };
+
+            bool ReadString(std::string &strRef) {
+                U32 size(0);
+                if(!ReadU32(size) || size > m_remaining) {
+                    return (false);
+                }
+                strRef.assign(reinterpret_cast<const char *>(m_ptr), size);
+                m_ptr += size;
+                m_remaining -= size;
+                return (true);
+            };
+
+            bool IsAtEnd() const {
+                return (m_remaining == 0);
+            };
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // If the statement declares a uniform block, add it to the table.
+        //
+        // @return bool True if the statement declares a uniform block.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool ParseUniformBlock(const std::string &statement, ShaderUniformTable &tableRef)
+        {
+            const std::string UNIFORM_KEYWORD_STR("uniform");
+            const std::string LAYOUT_KEYWORD_STR("layout");
+            std::vector<std::string> sections;
+
+            // A block is named by the word after the uniform keyword and is the last word of the statement.
+            boost::algorithm::split(sections, statement, boost::algorithm::is_any_of(" \t\r{"), boost::algorithm::token_compress_on);
+            sections.erase(std::remove(sections.begin(), sections.end(), std::string()), sections.end());
+            std::vector<std::string>::const_iterator uniformIter = std::find(sections.begin(), sections.end(), UNIFORM_KEYWORD_STR);
+            if(uniformIter == sections.end() || (uniformIter + 2) != sections.end()) {
+                return (false);
+            }
+            if(uniformIter != sections.begin() && !boost::algorithm::starts_with(sections.front(), LAYOUT_KEYWORD_STR)) {
+                return (false);
+            }
+
+            const std::string &blockName = *(uniformIter + 1);
+            for(ShaderUniformTable::BlockList::const_iterator i = tableRef.m_blocks.begin(), end = tableRef.m_blocks.end(); i != end; ++i) {
+                if((*i).first == blockName) {
+                    return (true);
+                }
+            }
+            tableRef.m_blocks.push_back(std::make_pair(blockName, GLuint(GL_INVALID_INDEX)));
+
+            return (true);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Add a uniform to the table if not already there.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void AddUniform(const std::string &name, ShaderUniformTable &tableRef)
+        {
+            for(ShaderUniformTable::UniformList::const_iterator i = tableRef.m_uniforms.begin(), end = tableRef.m_uniforms.end(); i != end; ++i) {
+                if((*i).first == name) {
+                    return;
+                }
+            }
+            tableRef.m_uniforms.push_back(std::make_pair(name, GLint(-1)));
+        }
+
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ParseShaderUniforms(const char *src, ShaderUniformTable &tableRef)
+    {
+        if(!src) {
+            return (false);
+        }
+
+        const std::string SEMICOLON_STR(";");
+        const std::string WHITESPACE_STR(" ");
+        const std::string ARRAY_LEFT_BRACKET_STR("[");
+        const std::string UNIFORM_KEYWORD_STR("uniform");
+        std::vector<std::string> statements, uniformSections, arraySections;
+        std::istringstream inputStream(src);
+        std::string line;
+
+        // Iterate through each line in the source looking for uniform declarations.
+        while(std::getline(inputStream, line)) {
+            // A line might have many GLSL statements...
+            boost::algorithm::split(statements, line, boost::algorithm::is_any_of(SEMICOLON_STR));
+
+            // Parse through all statements in the current line.
+            for(std::vector<std::string>::const_iterator stateIter = statements.begin(), stateEnd = statements.end(); stateIter != stateEnd; ++stateIter) {
+                // Uniform blocks are fed from uniform buffers rather than by location.
+                if(ParseUniformBlock(*stateIter, tableRef)) {
+                    continue;
+                }
+
+                // Only consider lines beginning with the uniform keyword.
+                if(boost::algorithm::starts_with(*stateIter, UNIFORM_KEYWORD_STR)) {
+                    boost::algorithm::split(uniformSections, *stateIter, boost::algorithm::is_any_of(WHITESPACE_STR));
+                    if(uniformSections.size() != 3) {
+                        return (false);
+                    }
+
+                    // Handle variable names that are arrays
+                    boost::algorithm::split(arraySections, uniformSections[2], boost::algorithm::is_any_of(ARRAY_LEFT_BRACKET_STR));
+                    AddUniform((arraySections.size() == 2) ? arraySections[0] : uniformSections[2], tableRef);
+                }
+            }
+        }
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    U64 HashShaderProgramSource(const char *vsSrc, const char *gsSrc, const char *fsSrc, const std::vector<std::string> &vsAttList)
+    {
+        const U8 hasGs = gsSrc ? 1 : 0;
+        U64 hash = HASH_SEED;
+
+        hash = HashString(hash, vsSrc ? vsSrc : "");
+        hash = HashBytes(hash, &hasGs, 1);
+        hash = HashString(hash, gsSrc ? gsSrc : "");
+        hash = HashString(hash, fsSrc ? fsSrc : "");
+        for(std::vector<std::string>::const_iterator i = vsAttList.begin(), end = vsAttList.end(); i != end; ++i) {
+            hash = HashString(hash, (*i).c_str());
+        }
+
+        return (hash);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void EncodeShaderProgramBinary(const ShaderProgramBinary &binaryRef, std::vector<U8> &outRef)
+    {
+        const ShaderUniformTable &table = binaryRef.m_uniformTable;
+        U32 buildSecondsBits(0);
+        memcpy(&buildSecondsBits, &binaryRef.m_buildSeconds, 4);
+
+        outRef.clear();
+        AppendBytes(outRef, PROGRAM_BINARY_MAGIC, 4);
+        AppendU32(outRef, PROGRAM_BINARY_VERSION);
+        AppendU32(outRef, U32(binaryRef.m_sourceHash & 0xFFFFFFFF));
+        AppendU32(outRef, U32(binaryRef.m_sourceHash >> 32));
+        AppendString(outRef, binaryRef.m_driverStr);
+        AppendU32(outRef, U32(binaryRef.m_format));
+        AppendU32(outRef, buildSecondsBits);
+        AppendU32(outRef, U32(binaryRef.m_binary.size()));
+        if(!binaryRef.m_binary.empty()) {
+            AppendBytes(outRef, &binaryRef.m_binary[0], binaryRef.m_binary.size());
+        }
+
+        AppendU32(outRef, U32(table.m_uniforms.size()));
+        for(ShaderUniformTable::UniformList::const_iterator i = table.m_uniforms.begin(), end = table.m_uniforms.end(); i != end; ++i) {
+            AppendString(outRef, (*i).first);
+            AppendU32(outRef, U32((*i).second));
+        }
+        AppendU32(outRef, U32(table.m_blocks.size()));
+        for(ShaderUniformTable::BlockList::const_iterator i = table.m_blocks.begin(), end = table.m_blocks.end(); i != end; ++i) {
+            AppendString(outRef, (*i).first);
+            AppendU32(outRef, U32((*i).second));
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool DecodeShaderProgramBinary(const U8 *dataPtr, const size_t length, ShaderProgramBinary &binaryRef)
+    {
+        if(!dataPtr) {
+            return (false);
+        }
+
+        EntryReader reader(dataPtr, length);
+        U8 magic[4];
+        U32 version(0), hashLow(0), hashHigh(0), format(0), buildSecondsBits(0), size(0);
+        if(!reader.ReadBytes(magic, 4) || memcmp(magic, PROGRAM_BINARY_MAGIC, 4) != 0) {
+            return (false);
+        }
+        if(!reader.ReadU32(version) || version != PROGRAM_BINARY_VERSION) {
+            return (false);
+        }
+        if(!reader.ReadU32(hashLow) || !reader.ReadU32(hashHigh) || !reader.ReadString(binaryRef.m_driverStr) \
+                || !reader.ReadU32(format) || !reader.ReadU32(buildSecondsBits) || !reader.ReadU32(size) || size == 0) {
+            return (false);
+        }
+        binaryRef.m_sourceHash = U64(hashLow) | (U64(hashHigh) << 32);
+        binaryRef.m_format = GLenum(format);
+        memcpy(&binaryRef.m_buildSeconds, &buildSecondsBits, 4);
+        binaryRef.m_binary.resize(size);
+        if(!reader.ReadBytes(&binaryRef.m_binary[0], size)) {
+            return (false);
+        }
+
+        ShaderUniformTable &table = binaryRef.m_uniformTable;
+        table.m_uniforms.clear();
+        table.m_blocks.clear();
+        U32 number(0), value(0);
+        std::string name;
+        if(!reader.ReadU32(number)) {
+            return (false);
+        }
+        for(U32 i = 0; i < number; ++i) {
+            if(!reader.ReadString(name) || !reader.ReadU32(value)) {
+                return (false);
+            }
+            table.m_uniforms.push_back(std::make_pair(name, GLint(value)));
+        }
+        if(!reader.ReadU32(number)) {
+            return (false);
+        }
+        for(U32 i = 0; i < number; ++i) {
+            if(!reader.ReadString(name) || !reader.ReadU32(value)) {
+                return (false);
+            }
+            table.m_blocks.push_back(std::make_pair(name, GLuint(value)));
+        }
+
+        return (reader.IsAtEnd());
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    ShaderProgramCache::ShaderProgramCache(const boost::filesystem::path &dir, const std::string &driverStr)
+        : m_dir(dir)
+        , m_driverStr(driverStr)
+        , m_stats()
+    {
+        boost::system::error_code error;
+        if(!boost::filesystem::is_directory(m_dir, error)) {
+            boost::filesystem::create_directories(m_dir, error);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ShaderProgramCache::IsValid() const
+    {
+        boost::system::error_code error;
+        return (boost::filesystem::is_directory(m_dir, error));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    boost::filesystem::path ShaderProgramCache::GetEntryPath(const U64 sourceHash) const
+    {
+        U8 hashBytes[8];
+        for(U32 i = 0; i < 8; ++i) {
+            hashBytes[i] = U8((sourceHash >> (i * 8)) & 0xFF);
+        }
+        const U64 key = HashString(HashBytes(HASH_SEED, hashBytes, 8), m_driverStr.c_str());
+
+        std::ostringstream filename;
+        filename << std::hex << std::setw(16) << std::setfill('0') << key << PROGRAM_BINARY_EXTENSION;
+        return (m_dir / filename.str());
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ShaderProgramCache::Load(const U64 sourceHash, ShaderProgramBinary &binaryRef)
+    {
+        const boost::filesystem::path entryPath(GetEntryPath(sourceHash));
+        std::ifstream in(entryPath.string().c_str(), std::ios::in | std::ios::binary);
+        if(!in.is_open()) {
+            return (false);
+        }
+
+        std::vector<U8> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        if(data.empty() || !DecodeShaderProgramBinary(&data[0], data.size(), binaryRef) \
+                || binaryRef.m_sourceHash != sourceHash || binaryRef.m_driverStr != m_driverStr) {
+            RecordRejected();
+            return (false);
+        }
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ShaderProgramCache::Store(ShaderProgramBinary &binaryRef)
+    {
+        binaryRef.m_driverStr = m_driverStr;
+        std::vector<U8> data;
+        EncodeShaderProgramBinary(binaryRef, data);
+
+        // Write to a temporary file first so a failed write never leaves a truncated entry.
+        const boost::filesystem::path entryPath(GetEntryPath(binaryRef.m_sourceHash));
+        boost::filesystem::path tmpPath(entryPath);
+        tmpPath.replace_extension(".tmp");
+        {
+            std::ofstream out(tmpPath.string().c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+            if(!out.is_open() || !out.write(reinterpret_cast<const char *>(&data[0]), std::streamsize(data.size()))) {
+                return (false);
+            }
+        }
+
+        boost::system::error_code error;
+        boost::filesystem::rename(tmpPath, entryPath, error);
+        if(error) {
+            boost::filesystem::remove(tmpPath, error);
+            return (false);
+        }
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ShaderProgramCache::RecordHit(const F64 seconds, const F64 buildSeconds)
+    {
+        ++m_stats.m_hits;
+        m_stats.m_hitSeconds += seconds;
+        m_stats.m_savedSeconds += buildSeconds - seconds;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void ShaderProgramCache::RecordMiss(const F64 seconds)
+    {
+        ++m_stats.m_misses;
+        m_stats.m_missSeconds += seconds;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    std::string ShaderProgramCache::GetStatsReport() const
+    {
+        std::ostringstream report;
+        report << std::fixed << std::setprecision(1);
+        report << "Shader programs: " << m_stats.m_hits << " loaded from the cache in " << (m_stats.m_hitSeconds * 1000.0) \
+               << " ms, saving " << (m_stats.m_savedSeconds * 1000.0) << " ms; " << m_stats.m_misses << " built from source in " \
+               << (m_stats.m_missSeconds * 1000.0) << " ms; " << m_stats.m_rejected << " cache entries rejected";
+        return (report.str());
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    std::string ShaderProgramCache::GetDriverString()
+    {
+        const GLenum NAMES[] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+        std::string driverStr;
+
+        for(U32 i = 0; i < sizeof(NAMES) / sizeof(NAMES[0]); ++i) {
+            const GLubyte *valuePtr = glGetString(NAMES[i]);
+            if(i > 0) {
+                driverStr.append(" | ");
+            }
+            if(valuePtr) {
+                driverStr.append(reinterpret_cast<const char *>(valuePtr));
+            }
+        }
+
+        return (driverStr);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ShaderProgramCache::IsSupported()
+    {
+        GLint numberFormats(0);
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numberFormats);
+
+        // Contexts without program binaries do not know the query, so clear the error it raises.
+        while(glGetError() != GL_NO_ERROR) {
+        }
+
+        return (numberFormats > 0);
+    }
+
+}
@@ -0,0 +1,252 @@
+#pragma once
+#ifndef __GF_SHADER_PROGRAM_CACHE_H
+#define __GF_SHADER_PROGRAM_CACHE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file ShaderProgramCache.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header for the persistent shader program cache, which keeps the
+// linked binaries of GLSL programs and their uniform tables on disk
+// so later runs can skip compiling, linking and parsing the source.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "GameBase.h"
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    // @struct ShaderUniformTable
+    // @author PJ O Halloran
+    //
+    // The uniforms and uniform blocks declared by the stages of a
+    // program, in declaration order without duplicates, and their
+    // locations and indices in the linked program.  Parsing the source
+    // leaves the locations at -1 and the indices at GL_INVALID_INDEX.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct ShaderUniformTable {
+        typedef std::vector< std::pair<std::string, GLint> > UniformList;
+        typedef std::vector< std::pair<std::string, GLuint> > BlockList;
+
+        UniformList m_uniforms;                 ///< Uniform names and locations.
+        BlockList m_blocks;                     ///< Uniform block names and indices.
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @struct ShaderProgramBinary
+    // @author PJ O Halloran
+    //
+    // An entry of the program cache.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct ShaderProgramBinary {
+        U64 m_sourceHash;                       ///< HashShaderProgramSource() of the program.
+        std::string m_driverStr;                ///< The driver that linked the program.
+        GLenum m_format;                        ///< The format from glGetProgramBinary().
+        std::vector<U8> m_binary;               ///< The program binary.
+        F32 m_buildSeconds;                     ///< Seconds taken to build the program from source.
+        ShaderUniformTable m_uniformTable;      ///< The uniforms of the program.
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        ShaderProgramBinary() : m_sourceHash(0), m_driverStr(), m_format(0), m_binary(), m_buildSeconds(0.0f), m_uniformTable() {};
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @struct ShaderProgramCacheStats
+    // @author PJ O Halloran
+    //
+    // Counts and times of the programs built with the cache.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct ShaderProgramCacheStats {
+        U32 m_hits;                             ///< Programs loaded from their binaries.
+        U32 m_misses;                           ///< Programs built from source.
+        U32 m_rejected;                         ///< Cached binaries which were stale, corrupt or refused by the driver.
+        F64 m_hitSeconds;                       ///< Time spent loading programs from their binaries.
+        F64 m_missSeconds;                      ///< Time spent building programs from source.
+        F64 m_savedSeconds;                     ///< Source build time of the programs loaded, less the time loading them.
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        ShaderProgramCacheStats() : m_hits(0), m_misses(0), m_rejected(0), m_hitSeconds(0.0), m_missSeconds(0.0), m_savedSeconds(0.0) {};
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Parse shader source for the uniforms and uniform blocks it
+    // declares, adding those not yet in the table.
+    //
+    // Only statements starting "uniform <type> <name>" are uniforms,
+    // and "uniform <Name> {" or "layout(...) uniform <Name> {" are
+    // blocks, as written by the framework's shaders.
+    //
+    // @param src The shader source code.
+    // @param tableRef The table to add to.
+    //
+    // @return bool False if a uniform declaration could not be parsed.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ParseShaderUniforms(const char *src, ShaderUniformTable &tableRef);
+
+    // /////////////////////////////////////////////////////////////////
+    // Hash everything a program is built from: the source of its stages
+    // and its vertex attribute names.
+    //
+    // @param gsSrc The geometry shader source or NULL if there is none.
+    //
+    // /////////////////////////////////////////////////////////////////
+    U64 HashShaderProgramSource(const char *vsSrc, const char *gsSrc, const char *fsSrc, const std::vector<std::string> &vsAttList);
+
+    // /////////////////////////////////////////////////////////////////
+    // Convert a cache entry to the cache file format.  All values are
+    // stored little endian.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void EncodeShaderProgramBinary(const ShaderProgramBinary &binaryRef, std::vector<U8> &outRef);
+
+    // /////////////////////////////////////////////////////////////////
+    // Read a cache file.
+    //
+    // @return bool False if the data is not a valid cache entry.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool DecodeShaderProgramBinary(const U8 *dataPtr, const size_t length, ShaderProgramBinary &binaryRef);
+
+    // /////////////////////////////////////////////////////////////////
+    // @class ShaderProgramCache
+    // @author PJ O Halloran
+    //
+    // A directory of program binaries.  Entries are keyed by the hash of
+    // the program source and the driver string, as binaries are only
+    // valid for the driver which linked them; both are stored in the
+    // entry and checked again when it is loaded.  GLSLShader looks a
+    // program up before compiling it and stores it after a successful
+    // build from source.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class ShaderProgramCache {
+    private:
+
+        boost::filesystem::path m_dir;          ///< The cache directory.
+        std::string m_driverStr;                ///< The current driver.
+        ShaderProgramCacheStats m_stats;        ///< Counts and times of the programs built.
+
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // @param dir The cache directory, created if it does not exist.
+        // @param driverStr The string identifying the current driver (see
+        //                  GetDriverString()).
+        //
+        // /////////////////////////////////////////////////////////////////
+        ShaderProgramCache(const boost::filesystem::path &dir, const std::string &driverStr);
+
+        // /////////////////////////////////////////////////////////////////
+        // Is the cache directory usable?
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool IsValid() const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the current driver string.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline const std::string &GetDriver() const {
+            return (m_driverStr);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the file of the entry for a program.
+        //
+        // /////////////////////////////////////////////////////////////////
+        boost::filesystem::path GetEntryPath(const U64 sourceHash) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Load the entry for a program.
+        //
+        // @return bool False if there is no entry for the program and the
+        //              current driver.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool Load(const U64 sourceHash, ShaderProgramBinary &binaryRef);
+
+        // /////////////////////////////////////////////////////////////////
+        // Store an entry, replacing any entry for the same program.  The
+        // driver string of the entry is set to the current driver.
+        //
+        // @return bool False if the entry could not be written.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool Store(ShaderProgramBinary &binaryRef);
+
+        // /////////////////////////////////////////////////////////////////
+        // Record a program loaded from its entry.
+        //
+        // @param seconds Time taken to load the program.
+        // @param buildSeconds Time the program took to build from source.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void RecordHit(const F64 seconds, const F64 buildSeconds);
+
+        // /////////////////////////////////////////////////////////////////
+        // Record a program built from source.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void RecordMiss(const F64 seconds);
+
+        // /////////////////////////////////////////////////////////////////
+        // Record an entry which could not be used.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline void RecordRejected() {
+            ++m_stats.m_rejected;
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the counts and times of the programs built.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline const ShaderProgramCacheStats &GetStats() const {
+            return (m_stats);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Describe the stats for the log.
+        //
+        // /////////////////////////////////////////////////////////////////
+        std::string GetStatsReport() const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the string identifying the driver of the current context:
+        // the vendor, renderer and version strings.
+        //
+        // /////////////////////////////////////////////////////////////////
+        static std::string GetDriverString();
+
+        // /////////////////////////////////////////////////////////////////
+        // Can the current context save and load program binaries (OpenGL
+        // 4.1 or ARB_get_program_binary with at least one format)?
+        //
+        // /////////////////////////////////////////////////////////////////
+        static bool IsSupported();
+    };
+
+}
+
+#endif
@@ -44,6 +44,7 @@ namespace GameHalloran {
         VSAttributeNameList attList;
         attList.push_back(std::string("vertexPos"));
         std::string errorMsg;
+        m_shaderProg.SetProgramCache(g_appPtr->GetShaderProgramCachePtr());
         if(!m_shaderProg.Build(vpSrcH->GetTextBuffer(), fpSrcH->GetTextBuffer(), attList, errorMsg)) {
             GF_LOG_TRACE_ERR("SnowParticleSystem::PrepareShader()", std::string("Failed to build the SnowPointShader: ") + errorMsg);
             return;
@@ -7,17 +7,47 @@
 //
 // /////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <string>
 
+#include <boost/scoped_ptr.hpp>
+
 #include "tinyxml/tinyxml.h"
 
 #include "TextureAtlas.h"
 #include "GameMain.h"
 #include "ImageResource.h"
+#include "ImageProcessing.h"
 #include "TextResource.h"
 
 namespace GameHalloran {
 
+    namespace {
+
+        // /////////////////////////////////////////////////////////////////
+        // Compare an atlas image's ID hash with a hash.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool AtlasImageHashLess(const AtlasImage &imageRef, const U64 hash)
+        {
+            return (imageRef.m_id.getHashValue() < hash);
+        }
+
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    const AtlasImage *TextureAtlas::FindImage(const U64 hash) const
+    {
+        AtlasImageVector::const_iterator imageIter = std::lower_bound(m_images.begin(), m_images.end(), hash, AtlasImageHashLess);
+        if(imageIter == m_images.end() || imageIter->m_id.getHashValue() != hash) {
+            return (NULL);
+        }
+
+        return (&*imageIter);
+    }
+
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
@@ -43,55 +73,74 @@ namespace GameHalloran {
     {
         assert(atlasNodePtr != NULL && strcmp(atlasNodePtr->Value(), "Atlas") == 0);
 
-        TextureAtlasSPtr atlas(new TextureAtlas(atlasNodePtr->Attribute("name")));
-        std::string mode(atlasNodePtr->Attribute("mode"));
-        std::string type(atlasNodePtr->Attribute("type"));
-        atlasNodePtr->Attribute("border", (int *)&atlas->m_borderSize);
-        atlasNodePtr->Attribute("width", (int *)&atlas->m_width);
-        atlasNodePtr->Attribute("height", (int *)&atlas->m_height);
-        atlas->m_type = GameHalloran::FindImageTypeFromFile(type);
-        atlas->m_mode = FindImageModeFromString(mode);
-
-        // Load atlas image from location using TextureManager.
-        if(m_loadingFromFilesystem) {
-            assert(false);
-        } else {
-            boost::optional<TexHandle> handle = g_appPtr->GetTextureManagerPtr()->Load2D(std::string("atlases") + ZipFile::ZIP_PATH_SEPERATOR + atlas->m_id.getStr() + std::string(".") + type);
-            if(!handle) {
-                return (false);
-            }
+        std::vector<U8> dictionary;
+        if(!EncodeAtlasDictionary(std::vector<const TiXmlElement *>(1, atlasNodePtr), dictionary)) {
+            return (false);
+        }
 
-            atlas->m_atlasId = *handle;
+        return (ParseDictionary(&dictionary[0], dictionary.size()));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool TextureAtlasManager::ParseDictionary(const U8 *dataPtr, const size_t length)
+    {
+        std::vector<AtlasDictionaryAtlas> atlases;
+        std::vector<AtlasDictionaryImage> images;
+        if(!ParseAtlasDictionary(dataPtr, length, atlases, images)) {
+            return (false);
         }
 
-        m_atlasMap[atlas->m_id.getHashValue()] = atlas;
+        for(std::vector<AtlasDictionaryAtlas>::const_iterator i = atlases.begin(), end = atlases.end(); i != end; ++i) {
+            TextureAtlasSPtr atlas(CreateAtlas(*i, images));
 
-        for(TiXmlElement *currChildPtr = atlasNodePtr->FirstChildElement(); currChildPtr; currChildPtr = currChildPtr->NextSiblingElement()) {
-            if(currChildPtr && !currChildPtr->ToComment() && strcmp(currChildPtr->Value(), "Image") == 0) {
-                double tmp(0.0);
-
-                AtlasImageSPtr image(new AtlasImage(currChildPtr->Attribute("name")));
-
-                currChildPtr->Attribute("x", &tmp);
-                image->m_x = (float)tmp / atlas->m_width;
-                currChildPtr->Attribute("y", &tmp);
-                image->m_y = (float)tmp / atlas->m_height;
-                image->m_y = 1.0f - image->m_y;
-                currChildPtr->Attribute("width", &tmp);
-                image->m_width = (float)tmp / atlas->m_width;
-                currChildPtr->Attribute("height", &tmp);
-                image->m_height = (float)tmp / atlas->m_height;
-                if(strcmp("True", currChildPtr->Attribute("flipped")) == 0) {
-                    image->m_flipped = true;
+            // Load atlas image from location using TextureManager.
+            if(m_loadingFromFilesystem) {
+                assert(false);
+            } else {
+                boost::optional<TexHandle> handle = g_appPtr->GetTextureManagerPtr()->Load2D(std::string("atlases") + ZipFile::ZIP_PATH_SEPERATOR + atlas->m_id.getStr() + std::string(".") + i->m_type);
+                if(!handle) {
+                    return (false);
                 }
 
-                atlas->m_images[image->m_id.getHashValue()] = image;
+                atlas->m_atlasId = *handle;
             }
+
+            m_atlasMap[atlas->m_id.getHashValue()] = atlas;
         }
 
         return (true);
     }
 
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    TextureAtlasSPtr TextureAtlasManager::CreateAtlas(const AtlasDictionaryAtlas &atlasRef, const std::vector<AtlasDictionaryImage> &imagesRef) const
+    {
+        TextureAtlasSPtr atlas(new TextureAtlas(atlasRef.m_name));
+        atlas->m_borderSize = atlasRef.m_border;
+        atlas->m_width = atlasRef.m_width;
+        atlas->m_height = atlasRef.m_height;
+        atlas->m_type = GameHalloran::FindImageTypeFromFile(atlasRef.m_type);
+        atlas->m_mode = FindImageModeFromString(atlasRef.m_mode);
+
+        // The dictionary holds the images sorted by hash, as FindImage() expects.
+        atlas->m_images.reserve(atlasRef.m_numberImages);
+        for(U32 i = atlasRef.m_firstImage; i < atlasRef.m_firstImage + atlasRef.m_numberImages; ++i) {
+            atlas->m_images.push_back(AtlasImage(imagesRef[i].m_name));
+            AtlasImage &imageRef = atlas->m_images.back();
+            assert(imageRef.m_id.getHashValue() == imagesRef[i].m_hash);
+            imageRef.m_x = imagesRef[i].m_x;
+            imageRef.m_y = imagesRef[i].m_y;
+            imageRef.m_width = imagesRef[i].m_width;
+            imageRef.m_height = imagesRef[i].m_height;
+            imageRef.m_flipped = imagesRef[i].m_flipped;
+        }
+
+        return (atlas);
+    }
+
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
@@ -165,6 +214,22 @@ namespace GameHalloran {
     {
         m_loadingFromFilesystem = false;
 
+        ResourceListing dictionaryList;
+        if(g_appPtr->GetResourceCache()->GetResourceListing(std::string("atlases/[a-zA-Z0-9]*\\.") + ATLAS_DICTIONARY_EXTENSION, dictionaryList) && !dictionaryList.empty()) {
+            for(ResourceListing::const_iterator i = dictionaryList.begin(), end = dictionaryList.end(); i != end; ++i) {
+                Resource dictionaryRes(i->string());
+                boost::shared_ptr<ResHandle> dictionaryHandle = g_appPtr->GetResourceCache()->GetHandle(&dictionaryRes);
+                if(!dictionaryHandle || !ParseDictionary(reinterpret_cast<const U8 *>(dictionaryHandle->Buffer()), dictionaryHandle->Size())) {
+                    GF_LOG_TRACE_ERR("TextureAtlasManager::LoadFromResourceCache()", std::string("Failed to load the atlas dictionary ") + dictionaryRes.GetName());
+                    m_loaded = false;
+                    return false;
+                }
+            }
+
+            m_loaded = true;
+            return true;
+        }
+
         ResourceListing fileList;
         //if(!g_appPtr->GetResourceCache()->GetResourceListing("atlases" + ZipFile::ZIP_PATH_SEPERATOR + "*.xml", fileList)) {
         if(!g_appPtr->GetResourceCache()->GetResourceListing("atlases/[a-zA-Z0-9]*.xml", fileList)) {
@@ -211,6 +276,68 @@ namespace GameHalloran {
         return true;
     }
 
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool TextureAtlasManager::BuildAtlas(const std::string &atlasId, const std::vector<std::string> &imageNamesRef, const AtlasPackerOptions &optionsRef)
+    {
+        HashedString id(atlasId.c_str());
+        if(imageNamesRef.empty() || m_atlasMap.find(id.getHashValue()) != m_atlasMap.end()) {
+            GF_LOG_TRACE_ERR("TextureAtlasManager::BuildAtlas()", std::string("No images or the atlas already exists: ") + atlasId);
+            return (false);
+        }
+
+        // Every parsed image holds its rows bottom up, as the atlas does.
+        AtlasPacker packer(optionsRef);
+        std::vector< std::vector<U8> > imagesVec(imageNamesRef.size());
+        for(size_t i = 0; i < imageNamesRef.size(); ++i) {
+            ImageResource imgRes(imageNamesRef[i]);
+            boost::shared_ptr<ImageResHandle> imgResHandle = boost::static_pointer_cast<ImageResHandle>(g_appPtr->GetResourceCache()->GetHandle(&imgRes));
+            if(!imgResHandle || !imgResHandle->VInitialize() || !ConvertImageToRgba(*imgResHandle, imagesVec[i])) {
+                GF_LOG_TRACE_ERR("TextureAtlasManager::BuildAtlas()", std::string("Failed to retrieve and/or convert the image ") + imageNamesRef[i]);
+                return (false);
+            }
+
+            const std::string::size_type sepPos = imageNamesRef[i].find_last_of("/\\");
+            packer.AddImage((sepPos == std::string::npos) ? imageNamesRef[i] : imageNamesRef[i].substr(sepPos + 1), \
+                            U32(imgResHandle->GetImageWidth()), U32(imgResHandle->GetImageHeight()));
+        }
+
+        if(!packer.Pack()) {
+            GF_LOG_TRACE_ERR("TextureAtlasManager::BuildAtlas()", std::string("The images do not fit in a single atlas: ") + atlasId);
+            return (false);
+        }
+
+        std::vector<U8> atlasVec(packer.GetWidth() * packer.GetHeight() * 4, 0);
+        for(U32 i = 0; i < packer.GetNumberImages(); ++i) {
+            packer.CopyImage(i, &imagesVec[i][0], &atlasVec[0]);
+        }
+
+        const std::string type("tga");
+        boost::scoped_ptr<TiXmlElement> atlasElemPtr(packer.CreateXmlElement(atlasId, "RGBA", type));
+        std::vector<U8> dictionary;
+        std::vector<AtlasDictionaryAtlas> atlases;
+        std::vector<AtlasDictionaryImage> images;
+        if(!EncodeAtlasDictionary(std::vector<const TiXmlElement *>(1, atlasElemPtr.get()), dictionary) \
+                || !ParseAtlasDictionary(&dictionary[0], dictionary.size(), atlases, images)) {
+            GF_LOG_TRACE_ERR("TextureAtlasManager::BuildAtlas()", std::string("Failed to describe the atlas: ") + atlasId);
+            return (false);
+        }
+
+        boost::optional<TexHandle> handle = g_appPtr->GetTextureManagerPtr()->LoadRgba2D(std::string("atlases") + ZipFile::ZIP_PATH_SEPERATOR + atlasId + std::string(".") + type, \
+                                                                                          &atlasVec[0], packer.GetWidth(), packer.GetHeight());
+        if(!handle) {
+            GF_LOG_TRACE_ERR("TextureAtlasManager::BuildAtlas()", std::string("Failed to load the atlas texture: ") + atlasId);
+            return (false);
+        }
+
+        TextureAtlasSPtr atlas(CreateAtlas(atlases.front(), images));
+        atlas->m_atlasId = *handle;
+        m_atlasMap[atlas->m_id.getHashValue()] = atlas;
+
+        return (true);
+    }
+
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
@@ -237,14 +364,12 @@ namespace GameHalloran {
             return (false);
         }
 
-        HashedString id(imgName.c_str());
-
-        AtlasImageMap::iterator imageIter = m_currAtlasPtr->m_images.find(id.getHashValue());
-        if(imageIter == m_currAtlasPtr->m_images.end()) {
+        const AtlasImage *imagePtr = m_currAtlasPtr->FindImage(reinterpret_cast<U64>(HashedString::hash_name(imgName.c_str())));
+        if(!imagePtr) {
             return (false);
         }
 
-        m_currImagePtr = (imageIter->second).get();
+        m_currImagePtr = imagePtr;
 
         return (true);
     }
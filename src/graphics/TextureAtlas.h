@@ -11,15 +11,20 @@
 // to batch up images and minimize GPU state changes.
 //
 // Used to read in atlases and their data files generated by the
-// "AtlasGenerator" build script located in $ROOT/src/build/tools/.
+// "atlasc" build tool (located in $ROOT/src/AtlasCompiler/), or to
+// pack atlases at runtime.
 //
 // /////////////////////////////////////////////////////////////////
 
 #include <map>
+#include <string>
+#include <vector>
 
 #include "GameBase.h"
 #include "HashedString.h"
 #include "TextureManager.h"
+#include "AtlasPacker.h"
+#include "AtlasDictionary.h"
 
 class TiXmlElement;
 
@@ -51,8 +56,8 @@ namespace GameHalloran {
         AtlasImage(const char *name) : m_x(0.0f), m_y(0.0f), m_width(0.0f), m_height(0.0f), m_id(name), m_flipped(false) {};
     };
 
-    typedef boost::shared_ptr<AtlasImage> AtlasImageSPtr;
-    typedef std::map<U64, AtlasImageSPtr > AtlasImageMap;
+    // Atlas images sorted by the hash of their ID.
+    typedef std::vector<AtlasImage> AtlasImageVector;
 
     struct TextureAtlas {
         U32 m_borderSize;       ///< Number of pixels space between images in the atlas.
@@ -61,7 +66,7 @@ namespace GameHalloran {
         HashedString m_id;      ///< Unique id.
         I32 m_mode;             ///< Image mode.
         I32 m_type;             ///< Image type.
-        AtlasImageMap m_images; ///< Collection of atlas images.
+        AtlasImageVector m_images;  ///< Collection of atlas images, sorted by ID hash.
         TexHandle m_atlasId;    ///< ID of the atlas the image belongs to.
 
         // /////////////////////////////////////////////////////////////////
@@ -69,6 +74,14 @@ namespace GameHalloran {
         //
         // /////////////////////////////////////////////////////////////////
         TextureAtlas(const char *name) : m_borderSize(0), m_width(0), m_height(0), m_id(name), m_mode(0), m_type(0), m_images(), m_atlasId(0) {};
+
+        // /////////////////////////////////////////////////////////////////
+        // Binary search the images for an ID hash.
+        //
+        // @return const AtlasImage* NULL if no image has the hash.
+        //
+        // /////////////////////////////////////////////////////////////////
+        const AtlasImage *FindImage(const U64 hash) const;
     };
 
     typedef boost::shared_ptr<TextureAtlas> TextureAtlasSPtr;
@@ -88,7 +101,7 @@ namespace GameHalloran {
         bool m_loaded;                          ///< ...
         TextureAtlasMap m_atlasMap;             ///< Our list of atlases.
         TextureAtlas *m_currAtlasPtr;           ///< Currently selected atlas.
-        AtlasImage *m_currImagePtr;             ///< Currently selected atlas image.
+        const AtlasImage *m_currImagePtr;       ///< Currently selected atlas image.
 
         // /////////////////////////////////////////////////////////////////
         // Parse the xml dictionary.
@@ -97,11 +110,26 @@ namespace GameHalloran {
         bool ParseXml(TiXmlElement *rootNodePtr);
 
         // /////////////////////////////////////////////////////////////////
-        // Parse an <Atlas> element.
+        // Parse an <Atlas> element.  The element is converted to a binary
+        // dictionary so both formats are read by the same code.
         //
         // /////////////////////////////////////////////////////////////////
         bool ParseAtlasElement(TiXmlElement *atlasNodePtr);
 
+        // /////////////////////////////////////////////////////////////////
+        // Parse a binary dictionary (see AtlasDictionary.h) and load the
+        // texture of each of its atlases.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool ParseDictionary(const U8 *dataPtr, const size_t length);
+
+        // /////////////////////////////////////////////////////////////////
+        // Create an atlas and its images from a binary dictionary, without
+        // loading the atlas texture.
+        //
+        // /////////////////////////////////////////////////////////////////
+        TextureAtlasSPtr CreateAtlas(const AtlasDictionaryAtlas &atlasRef, const std::vector<AtlasDictionaryImage> &imagesRef) const;
+
     public:
 
         // /////////////////////////////////////////////////////////////////
@@ -151,13 +179,34 @@ namespace GameHalloran {
         bool LoadFromFile(const boost::filesystem::path &atlasFilename);
 
         // /////////////////////////////////////////////////////////////////
-        // Load all texture atlases from the resource cache.
+        // Load all texture atlases from the resource cache.  Binary
+        // dictionaries (atlases/*.atd, written by the atlasc build tool)
+        // are read if there are any, otherwise the xml files are parsed.
         //
         // @return bool True|False on success|failure.
         //
         // /////////////////////////////////////////////////////////////////
         bool LoadFromResourceCache();
 
+        // /////////////////////////////////////////////////////////////////
+        // Pack images from the resource cache into a new atlas, such as
+        // GUI images loaded on demand.  The atlas is described with the
+        // same xml the atlasc build tool writes, so its images are used
+        // exactly as those of a pre-built atlas.
+        //
+        // @param atlasId The ID of the new atlas (see UseAtlas()).
+        // @param imageNamesRef The resource names of the images.  Each
+        //                      image's ID in the atlas is its file name
+        //                      (see UseImage()).
+        // @param optionsRef How to lay out the atlas.  Rotation should stay
+        //                      off for atlases used by the GUI.
+        //
+        // @return bool True|False on success|failure.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool BuildAtlas(const std::string &atlasId, const std::vector<std::string> &imageNamesRef, \
+                        const AtlasPackerOptions &optionsRef = AtlasPackerOptions());
+
         // /////////////////////////////////////////////////////////////////
         // Make a texture atlas the currently bound image on the GPU.
         //
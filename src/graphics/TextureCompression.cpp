@@ -0,0 +1,692 @@
+// /////////////////////////////////////////////////////////////////
+// @file TextureCompression.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Implementation of the CPU block compression (BC1/BC3/BC5) encoder
+// and decoder and the BCT texture container.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <boost/algorithm/string/case_conv.hpp>
+
+#include "TextureCompression.h"
+#include "ByteOrder.h"
+
+namespace GameHalloran {
+
+    namespace {
+
+        const U8 COMPRESSED_TEXTURE_MAGIC[4] = { 'G', 'F', 'B', 'C' };
+        const U32 COMPRESSED_TEXTURE_VERSION = 1;
+        const U32 MAX_COMPRESSED_TEXTURE_DIMENSION = 16384;     ///< Keeps the level sizes well inside a U32.
+        const U32 BLOCK_DIMENSION = 4;                          ///< Blocks are 4x4 texels.
+        const U32 BLOCK_TEXELS = 16;                            ///< Texels in a block.
+        const U32 POWER_ITERATIONS = 8;                         ///< Iterations to find the principal axis of a colour block.
+
+        // Global array of block format names.
+        const char * const gBlockFormatStrings[] = { "bc1", "bc3", "bc5" };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the size of a block in bytes.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U32 GetBlockSize(const BlockFormat format)
+        {
+            return ((format == BLOCK_FORMAT_BC1) ? 8 : 16);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Round and clamp a float to a byte.
+        //
+        // /////////////////////////////////////////////////////////////////
+        I32 ClampToByte(const F32 value)
+        {
+            if(value <= 0.0f) {
+                return (0);
+            }
+            if(value >= 255.0f) {
+                return (255);
+            }
+            return (I32(value + 0.5f));
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Quantize an 8 bit RGB colour to 5:6:5.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U16 PackColor565(const I32 r, const I32 g, const I32 b)
+        {
+            return (U16((((r * 31 + 127) / 255) << 11) | (((g * 63 + 127) / 255) << 5) | ((b * 31 + 127) / 255)));
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Expand a 5:6:5 colour to 8 bit RGB.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void UnpackColor565(const U16 color, I32 *rgbPtr)
+        {
+            const I32 r = (color >> 11) & 0x1F;
+            const I32 g = (color >> 5) & 0x3F;
+            const I32 b = color & 0x1F;
+            rgbPtr[0] = (r << 3) | (r >> 2);
+            rgbPtr[1] = (g << 2) | (g >> 4);
+            rgbPtr[2] = (b << 3) | (b >> 2);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Build the four RGBA colours of a colour block.  If allowThreeColor
+        // is true and c0 <= c1 then the block is in the three colour mode
+        // and colour 3 is transparent black (BC1 only).
+        //
+        // /////////////////////////////////////////////////////////////////
+        void BuildColorPalette(const U16 c0, const U16 c1, const bool allowThreeColor, I32 paletteArr[4][4])
+        {
+            UnpackColor565(c0, paletteArr[0]);
+            UnpackColor565(c1, paletteArr[1]);
+            paletteArr[0][3] = 255;
+            paletteArr[1][3] = 255;
+            paletteArr[2][3] = 255;
+            paletteArr[3][3] = 255;
+
+            if(c0 > c1 || !allowThreeColor) {
+                for(U32 i = 0; i < 3; ++i) {
+                    paletteArr[2][i] = (2 * paletteArr[0][i] + paletteArr[1][i] + 1) / 3;
+                    paletteArr[3][i] = (paletteArr[0][i] + 2 * paletteArr[1][i] + 1) / 3;
+                }
+            } else {
+                for(U32 i = 0; i < 3; ++i) {
+                    paletteArr[2][i] = (paletteArr[0][i] + paletteArr[1][i] + 1) / 2;
+                    paletteArr[3][i] = 0;
+                }
+                paletteArr[3][3] = 0;
+            }
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Build the eight values of a single channel (BC4) block.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void BuildChannelPalette(const I32 a0, const I32 a1, I32 *palettePtr)
+        {
+            palettePtr[0] = a0;
+            palettePtr[1] = a1;
+            if(a0 > a1) {
+                for(I32 i = 1; i < 7; ++i) {
+                    palettePtr[i + 1] = ((7 - i) * a0 + i * a1 + 3) / 7;
+                }
+            } else {
+                for(I32 i = 1; i < 5; ++i) {
+                    palettePtr[i + 1] = ((5 - i) * a0 + i * a1 + 2) / 5;
+                }
+                palettePtr[6] = 0;
+                palettePtr[7] = 255;
+            }
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Copy the 4x4 block of texels at block (bx, by) out of an RGBA
+        // image.  Texels past the right or top edge repeat the edge.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void FetchBlock(const U8 *rgbaPtr, const U32 width, const U32 height, const U32 bx, const U32 by, U8 *blockPtr)
+        {
+            for(U32 y = 0; y < BLOCK_DIMENSION; ++y) {
+                const U32 sy = std::min(by * BLOCK_DIMENSION + y, height - 1);
+                for(U32 x = 0; x < BLOCK_DIMENSION; ++x) {
+                    const U32 sx = std::min(bx * BLOCK_DIMENSION + x, width - 1);
+                    memcpy(blockPtr + (y * BLOCK_DIMENSION + x) * 4, rgbaPtr + (sy * width + sx) * 4, 4);
+                }
+            }
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Copy a decoded 4x4 block into an RGBA image, skipping the texels
+        // past the edges.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void StoreBlock(const U8 *blockPtr, const U32 width, const U32 height, const U32 bx, const U32 by, U8 *rgbaPtr)
+        {
+            for(U32 y = 0; y < BLOCK_DIMENSION && by * BLOCK_DIMENSION + y < height; ++y) {
+                for(U32 x = 0; x < BLOCK_DIMENSION && bx * BLOCK_DIMENSION + x < width; ++x) {
+                    memcpy(rgbaPtr + ((by * BLOCK_DIMENSION + y) * width + bx * BLOCK_DIMENSION + x) * 4, blockPtr + (y * BLOCK_DIMENSION + x) * 4, 4);
+                }
+            }
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Pick the nearest opaque palette colour for each texel.
+        //
+        // @return U32 The summed squared error of the block.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U32 FindColorIndices(const U8 *blockPtr, const U16 c0, const U16 c1, U8 *indicesPtr)
+        {
+            I32 paletteArr[4][4];
+            BuildColorPalette(c0, c1, false, paletteArr);
+
+            U32 totalError = 0;
+            for(U32 t = 0; t < BLOCK_TEXELS; ++t) {
+                U32 bestError = 0xFFFFFFFF;
+                for(U32 p = 0; p < 4; ++p) {
+                    U32 error = 0;
+                    for(U32 c = 0; c < 3; ++c) {
+                        const I32 diff = I32(blockPtr[t * 4 + c]) - paletteArr[p][c];
+                        error += U32(diff * diff);
+                    }
+                    if(error < bestError) {
+                        bestError = error;
+                        indicesPtr[t] = U8(p);
+                    }
+                }
+                totalError += bestError;
+            }
+
+            return (totalError);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Compress the RGB of a block to an 8 byte BC1 colour block.
+        //
+        // The end points are the extremes of the texels along the
+        // principal axis of the block's colours, then refined once by a
+        // least squares fit to the chosen indices.  The block is always
+        // written in the four colour mode (c0 > c1) so it decodes the same
+        // in BC1 and BC3.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void EncodeColorBlock(const U8 *blockPtr, U8 *outPtr)
+        {
+            F32 mean[3] = { 0.0f, 0.0f, 0.0f };
+            for(U32 t = 0; t < BLOCK_TEXELS; ++t) {
+                for(U32 c = 0; c < 3; ++c) {
+                    mean[c] += blockPtr[t * 4 + c];
+                }
+            }
+            for(U32 c = 0; c < 3; ++c) {
+                mean[c] /= F32(BLOCK_TEXELS);
+            }
+
+            // Covariance matrix of the colours.
+            F32 cov[3][3] = { { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f } };
+            for(U32 t = 0; t < BLOCK_TEXELS; ++t) {
+                F32 d[3];
+                for(U32 c = 0; c < 3; ++c) {
+                    d[c] = blockPtr[t * 4 + c] - mean[c];
+                }
+                for(U32 i = 0; i < 3; ++i) {
+                    for(U32 j = 0; j < 3; ++j) {
+                        cov[i][j] += d[i] * d[j];
+                    }
+                }
+            }
+
+            // Principal axis by power iteration.
+            F32 axis[3] = { 1.0f, 1.0f, 1.0f };
+            for(U32 iter = 0; iter < POWER_ITERATIONS; ++iter) {
+                F32 next[3];
+                for(U32 i = 0; i < 3; ++i) {
+                    next[i] = cov[i][0] * axis[0] + cov[i][1] * axis[1] + cov[i][2] * axis[2];
+                }
+                const F32 length = std::sqrt(next[0] * next[0] + next[1] * next[1] + next[2] * next[2]);
+                if(length < 1.0e-6f) {
+                    break;
+                }
+                for(U32 i = 0; i < 3; ++i) {
+                    axis[i] = next[i] / length;
+                }
+            }
+
+            F32 minT = 0.0f;
+            F32 maxT = 0.0f;
+            for(U32 t = 0; t < BLOCK_TEXELS; ++t) {
+                F32 proj = 0.0f;
+                for(U32 c = 0; c < 3; ++c) {
+                    proj += (blockPtr[t * 4 + c] - mean[c]) * axis[c];
+                }
+                minT = std::min(minT, proj);
+                maxT = std::max(maxT, proj);
+            }
+
+            U16 c0 = PackColor565(ClampToByte(mean[0] + axis[0] * maxT), ClampToByte(mean[1] + axis[1] * maxT), ClampToByte(mean[2] + axis[2] * maxT));
+            U16 c1 = PackColor565(ClampToByte(mean[0] + axis[0] * minT), ClampToByte(mean[1] + axis[1] * minT), ClampToByte(mean[2] + axis[2] * minT));
+            if(c0 < c1) {
+                std::swap(c0, c1);
+            }
+
+            U8 indices[BLOCK_TEXELS];
+            U32 error = FindColorIndices(blockPtr, c0, c1, indices);
+
+            // Least squares fit of the end points to the indices.  Index i
+            // is weighted w of c0 and (1 - w) of c1.
+            if(c0 != c1) {
+                const F32 weights[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+                F32 aa = 0.0f, bb = 0.0f, ab = 0.0f;
+                F32 ax[3] = { 0.0f, 0.0f, 0.0f };
+                F32 bx[3] = { 0.0f, 0.0f, 0.0f };
+                for(U32 t = 0; t < BLOCK_TEXELS; ++t) {
+                    const F32 a = weights[indices[t]];
+                    const F32 b = 1.0f - a;
+                    aa += a * a;
+                    bb += b * b;
+                    ab += a * b;
+                    for(U32 c = 0; c < 3; ++c) {
+                        ax[c] += a * blockPtr[t * 4 + c];
+                        bx[c] += b * blockPtr[t * 4 + c];
+                    }
+                }
+                const F32 det = aa * bb - ab * ab;
+                if(std::fabs(det) > 1.0e-6f) {
+                    I32 e0[3];
+                    I32 e1[3];
+                    for(U32 c = 0; c < 3; ++c) {
+                        e0[c] = ClampToByte((ax[c] * bb - bx[c] * ab) / det);
+                        e1[c] = ClampToByte((bx[c] * aa - ax[c] * ab) / det);
+                    }
+                    U16 r0 = PackColor565(e0[0], e0[1], e0[2]);
+                    U16 r1 = PackColor565(e1[0], e1[1], e1[2]);
+                    if(r0 < r1) {
+                        std::swap(r0, r1);
+                    }
+                    U8 refinedIndices[BLOCK_TEXELS];
+                    const U32 refinedError = FindColorIndices(blockPtr, r0, r1, refinedIndices);
+                    if(refinedError < error) {
+                        error = refinedError;
+                        c0 = r0;
+                        c1 = r1;
+                        memcpy(indices, refinedIndices, BLOCK_TEXELS);
+                    }
+                }
+            }
+
+            // Equal end points would select the three colour mode, where
+            // index 3 is transparent.  Only index 0 is needed.
+            if(c0 == c1) {
+                memset(indices, 0, BLOCK_TEXELS);
+            }
+
+            U32 bits = 0;
+            for(U32 t = 0; t < BLOCK_TEXELS; ++t) {
+                bits |= U32(indices[t]) << (t * 2);
+            }
+            WriteU16(outPtr, c0);
+            WriteU16(outPtr + 2, c1);
+            WriteU32(outPtr + 4, bits);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Decode an 8 byte colour block into the RGBA of a 4x4 block.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void DecodeColorBlock(const U8 *inPtr, const bool allowThreeColor, U8 *blockPtr)
+        {
+            I32 paletteArr[4][4];
+            BuildColorPalette(ReadU16(inPtr), ReadU16(inPtr + 2), allowThreeColor, paletteArr);
+
+            const U32 bits = ReadU32(inPtr + 4);
+            for(U32 t = 0; t < BLOCK_TEXELS; ++t) {
+                const U32 index = (bits >> (t * 2)) & 0x3;
+                for(U32 c = 0; c < 4; ++c) {
+                    blockPtr[t * 4 + c] = U8(paletteArr[index][c]);
+                }
+            }
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Pick the nearest palette value for each texel of one channel.
+        //
+        // @return U32 The summed squared error of the channel.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U32 FindChannelIndices(const U8 *blockPtr, const U32 channel, const I32 a0, const I32 a1, U8 *indicesPtr)
+        {
+            I32 palette[8];
+            BuildChannelPalette(a0, a1, palette);
+
+            U32 totalError = 0;
+            for(U32 t = 0; t < BLOCK_TEXELS; ++t) {
+                U32 bestError = 0xFFFFFFFF;
+                for(U32 p = 0; p < 8; ++p) {
+                    const I32 diff = I32(blockPtr[t * 4 + channel]) - palette[p];
+                    if(U32(diff * diff) < bestError) {
+                        bestError = U32(diff * diff);
+                        indicesPtr[t] = U8(p);
+                    }
+                }
+                totalError += bestError;
+            }
+
+            return (totalError);
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Compress one channel of a block to an 8 byte BC4 block.  Both the
+        // eight value mode (spanning the channel's range) and the six value
+        // mode (with exact 0 and 255) are tried.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void EncodeChannelBlock(const U8 *blockPtr, const U32 channel, U8 *outPtr)
+        {
+            I32 minValue = 255, maxValue = 0;
+            I32 minInner = 255, maxInner = 0;
+            for(U32 t = 0; t < BLOCK_TEXELS; ++t) {
+                const I32 value = blockPtr[t * 4 + channel];
+                minValue = std::min(minValue, value);
+                maxValue = std::max(maxValue, value);
+                if(value != 0 && value != 255) {
+                    minInner = std::min(minInner, value);
+                    maxInner = std::max(maxInner, value);
+                }
+            }
+
+            I32 a0 = maxValue;
+            I32 a1 = minValue;
+            U8 indices[BLOCK_TEXELS];
+            U32 error = FindChannelIndices(blockPtr, channel, a0, a1, indices);
+
+            if(error > 0) {
+                if(minInner > maxInner) {
+                    minInner = maxInner = 0;
+                }
+                U8 sixIndices[BLOCK_TEXELS];
+                const U32 sixError = FindChannelIndices(blockPtr, channel, minInner, maxInner, sixIndices);
+                if(sixError < error) {
+                    a0 = minInner;
+                    a1 = maxInner;
+                    memcpy(indices, sixIndices, BLOCK_TEXELS);
+                }
+            }
+
+            outPtr[0] = U8(a0);
+            outPtr[1] = U8(a1);
+            U32 bitPos = 0;
+            memset(outPtr + 2, 0, 6);
+            for(U32 t = 0; t < BLOCK_TEXELS; ++t, bitPos += 3) {
+                const U32 index = indices[t];
+                outPtr[2 + bitPos / 8] |= U8((index << (bitPos % 8)) & 0xFF);
+                if(bitPos % 8 > 5) {
+                    outPtr[2 + bitPos / 8 + 1] |= U8(index >> (8 - bitPos % 8));
+                }
+            }
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Decode an 8 byte BC4 block into one channel of a 4x4 block.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void DecodeChannelBlock(const U8 *inPtr, const U32 channel, U8 *blockPtr)
+        {
+            I32 palette[8];
+            BuildChannelPalette(inPtr[0], inPtr[1], palette);
+
+            U32 bitPos = 0;
+            for(U32 t = 0; t < BLOCK_TEXELS; ++t, bitPos += 3) {
+                U32 index = inPtr[2 + bitPos / 8] >> (bitPos % 8);
+                if(bitPos % 8 > 5) {
+                    index |= U32(inPtr[2 + bitPos / 8 + 1]) << (8 - bitPos % 8);
+                }
+                blockPtr[t * 4 + channel] = U8(palette[index & 0x7]);
+            }
+        }
+
+    }
+
+    // Size in bytes of the BCT file header.
+    const U32 COMPRESSED_TEXTURE_HEADER_SIZE = 24;
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    const char *FindStringFromBlockFormat(const BlockFormat format)
+    {
+        if(format >= BLOCK_FORMAT_COUNT) {
+            return ("");
+        }
+
+        return (gBlockFormatStrings[format]);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    BlockFormat FindBlockFormatFromString(const std::string &formatRef)
+    {
+        std::string copy(formatRef);
+        boost::algorithm::to_lower(copy);
+
+        for(I32 format = BLOCK_FORMAT_FIRST; format < BLOCK_FORMAT_COUNT; ++format) {
+            if(copy.compare(gBlockFormatStrings[format]) == 0) {
+                return (static_cast<BlockFormat>(format));
+            }
+        }
+
+        return (BLOCK_FORMAT_UNKNOWN);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    GLenum GetBlockFormatGLFormat(const BlockFormat format)
+    {
+        switch(format) {
+            case BLOCK_FORMAT_BC1:
+                return (GL_COMPRESSED_RGB_S3TC_DXT1_EXT);
+            case BLOCK_FORMAT_BC3:
+                return (GL_COMPRESSED_RGBA_S3TC_DXT5_EXT);
+            case BLOCK_FORMAT_BC5:
+                return (GL_COMPRESSED_RG_RGTC2);
+            default:
+                return (GL_NONE);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 GetBlockFormatChannels(const BlockFormat format)
+    {
+        switch(format) {
+            case BLOCK_FORMAT_BC1:
+                return (3);
+            case BLOCK_FORMAT_BC3:
+                return (4);
+            case BLOCK_FORMAT_BC5:
+                return (2);
+            default:
+                return (0);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 GetCompressedImageSize(const BlockFormat format, const U32 width, const U32 height)
+    {
+        return (((width + BLOCK_DIMENSION - 1) / BLOCK_DIMENSION) * ((height + BLOCK_DIMENSION - 1) / BLOCK_DIMENSION) * GetBlockSize(format));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 GetNumberMipLevels(const U32 width, const U32 height)
+    {
+        U32 levels = 1;
+        for(U32 size = std::max(width, height); size > 1; size >>= 1) {
+            ++levels;
+        }
+
+        return (levels);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void CompressImage(const U8 *rgbaPtr, const U32 width, const U32 height, const BlockFormat format, U8 *blocksPtr)
+    {
+        U8 block[BLOCK_TEXELS * 4];
+        const U32 blocksWide = (width + BLOCK_DIMENSION - 1) / BLOCK_DIMENSION;
+        const U32 blocksHigh = (height + BLOCK_DIMENSION - 1) / BLOCK_DIMENSION;
+
+        for(U32 by = 0; by < blocksHigh; ++by) {
+            for(U32 bx = 0; bx < blocksWide; ++bx) {
+                FetchBlock(rgbaPtr, width, height, bx, by, block);
+                switch(format) {
+                    case BLOCK_FORMAT_BC1:
+                        EncodeColorBlock(block, blocksPtr);
+                        break;
+                    case BLOCK_FORMAT_BC3:
+                        EncodeChannelBlock(block, 3, blocksPtr);
+                        EncodeColorBlock(block, blocksPtr + 8);
+                        break;
+                    case BLOCK_FORMAT_BC5:
+                        EncodeChannelBlock(block, 0, blocksPtr);
+                        EncodeChannelBlock(block, 1, blocksPtr + 8);
+                        break;
+                    default:
+                        return;
+                }
+                blocksPtr += GetBlockSize(format);
+            }
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void DecompressImage(const U8 *blocksPtr, const U32 width, const U32 height, const BlockFormat format, U8 *rgbaPtr)
+    {
+        U8 block[BLOCK_TEXELS * 4];
+        const U32 blocksWide = (width + BLOCK_DIMENSION - 1) / BLOCK_DIMENSION;
+        const U32 blocksHigh = (height + BLOCK_DIMENSION - 1) / BLOCK_DIMENSION;
+
+        for(U32 by = 0; by < blocksHigh; ++by) {
+            for(U32 bx = 0; bx < blocksWide; ++bx) {
+                switch(format) {
+                    case BLOCK_FORMAT_BC1:
+                        DecodeColorBlock(blocksPtr, true, block);
+                        break;
+                    case BLOCK_FORMAT_BC3:
+                        DecodeColorBlock(blocksPtr + 8, false, block);
+                        DecodeChannelBlock(blocksPtr, 3, block);
+                        break;
+                    case BLOCK_FORMAT_BC5:
+                        for(U32 t = 0; t < BLOCK_TEXELS; ++t) {
+                            block[t * 4 + 2] = 0;
+                            block[t * 4 + 3] = 255;
+                        }
+                        DecodeChannelBlock(blocksPtr, 0, block);
+                        DecodeChannelBlock(blocksPtr + 8, 1, block);
+                        break;
+                    default:
+                        return;
+                }
+                StoreBlock(block, width, height, bx, by, rgbaPtr);
+                blocksPtr += GetBlockSize(format);
+            }
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    F64 ComputePsnr(const U8 *aPtr, const U8 *bPtr, const U32 numberTexels, const U32 numberChannels)
+    {
+        F64 sum = 0.0;
+        for(U32 t = 0; t < numberTexels; ++t) {
+            for(U32 c = 0; c < numberChannels; ++c) {
+                const F64 diff = F64(aPtr[t * 4 + c]) - F64(bPtr[t * 4 + c]);
+                sum += diff * diff;
+            }
+        }
+
+        if(sum == 0.0 || numberTexels == 0 || numberChannels == 0) {
+            return (999.0);
+        }
+
+        const F64 mse = sum / (F64(numberTexels) * F64(numberChannels));
+        return (10.0 * std::log10((255.0 * 255.0) / mse));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void EncodeCompressedTexture(const U8 *rgbaPtr, const U32 width, const U32 height, const BlockFormat format, \
+                                 const bool generateMipMaps, std::vector<U8> &outRef, \
+                                 const ResampleFilter filter, const bool gammaCorrect)
+    {
+        CompressedTextureHeader header;
+        header.m_format = format;
+        header.m_width = width;
+        header.m_height = height;
+        header.m_numberMipLevels = generateMipMaps ? GetNumberMipLevels(width, height) : 1;
+
+        outRef.resize(COMPRESSED_TEXTURE_HEADER_SIZE + GetCompressedTextureDataSize(header));
+        U8 *outPtr = &outRef[0];
+        memcpy(outPtr, COMPRESSED_TEXTURE_MAGIC, 4);
+        WriteU32(outPtr + 4, COMPRESSED_TEXTURE_VERSION);
+        WriteU32(outPtr + 8, U32(format));
+        WriteU32(outPtr + 12, width);
+        WriteU32(outPtr + 16, height);
+        WriteU32(outPtr + 20, header.m_numberMipLevels);
+        outPtr += COMPRESSED_TEXTURE_HEADER_SIZE;
+
+        std::vector<U8> level(rgbaPtr, rgbaPtr + width * height * 4);
+        std::vector<U8> nextLevel;
+        U32 levelWidth = width;
+        U32 levelHeight = height;
+        for(U32 i = 0; i < header.m_numberMipLevels; ++i) {
+            CompressImage(&level[0], levelWidth, levelHeight, format, outPtr);
+            outPtr += GetCompressedImageSize(format, levelWidth, levelHeight);
+
+            if(i + 1 < header.m_numberMipLevels) {
+                DownsampleImage(&level[0], levelWidth, levelHeight, nextLevel, filter, gammaCorrect);
+                level.swap(nextLevel);
+                levelWidth = std::max(1U, levelWidth / 2);
+                levelHeight = std::max(1U, levelHeight / 2);
+            }
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ParseCompressedTextureHeader(const U8 *dataPtr, const size_t length, CompressedTextureHeader &headerRef)
+    {
+        if(dataPtr == NULL || length < COMPRESSED_TEXTURE_HEADER_SIZE || memcmp(dataPtr, COMPRESSED_TEXTURE_MAGIC, 4) != 0 \
+                || ReadU32(dataPtr + 4) != COMPRESSED_TEXTURE_VERSION) {
+            return (false);
+        }
+
+        const U32 format = ReadU32(dataPtr + 8);
+        headerRef.m_width = ReadU32(dataPtr + 12);
+        headerRef.m_height = ReadU32(dataPtr + 16);
+        headerRef.m_numberMipLevels = ReadU32(dataPtr + 20);
+        if(format >= U32(BLOCK_FORMAT_COUNT) \
+                || headerRef.m_width == 0 || headerRef.m_width > MAX_COMPRESSED_TEXTURE_DIMENSION \
+                || headerRef.m_height == 0 || headerRef.m_height > MAX_COMPRESSED_TEXTURE_DIMENSION \
+                || headerRef.m_numberMipLevels == 0 || headerRef.m_numberMipLevels > GetNumberMipLevels(headerRef.m_width, headerRef.m_height)) {
+            return (false);
+        }
+        headerRef.m_format = static_cast<BlockFormat>(format);
+
+        return (length - COMPRESSED_TEXTURE_HEADER_SIZE >= GetCompressedTextureDataSize(headerRef));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 GetCompressedTextureDataSize(const CompressedTextureHeader &headerRef)
+    {
+        U32 size = 0;
+        for(U32 i = 0; i < headerRef.m_numberMipLevels; ++i) {
+            size += GetCompressedImageSize(headerRef.m_format, std::max(1U, headerRef.m_width >> i), std::max(1U, headerRef.m_height >> i));
+        }
+
+        return (size);
+    }
+
+}
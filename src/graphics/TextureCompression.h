@@ -0,0 +1,173 @@
+#pragma once
+#ifndef __GF_TEXTURE_COMPRESSION_H
+#define __GF_TEXTURE_COMPRESSION_H
+
+// /////////////////////////////////////////////////////////////////
+// @file TextureCompression.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header for the CPU block compression (BC1/BC3/BC5) encoder and
+// decoder and the BCT texture container.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "GameBase.h"
+#include "ImageProcessing.h"
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    // @enum BlockFormat
+    // @author PJ O Halloran
+    //
+    // The block compressed texture formats.  Each 4x4 block of texels
+    // is stored in a fixed number of bytes.
+    // - BLOCK_FORMAT_BC1   (DXT1) Opaque RGB.  8 bytes a block.
+    // - BLOCK_FORMAT_BC3   (DXT5) RGBA.  16 bytes a block.
+    // - BLOCK_FORMAT_BC5   (RGTC2) Two channels, RG.  16 bytes a block.
+    //
+    // /////////////////////////////////////////////////////////////////
+    enum BlockFormat {
+        BLOCK_FORMAT_FIRST,
+        BLOCK_FORMAT_BC1 = BLOCK_FORMAT_FIRST,
+        BLOCK_FORMAT_BC3,
+        BLOCK_FORMAT_BC5,
+        BLOCK_FORMAT_COUNT,
+        BLOCK_FORMAT_UNKNOWN
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @struct CompressedTextureHeader
+    // @author PJ O Halloran
+    //
+    // Header of a BCT file.  A BCT file is the header followed by the
+    // blocks of each mipmap level, largest first.  Level i is
+    // max(1, width >> i) by max(1, height >> i) texels.  All the values
+    // are stored little endian.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct CompressedTextureHeader {
+        BlockFormat m_format;                   ///< Format of the blocks.
+        U32 m_width;                            ///< Width of the top level in texels.
+        U32 m_height;                           ///< Height of the top level in texels.
+        U32 m_numberMipLevels;                  ///< Number of mipmap levels stored.
+    };
+
+    // Size in bytes of the BCT file header.
+    extern const U32 COMPRESSED_TEXTURE_HEADER_SIZE;
+
+    // /////////////////////////////////////////////////////////////////
+    // Convert a block format to a string ("bc1", "bc3" or "bc5").
+    //
+    // /////////////////////////////////////////////////////////////////
+    const char *FindStringFromBlockFormat(const BlockFormat format);
+
+    // /////////////////////////////////////////////////////////////////
+    // Convert a string ("bc1", "bc3" or "bc5", any case) to a block
+    // format.
+    //
+    // @return BlockFormat BLOCK_FORMAT_UNKNOWN if not recognized.
+    //
+    // /////////////////////////////////////////////////////////////////
+    BlockFormat FindBlockFormatFromString(const std::string &formatRef);
+
+    // /////////////////////////////////////////////////////////////////
+    // Get the OpenGL internal format of a block format.
+    //
+    // /////////////////////////////////////////////////////////////////
+    GLenum GetBlockFormatGLFormat(const BlockFormat format);
+
+    // /////////////////////////////////////////////////////////////////
+    // Get the number of RGBA channels a block format keeps (3 for BC1,
+    // 4 for BC3 and 2 for BC5).
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 GetBlockFormatChannels(const BlockFormat format);
+
+    // /////////////////////////////////////////////////////////////////
+    // Get the size in bytes of an image of block compressed texels.
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 GetCompressedImageSize(const BlockFormat format, const U32 width, const U32 height);
+
+    // /////////////////////////////////////////////////////////////////
+    // Get the number of levels in a full mipmap chain down to 1x1.
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 GetNumberMipLevels(const U32 width, const U32 height);
+
+    // /////////////////////////////////////////////////////////////////
+    // Block compress an image.
+    //
+    // @param rgbaPtr The image as packed 8 bit RGBA texels.
+    // @param width The width of the image.
+    // @param height The height of the image.
+    // @param format The format to compress to.
+    // @param blocksPtr Output buffer of at least
+    //                  GetCompressedImageSize(format, width, height) bytes.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void CompressImage(const U8 *rgbaPtr, const U32 width, const U32 height, const BlockFormat format, U8 *blocksPtr);
+
+    // /////////////////////////////////////////////////////////////////
+    // Decompress a block compressed image to packed 8 bit RGBA.  BC1
+    // has an alpha of 255 (0 for the transparent texels of 3 colour
+    // blocks) and BC5 a blue of 0 and an alpha of 255.
+    //
+    // @param rgbaPtr Output buffer of at least width * height * 4 bytes.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void DecompressImage(const U8 *blocksPtr, const U32 width, const U32 height, const BlockFormat format, U8 *rgbaPtr);
+
+    // /////////////////////////////////////////////////////////////////
+    // Compute the peak signal to noise ratio of two 8 bit RGBA images
+    // over the first channels of each texel.
+    //
+    // @param numberChannels Number of the RGBA channels to compare.
+    //
+    // @return F64 The PSNR in decibels.  999.0 if the images are the
+    //              same.
+    //
+    // /////////////////////////////////////////////////////////////////
+    F64 ComputePsnr(const U8 *aPtr, const U8 *bPtr, const U32 numberTexels, const U32 numberChannels);
+
+    // /////////////////////////////////////////////////////////////////
+    // Encode an image to a BCT file in memory.
+    //
+    // @param rgbaPtr The image as packed 8 bit RGBA texels.
+    // @param generateMipMaps Store the full mipmap chain or only the
+    //                          top level?
+    // @param outRef The BCT file.
+    // @param filter The filter the mipmaps are downsampled with.
+    // @param gammaCorrect Are the RGB channels sRGB encoded?  If so the
+    //                      mipmaps are filtered in linear space.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void EncodeCompressedTexture(const U8 *rgbaPtr, const U32 width, const U32 height, const BlockFormat format, \
+                                 const bool generateMipMaps, std::vector<U8> &outRef, \
+                                 const ResampleFilter filter = RESAMPLE_FILTER_BOX, const bool gammaCorrect = false);
+
+    // /////////////////////////////////////////////////////////////////
+    // Read and check the header of a BCT file in memory.
+    //
+    // @return bool False if the data is not a BCT file or is too short
+    //              to hold the mipmap levels the header lists.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool ParseCompressedTextureHeader(const U8 *dataPtr, const size_t length, CompressedTextureHeader &headerRef);
+
+    // /////////////////////////////////////////////////////////////////
+    // Get the size in bytes of all the mipmap levels of a BCT file (the
+    // file without the header).
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 GetCompressedTextureDataSize(const CompressedTextureHeader &headerRef);
+
+}
+
+#endif
@@ -8,42 +8,457 @@
 //
 // /////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <cstring>
+#include <sstream>
+#include <vector>
 
 #include "TextureManager.h"
 #include "ResCache2.h"
 #include "ImageResource.h"
+#include "ImageLoadingPipeline.h"
 #include "GameMain.h"
 
 namespace GameHalloran {
 
+    namespace {
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the bytes the GPU stores per texel of an uncompressed
+        // internal format.  RGB is padded to 4 bytes by most drivers.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U64 GetBytesPerTexel(const GLint internalFormat)
+        {
+            switch(internalFormat) {
+                case 1:
+                case GL_ALPHA:
+                case GL_LUMINANCE:
+                case GL_RED:
+                    return (1);
+                case 2:
+                case GL_LUMINANCE_ALPHA:
+                case GL_RG:
+                    return (2);
+                default:
+                    return (4);
+            }
+        }
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the bytes used by an uncompressed texture.
+        //
+        // @param width Width of the base level.
+        // @param height Height of the base level.
+        // @param bytesPerTexel Bytes per texel.
+        // @param mipMapped Include the full mipmap chain?
+        //
+        // /////////////////////////////////////////////////////////////////
+        U64 GetTextureSize(U64 width, U64 height, const U64 bytesPerTexel, const bool mipMapped)
+        {
+            U64 size = width * height * bytesPerTexel;
+            while(mipMapped && (width > 1 || height > 1)) {
+                width = std::max<U64>(1, width / 2);
+                height = std::max<U64>(1, height / 2);
+                size += width * height * bytesPerTexel;
+            }
+            return (size);
+        }
+
+    }
+
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
     void TextureManager::ResizeTextureVector()
     {
         // First ensure that we do need to generate more texture objects.
-        if(m_usedTextureCount < m_glIdVec.size()) {
+        if(!m_glIdVec.empty()) {
             return;
         }
 
-        GLuint newTexObjects[DEFAULT_EXTEND_SIZE];              // Array of new texture objects.
-        const U64 oldSize(m_glIdVec.size());                    // Old size of the vector of texture IDs.
+        std::vector<GLuint> newTexObjects(m_extendSize);        // New texture objects.
 
         GF_CLEAR_GL_ERROR();
 
-        glGenTextures(DEFAULT_EXTEND_SIZE, newTexObjects);
+        glGenTextures(static_cast<GLsizei>(newTexObjects.size()), &newTexObjects[0]);
 
         if(!GF_CHECK_GL_ERROR_TRC("TextureManager::ResizeTextureVector(): ")) {
-            glDeleteTextures(DEFAULT_EXTEND_SIZE, newTexObjects);
+            glDeleteTextures(static_cast<GLsizei>(newTexObjects.size()), &newTexObjects[0]);
             return;
         }
 
-        m_glIdVec.resize(oldSize + DEFAULT_EXTEND_SIZE);
-        if(oldSize > 0) {
-            memcpy(&m_glIdVec[oldSize], newTexObjects, DEFAULT_EXTEND_SIZE * sizeof(GLuint));
+        m_glIdVec.swap(newTexObjects);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    boost::optional<GLuint> TextureManager::AcquireGlId()
+    {
+        boost::optional<GLuint> glId;
+
+        ResizeTextureVector();
+        if(m_glIdVec.empty()) {
+            GF_LOG_TRACE_ERR("TextureManager::AcquireGlId()", "Failed to generate OpenGL texture objects");
+            return (glId);
+        }
+
+        glId = m_glIdVec.back();
+        m_glIdVec.pop_back();
+        return (glId);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void TextureManager::DeleteGlId(const GLuint glId)
+    {
+        glDeleteTextures(1, &glId);
+        if(m_curBindTex == glId) {
+            m_curBindTex = 0;
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool TextureManager::ReserveMemory(const U64 size, const char *callerStr)
+    {
+        if(m_residency.GetBudget() != 0 && size > m_residency.GetBudget()) {
+            GF_LOG_TRACE_ERR(callerStr, "Cannot load image! It is bigger than the entire size of the TextureManagers memory budget!");
+            return (false);
+        }
+
+        // Textures which cannot be evicted may fill the budget, go over it rather than fail.
+        if(!m_residency.MakeRoom(size)) {
+            const TextureResidencyStats &stats = m_residency.GetStats();
+            if(stats.m_unevictableBytes + size > stats.m_budget) {
+                std::ostringstream message;
+                message << "Textures which cannot be evicted use " << stats.m_unevictableBytes << " bytes of the " << stats.m_budget \
+                        << " byte memory budget, going over it by loading " << size << " bytes";
+                GF_LOG_TRACE_ERR(callerStr, message.str());
+            } else {
+                GF_LOG_TRACE_INF(callerStr, "Not enough textures could be evicted to stay within the memory budget");
+            }
+        }
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    U64 TextureManager::GetImageTextureSize(const ImageResHandle &imgRef, const bool mipMapped) const
+    {
+        if(!imgRef.IsCompressed()) {
+            return (GetTextureSize(imgRef.GetImageWidth(), imgRef.GetImageHeight(), GetBytesPerTexel(imgRef.GetImageComponents()), mipMapped));
+        }
+
+        // Block compressed images are decompressed to RGBA if the GPU cannot sample the blocks.
+        const bool uploadBlocks = IsCompressedFormatSupported(imgRef.GetBlockFormat());
+        U64 size(0);
+        for(U32 level = 0; level < imgRef.GetNumberMipLevels(); ++level) {
+            GLint width, height, levelSize;
+            if(imgRef.GetMipLevelBuffer(level, width, height, levelSize) != NULL) {
+                size += uploadBlocks ? U64(levelSize) : U64(width) * height * 4;
+            }
+        }
+        return (size);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    boost::optional<U64> TextureManager::CreateImageTexture(TextureElement &elemRef)
+    {
+        boost::optional<U64> size;                      // Bytes of GPU memory used.
+        const GLenum target(elemRef.m_glTarget);
+        const bool rectangle(target == GL_TEXTURE_RECTANGLE);
+
+        ImageResource imgRes(elemRef.m_filename);
+        boost::shared_ptr<ImageResHandle> imgResHandle = boost::static_pointer_cast<ImageResHandle>(g_appPtr->GetResourceCache()->GetHandle(&imgRes));
+        if(!imgResHandle || !imgResHandle->VInitialize()) {
+            GF_LOG_TRACE_ERR("TextureManager::CreateImageTexture()", std::string("Failed to retrieve and/or initialize the resource ") + elemRef.m_filename);
+            return (size);
+        }
+        if(rectangle && imgResHandle->IsCompressed()) {
+            GF_LOG_TRACE_ERR("TextureManager::CreateImageTexture()", std::string("Rectangle textures cannot be block compressed ") + elemRef.m_filename);
+            return (size);
+        }
+
+        // Check if we need to swap out old textures to make room.
+        const bool mipMapped(!rectangle && m_currTexFilterMode >= eBasicMipMap);
+        const U64 textureSize(GetImageTextureSize(*imgResHandle, mipMapped));
+        if(!ReserveMemory(textureSize, "TextureManager::CreateImageTexture()")) {
+            return (size);
+        }
+
+        boost::optional<GLuint> glId = AcquireGlId();
+        if(!glId.is_initialized()) {
+            return (size);
+        }
+
+        GF_CLEAR_GL_ERROR();
+
+        glBindTexture(target, *glId);
+        GF_CHECK_GL_ERROR_TRC("TextureManager::CreateImageTexture(): ");
+        m_curBindTex = *glId;
+
+        bool pack = IsImageTypePacked(FindImageTypeFromFile(elemRef.m_filename));
+        const GLenum minFilter(rectangle ? GL_NEAREST : m_currMinFilter);
+        const GLenum magFilter(rectangle ? GL_NEAREST : m_currMagFilter);
+
+        glTexParameteri(target, GL_TEXTURE_MIN_FILTER, minFilter);
+        GF_CHECK_GL_ERROR_TRC("TextureManager::CreateImageTexture(): ");
+        glTexParameteri(target, GL_TEXTURE_MAG_FILTER, magFilter);
+        GF_CHECK_GL_ERROR_TRC("TextureManager::CreateImageTexture(): ");
+        glTexParameteri(target, GL_TEXTURE_WRAP_S, elemRef.m_wrapMode);
+        GF_CHECK_GL_ERROR_TRC("TextureManager::CreateImageTexture(): ");
+        glTexParameteri(target, GL_TEXTURE_WRAP_T, elemRef.m_wrapMode);
+        GF_CHECK_GL_ERROR_TRC("TextureManager::CreateImageTexture(): ");
+
+        bool loaded(false);
+        if(imgResHandle->IsCompressed()) {
+            loaded = LoadCompressed2D(*imgResHandle);
+        } else if(m_cpuMipMaps && mipMapped) {
+            loaded = LoadMipMapped2D(*imgResHandle);
         } else {
-            memcpy(&m_glIdVec[0], newTexObjects, DEFAULT_EXTEND_SIZE * sizeof(GLuint));
+            loaded = LoadCommon2D(target, 0, imgResHandle->GetImageComponents(), imgResHandle->GetImageWidth(), imgResHandle->GetImageHeight(), \
+                                  0, imgResHandle->GetImageFormat(), GL_UNSIGNED_BYTE, const_cast<GLbyte *>(imgResHandle->GetImageBuffer()), pack);
+
+            if(loaded && mipMapped) {
+                glGenerateMipmap(target);
+                loaded = GF_CHECK_GL_ERROR_TRC("TextureManager::CreateImageTexture(): ");
+            }
+        }
+
+        if(!loaded) {
+            DeleteGlId(*glId);
+            return (size);
+        }
+
+        GLint unpackAlignment(1);
+        if(!pack) {
+            glGetIntegerv(GL_UNPACK_ALIGNMENT, &unpackAlignment);
+            GF_CHECK_GL_ERROR_TRC("TextureManager::CreateImageTexture(): ");
+        }
+
+        // Fill out the data struct for the texture we have loaded onto the GPU.
+        elemRef.m_glTexId = *glId;
+        elemRef.m_minFilter = minFilter;
+        elemRef.m_magFilter = magFilter;
+        elemRef.m_width = imgResHandle->GetImageWidth();
+        elemRef.m_height = imgResHandle->GetImageHeight();
+        elemRef.m_imgFormat = imgResHandle->GetImageFormat();
+        elemRef.m_imgType = GL_UNSIGNED_BYTE;
+        elemRef.m_unpackAlignment = unpackAlignment;
+
+        size = textureSize;
+        return (size);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    boost::optional<U64> TextureManager::CreateCubeMapTexture(TextureElement &elemRef)
+    {
+        boost::optional<U64> size;                      // Bytes of GPU memory used.
+        const U32 CUBE_SIDES = 6;                       // Number of sides in a 3D cube.
+
+        if(elemRef.m_faceNames.size() != CUBE_SIDES) {
+            GF_LOG_TRACE_ERR("TextureManager::CreateCubeMapTexture()", "Invalid parameters");
+            return (size);
+        }
+
+        GLenum cubeEnum[CUBE_SIDES] = { GL_TEXTURE_CUBE_MAP_POSITIVE_X,
+                                        GL_TEXTURE_CUBE_MAP_NEGATIVE_X,
+                                        GL_TEXTURE_CUBE_MAP_POSITIVE_Y,
+                                        GL_TEXTURE_CUBE_MAP_NEGATIVE_Y,
+                                        GL_TEXTURE_CUBE_MAP_POSITIVE_Z,
+                                        GL_TEXTURE_CUBE_MAP_NEGATIVE_Z
+                                      };
+
+        const bool mipMapped(m_currTexFilterMode >= eBasicMipMap);
+        U64 totalSize(0);
+        boost::shared_ptr<ImageResHandle> imgResArr[6];
+
+        // Initialize cubemap images and calculate total size required.  The faces are
+        //  independent so they are decoded in parallel.
+        ImageLoadingPipeline pipeline(g_appPtr->GetResourceCache().get(), g_appPtr->GetWorkerThreadPoolPtr());
+        U32 faceIndexArr[CUBE_SIDES];
+        for(U32 i = 0; i < CUBE_SIDES; ++i) {
+            faceIndexArr[i] = pipeline.AddImage(elemRef.m_faceNames[i]);
+        }
+        pipeline.Finish();
+
+        for(U32 i = 0; i < CUBE_SIDES; ++i) {
+            imgResArr[i] = pipeline.GetImage(faceIndexArr[i]);
+            if(!imgResArr[i]) {
+                GF_LOG_TRACE_ERR("TextureManager::CreateCubeMapTexture()", std::string("Failed to retrieve and/or initialize the resource ") + elemRef.m_faceNames[i]);
+                return (size);
+            }
+            if(imgResArr[i]->IsCompressed()) {
+                GF_LOG_TRACE_ERR("TextureManager::CreateCubeMapTexture()", std::string("Cube maps cannot be block compressed ") + elemRef.m_faceNames[i]);
+                return (size);
+            }
+            totalSize += GetImageTextureSize(*imgResArr[i], mipMapped);
+        }
+
+        if(!ReserveMemory(totalSize, "TextureManager::CreateCubeMapTexture()")) {
+            return (size);
+        }
+
+        boost::optional<GLuint> glId = AcquireGlId();
+        if(!glId.is_initialized()) {
+            return (size);
+        }
+
+        GF_CLEAR_GL_ERROR();
+
+        glBindTexture(GL_TEXTURE_CUBE_MAP, *glId);
+        GF_CHECK_GL_ERROR_TRC("TextureManager::CreateCubeMapTexture(): ");
+        m_curBindTex = *glId;
+
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, m_currMinFilter);
+        GF_CHECK_GL_ERROR_TRC("TextureManager::CreateCubeMapTexture(): ");
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, m_currMagFilter);
+        GF_CHECK_GL_ERROR_TRC("TextureManager::CreateCubeMapTexture(): ");
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, elemRef.m_wrapMode);
+        GF_CHECK_GL_ERROR_TRC("TextureManager::CreateCubeMapTexture(): ");
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, elemRef.m_wrapMode);
+        GF_CHECK_GL_ERROR_TRC("TextureManager::CreateCubeMapTexture(): ");
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, elemRef.m_wrapMode);
+        GF_CHECK_GL_ERROR_TRC("TextureManager::CreateCubeMapTexture(): ");
+
+        for(U32 i = 0; i < CUBE_SIDES; ++i) {
+            bool pack = IsImageTypePacked(FindImageTypeFromFile(elemRef.m_faceNames[i]));
+            if(!LoadCommon2D(cubeEnum[i], 0, imgResArr[i]->GetImageComponents(), imgResArr[i]->GetImageWidth(), imgResArr[i]->GetImageHeight(), \
+                             0, imgResArr[i]->GetImageFormat(), GL_UNSIGNED_BYTE, const_cast<GLbyte *>(imgResArr[i]->GetImageBuffer()), pack)) {
+                DeleteGlId(*glId);
+                return (size);
+            }
+        }
+
+        if(mipMapped) {
+            glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
+            if(!GF_CHECK_GL_ERROR_TRC("TextureManager::CreateCubeMapTexture(): ")) {
+                DeleteGlId(*glId);
+                return (size);
+            }
+        }
+
+        GLint unpackAlignment(1);
+        if(!IsImageTypePacked(FindImageTypeFromFile(elemRef.m_faceNames[0]))) {
+            glGetIntegerv(GL_UNPACK_ALIGNMENT, &unpackAlignment);
+            GF_CHECK_GL_ERROR_TRC("TextureManager::CreateCubeMapTexture(): ");
+        }
+
+        // Fill out the data struct for the texture we have loaded onto the GPU.
+        elemRef.m_glTexId = *glId;
+        elemRef.m_minFilter = m_currMinFilter;
+        elemRef.m_magFilter = m_currMagFilter;
+        elemRef.m_width = imgResArr[0]->GetImageWidth();
+        elemRef.m_height = imgResArr[0]->GetImageHeight();
+        elemRef.m_imgFormat = imgResArr[0]->GetImageFormat();
+        elemRef.m_imgType = GL_UNSIGNED_BYTE;
+        elemRef.m_unpackAlignment = unpackAlignment;
+
+        size = totalSize;
+        return (size);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    TexHandle TextureManager::AddElement(TextureElement &elemRef, const U64 size)
+    {
+        // Reuse the handles of unloaded textures so the residency entries stay dense.
+        if(m_freeHandles.empty()) {
+            elemRef.m_id = m_nextHandle++;
+        } else {
+            elemRef.m_id = m_freeHandles.back();
+            m_freeHandles.pop_back();
+        }
+        m_elementsMap[elemRef.m_id] = elemRef;
+        m_residency.Add(elemRef.m_id, size, elemRef.m_reloadable);
+        return (elemRef.m_id);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool TextureManager::VEvict(const TexHandle handle)
+    {
+        ElementMap::iterator i = m_elementsMap.find(handle);
+        if(i == m_elementsMap.end() || ((*i).second).m_glTexId == 0) {
+            return (false);
+        }
+
+        GF_CLEAR_GL_ERROR();
+
+        DeleteGlId(((*i).second).m_glTexId);
+        if(!GF_CHECK_GL_ERROR_TRC("TextureManager::VEvict(): ")) {
+            GF_LOG_TRACE_ERR("TextureManager::VEvict()", std::string("An OpenGL error occurred freeing the texture data for the image ") + ((*i).second).m_filename);
+            return (false);
+        }
+
+        ((*i).second).m_glTexId = 0;
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    boost::optional<U64> TextureManager::VReload(const TexHandle handle)
+    {
+        boost::optional<U64> size;
+
+        ElementMap::iterator i = m_elementsMap.find(handle);
+        if(i == m_elementsMap.end() || !((*i).second).m_reloadable) {
+            return (size);
+        }
+
+        // The images may still be being decoded by a prefetch.
+        WaitForPrefetch();
+
+        if(((*i).second).m_glTarget == GL_TEXTURE_CUBE_MAP) {
+            size = CreateCubeMapTexture((*i).second);
+        } else {
+            size = CreateImageTexture((*i).second);
+        }
+
+        return (size);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void TextureManager::WaitForPrefetch()
+    {
+        if(m_prefetchPtr && !m_prefetchDecoded) {
+            m_prefetchPtr->Finish();
+            m_prefetchDecoded = true;
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void TextureManager::FinishPrefetch()
+    {
+        WaitForPrefetch();
+
+        // Hold the pipeline so the decoded images stay in the resource cache while the textures are reloaded.
+        boost::shared_ptr<ImageLoadingPipeline> pipelinePtr;
+        pipelinePtr.swap(m_prefetchPtr);
+        std::vector<TexHandle> handles;
+        handles.swap(m_prefetchHandles);
+
+        for(std::vector<TexHandle>::const_iterator i = handles.begin(), end = handles.end(); i != end; ++i) {
+            if(m_residency.IsManaged(*i) && !m_residency.IsResident(*i)) {
+                m_residency.Touch(*i);
+            }
         }
     }
 
@@ -51,10 +466,11 @@ namespace GameHalloran {
     //
     // /////////////////////////////////////////////////////////////////
     TextureManager::TextureManager(const U32 expectedNumTextures,
-                                   const U32 maxSize) throw(GameException &)
+                                   const U64 maxSize) throw(GameException &)
         : m_elementsMap()
         , m_glIdVec()
-        , m_usedTextureCount(0)
+        , m_nextHandle(0)
+        , m_freeHandles()
         , m_currTexLayer(0)
         , m_maxTexLayers(0)
         , m_currTexFilterMode(eBasic)
@@ -63,9 +479,14 @@ namespace GameHalloran {
         , m_anisotropicLinearLevel(0.0f)
         , m_maxAnisotropicValue(0.0f)
         , m_extendSize(DEFAULT_EXTEND_SIZE)
-        , m_maxSize(maxSize)
-        , m_currSize(0)
+        , m_residency(this, maxSize)
+        , m_prefetchPtr()
+        , m_prefetchHandles()
+        , m_prefetchDecoded(false)
         , m_curBindTex(99999)
+        , m_cpuMipMaps(false)
+        , m_mipMapFilter(RESAMPLE_FILTER_KAISER)
+        , m_gammaCorrectMipMaps(true)
     {
         m_glIdVec.resize(expectedNumTextures);
 
@@ -163,9 +584,11 @@ namespace GameHalloran {
         GF_CLEAR_GL_ERROR();
 
         for(ElementMap::iterator i = m_elementsMap.begin(), end = m_elementsMap.end(); i != end; ++i) {
+            // Evicted textures are given the current filters when reloaded.
             GLenum currTarget(((*i).second).m_glTarget);
-            if(currTarget != GL_TEXTURE_RECTANGLE) {
-                Bind(((*i).second).m_id, currTarget);
+            if(currTarget != GL_TEXTURE_RECTANGLE && ((*i).second).m_glTexId != 0) {
+                glBindTexture(currTarget, ((*i).second).m_glTexId);
+                m_curBindTex = ((*i).second).m_glTexId;
                 glTexParameteri(currTarget, GL_TEXTURE_MIN_FILTER, m_currMinFilter);
                 GF_CHECK_GL_ERROR_TRC("TextureManager::UpdateTextureFilters(): ");
 
@@ -188,15 +611,12 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
-    boost::optional<GLuint> TextureManager::Find(const TexHandle tHandle, bool timestampTex)
+    boost::optional<GLuint> TextureManager::Find(const TexHandle tHandle) const
     {
         boost::optional<GLuint> texturePrivateId;
 
-        ElementMap::iterator i = m_elementsMap.find(tHandle);
+        ElementMap::const_iterator i = m_elementsMap.find(tHandle);
         if(i == m_elementsMap.end()) {
-            if(timestampTex) {
-                (*i).second.m_timestamp = static_cast<F32>(g_appPtr->GetCurrTime());
-            }
             return (texturePrivateId);
         }
 
@@ -225,63 +645,28 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
-    boost::optional<U32> TextureManager::UnloadLRUTexture()
+    bool TextureManager::UnloadTexture(ElementMap::iterator texIter)
     {
-        boost::optional<U32> bytesFreed;                // Number of bytes freed.
-
-        if(!m_elementsMap.empty()) {
-            //F32 minTs(FLT_MAX);                                       // Record of minimum ts found to date.
-            F32 minTs(999999999.9999);                                  // Record of minimum ts found to date.
-            ElementMap::iterator lruElementIter(m_elementsMap.end());   // Iterator into element map.
-
-            for(ElementMap::iterator i = m_elementsMap.begin(), end = m_elementsMap.end(); (i != end); ++i) {
-                if(((*i).second).m_timestamp < minTs) {
-                    minTs = ((*i).second).m_timestamp;
-                    lruElementIter = i;
-                }
-            }
-
-            bytesFreed = UnloadTexture(lruElementIter);
+        if(texIter == m_elementsMap.end()) {
+            return (false);
         }
 
-        return (bytesFreed);
-    }
-
-    // /////////////////////////////////////////////////////////////////
-    //
-    // /////////////////////////////////////////////////////////////////
-    boost::optional<U32> TextureManager::UnloadTexture(ElementMap::iterator &texIter)
-    {
-        boost::optional<U32> bytesFreed;                // Number of bytes freed.
-
-        if(texIter != m_elementsMap.end()) {
+        // Evicted textures have no texture data on the GPU.
+        if(((*texIter).second).m_glTexId != 0) {
             GF_CLEAR_GL_ERROR();
 
-            glDeleteTextures(1, &((*texIter).second).m_glTexId);
+            DeleteGlId(((*texIter).second).m_glTexId);
             if(!GF_CHECK_GL_ERROR_TRC("TextureManager::UnloadTexture(): ")) {
                 GF_LOG_TRACE_ERR("TextureManager::UnloadTexture()", std::string("An OpenGL error occurred freeing the texture data for the image ") + ((*texIter).second).m_filename);
-                return (bytesFreed);
-            }
-
-            bytesFreed = ((*texIter).second).m_width * ((*texIter).second).m_height;
-            m_currSize -= *bytesFreed;
-            m_elementsMap.erase(texIter);
-
-            bool found(false);
-            for(std::vector<GLuint>::iterator i = m_glIdVec.begin(); ((!found) && (i != m_glIdVec.end()));) {
-                if((*i) == ((*texIter).second).m_glTexId) {
-                    i = m_glIdVec.erase(i);
-                    found = true;
-                } else {
-                    ++i;
-                }
-            }
-            if(found) {
-                --m_usedTextureCount;
+                return (false);
             }
         }
 
-        return (bytesFreed);
+        m_residency.Remove((*texIter).first);
+        m_freeHandles.push_back((*texIter).first);
+        m_elementsMap.erase(texIter);
+
+        return (true);
     }
 
     // /////////////////////////////////////////////////////////////////
@@ -289,21 +674,7 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     bool TextureManager::UnloadTexture(const TexHandle textureHandle)
     {
-        boost::optional<U32> bytesFreed;                // Number of bytes freed.
-
-        if(!m_elementsMap.empty()) {
-            ElementMap::iterator elementIter(m_elementsMap.end());  // Iterator into element map.
-
-            for(ElementMap::iterator i = m_elementsMap.begin(), end = m_elementsMap.end(); (i != end); ++i) {
-                if(((*i).second).m_id < textureHandle) {
-                    elementIter = i;
-                }
-            }
-
-            bytesFreed = UnloadTexture(elementIter);
-        }
-
-        return (bytesFreed.is_initialized());
+        return (UnloadTexture(m_elementsMap.find(textureHandle)));
     }
 
     // /////////////////////////////////////////////////////////////////
@@ -323,27 +694,23 @@ namespace GameHalloran {
             return (tHandle);
         }
 
-        if(m_maxSize != 0) {
-            if(w > m_maxSize) {
-                GF_LOG_TRACE_ERR("TextureManager::Load1D()", "Cannot load image! It is bigger than the entire size of the TextureManagers memory budget!");
-                return (tHandle);
-            }
-
-            while(w + m_currSize > m_maxSize) {
-                UnloadLRUTexture();
-            }
+        const bool mipMapped(m_currTexFilterMode >= eBasicMipMap);
+        const U64 textureSize(GetTextureSize(w, 1, GetBytesPerTexel(GL_RGB), mipMapped));
+        if(!ReserveMemory(textureSize, "TextureManager::Load1D()")) {
+            return (tHandle);
         }
 
-        // Ensure we have generated enough texture objects.
-        if(m_usedTextureCount >= m_glIdVec.size()) {
-            ResizeTextureVector();
+        boost::optional<GLuint> glId = AcquireGlId();
+        if(!glId.is_initialized()) {
+            return (tHandle);
         }
 
         GF_CLEAR_GL_ERROR();
 
         // Bind to the next available texture object.
-        glBindTexture(GL_TEXTURE_1D, m_glIdVec[m_usedTextureCount]);
+        glBindTexture(GL_TEXTURE_1D, *glId);
         GF_CHECK_GL_ERROR_TRC("TextureManager::Load1D(): ");
+        m_curBindTex = *glId;
 
         glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, m_currMinFilter);
         GF_CHECK_GL_ERROR_TRC("TextureManager::Load1D(): ");
@@ -355,26 +722,24 @@ namespace GameHalloran {
         // Send the texture data to the GPU (using set format values).
         glTexImage1D(GL_TEXTURE_1D, 0, GL_RGB, w, 0, GL_RGB, GL_UNSIGNED_BYTE, textureData);
         if(!GF_CHECK_GL_ERROR_TRC("TextureManager::Load1D(): ")) {
+            DeleteGlId(*glId);
             return (tHandle);
         }
 
-        if(m_currTexFilterMode >= eBasicMipMap) {
+        if(mipMapped) {
             glGenerateMipmap(GL_TEXTURE_1D);
             if(!GF_CHECK_GL_ERROR_TRC("TextureManager::Load1D(): ")) {
+                DeleteGlId(*glId);
                 return (tHandle);
             }
         }
 
-        // increment the current size of the textures stored in the GPU.
-        m_currSize += w;
-        tHandle = m_usedTextureCount;
-
-        // Fill out the data struct for the texture we have loaded onto the GPU.
+        // Fill out the data struct for the texture we have loaded onto the GPU.  The texels
+        //  are not kept so the texture cannot be evicted.
         TextureElement newTexElement;
-        newTexElement.m_id = *tHandle;
         newTexElement.m_filename.assign(imgnameRef);
-        newTexElement.m_timestamp = static_cast<F32>(g_appPtr->GetCurrTime());
-        newTexElement.m_glTexId = m_glIdVec[*tHandle];
+        newTexElement.m_reloadable = false;
+        newTexElement.m_glTexId = *glId;
         newTexElement.m_minFilter = m_currMinFilter;
         newTexElement.m_magFilter = m_currMagFilter;
         newTexElement.m_wrapMode = wrapMode;
@@ -385,8 +750,7 @@ namespace GameHalloran {
         newTexElement.m_imgType = GL_UNSIGNED_BYTE;
         newTexElement.m_unpackAlignment = -1;
 
-        m_elementsMap[*tHandle] = newTexElement;
-        ++m_usedTextureCount;
+        tHandle = AddElement(newTexElement, textureSize);
 
         return (tHandle);
     }
@@ -431,11 +795,104 @@ namespace GameHalloran {
             GF_CHECK_GL_ERROR_TRC("TextureManager::LoadCommon2D(): ");
         }
 
-        if(!glError) {
-            m_currSize += width * height;
+        return (!glError);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool TextureManager::LoadCompressed2D(const ImageResHandle &imgRef)
+    {
+        const BlockFormat format = imgRef.GetBlockFormat();
+        const bool uploadBlocks = IsCompressedFormatSupported(format);
+        std::vector<U8> rgbaVec;
+
+        GF_CLEAR_GL_ERROR();
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, GLint(imgRef.GetNumberMipLevels()) - 1);
+        if(!GF_CHECK_GL_ERROR_TRC("TextureManager::LoadCompressed2D(): ")) {
+            return (false);
         }
 
-        return (!glError);
+        for(U32 level = 0; level < imgRef.GetNumberMipLevels(); ++level) {
+            GLint width, height, size;
+            const GLbyte *levelPtr = imgRef.GetMipLevelBuffer(level, width, height, size);
+            if(levelPtr == NULL) {
+                GF_LOG_TRACE_ERR("TextureManager::LoadCompressed2D()", std::string("The image is not block compressed ") + imgRef.GetImageFilename());
+                return (false);
+            }
+
+            if(uploadBlocks) {
+                glCompressedTexImage2D(GL_TEXTURE_2D, level, imgRef.GetImageFormat(), width, height, 0, size, levelPtr);
+            } else {
+                // RGBA rows are always 4 byte aligned.
+                rgbaVec.resize(width * height * 4);
+                DecompressImage(reinterpret_cast<const U8 *>(levelPtr), width, height, format, &rgbaVec[0]);
+                glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, &rgbaVec[0]);
+            }
+            if(!GF_CHECK_GL_ERROR_TRC("TextureManager::LoadCompressed2D(): ")) {
+                return (false);
+            }
+        }
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool TextureManager::LoadMipMapped2D(const ImageResHandle &imgRef)
+    {
+        const U32 width = U32(imgRef.GetImageWidth());
+        const U32 height = U32(imgRef.GetImageHeight());
+        std::vector<U8> rgbaVec;
+        if(!ConvertImageToRgba(imgRef, rgbaVec)) {
+            GF_LOG_TRACE_ERR("TextureManager::LoadMipMapped2D()", std::string("Unsupported image format ") + imgRef.GetImageFilename());
+            return (false);
+        }
+
+        return (LoadMipMappedRgba2D(&rgbaVec[0], width, height, imgRef.GetImageComponents()));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool TextureManager::LoadMipMappedRgba2D(const U8 *rgbaPtr, const U32 width, const U32 height, const GLint internalFormat)
+    {
+        // RGBA rows are always 4 byte aligned.
+        if(!LoadCommon2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, const_cast<U8 *>(rgbaPtr))) {
+            return (false);
+        }
+
+        std::vector< std::vector<U8> > levels;
+        GenerateMipChain(rgbaPtr, width, height, levels, m_mipMapFilter, m_gammaCorrectMipMaps);
+
+        GF_CLEAR_GL_ERROR();
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, GLint(levels.size()));
+        for(U32 level = 0; level < levels.size(); ++level) {
+            const GLsizei levelWidth = std::max(1U, width >> (level + 1));
+            const GLsizei levelHeight = std::max(1U, height >> (level + 1));
+            glTexImage2D(GL_TEXTURE_2D, level + 1, internalFormat, levelWidth, levelHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, &levels[level][0]);
+        }
+
+        return (GF_CHECK_GL_ERROR_TRC("TextureManager::LoadMipMappedRgba2D(): "));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool TextureManager::IsCompressedFormatSupported(const BlockFormat format) const
+    {
+        switch(format) {
+            case BLOCK_FORMAT_BC1:
+            case BLOCK_FORMAT_BC3:
+                return (GLEW_EXT_texture_compression_s3tc != GL_FALSE);
+            case BLOCK_FORMAT_BC5:
+                return (GLEW_VERSION_3_0 != GL_FALSE || GLEW_ARB_texture_compression_rgtc != GL_FALSE);
+            default:
+                return (false);
+        }
     }
 
     // /////////////////////////////////////////////////////////////////
@@ -455,85 +912,100 @@ namespace GameHalloran {
             return (tHandle);
         }
 
-        ImageResource imgRes(imgnameRef);
-        boost::shared_ptr<ImageResHandle> imgResHandle = boost::static_pointer_cast<ImageResHandle>(g_appPtr->GetResourceCache()->GetHandle(&imgRes));
-        if(!imgResHandle || !imgResHandle->VInitialize()) {
-            GF_LOG_TRACE_ERR("TextureManager::Load2D()", std::string("Failed to retrieve and/or initialize the resource ") + imgnameRef);
+        TextureElement newTexElement;
+        newTexElement.m_filename.assign(imgnameRef);
+        newTexElement.m_reloadable = true;
+        newTexElement.m_wrapMode = wrapMode;
+        newTexElement.m_glTarget = GL_TEXTURE_2D;
+
+        boost::optional<U64> textureSize = CreateImageTexture(newTexElement);
+        if(!textureSize.is_initialized()) {
             return (tHandle);
         }
 
-        // Check if we need to swap out textures.
-        if(m_maxSize != 0) {
-            U32 imgsize(imgResHandle->GetImageWidth() * imgResHandle->GetImageHeight());
-            if(imgsize > m_maxSize) {
-                GF_LOG_TRACE_ERR("TextureManager::Load2D()", "Cannot load image! It is bigger than the entire size of the TextureManagers memory budget!");
-                return (tHandle);
-            }
-            while(imgsize + m_currSize > m_maxSize) {
-                UnloadLRUTexture();
-            }
+        tHandle = AddElement(newTexElement, *textureSize);
+
+        return (tHandle);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    boost::optional<TexHandle> TextureManager::LoadRgba2D(const std::string &imgnameRef, const U8 *rgbaPtr, const U32 width, const U32 height, const GLenum wrapMode)
+    {
+        boost::optional<TexHandle> tHandle;             // The texture handle.
+
+        if((rgbaPtr == NULL) || (width == 0) || (height == 0) || (imgnameRef.empty())) {
+            GF_LOG_TRACE_ERR("TextureManager::LoadRgba2D()", "Invalid parameters");
+            return (tHandle);
         }
 
-        if(m_usedTextureCount >= m_glIdVec.size()) {
-            ResizeTextureVector();
+        tHandle = Find(imgnameRef);
+        if(tHandle.is_initialized()) {
+            return (tHandle);
         }
 
-        GF_CLEAR_GL_ERROR();
+        const bool mipMapped(m_currTexFilterMode >= eBasicMipMap);
+        const U64 textureSize(GetTextureSize(width, height, GetBytesPerTexel(GL_RGBA), mipMapped));
+        if(!ReserveMemory(textureSize, "TextureManager::LoadRgba2D()")) {
+            return (tHandle);
+        }
 
-        glBindTexture(GL_TEXTURE_2D, m_glIdVec[m_usedTextureCount]);
-        GF_CHECK_GL_ERROR_TRC("TextureManager::Load2D(): ");
+        boost::optional<GLuint> glId = AcquireGlId();
+        if(!glId.is_initialized()) {
+            return (tHandle);
+        }
 
-        bool pack = (FindImageTypeFromFile(imgnameRef) == IMAGE_TYPE_TGA);
+        GF_CLEAR_GL_ERROR();
+
+        glBindTexture(GL_TEXTURE_2D, *glId);
+        GF_CHECK_GL_ERROR_TRC("TextureManager::LoadRgba2D(): ");
+        m_curBindTex = *glId;
 
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, m_currMinFilter);
-        GF_CHECK_GL_ERROR_TRC("TextureManager::Load2D(): ");
+        GF_CHECK_GL_ERROR_TRC("TextureManager::LoadRgba2D(): ");
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, m_currMagFilter);
-        GF_CHECK_GL_ERROR_TRC("TextureManager::Load2D(): ");
+        GF_CHECK_GL_ERROR_TRC("TextureManager::LoadRgba2D(): ");
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapMode);
-        GF_CHECK_GL_ERROR_TRC("TextureManager::Load2D(): ");
+        GF_CHECK_GL_ERROR_TRC("TextureManager::LoadRgba2D(): ");
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrapMode);
-        GF_CHECK_GL_ERROR_TRC("TextureManager::Load2D(): ");
+        GF_CHECK_GL_ERROR_TRC("TextureManager::LoadRgba2D(): ");
 
-        if(!LoadCommon2D(GL_TEXTURE_2D, 0, imgResHandle->GetImageComponents(), imgResHandle->GetImageWidth(), imgResHandle->GetImageHeight(), \
-                         0, imgResHandle->GetImageFormat(), GL_UNSIGNED_BYTE, const_cast<GLbyte *>(imgResHandle->GetImageBuffer()), pack)) {
-            return (tHandle);
-        }
+        bool loaded(false);
+        if(m_cpuMipMaps && mipMapped) {
+            loaded = LoadMipMappedRgba2D(rgbaPtr, width, height, GL_RGBA);
+        } else {
+            // RGBA rows are always 4 byte aligned.
+            loaded = LoadCommon2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, const_cast<U8 *>(rgbaPtr));
 
-        if(m_currTexFilterMode >= eBasicMipMap) {
-            glGenerateMipmap(GL_TEXTURE_2D);
-            if(!GF_CHECK_GL_ERROR_TRC("TextureManager::Load2D(): ")) {
-                return (tHandle);
+            if(loaded && mipMapped) {
+                glGenerateMipmap(GL_TEXTURE_2D);
+                loaded = GF_CHECK_GL_ERROR_TRC("TextureManager::LoadRgba2D(): ");
             }
         }
 
-        // Set the public texture ID.
-        tHandle = m_usedTextureCount;
-
-        GLint unpackAlignment(1);
-        if(!pack) {
-            glGetIntegerv(GL_UNPACK_ALIGNMENT, &unpackAlignment);
-            GF_CHECK_GL_ERROR_TRC("TextureManager::Load2D(): ");
+        if(!loaded) {
+            DeleteGlId(*glId);
+            return (tHandle);
         }
 
-        // Fill out the data struct for the texture we have loaded onto the GPU.
+        // Fill out the data struct for the texture we have loaded onto the GPU.  The texels
+        //  are not kept so the texture cannot be evicted.
         TextureElement newTexElement;
-        newTexElement.m_id = *tHandle;
         newTexElement.m_filename.assign(imgnameRef);
-        newTexElement.m_timestamp = static_cast<F32>(g_appPtr->GetCurrTime());
-        newTexElement.m_glTexId = m_glIdVec[*tHandle];
+        newTexElement.m_reloadable = false;
+        newTexElement.m_glTexId = *glId;
         newTexElement.m_minFilter = m_currMinFilter;
         newTexElement.m_magFilter = m_currMagFilter;
         newTexElement.m_wrapMode = wrapMode;
         newTexElement.m_glTarget = GL_TEXTURE_2D;
-        newTexElement.m_width = imgResHandle->GetImageWidth();
-        newTexElement.m_height = imgResHandle->GetImageHeight();
-        newTexElement.m_imgFormat = imgResHandle->GetImageFormat();
+        newTexElement.m_width = width;
+        newTexElement.m_height = height;
+        newTexElement.m_imgFormat = GL_RGBA;
         newTexElement.m_imgType = GL_UNSIGNED_BYTE;
-        newTexElement.m_unpackAlignment = unpackAlignment;
+        newTexElement.m_unpackAlignment = 4;
 
-        // Append the struct to the map.
-        m_elementsMap[*tHandle] = newTexElement;
-        ++m_usedTextureCount;
+        tHandle = AddElement(newTexElement, textureSize);
 
         return (tHandle);
     }
@@ -555,82 +1027,20 @@ namespace GameHalloran {
             return (tHandle);
         }
 
-        ImageResource imgRes(imgnameRef);
-        boost::shared_ptr<ImageResHandle> imgResHandle = boost::static_pointer_cast<ImageResHandle>(g_appPtr->GetResourceCache()->GetHandle(&imgRes));
-        if(!imgResHandle || !imgResHandle->VInitialize()) {
-            GF_LOG_TRACE_ERR("TextureManager::LoadRectangle()", std::string("Failed to retrieve and/or initialize the resource ") + imgnameRef);
-            return (tHandle);
-        }
-
-        wRef = imgResHandle->GetImageWidth();
-        hRef = imgResHandle->GetImageHeight();
-
-        // Check if we need to swap out old textures to make room.
-        if(m_maxSize != 0) {
-            U32 imgsize(wRef * hRef);
-            if(imgsize > m_maxSize) {
-                GF_LOG_TRACE_ERR("TextureManager::LoadRectangle()", "Cannot load image! It is bigger than the entire size of the TextureManagers memory budget!");
-                return (tHandle);
-            }
-            while(imgsize + m_currSize > m_maxSize) {
-                UnloadLRUTexture();
-            }
-        }
-
-        // Ensure we have generated enough texture objects.
-        if(m_usedTextureCount >= m_glIdVec.size()) {
-            ResizeTextureVector();
-        }
-
-        GF_CLEAR_GL_ERROR();
-
-        glBindTexture(GL_TEXTURE_RECTANGLE, m_glIdVec[m_usedTextureCount]);
-        GF_CHECK_GL_ERROR_TRC("TextureManager::LoadRectangle(): ");
-
-        bool pack = (FindImageTypeFromFile(imgnameRef) == IMAGE_TYPE_TGA);
-
-        glTexParameteri(GL_TEXTURE_RECTANGLE, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-        GF_CHECK_GL_ERROR_TRC("TextureManager::LoadRectangle(): ");
-        glTexParameteri(GL_TEXTURE_RECTANGLE, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-        GF_CHECK_GL_ERROR_TRC("TextureManager::LoadRectangle(): ");
-        glTexParameteri(GL_TEXTURE_RECTANGLE, GL_TEXTURE_WRAP_S, wrapMode);
-        GF_CHECK_GL_ERROR_TRC("TextureManager::LoadRectangle(): ");
-        glTexParameteri(GL_TEXTURE_RECTANGLE, GL_TEXTURE_WRAP_T, wrapMode);
-        GF_CHECK_GL_ERROR_TRC("TextureManager::LoadRectangle(): ");
-
-        if(!LoadCommon2D(GL_TEXTURE_RECTANGLE, 0, imgResHandle->GetImageComponents(), wRef, hRef, \
-                         0, imgResHandle->GetImageFormat(), GL_UNSIGNED_BYTE, const_cast<GLbyte *>(imgResHandle->GetImageBuffer()), pack)) {
-            return (tHandle);
-        }
-
-        // Set the public texture ID.
-        tHandle = m_usedTextureCount;
-
-        GLint unpackAlignment(1);
-        if(!pack) {
-            glGetIntegerv(GL_UNPACK_ALIGNMENT, &unpackAlignment);
-            GF_CHECK_GL_ERROR_TRC("TextureManager::LoadRectangle(): ");
-        }
-
-        // Fill out the data struct for the texture we have loaded onto the GPU.
         TextureElement newTexElement;
-        newTexElement.m_id = *tHandle;
         newTexElement.m_filename.assign(imgnameRef);
-        newTexElement.m_timestamp = static_cast<F32>(g_appPtr->GetCurrTime());
-        newTexElement.m_glTexId = m_glIdVec[*tHandle];
-        newTexElement.m_minFilter = GL_NEAREST;
-        newTexElement.m_magFilter = GL_NEAREST;
+        newTexElement.m_reloadable = true;
         newTexElement.m_wrapMode = wrapMode;
         newTexElement.m_glTarget = GL_TEXTURE_RECTANGLE;
-        newTexElement.m_width = wRef;
-        newTexElement.m_height = hRef;
-        newTexElement.m_imgFormat = imgResHandle->GetImageFormat();
-        newTexElement.m_imgType = GL_UNSIGNED_BYTE;
-        newTexElement.m_unpackAlignment = unpackAlignment;
 
-        // Append the struct to the map.
-        m_elementsMap[*tHandle] = newTexElement;
-        ++m_usedTextureCount;
+        boost::optional<U64> textureSize = CreateImageTexture(newTexElement);
+        if(!textureSize.is_initialized()) {
+            return (tHandle);
+        }
+
+        wRef = newTexElement.m_width;
+        hRef = newTexElement.m_height;
+        tHandle = AddElement(newTexElement, *textureSize);
 
         return (tHandle);
     }
@@ -662,102 +1072,19 @@ namespace GameHalloran {
             return (tHandle);
         }
 
-        GLenum cubeEnum[CUBE_SIDES] = { GL_TEXTURE_CUBE_MAP_POSITIVE_X,
-                                        GL_TEXTURE_CUBE_MAP_NEGATIVE_X,
-                                        GL_TEXTURE_CUBE_MAP_POSITIVE_Y,
-                                        GL_TEXTURE_CUBE_MAP_NEGATIVE_Y,
-                                        GL_TEXTURE_CUBE_MAP_POSITIVE_Z,
-                                        GL_TEXTURE_CUBE_MAP_NEGATIVE_Z
-                                      };
-
-        // Ensure we have generated enough texture objects.
-        if(m_usedTextureCount >= m_glIdVec.size()) {
-            ResizeTextureVector();
-        }
-
-        GF_CLEAR_GL_ERROR();
-
-        glBindTexture(GL_TEXTURE_CUBE_MAP, m_glIdVec[m_usedTextureCount]);
-        GF_CHECK_GL_ERROR_TRC("TextureManager::LoadCubeMap(): ");
-
-        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, m_currMinFilter);
-        GF_CHECK_GL_ERROR_TRC("TextureManager::LoadCubeMap(): ");
-        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, m_currMagFilter);
-        GF_CHECK_GL_ERROR_TRC("TextureManager::LoadCubeMap(): ");
-        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, wrapMode);
-        GF_CHECK_GL_ERROR_TRC("TextureManager::LoadCubeMap(): ");
-        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, wrapMode);
-        GF_CHECK_GL_ERROR_TRC("TextureManager::LoadCubeMap(): ");
-        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, wrapMode);
-        GF_CHECK_GL_ERROR_TRC("TextureManager::LoadCubeMap(): ");
-
-        U32 totalSize(0);
-        boost::shared_ptr<ImageResHandle> imgResArr[6];
-
-        // Initialize cubemap images and calculate total size required.
-        for(U32 i = 0; i < CUBE_SIDES; ++i) {
-            ImageResource imgRes(cubeImgVec[i]);
-            imgResArr[i] = boost::static_pointer_cast<ImageResHandle>(g_appPtr->GetResourceCache()->GetHandle(&imgRes));
-            if(!imgResArr[i] || !imgResArr[i]->VInitialize()) {
-                GF_LOG_TRACE_ERR("TextureManager::LoadCubeMap()", std::string("Failed to retrieve and/or initialize the resource ") + cubeImgVec[i]);
-                return (tHandle);
-            }
-            totalSize += imgResArr[i]->GetImageWidth() * imgResArr[i]->GetImageHeight();
-        }
-
-        if(m_maxSize != 0) {
-            if(totalSize > m_maxSize) {
-                GF_LOG_TRACE_ERR("TextureManager::LoadCubeMap()", "Cannot load image! It is bigger than the entire size of the TextureManagers memory budget!");
-                return (tHandle);
-            }
-            while(totalSize + m_currSize > m_maxSize) {
-                UnloadLRUTexture();
-            }
-        }
-
-        for(U32 i = 0; i < CUBE_SIDES; ++i) {
-            bool pack = (FindImageTypeFromFile(cubeImgVec[i]) == IMAGE_TYPE_TGA);
-            if(!LoadCommon2D(cubeEnum[i], 0, imgResArr[i]->GetImageComponents(), imgResArr[i]->GetImageWidth(), imgResArr[i]->GetImageHeight(), \
-                             0, imgResArr[i]->GetImageFormat(), GL_UNSIGNED_BYTE, const_cast<GLbyte *>(imgResArr[i]->GetImageBuffer()), pack)) {
-                return (tHandle);
-            }
-        }
-
-        if(m_currMinFilter >= eBasicMipMap) {
-            glGenerateMipmap(GL_TEXTURE_CUBE_MAP);
-            if(!GF_CHECK_GL_ERROR_TRC("TextureManager::LoadCubeMap(): ")) {
-                return (tHandle);
-            }
-        }
-
-        // Set the public texture ID.
-        tHandle = m_usedTextureCount;
-
-        GLint unpackAlignment(1);
-        if(FindImageTypeFromFile(cubeImgVec[0]) != IMAGE_TYPE_TGA) {
-            glGetIntegerv(GL_UNPACK_ALIGNMENT, &unpackAlignment);
-            GF_CHECK_GL_ERROR_TRC("TextureManager::LoadCubeMap(): ");
-        }
-
-        // Fill out the data struct for the texture we have loaded onto the GPU.
         TextureElement newTexElement;
-        newTexElement.m_id = *tHandle;
         newTexElement.m_filename.assign(concatStr);
-        newTexElement.m_timestamp = static_cast<F32>(g_appPtr->GetCurrTime());
-        newTexElement.m_glTexId = m_glIdVec[*tHandle];
-        newTexElement.m_minFilter = m_currMinFilter;
-        newTexElement.m_magFilter = m_currMagFilter;
+        newTexElement.m_faceNames = cubeImgVec;
+        newTexElement.m_reloadable = true;
         newTexElement.m_wrapMode = wrapMode;
         newTexElement.m_glTarget = GL_TEXTURE_CUBE_MAP;
-        newTexElement.m_width = imgResArr[0]->GetImageWidth();
-        newTexElement.m_height = imgResArr[0]->GetImageHeight();
-        newTexElement.m_imgFormat = imgResArr[0]->GetImageFormat();
-        newTexElement.m_imgType = GL_UNSIGNED_BYTE;
-        newTexElement.m_unpackAlignment = unpackAlignment;
 
-        // Append the struct to the map.
-        m_elementsMap[*tHandle] = newTexElement;
-        ++m_usedTextureCount;
+        boost::optional<U64> textureSize = CreateCubeMapTexture(newTexElement);
+        if(!textureSize.is_initialized()) {
+            return (tHandle);
+        }
+
+        tHandle = AddElement(newTexElement, *textureSize);
 
         return (tHandle);
     }
@@ -776,21 +1103,28 @@ namespace GameHalloran {
             }
         }
 
-        boost::optional<GLuint> textureId = Find(textureHandle, true);
-        if(!textureId.is_initialized()) {
+        ElementMap::const_iterator i = m_elementsMap.find(textureHandle);
+        if(i == m_elementsMap.end()) {
             GF_LOG_TRACE_ERR("TextureManager::Bind()", "The texture with the public ID has not been loaded into the TextureManager");
             return (false);
         }
 
-        if(m_curBindTex == *textureId) {
+        // Mark the texture as recently used, reloading it if it was evicted.
+        if(!m_residency.Touch(textureHandle)) {
+            GF_LOG_TRACE_ERR("TextureManager::Bind()", std::string("Failed to reload the evicted texture ") + ((*i).second).m_filename);
+            return (false);
+        }
+
+        const GLuint textureId(((*i).second).m_glTexId);
+        if(m_curBindTex == textureId) {
             return (true);
         }
 
-        glBindTexture(target, *textureId);
+        glBindTexture(target, textureId);
         if(!GF_CHECK_GL_ERROR_TRC("TextureManager::Bind(): ")) {
             return (false);
         }
-        m_curBindTex = *textureId;
+        m_curBindTex = textureId;
 
         return (true);
     }
@@ -826,6 +1160,11 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     boost::optional<GLuint> TextureManager::GetGLTextureHandle(const TexHandle texturePublicHandle)
     {
+        // The caller is about to use the texture so make sure it is resident.
+        if(!m_residency.Touch(texturePublicHandle)) {
+            return (boost::optional<GLuint>());
+        }
+
         return (Find(texturePublicHandle));
     }
 
@@ -834,30 +1173,89 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     bool TextureManager::FreeAll()
     {
-        GF_CLEAR_GL_ERROR();
-
-        bool glError(false);
-        if(!m_glIdVec.empty()) {
-            glDeleteTextures(static_cast<GLsizei>(m_glIdVec.size()), &m_glIdVec[0]);
-            glError = GF_CHECK_GL_ERROR_TRC("TextureManager::FreeAll(): ");
+        // Waits for any images still being decoded.
+        m_prefetchPtr.reset();
+        m_prefetchHandles.clear();
+        m_prefetchDecoded = false;
+
+        // Delete the unused texture objects and those of the resident textures.
+        std::vector<GLuint> glIds(m_glIdVec);
+        for(ElementMap::const_iterator i = m_elementsMap.begin(), end = m_elementsMap.end(); i != end; ++i) {
+            if(((*i).second).m_glTexId != 0) {
+                glIds.push_back(((*i).second).m_glTexId);
+            }
         }
 
-        if(glError) {
-            return (false);
+        GF_CLEAR_GL_ERROR();
+
+        if(!glIds.empty()) {
+            glDeleteTextures(static_cast<GLsizei>(glIds.size()), &glIds[0]);
+            if(!GF_CHECK_GL_ERROR_TRC("TextureManager::FreeAll(): ")) {
+                return (false);
+            }
         }
 
         m_glIdVec.clear();
         m_elementsMap.clear();
-        m_usedTextureCount = 0;
+        m_residency.Clear();
+        m_nextHandle = 0;
+        m_freeHandles.clear();
         m_currTexLayer = GL_TEXTURE0;
         SetTextureFilterMode(eBasic);
         m_anisotropicLinearLevel = 0.0f;
-        m_currSize = 0;
         m_curBindTex = 9999;
 
         return (true);
     }
 
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool TextureManager::PrefetchTextures(const std::vector<TexHandle> &handlesRef)
+    {
+        if(m_prefetchPtr) {
+            FinishPrefetch();
+        }
+
+        boost::shared_ptr<ImageLoadingPipeline> pipelinePtr(GCC_NEW ImageLoadingPipeline(g_appPtr->GetResourceCache().get(), g_appPtr->GetWorkerThreadPoolPtr()));
+        for(std::vector<TexHandle>::const_iterator i = handlesRef.begin(), end = handlesRef.end(); i != end; ++i) {
+            ElementMap::const_iterator elemIter = m_elementsMap.find(*i);
+            if(elemIter == m_elementsMap.end() || !((*elemIter).second).m_reloadable || m_residency.IsResident(*i)) {
+                continue;
+            }
+
+            const TextureElement &elemRef = (*elemIter).second;
+            if(elemRef.m_glTarget == GL_TEXTURE_CUBE_MAP) {
+                for(std::vector<std::string>::const_iterator j = elemRef.m_faceNames.begin(), jEnd = elemRef.m_faceNames.end(); j != jEnd; ++j) {
+                    pipelinePtr->AddImage(*j);
+                }
+            } else {
+                pipelinePtr->AddImage(elemRef.m_filename);
+            }
+            m_prefetchHandles.push_back(*i);
+        }
+
+        if(m_prefetchHandles.empty() || !pipelinePtr->Start()) {
+            m_prefetchHandles.clear();
+            return (false);
+        }
+
+        m_prefetchPtr = pipelinePtr;
+        m_prefetchDecoded = false;
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void TextureManager::UpdatePrefetch()
+    {
+        if(m_prefetchPtr && (m_prefetchDecoded || m_prefetchPtr->IsDecodeComplete())) {
+            FinishPrefetch();
+        }
+    }
+
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
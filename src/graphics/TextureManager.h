@@ -13,6 +13,7 @@
 // /////////////////////////////////////////////////////////////////
 
 #include <boost/optional.hpp>
+#include <boost/shared_ptr.hpp>
 
 #include <map>
 #include <vector>
@@ -20,6 +21,9 @@
 
 #include "GameBase.h"
 #include "GameException.h"
+#include "TextureCompression.h"
+#include "ImageProcessing.h"
+#include "TextureResidency.h"
 
 // /////////////////////////////////////////////////////////////////
 //
@@ -27,8 +31,8 @@
 // /////////////////////////////////////////////////////////////////
 namespace GameHalloran {
 
-    // A handle to the texture passed out to users of the texture manager.
-    typedef I32 TexHandle;
+    class ImageResHandle;
+    class ImageLoadingPipeline;
 
     // /////////////////////////////////////////////////////////////////
     // @class TextureManager
@@ -41,19 +45,24 @@ namespace GameHalloran {
     // required and cleaning them up on shutdown.
     //
     // It also optionally has functionality for using only a certain
-    // fraction of available GPU memory and swapping textures in and out
-    // to maintain available memory.
-    // It uses a LRU strategy for removing textures when the memory is full
-    // by timestamping texture access and removing the LRU texture(s) from
-    // GPU memory when the texture manager detects an overflow while
-    // loading in a new texture.
+    // amount of GPU memory and swapping textures in and out to stay
+    // within it (see TextureResidency).  The bytes used by each texture,
+    // including its mipmaps, are counted.  When a new texture does not
+    // fit the least recently bound textures loaded from the resource
+    // cache are evicted from the GPU.  Their handles stay valid and they
+    // are reloaded from the resource cache when next bound, or ahead of
+    // time with PrefetchTextures().  Textures created from texels in
+    // memory (Load1D() and LoadRgba2D()) cannot be reloaded so are never
+    // evicted.  Their bytes are reported separately
+    // (TextureResidencyStats::m_unevictableBytes) and an error is logged
+    // when they alone do not fit in the budget.
     //
     // TODO:
     // Check the texture being swapped out when the limit is reached to
     // prevent trashing.  Use a MRU strategy temporarily to avoid this.
     //
     // /////////////////////////////////////////////////////////////////
-    class TextureManager : public NonCopyable {
+    class TextureManager : public NonCopyable, private ITextureResidencyBackend {
     public:
 
         // /////////////////////////////////////////////////////////////////
@@ -93,7 +102,8 @@ namespace GameHalloran {
         struct TextureElement {
             TexHandle m_id;                     ///< The application side ID.
             std::string m_filename;             ///< The filename from where the img was loaded from.
-            F32 m_timestamp;                    ///< Timestamp of the last texture access.
+            std::vector<std::string> m_faceNames;   ///< The images of each face of a cube map.
+            bool m_reloadable;                  ///< Was the texture loaded from the resource cache, so can be evicted?
 
             GLuint m_glTexId;                   ///< OpenGL texture ID.
             GLenum m_minFilter;                 ///< Current min filter applied to the texture.
@@ -112,8 +122,9 @@ namespace GameHalloran {
         typedef std::map<TexHandle, TextureElement> ElementMap;
 
         ElementMap m_elementsMap;                                   ///< Map of texture handles known externally to Texture information.
-        std::vector<GLuint> m_glIdVec;                              ///< Striaght vector of OpenGL texture Ids generated on startup and when required.
-        U32 m_usedTextureCount;                                     ///< The number of textures used.
+        std::vector<GLuint> m_glIdVec;                              ///< Unused OpenGL texture Ids generated on startup and when required.
+        TexHandle m_nextHandle;                                     ///< The handle of the next texture loaded when none are free.
+        std::vector<TexHandle> m_freeHandles;                       ///< Handles of unloaded textures, reused before m_nextHandle.
         GLint m_currTexLayer;                                       ///< Cache of the current active texture layer.
         GLint m_maxTexLayers;                                       ///< Cache of the maximum allowed texture layers on this GPU.
         TextureFilterMode m_currTexFilterMode;                      ///< The current texture filter mode.
@@ -122,21 +133,119 @@ namespace GameHalloran {
         F32 m_anisotropicLinearLevel;                               ///< The level of anisotropic filtering to use.  Between 0.0 and 1.0.  Used to linearly interpolate the actual value used.
         GLfloat m_maxAnisotropicValue;                              ///< The maximum anisotropic value the hardware is capable of (if at all).
         U32 m_extendSize;                                           ///< The number of OpenGL texture IDs to generate at a time when we run out of free texture IDs when textures are added.
-        const U32 m_maxSize;                                        ///< The maximum allowable texture memory in bytes the TextureManager has access to on the GPU.
-        U32 m_currSize;                                             ///< Current GPU memory used for textures in bytes.
+        TextureResidency m_residency;                               ///< GPU memory used by the textures and the LRU order for evicting them.
+        boost::shared_ptr<ImageLoadingPipeline> m_prefetchPtr;      ///< Decodes the images of textures being prefetched.
+        std::vector<TexHandle> m_prefetchHandles;                   ///< The textures being prefetched.
+        bool m_prefetchDecoded;                                     ///< Have the prefetched images been decoded?
         GLuint m_curBindTex;                                        ///< Currently binded texture.
+        bool m_cpuMipMaps;                                          ///< Are the mipmaps of 2D textures generated on the CPU?
+        ResampleFilter m_mipMapFilter;                              ///< The filter used to generate mipmaps on the CPU.
+        bool m_gammaCorrectMipMaps;                                 ///< Are mipmaps generated on the CPU filtered in linear space?
 
         // The number of texture objects to generate if we run out of them by default.
         static const U32 DEFAULT_EXTEND_SIZE = 10;
 
         // /////////////////////////////////////////////////////////////////
-        // Called if we have got to the end of our allocated texture vector.
-        // This method will generate 10 new texture objects and extend the
-        // internal texture vector by 10 also.
+        // Called if we have run out of unused texture IDs.  This method
+        // will generate m_extendSize new texture objects.
         //
         // /////////////////////////////////////////////////////////////////
         void ResizeTextureVector();
 
+        // /////////////////////////////////////////////////////////////////
+        // Take an unused OpenGL texture ID, generating more if needed.
+        //
+        // /////////////////////////////////////////////////////////////////
+        boost::optional<GLuint> AcquireGlId();
+
+        // /////////////////////////////////////////////////////////////////
+        // Delete a texture object, freeing its GPU memory.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void DeleteGlId(const GLuint glId);
+
+        // /////////////////////////////////////////////////////////////////
+        // Check a texture fits in the memory budget and evict textures to
+        // make room for it.
+        //
+        // @param size Bytes of GPU memory the texture will use.
+        // @param callerStr Name of the calling method for the log.
+        //
+        // @return bool False if the texture is larger than the budget.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool ReserveMemory(const U64 size, const char *callerStr);
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the bytes of GPU memory an image will use as a texture.
+        //
+        // @param imgRef The initialized image.
+        // @param mipMapped Will mipmaps be created?
+        //
+        // /////////////////////////////////////////////////////////////////
+        U64 GetImageTextureSize(const ImageResHandle &imgRef, const bool mipMapped) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Create the GPU texture of a 2D or rectangle texture element from
+        // its image in the resource cache, filling in the element.  Used
+        // to load and to reload the texture.
+        //
+        // @param elemRef The element, with its filename, target and wrap
+        //                  mode set.
+        //
+        // @return boost::optional<U64> The bytes of GPU memory used or
+        //                              uninitialized on failure.
+        //
+        // /////////////////////////////////////////////////////////////////
+        boost::optional<U64> CreateImageTexture(TextureElement &elemRef);
+
+        // /////////////////////////////////////////////////////////////////
+        // Create the GPU texture of a cube map element from its face images
+        // in the resource cache, filling in the element.  Used to load and
+        // to reload the texture.
+        //
+        // @param elemRef The element, with its face names and wrap mode
+        //                  set.
+        //
+        // @return boost::optional<U64> The bytes of GPU memory used or
+        //                              uninitialized on failure.
+        //
+        // /////////////////////////////////////////////////////////////////
+        boost::optional<U64> CreateCubeMapTexture(TextureElement &elemRef);
+
+        // /////////////////////////////////////////////////////////////////
+        // Add a texture element which has been created on the GPU.
+        //
+        // @return TexHandle The handle of the new texture.
+        //
+        // /////////////////////////////////////////////////////////////////
+        TexHandle AddElement(TextureElement &elemRef, const U64 size);
+
+        // /////////////////////////////////////////////////////////////////
+        // Free the GPU memory of a texture so it can be reloaded later.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual bool VEvict(const TexHandle handle);
+
+        // /////////////////////////////////////////////////////////////////
+        // Reload an evicted texture from the resource cache.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual boost::optional<U64> VReload(const TexHandle handle);
+
+        // /////////////////////////////////////////////////////////////////
+        // Wait for the prefetched images to be decoded.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void WaitForPrefetch();
+
+        // /////////////////////////////////////////////////////////////////
+        // Wait for the prefetched images to be decoded and reload their
+        // textures.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void FinishPrefetch();
+
         // /////////////////////////////////////////////////////////////////
         // Loads a 2D texture.
         //
@@ -162,7 +271,7 @@ namespace GameHalloran {
         // @param type Type of data.
         // @param data Pointer to the data.
         // @param tightlyPack Should we instruct GL to unpack the image
-        //                      data in a 1 byte packed format (for TGA).
+        //                      data in a 1 byte packed format (for TGA, PNG and JPEG).
         //
         // @return bool True if the image was loaded and false if not.
         //
@@ -171,31 +280,61 @@ namespace GameHalloran {
                           const GLint border, const GLenum format, const GLenum type, void *data, const bool tightlyPack = false);
 
         // /////////////////////////////////////////////////////////////////
-        // Find a textures private ID by the texture handle.
+        // Loads every mipmap level of a block compressed image into the
+        // GL_TEXTURE_2D texture currently bound.
         //
-        // @param tHandle Public texture ID.
-        // @param timestampTex Should we apply a timestamp to the texture to
-        //                      imply it is being accessed?
+        // The blocks are uploaded as they are if the GPU supports the
+        // format.  If not they are decompressed on the CPU and uploaded as
+        // GL_RGBA.  Mipmaps are never generated, GL_TEXTURE_MAX_LEVEL is
+        // set to the last level stored in the image.
+        //
+        // @param imgRef The initialized compressed image.
+        //
+        // @return bool True if the image was loaded and false if not.
         //
         // /////////////////////////////////////////////////////////////////
-        boost::optional<GLuint> Find(const TexHandle tHandle, bool timestampTex = false);
+        bool LoadCompressed2D(const ImageResHandle &imgRef);
 
         // /////////////////////////////////////////////////////////////////
-        // Find a textures public ID by the string name used to load the
-        // texture.
+        // Loads an uncompressed image and a mipmap chain generated from it
+        // on the CPU (see GenerateMipChain()) into the GL_TEXTURE_2D
+        // texture currently bound.  The texels are uploaded as GL_RGBA.
+        //
+        // @param imgRef The initialized image.
+        //
+        // @return bool True if the image was loaded and false if not.
         //
         // /////////////////////////////////////////////////////////////////
-        boost::optional<TexHandle> Find(const std::string &imgnameRef) const;
+        bool LoadMipMapped2D(const ImageResHandle &imgRef);
+
+        // /////////////////////////////////////////////////////////////////
+        // Loads 8 bit RGBA texels and a mipmap chain generated from them on
+        // the CPU (see GenerateMipChain()) into the GL_TEXTURE_2D texture
+        // currently bound.
+        //
+        // @param rgbaPtr The texels, rows bottom up.
+        // @param internalFormat The internal format of the texture.
+        //
+        // @return bool True if the image was loaded and false if not.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool LoadMipMappedRgba2D(const U8 *rgbaPtr, const U32 width, const U32 height, const GLint internalFormat);
 
         // /////////////////////////////////////////////////////////////////
-        // Unload the least recently used texture from the GPU.
+        // Find a textures private ID by the texture handle.  The ID is 0 if
+        // the texture has been evicted.
         //
-        // @param U32 The number of bytes freed. 0 if there are no
-        //                      textures loaded or uninitialized if an error
-        //                      occurred.
+        // @param tHandle Public texture ID.
         //
         // /////////////////////////////////////////////////////////////////
-        boost::optional<U32> UnloadLRUTexture();
+        boost::optional<GLuint> Find(const TexHandle tHandle) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Find a textures public ID by the string name used to load the
+        // texture.
+        //
+        // /////////////////////////////////////////////////////////////////
+        boost::optional<TexHandle> Find(const std::string &imgnameRef) const;
 
         // /////////////////////////////////////////////////////////////////
         // Unload the texture with the information supplied from the GPU.
@@ -205,12 +344,10 @@ namespace GameHalloran {
         //
         // @param texIter Iterator pointing to the element to remove.
         //
-        // @param U32 The number of bytes freed. 0 if there are no
-        //                      textures loaded or uninitialized if an error
-        //                      occurred.
+        // @return bool False if an error occurred.
         //
         // /////////////////////////////////////////////////////////////////
-        boost::optional<U32> UnloadTexture(ElementMap::iterator &texIter);
+        bool UnloadTexture(ElementMap::iterator texIter);
 
         // /////////////////////////////////////////////////////////////////
         // Update the texture filters for all managed textures according to
@@ -235,7 +372,7 @@ namespace GameHalloran {
         //                  unlimited memory!
         //
         // /////////////////////////////////////////////////////////////////
-        explicit TextureManager(const U32 expectedNumTextures, const U32 maxSize) throw(GameException &);
+        explicit TextureManager(const U32 expectedNumTextures, const U64 maxSize) throw(GameException &);
 
         // /////////////////////////////////////////////////////////////////
         // Destructor.
@@ -275,6 +412,40 @@ namespace GameHalloran {
 #endif
         };
 
+        // /////////////////////////////////////////////////////////////////
+        // Runtime check to query if the hardware we are running on can
+        // sample a block compressed format directly.  BC1 and BC3 need
+        // GL_EXT_texture_compression_s3tc and BC5 needs OpenGL 3.0 or
+        // GL_ARB_texture_compression_rgtc.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool IsCompressedFormatSupported(const BlockFormat format) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Are the mipmaps of 2D textures generated on the CPU?
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline bool IsCpuMipMaps() const {
+            return (m_cpuMipMaps);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Set whether the mipmaps of 2D textures loaded from now on are
+        // generated on the CPU, instead of by the driver with
+        // glGenerateMipmap().  The CPU can use a better filter and filter
+        // sRGB images in linear space, at the cost of a longer load.
+        //
+        // @param enable Generate the mipmaps on the CPU?
+        // @param filter The filter to use.
+        // @param gammaCorrect Are the images sRGB encoded?
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline void SetCpuMipMaps(const bool enable, const ResampleFilter filter = RESAMPLE_FILTER_KAISER, const bool gammaCorrect = true) {
+            m_cpuMipMaps = enable;
+            m_mipMapFilter = filter;
+            m_gammaCorrectMipMaps = gammaCorrect;
+        };
+
         // /////////////////////////////////////////////////////////////////
         // Get the current anisotropic linear level.  This means the linearly
         // interpolated level between 0.0 and the value of GL_MAX_TEXTURE_MAX_ANISOTROPY_EXT.
@@ -347,11 +518,14 @@ namespace GameHalloran {
         // Notes:
         // - The internal components, format, width and height will be read
         //   from the image.
-        // - If the image file to be read in is a TGA file then the
+        // - If the image file to be read in is not a BMP file then the
         //   GL_UNPACK_ALIGNMENT parameter will be temporarily set to 1.
         // - Mipmaps will be generated automatically if the current filter
-        //   level is Bilinear or higher.
+        //   level is Bilinear or higher, on the CPU if SetCpuMipMaps() is
+        //   enabled (see LoadMipMapped2D()).
         // - The type of data is GL_UNSIGNED_BYTE.
+        // - Block compressed (BCT) images are uploaded with their stored
+        //   mipmaps instead (see LoadCompressed2D()).
         //
         // @param imgnameRef The name of the image to load from the ResourceCache.
         // @param wrapMode The texture wrap mode (default: GL_CLAMP_TO_EDGE).
@@ -362,6 +536,29 @@ namespace GameHalloran {
         // /////////////////////////////////////////////////////////////////
         boost::optional<TexHandle> Load2D(const std::string &imgnameRef, const GLenum wrapMode = GL_CLAMP_TO_EDGE);
 
+        // /////////////////////////////////////////////////////////////////
+        // Loads a 2D texture from 8 bit RGBA texels in memory, such as an
+        // atlas packed at runtime (see TextureAtlasManager::BuildAtlas()).
+        //
+        // Notes:
+        // - Mipmaps are generated as for Load2D().
+        // - The texels are copied, rgbaPtr may be freed on return.
+        //
+        // @param imgnameRef The string ID of the texture for future
+        //                      reference.
+        // @param rgbaPtr The texels, width * height * 4 bytes with the
+        //                      rows bottom up.
+        // @param width The width of the texture.
+        // @param height The height of the texture.
+        // @param wrapMode The texture wrap mode (default: GL_CLAMP_TO_EDGE).
+        //
+        // @return boost::optional<TexHandle> Uninitialized on failure or will
+        //      contain the texture handle (not the GL texture ID!) on success.
+        //
+        // /////////////////////////////////////////////////////////////////
+        boost::optional<TexHandle> LoadRgba2D(const std::string &imgnameRef, const U8 *rgbaPtr, const U32 width, const U32 height, \
+                                              const GLenum wrapMode = GL_CLAMP_TO_EDGE);
+
         // /////////////////////////////////////////////////////////////////
         // Loads a Rectangle texture from the resource cache identified by
         // the image name string.
@@ -369,12 +566,13 @@ namespace GameHalloran {
         // Notes:
         // - The internal components, format, width and height will be read
         //   from the image.
-        // - If the image file to be read in is a TGA file then the
+        // - If the image file to be read in is not a BMP file then the
         //   GL_UNPACK_ALIGNMENT parameter will be temporarily set to 1.
         // - Mipmaps cannot be generated for rectangle textures.
         // - The type of data is GL_UNSIGNED_BYTE.
         // - Only Basic filtering mode is allowed for rectangle textures.
         // - GL_REPEAT and GL_REPEAT_MIRRORED clamp values are not supported.
+        // - Block compressed (BCT) images are not supported.
         //
         // @param imgnameRef The name of the image to load from the ResourceCache.
         // @param wRef The width of the image on success.
@@ -394,11 +592,12 @@ namespace GameHalloran {
         // Notes:
         // - The internal components, format, width and height will be read
         //   from the image.
-        // - If the image file to be read in is a TGA file then the
+        // - If the image file to be read in is not a BMP file then the
         //   GL_UNPACK_ALIGNMENT parameter will be temporarily set to 1.
         // - Mipmaps will be generated automatically if the current filter
         //   level is Bilinear or higher.
         // - The type of data is GL_UNSIGNED_BYTE.
+        // - Block compressed (BCT) images are not supported.
         //
         // @param cubeImgVec A vector of names of the image to load from
         //                      the ResourceCache.
@@ -457,11 +656,84 @@ namespace GameHalloran {
         boost::optional<GLuint> GetGLTextureHandle(const TexHandle textureHandle);
 
         // /////////////////////////////////////////////////////////////////
-        // Manually unload a texture from memory.
+        // Manually unload a texture from memory.  The handle is given to
+        // the next texture loaded so must not be used again.
         //
         // /////////////////////////////////////////////////////////////////
         bool UnloadTexture(const TexHandle textureHandle);
 
+        // /////////////////////////////////////////////////////////////////
+        // Get the maximum GPU memory in bytes the textures may use, 0 for
+        // unlimited.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U64 GetMemoryBudget() const {
+            return (m_residency.GetBudget());
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Set the maximum GPU memory in bytes the textures may use, 0 for
+        // unlimited.  Textures are evicted if they no longer fit.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline void SetMemoryBudget(const U64 budget) {
+            m_residency.SetBudget(budget);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the GPU memory used by the textures and the hit, miss,
+        // eviction and reload counters.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline const TextureResidencyStats &GetResidencyStats() const {
+            return (m_residency.GetStats());
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Zero the residency counters, such as at the start of a frame.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline void ResetResidencyCounters() {
+            m_residency.ResetCounters();
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Is a texture on the GPU, rather than evicted?
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline bool IsResident(const TexHandle textureHandle) const {
+            return (m_residency.IsResident(textureHandle));
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Evict a texture loaded from the resource cache from the GPU.  It
+        // is reloaded when next bound.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline bool EvictTexture(const TexHandle textureHandle) {
+            return (m_residency.Evict(textureHandle));
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Start decoding the images of evicted textures on the worker
+        // threads, such as the textures of the next level, so binding them
+        // does not stall on the decode.  UpdatePrefetch() reloads them
+        // once decoded.  Starting a new prefetch finishes the last one.
+        //
+        // @param handlesRef The textures.  Resident ones are ignored.
+        //
+        // @return bool True if any images are being decoded.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool PrefetchTextures(const std::vector<TexHandle> &handlesRef);
+
+        // /////////////////////////////////////////////////////////////////
+        // Reload the prefetched textures if their images have been
+        // decoded.  Call once a frame on the main thread.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void UpdatePrefetch();
+
         // /////////////////////////////////////////////////////////////////
         // Free all textures from GPU memory.
         //
@@ -0,0 +1,248 @@
+// /////////////////////////////////////////////////////////////////
+// @file TextureResidency.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Implementation of the TextureResidency class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include "TextureResidency.h"
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    TextureResidency::Entry *TextureResidency::GetEntry(const TexHandle handle)
+    {
+        if(handle < 0 || size_t(handle) >= m_entries.size() || !m_entries[handle].m_managed) {
+            return (NULL);
+        }
+
+        return (&m_entries[handle]);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool TextureResidency::EvictEntry(const TexHandle handle, Entry &entryRef)
+    {
+        assert(entryRef.m_resident && entryRef.m_evictable);
+
+        if(!m_backendPtr->VEvict(handle)) {
+            return (false);
+        }
+
+        m_lruList.erase(entryRef.m_lruIter);
+        entryRef.m_lruIter = m_lruList.end();
+        entryRef.m_resident = false;
+        m_stats.m_residentBytes -= entryRef.m_size;
+        --m_stats.m_numberResident;
+        ++m_stats.m_numberEvicted;
+        ++m_stats.m_evictions;
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void TextureResidency::MakeResident(const TexHandle handle, Entry &entryRef, const U64 size)
+    {
+        entryRef.m_size = size;
+        entryRef.m_resident = true;
+        entryRef.m_lruIter = entryRef.m_evictable ? m_lruList.insert(m_lruList.begin(), handle) : m_lruList.end();
+        m_stats.m_residentBytes += size;
+        m_stats.m_peakResidentBytes = std::max(m_stats.m_peakResidentBytes, m_stats.m_residentBytes);
+        if(!entryRef.m_evictable) {
+            m_stats.m_unevictableBytes += size;
+        }
+        ++m_stats.m_numberResident;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    TextureResidency::TextureResidency(ITextureResidencyBackend *backendPtr, const U64 budget)
+        : m_backendPtr(backendPtr)
+        , m_entries()
+        , m_lruList()
+        , m_stats()
+    {
+        assert(backendPtr != NULL);
+        m_stats.m_budget = budget;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void TextureResidency::SetBudget(const U64 budget)
+    {
+        m_stats.m_budget = budget;
+        MakeRoom(0);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool TextureResidency::MakeRoom(const U64 size)
+    {
+        if(m_stats.m_budget == 0) {
+            return (true);
+        }
+
+        // Evicting everything else would not make it fit.
+        if(m_stats.m_unevictableBytes + size > m_stats.m_budget) {
+            return (false);
+        }
+
+        while(m_stats.m_residentBytes + size > m_stats.m_budget) {
+            if(m_lruList.empty()) {
+                return (false);
+            }
+
+            const TexHandle lruHandle = m_lruList.back();
+            if(!EvictEntry(lruHandle, m_entries[lruHandle])) {
+                return (false);
+            }
+        }
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void TextureResidency::Add(const TexHandle handle, const U64 size, const bool evictable)
+    {
+        assert(handle >= 0);
+
+        Remove(handle);
+        if(size_t(handle) >= m_entries.size()) {
+            m_entries.resize(handle + 1);
+        }
+
+        Entry &entryRef = m_entries[handle];
+        entryRef.m_managed = true;
+        entryRef.m_evictable = evictable;
+        MakeResident(handle, entryRef, size);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void TextureResidency::Remove(const TexHandle handle)
+    {
+        Entry *entryPtr = GetEntry(handle);
+        if(!entryPtr) {
+            return;
+        }
+
+        if(entryPtr->m_resident) {
+            if(entryPtr->m_evictable) {
+                m_lruList.erase(entryPtr->m_lruIter);
+            } else {
+                m_stats.m_unevictableBytes -= entryPtr->m_size;
+            }
+            m_stats.m_residentBytes -= entryPtr->m_size;
+            --m_stats.m_numberResident;
+        } else {
+            --m_stats.m_numberEvicted;
+        }
+
+        *entryPtr = Entry();
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void TextureResidency::Clear()
+    {
+        m_entries.clear();
+        m_lruList.clear();
+        m_stats.m_residentBytes = 0;
+        m_stats.m_unevictableBytes = 0;
+        m_stats.m_numberResident = 0;
+        m_stats.m_numberEvicted = 0;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool TextureResidency::Touch(const TexHandle handle)
+    {
+        Entry *entryPtr = GetEntry(handle);
+        if(!entryPtr) {
+            return (false);
+        }
+
+        if(entryPtr->m_resident) {
+            if(entryPtr->m_evictable) {
+                m_lruList.splice(m_lruList.begin(), m_lruList, entryPtr->m_lruIter);
+            }
+            ++m_stats.m_hits;
+            return (true);
+        }
+
+        // Make room for the texture as it was, the reload reports its size now.
+        ++m_stats.m_misses;
+        MakeRoom(entryPtr->m_size);
+        boost::optional<U64> size = m_backendPtr->VReload(handle);
+        if(!size) {
+            ++m_stats.m_failedReloads;
+            return (false);
+        }
+
+        --m_stats.m_numberEvicted;
+        ++m_stats.m_reloads;
+        MakeResident(handle, *entryPtr, *size);
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool TextureResidency::Evict(const TexHandle handle)
+    {
+        Entry *entryPtr = GetEntry(handle);
+        if(!entryPtr || !entryPtr->m_resident || !entryPtr->m_evictable) {
+            return (false);
+        }
+
+        return (EvictEntry(handle, *entryPtr));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool TextureResidency::IsManaged(const TexHandle handle) const
+    {
+        return (handle >= 0 && size_t(handle) < m_entries.size() && m_entries[handle].m_managed);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool TextureResidency::IsResident(const TexHandle handle) const
+    {
+        return (IsManaged(handle) && m_entries[handle].m_resident);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void TextureResidency::ResetCounters()
+    {
+        m_stats.m_peakResidentBytes = m_stats.m_residentBytes;
+        m_stats.m_hits = 0;
+        m_stats.m_misses = 0;
+        m_stats.m_evictions = 0;
+        m_stats.m_reloads = 0;
+        m_stats.m_failedReloads = 0;
+    }
+
+}
@@ -0,0 +1,270 @@
+#pragma once
+#ifndef __GF_TEXTURE_RESIDENCY_H
+#define __GF_TEXTURE_RESIDENCY_H
+
+// /////////////////////////////////////////////////////////////////
+// @file TextureResidency.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header for the TextureResidency class which keeps the textures of
+// the TextureManager within a GPU memory budget.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <list>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "GameBase.h"
+
+namespace GameHalloran {
+
+    // A handle to the texture passed out to users of the texture manager.
+    typedef I32 TexHandle;
+
+    // /////////////////////////////////////////////////////////////////
+    // @class ITextureResidencyBackend
+    // @author PJ O Halloran
+    //
+    // Frees and recreates the GPU memory of textures for a
+    // TextureResidency.  Implemented with OpenGL by the TextureManager
+    // and by a stub that only tracks allocations in the unit tests.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class ITextureResidencyBackend {
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Destructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual ~ITextureResidencyBackend() {};
+
+        // /////////////////////////////////////////////////////////////////
+        // Free the GPU memory of a texture, keeping what is needed to
+        // reload it.
+        //
+        // @return bool False if the memory could not be freed.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual bool VEvict(const TexHandle handle) = 0;
+
+        // /////////////////////////////////////////////////////////////////
+        // Reload an evicted texture, from the resource cache.
+        //
+        // @return boost::optional<U64> The bytes of GPU memory used by the
+        //                              texture or uninitialized on failure.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual boost::optional<U64> VReload(const TexHandle handle) = 0;
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @struct TextureResidencyStats
+    // @author PJ O Halloran
+    //
+    // Memory use and counters of a TextureResidency.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct TextureResidencyStats {
+        U64 m_budget;                           ///< Bytes of GPU memory the textures may use, 0 for unlimited.
+        U64 m_residentBytes;                    ///< Bytes used by the resident textures.
+        U64 m_peakResidentBytes;                ///< Most bytes used at once.
+        U64 m_unevictableBytes;                 ///< Bytes of m_residentBytes used by textures which cannot be evicted.
+        U32 m_numberResident;                   ///< Number of textures on the GPU.
+        U32 m_numberEvicted;                    ///< Number of textures evicted and not yet reloaded.
+        U32 m_hits;                             ///< Uses of a resident texture.
+        U32 m_misses;                           ///< Uses of an evicted texture.
+        U32 m_evictions;                        ///< Textures evicted.
+        U32 m_reloads;                          ///< Textures reloaded.
+        U32 m_failedReloads;                    ///< Reloads which failed.
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        TextureResidencyStats() : m_budget(0), m_residentBytes(0), m_peakResidentBytes(0), m_unevictableBytes(0), m_numberResident(0), m_numberEvicted(0), \
+            m_hits(0), m_misses(0), m_evictions(0), m_reloads(0), m_failedReloads(0) {};
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @class TextureResidency
+    // @author PJ O Halloran
+    //
+    // Tracks the bytes of GPU memory used by each texture and evicts the
+    // least recently used textures to stay within a budget.  An evicted
+    // texture is reloaded by the backend when it is next used.
+    //
+    // Textures are kept in a list ordered by use, so using a texture and
+    // finding the one to evict are O(1).  Textures which cannot be
+    // reloaded (such as ones created from texels in memory) are counted
+    // against the budget but never evicted, and their bytes are also
+    // kept in TextureResidencyStats::m_unevictableBytes.
+    //
+    // Handles are indices into a vector so should be small and dense,
+    // as the TextureManager's are (it reuses the handles of unloaded
+    // textures).
+    //
+    // /////////////////////////////////////////////////////////////////
+    class TextureResidency : public NonCopyable {
+    private:
+
+        typedef std::list<TexHandle> LruList;
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct Entry
+        //
+        // Residency of a single texture.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct Entry {
+            U64 m_size;                         ///< Bytes used when resident.
+            bool m_managed;                     ///< Is the handle in use?
+            bool m_resident;                    ///< Is the texture on the GPU?
+            bool m_evictable;                   ///< Can the texture be evicted?
+            LruList::iterator m_lruIter;        ///< Position in m_lruList if resident and evictable.
+
+            Entry() : m_size(0), m_managed(false), m_resident(false), m_evictable(false), m_lruIter() {};
+        };
+
+        ITextureResidencyBackend *m_backendPtr; ///< Frees and reloads the textures.
+        std::vector<Entry> m_entries;           ///< Entries indexed by texture handle.
+        LruList m_lruList;                      ///< Resident evictable textures, most recently used first.
+        TextureResidencyStats m_stats;          ///< Memory use and counters.
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the entry of a managed texture.
+        //
+        // @return Entry* NULL if the handle is not managed.
+        //
+        // /////////////////////////////////////////////////////////////////
+        Entry *GetEntry(const TexHandle handle);
+
+        // /////////////////////////////////////////////////////////////////
+        // Evict a resident evictable texture.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool EvictEntry(const TexHandle handle, Entry &entryRef);
+
+        // /////////////////////////////////////////////////////////////////
+        // Mark a texture resident and most recently used.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void MakeResident(const TexHandle handle, Entry &entryRef, const U64 size);
+
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // @param backendPtr Frees and reloads the textures.  Must outlive
+        //                      the residency.
+        // @param budget Bytes of GPU memory the textures may use, 0 for
+        //                      unlimited.
+        //
+        // /////////////////////////////////////////////////////////////////
+        TextureResidency(ITextureResidencyBackend *backendPtr, const U64 budget);
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the budget in bytes, 0 for unlimited.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U64 GetBudget() const {
+            return (m_stats.m_budget);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Set the budget, evicting textures if the resident textures no
+        // longer fit.
+        //
+        // @param budget Bytes of GPU memory the textures may use, 0 for
+        //                      unlimited.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void SetBudget(const U64 budget);
+
+        // /////////////////////////////////////////////////////////////////
+        // Evict least recently used textures until a texture of the given
+        // size fits in the budget.  Call before creating a texture.
+        // Nothing is evicted if the texture would not fit beside the
+        // textures which cannot be evicted.
+        //
+        // @return bool False if not enough textures could be evicted.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool MakeRoom(const U64 size);
+
+        // /////////////////////////////////////////////////////////////////
+        // Add a texture that has just been created on the GPU.  It becomes
+        // the most recently used.
+        //
+        // @param handle The texture handle.
+        // @param size Bytes of GPU memory used by the texture.
+        // @param evictable Can the backend reload the texture?
+        //
+        // /////////////////////////////////////////////////////////////////
+        void Add(const TexHandle handle, const U64 size, const bool evictable);
+
+        // /////////////////////////////////////////////////////////////////
+        // Stop tracking a texture that has been deleted.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void Remove(const TexHandle handle);
+
+        // /////////////////////////////////////////////////////////////////
+        // Stop tracking all textures, without evicting them.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void Clear();
+
+        // /////////////////////////////////////////////////////////////////
+        // Record the use of a texture, making it the most recently used.
+        // An evicted texture is reloaded first.
+        //
+        // @return bool False if the handle is not managed or reloading
+        //              failed.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool Touch(const TexHandle handle);
+
+        // /////////////////////////////////////////////////////////////////
+        // Evict a texture now.
+        //
+        // @return bool False if the texture is not resident and evictable
+        //              or the backend failed to free it.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool Evict(const TexHandle handle);
+
+        // /////////////////////////////////////////////////////////////////
+        // Is the texture tracked?
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool IsManaged(const TexHandle handle) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Is the texture on the GPU?
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool IsResident(const TexHandle handle) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the memory use and counters.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline const TextureResidencyStats &GetStats() const {
+            return (m_stats);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Zero the hit, miss, eviction and reload counters and the peak.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void ResetCounters();
+    };
+
+}
+
+#endif
@@ -0,0 +1,281 @@
+// /////////////////////////////////////////////////////////////////
+// @file UniformBlock.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Implementation of the UniformBlock class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstring>
+
+#include "UniformBlock.h"
+
+namespace GameHalloran {
+
+    namespace {
+
+        // std140 aligns arrays, vec3s, vec4s and matrix columns to a vec4.
+        const U32 STD140_VEC4_ALIGNMENT = 16;
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct MemberTypeLayout
+        //
+        // The std140 layout of a member type.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct MemberTypeLayout {
+            U32 m_alignment;                    ///< Base alignment when not in an array.
+            U32 m_size;                         ///< Bytes used by one element.
+            U32 m_columns;                      ///< Number of columns, each aligned to a vec4.
+            U32 m_rows;                         ///< Number of components in a column.
+        };
+
+        const MemberTypeLayout MEMBER_TYPE_LAYOUTS[] = {
+            { 4, 4, 1, 1 },                     // eInt
+            { 4, 4, 1, 1 },                     // eFloat
+            { 8, 8, 1, 2 },                     // eVec2
+            { 16, 12, 1, 3 },                   // eVec3
+            { 16, 16, 1, 4 },                   // eVec4
+            { 16, 48, 3, 3 },                   // eMat3
+            { 16, 64, 4, 4 }                    // eMat4
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Round a value up to a multiple of the alignment.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 AlignUp(const U32 value, const U32 alignment)
+        {
+            return (((value + alignment - 1) / alignment) * alignment);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    UniformBlock::UniformBlock(const std::string &name)
+        : m_name(name)
+        , m_members()
+        , m_data()
+        , m_dirtyBegin(0)
+        , m_dirtyEnd(0)
+        , m_bufferId(0)
+    {
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    UniformBlock::~UniformBlock()
+    {
+        try {
+            Free();
+        } catch(...) {
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 UniformBlock::AddMember(const std::string &name, const MemberType type, const U32 arrayCount)
+    {
+        assert(m_bufferId == 0 && arrayCount > 0);
+
+        const MemberTypeLayout &layout = MEMBER_TYPE_LAYOUTS[type];
+        U32 end = 0;
+        if(!m_members.empty()) {
+            const Member &last = m_members.back();
+            end = last.m_offset + ((last.m_arrayCount > 1) ? (last.m_arrayStride * last.m_arrayCount) : MEMBER_TYPE_LAYOUTS[last.m_type].m_size);
+        }
+
+        Member member;
+        member.m_name = name;
+        member.m_type = type;
+        member.m_arrayCount = arrayCount;
+        if(arrayCount > 1) {
+            member.m_offset = AlignUp(end, AlignUp(layout.m_alignment, STD140_VEC4_ALIGNMENT));
+            member.m_arrayStride = AlignUp(layout.m_size, STD140_VEC4_ALIGNMENT);
+            end = member.m_offset + member.m_arrayStride * arrayCount;
+        } else {
+            member.m_offset = AlignUp(end, layout.m_alignment);
+            member.m_arrayStride = layout.m_size;
+            end = member.m_offset + layout.m_size;
+        }
+        m_members.push_back(member);
+
+        // The whole block is uploaded the first time.
+        m_data.resize(AlignUp(end, STD140_VEC4_ALIGNMENT), 0);
+        m_dirtyBegin = 0;
+        m_dirtyEnd = GetSize();
+
+        return (GetNumberMembers() - 1);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    boost::optional<U32> UniformBlock::FindMember(const std::string &name) const
+    {
+        for(U32 i = 0; i < GetNumberMembers(); ++i) {
+            if(m_members[i].m_name == name) {
+                return (boost::optional<U32>(i));
+            }
+        }
+
+        return (boost::optional<U32>());
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void UniformBlock::Write(const U32 offset, const void *srcPtr, const U32 size)
+    {
+        assert(offset + size <= GetSize());
+
+        if(memcmp(&m_data[offset], srcPtr, size) == 0) {
+            return;
+        }
+
+        memcpy(&m_data[offset], srcPtr, size);
+        if(!IsDirty()) {
+            m_dirtyBegin = offset;
+            m_dirtyEnd = offset + size;
+        } else {
+            m_dirtyBegin = std::min(m_dirtyBegin, offset);
+            m_dirtyEnd = std::max(m_dirtyEnd, offset + size);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void UniformBlock::WriteMember(const U32 member, const void *srcPtr, const U32 arrCount)
+    {
+        assert(member < GetNumberMembers() && srcPtr != NULL);
+
+        const Member &memberRef = m_members[member];
+        assert(arrCount > 0 && arrCount <= memberRef.m_arrayCount);
+
+        const MemberTypeLayout &layout = MEMBER_TYPE_LAYOUTS[memberRef.m_type];
+        const U32 columnSize = layout.m_rows * sizeof(GLfloat);
+        const U8 *srcBytePtr = static_cast<const U8 *>(srcPtr);
+        for(U32 element = 0; element < arrCount; ++element) {
+            const U32 elementOffset = memberRef.m_offset + element * memberRef.m_arrayStride;
+            for(U32 column = 0; column < layout.m_columns; ++column) {
+                Write(elementOffset + column * STD140_VEC4_ALIGNMENT, srcBytePtr, columnSize);
+                srcBytePtr += columnSize;
+            }
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void UniformBlock::SetValue(const U32 member, const GLint value)
+    {
+        assert(member < GetNumberMembers() && m_members[member].m_type == eInt);
+        WriteMember(member, &value, 1);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void UniformBlock::SetValue(const U32 member, const GLfloat value)
+    {
+        assert(member < GetNumberMembers() && m_members[member].m_type == eFloat);
+        WriteMember(member, &value, 1);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void UniformBlock::SetValue(const U32 member, const GLint *arr, const U32 arrCount)
+    {
+        assert(member < GetNumberMembers() && m_members[member].m_type == eInt);
+        WriteMember(member, arr, arrCount);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void UniformBlock::SetValue(const U32 member, const GLfloat *arr, const U32 arrCount)
+    {
+        assert(member < GetNumberMembers() && m_members[member].m_type != eInt);
+        WriteMember(member, arr, arrCount);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool UniformBlock::Upload()
+    {
+        if(m_data.empty() || (m_bufferId != 0 && !IsDirty())) {
+            return (true);
+        }
+
+        GF_CLEAR_GL_ERROR();
+
+        if(m_bufferId == 0) {
+            glGenBuffers(1, &m_bufferId);
+            glBindBuffer(GL_UNIFORM_BUFFER, m_bufferId);
+            glBufferData(GL_UNIFORM_BUFFER, GetSize(), &m_data[0], GL_DYNAMIC_DRAW);
+        } else {
+            glBindBuffer(GL_UNIFORM_BUFFER, m_bufferId);
+            glBufferSubData(GL_UNIFORM_BUFFER, m_dirtyBegin, m_dirtyEnd - m_dirtyBegin, &m_data[m_dirtyBegin]);
+        }
+        m_dirtyBegin = 0;
+        m_dirtyEnd = 0;
+
+        return (GF_CHECK_GL_ERROR_TRC("UniformBlock::Upload(): "));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool UniformBlock::Bind(const GLuint bindingPoint)
+    {
+        if(!Upload()) {
+            return (false);
+        }
+
+        GF_CLEAR_GL_ERROR();
+        glBindBufferBase(GL_UNIFORM_BUFFER, bindingPoint, m_bufferId);
+        return (GF_CHECK_GL_ERROR_TRC("UniformBlock::Bind(): "));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void UniformBlock::Free()
+    {
+        if(m_bufferId != 0) {
+            GF_CLEAR_GL_ERROR();
+            glDeleteBuffers(1, &m_bufferId);
+            GF_CHECK_GL_ERROR_TRC("UniformBlock::Free(): ");
+            m_bufferId = 0;
+
+            // The recreated buffer needs all of the block.
+            m_dirtyBegin = 0;
+            m_dirtyEnd = GetSize();
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool UniformBlock::IsSupported()
+    {
+        GLint major(0), minor(0);
+        glGetIntegerv(GL_MAJOR_VERSION, &major);
+        glGetIntegerv(GL_MINOR_VERSION, &minor);
+
+        // OpenGL 2 contexts do not know the version queries, so clear the error they raise.
+        while(glGetError() != GL_NO_ERROR) {
+        }
+
+        return ((major > 3) || (major == 3 && minor >= 1));
+    }
+
+}
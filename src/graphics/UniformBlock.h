@@ -0,0 +1,246 @@
+#pragma once
+#ifndef __GF_UNIFORM_BLOCK_H
+#define __GF_UNIFORM_BLOCK_H
+
+// /////////////////////////////////////////////////////////////////
+// @file UniformBlock.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header for the UniformBlock class which packs the values of a GLSL
+// uniform block with the std140 layout into one uniform buffer.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "GameBase.h"
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    // @class UniformBlock
+    // @author PJ O Halloran
+    //
+    // A CPU side copy of a std140 uniform block and the uniform buffer
+    // object that backs it.
+    //
+    // The members are added in the order they are declared in the
+    // shader and their offsets are calculated with the std140 rules, so
+    // no queries of the program are needed.  Setting a member only
+    // marks it dirty when its bytes change and Upload() sends the dirty
+    // range to the GPU with one glBufferSubData call.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class UniformBlock : public NonCopyable {
+    public:
+
+        enum MemberType {
+            eInt = 0,                           ///< int or bool.
+            eFloat,
+            eVec2,
+            eVec3,
+            eVec4,
+            eMat3,
+            eMat4
+        };
+
+    private:
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct Member
+        //
+        // A member of the block and its std140 layout.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct Member {
+            std::string m_name;                 ///< Name of the member in the shader.
+            MemberType m_type;                  ///< Type of the member.
+            U32 m_arrayCount;                   ///< Number of array elements, 1 if not an array.
+            U32 m_offset;                       ///< Byte offset of the member in the block.
+            U32 m_arrayStride;                  ///< Bytes between array elements.
+        };
+
+        std::string m_name;                     ///< Name of the block in the shader.
+        std::vector<Member> m_members;          ///< The members, in declaration order.
+        std::vector<U8> m_data;                 ///< The packed block.
+        U32 m_dirtyBegin;                       ///< First byte not yet uploaded.
+        U32 m_dirtyEnd;                         ///< One past the last byte not yet uploaded.
+        GLuint m_bufferId;                      ///< The uniform buffer object, 0 until the first upload.
+
+        // /////////////////////////////////////////////////////////////////
+        // Copy the rows of a member element into the block, extending the
+        // dirty range if the bytes change.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void Write(const U32 offset, const void *srcPtr, const U32 size);
+
+        // /////////////////////////////////////////////////////////////////
+        // Copy the elements of a member into the block.  The source holds
+        // the components of each element tightly packed, with matrices in
+        // column major order.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void WriteMember(const U32 member, const void *srcPtr, const U32 arrCount);
+
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // @param name The name of the block in the shader.
+        //
+        // /////////////////////////////////////////////////////////////////
+        explicit UniformBlock(const std::string &name);
+
+        // /////////////////////////////////////////////////////////////////
+        // Destructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        ~UniformBlock();
+
+        // /////////////////////////////////////////////////////////////////
+        // Append a member to the block.  Members must be added before the
+        // first upload.
+        //
+        // @param name The name of the member.
+        // @param type The type of the member.
+        // @param arrayCount The number of array elements, 1 if not an array.
+        //
+        // @return U32 The index of the member.
+        //
+        // /////////////////////////////////////////////////////////////////
+        U32 AddMember(const std::string &name, const MemberType type, const U32 arrayCount = 1);
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the name of the block.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline const std::string &GetName() const {
+            return (m_name);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of members.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetNumberMembers() const {
+            return (static_cast<U32>(m_members.size()));
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Find a member by name.
+        //
+        // @return boost::optional<U32> The member index or uninitialized if
+        //                              the block has no such member.
+        //
+        // /////////////////////////////////////////////////////////////////
+        boost::optional<U32> FindMember(const std::string &name) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the byte offset of a member.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetOffset(const U32 member) const {
+            return (m_members[member].m_offset);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the bytes between the array elements of a member.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetArrayStride(const U32 member) const {
+            return (m_members[member].m_arrayStride);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the size of the block in bytes.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetSize() const {
+            return (static_cast<U32>(m_data.size()));
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the packed block.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline const U8 *GetData() const {
+            return (m_data.empty() ? NULL : &m_data[0]);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Are there changes not yet uploaded to the GPU?
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline bool IsDirty() const {
+            return (m_dirtyBegin < m_dirtyEnd);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Set the value of an int or bool member.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void SetValue(const U32 member, const GLint value);
+
+        // /////////////////////////////////////////////////////////////////
+        // Set the value of a float member.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void SetValue(const U32 member, const GLfloat value);
+
+        // /////////////////////////////////////////////////////////////////
+        // Set the first arrCount elements of an int member.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void SetValue(const U32 member, const GLint *arr, const U32 arrCount = 1);
+
+        // /////////////////////////////////////////////////////////////////
+        // Set the first arrCount elements of a float, vector or matrix
+        // member from tightly packed components (e.g. 3 floats per vec3,
+        // 9 per mat3).
+        //
+        // /////////////////////////////////////////////////////////////////
+        void SetValue(const U32 member, const GLfloat *arr, const U32 arrCount = 1);
+
+        // /////////////////////////////////////////////////////////////////
+        // Upload the dirty range of the block to the uniform buffer,
+        // creating the buffer on the first call.
+        //
+        // @return bool False on a GL error.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool Upload();
+
+        // /////////////////////////////////////////////////////////////////
+        // Upload any changes and bind the uniform buffer to a binding
+        // point.
+        //
+        // @param bindingPoint The uniform buffer binding point the block
+        //                      of the shader is bound to.
+        //
+        // @return bool False on a GL error.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool Bind(const GLuint bindingPoint);
+
+        // /////////////////////////////////////////////////////////////////
+        // Free the uniform buffer.  The next upload recreates it.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void Free();
+
+        // /////////////////////////////////////////////////////////////////
+        // Does the current GL context support uniform buffer objects
+        // (OpenGL 3.1 or later)?
+        //
+        // /////////////////////////////////////////////////////////////////
+        static bool IsSupported();
+    };
+
+}
+
+#endif
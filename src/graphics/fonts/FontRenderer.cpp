@@ -62,7 +62,7 @@ namespace GameHalloran {
 
     void FontRenderer::Render()
     {
-        m_shader->SetUniform("texture", 0);
+        m_shader->SetUniform("fontTexture", 0);
         m_shader->SetUniform("mvMat", m_stackManager->GetModelViewMatrixStack()->GetMatrix());
         m_shader->SetUniform("projection", m_stackManager->GetProjectionMatrixStack()->GetMatrix());
         m_shader->Activate();
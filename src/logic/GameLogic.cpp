@@ -70,6 +70,7 @@
 #include "GameMain.h"
 #include "NullPhysics.h"
 #include "BulletPhysics.h"
+#include "WorkerThreadPool.h"
 
 using boost::optional;
 using boost::shared_ptr;
@@ -108,7 +109,14 @@ namespace GameHalloran {
                 GF_LOG_TRACE_ERR("BaseGameLogic::CreatePhysicsModule()", "Failed to initialize Bullet as it needs a valid MVP stack manager");
                 return (false);
             }
-            m_pPhysics.reset(GCC_NEW BulletPhysics(stackManagerPtr));
+            I32 numberThreads = 0;                  // Number of threads to step the simulation on.
+            if(!RetrieveAndConvertOption<I32>(m_optionsPtr, string("PhysicsThreads"), GameOptions::PROGRAMMER, numberThreads)) {
+                numberThreads = 0;
+            } else if(numberThreads < 0) {
+                // Leave one processor free for the main thread.
+                numberThreads = I32(WorkerThreadPool::GetNumberProcessors()) - 1;
+            }
+            m_pPhysics.reset(GCC_NEW BulletPhysics(stackManagerPtr, U32(numberThreads)));
             m_physicsDiagnosticMode = GetBulletDiagnosticOptions();
         } else {
             GF_LOG_TRACE_ERR("BaseGameLogic::CreatePhysicsModule()", string("The physics system name is not known: ") + physicsNameStr);
@@ -228,6 +236,12 @@ namespace GameHalloran {
             throw GameException(string("Failed to allocate memory for the logic layers process manager"));
         }
 
+        // Thread safe processes may share the worker threads.
+        bool parallelProcesses = false;
+        if(RetrieveAndConvertOption<bool>(m_optionsPtr, string("ParallelProcesses"), GameOptions::PROGRAMMER, parallelProcesses) && parallelProcesses) {
+            m_pProcessManager->SetWorkerThreadPool(g_appPtr->GetWorkerThreadPoolPtr());
+        }
+
         m_random.Randomize();
 
         if(!CreatePhysicsModule(stackManagerPtr)) {
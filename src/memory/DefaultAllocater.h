@@ -13,9 +13,13 @@
 // ////////////////////////////////////////////////////////////
 
 #include <cstdlib>
+#if defined(_WINDOWS) || defined(WIN32)
+#include <malloc.h>
+#endif
 
 #include "GameTypes.h"
 #include "GameBase.h"
+#include "GameAllocater.h"
 
 namespace GameHalloran {
 
@@ -25,6 +29,9 @@ namespace GameHalloran {
     //
     // Default game allocater.
     //
+    // On windows all blocks come from _aligned_malloc() so blocks from
+    // VAlloc() and VAllocAligned() can both be freed with VDealloc().
+    //
     // ////////////////////////////////////////////////////////////
     class DefaultAllocater : public BaseGameAllocater {
     private:
@@ -52,22 +59,39 @@ namespace GameHalloran {
         //
         // ////////////////////////////////////////////////////////////
         virtual void *VAlloc(const U64 size) {
+#if defined(_WINDOWS) || defined(WIN32)
+            return (_aligned_malloc((size_t)size, sizeof(void *)));
+#else
             return (malloc((size_t)size));
+#endif
         };
 
         // ////////////////////////////////////////////////////////////
-        // TODO (not currently implemented)
-        //
         // Allocate an aligned block of memory.
         //
         // @param size Size of memory block to allocate.
-        // @param alignment The alignment of the block of memory.
+        // @param alignment The alignment of the block of memory (a power
+        //                  of two).
         //
         // @return void* NULL on error.
         //
         // ////////////////////////////////////////////////////////////
         virtual void *VAllocAligned(const U64 size, const U32 alignment) {
-            return (NULL);
+            if(!IsValidAlignment(alignment)) {
+                return (NULL);
+            }
+
+            // Both platform functions need at least pointer alignment.
+            const size_t blockAlignment = (alignment < sizeof(void *)) ? sizeof(void *) : size_t(alignment);
+#if defined(_WINDOWS) || defined(WIN32)
+            return (_aligned_malloc((size_t)size, blockAlignment));
+#else
+            void *ptr = NULL;
+            if(posix_memalign(&ptr, blockAlignment, (size_t)size) != 0) {
+                return (NULL);
+            }
+            return (ptr);
+#endif
         };
 
         // ////////////////////////////////////////////////////////////
@@ -75,7 +99,11 @@ namespace GameHalloran {
         //
         // ////////////////////////////////////////////////////////////
         virtual void VDealloc(void *ptr) {
+#if defined(_WINDOWS) || defined(WIN32)
+            _aligned_free(ptr);
+#else
             free(ptr);
+#endif
         };
 
         // ////////////////////////////////////////////////////////////
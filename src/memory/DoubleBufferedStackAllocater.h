@@ -12,7 +12,7 @@
 // ////////////////////////////////////////////////////////////
 
 #include "GameAllocater.h"
-#include "StackAlocater.h"
+#include "StackAllocater.h"
 
 namespace GameHalloran {
 
@@ -27,11 +27,42 @@ namespace GameHalloran {
     // ////////////////////////////////////////////////////////////
     class DoubleBufferedStackAllocater : public BaseGameAllocater {
     private:
-        U64 m_currStack;
-        StackAllocater m_stacks[2];
+        U64 m_currStack;                    ///< Index of the buffer being allocated from.
+        StackAllocater m_firstStack;        ///< Buffer 0.
+        StackAllocater m_secondStack;       ///< Buffer 1.
+
+        // ////////////////////////////////////////////////////////////
+        // Get the buffer being allocated from.
+        //
+        // ////////////////////////////////////////////////////////////
+        inline StackAllocater &GetCurrentStack() {
+            return ((m_currStack == 0) ? m_firstStack : m_secondStack);
+        };
+        inline const StackAllocater &GetCurrentStack() const {
+            return ((m_currStack == 0) ? m_firstStack : m_secondStack);
+        };
 
     public:
 
+        // ////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // Ensure to check if the buffers were created with IsValid()
+        // after.
+        //
+        // @param stackSize The size of each of the two buffers.
+        //
+        // ////////////////////////////////////////////////////////////
+        explicit DoubleBufferedStackAllocater(const U64 stackSize) : m_currStack(0), m_firstStack(stackSize), m_secondStack(stackSize) {};
+
+        // ////////////////////////////////////////////////////////////
+        // Were both buffers created?
+        //
+        // ////////////////////////////////////////////////////////////
+        inline bool IsValid() const {
+            return (m_firstStack.IsValid() && m_secondStack.IsValid());
+        };
+
         // ////////////////////////////////////////////////////////////
         // Swap to the other buffer. Called at the end of a game loop
         // cycle.
@@ -46,7 +77,7 @@ namespace GameHalloran {
         //
         // ////////////////////////////////////////////////////////////
         inline void ClearCurrentBuffer() {
-            m_stacks[m_currStack].VClear();
+            GetCurrentStack().Clear();
         };
 
         // ////////////////////////////////////////////////////////////
@@ -54,8 +85,8 @@ namespace GameHalloran {
         //
         // ////////////////////////////////////////////////////////////
         inline void ClearAll() {
-            m_stacks[0].VClear();
-            m_stacks[1].VClear();
+            m_firstStack.Clear();
+            m_secondStack.Clear();
         };
 
         // ////////////////////////////////////////////////////////////
@@ -67,7 +98,7 @@ namespace GameHalloran {
         //
         // ////////////////////////////////////////////////////////////
         inline virtual void *VAlloc(const U64 blockSize) {
-            return (m_stacks[m_currStack].VAlloc(blockSize));
+            return (GetCurrentStack().VAlloc(blockSize));
         };
 
         // ////////////////////////////////////////////////////////////
@@ -75,7 +106,7 @@ namespace GameHalloran {
         //
         // ////////////////////////////////////////////////////////////
         U64 GetCurrentBufferMarker() const {
-            return (m_stacks[m_currStack].GetMarker());
+            return (GetCurrentStack().GetMarker());
         };
 
         // ////////////////////////////////////////////////////////////
@@ -83,21 +114,21 @@ namespace GameHalloran {
         //
         // ////////////////////////////////////////////////////////////
         void FreeToCurrentBufferMarker(const U64 marker) {
-            m_stacks[m_currStack].FreeToMarker(marker);
+            GetCurrentStack().FreeToMarker(marker);
         };
 
         // ////////////////////////////////////////////////////////////
-        // (not used)
-        // Allocate an aligned block of memory.
+        // Allocate an aligned block of memory from the current buffer.
         //
         // @param size Size of memory block to allocate.
-        // @param alignment The alignment of the block of memory.
+        // @param alignment The alignment of the block of memory (a power
+        //                  of two).
         //
         // @return void* NULL on error.
         //
         // ////////////////////////////////////////////////////////////
         virtual void *VAllocAligned(const U64 size, const U32 alignment) {
-            return (NULL);
+            return (GetCurrentStack().VAllocAligned(size, alignment));
         };
 
         // ////////////////////////////////////////////////////////////
@@ -105,9 +136,7 @@ namespace GameHalloran {
         // Deallocate a block of memory.
         //
         // ////////////////////////////////////////////////////////////
-        virtual void VDealloc(void *ptr) {
-            return (NULL);
-        };
+        virtual void VDealloc(void *ptr) {};
 
         // ////////////////////////////////////////////////////////////
         // (not used)
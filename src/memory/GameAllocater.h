@@ -16,6 +16,33 @@
 
 namespace GameHalloran {
 
+    // ////////////////////////////////////////////////////////////
+    // Check an alignment passed to VAllocAligned() is a non zero
+    // power of two.
+    //
+    // ////////////////////////////////////////////////////////////
+    inline bool IsValidAlignment(const U32 alignment) {
+        return (alignment != 0 && (alignment & (alignment - 1)) == 0);
+    };
+
+    // ////////////////////////////////////////////////////////////
+    // Round an address up to the next multiple of alignment (which
+    // must be a valid alignment).
+    //
+    // ////////////////////////////////////////////////////////////
+    inline size_t AlignAddressUp(const size_t address, const U32 alignment) {
+        return ((address + (alignment - 1)) & ~size_t(alignment - 1));
+    };
+
+    // ////////////////////////////////////////////////////////////
+    // Round an address down to the previous multiple of alignment
+    // (which must be a valid alignment).
+    //
+    // ////////////////////////////////////////////////////////////
+    inline size_t AlignAddressDown(const size_t address, const U32 alignment) {
+        return (address & ~size_t(alignment - 1));
+    };
+
     // ////////////////////////////////////////////////////////////
     // @class IGameAllocater
     // @author PJ O Halloran
@@ -45,10 +72,12 @@ namespace GameHalloran {
         virtual void *VAlloc(const U64 size) = 0;
 
         // ////////////////////////////////////////////////////////////
-        // Allocate an aligned block of memory.
+        // Allocate an aligned block of memory.  Free it the same way as
+        // a block from VAlloc().
         //
         // @param size Size of memory block to allocate.
-        // @param alignment The alignment of the block of memory.
+        // @param alignment The alignment of the block of memory (a power
+        //                  of two).
         //
         // @return void* NULL on error.
         //
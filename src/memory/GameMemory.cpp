@@ -17,15 +17,33 @@
 
 namespace GameHalloran {
 
+    MemoryManager g_memManObj;
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    SizeClassPoolAllocater &GetGamePoolAllocater()
+    {
+        static SizeClassPoolAllocater poolObj(ePool);
+        return (poolObj);
+    }
+
     // ////////////////////////////////////////////////////////////
     //
     // ////////////////////////////////////////////////////////////
-    void GameMemoryInit()
+    bool GameMemoryInit()
     {
         // Register all required memory allocaters here.
+        SizeClassPoolAllocater &poolRef = GetGamePoolAllocater();
+        if(!poolRef.EnableThreadSafety()) {
+            return (false);
+        }
+        g_memManObj.RegisterAllocater(&poolRef);
 
         // Allow game devs to pass in a function pointer here to set
         // up any custom game specific allocaters here also.
+
+        return (true);
     }
 
     // ////////////////////////////////////////////////////////////
@@ -34,6 +52,9 @@ namespace GameHalloran {
     void GameMemoryShutdown()
     {
         g_memManObj.Clear();
+
+        // The pool stays alive for objects destroyed after shutdown.
+        GetGamePoolAllocater().DisableThreadSafety();
     }
 
     // ////////////////////////////////////////////////////////////
@@ -59,8 +80,9 @@ namespace GameHalloran {
     {
         void *block(NULL);
 
-        if(area < DEFAULT_MAX_MEMORY_ALLOCATERS) {
-            block = g_memManObj.GetAllocater(area)->VAlloc(size);
+        BaseGameAllocater *allocaterPtr = g_memManObj.GetAllocater(area);
+        if(allocaterPtr) {
+            block = allocaterPtr->VAlloc(size);
         } else {
             block = GameDefaultAlloc(size);
         }
@@ -73,8 +95,9 @@ namespace GameHalloran {
     // ////////////////////////////////////////////////////////////
     void GameDealloc(void *ptr, const enum AllocId area)
     {
-        if(area < DEFAULT_MAX_MEMORY_ALLOCATERS) {
-            g_memManObj.GetAllocater(area)->VDealloc(ptr);
+        BaseGameAllocater *allocaterPtr = g_memManObj.GetAllocater(area);
+        if(allocaterPtr) {
+            allocaterPtr->VDealloc(ptr);
         } else {
             GameDefaultDealloc(ptr);
         }
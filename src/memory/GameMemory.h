@@ -14,11 +14,12 @@
 #include "GameTypes.h"
 
 #include "MemoryManager.h"
+#include "SizeClassPoolAllocater.h"
 
 namespace GameHalloran {
 
     // Global memory manager instance.
-    MemoryManager g_memManObj;
+    extern MemoryManager g_memManObj;
 
     // ////////////////////////////////////////////////////////////
     // Area to allocate memory from.
@@ -41,17 +42,31 @@ namespace GameHalloran {
     };
 
     // ////////////////////////////////////////////////////////////
-    // Setup the games memory manager.
+    // Setup the games memory manager.  Registers the games small
+    // object pool as the ePool allocater and makes it thread safe so
+    // must be called after GLFW has been initialised and before any
+    // worker threads are started.
+    //
+    // @return bool False if the pool could not be made thread safe.
     //
     // ////////////////////////////////////////////////////////////
-    void GameMemoryInit();
+    bool GameMemoryInit();
 
     // ////////////////////////////////////////////////////////////
-    // Shutdown the games memory manager.
+    // Shutdown the games memory manager.  Call after all worker
+    // threads have been stopped.
     //
     // ////////////////////////////////////////////////////////////
     void GameMemoryShutdown();
 
+    // ////////////////////////////////////////////////////////////
+    // Get the games small object pool.  It is created on first use
+    // and lives until the program exits so objects allocated from it
+    // (see PoolObject) may be freed at any time.
+    //
+    // ////////////////////////////////////////////////////////////
+    SizeClassPoolAllocater &GetGamePoolAllocater();
+
     // ////////////////////////////////////////////////////////////
     // Games Allocation routine.
     //
@@ -62,7 +62,7 @@ namespace GameHalloran {
         //
         // ////////////////////////////////////////////////////////////
         inline bool RegisterAllocater(BaseGameAllocater *allocaterPtr) {
-            if(NULL != allocaterPtr || allocaterPtr->GetId() > DEFAULT_MAX_MEMORY_ALLOCATERS) {
+            if(NULL == allocaterPtr || allocaterPtr->GetId() >= DEFAULT_MAX_MEMORY_ALLOCATERS) {
                 return (false);
             }
 
@@ -80,7 +80,7 @@ namespace GameHalloran {
         //
         // ////////////////////////////////////////////////////////////
         inline bool UnregisterAllocater(const U32 aid) {
-            if(aid > DEFAULT_MAX_MEMORY_ALLOCATERS) {
+            if(aid >= DEFAULT_MAX_MEMORY_ALLOCATERS) {
                 return (false);
             }
 
@@ -115,7 +115,7 @@ namespace GameHalloran {
         //
         // ////////////////////////////////////////////////////////////
         inline BaseGameAllocater *GetAllocater(const U32 aid) {
-            if(aid > DEFAULT_MAX_MEMORY_ALLOCATERS) {
+            if(aid >= DEFAULT_MAX_MEMORY_ALLOCATERS) {
                 return (NULL);
             }
 
@@ -0,0 +1,111 @@
+// ////////////////////////////////////////////////////////////
+// @file PoolAllocater.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Impl for the PoolAllocater class.
+//
+// ////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+
+#include "PoolAllocater.h"
+
+namespace GameHalloran {
+
+    // Each chunk starts with a pointer to the next chunk.
+    static const U64 POOL_CHUNK_HEADER_SIZE = 16;
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    PoolAllocater::PoolAllocater(const U64 blockSize, const U32 blocksPerChunk, const U32 alignment) : m_blockSize(0), m_alignment(sizeof(void *)), \
+        m_blocksPerChunk(blocksPerChunk), m_freeListPtr(NULL), m_chunkListPtr(NULL), m_numChunks(0), m_numBlocks(0)
+    {
+        if(alignment != 0 && !IsValidAlignment(alignment)) {
+            m_alignment = 0;
+        } else if(alignment > m_alignment) {
+            m_alignment = alignment;
+        }
+
+        if(blockSize != 0 && m_alignment != 0) {
+            // Every free block must be able to hold the free list pointer and keep the next block aligned.
+            m_blockSize = U64(AlignAddressUp(size_t(blockSize), m_alignment));
+        }
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    PoolAllocater::~PoolAllocater()
+    {
+        try {
+            while(m_chunkListPtr) {
+                void *nextChunkPtr = *static_cast<void **>(m_chunkListPtr);
+                free(m_chunkListPtr);
+                m_chunkListPtr = nextChunkPtr;
+            }
+        } catch(...) {}
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    bool PoolAllocater::AllocateChunk()
+    {
+        // Over allocate so the first block can be aligned.
+        unsigned char *chunkPtr = static_cast<unsigned char *>(malloc(size_t(POOL_CHUNK_HEADER_SIZE + (m_alignment - 1) + (m_blockSize * m_blocksPerChunk))));
+        if(!chunkPtr) {
+            return (false);
+        }
+
+        *reinterpret_cast<void **>(chunkPtr) = m_chunkListPtr;
+        m_chunkListPtr = chunkPtr;
+        ++m_numChunks;
+
+        // Thread the new blocks onto the free list, last block first so they are handed out in address order.
+        unsigned char *firstBlockPtr = reinterpret_cast<unsigned char *>(AlignAddressUp(reinterpret_cast<size_t>(chunkPtr + POOL_CHUNK_HEADER_SIZE), m_alignment));
+        for(U32 i = m_blocksPerChunk; i > 0; --i) {
+            unsigned char *blockPtr = firstBlockPtr + ((i - 1) * m_blockSize);
+            *reinterpret_cast<void **>(blockPtr) = m_freeListPtr;
+            m_freeListPtr = blockPtr;
+        }
+
+        return (true);
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void *PoolAllocater::VAlloc(const U64 size)
+    {
+        if(!IsValid() || size > m_blockSize) {
+            return (NULL);
+        }
+
+        if(!m_freeListPtr && !AllocateChunk()) {
+            return (NULL);
+        }
+
+        void *blockPtr = m_freeListPtr;
+        m_freeListPtr = *static_cast<void **>(blockPtr);
+        ++m_numBlocks;
+
+        return (blockPtr);
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void PoolAllocater::VDealloc(void *ptr)
+    {
+        if(!ptr) {
+            return;
+        }
+
+        *static_cast<void **>(ptr) = m_freeListPtr;
+        m_freeListPtr = ptr;
+        --m_numBlocks;
+    }
+
+}
@@ -0,0 +1,181 @@
+#pragma once
+#ifndef _GF_POOL_ALLOCATER_H
+#define _GF_POOL_ALLOCATER_H
+
+// ////////////////////////////////////////////////////////////
+// @file PoolAllocater.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header for the PoolAllocater class.
+//
+// ////////////////////////////////////////////////////////////
+
+#include "GameAllocater.h"
+#include "GameBase.h"
+
+namespace GameHalloran {
+
+    // ////////////////////////////////////////////////////////////
+    // @class PoolAllocater
+    // @author PJ O Halloran
+    //
+    // A pool of fixed size memory blocks.  Allocating and freeing a
+    // block are both O(1) operations which pop/push the block from
+    // a free list threaded through the unused blocks themselves.
+    //
+    // Blocks are carved from chunks which are allocated from the OS
+    // heap on demand.  Chunks are only returned to the OS when the
+    // pool is destroyed.  Every block is aligned to the alignment the
+    // pool was created with.
+    //
+    // Based on Section 5.2 Memory Management from Game Engine
+    // Architecture 1st Edition by Jason Gregory.
+    //
+    // Not thread safe.
+    //
+    // ////////////////////////////////////////////////////////////
+    class PoolAllocater : public BaseGameAllocater {
+    private:
+
+        U64 m_blockSize;                ///< Size of each block in bytes (rounded up to hold a pointer).
+        U32 m_alignment;                ///< Alignment of every block.
+        U32 m_blocksPerChunk;           ///< Number of blocks allocated from the OS at a time.
+        void *m_freeListPtr;            ///< First free block.
+        void *m_chunkListPtr;           ///< First chunk allocated from the OS.
+        U32 m_numChunks;                ///< Number of chunks allocated from the OS.
+        U32 m_numBlocks;                ///< Number of blocks currently allocated from the pool.
+
+        // ////////////////////////////////////////////////////////////
+        // Allocate a new chunk from the OS and add all its blocks to the
+        // free list.
+        //
+        // @return bool False if the OS allocation failed.
+        //
+        // ////////////////////////////////////////////////////////////
+        bool AllocateChunk();
+
+    public:
+
+        // ////////////////////////////////////////////////////////////
+        // Constructor.  No memory is allocated until the first block
+        // is requested.
+        //
+        // @param blockSize Size of the blocks the pool hands out.
+        // @param blocksPerChunk Number of blocks to allocate from the
+        //                          OS each time the pool runs out.
+        // @param alignment Alignment of the blocks (a power of two,
+        //                  at least pointer alignment is used).
+        //
+        // ////////////////////////////////////////////////////////////
+        explicit PoolAllocater(const U64 blockSize, const U32 blocksPerChunk = 64, const U32 alignment = 0);
+
+        // ////////////////////////////////////////////////////////////
+        // Destructor.  Frees all chunks, any blocks still allocated from
+        // the pool become invalid.
+        //
+        // ////////////////////////////////////////////////////////////
+        ~PoolAllocater();
+
+        // ////////////////////////////////////////////////////////////
+        // Check if the pool was created with a valid block size.  If not
+        // all other class methods will fail!
+        //
+        // ////////////////////////////////////////////////////////////
+        inline bool IsValid() const {
+            return (m_blockSize != 0 && m_blocksPerChunk != 0);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Get the size in bytes of the blocks handed out by the pool.
+        //
+        // ////////////////////////////////////////////////////////////
+        inline U64 GetBlockSize() const {
+            return (m_blockSize);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Get the alignment of the blocks handed out by the pool.
+        //
+        // ////////////////////////////////////////////////////////////
+        inline U32 GetAlignment() const {
+            return (m_alignment);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Get the number of blocks currently allocated from the pool.
+        //
+        // ////////////////////////////////////////////////////////////
+        inline U32 GetNumberBlocksAllocated() const {
+            return (m_numBlocks);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Get the number of chunks allocated from the OS.
+        //
+        // ////////////////////////////////////////////////////////////
+        inline U32 GetNumberChunks() const {
+            return (m_numChunks);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Allocate a block of memory.
+        //
+        // @param size Size of memory block to allocate, must not be
+        //              larger than the pools block size.
+        //
+        // @return void* NULL on error.
+        //
+        // ////////////////////////////////////////////////////////////
+        virtual void *VAlloc(const U64 size);
+
+        // ////////////////////////////////////////////////////////////
+        // Allocate an aligned block of memory.  Only succeeds when the
+        // pools block alignment is a multiple of the alignment requested.
+        //
+        // @param size Size of memory block to allocate.
+        // @param alignment The alignment of the block of memory.
+        //
+        // @return void* NULL on error.
+        //
+        // ////////////////////////////////////////////////////////////
+        virtual void *VAllocAligned(const U64 size, const U32 alignment) {
+            if(!IsValidAlignment(alignment) || alignment > m_alignment) {
+                return (NULL);
+            }
+            return (VAlloc(size));
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Return a block of memory to the pool.
+        //
+        // @param ptr A block allocated from this pool or NULL.
+        //
+        // ////////////////////////////////////////////////////////////
+        virtual void VDealloc(void *ptr);
+
+        // ////////////////////////////////////////////////////////////
+        // Run defragmentation on the allocaters memory block (not used).
+        //
+        // ////////////////////////////////////////////////////////////
+        virtual void VDefrag() {};
+
+        // ////////////////////////////////////////////////////////////
+        // (not used)
+        // Run a partial defragmentation on the allocaters memory block.
+        // Useful when you want to defragment the block but want to spread
+        // the workload over a couple of frames.
+        //
+        // @param seconds The maximum number of seconds to run for.
+        //
+        // @return F32 Percentage of memory block left to defragment.
+        //
+        // ////////////////////////////////////////////////////////////
+        virtual F32 VDefrag(const F32 seconds) {
+            return (0.0f);
+        };
+    };
+
+}
+
+#endif
@@ -0,0 +1,80 @@
+#pragma once
+#ifndef _GF_POOL_OBJECT_H
+#define _GF_POOL_OBJECT_H
+
+// ////////////////////////////////////////////////////////////
+// @file PoolObject.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header for the PoolObject class.
+//
+// ////////////////////////////////////////////////////////////
+
+#include <new>
+
+#include "GameBase.h"
+#include "GameMemory.h"
+
+namespace GameHalloran {
+
+    // ////////////////////////////////////////////////////////////
+    // @class PoolObject
+    // @author PJ O Halloran
+    //
+    // Derive from this class to have new and delete of the derived
+    // class allocate from the games small object pool (see
+    // GetGamePoolAllocater()) rather than the OS heap.  Intended for
+    // small objects which are created and destroyed every frame
+    // (events, particles, alpha nodes, etc).
+    //
+    // ////////////////////////////////////////////////////////////
+    class PoolObject {
+    public:
+
+        // ////////////////////////////////////////////////////////////
+        // Allocate an object from the pool.
+        //
+        // ////////////////////////////////////////////////////////////
+        static void *operator new(size_t size) {
+            void *ptr = GetGamePoolAllocater().VAlloc(U64(size));
+            if(!ptr) {
+                throw std::bad_alloc();
+            }
+            return (ptr);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Return an object to the pool.
+        //
+        // ////////////////////////////////////////////////////////////
+        static void operator delete(void *ptr) {
+            GetGamePoolAllocater().VDealloc(ptr);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Placement new/delete (hidden by the class operators otherwise).
+        //
+        // ////////////////////////////////////////////////////////////
+        static void *operator new(size_t size, void *placePtr) {
+            return (placePtr);
+        };
+        static void operator delete(void *ptr, void *placePtr) {};
+
+#if defined(_WINDOWS)
+        // ////////////////////////////////////////////////////////////
+        // Debug heap form used by GCC_NEW on windows.
+        //
+        // ////////////////////////////////////////////////////////////
+        static void *operator new(size_t size, int blockType, const char *fileName, int line) {
+            return (operator new(size));
+        };
+        static void operator delete(void *ptr, int blockType, const char *fileName, int line) {
+            operator delete(ptr);
+        };
+#endif
+    };
+
+}
+
+#endif
@@ -0,0 +1,363 @@
+// ////////////////////////////////////////////////////////////
+// @file SizeClassPoolAllocater.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Impl for the SizeClassPoolAllocater class.
+//
+// ////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+
+#ifdef DEBUG
+#include <cstring>
+#include <cstdio>
+#endif
+
+#include "SizeClassPoolAllocater.h"
+
+namespace GameHalloran {
+
+    // ////////////////////////////////////////////////////////////
+    // Header in front of every block.  Kept at 16 bytes so the
+    // callers memory has the same alignment as the raw block.
+    //
+    // ////////////////////////////////////////////////////////////
+    struct PoolBlockHeader {
+        U32 m_sizeClass;            ///< Size class or LARGE_BLOCK_CLASS.
+        U32 m_size;                 ///< Requested size (DEBUG guard checks only).
+        U32 m_guard;                ///< HEADER_GUARD_VALUE while the block is allocated.
+        U32 m_offset;               ///< Bytes from the raw block to the header (aligned blocks only).
+    };
+
+    static const U64 BLOCK_HEADER_SIZE = sizeof(PoolBlockHeader);
+
+#ifdef DEBUG
+    static const U32 HEADER_GUARD_VALUE = 0xFDFDFDFD;
+    static const U32 FREED_GUARD_VALUE = 0xDDDDDDDD;
+    static const unsigned char TAIL_GUARD_VALUE = 0xFD;
+    static const unsigned char FREE_BLOCK_VALUE = 0xDD;
+    static const U64 TAIL_GUARD_SIZE = 4;
+#else
+    static const U64 TAIL_GUARD_SIZE = 0;
+#endif
+
+    // ////////////////////////////////////////////////////////////
+    // Size of the raw blocks of a size class.
+    //
+    // ////////////////////////////////////////////////////////////
+    static inline U64 GetRawBlockSize(const U32 sizeClass)
+    {
+        return (BLOCK_HEADER_SIZE + (U64(sizeClass) + 1) * SizeClassPoolAllocater::SIZE_CLASS_GRANULARITY);
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    U32 SizeClassPoolAllocater::GetSizeClass(const U64 size)
+    {
+        const U64 totalSize = size + TAIL_GUARD_SIZE;
+        if(totalSize > MAX_SMALL_BLOCK_SIZE) {
+            return (LARGE_BLOCK_CLASS);
+        }
+
+        return ((totalSize == 0) ? 0 : U32((totalSize - 1) / SIZE_CLASS_GRANULARITY));
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void *SizeClassPoolAllocater::InitBlock(void *rawPtr, const U32 sizeClass, const U64 size, const U32 offset)
+    {
+        if(!rawPtr) {
+            return (NULL);
+        }
+
+        PoolBlockHeader *headerPtr = reinterpret_cast<PoolBlockHeader *>(static_cast<unsigned char *>(rawPtr) + offset);
+        headerPtr->m_sizeClass = sizeClass;
+        headerPtr->m_size = U32(size);
+        headerPtr->m_offset = offset;
+
+        unsigned char *blockPtr = reinterpret_cast<unsigned char *>(headerPtr) + BLOCK_HEADER_SIZE;
+#ifdef DEBUG
+        headerPtr->m_guard = HEADER_GUARD_VALUE;
+        memset(blockPtr + size, TAIL_GUARD_VALUE, size_t(TAIL_GUARD_SIZE));
+#else
+        headerPtr->m_guard = 0;
+#endif
+
+        return (blockPtr);
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void *SizeClassPoolAllocater::ReleaseBlock(void *ptr, U32 &sizeClass)
+    {
+        PoolBlockHeader *headerPtr = reinterpret_cast<PoolBlockHeader *>(static_cast<unsigned char *>(ptr) - BLOCK_HEADER_SIZE);
+        unsigned char *rawPtr = reinterpret_cast<unsigned char *>(headerPtr) - headerPtr->m_offset;
+
+        sizeClass = headerPtr->m_sizeClass;
+        if(sizeClass >= NUMBER_SIZE_CLASSES && sizeClass != LARGE_BLOCK_CLASS) {
+            return (NULL);
+        }
+
+#ifdef DEBUG
+        if(headerPtr->m_guard != HEADER_GUARD_VALUE) {
+            printf("SizeClassPoolAllocater::ReleaseBlock(): Block %p was freed twice or its header was overwritten!\n", ptr);
+            return (NULL);
+        }
+
+        unsigned char *tailPtr = static_cast<unsigned char *>(ptr) + headerPtr->m_size;
+        for(U64 i = 0; i < TAIL_GUARD_SIZE; ++i) {
+            if(tailPtr[i] != TAIL_GUARD_VALUE) {
+                printf("SizeClassPoolAllocater::ReleaseBlock(): Memory past the end of block %p (%u bytes) was overwritten!\n", ptr, headerPtr->m_size);
+                return (NULL);
+            }
+        }
+
+        headerPtr->m_guard = FREED_GUARD_VALUE;
+        memset(ptr, FREE_BLOCK_VALUE, size_t(headerPtr->m_size));
+#endif
+
+        return (rawPtr);
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void SizeClassPoolAllocater::Lock(const U32 sizeClass)
+    {
+        if(m_threadSafe) {
+            glfwLockMutex(m_locks[sizeClass]);
+        }
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void SizeClassPoolAllocater::Unlock(const U32 sizeClass)
+    {
+        if(m_threadSafe) {
+            glfwUnlockMutex(m_locks[sizeClass]);
+        }
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void *SizeClassPoolAllocater::AllocLarge(const U64 size)
+    {
+        void *rawPtr = malloc(size_t(BLOCK_HEADER_SIZE + size + TAIL_GUARD_SIZE));
+        if(!rawPtr) {
+            return (NULL);
+        }
+
+        if(m_threadSafe) {
+            glfwLockMutex(m_largeLock);
+            ++m_numLargeBlocks;
+            glfwUnlockMutex(m_largeLock);
+        } else {
+            ++m_numLargeBlocks;
+        }
+
+        return (rawPtr);
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void SizeClassPoolAllocater::DeallocLarge(void *rawPtr)
+    {
+        free(rawPtr);
+
+        if(m_threadSafe) {
+            glfwLockMutex(m_largeLock);
+            --m_numLargeBlocks;
+            glfwUnlockMutex(m_largeLock);
+        } else {
+            --m_numLargeBlocks;
+        }
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    SizeClassPoolAllocater::SizeClassPoolAllocater(const U32 id, const U32 blocksPerChunk) : BaseGameAllocater(id), m_largeLock(NULL), \
+        m_numLargeBlocks(0), m_threadSafe(false)
+    {
+        for(U32 i = 0; i < NUMBER_SIZE_CLASSES; ++i) {
+            m_pools[i] = GCC_NEW PoolAllocater(GetRawBlockSize(i), blocksPerChunk, SMALL_BLOCK_ALIGNMENT);
+            m_locks[i] = NULL;
+        }
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    SizeClassPoolAllocater::~SizeClassPoolAllocater()
+    {
+        try {
+            DisableThreadSafety();
+            for(U32 i = 0; i < NUMBER_SIZE_CLASSES; ++i) {
+                delete m_pools[i];
+                m_pools[i] = NULL;
+            }
+        } catch(...) {}
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    bool SizeClassPoolAllocater::EnableThreadSafety()
+    {
+        if(m_threadSafe) {
+            return (true);
+        }
+
+        bool result = ((m_largeLock = glfwCreateMutex()) != NULL);
+        for(U32 i = 0; result && i < NUMBER_SIZE_CLASSES; ++i) {
+            result = ((m_locks[i] = glfwCreateMutex()) != NULL);
+        }
+
+        m_threadSafe = true;
+        if(!result) {
+            DisableThreadSafety();
+        }
+
+        return (result);
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void SizeClassPoolAllocater::DisableThreadSafety()
+    {
+        if(!m_threadSafe) {
+            return;
+        }
+
+        for(U32 i = 0; i < NUMBER_SIZE_CLASSES; ++i) {
+            if(m_locks[i]) {
+                glfwDestroyMutex(m_locks[i]);
+                m_locks[i] = NULL;
+            }
+        }
+        if(m_largeLock) {
+            glfwDestroyMutex(m_largeLock);
+            m_largeLock = NULL;
+        }
+
+        m_threadSafe = false;
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    U32 SizeClassPoolAllocater::GetNumberBlocksAllocated(const U32 sizeClass)
+    {
+        if(sizeClass >= NUMBER_SIZE_CLASSES) {
+            return (0);
+        }
+
+        Lock(sizeClass);
+        const U32 numBlocks = m_pools[sizeClass]->GetNumberBlocksAllocated();
+        Unlock(sizeClass);
+
+        return (numBlocks);
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    U32 SizeClassPoolAllocater::GetNumberLargeBlocksAllocated()
+    {
+        if(!m_threadSafe) {
+            return (m_numLargeBlocks);
+        }
+
+        glfwLockMutex(m_largeLock);
+        const U32 numBlocks = m_numLargeBlocks;
+        glfwUnlockMutex(m_largeLock);
+
+        return (numBlocks);
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void *SizeClassPoolAllocater::VAlloc(const U64 size)
+    {
+        const U32 sizeClass = GetSizeClass(size);
+        if(sizeClass == LARGE_BLOCK_CLASS) {
+            return (InitBlock(AllocLarge(size), LARGE_BLOCK_CLASS, size));
+        }
+
+        Lock(sizeClass);
+        void *rawPtr = m_pools[sizeClass]->VAlloc(GetRawBlockSize(sizeClass));
+        Unlock(sizeClass);
+
+        return (InitBlock(rawPtr, sizeClass, size));
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void *SizeClassPoolAllocater::VAllocAligned(const U64 size, const U32 alignment)
+    {
+        if(!IsValidAlignment(alignment)) {
+            return (NULL);
+        }
+
+        // Small blocks are already aligned, malloc only promises pointer alignment.
+        const U32 naturalAlignment = (GetSizeClass(size) == LARGE_BLOCK_CLASS) ? U32(sizeof(void *)) : SMALL_BLOCK_ALIGNMENT;
+        if(alignment <= naturalAlignment) {
+            return (VAlloc(size));
+        }
+
+        // Over allocate and move the header up so the block after it is aligned.
+        const U64 paddedSize = size + alignment - 1;
+        const U32 sizeClass = GetSizeClass(paddedSize);
+        void *rawPtr;
+        if(sizeClass == LARGE_BLOCK_CLASS) {
+            rawPtr = AllocLarge(paddedSize);
+        } else {
+            Lock(sizeClass);
+            rawPtr = m_pools[sizeClass]->VAlloc(GetRawBlockSize(sizeClass));
+            Unlock(sizeClass);
+        }
+        if(!rawPtr) {
+            return (NULL);
+        }
+
+        const size_t rawAddress = reinterpret_cast<size_t>(rawPtr);
+        const size_t blockAddress = AlignAddressUp(rawAddress + size_t(BLOCK_HEADER_SIZE), alignment);
+        return (InitBlock(rawPtr, sizeClass, size, U32(blockAddress - size_t(BLOCK_HEADER_SIZE) - rawAddress)));
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void SizeClassPoolAllocater::VDealloc(void *ptr)
+    {
+        if(!ptr) {
+            return;
+        }
+
+        U32 sizeClass;
+        void *rawPtr = ReleaseBlock(ptr, sizeClass);
+        if(!rawPtr) {
+            return;
+        }
+
+        if(sizeClass == LARGE_BLOCK_CLASS) {
+            DeallocLarge(rawPtr);
+            return;
+        }
+
+        Lock(sizeClass);
+        m_pools[sizeClass]->VDealloc(rawPtr);
+        Unlock(sizeClass);
+    }
+
+}
@@ -0,0 +1,214 @@
+#pragma once
+#ifndef _GF_SIZE_CLASS_POOL_ALLOCATER_H
+#define _GF_SIZE_CLASS_POOL_ALLOCATER_H
+
+// ////////////////////////////////////////////////////////////
+// @file SizeClassPoolAllocater.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header for the SizeClassPoolAllocater class.
+//
+// ////////////////////////////////////////////////////////////
+
+#include "GameAllocater.h"
+#include "GameBase.h"
+#include "PoolAllocater.h"
+
+namespace GameHalloran {
+
+    // ////////////////////////////////////////////////////////////
+    // @class SizeClassPoolAllocater
+    // @author PJ O Halloran
+    //
+    // General purpose small object allocater.  Requests are rounded
+    // up into one of NUMBER_SIZE_CLASSES size classes, each of which
+    // is served by its own PoolAllocater, so allocating and freeing a
+    // block are O(1).  Requests larger than MAX_SMALL_BLOCK_SIZE go
+    // to the OS heap.
+    //
+    // Every block is prefixed with a small header recording its size
+    // class so VDealloc() does not need to be told the block size.
+    // In DEBUG builds the header and the bytes after the block hold
+    // guard values which are checked when the block is freed.
+    //
+    // The allocater is single threaded until EnableThreadSafety() is
+    // called (GLFW must be initialised), after which each size class
+    // is protected by its own mutex.
+    //
+    // ////////////////////////////////////////////////////////////
+    class SizeClassPoolAllocater : public BaseGameAllocater {
+    public:
+
+        static const U32 SIZE_CLASS_GRANULARITY = 16;       ///< Difference in bytes between size classes.
+        static const U32 NUMBER_SIZE_CLASSES = 16;          ///< Number of pooled size classes.
+        static const U32 MAX_SMALL_BLOCK_SIZE = SIZE_CLASS_GRANULARITY * NUMBER_SIZE_CLASSES;   ///< Largest pooled request.
+
+    private:
+
+        static const U32 LARGE_BLOCK_CLASS = 0xFFFFFFFF;    ///< Size class of blocks allocated from the OS heap.
+        static const U32 SMALL_BLOCK_ALIGNMENT = 16;        ///< Alignment of the blocks of every size class.
+
+        PoolAllocater *m_pools[NUMBER_SIZE_CLASSES];        ///< Pool for each size class.
+        GLFWmutex m_locks[NUMBER_SIZE_CLASSES];             ///< Lock for each size class (NULL when not thread safe).
+        GLFWmutex m_largeLock;                              ///< Lock for the large block count.
+        U32 m_numLargeBlocks;                               ///< Number of large blocks currently allocated.
+        bool m_threadSafe;                                  ///< Are the locks in use?
+
+        // ////////////////////////////////////////////////////////////
+        // Get the size class for a request.
+        //
+        // @return U32 The size class or LARGE_BLOCK_CLASS.
+        //
+        // ////////////////////////////////////////////////////////////
+        static U32 GetSizeClass(const U64 size);
+
+        // ////////////////////////////////////////////////////////////
+        // Write the header (and DEBUG guards) of a raw block.
+        //
+        // @param offset Bytes to skip before the header (for aligned
+        //                  blocks).
+        //
+        // @return void* Pointer to the memory handed to the caller.
+        //
+        // ////////////////////////////////////////////////////////////
+        static void *InitBlock(void *rawPtr, const U32 sizeClass, const U64 size, const U32 offset = 0);
+
+        // ////////////////////////////////////////////////////////////
+        // Find the raw block and size class of a block handed out by
+        // InitBlock(), checking the DEBUG guards.
+        //
+        // @param ptr The callers pointer.
+        // @param sizeClass Set to the size class of the block.
+        //
+        // @return void* The raw block or NULL if the block is corrupt.
+        //
+        // ////////////////////////////////////////////////////////////
+        static void *ReleaseBlock(void *ptr, U32 &sizeClass);
+
+        // ////////////////////////////////////////////////////////////
+        // Lock/unlock a size class (no-op when not thread safe).
+        //
+        // ////////////////////////////////////////////////////////////
+        void Lock(const U32 sizeClass);
+        void Unlock(const U32 sizeClass);
+
+        // ////////////////////////////////////////////////////////////
+        // Allocate/free a raw block for a request larger than
+        // MAX_SMALL_BLOCK_SIZE.
+        //
+        // ////////////////////////////////////////////////////////////
+        void *AllocLarge(const U64 size);
+        void DeallocLarge(void *rawPtr);
+
+    public:
+
+        // ////////////////////////////////////////////////////////////
+        // Constructor.  No memory is allocated until the first block
+        // of a size class is requested.
+        //
+        // @param id The allocater ID to register with the MemoryManager.
+        // @param blocksPerChunk Number of blocks each size class
+        //                          allocates from the OS at a time.
+        //
+        // ////////////////////////////////////////////////////////////
+        explicit SizeClassPoolAllocater(const U32 id, const U32 blocksPerChunk = 64);
+
+        // ////////////////////////////////////////////////////////////
+        // Destructor.  Any blocks still allocated become invalid.
+        //
+        // ////////////////////////////////////////////////////////////
+        ~SizeClassPoolAllocater();
+
+        // ////////////////////////////////////////////////////////////
+        // Create the size class locks.  Call before any other thread
+        // uses the allocater.  Requires GLFW to be initialised.
+        //
+        // @return bool False if the locks could not be created.
+        //
+        // ////////////////////////////////////////////////////////////
+        bool EnableThreadSafety();
+
+        // ////////////////////////////////////////////////////////////
+        // Destroy the size class locks.  Call once only one thread
+        // uses the allocater.
+        //
+        // ////////////////////////////////////////////////////////////
+        void DisableThreadSafety();
+
+        // ////////////////////////////////////////////////////////////
+        // Are the size class locks in use?
+        //
+        // ////////////////////////////////////////////////////////////
+        inline bool IsThreadSafe() const {
+            return (m_threadSafe);
+        };
+
+        // ////////////////////////////////////////////////////////////
+        // Get the number of blocks of a size class currently allocated.
+        //
+        // ////////////////////////////////////////////////////////////
+        U32 GetNumberBlocksAllocated(const U32 sizeClass);
+
+        // ////////////////////////////////////////////////////////////
+        // Get the number of blocks allocated from the OS heap.
+        //
+        // ////////////////////////////////////////////////////////////
+        U32 GetNumberLargeBlocksAllocated();
+
+        // ////////////////////////////////////////////////////////////
+        // Allocate a block of memory.
+        //
+        // @param size Size of memory block to allocate.
+        //
+        // @return void* NULL on error.
+        //
+        // ////////////////////////////////////////////////////////////
+        virtual void *VAlloc(const U64 size);
+
+        // ////////////////////////////////////////////////////////////
+        // Allocate an aligned block of memory.  Blocks of every size
+        // class are aligned to 16 bytes, larger alignments are padded.
+        //
+        // @param size Size of memory block to allocate.
+        // @param alignment The alignment of the block of memory (a power
+        //                  of two).
+        //
+        // @return void* NULL on error.
+        //
+        // ////////////////////////////////////////////////////////////
+        virtual void *VAllocAligned(const U64 size, const U32 alignment);
+
+        // ////////////////////////////////////////////////////////////
+        // Free a block of memory.
+        //
+        // @param ptr A block allocated from this allocater or NULL.
+        //
+        // ////////////////////////////////////////////////////////////
+        virtual void VDealloc(void *ptr);
+
+        // ////////////////////////////////////////////////////////////
+        // Run defragmentation on the allocaters memory block (not used).
+        //
+        // ////////////////////////////////////////////////////////////
+        virtual void VDefrag() {};
+
+        // ////////////////////////////////////////////////////////////
+        // (not used)
+        // Run a partial defragmentation on the allocaters memory block.
+        // Useful when you want to defragment the block but want to spread
+        // the workload over a couple of frames.
+        //
+        // @param seconds The maximum number of seconds to run for.
+        //
+        // @return F32 Percentage of memory block left to defragment.
+        //
+        // ////////////////////////////////////////////////////////////
+        virtual F32 VDefrag(const F32 seconds) {
+            return (0.0f);
+        };
+    };
+
+}
+
+#endif
@@ -22,6 +22,13 @@
 
 namespace GameHalloran {
 
+    // Bytes reserved either side of a block for the debug guard values.
+#ifdef DEBUG
+    static const U64 SA_GUARD_SIZE = 4;
+#else
+    static const U64 SA_GUARD_SIZE = 0;
+#endif
+
     // ////////////////////////////////////////////////////////////
     //
     // ////////////////////////////////////////////////////////////
@@ -64,32 +71,38 @@ namespace GameHalloran {
     // ////////////////////////////////////////////////////////////
     void *StackAllocater::VAlloc(const U64 blockSize)
     {
+        return (VAllocAligned(blockSize, 1));
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void *StackAllocater::VAllocAligned(const U64 blockSize, const U32 alignment)
+    {
+        if(!IsValid() || !IsValidAlignment(alignment)) {
+            return (NULL);
+        }
+
+        // Align the block (after the debug start guard) relative to the real address of the stack.
+        const size_t dataAddress = reinterpret_cast<size_t>(m_data);
+        const Marker blockStart = Marker(AlignAddressUp(dataAddress + size_t(m_topMarker + SA_GUARD_SIZE), alignment) - dataAddress);
+
         // Not enough space to allocate the block!
+        if(blockStart > m_endMarker || blockSize + SA_GUARD_SIZE > m_endMarker - blockStart) {
 #ifdef DEBUG
-        if(!IsValid() || m_topMarker + blockSize + 8 > m_endMarker) {
-            printf("StackAllocater::Alloc(): Failed to allocate %u bytes.  Not enough free space!", blockSize);
-#else
-        if(!IsValid() || m_topMarker + blockSize > m_endMarker) {
+            printf("StackAllocater::VAllocAligned(): Failed to allocate %u bytes.  Not enough free space!\n", U32(blockSize));
 #endif
             return (NULL);
         }
 
-        unsigned char *topStack = m_data + m_topMarker;
+        m_topMarker = blockStart + blockSize + SA_GUARD_SIZE;
 
 #ifdef DEBUG
         ++m_numBlocks;
-
-        m_topMarker += blockSize + 8;
-
-        unsigned char *endStack = topStack + blockSize + 1;
-        topStack = reinterpret_cast<unsigned char *>(SA_START_BLOCK_VALUE);
-        topStack += 4;
-        endStack = reinterpret_cast<unsigned char *>(SA_END_BLOCK_VALUE);
-#else
-        m_topMarker += blockSize;
+        WriteGuards(blockStart, blockSize);
 #endif
 
-        return (static_cast<void *>(topStack));
+        return (static_cast<void *>(m_data + blockStart));
     }
 
     // ////////////////////////////////////////////////////////////
@@ -97,34 +110,45 @@ namespace GameHalloran {
     // ////////////////////////////////////////////////////////////
     void *StackAllocater::AllocEnd(const U64 blockSize)
     {
+        return (AllocEndAligned(blockSize, 1));
+    }
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void *StackAllocater::AllocEndAligned(const U64 blockSize, const U32 alignment)
+    {
+        if(!IsValid() || !IsValidAlignment(alignment)) {
+            return (NULL);
+        }
+
         // Not enough space to allocate the block!
+        const U64 minStart = m_topMarker + SA_GUARD_SIZE;
+        if(blockSize + minStart + SA_GUARD_SIZE > m_endMarker) {
 #ifdef DEBUG
-        if(!IsValid() || m_endMarker - blockSize - 8 < m_topMarker) {
-            printf("StackAllocater::AllocEnd(): Failed to allocate %u bytes.  Not enough free space!", blockSize);
-#else
-        if(!IsValid() || m_endMarker - blockSize < m_topMarker) {
+            printf("StackAllocater::AllocEndAligned(): Failed to allocate %u bytes.  Not enough free space!\n", U32(blockSize));
 #endif
             return (NULL);
         }
 
-        unsigned char *topStack = m_data + m_endMarker - blockSize;
-
+        const size_t dataAddress = reinterpret_cast<size_t>(m_data);
+        const size_t blockAddress = AlignAddressDown(dataAddress + size_t(m_endMarker - SA_GUARD_SIZE - blockSize), alignment);
+        if(blockAddress < dataAddress + size_t(minStart)) {
 #ifdef DEBUG
-        topStack -= 8;
-
-        ++m_numBlocks;
+            printf("StackAllocater::AllocEndAligned(): Failed to allocate %u bytes.  Not enough free space!\n", U32(blockSize));
+#endif
+            return (NULL);
+        }
 
-        m_endMarker -= blockSize - 8;
+        const Marker blockStart = Marker(blockAddress - dataAddress);
+        m_endMarker = blockStart - SA_GUARD_SIZE;
 
-        unsigned char *endStack = topStack + blockSize + 1;
-        topStack = reinterpret_cast<unsigned char *>(SA_START_BLOCK_VALUE);
-        topStack += 4;
-        endStack = reinterpret_cast<unsigned char *>(SA_END_BLOCK_VALUE);
-#else
-        m_endMarker -= blockSize;
+#ifdef DEBUG
+        ++m_numBlocks;
+        WriteGuards(blockStart, blockSize);
 #endif
 
-        return (static_cast<void *>(topStack));
+        return (static_cast<void *>(m_data + blockStart));
     }
 
     // ////////////////////////////////////////////////////////////
@@ -137,14 +161,14 @@ namespace GameHalloran {
 #ifdef DEBUG
                 --m_numBlocks;
                 U64 bytesToClear(m_topMarker - marker);
-                memset(m_data + marker, FREE_BLOCK_VALUE, bytesToClear);
+                memset(m_data + marker, FREE_BLOCK_VALUE, size_t(bytesToClear));
 #endif
                 m_topMarker = marker;
-            } else if(marker > m_endMarker) {
+            } else if(marker > m_endMarker && marker <= m_size) {
 #ifdef DEBUG
                 --m_numBlocks;
-                U64 bytesToClear(m_endMarker - marker);
-                memset(m_data + marker, FREE_BLOCK_VALUE, bytesToClear);
+                U64 bytesToClear(marker - m_endMarker);
+                memset(m_data + m_endMarker, FREE_BLOCK_VALUE, size_t(bytesToClear));
 #endif
                 m_endMarker = marker;
             }
@@ -153,20 +177,30 @@ namespace GameHalloran {
 
 #ifdef DEBUG
 
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void StackAllocater::WriteGuards(const Marker blockStart, const U64 blockSize)
+    {
+        const U32 startValue = START_BLOCK_VALUE;
+        const U32 endValue = END_BLOCK_VALUE;
+        memcpy(m_data + blockStart - SA_GUARD_SIZE, &startValue, SA_GUARD_SIZE);
+        memcpy(m_data + blockStart + blockSize, &endValue, SA_GUARD_SIZE);
+    }
+
     // ////////////////////////////////////////////////////////////
     //
     // ////////////////////////////////////////////////////////////
     bool StackAllocater::VerifyBlock(void *block, const U64 blockSize) const
     {
         unsigned char *memBlock = static_cast<unsigned char *>(block);
-        if(!IsValid()\
-                || (!memBlock)\
-                || (memBlock - 1 != reinterpret_cast<unsigned char *>(SA_START_BLOCK_VALUE))\
-                || (memBlock + blockSize != reinterpret_cast<unsigned char *>(SA_END_BLOCK_VALUE))) {
+        if(!IsValid() || !memBlock) {
             return (false);
         }
 
-        return (true);
+        const U32 startValue = START_BLOCK_VALUE;
+        const U32 endValue = END_BLOCK_VALUE;
+        return (memcmp(memBlock - SA_GUARD_SIZE, &startValue, SA_GUARD_SIZE) == 0 && memcmp(memBlock + blockSize, &endValue, SA_GUARD_SIZE) == 0);
     }
 
     // ////////////////////////////////////////////////////////////
@@ -58,6 +58,12 @@ namespace GameHalloran {
         bool FourByteCompare(unsigned char *bytesA, unsigned char *bytesB) const {
             return (bytesA && bytesB && (bytesA[0] == bytesB[0]) && (bytesA[1] == bytesB[1]) && (bytesA[2] == bytesB[2]) && (bytesA[3] == bytesB[3]));
         };
+
+        // ////////////////////////////////////////////////////////////
+        // Write the start and end guard values around a new block.
+        //
+        // ////////////////////////////////////////////////////////////
+        void WriteGuards(const Marker blockStart, const U64 blockSize);
 #endif
 
         unsigned char *m_data;                  ///< Block of data.
@@ -111,19 +117,19 @@ namespace GameHalloran {
         virtual void *VAlloc(const U64 size);
 
         // ////////////////////////////////////////////////////////////
-        // TODO
-        // (currently not used)
-        // Allocate an aligned block of memory.
+        // Allocate an aligned block of memory from the top of the stack.
+        // The padding needed to align the block is part of the
+        // allocation so freeing to a marker taken before the call
+        // releases it too.
         //
         // @param size Size of memory block to allocate.
-        // @param alignment The alignment of the block of memory.
+        // @param alignment The alignment of the block of memory (a power
+        //                  of two).
         //
-        // @return void* NULL on error.
+        // @return void* NULL on error (the stack is left unchanged).
         //
         // ////////////////////////////////////////////////////////////
-        virtual void *VAllocAligned(const U64 size, const U32 alignment) {
-            return (NULL);
-        };
+        virtual void *VAllocAligned(const U64 size, const U32 alignment);
 
         // ////////////////////////////////////////////////////////////
         // Deallocate a block of memory (not used).
@@ -172,6 +178,18 @@ namespace GameHalloran {
         // ////////////////////////////////////////////////////////////
         void *AllocEnd(const U64 blockSize);
 
+        // ////////////////////////////////////////////////////////////
+        // Allocate an aligned block of memory from the end of the stack.
+        //
+        // @param blockSize Size of the block to allocate in bytes.
+        // @param alignment The alignment of the block (a power of two).
+        //
+        // @return A pointer to the beginning of a block of data of
+        //          the size requested or NULL on error.
+        //
+        // ////////////////////////////////////////////////////////////
+        void *AllocEndAligned(const U64 blockSize, const U32 alignment);
+
         // ////////////////////////////////////////////////////////////
         // Get the current marker or top of the stack from the end of
         // the stack.  Won't be valid unless the stack is valid!
@@ -203,7 +221,7 @@ namespace GameHalloran {
         //
         // ////////////////////////////////////////////////////////////
         inline U64 GetAvailableMemory() const {
-            return (m_size - m_topMarker);
+            return (m_endMarker - m_topMarker);
         };
 
 #ifdef DEBUG
@@ -0,0 +1,150 @@
+// /////////////////////////////////////////////////////////////////
+// @file BulletCollisionPairTracker.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Implementation file for the BulletCollisionPairTracker class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <functional>
+
+#include "BulletCollisionPairTracker.h"
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    // Order contacts by their pair of bodies.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static bool ContactLess(const BulletCollisionPairTracker::Contact &lhs, const BulletCollisionPairTracker::Contact &rhs)
+    {
+        const std::less<btCollisionObject const *> less;
+        if(lhs.m_bodyAPtr != rhs.m_bodyAPtr) {
+            return (less(lhs.m_bodyAPtr, rhs.m_bodyAPtr));
+        }
+        return (less(lhs.m_bodyBPtr, rhs.m_bodyBPtr));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // Do two contacts have the same pair of bodies?
+    //
+    // /////////////////////////////////////////////////////////////////
+    static bool ContactSamePair(const BulletCollisionPairTracker::Contact &lhs, const BulletCollisionPairTracker::Contact &rhs)
+    {
+        return (lhs.m_bodyAPtr == rhs.m_bodyAPtr && lhs.m_bodyBPtr == rhs.m_bodyBPtr);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    BulletCollisionPairTracker::BulletCollisionPairTracker()\
+:
+    m_previous()
+    , m_current()
+    , m_added()
+    , m_removed()
+    {
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    BulletCollisionPairTracker::~BulletCollisionPairTracker()
+    {
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void BulletCollisionPairTracker::BeginTick()
+    {
+        m_current.clear();
+        m_added.clear();
+        m_removed.clear();
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void BulletCollisionPairTracker::AddContact(btPersistentManifold const *manifoldPtr)
+    {
+        if(!manifoldPtr) {
+            return;
+        }
+
+        btCollisionObject const * const body0Ptr = static_cast<btCollisionObject const *>(manifoldPtr->getBody0());
+        btCollisionObject const * const body1Ptr = static_cast<btCollisionObject const *>(manifoldPtr->getBody1());
+
+        // always create the pair in a predictable order
+        const bool swapped = std::less<btCollisionObject const *>()(body1Ptr, body0Ptr);
+
+        Contact contact;
+        contact.m_bodyAPtr = swapped ? body1Ptr : body0Ptr;
+        contact.m_bodyBPtr = swapped ? body0Ptr : body1Ptr;
+        contact.m_manifoldPtr = manifoldPtr;
+        m_current.push_back(contact);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void BulletCollisionPairTracker::EndTick()
+    {
+        // A pair can have more than one manifold (e.g. compound shapes), keep the first.
+        std::stable_sort(m_current.begin(), m_current.end(), ContactLess);
+        m_current.erase(std::unique(m_current.begin(), m_current.end(), ContactSamePair), m_current.end());
+
+        // Merge the two sorted ticks to find the pairs in only one of them.
+        ContactVec::const_iterator prev = m_previous.begin(), prevEnd = m_previous.end();
+        ContactVec::const_iterator curr = m_current.begin(), currEnd = m_current.end();
+        while(prev != prevEnd || curr != currEnd) {
+            if(prev == prevEnd || (curr != currEnd && ContactLess(*curr, *prev))) {
+                m_added.push_back(*curr);
+                ++curr;
+            } else if(curr == currEnd || ContactLess(*prev, *curr)) {
+                m_removed.push_back(*prev);
+                m_removed.back().m_manifoldPtr = NULL;
+                ++prev;
+            } else {
+                ++prev;
+                ++curr;
+            }
+        }
+
+        // the current tick becomes the previous tick.  this is the way of all things.
+        m_previous.swap(m_current);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void BulletCollisionPairTracker::RemoveBody(btCollisionObject const *bodyPtr)
+    {
+        m_removed.clear();
+
+        ContactVec::iterator out = m_previous.begin();
+        for(ContactVec::iterator i = m_previous.begin(), end = m_previous.end(); i != end; ++i) {
+            if(i->m_bodyAPtr == bodyPtr || i->m_bodyBPtr == bodyPtr) {
+                m_removed.push_back(*i);
+                m_removed.back().m_manifoldPtr = NULL;
+            } else {
+                *out++ = *i;
+            }
+        }
+        m_previous.erase(out, m_previous.end());
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void BulletCollisionPairTracker::Clear()
+    {
+        m_previous.clear();
+        m_current.clear();
+        m_added.clear();
+        m_removed.clear();
+    }
+
+}
@@ -0,0 +1,137 @@
+#pragma once
+#ifndef __GF_BULLET_COLLISION_PAIR_TRACKER_H
+#define __GF_BULLET_COLLISION_PAIR_TRACKER_H
+
+// /////////////////////////////////////////////////////////////////
+// @file BulletCollisionPairTracker.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header file for the BulletCollisionPairTracker class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include <bullet/btBulletDynamicsCommon.h>
+
+#include "GameBase.h"
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    // @class BulletCollisionPairTracker
+    // @author PJ O Halloran
+    //
+    // Tracks which pairs of bodies are touching from one internal
+    // physics tick to the next so collision begin and end events are
+    // only sent when a pair changes.
+    //
+    // The pairs of a tick are kept in a vector sorted by body address.
+    // At the end of each tick the new pairs are compared with those of
+    // the previous tick in a single merge pass and the two vectors are
+    // swapped, so once the vectors have grown to the number of contacts
+    // in the scene no memory is allocated.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class BulletCollisionPairTracker : private NonCopyable {
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct Contact
+        //
+        // A pair of touching bodies.  m_bodyAPtr is always the body with
+        // the lower address.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct Contact {
+            btCollisionObject const *m_bodyAPtr;        ///< Body with the lower address.
+            btCollisionObject const *m_bodyBPtr;        ///< Body with the higher address.
+            btPersistentManifold const *m_manifoldPtr;  ///< Contact manifold (NULL for pairs which have separated).
+        };
+
+        typedef std::vector<Contact> ContactVec;
+
+    private:
+
+        ContactVec m_previous;                          ///< Sorted pairs of the previous tick.
+        ContactVec m_current;                           ///< Pairs of the tick being built.
+        ContactVec m_added;                             ///< Pairs which started touching in the last tick.
+        ContactVec m_removed;                           ///< Pairs which stopped touching.
+
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        BulletCollisionPairTracker();
+
+        // /////////////////////////////////////////////////////////////////
+        // Destructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        ~BulletCollisionPairTracker();
+
+        // /////////////////////////////////////////////////////////////////
+        // Start collecting the pairs of a new tick.  Clears the added and
+        // removed pairs.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void BeginTick();
+
+        // /////////////////////////////////////////////////////////////////
+        // Add a manifold with contact points to the current tick.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void AddContact(btPersistentManifold const *manifoldPtr);
+
+        // /////////////////////////////////////////////////////////////////
+        // Finish the current tick.  GetAdded() and GetRemoved() then hold
+        // the pairs which changed since the previous tick, both sorted.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void EndTick();
+
+        // /////////////////////////////////////////////////////////////////
+        // Forget the pairs of a body which is about to be removed from the
+        // world.  GetRemoved() then holds the pairs it was part of.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void RemoveBody(btCollisionObject const *bodyPtr);
+
+        // /////////////////////////////////////////////////////////////////
+        // Forget every pair (without reporting them as removed).
+        //
+        // /////////////////////////////////////////////////////////////////
+        void Clear();
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the pairs which started touching in the last tick.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline const ContactVec &GetAdded() const {
+            return (m_added);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the pairs which stopped touching in the last tick or call to
+        // RemoveBody().
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline const ContactVec &GetRemoved() const {
+            return (m_removed);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of pairs touching at the end of the last tick.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetNumberPairs() const {
+            return (static_cast<U32>(m_previous.size()));
+        };
+    };
+
+}
+
+#endif
@@ -42,12 +42,14 @@
 //
 // /////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <string>
 
 #include <boost/optional.hpp>
 #include <boost/lexical_cast.hpp>
 
 #include "BulletPhysics.h"
+#include "BulletQueryBatch.h"
 #include "EventManager.h"
 #include "GameMain.h"
 #include "GameBase.h"
@@ -55,6 +57,12 @@
 
 namespace GameHalloran {
 
+    // Substepping used by BulletPhysics::VOnUpdate().
+    const F32 FINEST_SUBSTEP_SECONDS = 1.0f / 240.0f;       ///< Smallest substep (used for fast shots).
+    const U32 MAX_FINEST_SUBSTEPS = 12;                     ///< Most finest substeps simulated in one frame.
+    const U32 MAX_SUBSTEP_MULTIPLE = 4;                     ///< Largest substep is this many finest substeps (1/60s).
+    const F32 MAX_SUBSTEP_TRAVEL = 0.02f;                   ///< Furthest the fastest body should move in one substep (m).
+
     // /////////////////////////////////////////////////////////////////
     // ***** Useful Bullet to gameframework engine conversion utility functions *****
     // /////////////////////////////////////////////////////////////////
@@ -115,23 +123,15 @@ namespace GameHalloran {
             return;
         }
 
-        if(body0Ptr->getUserPointer() || body1Ptr->getUserPointer()) {
-            // only triggers have non-NULL userPointers
-
+        BulletBodyLink const * const trigger0Ptr = GetTriggerLink(body0Ptr);
+        BulletBodyLink const * const trigger1Ptr = GetTriggerLink(body1Ptr);
+        if(trigger0Ptr || trigger1Ptr) {
             // figure out which actor is the trigger
-            btRigidBody const * triggerBody, * otherBody;
-
-            if(body0Ptr->getUserPointer()) {
-                triggerBody = body0Ptr;
-                otherBody = body1Ptr;
-            } else {
-                otherBody = body0Ptr;
-                triggerBody = body1Ptr;
-            }
+            BulletBodyLink const * const triggerPtr = trigger0Ptr ? trigger0Ptr : trigger1Ptr;
+            btRigidBody const * const otherBody = trigger0Ptr ? body1Ptr : body0Ptr;
 
             // send the trigger event.
-            const I32 triggerId = *(static_cast<I32*>(triggerBody->getUserPointer()));
-            safeQueEvent(IEventDataPtr(GCC_NEW EvtData_PhysTrigger_Enter(triggerId, FindActorID(otherBody))));
+            safeQueEvent(IEventDataPtr(GCC_NEW EvtData_PhysTrigger_Enter(triggerPtr->m_triggerId, FindActorID(otherBody))));
         } else {
             boost::optional<ActorId> const id0 = FindActorID(body0Ptr);
             boost::optional<ActorId> const id1 = FindActorID(body1Ptr);
@@ -193,21 +193,15 @@ namespace GameHalloran {
             return;
         }
 
-        if(body0Ptr->getUserPointer() || body1Ptr->getUserPointer()) {
+        BulletBodyLink const * const trigger0Ptr = GetTriggerLink(body0Ptr);
+        BulletBodyLink const * const trigger1Ptr = GetTriggerLink(body1Ptr);
+        if(trigger0Ptr || trigger1Ptr) {
             // figure out which actor is the trigger
-            btRigidBody const *triggerBody, *otherBody;
-
-            if(body0Ptr->getUserPointer()) {
-                triggerBody = body0Ptr;
-                otherBody = body1Ptr;
-            } else {
-                otherBody = body0Ptr;
-                triggerBody = body1Ptr;
-            }
+            BulletBodyLink const * const triggerPtr = trigger0Ptr ? trigger0Ptr : trigger1Ptr;
+            btRigidBody const * const otherBody = trigger0Ptr ? body1Ptr : body0Ptr;
 
             // send the trigger event.
-            const I32 triggerId = *(static_cast<I32*>(triggerBody->getUserPointer()));
-            safeQueEvent(IEventDataPtr(GCC_NEW EvtData_PhysTrigger_Leave(triggerId, FindActorID(otherBody))));
+            safeQueEvent(IEventDataPtr(GCC_NEW EvtData_PhysTrigger_Leave(triggerPtr->m_triggerId, FindActorID(otherBody))));
         } else {
             const boost::optional<ActorId> id0 = FindActorID(body0Ptr);
             const boost::optional<ActorId> id1 = FindActorID(body1Ptr);
@@ -242,16 +236,18 @@ namespace GameHalloran {
         // Parameter check
         if(!shapePtr || !physicsObject.m_actorId) {
             GF_LOG_TRACE_ERR("BulletPhysics::AddGameActorRigidBody()", "Invalid parameters");
+            ReleaseShape(shapePtr);
             return;
         }
         if(physicsObject.m_bodyType != eRigidBody) {
             GF_LOG_TRACE_ERR("BulletPhysics::AddGameActorRigidBody()", "Cannot add non rigid body using this function");
+            ReleaseShape(shapePtr);
             return;
         }
 
         // actors get one body apiece
         const ActorId actorID = *physicsObject.m_actorId;
-        if(m_actorBodies.find(actorID) != m_actorBodies.end()) {
+        if(m_actorBodies.Contains(actorID)) {
 #if DEBUG
             std::string actorStr;
             try {
@@ -259,6 +255,7 @@ namespace GameHalloran {
             } catch(...) { }
             GF_LOG_TRACE_ERR("BulletPhysics::AddGameActorRigidBody()", "Tried to add another shape for an actor that already has a shape registered, id: " + actorStr);
 #endif
+            ReleaseShape(shapePtr);
             return;
         }
 
@@ -270,7 +267,7 @@ namespace GameHalloran {
         }
 
         // set the initial position of the body from the actor
-        ActorMotionState * const myMotionState = GCC_NEW ActorMotionState(physicsObject.m_objMatrix);
+        ActorMotionState * const myMotionState = GCC_NEW ActorMotionState(physicsObject.m_objMatrix, actorID, &m_movedMotionStates);
 
         btRigidBody::btRigidBodyConstructionInfo rbInfo(physicsObject.m_mass, myMotionState, shapePtr, localInertia);
 
@@ -286,6 +283,13 @@ namespace GameHalloran {
             rigidBodyPtr->setContactProcessingThreshold(0.0f);
         }
 
+        // Fast small bodies (e.g. a ball after a hard shot) can pass through thin objects
+        //  in a single step, sweep a sphere through the step for them instead.
+        if(physicsObject.m_ccdMotionThreshold > 0.0f) {
+            rigidBodyPtr->setCcdMotionThreshold(physicsObject.m_ccdMotionThreshold);
+            rigidBodyPtr->setCcdSweptSphereRadius(physicsObject.m_ccdSweptSphereRadius);
+        }
+
         if(physicsObject.m_objectType == eKinematic) {
             rigidBodyPtr->setCollisionFlags(rigidBodyPtr->getCollisionFlags() | btCollisionObject::CF_KINEMATIC_OBJECT);
             rigidBodyPtr->setActivationState(DISABLE_DEACTIVATION);
@@ -293,19 +297,14 @@ namespace GameHalloran {
 
         // To work around Bullets inconsistant interface we will see if a btDiscreteDynamicsWorld is in use.  If it is we will use the custom groups
         //  defined in PhysicsObjectAttributes for collision filtering.  If not, we just use Bullet defaults.
-        boost::shared_ptr<btDiscreteDynamicsWorld> discreteDynamicsWorldPtr = boost::static_pointer_cast<btDiscreteDynamicsWorld>(m_dynamicsWorld);
-        if(discreteDynamicsWorldPtr) {
-            discreteDynamicsWorldPtr->addRigidBody(rigidBodyPtr, physicsObject.m_collisionGroup, physicsObject.m_collisionMask);
-        } else {
-            m_dynamicsWorld->addRigidBody(rigidBodyPtr);
-        }
+        m_dynamicsWorld->addRigidBody(rigidBodyPtr, physicsObject.m_collisionGroup, physicsObject.m_collisionMask);
 
-        // create the BulletActor
-        boost::shared_ptr<BulletActor> bulletActorPtr(GCC_NEW BulletActor(rigidBodyPtr));
+        // create the BulletActor and point the body at it
+        boost::shared_ptr<BulletActor> bulletActorPtr(GCC_NEW BulletActor(rigidBodyPtr, actorID));
+        rigidBodyPtr->setUserPointer(&bulletActorPtr->m_link);
 
         // add it to the collection to be checked for changes in VSyncVisibleScene
-        m_actorBodies[actorID] = bulletActorPtr;
-        m_rigidBodyToActorId[rigidBodyPtr] = actorID;
+        m_actorBodies.Insert(actorID, bulletActorPtr);
     }
 
     // /////////////////////////////////////////////////////////////////
@@ -323,28 +322,27 @@ namespace GameHalloran {
         m_dynamicsWorld->removeCollisionObject(removeMePtr);
 
         // then remove the pointer from the ongoing contacts list
-        for(CollisionPairs::iterator it = m_previousTickCollisionPairs.begin(); it != m_previousTickCollisionPairs.end();) {
-            CollisionPairs::iterator next = it;
-            ++next;
-
-            if((it->first == removeMePtr) || (it->second == removeMePtr)) {
-                SendCollisionPairRemoveEvent(it->first, it->second);
-                m_previousTickCollisionPairs.erase(it);
-            }
-
-            it = next;
+        m_collisionPairs.RemoveBody(removeMePtr);
+        const BulletCollisionPairTracker::ContactVec &removedPairs = m_collisionPairs.GetRemoved();
+        for(BulletCollisionPairTracker::ContactVec::const_iterator it = removedPairs.begin(), end = removedPairs.end(); it != end; ++it) {
+            SendCollisionPairRemoveEvent(static_cast<btRigidBody const *>(it->m_bodyAPtr), static_cast<btRigidBody const *>(it->m_bodyBPtr));
         }
 
         // if the object is a RigidBody (all of ours are RigidBodies, but it's good to be safe)
         if(btRigidBody * const body = btRigidBody::upcast(removeMePtr)) {
             // delete the components of the object
-            // Created in AddGameActorRigidBody()...
-            delete body->getMotionState();
-            // Created externally or in the VAddShape() interface routines...
-            delete body->getCollisionShape();
-            // Created in VCreateTrigger()...
-            if(body->getUserPointer()) {
-                delete body->getUserPointer();
+            // Created in AddGameActorRigidBody() or VCreateTrigger()...
+            ActorMotionState * const motionStatePtr = static_cast<ActorMotionState *>(body->getMotionState());
+            if(motionStatePtr && motionStatePtr->m_moved) {
+                m_movedMotionStates.erase(std::find(m_movedMotionStates.begin(), m_movedMotionStates.end(), motionStatePtr));
+            }
+            delete motionStatePtr;
+            // Shared through the shape cache or created externally...
+            ReleaseShape(body->getCollisionShape());
+            // Created in VCreateTrigger() (an actor's link belongs to its BulletActor)...
+            if(BulletBodyLink const * const triggerPtr = GetTriggerLink(body)) {
+                m_triggerBodies.Erase(triggerPtr->m_triggerId);
+                delete triggerPtr;
             }
 
             for(I32 ii = body->getNumConstraintRefs() - 1; ii >= 0; --ii) {
@@ -359,14 +357,24 @@ namespace GameHalloran {
         delete removeMePtr;
     }
 
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void BulletPhysics::ReleaseShape(btCollisionShape *shapePtr)
+    {
+        if(shapePtr && !m_shapeCache.Release(shapePtr)) {
+            delete shapePtr;
+        }
+    }
+
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
     btRigidBody *BulletPhysics::FindActorBody(const ActorId id) const
     {
-        boost::shared_ptr<BulletActor> bulletActorPtr = FindBulletActor(id);
+        const boost::shared_ptr<BulletActor> *bulletActorPtr = m_actorBodies.Find(id);
         if(bulletActorPtr) {
-            return (bulletActorPtr->m_rigidBodyPtr);
+            return ((*bulletActorPtr)->m_rigidBodyPtr);
         }
 
         return (NULL);
@@ -377,10 +385,10 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     boost::shared_ptr<BulletPhysics::BulletActor> BulletPhysics::FindBulletActor(const ActorId id) const
     {
-        ActorIDToBulletActorMap::const_iterator found = m_actorBodies.find(id);
+        const boost::shared_ptr<BulletActor> *found = m_actorBodies.Find(id);
 
-        if(found != m_actorBodies.end()) {
-            return (found->second);
+        if(found) {
+            return (*found);
         }
 
         boost::shared_ptr<BulletActor> null;
@@ -398,9 +406,9 @@ namespace GameHalloran {
             return (boost::optional<ActorId>());
         }
 
-        RigidBodyToActorIDMap::const_iterator found = m_rigidBodyToActorId.find(bodyPtr);
-        if(found != m_rigidBodyToActorId.end()) {
-            return (found->second);
+        BulletBodyLink const * const linkPtr = static_cast<BulletBodyLink const *>(bodyPtr->getUserPointer());
+        if(linkPtr && !linkPtr->m_isTrigger) {
+            return (linkPtr->m_actorId);
         }
 
         return (boost::optional<ActorId>());
@@ -409,12 +417,14 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
-    btStridingMeshInterface const *BulletPhysics::FindMeshShape(const ActorId aid) const
+    BulletPhysics::BulletBodyLink const *BulletPhysics::GetTriggerLink(btRigidBody const *bodyPtr)
     {
-        BulletMeshMap::const_iterator found = m_meshMap.find(aid);
-        if(found != m_meshMap.end()) {
-            return (found->second);
+        // Every body added by BulletPhysics has a link in its user pointer.
+        BulletBodyLink const * const linkPtr = static_cast<BulletBodyLink const *>(bodyPtr->getUserPointer());
+        if(linkPtr && linkPtr->m_isTrigger) {
+            return (linkPtr);
         }
+
         return (NULL);
     }
 
@@ -499,7 +509,8 @@ namespace GameHalloran {
 
 
         BulletPhysics * const bulletPhysics = static_cast<BulletPhysics*>(world->getWorldUserInfo());
-        CollisionPairs currentTickCollisionPairs;
+        BulletCollisionPairTracker &collisionPairs = bulletPhysics->m_collisionPairs;
+        collisionPairs.BeginTick();
 
         // look at all existing contacts
         btDispatcher * const dispatcher = world->getDispatcher();
@@ -513,45 +524,31 @@ namespace GameHalloran {
             }
 
             if(manifold->getNumContacts() > 0) {
-                // get the two bodies used in the manifold.  Bullet stores them as void*, so we must cast
-                //  them back to btRigidBody*s.  Manipulating void* pointers is usually a bad
-                //  idea, but we have to work with the environment that we're given.  We know this
-                //  is safe because we only ever add btRigidBodys to the simulation
-                btRigidBody const * const body0 = static_cast<btRigidBody const *>(manifold->getBody0());
-                btRigidBody const * const body1 = static_cast<btRigidBody const *>(manifold->getBody1());
-
-                // always create the pair in a predictable order
-                bool const swapped = body0 > body1;
-
-                btRigidBody const * const sortedBodyA = (swapped ? body1 : body0);
-                btRigidBody const * const sortedBodyB = (swapped ? body0 : body1);
-
-                CollisionPair const thisPair = std::make_pair(sortedBodyA, sortedBodyB);
-                currentTickCollisionPairs.insert(thisPair);
-
-                if(bulletPhysics->m_previousTickCollisionPairs.find(thisPair) == bulletPhysics->m_previousTickCollisionPairs.end()) {
-                    // this is a new contact, which wasn't in our list before.  send an event to the game.
-                    bulletPhysics->SendCollisionPairAddEvent(manifold, body0, body1);
-                }
+                collisionPairs.AddContact(manifold);
             }
         }
 
-        CollisionPairs removedCollisionPairs;
-
-        // use the STL set difference function to find collision pairs that existed during the previous tick but not any more
-        std::set_difference(bulletPhysics->m_previousTickCollisionPairs.begin(), bulletPhysics->m_previousTickCollisionPairs.end(),
-                            currentTickCollisionPairs.begin(), currentTickCollisionPairs.end(),
-                            std::inserter(removedCollisionPairs, removedCollisionPairs.begin()));
+        // compare the pairs with the previous tick (the current tick becomes the previous tick).
+        collisionPairs.EndTick();
+
+        // these are new contacts, which weren't in our list before.  send an event to the game.
+        //   Bullet stores the bodies as void*, so we must cast them back to btRigidBody*s.  We know
+        //   this is safe because we only ever add btRigidBodys to the simulation.
+        const BulletCollisionPairTracker::ContactVec &addedPairs = collisionPairs.GetAdded();
+        for(BulletCollisionPairTracker::ContactVec::const_iterator it = addedPairs.begin(), end = addedPairs.end(); it != end; ++it) {
+            btRigidBody const * const body0 = static_cast<btRigidBody const *>(it->m_manifoldPtr->getBody0());
+            btRigidBody const * const body1 = static_cast<btRigidBody const *>(it->m_manifoldPtr->getBody1());
+            bulletPhysics->SendCollisionPairAddEvent(it->m_manifoldPtr, body0, body1);
+        }
 
-        for(CollisionPairs::const_iterator it = removedCollisionPairs.begin(), end = removedCollisionPairs.end(); it != end; ++it) {
-            btRigidBody const * const body0 = it->first;
-            btRigidBody const * const body1 = it->second;
+        // and collision pairs that existed during the previous tick but not any more
+        const BulletCollisionPairTracker::ContactVec &removedPairs = collisionPairs.GetRemoved();
+        for(BulletCollisionPairTracker::ContactVec::const_iterator it = removedPairs.begin(), end = removedPairs.end(); it != end; ++it) {
+            btRigidBody const * const body0 = static_cast<btRigidBody const *>(it->m_bodyAPtr);
+            btRigidBody const * const body1 = static_cast<btRigidBody const *>(it->m_bodyBPtr);
             bulletPhysics->SendCollisionPairRemoveEvent(body0, body1);
         }
 
-        // the current tick becomes the previous tick.  this is the way of all things.
-        bulletPhysics->m_previousTickCollisionPairs = currentTickCollisionPairs;
-
         //// handle actors that want to turn manually
         //for(ActorIDToBulletActorMap::const_iterator it = bulletPhysics->m_actorBodies.begin(); it != bulletPhysics->m_actorBodies.end(); ++it)
         //{
@@ -580,19 +577,20 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
-    BulletPhysics::BulletPhysics(boost::shared_ptr<ModelViewProjStackManager> mvpStackManagerPtr)\
+    BulletPhysics::BulletPhysics(boost::shared_ptr<ModelViewProjStackManager> mvpStackManagerPtr, const U32 numberThreads)\
 :
-    m_dynamicsWorld()
-    , m_broadphase()
-    , m_dispatcher()
-    , m_solver()
-    , m_collisionConfiguration()
+    m_numberThreads(numberThreads)
+    , m_worldComponentsPtr()
+    , m_dynamicsWorld(NULL)
     , m_debugDrawer()
     , m_actorBodies()
-    , m_rigidBodyToActorId()
-    , m_previousTickCollisionPairs()
+    , m_movedMotionStates()
+    , m_triggerBodies()
+    , m_collisionPairs()
     , m_mvpStackManagerPtr(mvpStackManagerPtr)
-    , m_meshMap()
+    , m_shapeCache()
+    , m_adaptiveSubstepping(true)
+    , m_lastNumberSubsteps(0)
     {
     }
 
@@ -603,22 +601,17 @@ namespace GameHalloran {
     {
         try {
             // delete any physics objects which are still in the world
-            for(I32 index = m_dynamicsWorld->getNumCollisionObjects() - 1; index >= 0; --index) {
-                btCollisionObject * const obj = m_dynamicsWorld->getCollisionObjectArray()[index];
-                RemoveCollisionObject(obj);
+            if(m_dynamicsWorld) {
+                for(I32 index = m_dynamicsWorld->getNumCollisionObjects() - 1; index >= 0; --index) {
+                    btCollisionObject * const obj = m_dynamicsWorld->getCollisionObjectArray()[index];
+                    RemoveCollisionObject(obj);
+                }
             }
 
             // destroy all the BulletActor objects (all shared_ptr so they are cleaned automatically!)
-            m_actorBodies.clear();
+            m_actorBodies.Clear();
 
-            // Clean up any meshes created.
-            for(BulletMeshMap::iterator i = m_meshMap.begin(), end = m_meshMap.end(); i != end; ++i) {
-                if(i->second) {
-                    delete i->second;
-                    i->second = NULL;
-                }
-            }
-            m_meshMap.clear();
+            // The shapes and meshes are deleted by m_shapeCache.
         } catch(...) { }
     }
 
@@ -627,58 +620,35 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     bool BulletPhysics::VInitialize()
     {
-        // VInitialize creates the components that Bullet uses
-        // this controls how Bullet does internal memory management during the collision pass
-        m_collisionConfiguration.reset(GCC_NEW btDefaultCollisionConfiguration());
-        if(!m_collisionConfiguration) {
-            GF_LOG_TRACE_ERR("BulletPhysics::VInitialize()", "Failed to create the btDefaultCollisionConfiguration");
+        // VInitialize creates the components that Bullet uses (the collision configuration,
+        //  dispatcher, broadphase, solver and world), single or multithreaded.
+        m_worldComponentsPtr.reset(GCC_NEW BulletWorldComponents(m_numberThreads));
+        if(!m_worldComponentsPtr || !m_worldComponentsPtr->Initialize()) {
+            GF_LOG_TRACE_ERR("BulletPhysics::VInitialize()", "Failed to create the Bullet dynamics world");
             return (false);
         }
+        m_dynamicsWorld = m_worldComponentsPtr->GetWorld();
 
-        // this manages how Bullet detects precise collisions between pairs of objects
-        m_dispatcher.reset(GCC_NEW btCollisionDispatcher(m_collisionConfiguration.get()));
-        if(!m_dispatcher) {
-            GF_LOG_TRACE_ERR("BulletPhysics::VInitialize()", "Failed to create the btCollisionDispatcher");
-            return (false);
-        }
-
-        // Bullet uses this to quickly (imprecisely) detect collisions between objects.
-        //  Once a possible collision passes the broad phase, it will be passed to the
-        //   slower but more precise narrow-phase collision detection (btCollisionDispatcher).
-        m_broadphase.reset(GCC_NEW btDbvtBroadphase());
-        //m_broadphase.reset(new btAxisSweep3(btVector3(-2.0f, -2.0f, -2.0f), btVector3(2.0f, 2.0f, 2.0f)));
-        if(!m_broadphase) {
-            GF_LOG_TRACE_ERR("BulletPhysics::VInitialize()", "Failed to create the btDbvtBroadphase");
-            return (false);
-        }
-
-        // Manages constraints which apply forces to the physics simulation.  Used
-        //  for e.g. springs, motors.  We don't use any constraints right now.
-        m_solver.reset(GCC_NEW btSequentialImpulseConstraintSolver);
-        if(!m_solver) {
-            GF_LOG_TRACE_ERR("BulletPhysics::VInitialize()", "Failed to create the btSequentialImpulseConstraintSolver");
-            return (false);
+        if(m_worldComponentsPtr->IsMultithreaded()) {
+            std::string threadsStr;
+            try {
+                threadsStr = boost::lexical_cast<std::string, U32>(m_worldComponentsPtr->GetNumberThreads());
+            } catch(...) { }
+            GF_LOG_TRACE_INF("BulletPhysics::VInitialize()", "Stepping the physics simulation on " + threadsStr + " threads");
         }
 
-        // This is the main Bullet interface point.  Pass in all these components to customize its behavior.
-        m_dynamicsWorld.reset(GCC_NEW btDiscreteDynamicsWorld(m_dispatcher.get(),
-                              m_broadphase.get(),
-                              m_solver.get(),
-                              m_collisionConfiguration.get()));
-        if(!m_dynamicsWorld) {
-            GF_LOG_TRACE_ERR("BulletPhysics::VInitialize()", "Failed to create the btDiscreteDynamicsWorld");
-            return (false);
-        }
+        // also set up the functionality for debug drawing (unless we are running headless without
+        //  a MVP stack, e.g. in the replay harness, in which case there is nothing to draw with).
+        if(m_mvpStackManagerPtr) {
+            m_debugDrawer.reset(GCC_NEW BulletPhysicsDebugDrawer(m_mvpStackManagerPtr));
+            if(!m_debugDrawer) {
+                GF_LOG_TRACE_ERR("BulletPhysics::VInitialize()", "Failed to create the BulletPhysicsDebugDrawer");
+                return (false);
+            }
 
-        // also set up the functionality for debug drawing
-        m_debugDrawer.reset(GCC_NEW BulletPhysicsDebugDrawer(m_mvpStackManagerPtr));
-        if(!m_debugDrawer) {
-            GF_LOG_TRACE_ERR("BulletPhysics::VInitialize()", "Failed to create the BulletPhysicsDebugDrawer");
-            return (false);
+            m_dynamicsWorld->setDebugDrawer(m_debugDrawer.get());
         }
 
-        m_dynamicsWorld->setDebugDrawer(m_debugDrawer.get());
-
         // and set the internal tick callback to our own method "BulletInternalTickCallback"
         m_dynamicsWorld->setInternalTickCallback(BulletInternalTickCallback);
         m_dynamicsWorld->setWorldUserInfo(this);
@@ -693,36 +663,20 @@ namespace GameHalloran {
     {
         // Keep physics & graphics in sync
 
-        // check all the existing actor's bodies for changes.
-        //  If there is a change, send the appropriate event for the game system.
-        for(ActorIDToBulletActorMap::const_iterator it = m_actorBodies.begin(); it != m_actorBodies.end(); ++it) {
-            const ActorId id = it->first;
-
-            // get the MotionState.  this object is updated by Bullet.
-            // it's safe to cast the btMotionState to ActorMotionState, because all the bodies in m_actorBodies
-            //   were created through AddGameActorRigidBody()
-            ActorMotionState const * const actorMotionStatePtr = static_cast<ActorMotionState*>(it->second->m_rigidBodyPtr->getMotionState());
-            if(!actorMotionStatePtr) {
-                GF_LOG_TRACE_DEB("BulletPhysics::VSyncVisibleScene()", "Failed to cast to ActorMotionState");
-                continue;
-            }
+        // only the actors whose motion state Bullet has moved since the last sync are in
+        //  m_movedMotionStates (sleeping bodies are never touched).  Send them all in a single event.
+        if(m_movedMotionStates.empty()) {
+            return;
+        }
 
-            boost::shared_ptr<IActor> gameActor = g_appPtr->GetLogicPtr()->VGetActor(id);
-            if(!gameActor) {
-#if DEBUG
-                std::string str;
-                try {
-                    boost::lexical_cast<std::string, ActorId>(id);
-                } catch(...) { }
-                GF_LOG_TRACE_DEB("BulletPhysics::VSyncVisibleScene()", "Failed to retrieve the actor from the Logic Layer, id: " + str);
-#endif
-                continue;
-            }
-            if(gameActor->VGetMat() != actorMotionStatePtr->m_worldToPositionTransform) {
-                // bullet has moved the actor's physics object.  update the actor.
-                safeQueEvent(IEventDataPtr(GCC_NEW EvtData_Move_Actor(id, actorMotionStatePtr->m_worldToPositionTransform)));
-            }
+        boost::shared_ptr<EvtData_Move_Actors> eventPtr(GCC_NEW EvtData_Move_Actors(static_cast<U32>(m_movedMotionStates.size())));
+        for(std::vector<ActorMotionState *>::const_iterator it = m_movedMotionStates.begin(), end = m_movedMotionStates.end(); it != end; ++it) {
+            (*it)->m_moved = false;
+            eventPtr->AddMovement((*it)->m_actorId, (*it)->m_worldToPositionTransform);
         }
+        m_movedMotionStates.clear();
+
+        safeQueEvent(eventPtr);
     }
 
     // /////////////////////////////////////////////////////////////////
@@ -730,7 +684,49 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     void BulletPhysics::VOnUpdate(const F32 deltaSeconds)
     {
-        m_dynamicsWorld->stepSimulation(deltaSeconds, 12, 1.0f / 240.0f);
+        // Step at 1, 2 or 4 times the finest substep.  Keeping to a few substep sizes lets Bullet
+        //  carry the left over time (and interpolate the motion states) from frame to frame.
+        U32 multiple = 1;
+        if(m_adaptiveSubstepping) {
+            F32 fastestSpeed = 0.0f;
+            if(!GetFastestBodySpeed(fastestSpeed)) {
+                // Everything is asleep so nothing can move or tunnel.
+                multiple = MAX_SUBSTEP_MULTIPLE;
+            } else {
+                // Awake bodies resting on each other bounce (making and breaking contacts) with the
+                //  largest substep, so use at most half of it and then the largest that keeps the
+                //  fastest body moving less than MAX_SUBSTEP_TRAVEL per substep.
+                multiple = MAX_SUBSTEP_MULTIPLE / 2;
+                while(multiple > 1 && fastestSpeed * FINEST_SUBSTEP_SECONDS * F32(multiple) > MAX_SUBSTEP_TRAVEL) {
+                    multiple /= 2;
+                }
+            }
+        }
+
+        const I32 maxSubsteps = I32(MAX_FINEST_SUBSTEPS / multiple);
+        const I32 numberSubsteps = m_dynamicsWorld->stepSimulation(deltaSeconds, maxSubsteps, FINEST_SUBSTEP_SECONDS * F32(multiple));
+        m_lastNumberSubsteps = U32(std::min(numberSubsteps, maxSubsteps));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool BulletPhysics::GetFastestBodySpeed(F32 &fastestSpeed) const
+    {
+        // Static bodies never move and sleeping bodies are not moving, so only the awake
+        //  non static ones are checked.
+        bool anyAwake = false;
+        btScalar fastestSpeedSqr = 0.0f;
+        const btAlignedObjectArray<btRigidBody *> &bodies = m_dynamicsWorld->GetNonStaticRigidBodies();
+        for(I32 i = 0, numberBodies = bodies.size(); i < numberBodies; ++i) {
+            btRigidBody const * const body = bodies[i];
+            if(body->isActive()) {
+                anyAwake = true;
+                fastestSpeedSqr = std::max(fastestSpeedSqr, body->getLinearVelocity().length2());
+            }
+        }
+        fastestSpeed = F32(btSqrt(fastestSpeedSqr));
+        return (anyAwake);
     }
 
     // /////////////////////////////////////////////////////////////////
@@ -739,7 +735,7 @@ namespace GameHalloran {
     void BulletPhysics::VAddSphere(const F32 radius, const F32 specificGravity, PhysicsObjectAttributes &physicsObjectAtt)
     {
         // create the collision body, which specifies the shape of the object
-        btSphereShape * const collisionShape = new btSphereShape(btScalar(radius));
+        btSphereShape * const collisionShape = m_shapeCache.AcquireSphere(radius);
 
         // Sphere volume = 4/3 * PI * r^3
         const F32 volume = (4.0f / 3.0f) * static_cast<F32>(M3D_PI) * radius * radius * radius;
@@ -758,7 +754,7 @@ namespace GameHalloran {
         // create the collision body, which specifies the shape of the object
         btVector3 bulletVec;
         Vector3TobtVector3(dimensions, bulletVec);
-        btBoxShape * const boxShape = new btBoxShape(bulletVec);
+        btBoxShape * const boxShape = m_shapeCache.AcquireBox(bulletVec);
 
         // Volume of a cube is W*H*D
         const F32 volume = dimensions.GetX() * dimensions.GetY() * dimensions.GetZ();
@@ -777,7 +773,7 @@ namespace GameHalloran {
         // create the collision body, which specifies the shape of the object
         btVector3 bulletVec;
         Vector3TobtVector3(dimensions, bulletVec);
-        btCylinderShapeZ * const cylinderShape = new btCylinderShapeZ(bulletVec);
+        btCylinderShapeZ * const cylinderShape = m_shapeCache.AcquireCylinderZ(bulletVec);
 
         // Volume of a cylinder is PI * r^2 * h
         F32 r(cylinderShape->getRadius());
@@ -818,24 +814,25 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
-    void BulletPhysics::VAddStaticMesh(const TriangleMesh &mesh, PhysicsObjectAttributes &physicsObjectAtt)
+    void BulletPhysics::VAddStaticMesh(const TriangleMesh &mesh, PhysicsObjectAttributes &physicsObjectAtt, const std::string &meshName)
     {
         if(mesh.empty() || !physicsObjectAtt.m_actorId) {
             GF_LOG_TRACE_ERR("BulletPhysics::VAddStaticMesh()", "Invalid parameters");
             return;
         }
 
-        if(FindMeshShape(*physicsObjectAtt.m_actorId) != NULL) {
+        if(FindActorBody(*physicsObjectAtt.m_actorId) != NULL) {
             GF_LOG_TRACE_ERR("BulletPhysics::VAddStaticMesh()", "Actor already has a mesh");
             return;
         }
 
-        btTriangleMesh * const bulletMesh = new btTriangleMesh(false, false);
-        GameHalloran::GfTriangleMeshTobtTriangleMesh(mesh, *bulletMesh);
-
-        m_meshMap[*physicsObjectAtt.m_actorId] = bulletMesh;
-
-        btBvhTriangleMeshShape * const shape = new btBvhTriangleMeshShape(bulletMesh, true);
+        // Only convert the triangles if no other actor is using the mesh.
+        btBvhTriangleMeshShape *shape = m_shapeCache.AcquireMesh(meshName);
+        if(!shape) {
+            btTriangleMesh * const bulletMesh = new btTriangleMesh(false, false);
+            GameHalloran::GfTriangleMeshTobtTriangleMesh(mesh, *bulletMesh);
+            shape = m_shapeCache.AddMesh(meshName, bulletMesh, true);
+        }
 
         // Add the shape - Static object so we use 0 mass.
         physicsObjectAtt.m_mass = 0.0f;
@@ -846,24 +843,26 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     //
     // /////////////////////////////////////////////////////////////////
-    void BulletPhysics::VAddStaticMesh(const GLTriangleBatch &batch, PhysicsObjectAttributes &physicsObjectAtt)
+    void BulletPhysics::VAddStaticMesh(const GLTriangleBatch &batch, PhysicsObjectAttributes &physicsObjectAtt, const std::string &meshName)
     {
         if(!batch.IsBatchComplete() || !physicsObjectAtt.m_actorId) {
             GF_LOG_TRACE_ERR("BulletPhysics::VAddStaticMesh()", "Invalid parameters");
             return;
         }
 
-        if(FindMeshShape(*physicsObjectAtt.m_actorId) != NULL) {
+        if(FindActorBody(*physicsObjectAtt.m_actorId) != NULL) {
             GF_LOG_TRACE_ERR("BulletPhysics::VAddStaticMesh()", "Actor already has a mesh");
             return;
         }
 
-        btTriangleMesh * const bulletMesh = new btTriangleMesh(false, false);
-        GameHalloran::GfTriangleBatchTobtTriangleMesh(batch, *bulletMesh);
-
-        m_meshMap[*physicsObjectAtt.m_actorId] = bulletMesh;
-
-        btBvhTriangleMeshShape * const shape = new btBvhTriangleMeshShape(bulletMesh, false);
+        // The bullet mesh points at the batches arrays so a shared shape
+        //  uses the arrays of the first batch added with the name.
+        btBvhTriangleMeshShape *shape = m_shapeCache.AcquireMesh(meshName);
+        if(!shape) {
+            btTriangleMesh * const bulletMesh = new btTriangleMesh(false, false);
+            GameHalloran::GfTriangleBatchTobtTriangleMesh(batch, *bulletMesh);
+            shape = m_shapeCache.AddMesh(meshName, bulletMesh, false);
+        }
 
         // Add the shape - Static object so we use 0 mass.
         physicsObjectAtt.m_mass = 0.0f;
@@ -913,6 +912,8 @@ namespace GameHalloran {
         status.m_linearDamping = bulletActor->m_rigidBodyPtr->getLinearDamping();
         btVector3ToVector3(bulletActor->m_rigidBodyPtr->getAngularVelocity(), status.m_angularVelocity);
         status.m_angularDamping = bulletActor->m_rigidBodyPtr->getAngularDamping();
+        status.m_ccdMotionThreshold = bulletActor->m_rigidBodyPtr->getCcdMotionThreshold();
+        status.m_ccdSweptSphereRadius = bulletActor->m_rigidBodyPtr->getCcdSweptSphereRadius();
         status.m_mass = bulletActor->m_rigidBodyPtr->getInvMass();
         if(status.m_mass != 0.0f) {
             status.m_mass = 1.0f / status.m_mass;
@@ -940,20 +941,8 @@ namespace GameHalloran {
             // destroy the body and all its components
             RemoveCollisionObject(body);
 
-            // clear the relevant elements from the lookup maps
-            ActorIDToBulletActorMap::iterator it = m_actorBodies.find(id);
-            if(it != m_actorBodies.end()) {
-                m_actorBodies.erase(it);
-            }
-            m_rigidBodyToActorId.erase(body);
-
-            // Check if actor had a physics mesh created for it, if so free it.
-            BulletMeshMap::iterator mit = m_meshMap.find(id);
-            if(mit != m_meshMap.end()) {
-                delete mit->second;
-                mit->second = NULL;
-                m_meshMap.erase(mit);
-            }
+            // clear the actor from the lookup map
+            m_actorBodies.Erase(id);
         }
     }
 
@@ -962,8 +951,10 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     void BulletPhysics::VRenderDiagnostics()
     {
-        m_dynamicsWorld->debugDrawWorld();
-        m_debugDrawer->BatchDraw();
+        if(m_debugDrawer) {
+            m_dynamicsWorld->debugDrawWorld();
+            m_debugDrawer->BatchDraw();
+        }
     }
 
     // /////////////////////////////////////////////////////////////////
@@ -993,9 +984,14 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     void BulletPhysics::VCreateTrigger(const Point3 &pos, const F32 dim, const I32 triggerID)
     {
+        if(m_triggerBodies.Contains(triggerID)) {
+            GF_LOG_TRACE_ERR("BulletPhysics::VCreateTrigger()", "A trigger with the same ID already exists");
+            return;
+        }
+
         // create the collision body, which specifies the shape of the object
         btVector3 bulletVec(dim, dim, dim);
-        btBoxShape * const boxShape = new btBoxShape(bulletVec);
+        btBoxShape * const boxShape = m_shapeCache.AcquireBox(bulletVec);
 
         // triggers are immoveable.  0 mass signals this to Bullet.
         const btScalar mass = 0;
@@ -1015,7 +1011,8 @@ namespace GameHalloran {
 
         // a trigger is just a box that doesn't collide with anything.  That's what "CF_NO_CONTACT_RESPONSE" indicates.
         body->setCollisionFlags(body->getCollisionFlags() | btRigidBody::CF_NO_CONTACT_RESPONSE);
-        body->setUserPointer(new I32(triggerID));
+        body->setUserPointer(GCC_NEW BulletBodyLink(true, 0, triggerID));
+        m_triggerBodies.Insert(triggerID, body);
     }
 
     // /////////////////////////////////////////////////////////////////
@@ -1023,19 +1020,10 @@ namespace GameHalloran {
     // /////////////////////////////////////////////////////////////////
     void BulletPhysics::VRemoveTrigger(const I32 triggerId)
     {
-        bool removed(false);
-        btCollisionObjectArray &collisionObjects = m_dynamicsWorld->getCollisionObjectArray();
-
-        for(I32 i = 0, size = collisionObjects.size(); ((!removed) && (i < size)); ++i) {
-            // Any rigid bodies that have a user pointer defined are trigger areas so we search for them.
-            btRigidBody *currRigidBodyPtr = btRigidBody::upcast(collisionObjects[i]);
-            if(currRigidBodyPtr && currRigidBodyPtr->getUserPointer()) {
-                I32 *idPtr = reinterpret_cast<I32 *>(currRigidBodyPtr->getUserPointer());
-                if(idPtr && *idPtr == triggerId) {
-                    RemoveCollisionObject(currRigidBodyPtr);
-                    removed = true;
-                }
-            }
+        btRigidBody * const * const bodyPtr = m_triggerBodies.Find(triggerId);
+        if(bodyPtr) {
+            // RemoveCollisionObject() also erases the trigger from m_triggerBodies.
+            RemoveCollisionObject(*bodyPtr);
         }
     }
 
@@ -1183,4 +1171,46 @@ namespace GameHalloran {
         }
     }
 
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void BulletPhysics::RunQueryBatch(const PhysicsRayVec &rays, const btConvexShape *sweepShapePtr, PhysicsRayHitVec &hits, boost::shared_ptr<WorkerThreadPool> poolPtr) const
+    {
+        if(!m_dynamicsWorld) {
+            hits.assign(rays.size(), PhysicsRayHit());
+            return;
+        }
+
+        BulletQueryBatch batch(*m_dynamicsWorld, rays, sweepShapePtr, hits);
+        batch.Run(poolPtr);
+
+        // Read the actor hit from the body link (triggers are never hit).
+        for(U32 i = 0; i < hits.size(); ++i) {
+            const btCollisionObject *objectPtr = batch.GetHitObject(i);
+            if(objectPtr) {
+                const BulletBodyLink *linkPtr = static_cast<const BulletBodyLink *>(objectPtr->getUserPointer());
+                if(linkPtr && !linkPtr->m_isTrigger) {
+                    hits[i].m_actorId = linkPtr->m_actorId;
+                }
+            }
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void BulletPhysics::VRayCastBatch(const PhysicsRayVec &rays, PhysicsRayHitVec &hits, boost::shared_ptr<WorkerThreadPool> poolPtr) const
+    {
+        RunQueryBatch(rays, NULL, hits, poolPtr);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void BulletPhysics::VSphereSweepBatch(const PhysicsRayVec &rays, const F32 radius, PhysicsRayHitVec &hits, boost::shared_ptr<WorkerThreadPool> poolPtr) const
+    {
+        const btSphereShape sphere(radius);
+        RunQueryBatch(rays, &sphere, hits, poolPtr);
+    }
+
 }
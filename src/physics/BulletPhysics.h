@@ -59,6 +59,10 @@
 
 #include "IGamePhysics.h"
 #include "BulletPhysicsDebugDrawer.h"
+#include "BulletCollisionPairTracker.h"
+#include "BulletShapeCache.h"
+#include "BulletWorldComponents.h"
+#include "HashMap.h"
 #include "ModelViewProjStackManager.h"
 #include "Triangle.h"
 #include "GLTriangleBatch.h"
@@ -226,6 +230,12 @@ namespace GameHalloran {
         // difference.
         //
         // Note:
+        // Bullet only calls setWorldTransform() for bodies which are awake,
+        // so an actor's motion state adds itself to the list of moved
+        // motion states when its transform changes and VSyncVisibleScene()
+        // only has to look at that list.
+        //
+        // Note:
         // Members are public here because the class is private and known
         // only to the BulletPhysics class!
         //
@@ -234,15 +244,23 @@ namespace GameHalloran {
         public:
 
             Matrix4 m_worldToPositionTransform;                 ///< The actors position and orientation info.
+            ActorId m_actorId;                                  ///< The actor (only valid if m_movedListPtr is set).
+            std::vector<ActorMotionState *> *m_movedListPtr;    ///< Moved motion states to add this to (NULL for triggers).
+            bool m_moved;                                       ///< Is this in the moved list?
 
             // /////////////////////////////////////////////////////////////////
             // Constructor.
             //
             // @param startingTransform The starting position and orientation of
             //                          the game object.
+            // @param actorId The ID of the actor.
+            // @param movedListPtr List to add the motion state to when it moves
+            //                      (NULL to never add it).
             //
             // /////////////////////////////////////////////////////////////////
-            inline explicit ActorMotionState(const Matrix4 &startingTransform) : m_worldToPositionTransform(startingTransform) { };
+            inline explicit ActorMotionState(const Matrix4 &startingTransform, const ActorId actorId = 0, std::vector<ActorMotionState *> *movedListPtr = NULL)\
+        :
+            m_worldToPositionTransform(startingTransform), m_actorId(actorId), m_movedListPtr(movedListPtr), m_moved(false) { };
 
             // /////////////////////////////////////////////////////////////////
             // btMotionState interface:  Bullet calls these
@@ -255,10 +273,48 @@ namespace GameHalloran {
             // btMotionState interface:  Bullet calls these
             // /////////////////////////////////////////////////////////////////
             inline virtual void setWorldTransform(const btTransform &worldTrans) {
-                btTransformToMatrix4(worldTrans, m_worldToPositionTransform);
+                Matrix4 newTransform;
+                btTransformToMatrix4(worldTrans, newTransform);
+                if(m_movedListPtr && !m_moved && newTransform != m_worldToPositionTransform) {
+                    m_movedListPtr->push_back(this);
+                    m_moved = true;
+                }
+                m_worldToPositionTransform = newTransform;
             };
         };
 
+        // /////////////////////////////////////////////////////////////////
+        // @class BulletBodyLink
+        // @author PJ O Halloran
+        //
+        // Stored in the user pointer of every rigid body added by
+        // BulletPhysics so the actor or trigger a body belongs to is read
+        // straight from the body (e.g. when reporting contacts) instead of
+        // being looked up.
+        //
+        // Note:
+        // Members are public here because the class is private and known
+        // only to the BulletPhysics class!
+        //
+        // /////////////////////////////////////////////////////////////////
+        class BulletBodyLink {
+        public:
+
+            bool m_isTrigger;                   ///< Does the body belong to a trigger rather than an actor?
+            ActorId m_actorId;                  ///< The actor the body belongs to (actors only).
+            I32 m_triggerId;                    ///< The ID of the trigger (triggers only).
+
+            // /////////////////////////////////////////////////////////////////
+            // Constructor.
+            //
+            // @param isTrigger Does the body belong to a trigger?
+            // @param actorId The actor the body belongs to.
+            // @param triggerId The ID of the trigger.
+            //
+            // /////////////////////////////////////////////////////////////////
+            inline BulletBodyLink(const bool isTrigger, const ActorId actorId, const I32 triggerId) : m_isTrigger(isTrigger), m_actorId(actorId), m_triggerId(triggerId) { };
+        };
+
         // /////////////////////////////////////////////////////////////////
         // @class BulletActor
         // @author Mike McShaffry & PJ O Halloran
@@ -277,52 +333,60 @@ namespace GameHalloran {
             btRigidBody *m_rigidBodyPtr;        ///< The rigid body associted with this actor (should never be NULL)
             F32 m_desiredDeltaYAngle;           ///< The desired Y orientation (to change to over time).
             F32 m_desiredDeltaYAngleTime;       ///< The desired timeframe (seconds) to change the orientation.
+            BulletBodyLink m_link;              ///< Pointed to by the user pointer of m_rigidBodyPtr.
 
             // /////////////////////////////////////////////////////////////////
             // Constructor.
             //
             // @param rigidBodPtr The pointer to the Bullet rigid body input into
             //                      the physics world.
+            // @param actorId The ID of the actor.
             //
             // /////////////////////////////////////////////////////////////////
-            inline explicit BulletActor(btRigidBody *rigidBodyPtr)\
+            inline explicit BulletActor(btRigidBody *rigidBodyPtr, const ActorId actorId)\
         :
-            m_rigidBodyPtr(rigidBodyPtr), m_desiredDeltaYAngle(0.0f), m_desiredDeltaYAngleTime(0.0f) { };
+            m_rigidBodyPtr(rigidBodyPtr), m_desiredDeltaYAngle(0.0f), m_desiredDeltaYAngleTime(0.0f), m_link(false, actorId, 0) { };
         };
 
         // these are all of the objects that Bullet uses to do its work.
-        //   see BulletPhysics::VInitialize() for some more info.
-        boost::shared_ptr<btDynamicsWorld> m_dynamicsWorld;
-        boost::shared_ptr<btBroadphaseInterface> m_broadphase;
-        boost::shared_ptr<btCollisionDispatcher> m_dispatcher;
-        boost::shared_ptr<btConstraintSolver> m_solver;
-        boost::shared_ptr<btDefaultCollisionConfiguration> m_collisionConfiguration;
+        //   see BulletPhysics::VInitialize() and BulletWorldComponents for some more info.
+        U32 m_numberThreads;
+        boost::shared_ptr<BulletWorldComponents> m_worldComponentsPtr;
+        BulletDynamicsWorld *m_dynamicsWorld;               ///< Owned by m_worldComponentsPtr.
         boost::shared_ptr<BulletPhysicsDebugDrawer> m_debugDrawer;
 
         // keep track of the existing rigid bodies:  To check them for updates
         //   to the actors' positions, and to remove them when their lives are over.
-        typedef std::map<ActorId, boost::shared_ptr<BulletActor> > ActorIDToBulletActorMap;
+        //   The actor ID of a btRigidBody* is read from its BulletBodyLink user pointer.
+        typedef HashMap<ActorId, boost::shared_ptr<BulletActor> > ActorIDToBulletActorMap;
         ActorIDToBulletActorMap m_actorBodies;
 
-        // also keep a map to get the actor id from the btRigidBody*
-        typedef std::map<btRigidBody const *, ActorId> RigidBodyToActorIDMap;
-        RigidBodyToActorIDMap m_rigidBodyToActorId;
+        // the motion states of the actors which have moved since the last VSyncVisibleScene().
+        std::vector<ActorMotionState *> m_movedMotionStates;
+
+        // the trigger bodies, so they can be removed without searching the world.
+        typedef HashMap<I32, btRigidBody *> TriggerIDToBodyMap;
+        TriggerIDToBodyMap m_triggerBodies;
 
         // data used to store which collision pair (bodies that are touching) need
         //   Collision events sent.  When a new pair of touching bodies are detected,
-        //   they are added to m_previousTickCollisionPairs and an event is sent.
+        //   they are added to m_collisionPairs and an event is sent.
         //   When the pair is no longer detected, they are removed and another event
         //   is sent.
-        typedef std::pair<btRigidBody const *, btRigidBody const *> CollisionPair;
-        typedef std::set<CollisionPair> CollisionPairs;
-        CollisionPairs m_previousTickCollisionPairs;
+        BulletCollisionPairTracker m_collisionPairs;
 
         // The MVP stack manager to pass onto the Debug Drawer class in VInitialize() so
         //  that it knows the current mvp matrix for rendering debug info!
         boost::shared_ptr<ModelViewProjStackManager> m_mvpStackManagerPtr;
 
-        typedef std::map<ActorId, btStridingMeshInterface const *> BulletMeshMap;
-        BulletMeshMap m_meshMap;
+        // Collision shapes shared between the rigid bodies with the same
+        //  primitive shape or static mesh.
+        BulletShapeCache m_shapeCache;
+
+        // Pick the substep size each frame from the speed of the fastest body
+        //  (see VOnUpdate()) rather than always stepping at the finest size.
+        bool m_adaptiveSubstepping;
+        U32 m_lastNumberSubsteps;                           ///< Substeps taken by the last VOnUpdate().
 
         // /////////////////////////////////////////////////////////////////
         // helpers for sending events relating to collision pairs
@@ -342,6 +406,13 @@ namespace GameHalloran {
         // /////////////////////////////////////////////////////////////////
         void RemoveCollisionObject(btCollisionObject *removeMePtr);
 
+        // /////////////////////////////////////////////////////////////////
+        // Give a collision shape back to the shape cache (or delete it if
+        // it was not created by the cache).
+        //
+        // /////////////////////////////////////////////////////////////////
+        void ReleaseShape(btCollisionShape *shapePtr);
+
         // /////////////////////////////////////////////////////////////////
         // find the rigid body associated with the given actor ID
         //
@@ -361,17 +432,12 @@ namespace GameHalloran {
         boost::optional<ActorId> FindActorID(btRigidBody const *bodyPtr) const;
 
         // /////////////////////////////////////////////////////////////////
-        // Find the mesh shape associated with the physics object created
-        // for the actor identified.
+        // Get the trigger link of a body.
         //
-        // @param aid The actor ID.
-        //
-        // @return btStridingMeshInterface const * Pointer to bullet mesh
-        //                                          linked to actor or NULL
-        //                                          if the actor has no mesh.
+        // @return BulletBodyLink* NULL if the body is not a trigger.
         //
         // /////////////////////////////////////////////////////////////////
-        btStridingMeshInterface const *FindMeshShape(const ActorId aid) const;
+        static BulletBodyLink const *GetTriggerLink(btRigidBody const *bodyPtr);
 
         // /////////////////////////////////////////////////////////////////
         // Get the API independant physics object type from the bullet
@@ -395,6 +461,23 @@ namespace GameHalloran {
         // /////////////////////////////////////////////////////////////////
         PhysicsBodyType GetPhysicsBodyType(const btCollisionObject *bodyPtr) const;
 
+        // /////////////////////////////////////////////////////////////////
+        // Get the linear speed of the fastest awake non static body.  Only
+        // the world's non static rigid bodies are checked, not the static
+        // table meshes and triggers.
+        //
+        // @return bool False if every non static body is asleep.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool GetFastestBodySpeed(F32 &fastestSpeed) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Run a batch of ray casts (sweepShapePtr is NULL) or convex sweeps
+        // and fill in the actors that were hit.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void RunQueryBatch(const PhysicsRayVec &rays, const btConvexShape *sweepShapePtr, PhysicsRayHitVec &hits, boost::shared_ptr<WorkerThreadPool> poolPtr) const;
+
         // /////////////////////////////////////////////////////////////////
         // callback from bullet for each physics time step.  set in VInitialize
         //
@@ -406,8 +489,14 @@ namespace GameHalloran {
         // /////////////////////////////////////////////////////////////////
         // Constructor.
         //
+        // @param mvpStackManagerPtr The MVP stack for the debug drawer (if
+        //                      empty the simulation runs headless with no
+        //                      debug drawing).
+        // @param numberThreads Number of threads to step the simulation on
+        //                      (0 or 1 for the single threaded solver).
+        //
         // /////////////////////////////////////////////////////////////////
-        BulletPhysics(boost::shared_ptr<ModelViewProjStackManager> mvpStackManagerPtr);
+        BulletPhysics(boost::shared_ptr<ModelViewProjStackManager> mvpStackManagerPtr, const U32 numberThreads = 0);
 
         // /////////////////////////////////////////////////////////////////
         // Destructor.
@@ -433,16 +522,50 @@ namespace GameHalloran {
         // /////////////////////////////////////////////////////////////////
         // Update the physics world.
         //
+        // With adaptive substepping the substep size is picked from the
+        // speed of the fastest body: 1/60s while everything is asleep (so
+        // an idle table costs one substep a frame), 1/120s while bodies are
+        // awake and down to 1/240s for fast shots.  A frame is never
+        // simulated with more than 12 of the finest substeps (longer frames
+        // are slowed down).
+        //
         // @param deltaSeconds The number of seconds since the last update.
         //
         // /////////////////////////////////////////////////////////////////
         virtual void VOnUpdate(const F32 deltaSeconds);
 
+        // /////////////////////////////////////////////////////////////////
+        // Turn adaptive substepping on (the default) or off (always step at
+        // 1/240s).
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline void SetAdaptiveSubstepping(const bool enabled) {
+            m_adaptiveSubstepping = enabled;
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Is adaptive substepping on?
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline bool IsAdaptiveSubstepping() const {
+            return (m_adaptiveSubstepping);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of substeps taken by the last VOnUpdate().
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetLastNumberSubsteps() const {
+            return (m_lastNumberSubsteps);
+        };
+
         // /////////////////////////////////////////////////////////////////
         // Adds a btRigidBody to the physics simulation linked to the game
         // actor supplied.
         //
         // @param shapePtr Pointer to the game shape for the bullet object.
+        //                  If the body can not be added the shape is
+        //                  released.
         // @param physicsObject Information describing the physics object
         //
         // /////////////////////////////////////////////////////////////////
@@ -493,18 +616,22 @@ namespace GameHalloran {
         //
         // @param mesh The triangle mesh.
         // @param physicsObjectAtt The physics object attributes of the object.
+        // @param meshName Name of the mesh resource.  Actors added with the
+        //                  same mesh name share a single collision shape.
         //
         // /////////////////////////////////////////////////////////////////
-        virtual void VAddStaticMesh(const TriangleMesh &mesh, struct PhysicsObjectAttributes &physicsObjectAtt);
+        virtual void VAddStaticMesh(const TriangleMesh &mesh, struct PhysicsObjectAttributes &physicsObjectAtt, const std::string &meshName = std::string());
 
         // /////////////////////////////////////////////////////////////////
         // Add a static triangle mesh object (0 mass) to the physics world.
         //
         // @param batch The OpenGL rendering triangle batch.
         // @param physicsObjectAtt The physics object attributes of the object.
+        // @param meshName Name of the mesh resource.  Actors added with the
+        //                  same mesh name share a single collision shape.
         //
         // /////////////////////////////////////////////////////////////////
-        virtual void VAddStaticMesh(const GLTriangleBatch &batch, struct PhysicsObjectAttributes &physicsObjectAtt);
+        virtual void VAddStaticMesh(const GLTriangleBatch &batch, struct PhysicsObjectAttributes &physicsObjectAtt, const std::string &meshName = std::string());
 
         // /////////////////////////////////////////////////////////////////
         // Get the current status of a physics object in the simulation.
@@ -687,6 +814,36 @@ namespace GameHalloran {
         //
         // /////////////////////////////////////////////////////////////////
         virtual void VTranslate(const ActorId actorId, const Vector3 &vec);
+
+        // /////////////////////////////////////////////////////////////////
+        // Physics world queries.
+        //
+        // Find the closest object hit by each of a batch of rays.  Must not
+        // be called while the world is being stepped.
+        //
+        // @param rays The rays to cast.
+        // @param hits Resized to hold the result of each ray.
+        // @param poolPtr Worker threads to share large batches with (NULL
+        //                  to cast every ray on the calling thread).
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual void VRayCastBatch(const PhysicsRayVec &rays, PhysicsRayHitVec &hits, boost::shared_ptr<WorkerThreadPool> poolPtr = boost::shared_ptr<WorkerThreadPool>()) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Physics world queries.
+        //
+        // Sweep a sphere along each of a batch of rays and find the first
+        // object it touches.  Must not be called while the world is being
+        // stepped.
+        //
+        // @param rays The paths of the centre of the sphere.
+        // @param radius Radius of the sphere.
+        // @param hits Resized to hold the result of each sweep.
+        // @param poolPtr Worker threads to share large batches with (NULL
+        //                  to sweep on the calling thread).
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual void VSphereSweepBatch(const PhysicsRayVec &rays, const F32 radius, PhysicsRayHitVec &hits, boost::shared_ptr<WorkerThreadPool> poolPtr = boost::shared_ptr<WorkerThreadPool>()) const;
     };
 
 }
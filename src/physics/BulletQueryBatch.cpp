@@ -0,0 +1,280 @@
+// /////////////////////////////////////////////////////////////////
+// @file BulletQueryBatch.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Implementation file for the BulletQueryBatch class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <bullet/BulletCollision/BroadphaseCollision/btDbvtBroadphase.h>
+
+#include "BulletQueryBatch.h"
+#include "BulletPhysics.h"
+#include "GameMain.h"
+
+namespace GameHalloran {
+
+    // Smallest share of a batch handed to a worker thread, smaller batches
+    //  are run on the calling thread.
+    static const U32 MIN_QUERIES_PER_TASK = 32;
+
+    // /////////////////////////////////////////////////////////////////
+    // Can a query hit an object?  Triggers are never hit and the
+    // collision groups and masks of both must match.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static bool IsQueryable(const btCollisionObject *objectPtr, const I32 collisionGroup, const I32 collisionMask)
+    {
+        const btBroadphaseProxy *proxyPtr = objectPtr->getBroadphaseHandle();
+        if(!proxyPtr || !objectPtr->hasContactResponse()) {
+            return (false);
+        }
+        return ((proxyPtr->m_collisionFilterGroup & collisionMask) != 0 && (collisionGroup & proxyPtr->m_collisionFilterMask) != 0);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    // @class QueryLeafCollider
+    //
+    // Called back for each broadphase leaf a query touches, tests the
+    // query against the object of the leaf.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class QueryLeafCollider : public btDbvt::ICollide {
+    private:
+
+        const btTransform &m_from;                                          ///< Start of the query.
+        const btTransform &m_to;                                            ///< End of the query.
+        const I32 m_collisionGroup;                                         ///< Collision group of the query.
+        const I32 m_collisionMask;                                          ///< Collision groups the query hits.
+        const btConvexShape *m_sweepShapePtr;                               ///< Shape to sweep (NULL for a ray).
+        btVector3 m_sweepExtents;                                           ///< Half extents of the box around the swept shape.
+        btCollisionWorld::ClosestRayResultCallback *m_rayCallbackPtr;       ///< Closest ray hit (rays only).
+        btCollisionWorld::ClosestConvexResultCallback *m_sweepCallbackPtr;  ///< Closest sweep hit (sweeps only).
+
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor for a ray.
+        //
+        // /////////////////////////////////////////////////////////////////
+        QueryLeafCollider(const btTransform &from, const btTransform &to, const I32 collisionGroup, const I32 collisionMask, btCollisionWorld::ClosestRayResultCallback &callback)\
+    :
+        m_from(from), m_to(to), m_collisionGroup(collisionGroup), m_collisionMask(collisionMask), m_sweepShapePtr(NULL), m_sweepExtents(0.0f, 0.0f, 0.0f), m_rayCallbackPtr(&callback), m_sweepCallbackPtr(NULL) {};
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor for a sweep.
+        //
+        // /////////////////////////////////////////////////////////////////
+        QueryLeafCollider(const btTransform &from, const btTransform &to, const I32 collisionGroup, const I32 collisionMask, const btConvexShape *sweepShapePtr, btCollisionWorld::ClosestConvexResultCallback &callback)\
+    :
+        m_from(from), m_to(to), m_collisionGroup(collisionGroup), m_collisionMask(collisionMask), m_sweepShapePtr(sweepShapePtr), m_sweepExtents(), m_rayCallbackPtr(NULL), m_sweepCallbackPtr(&callback) {
+            btVector3 shapeMin, shapeMax;
+            sweepShapePtr->getAabb(btTransform::getIdentity(), shapeMin, shapeMax);
+            m_sweepExtents = (shapeMax - shapeMin) * btScalar(0.5);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Test the query against an object.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void TestObject(const btCollisionObject *objectPtr) {
+            if(!IsQueryable(objectPtr, m_collisionGroup, m_collisionMask)) {
+                return;
+            }
+
+            // Bullet's single object tests are not const correct but do not modify the object.
+            btCollisionObject *mutableObjectPtr = const_cast<btCollisionObject *>(objectPtr);
+            if(m_sweepShapePtr) {
+                btCollisionWorld::objectQuerySingle(m_sweepShapePtr, m_from, m_to, mutableObjectPtr, objectPtr->getCollisionShape(), objectPtr->getWorldTransform(), *m_sweepCallbackPtr, btScalar(0.0));
+            } else {
+                btCollisionWorld::rayTestSingle(m_from, m_to, mutableObjectPtr, objectPtr->getCollisionShape(), objectPtr->getWorldTransform(), *m_rayCallbackPtr);
+            }
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // btDbvt::ICollide interface.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual void Process(const btDbvtNode *leafPtr) {
+            if(m_sweepShapePtr) {
+                // The sweep visits every leaf in the box around the whole sweep, skip
+                //  those the shape cannot touch before the closest hit so far.
+                btScalar param = m_sweepCallbackPtr->m_closestHitFraction;
+                btVector3 normal;
+                if(!btRayAabb(m_from.getOrigin(), m_to.getOrigin(), leafPtr->volume.Mins() - m_sweepExtents, leafPtr->volume.Maxs() + m_sweepExtents, param, normal)) {
+                    return;
+                }
+            }
+
+            const btBroadphaseProxy *proxyPtr = static_cast<const btBroadphaseProxy *>(leafPtr->data);
+            TestObject(static_cast<const btCollisionObject *>(proxyPtr->m_clientObject));
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    BulletQueryBatch::BulletQueryBatch(const btCollisionWorld &world, const PhysicsRayVec &rays, const btConvexShape *sweepShapePtr, PhysicsRayHitVec &hits)\
+:
+    m_worldPtr(&world)
+    , m_rays(rays)
+    , m_sweepShapePtr(sweepShapePtr)
+    , m_hits(hits)
+    , m_hitObjects(rays.size(), static_cast<const btCollisionObject *>(NULL))
+    , m_mutex(NULL)
+    , m_tasksDoneCond(NULL)
+    , m_tasksPending(0)
+    {
+        m_hits.assign(rays.size(), PhysicsRayHit());
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    BulletQueryBatch::~BulletQueryBatch()
+    {
+        if(m_tasksDoneCond) {
+            glfwDestroyCond(m_tasksDoneCond);
+        }
+        if(m_mutex) {
+            glfwDestroyMutex(m_mutex);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void BulletQueryBatch::RunRange(const U32 begin, const U32 end)
+    {
+        for(U32 i = begin; i < end; ++i) {
+            RunQuery(i);
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void BulletQueryBatch::RunQuery(const U32 index)
+    {
+        const PhysicsRay &ray = m_rays[index];
+        if(ray.m_from == ray.m_to) {
+            // A zero length query has no direction to traverse the broadphase with.
+            return;
+        }
+
+        btVector3 from, to;
+        Point3TobtVector3(ray.m_from, from);
+        Point3TobtVector3(ray.m_to, to);
+        const btTransform fromTrans(btQuaternion::getIdentity(), from);
+        const btTransform toTrans(btQuaternion::getIdentity(), to);
+
+        btCollisionWorld::ClosestRayResultCallback rayCallback(from, to);
+        btCollisionWorld::ClosestConvexResultCallback sweepCallback(from, to);
+        QueryLeafCollider collider = m_sweepShapePtr ? QueryLeafCollider(fromTrans, toTrans, ray.m_collisionGroup, ray.m_collisionMask, m_sweepShapePtr, sweepCallback)
+                                                     : QueryLeafCollider(fromTrans, toTrans, ray.m_collisionGroup, ray.m_collisionMask, rayCallback);
+
+        // Walk the broadphase trees with the re-entrant traversals, Bullet's own
+        //  rayTest() shares one stack between every query.  Any other broadphase
+        //  is searched object by object.
+        btDbvtBroadphase *dbvtPtr = dynamic_cast<btDbvtBroadphase *>(const_cast<btBroadphaseInterface *>(m_worldPtr->getBroadphase()));
+        if(dbvtPtr) {
+            if(m_sweepShapePtr) {
+                btVector3 fromMin, fromMax, toMin, toMax;
+                m_sweepShapePtr->getAabb(fromTrans, fromMin, fromMax);
+                m_sweepShapePtr->getAabb(toTrans, toMin, toMax);
+                fromMin.setMin(toMin);
+                fromMax.setMax(toMax);
+                const btDbvtVolume sweptVolume(btDbvtVolume::FromMM(fromMin, fromMax));
+                dbvtPtr->m_sets[0].collideTV(dbvtPtr->m_sets[0].m_root, sweptVolume, collider);
+                dbvtPtr->m_sets[1].collideTV(dbvtPtr->m_sets[1].m_root, sweptVolume, collider);
+            } else {
+                btDbvt::rayTest(dbvtPtr->m_sets[0].m_root, from, to, collider);
+                btDbvt::rayTest(dbvtPtr->m_sets[1].m_root, from, to, collider);
+            }
+        } else {
+            const btCollisionObjectArray &objects = m_worldPtr->getCollisionObjectArray();
+            for(I32 i = 0; i < objects.size(); ++i) {
+                collider.TestObject(objects[i]);
+            }
+        }
+
+        PhysicsRayHit &hit = m_hits[index];
+        if(m_sweepShapePtr && sweepCallback.hasHit()) {
+            m_hitObjects[index] = sweepCallback.m_hitCollisionObject;
+            btVector3ToPoint3(sweepCallback.m_hitPointWorld, hit.m_point);
+            btVector3ToVector3(sweepCallback.m_hitNormalWorld, hit.m_normal);
+            hit.m_fraction = sweepCallback.m_closestHitFraction;
+            hit.m_hit = true;
+        } else if(!m_sweepShapePtr && rayCallback.hasHit()) {
+            m_hitObjects[index] = rayCallback.m_collisionObject;
+            btVector3ToPoint3(rayCallback.m_hitPointWorld, hit.m_point);
+            btVector3ToVector3(rayCallback.m_hitNormalWorld, hit.m_normal);
+            hit.m_fraction = rayCallback.m_closestHitFraction;
+            hit.m_hit = true;
+        }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void BulletQueryBatch::TaskCompleted()
+    {
+        glfwLockMutex(m_mutex);
+        --m_tasksPending;
+        if(m_tasksPending == 0) {
+            glfwBroadcastCond(m_tasksDoneCond);
+        }
+        glfwUnlockMutex(m_mutex);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void BulletQueryBatch::Run(boost::shared_ptr<WorkerThreadPool> poolPtr)
+    {
+        const U32 numberQueries = U32(m_rays.size());
+
+        // Split the batch between the workers and the calling thread.
+        U32 numberChunks = 1;
+        if(poolPtr) {
+            numberChunks = std::min(poolPtr->GetNumberThreads() + 1, numberQueries / MIN_QUERIES_PER_TASK);
+        }
+        if(numberChunks > 1 && !m_mutex) {
+            m_mutex = glfwCreateMutex();
+            m_tasksDoneCond = glfwCreateCond();
+            if(!m_mutex || !m_tasksDoneCond) {
+                GF_LOG_TRACE_ERR("BulletQueryBatch::Run()", "Failed to create the thread synchronization objects, running the queries on the calling thread");
+                numberChunks = 1;
+            }
+        }
+        if(numberChunks <= 1 || !m_mutex || !m_tasksDoneCond) {
+            RunRange(0, numberQueries);
+            return;
+        }
+
+        glfwLockMutex(m_mutex);
+        m_tasksPending = numberChunks - 1;
+        glfwUnlockMutex(m_mutex);
+
+        for(U32 i = 1; i < numberChunks; ++i) {
+            const U32 begin = (i * numberQueries) / numberChunks;
+            const U32 end = ((i + 1) * numberQueries) / numberChunks;
+            if(!poolPtr->AddTask(WorkerTaskPtr(GCC_NEW QueryTask(this, begin, end)))) {
+                RunRange(begin, end);
+                TaskCompleted();
+            }
+        }
+
+        RunRange(0, numberQueries / numberChunks);
+
+        glfwLockMutex(m_mutex);
+        while(m_tasksPending > 0) {
+            glfwWaitCond(m_tasksDoneCond, m_mutex, GLFW_INFINITY);
+        }
+        glfwUnlockMutex(m_mutex);
+    }
+
+}
@@ -0,0 +1,137 @@
+#pragma once
+#ifndef __GF_BULLET_QUERY_BATCH_H
+#define __GF_BULLET_QUERY_BATCH_H
+
+// /////////////////////////////////////////////////////////////////
+// @file BulletQueryBatch.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header file for the BulletQueryBatch class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include <bullet/btBulletDynamicsCommon.h>
+
+#include "GameBase.h"
+#include "IGamePhysics.h"
+#include "WorkerThreadPool.h"
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    // @class BulletQueryBatch
+    // @author PJ O Halloran
+    //
+    // Runs a batch of ray casts or convex sweeps against a Bullet
+    // collision world, optionally sharing the batch between the threads
+    // of a WorkerThreadPool.
+    //
+    // btCollisionWorld::rayTest() walks the btDbvtBroadphase with a
+    // stack shared by every query so it may only be used from one thread
+    // at a time.  The batch walks the broadphase trees itself with the
+    // re-entrant btDbvt traversals and tests the leaves with the static
+    // btCollisionWorld::rayTestSingle() and objectQuerySingle(), so any
+    // number of queries may run at once as long as the world is not
+    // being stepped or modified.
+    //
+    // Bodies without contact response (triggers) are never hit.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class BulletQueryBatch : private NonCopyable {
+    private:
+
+        // /////////////////////////////////////////////////////////////////
+        // @class QueryTask
+        //
+        // Worker task which runs a range of the queries.
+        //
+        // /////////////////////////////////////////////////////////////////
+        class QueryTask : public IWorkerTask {
+        private:
+            BulletQueryBatch *m_batchPtr;                   ///< Owning batch.
+            const U32 m_begin;                              ///< First query to run.
+            const U32 m_end;                                ///< One past the last query to run.
+        public:
+            QueryTask(BulletQueryBatch *batchPtr, const U32 begin, const U32 end) : m_batchPtr(batchPtr), m_begin(begin), m_end(end) {};
+            virtual void VExecute() {
+                m_batchPtr->RunRange(m_begin, m_end);
+                m_batchPtr->TaskCompleted();
+            };
+        };
+
+        const btCollisionWorld *m_worldPtr;                 ///< World to query.
+        const PhysicsRayVec &m_rays;                        ///< The queries.
+        const btConvexShape *m_sweepShapePtr;               ///< Shape to sweep along the rays (NULL to cast rays).
+        PhysicsRayHitVec &m_hits;                           ///< Result of each query.
+        std::vector<const btCollisionObject *> m_hitObjects;    ///< Object hit by each query (NULL for a miss).
+        GLFWmutex m_mutex;                                  ///< Guards m_tasksPending.
+        GLFWcond m_tasksDoneCond;                           ///< Signalled when the last worker task completes.
+        U32 m_tasksPending;                                 ///< Number of worker tasks still running.
+
+        // /////////////////////////////////////////////////////////////////
+        // Run the queries in the range [begin, end).
+        //
+        // /////////////////////////////////////////////////////////////////
+        void RunRange(const U32 begin, const U32 end);
+
+        // /////////////////////////////////////////////////////////////////
+        // Run one query.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void RunQuery(const U32 index);
+
+        // /////////////////////////////////////////////////////////////////
+        // Record that a worker task has finished.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void TaskCompleted();
+
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // @param world The world to query.
+        // @param rays The rays to cast or sweep along.
+        // @param sweepShapePtr Shape to sweep along the rays, NULL to cast
+        //                      the rays.
+        // @param hits Resized to hold the result of each query.
+        //
+        // /////////////////////////////////////////////////////////////////
+        explicit BulletQueryBatch(const btCollisionWorld &world, const PhysicsRayVec &rays, const btConvexShape *sweepShapePtr, PhysicsRayHitVec &hits);
+
+        // /////////////////////////////////////////////////////////////////
+        // Destructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        ~BulletQueryBatch();
+
+        // /////////////////////////////////////////////////////////////////
+        // Run every query and wait for them to finish.
+        //
+        // @param poolPtr Worker threads to share the queries with (NULL
+        //                  to run them all on the calling thread).  The
+        //                  calling thread runs a share of the queries too.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void Run(boost::shared_ptr<WorkerThreadPool> poolPtr);
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the object hit by a query after Run().
+        //
+        // @return const btCollisionObject* NULL if the query missed.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline const btCollisionObject *GetHitObject(const U32 index) const {
+            return (m_hitObjects[index]);
+        };
+    };
+
+}
+
+#endif
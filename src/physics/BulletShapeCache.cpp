@@ -0,0 +1,285 @@
+// /////////////////////////////////////////////////////////////////
+// @file BulletShapeCache.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Implementation file for the BulletShapeCache class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <cstring>
+
+#include "BulletShapeCache.h"
+
+namespace GameHalloran {
+
+    // Alignment btQuantizedBvh requires for its serialized buffers.
+    static const U32 BVH_BUFFER_ALIGNMENT = 16;
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool BulletShapeCache::PrimitiveKey::operator<(const PrimitiveKey &rhs) const
+    {
+        if(m_type != rhs.m_type) {
+            return (m_type < rhs.m_type);
+        }
+        if(m_x != rhs.m_x) {
+            return (m_x < rhs.m_x);
+        }
+        if(m_y != rhs.m_y) {
+            return (m_y < rhs.m_y);
+        }
+        return (m_z < rhs.m_z);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    BulletShapeCache::BulletShapeCache()\
+:
+    m_primitives()
+    , m_meshes()
+    , m_shapes()
+    , m_bvhData()
+    {
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    BulletShapeCache::~BulletShapeCache()
+    {
+        try {
+            for(ShapeMap::iterator i = m_shapes.begin(), end = m_shapes.end(); i != end; ++i) {
+                DestroyEntry(i->second);
+            }
+            m_shapes.clear();
+            m_primitives.clear();
+            m_meshes.clear();
+
+            for(BvhMap::iterator i = m_bvhData.begin(), end = m_bvhData.end(); i != end; ++i) {
+                btAlignedFree(i->second.m_bufferPtr);
+            }
+            m_bvhData.clear();
+        } catch(...) { }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void BulletShapeCache::DestroyEntry(ShapeEntry *entryPtr)
+    {
+        if(!entryPtr) {
+            return;
+        }
+
+        // The shape uses the mesh and the BVH buffer so it goes first.
+        delete entryPtr->m_shapePtr;
+        delete entryPtr->m_meshPtr;
+        if(entryPtr->m_bvhBufferPtr) {
+            btAlignedFree(entryPtr->m_bvhBufferPtr);
+        }
+        delete entryPtr;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    btCollisionShape *BulletShapeCache::AcquirePrimitive(const PrimitiveKey &key)
+    {
+        PrimitiveMap::iterator found = m_primitives.find(key);
+        if(found == m_primitives.end()) {
+            return (NULL);
+        }
+
+        ++found->second->m_refCount;
+        return (found->second->m_shapePtr);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void BulletShapeCache::AddPrimitive(const PrimitiveKey &key, btCollisionShape *shapePtr)
+    {
+        ShapeEntry *entryPtr = GCC_NEW ShapeEntry();
+        entryPtr->m_shapePtr = shapePtr;
+        entryPtr->m_key = key;
+        m_primitives[key] = entryPtr;
+        m_shapes[shapePtr] = entryPtr;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    btSphereShape *BulletShapeCache::AcquireSphere(const F32 radius)
+    {
+        const PrimitiveKey key(SPHERE_SHAPE_PROXYTYPE, radius, 0.0f, 0.0f);
+        btCollisionShape *shapePtr = AcquirePrimitive(key);
+        if(shapePtr) {
+            return (static_cast<btSphereShape *>(shapePtr));
+        }
+
+        btSphereShape *spherePtr = GCC_NEW btSphereShape(btScalar(radius));
+        AddPrimitive(key, spherePtr);
+        return (spherePtr);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    btBoxShape *BulletShapeCache::AcquireBox(const btVector3 &halfExtents)
+    {
+        const PrimitiveKey key(BOX_SHAPE_PROXYTYPE, halfExtents.x(), halfExtents.y(), halfExtents.z());
+        btCollisionShape *shapePtr = AcquirePrimitive(key);
+        if(shapePtr) {
+            return (static_cast<btBoxShape *>(shapePtr));
+        }
+
+        btBoxShape *boxPtr = GCC_NEW btBoxShape(halfExtents);
+        AddPrimitive(key, boxPtr);
+        return (boxPtr);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    btCylinderShapeZ *BulletShapeCache::AcquireCylinderZ(const btVector3 &halfExtents)
+    {
+        const PrimitiveKey key(CYLINDER_SHAPE_PROXYTYPE, halfExtents.x(), halfExtents.y(), halfExtents.z());
+        btCollisionShape *shapePtr = AcquirePrimitive(key);
+        if(shapePtr) {
+            return (static_cast<btCylinderShapeZ *>(shapePtr));
+        }
+
+        btCylinderShapeZ *cylinderPtr = GCC_NEW btCylinderShapeZ(halfExtents);
+        AddPrimitive(key, cylinderPtr);
+        return (cylinderPtr);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    btBvhTriangleMeshShape *BulletShapeCache::AcquireMesh(const std::string &meshName)
+    {
+        if(meshName.empty()) {
+            return (NULL);
+        }
+
+        MeshMap::iterator found = m_meshes.find(meshName);
+        if(found == m_meshes.end()) {
+            return (NULL);
+        }
+
+        ++found->second->m_refCount;
+        return (static_cast<btBvhTriangleMeshShape *>(found->second->m_shapePtr));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    btBvhTriangleMeshShape *BulletShapeCache::AddMesh(const std::string &meshName, btTriangleMesh *meshPtr, const bool useQuantizedAabbCompression)
+    {
+        if(!meshPtr) {
+            return (NULL);
+        }
+
+        // A named mesh already in use keeps the shape it has.
+        btBvhTriangleMeshShape *existingPtr = AcquireMesh(meshName);
+        if(existingPtr) {
+            delete meshPtr;
+            return (existingPtr);
+        }
+
+        ShapeEntry *entryPtr = GCC_NEW ShapeEntry();
+        entryPtr->m_meshPtr = meshPtr;
+        entryPtr->m_meshName = meshName;
+
+        BvhMap::iterator bvhIt = meshName.empty() ? m_bvhData.end() : m_bvhData.find(meshName);
+        if(bvhIt != m_bvhData.end() && bvhIt->second.m_quantized == useQuantizedAabbCompression) {
+            // Load the BVH from a copy of the serialized data as it is deserialized in place.
+            btBvhTriangleMeshShape *shapePtr = GCC_NEW btBvhTriangleMeshShape(meshPtr, useQuantizedAabbCompression, false);
+            entryPtr->m_bvhBufferPtr = btAlignedAlloc(bvhIt->second.m_size, BVH_BUFFER_ALIGNMENT);
+            memcpy(entryPtr->m_bvhBufferPtr, bvhIt->second.m_bufferPtr, bvhIt->second.m_size);
+            shapePtr->setOptimizedBvh(btOptimizedBvh::deSerializeInPlace(entryPtr->m_bvhBufferPtr, bvhIt->second.m_size, false));
+            entryPtr->m_shapePtr = shapePtr;
+        } else {
+            entryPtr->m_shapePtr = GCC_NEW btBvhTriangleMeshShape(meshPtr, useQuantizedAabbCompression, true);
+        }
+
+        if(!meshName.empty()) {
+            m_meshes[meshName] = entryPtr;
+        }
+        m_shapes[entryPtr->m_shapePtr] = entryPtr;
+        return (static_cast<btBvhTriangleMeshShape *>(entryPtr->m_shapePtr));
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void BulletShapeCache::SaveBvh(ShapeEntry &entry)
+    {
+        if(entry.m_meshName.empty() || HasSerializedBvh(entry.m_meshName)) {
+            return;
+        }
+
+        btBvhTriangleMeshShape *shapePtr = static_cast<btBvhTriangleMeshShape *>(entry.m_shapePtr);
+        const btOptimizedBvh *bvhPtr = shapePtr->getOptimizedBvh();
+        if(!bvhPtr) {
+            return;
+        }
+
+        SerializedBvh data;
+        data.m_size = bvhPtr->calculateSerializeBufferSize();
+        data.m_bufferPtr = btAlignedAlloc(data.m_size, BVH_BUFFER_ALIGNMENT);
+        data.m_quantized = shapePtr->usesQuantizedAabbCompression();
+        if(!data.m_bufferPtr || !bvhPtr->serializeInPlace(data.m_bufferPtr, data.m_size, false)) {
+            btAlignedFree(data.m_bufferPtr);
+            return;
+        }
+
+        m_bvhData[entry.m_meshName] = data;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool BulletShapeCache::Release(btCollisionShape *shapePtr)
+    {
+        ShapeMap::iterator found = m_shapes.find(shapePtr);
+        if(found == m_shapes.end()) {
+            return (false);
+        }
+
+        ShapeEntry *entryPtr = found->second;
+        if(--entryPtr->m_refCount > 0) {
+            return (true);
+        }
+
+        if(entryPtr->m_meshPtr) {
+            SaveBvh(*entryPtr);
+            if(!entryPtr->m_meshName.empty()) {
+                m_meshes.erase(entryPtr->m_meshName);
+            }
+        } else {
+            m_primitives.erase(entryPtr->m_key);
+        }
+
+        m_shapes.erase(found);
+        DestroyEntry(entryPtr);
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    U32 BulletShapeCache::GetReferenceCount(btCollisionShape const *shapePtr) const
+    {
+        ShapeMap::const_iterator found = m_shapes.find(shapePtr);
+        if(found == m_shapes.end()) {
+            return (0);
+        }
+        return (found->second->m_refCount);
+    }
+
+}
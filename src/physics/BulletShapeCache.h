@@ -0,0 +1,238 @@
+#pragma once
+#ifndef __GF_BULLET_SHAPE_CACHE_H
+#define __GF_BULLET_SHAPE_CACHE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file BulletShapeCache.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header file for the BulletShapeCache class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <string>
+
+#include <bullet/btBulletDynamicsCommon.h>
+
+#include "GameBase.h"
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    // @class BulletShapeCache
+    // @author PJ O Halloran
+    //
+    // Shares Bullet collision shapes between rigid bodies.  Primitive
+    // shapes are keyed by their type and dimensions so e.g. every pool
+    // ball uses the same btSphereShape.  Static triangle mesh shapes
+    // are keyed by the name of the mesh resource they were built from.
+    //
+    // Each shape handed out is reference counted and must be given
+    // back with Release() once the rigid body using it is destroyed.
+    // When the last reference to a named mesh is released its BVH is
+    // kept in serialized form so adding the mesh again does not have
+    // to rebuild the tree.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class BulletShapeCache : private NonCopyable {
+    private:
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct PrimitiveKey
+        //
+        // Identifies a primitive shape by type and dimensions.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct PrimitiveKey {
+            I32 m_type;                                 ///< Bullet shape type (BroadphaseNativeTypes).
+            F32 m_x;                                    ///< First dimension.
+            F32 m_y;                                    ///< Second dimension.
+            F32 m_z;                                    ///< Third dimension.
+
+            // /////////////////////////////////////////////////////////////////
+            // Constructor.
+            //
+            // /////////////////////////////////////////////////////////////////
+            PrimitiveKey(const I32 type = INVALID_SHAPE_PROXYTYPE, const F32 x = 0.0f, const F32 y = 0.0f, const F32 z = 0.0f) : m_type(type), m_x(x), m_y(y), m_z(z) {};
+
+            // /////////////////////////////////////////////////////////////////
+            // Ordering for std::map.
+            //
+            // /////////////////////////////////////////////////////////////////
+            bool operator<(const PrimitiveKey &rhs) const;
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct ShapeEntry
+        //
+        // A cached shape, its reference count and the data it owns.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct ShapeEntry {
+            btCollisionShape *m_shapePtr;               ///< The shared shape.
+            btTriangleMesh *m_meshPtr;                  ///< Triangles of a mesh shape (NULL for primitives).
+            void *m_bvhBufferPtr;                       ///< Deserialized BVH of a mesh shape (NULL if the shape built its own).
+            std::string m_meshName;                     ///< Name of a mesh shape (empty for primitives and unnamed meshes).
+            PrimitiveKey m_key;                         ///< Key of a primitive shape.
+            U32 m_refCount;                             ///< Number of rigid bodies using the shape.
+
+            // /////////////////////////////////////////////////////////////////
+            // Constructor.
+            //
+            // /////////////////////////////////////////////////////////////////
+            ShapeEntry() : m_shapePtr(NULL), m_meshPtr(NULL), m_bvhBufferPtr(NULL), m_meshName(), m_key(), m_refCount(1) {};
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // @struct SerializedBvh
+        //
+        // The serialized BVH of a mesh no longer in use.
+        //
+        // /////////////////////////////////////////////////////////////////
+        struct SerializedBvh {
+            void *m_bufferPtr;                          ///< 16 byte aligned serialized btOptimizedBvh.
+            U32 m_size;                                 ///< Size of the buffer in bytes.
+            bool m_quantized;                           ///< Was the BVH built with quantized AABB compression?
+        };
+
+        typedef std::map<PrimitiveKey, ShapeEntry *> PrimitiveMap;
+        typedef std::map<std::string, ShapeEntry *> MeshMap;
+        typedef std::map<btCollisionShape const *, ShapeEntry *> ShapeMap;
+        typedef std::map<std::string, SerializedBvh> BvhMap;
+
+        PrimitiveMap m_primitives;                      ///< Primitive shapes in use.
+        MeshMap m_meshes;                               ///< Named mesh shapes in use.
+        ShapeMap m_shapes;                              ///< Every shape in use (primitives and meshes).
+        BvhMap m_bvhData;                               ///< Serialized BVH of named meshes no longer in use.
+
+        // /////////////////////////////////////////////////////////////////
+        // Find a primitive shape and add a reference to it.
+        //
+        // @return btCollisionShape* NULL if the shape is not cached.
+        //
+        // /////////////////////////////////////////////////////////////////
+        btCollisionShape *AcquirePrimitive(const PrimitiveKey &key);
+
+        // /////////////////////////////////////////////////////////////////
+        // Add a new primitive shape with a single reference.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void AddPrimitive(const PrimitiveKey &key, btCollisionShape *shapePtr);
+
+        // /////////////////////////////////////////////////////////////////
+        // Serialize the BVH of a named mesh shape into m_bvhData.
+        //
+        // /////////////////////////////////////////////////////////////////
+        void SaveBvh(ShapeEntry &entry);
+
+        // /////////////////////////////////////////////////////////////////
+        // Delete a shape and everything it owns.
+        //
+        // /////////////////////////////////////////////////////////////////
+        static void DestroyEntry(ShapeEntry *entryPtr);
+
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        BulletShapeCache();
+
+        // /////////////////////////////////////////////////////////////////
+        // Destructor.  Deletes every shape, so no rigid body may still be
+        // using one.
+        //
+        // /////////////////////////////////////////////////////////////////
+        ~BulletShapeCache();
+
+        // /////////////////////////////////////////////////////////////////
+        // Get a sphere shape.
+        //
+        // @param radius The radius of the sphere.
+        //
+        // /////////////////////////////////////////////////////////////////
+        btSphereShape *AcquireSphere(const F32 radius);
+
+        // /////////////////////////////////////////////////////////////////
+        // Get a box shape.
+        //
+        // @param halfExtents Half the width, height and depth of the box.
+        //
+        // /////////////////////////////////////////////////////////////////
+        btBoxShape *AcquireBox(const btVector3 &halfExtents);
+
+        // /////////////////////////////////////////////////////////////////
+        // Get a cylinder shape aligned on the Z axis.
+        //
+        // @param halfExtents Half the dimensions of the cylinder.
+        //
+        // /////////////////////////////////////////////////////////////////
+        btCylinderShapeZ *AcquireCylinderZ(const btVector3 &halfExtents);
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the shape of a named mesh which is already in use.
+        //
+        // @param meshName The name of the mesh resource.
+        //
+        // @return btBvhTriangleMeshShape* NULL if the mesh is not in use
+        //                                  (add it with AddMesh()).
+        //
+        // /////////////////////////////////////////////////////////////////
+        btBvhTriangleMeshShape *AcquireMesh(const std::string &meshName);
+
+        // /////////////////////////////////////////////////////////////////
+        // Create the shape for a mesh.  If the named mesh has been used
+        // before its serialized BVH is loaded instead of building a new
+        // one.
+        //
+        // @param meshName The name of the mesh resource (an empty name
+        //                  creates a shape which is never shared).
+        // @param meshPtr The triangles of the mesh.  Owned by the cache
+        //                  from now on.
+        // @param useQuantizedAabbCompression Build a quantized BVH.
+        //
+        // @return btBvhTriangleMeshShape* The shape with a single reference.
+        //
+        // /////////////////////////////////////////////////////////////////
+        btBvhTriangleMeshShape *AddMesh(const std::string &meshName, btTriangleMesh *meshPtr, const bool useQuantizedAabbCompression);
+
+        // /////////////////////////////////////////////////////////////////
+        // Release a reference to a shape from the cache.  The shape is
+        // deleted when its last reference is released.
+        //
+        // @return bool False if the shape does not belong to the cache
+        //              (the caller still owns it).
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool Release(btCollisionShape *shapePtr);
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of references to a shape (0 if it is not in
+        // the cache).
+        //
+        // /////////////////////////////////////////////////////////////////
+        U32 GetReferenceCount(btCollisionShape const *shapePtr) const;
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of shapes currently in use.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetNumberShapes() const {
+            return (static_cast<U32>(m_shapes.size()));
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Is there a serialized BVH for a named mesh?
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline bool HasSerializedBvh(const std::string &meshName) const {
+            return (m_bvhData.find(meshName) != m_bvhData.end());
+        };
+    };
+
+}
+
+#endif
@@ -0,0 +1,209 @@
+// /////////////////////////////////////////////////////////////////
+// @file BulletWorldComponents.cpp
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Implementation file for the BulletWorldComponents class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <bullet/BulletCollision/CollisionDispatch/btSimulationIslandManager.h>
+#include <bullet/BulletMultiThreaded/PlatformDefinitions.h>
+#include <bullet/BulletMultiThreaded/SpuGatheringCollisionDispatcher.h>
+#include <bullet/BulletMultiThreaded/SpuNarrowPhaseCollisionTask/SpuGatheringCollisionTask.h>
+#include <bullet/BulletMultiThreaded/btParallelConstraintSolver.h>
+#if defined(USE_WIN32_THREADING)
+#include <bullet/BulletMultiThreaded/Win32ThreadSupport.h>
+#elif defined(USE_PTHREADS)
+#include <bullet/BulletMultiThreaded/PosixThreadSupport.h>
+#endif
+
+#include "BulletWorldComponents.h"
+#include "GameMain.h"
+
+namespace GameHalloran {
+
+    // Size of the contact manifold and collision algorithm pools.  The parallel
+    //  solver needs every manifold in one contiguous pool so it may not grow.
+    static const I32 THREADED_MANIFOLD_POOL_SIZE = 32768;
+    static const I32 THREADED_ALGORITHM_POOL_SIZE = 32768;
+
+    // /////////////////////////////////////////////////////////////////
+    // Create the thread support object for a set of Bullet tasks.
+    //
+    // @return btThreadSupportInterface* NULL if threads are not
+    //                                      supported on the platform.
+    //
+    // /////////////////////////////////////////////////////////////////
+#if defined(USE_WIN32_THREADING)
+    static btThreadSupportInterface *CreateThreadSupport(const char *name, Win32ThreadFunc threadFunc, Win32lsMemorySetupFunc memoryFunc, const U32 numberThreads)
+    {
+        Win32ThreadSupport::Win32ThreadConstructionInfo info(name, threadFunc, memoryFunc, I32(numberThreads));
+        return (GCC_NEW Win32ThreadSupport(info));
+    }
+#elif defined(USE_PTHREADS)
+    static btThreadSupportInterface *CreateThreadSupport(const char *name, PosixThreadFunc threadFunc, PosixlsMemorySetupFunc memoryFunc, const U32 numberThreads)
+    {
+        PosixThreadSupport::ThreadConstructionInfo info(name, threadFunc, memoryFunc, I32(numberThreads));
+        return (GCC_NEW PosixThreadSupport(info));
+    }
+#else
+    static btThreadSupportInterface *CreateThreadSupport(const char *name, void (*threadFunc)(void *, void *), void *(*memoryFunc)(), const U32 numberThreads)
+    {
+        return (NULL);
+    }
+#endif
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    BulletWorldComponents::BulletWorldComponents(const U32 numberThreads)\
+:
+    m_numberThreads((numberThreads > 1) ? numberThreads : 1)
+    , m_collisionThreadsPtr(NULL)
+    , m_solverThreadsPtr(NULL)
+    , m_collisionConfigurationPtr(NULL)
+    , m_dispatcherPtr(NULL)
+    , m_broadphasePtr(NULL)
+    , m_solverPtr(NULL)
+    , m_dynamicsWorldPtr(NULL)
+    {
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    BulletWorldComponents::~BulletWorldComponents()
+    {
+        try {
+            Destroy();
+        } catch(...) { }
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void BulletWorldComponents::Destroy()
+    {
+        // The world uses everything else and the threads must outlive the dispatcher and solver.
+        delete m_dynamicsWorldPtr;
+        m_dynamicsWorldPtr = NULL;
+        delete m_solverPtr;
+        m_solverPtr = NULL;
+        delete m_broadphasePtr;
+        m_broadphasePtr = NULL;
+        delete m_dispatcherPtr;
+        m_dispatcherPtr = NULL;
+        delete m_collisionConfigurationPtr;
+        m_collisionConfigurationPtr = NULL;
+        delete m_solverThreadsPtr;
+        m_solverThreadsPtr = NULL;
+        delete m_collisionThreadsPtr;
+        m_collisionThreadsPtr = NULL;
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool BulletWorldComponents::CreateMultithreadedComponents()
+    {
+        btDefaultCollisionConstructionInfo collisionInfo;
+        collisionInfo.m_defaultMaxPersistentManifoldPoolSize = THREADED_MANIFOLD_POOL_SIZE;
+        collisionInfo.m_defaultMaxCollisionAlgorithmPoolSize = THREADED_ALGORITHM_POOL_SIZE;
+        m_collisionConfigurationPtr = GCC_NEW btDefaultCollisionConfiguration(collisionInfo);
+        if(!m_collisionConfigurationPtr) {
+            GF_LOG_TRACE_ERR("BulletWorldComponents::CreateMultithreadedComponents()", "Failed to create the btDefaultCollisionConfiguration");
+            return (false);
+        }
+
+        m_collisionThreadsPtr = CreateThreadSupport("collision", processCollisionTask, createCollisionLocalStoreMemory, m_numberThreads);
+        m_solverThreadsPtr = CreateThreadSupport("solver", SolverThreadFunc, SolverlsMemoryFunc, m_numberThreads);
+        if(!m_collisionThreadsPtr || !m_solverThreadsPtr) {
+            GF_LOG_TRACE_ERR("BulletWorldComponents::CreateMultithreadedComponents()", "Failed to create the Bullet physics threads");
+            return (false);
+        }
+
+        m_dispatcherPtr = GCC_NEW SpuGatheringCollisionDispatcher(m_collisionThreadsPtr, m_numberThreads, m_collisionConfigurationPtr);
+        if(!m_dispatcherPtr) {
+            GF_LOG_TRACE_ERR("BulletWorldComponents::CreateMultithreadedComponents()", "Failed to create the SpuGatheringCollisionDispatcher");
+            return (false);
+        }
+        m_dispatcherPtr->setDispatcherFlags(btCollisionDispatcher::CD_DISABLE_CONTACTPOOL_DYNAMIC_ALLOCATION);
+
+        m_solverPtr = GCC_NEW btParallelConstraintSolver(m_solverThreadsPtr);
+        if(!m_solverPtr) {
+            GF_LOG_TRACE_ERR("BulletWorldComponents::CreateMultithreadedComponents()", "Failed to create the btParallelConstraintSolver");
+            return (false);
+        }
+
+        return (true);
+    }
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool BulletWorldComponents::Initialize()
+    {
+        Destroy();
+
+        if(IsMultithreaded()) {
+            if(!CreateMultithreadedComponents()) {
+                Destroy();
+                return (false);
+            }
+        } else {
+            // this controls how Bullet does internal memory management during the collision pass
+            m_collisionConfigurationPtr = GCC_NEW btDefaultCollisionConfiguration();
+            if(!m_collisionConfigurationPtr) {
+                GF_LOG_TRACE_ERR("BulletWorldComponents::Initialize()", "Failed to create the btDefaultCollisionConfiguration");
+                return (false);
+            }
+
+            // this manages how Bullet detects precise collisions between pairs of objects
+            m_dispatcherPtr = GCC_NEW btCollisionDispatcher(m_collisionConfigurationPtr);
+            if(!m_dispatcherPtr) {
+                GF_LOG_TRACE_ERR("BulletWorldComponents::Initialize()", "Failed to create the btCollisionDispatcher");
+                Destroy();
+                return (false);
+            }
+
+            // Manages constraints which apply forces to the physics simulation.  Used
+            //  for e.g. springs, motors.  We don't use any constraints right now.
+            m_solverPtr = GCC_NEW btSequentialImpulseConstraintSolver;
+            if(!m_solverPtr) {
+                GF_LOG_TRACE_ERR("BulletWorldComponents::Initialize()", "Failed to create the btSequentialImpulseConstraintSolver");
+                Destroy();
+                return (false);
+            }
+        }
+
+        // Bullet uses this to quickly (imprecisely) detect collisions between objects.
+        //  Once a possible collision passes the broad phase, it will be passed to the
+        //   slower but more precise narrow-phase collision detection (btCollisionDispatcher).
+        m_broadphasePtr = GCC_NEW btDbvtBroadphase();
+        if(!m_broadphasePtr) {
+            GF_LOG_TRACE_ERR("BulletWorldComponents::Initialize()", "Failed to create the btDbvtBroadphase");
+            Destroy();
+            return (false);
+        }
+
+        // This is the main Bullet interface point.  Pass in all these components to customize its behavior.
+        m_dynamicsWorldPtr = GCC_NEW BulletDynamicsWorld(m_dispatcherPtr, m_broadphasePtr, m_solverPtr, m_collisionConfigurationPtr);
+        if(!m_dynamicsWorldPtr) {
+            GF_LOG_TRACE_ERR("BulletWorldComponents::Initialize()", "Failed to create the BulletDynamicsWorld");
+            Destroy();
+            return (false);
+        }
+
+        if(IsMultithreaded()) {
+            // The parallel solver batches all the islands itself and the narrowphase
+            //  tasks only run when enabled in the dispatch info.
+            m_dynamicsWorldPtr->getSimulationIslandManager()->setSplitIslands(false);
+            m_dynamicsWorldPtr->getSolverInfo().m_solverMode = SOLVER_SIMD | SOLVER_USE_WARMSTARTING;
+            m_dynamicsWorldPtr->getDispatchInfo().m_enableSPU = true;
+        }
+
+        return (true);
+    }
+
+}
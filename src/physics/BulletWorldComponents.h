@@ -0,0 +1,153 @@
+#pragma once
+#ifndef __GF_BULLET_WORLD_COMPONENTS_H
+#define __GF_BULLET_WORLD_COMPONENTS_H
+
+// /////////////////////////////////////////////////////////////////
+// @file BulletWorldComponents.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// Header file for the BulletWorldComponents class.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <bullet/btBulletDynamicsCommon.h>
+
+#include "GameBase.h"
+
+class btThreadSupportInterface;
+
+namespace GameHalloran {
+
+    // /////////////////////////////////////////////////////////////////
+    // @class BulletDynamicsWorld
+    // @author PJ O Halloran
+    //
+    // btDiscreteDynamicsWorld giving read access to the world's list of
+    // non static rigid bodies, the list Bullet walks in its own
+    // activation and motion state passes, so the engine does not have
+    // to walk every collision object (static meshes and triggers
+    // included) to find the moving bodies.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class BulletDynamicsWorld : public btDiscreteDynamicsWorld {
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.  See btDiscreteDynamicsWorld.
+        //
+        // /////////////////////////////////////////////////////////////////
+        BulletDynamicsWorld(btDispatcher *dispatcherPtr, btBroadphaseInterface *broadphasePtr, btConstraintSolver *solverPtr, \
+                            btCollisionConfiguration *collisionConfigurationPtr)
+            : btDiscreteDynamicsWorld(dispatcherPtr, broadphasePtr, solverPtr, collisionConfigurationPtr) {};
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the dynamic and kinematic rigid bodies in the world.
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline const btAlignedObjectArray<btRigidBody *> &GetNonStaticRigidBodies() const {
+            return (m_nonStaticRigidBodies);
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @class BulletWorldComponents
+    // @author PJ O Halloran
+    //
+    // Creates and owns the objects Bullet needs for a discrete dynamics
+    // world (collision configuration, dispatcher, broadphase, constraint
+    // solver and the world itself) and destroys them in the right order.
+    //
+    // With more than one thread the narrowphase runs on a
+    // SpuGatheringCollisionDispatcher and the constraints are solved by
+    // a btParallelConstraintSolver, both backed by the BulletMultiThreaded
+    // thread support for the platform (pthreads or Win32).  Otherwise the
+    // usual single threaded btCollisionDispatcher and
+    // btSequentialImpulseConstraintSolver are used.
+    //
+    // Does not depend on the rest of the engine so it can also be used
+    // by headless tools (see PhysicsBenchmark).
+    //
+    // /////////////////////////////////////////////////////////////////
+    class BulletWorldComponents : private NonCopyable {
+    private:
+
+        U32 m_numberThreads;                                    ///< Number of physics threads (1 when single threaded).
+        btThreadSupportInterface *m_collisionThreadsPtr;        ///< Threads running the narrowphase tasks (NULL when single threaded).
+        btThreadSupportInterface *m_solverThreadsPtr;           ///< Threads running the solver tasks (NULL when single threaded).
+        btDefaultCollisionConfiguration *m_collisionConfigurationPtr;   ///< Controls Bullets memory pools for the collision pass.
+        btCollisionDispatcher *m_dispatcherPtr;                 ///< Narrowphase collision detection.
+        btBroadphaseInterface *m_broadphasePtr;                 ///< Broadphase collision detection.
+        btConstraintSolver *m_solverPtr;                        ///< Contact and constraint solver.
+        BulletDynamicsWorld *m_dynamicsWorldPtr;                ///< The world.
+
+        // /////////////////////////////////////////////////////////////////
+        // Create the threaded dispatcher and solver.
+        //
+        // @return bool True on success.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool CreateMultithreadedComponents();
+
+        // /////////////////////////////////////////////////////////////////
+        // Destroy all the components (safe to call more than once).
+        //
+        // /////////////////////////////////////////////////////////////////
+        void Destroy();
+
+    public:
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.  Nothing is created until Initialize() is called.
+        //
+        // @param numberThreads Number of threads the dispatcher and
+        //                      solver should use.  0 or 1 for the single
+        //                      threaded components.
+        //
+        // /////////////////////////////////////////////////////////////////
+        explicit BulletWorldComponents(const U32 numberThreads);
+
+        // /////////////////////////////////////////////////////////////////
+        // Destructor.  Any collision objects still in the world must have
+        // been removed (and deleted) by the owner.
+        //
+        // /////////////////////////////////////////////////////////////////
+        ~BulletWorldComponents();
+
+        // /////////////////////////////////////////////////////////////////
+        // Create the Bullet components.
+        //
+        // @return bool True on success or false on failure.
+        //
+        // /////////////////////////////////////////////////////////////////
+        bool Initialize();
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the world (NULL before Initialize() succeeds).
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline BulletDynamicsWorld *GetWorld() const {
+            return (m_dynamicsWorldPtr);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Get the number of threads stepping the world (1 when single
+        // threaded).
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline U32 GetNumberThreads() const {
+            return (m_numberThreads);
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Is the multithreaded dispatcher and solver in use?
+        //
+        // /////////////////////////////////////////////////////////////////
+        inline bool IsMultithreaded() const {
+            return (m_numberThreads > 1);
+        };
+    };
+
+}
+
+#endif
@@ -58,6 +58,7 @@
 //
 // /////////////////////////////////////////////////////////////////
 
+#include <string>
 #include <vector>
 
 #include <boost/shared_ptr.hpp>
@@ -71,6 +72,8 @@
 
 namespace GameHalloran {
 
+    class WorkerThreadPool;
+
     typedef U32 PhysicsObjectId;
 
     // /////////////////////////////////////////////////////////////////
@@ -148,6 +151,8 @@ namespace GameHalloran {
         F32 m_angularDamping;                       ///< Angular damping.
         F32 m_mass;                                 ///< Body mass.
         Vector3 m_inertia;                          ///< The bodies inertia tensor.
+        F32 m_ccdMotionThreshold;                   ///< Use continuous collision detection when the body moves further than this in a step (0 disables it).
+        F32 m_ccdSweptSphereRadius;                 ///< Radius of the sphere swept through the step by continuous collision detection.
 
         // Parameters for SoftBody types only (TODO: Add these later...).
 
@@ -156,7 +161,8 @@ namespace GameHalloran {
         //
         // /////////////////////////////////////////////////////////////////
         PhysicsObjectAttributes() : m_id(0), m_bodyType(eInvalidBody), m_objectType(eInvalidObject), m_actorId(), m_active(false), m_friction(0.0f), m_restitution(0.0f), \
-            m_collisionGroup(0), m_collisionMask(0), m_objMatrix(), m_linearVelocity(), m_linearDamping(0.0f), m_angularVelocity(), m_angularDamping(0.0f), m_mass(0.0f), m_inertia() {};
+            m_collisionGroup(0), m_collisionMask(0), m_objMatrix(), m_linearVelocity(), m_linearDamping(0.0f), m_angularVelocity(), m_angularDamping(0.0f), m_mass(0.0f), m_inertia(), \
+            m_ccdMotionThreshold(0.0f), m_ccdSweptSphereRadius(0.0f) {};
 
         // /////////////////////////////////////////////////////////////////
         // Is the object currently moving in the simulation.
@@ -183,6 +189,56 @@ namespace GameHalloran {
         };
     };
 
+    // /////////////////////////////////////////////////////////////////
+    // @struct PhysicsRay
+    // @author PJ O Halloran
+    //
+    // A line segment to test against the physics world with
+    // IGamePhysics::VRayCastBatch() or VSphereSweepBatch().  The group
+    // and mask filter the objects tested in the same way as the
+    // collision group and mask of PhysicsObjectAttributes.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct PhysicsRay {
+        Point3 m_from;                              ///< Start of the segment.
+        Point3 m_to;                                ///< End of the segment.
+        I32 m_collisionGroup;                       ///< Collision group the ray belongs to.
+        I32 m_collisionMask;                        ///< Collision groups the ray hits.
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.  By default the ray is in the default group and hits
+        // every group.
+        //
+        // /////////////////////////////////////////////////////////////////
+        PhysicsRay(const Point3 &from = Point3(), const Point3 &to = Point3(), const I32 collisionGroup = 1, const I32 collisionMask = -1)\
+            : m_from(from), m_to(to), m_collisionGroup(collisionGroup), m_collisionMask(collisionMask) {};
+    };
+
+    typedef std::vector<PhysicsRay> PhysicsRayVec;
+
+    // /////////////////////////////////////////////////////////////////
+    // @struct PhysicsRayHit
+    // @author PJ O Halloran
+    //
+    // The closest hit along a PhysicsRay.
+    //
+    // /////////////////////////////////////////////////////////////////
+    struct PhysicsRayHit {
+        bool m_hit;                                 ///< Did the ray hit anything?
+        boost::optional<ActorId> m_actorId;         ///< Actor that was hit (not set for bodies without an actor).
+        Point3 m_point;                             ///< World space point of contact.
+        Vector3 m_normal;                           ///< World space surface normal at the point of contact.
+        F32 m_fraction;                             ///< How far along the ray the hit is (0 at m_from to 1 at m_to).
+
+        // /////////////////////////////////////////////////////////////////
+        // Constructor.
+        //
+        // /////////////////////////////////////////////////////////////////
+        PhysicsRayHit() : m_hit(false), m_actorId(), m_point(), m_normal(), m_fraction(1.0f) {};
+    };
+
+    typedef std::vector<PhysicsRayHit> PhysicsRayHitVec;
+
     // /////////////////////////////////////////////////////////////////
     // @class IGamePhysics
     // @author Michael L. McShaffry (edited by PJ O Halloran).
@@ -210,7 +266,8 @@ namespace GameHalloran {
 
         // /////////////////////////////////////////////////////////////////
         // Propagate reported physics changes throughout the system using
-        // the game event framework.
+        // the game event framework.  The actors which moved are sent in a
+        // single EvtData_Move_Actors event.
         //
         // /////////////////////////////////////////////////////////////////
         virtual void VSyncVisibleScene() = 0;
@@ -268,18 +325,22 @@ namespace GameHalloran {
         //
         // @param mesh The triangle mesh.
         // @param physicsObjectAtt The physics object attributes of the object.
+        // @param meshName Name of the mesh resource.  Actors added with the
+        //                  same mesh name share a single collision shape.
         //
         // /////////////////////////////////////////////////////////////////
-        virtual void VAddStaticMesh(const TriangleMesh &mesh, struct PhysicsObjectAttributes &physicsObjectAtt) = 0;
+        virtual void VAddStaticMesh(const TriangleMesh &mesh, struct PhysicsObjectAttributes &physicsObjectAtt, const std::string &meshName = std::string()) = 0;
 
         // /////////////////////////////////////////////////////////////////
         // Add a static triangle mesh object (0 mass) to the physics world.
         //
         // @param batch The OpenGL rendering triangle batch.
         // @param physicsObjectAtt The physics object attributes of the object.
+        // @param meshName Name of the mesh resource.  Actors added with the
+        //                  same mesh name share a single collision shape.
         //
         // /////////////////////////////////////////////////////////////////
-        virtual void VAddStaticMesh(const GLTriangleBatch &batch, struct PhysicsObjectAttributes &physicsObjectAtt) = 0;
+        virtual void VAddStaticMesh(const GLTriangleBatch &batch, struct PhysicsObjectAttributes &physicsObjectAtt, const std::string &meshName = std::string()) = 0;
 
         // /////////////////////////////////////////////////////////////////
         // Get the current status of a physics object in the simulation.
@@ -462,6 +523,41 @@ namespace GameHalloran {
         //
         // /////////////////////////////////////////////////////////////////
         virtual void VTranslate(const ActorId actorId, const Vector3 &vec) = 0;
+
+        // /////////////////////////////////////////////////////////////////
+        // Physics world queries.
+        //
+        // Find the closest object hit by each of a batch of rays.  Trigger
+        // volumes are never hit.
+        //
+        // @param rays The rays to cast.
+        // @param hits Resized to hold the result of each ray, in the same
+        //                  order as rays.
+        // @param poolPtr Worker threads to share large batches with (NULL
+        //                  to cast every ray on the calling thread).  The
+        //                  call blocks until the whole batch is done.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual void VRayCastBatch(const PhysicsRayVec &rays, PhysicsRayHitVec &hits, boost::shared_ptr<WorkerThreadPool> poolPtr = boost::shared_ptr<WorkerThreadPool>()) const = 0;
+
+        // /////////////////////////////////////////////////////////////////
+        // Physics world queries.
+        //
+        // Sweep a sphere along each of a batch of rays and find the first
+        // object it touches (e.g. where a ball struck along an aim line
+        // would first make contact).  Trigger volumes are never hit.
+        //
+        // @param rays The paths of the centre of the sphere.
+        // @param radius Radius of the sphere.
+        // @param hits Resized to hold the result of each sweep, in the same
+        //                  order as rays.  The centre of the sphere at the
+        //                  time of contact is m_fraction along the ray.
+        // @param poolPtr Worker threads to share large batches with (NULL
+        //                  to sweep on the calling thread).  The call blocks
+        //                  until the whole batch is done.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual void VSphereSweepBatch(const PhysicsRayVec &rays, const F32 radius, PhysicsRayHitVec &hits, boost::shared_ptr<WorkerThreadPool> poolPtr = boost::shared_ptr<WorkerThreadPool>()) const = 0;
     };
 }
 
@@ -142,18 +142,22 @@ namespace GameHalloran {
         //
         // @param mesh The triangle mesh.
         // @param physicsObjectAtt The physics object attributes of the object.
+        // @param meshName Name of the mesh resource.  Actors added with the
+        //                  same mesh name share a single collision shape.
         //
         // /////////////////////////////////////////////////////////////////
-        virtual void VAddStaticMesh(const TriangleMesh &mesh, struct PhysicsObjectAttributes &physicsObjectAtt) {};
+        virtual void VAddStaticMesh(const TriangleMesh &mesh, struct PhysicsObjectAttributes &physicsObjectAtt, const std::string &meshName = std::string()) {};
 
         // /////////////////////////////////////////////////////////////////
         // Add a static triangle mesh object (0 mass) to the physics world.
         //
         // @param batch The OpenGL rendering triangle batch.
         // @param physicsObjectAtt The physics object attributes of the object.
+        // @param meshName Name of the mesh resource.  Actors added with the
+        //                  same mesh name share a single collision shape.
         //
         // /////////////////////////////////////////////////////////////////
-        virtual void VAddStaticMesh(const GLTriangleBatch &batch, struct PhysicsObjectAttributes &physicsObjectAtt) {};
+        virtual void VAddStaticMesh(const GLTriangleBatch &batch, struct PhysicsObjectAttributes &physicsObjectAtt, const std::string &meshName = std::string()) {};
 
         // /////////////////////////////////////////////////////////////////
         // Get the current status of a physics object in the simulation.
@@ -344,6 +348,22 @@ namespace GameHalloran {
         //
         // /////////////////////////////////////////////////////////////////
         virtual void VTranslate(const ActorId actorId, const Vector3 &vec) { };
+
+        // /////////////////////////////////////////////////////////////////
+        // Physics world queries.  Nothing is ever hit.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual void VRayCastBatch(const PhysicsRayVec &rays, PhysicsRayHitVec &hits, boost::shared_ptr<WorkerThreadPool> poolPtr = boost::shared_ptr<WorkerThreadPool>()) const {
+            hits.assign(rays.size(), PhysicsRayHit());
+        };
+
+        // /////////////////////////////////////////////////////////////////
+        // Physics world queries.  Nothing is ever hit.
+        //
+        // /////////////////////////////////////////////////////////////////
+        virtual void VSphereSweepBatch(const PhysicsRayVec &rays, const F32 radius, PhysicsRayHitVec &hits, boost::shared_ptr<WorkerThreadPool> poolPtr = boost::shared_ptr<WorkerThreadPool>()) const {
+            hits.assign(rays.size(), PhysicsRayHit());
+        };
     };
 
 
@@ -0,0 +1,205 @@
+#pragma once
+#ifndef __ATLAS_DICTIONARY_TEST_SUITE_H
+#define __ATLAS_DICTIONARY_TEST_SUITE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file AtlasDictionaryTestSuite.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the header for the binary atlas dictionary Test Suite.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include "tinyxml/tinyxml.h"
+
+#include "AtlasDictionary.h"
+#include "HashedString.h"
+
+// /////////////////////////////////////////////////////////////////
+// @class AtlasDictionaryTestSuite
+// @author PJ O Halloran
+//
+// This class defines a series of unit tests for the binary atlas
+// dictionary.
+//
+// /////////////////////////////////////////////////////////////////
+class AtlasDictionaryTestSuite : public CxxTest::TestSuite {
+private:
+
+    typedef GameHalloran::U8 U8;
+    typedef GameHalloran::U32 U32;
+    typedef GameHalloran::U64 U64;
+
+    // /////////////////////////////////////////////////////////////////
+    // Add an <Image> element to an <Atlas> element.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static void AddImage(TiXmlElement &atlasElemRef, const char *name, const int x, const int y, const int width, const int height, const bool flipped) {
+        TiXmlElement imageElem("Image");
+        imageElem.SetAttribute("flipped", flipped ? "True" : "False");
+        imageElem.SetAttribute("height", height);
+        imageElem.SetAttribute("name", name);
+        imageElem.SetAttribute("width", width);
+        imageElem.SetAttribute("x", x);
+        imageElem.SetAttribute("y", y);
+        atlasElemRef.InsertEndChild(imageElem);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Create an <Atlas> element.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static TiXmlElement CreateAtlas(const char *name, const int width, const int height) {
+        TiXmlElement atlasElem("Atlas");
+        atlasElem.SetAttribute("border", 1);
+        atlasElem.SetAttribute("height", height);
+        atlasElem.SetAttribute("mode", "RGBA");
+        atlasElem.SetAttribute("name", name);
+        atlasElem.SetAttribute("type", "tga");
+        atlasElem.SetAttribute("width", width);
+        return (atlasElem);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Hash a name as HashedString does.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static U64 Hash(const char *name) {
+        return (GameHalloran::HashedString(name).getHashValue());
+    };
+
+public:
+
+    // /////////////////////////////////////////////////////////////////
+    // Test atlases survive encoding and parsing, with their images
+    // sorted by hash and converted to texture coordinates.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testRoundTrip(void) {
+        TiXmlElement uiElem(CreateAtlas("UI", 256, 128));
+        AddImage(uiElem, "pBut.tga", 0, 0, 64, 32, false);
+        AddImage(uiElem, "quitBut.tga", 64, 32, 32, 16, true);
+        AddImage(uiElem, "background.tga", 128, 64, 128, 64, false);
+        TiXmlElement gameElem(CreateAtlas("INGAME", 64, 64));
+        AddImage(gameElem, "cue.tga", 2, 4, 8, 16, false);
+
+        std::vector<const TiXmlElement *> atlasElemVec;
+        atlasElemVec.push_back(&uiElem);
+        atlasElemVec.push_back(&gameElem);
+        std::vector<U8> dictionary;
+        TS_ASSERT(GameHalloran::EncodeAtlasDictionary(atlasElemVec, dictionary));
+
+        std::vector<GameHalloran::AtlasDictionaryAtlas> atlases;
+        std::vector<GameHalloran::AtlasDictionaryImage> images;
+        TS_ASSERT(GameHalloran::ParseAtlasDictionary(&dictionary[0], dictionary.size(), atlases, images));
+        TS_ASSERT_EQUALS(atlases.size(), 2u);
+        TS_ASSERT_EQUALS(images.size(), 4u);
+        if(atlases.size() != 2 || images.size() != 4) {
+            return;
+        }
+
+        TS_ASSERT_EQUALS(std::string(atlases[0].m_name), std::string("UI"));
+        TS_ASSERT_EQUALS(std::string(atlases[0].m_mode), std::string("RGBA"));
+        TS_ASSERT_EQUALS(std::string(atlases[0].m_type), std::string("tga"));
+        TS_ASSERT_EQUALS(atlases[0].m_border, 1u);
+        TS_ASSERT_EQUALS(atlases[0].m_width, 256u);
+        TS_ASSERT_EQUALS(atlases[0].m_height, 128u);
+        TS_ASSERT_EQUALS(atlases[0].m_firstImage, 0u);
+        TS_ASSERT_EQUALS(atlases[0].m_numberImages, 3u);
+        TS_ASSERT_EQUALS(std::string(atlases[1].m_name), std::string("INGAME"));
+        TS_ASSERT_EQUALS(atlases[1].m_firstImage, 3u);
+        TS_ASSERT_EQUALS(atlases[1].m_numberImages, 1u);
+
+        for(U32 i = 0; i < images.size(); ++i) {
+            TS_ASSERT_EQUALS(images[i].m_hash, Hash(images[i].m_name));
+        }
+        TS_ASSERT(images[0].m_hash < images[1].m_hash && images[1].m_hash < images[2].m_hash);
+
+        for(U32 i = 0; i < 3; ++i) {
+            if(std::string(images[i].m_name) == "quitBut.tga") {
+                TS_ASSERT_DELTA(images[i].m_x, 0.25f, 1e-6f);
+                TS_ASSERT_DELTA(images[i].m_y, 0.75f, 1e-6f);
+                TS_ASSERT_DELTA(images[i].m_width, 0.125f, 1e-6f);
+                TS_ASSERT_DELTA(images[i].m_height, 0.125f, 1e-6f);
+                TS_ASSERT(images[i].m_flipped);
+            } else {
+                TS_ASSERT(!images[i].m_flipped);
+            }
+        }
+        TS_ASSERT_EQUALS(std::string(images[3].m_name), std::string("cue.tga"));
+        TS_ASSERT_DELTA(images[3].m_y, 1.0f - 4.0f / 64.0f, 1e-6f);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test the last of the images with the same name is kept, as when
+    // the xml was read into a map.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testDuplicateImages(void) {
+        TiXmlElement atlasElem(CreateAtlas("UI", 64, 64));
+        AddImage(atlasElem, "icon.tga", 0, 0, 16, 16, false);
+        AddImage(atlasElem, "ICON.tga", 32, 0, 16, 16, false);
+
+        std::vector<U8> dictionary;
+        TS_ASSERT(GameHalloran::EncodeAtlasDictionary(std::vector<const TiXmlElement *>(1, &atlasElem), dictionary));
+        std::vector<GameHalloran::AtlasDictionaryAtlas> atlases;
+        std::vector<GameHalloran::AtlasDictionaryImage> images;
+        TS_ASSERT(GameHalloran::ParseAtlasDictionary(&dictionary[0], dictionary.size(), atlases, images));
+        TS_ASSERT_EQUALS(images.size(), 1u);
+        if(images.size() == 1) {
+            TS_ASSERT_EQUALS(std::string(images[0].m_name), std::string("ICON.tga"));
+            TS_ASSERT_DELTA(images[0].m_x, 0.5f, 1e-6f);
+        }
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test bad input is rejected.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testInvalidData(void) {
+        TiXmlElement noNameElem("Atlas");
+        noNameElem.SetAttribute("width", 64);
+        noNameElem.SetAttribute("height", 64);
+        std::vector<U8> dictionary;
+        TS_ASSERT(!GameHalloran::EncodeAtlasDictionary(std::vector<const TiXmlElement *>(1, &noNameElem), dictionary));
+
+        TiXmlElement atlasElem(CreateAtlas("UI", 64, 64));
+        AddImage(atlasElem, "a.tga", 0, 0, 8, 8, false);
+        AddImage(atlasElem, "b.tga", 8, 0, 8, 8, false);
+        TS_ASSERT(GameHalloran::EncodeAtlasDictionary(std::vector<const TiXmlElement *>(1, &atlasElem), dictionary));
+
+        std::vector<GameHalloran::AtlasDictionaryAtlas> atlases;
+        std::vector<GameHalloran::AtlasDictionaryImage> images;
+        TS_ASSERT(!GameHalloran::ParseAtlasDictionary(NULL, 0, atlases, images));
+        TS_ASSERT(!GameHalloran::ParseAtlasDictionary(&dictionary[0], dictionary.size() - 1, atlases, images));
+
+        std::vector<U8> corrupt(dictionary);
+        corrupt[0] = 'X';
+        TS_ASSERT(!GameHalloran::ParseAtlasDictionary(&corrupt[0], corrupt.size(), atlases, images));
+
+        // Swap the two image records so they are out of order.
+        corrupt = dictionary;
+        std::swap_ranges(corrupt.begin() + 52, corrupt.begin() + 84, corrupt.begin() + 84);
+        TS_ASSERT(!GameHalloran::ParseAtlasDictionary(&corrupt[0], corrupt.size(), atlases, images));
+
+        // Rename the first image so its hash no longer matches.
+        corrupt = dictionary;
+        TS_ASSERT_EQUALS(corrupt[116], U8('a'));
+        corrupt[116] = 'c';
+        TS_ASSERT(!GameHalloran::ParseAtlasDictionary(&corrupt[0], corrupt.size(), atlases, images));
+
+        // A huge image count must not wrap the size checks.
+        corrupt = dictionary;
+        corrupt[12] = corrupt[13] = corrupt[14] = corrupt[15] = 0xFF;
+        TS_ASSERT(!GameHalloran::ParseAtlasDictionary(&corrupt[0], corrupt.size(), atlases, images));
+    };
+};
+
+#endif
@@ -0,0 +1,256 @@
+#pragma once
+#ifndef __ATLAS_PACKER_TEST_SUITE_H
+#define __ATLAS_PACKER_TEST_SUITE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file AtlasPackerTestSuite.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the header for the AtlasPacker Test Suite.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <boost/scoped_ptr.hpp>
+
+#include <cxxtest/TestSuite.h>
+
+#include "tinyxml/tinyxml.h"
+
+#include "AtlasPacker.h"
+
+// /////////////////////////////////////////////////////////////////
+// @class AtlasPackerTestSuite
+// @author PJ O Halloran
+//
+// This class defines a series of unit tests for the AtlasPacker class.
+//
+// /////////////////////////////////////////////////////////////////
+class AtlasPackerTestSuite : public CxxTest::TestSuite {
+private:
+
+    typedef GameHalloran::U8 U8;
+    typedef GameHalloran::U32 U32;
+
+    // /////////////////////////////////////////////////////////////////
+    // Add a mix of pseudo random sprite sizes.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static void AddSprites(GameHalloran::AtlasPacker &packerRef, const U32 number, U32 seed) {
+        for(U32 i = 0; i < number; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            const U32 width = 4 + (seed >> 8) % 60;
+            seed = seed * 1664525u + 1013904223u;
+            const U32 height = 4 + (seed >> 8) % 60;
+            packerRef.AddImage("sprite", width, height);
+        }
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Check every image (plus border) is inside the atlas and no two
+    // overlap.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static bool IsValidLayout(const GameHalloran::AtlasPacker &packerRef) {
+        const U32 border = packerRef.GetOptions().m_border;
+        std::vector<U8> covered(packerRef.GetWidth() * packerRef.GetHeight(), 0);
+        for(U32 i = 0; i < packerRef.GetNumberImages(); ++i) {
+            const GameHalloran::AtlasPackedImage &imageRef = packerRef.GetImage(i);
+            const U32 width = (imageRef.m_flipped ? imageRef.m_height : imageRef.m_width) + border * 2;
+            const U32 height = (imageRef.m_flipped ? imageRef.m_width : imageRef.m_height) + border * 2;
+            if(imageRef.m_x < border || imageRef.m_y < border || imageRef.m_x - border + width > packerRef.GetWidth() || \
+               imageRef.m_y - border + height > packerRef.GetHeight()) {
+                return (false);
+            }
+            for(U32 y = imageRef.m_y - border; y < imageRef.m_y - border + height; ++y) {
+                for(U32 x = imageRef.m_x - border; x < imageRef.m_x - border + width; ++x) {
+                    if(covered[y * packerRef.GetWidth() + x]++ != 0) {
+                        return (false);
+                    }
+                }
+            }
+        }
+        return (true);
+    };
+
+public:
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testMethodNames(void) {
+        TS_ASSERT_EQUALS(GameHalloran::FindAtlasPackingMethodFromString("MaxRects"), GameHalloran::ATLAS_PACKING_MAX_RECTS);
+        TS_ASSERT_EQUALS(GameHalloran::FindAtlasPackingMethodFromString("skyline"), GameHalloran::ATLAS_PACKING_SKYLINE);
+        TS_ASSERT_EQUALS(GameHalloran::FindAtlasPackingMethodFromString("guillotine"), GameHalloran::ATLAS_PACKING_UNKNOWN);
+        TS_ASSERT_EQUALS(std::string(GameHalloran::FindStringFromAtlasPackingMethod(GameHalloran::ATLAS_PACKING_SKYLINE)), std::string("skyline"));
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testPackValidLayouts(void) {
+        for(U32 method = GameHalloran::ATLAS_PACKING_FIRST; method < GameHalloran::ATLAS_PACKING_COUNT; ++method) {
+            for(U32 flags = 0; flags < 4; ++flags) {
+                GameHalloran::AtlasPackerOptions options;
+                options.m_method = GameHalloran::AtlasPackingMethod(method);
+                options.m_allowRotation = (flags & 1) != 0;
+                options.m_powerOfTwo = (flags & 2) != 0;
+                options.m_border = flags;
+                GameHalloran::AtlasPacker packer(options);
+                AddSprites(packer, 300, method * 4 + flags);
+                TS_ASSERT(packer.Pack());
+                TS_ASSERT(IsValidLayout(packer));
+                if(options.m_powerOfTwo) {
+                    TS_ASSERT_EQUALS(packer.GetWidth() & (packer.GetWidth() - 1), 0u);
+                    TS_ASSERT_EQUALS(packer.GetHeight() & (packer.GetHeight() - 1), 0u);
+                } else {
+                    TS_ASSERT(packer.GetOccupancy() > 0.7f);
+                }
+            }
+        }
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testPackFailures(void) {
+        GameHalloran::AtlasPacker packer;
+        TS_ASSERT(!packer.Pack());
+
+        GameHalloran::AtlasPackerOptions options;
+        options.m_maxSize = 64;
+        GameHalloran::AtlasPacker small(options);
+        small.AddImage("wide", 70, 8);
+        TS_ASSERT(!small.Pack());
+        TS_ASSERT(!small.IsPacked());
+
+        // Fits on its side.
+        options.m_allowRotation = true;
+        GameHalloran::AtlasPacker rotated(options);
+        rotated.AddImage("wide", 60, 8);
+        rotated.AddImage("tall", 8, 60);
+        TS_ASSERT(rotated.Pack());
+        TS_ASSERT(IsValidLayout(rotated));
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testRotation(void) {
+        // A tall strip beside a wide one only fits a 32 by 32 atlas if
+        // one of them is turned.
+        GameHalloran::AtlasPackerOptions options;
+        options.m_border = 0;
+        options.m_maxSize = 32;
+        GameHalloran::AtlasPacker packer(options);
+        packer.AddImage("a", 32, 16);
+        packer.AddImage("b", 16, 32);
+        TS_ASSERT(!packer.Pack());
+
+        options.m_allowRotation = true;
+        GameHalloran::AtlasPacker exact(options);
+        exact.AddImage("a", 32, 16);
+        exact.AddImage("b", 16, 32);
+        TS_ASSERT(exact.Pack());
+        TS_ASSERT(IsValidLayout(exact));
+        TS_ASSERT_EQUALS(exact.GetWidth(), 32u);
+        TS_ASSERT_EQUALS(exact.GetHeight(), 32u);
+        TS_ASSERT(exact.GetImage(0).m_flipped != exact.GetImage(1).m_flipped);
+        TS_ASSERT_DELTA(exact.GetOccupancy(), 1.0f, 1e-6f);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testCopyImage(void) {
+        // A 2 by 3 image, rows bottom up, texel value = 10 * row + column.
+        U8 rgba[2 * 3 * 4];
+        for(U32 row = 0; row < 3; ++row) {
+            for(U32 col = 0; col < 2; ++col) {
+                memset(&rgba[(row * 2 + col) * 4], int(10 * row + col), 4);
+            }
+        }
+
+        GameHalloran::AtlasPackerOptions options;
+        options.m_border = 1;
+        GameHalloran::AtlasPacker packer(options);
+        packer.AddImage("img", 2, 3);
+        TS_ASSERT(packer.Pack());
+        TS_ASSERT_EQUALS(packer.GetWidth(), 4u);
+        TS_ASSERT_EQUALS(packer.GetHeight(), 8u);
+        TS_ASSERT_EQUALS(packer.GetImage(0).m_x, 1u);
+        TS_ASSERT_EQUALS(packer.GetImage(0).m_y, 1u);
+
+        std::vector<U8> atlas(4 * 8 * 4, 0xff);
+        packer.CopyImage(0, rgba, &atlas[0]);
+        // The top of the image is atlas row 1 from the top, 6 from the
+        // bottom, with the border above repeating it.
+        TS_ASSERT_EQUALS(atlas[(6 * 4 + 1) * 4], 20);
+        TS_ASSERT_EQUALS(atlas[(6 * 4 + 2) * 4], 21);
+        TS_ASSERT_EQUALS(atlas[(7 * 4 + 0) * 4], 20);
+        TS_ASSERT_EQUALS(atlas[(4 * 4 + 1) * 4], 0);
+        TS_ASSERT_EQUALS(atlas[(4 * 4 + 3) * 4], 1);
+        TS_ASSERT_EQUALS(atlas[(3 * 4 + 3) * 4], 1);
+        TS_ASSERT_EQUALS(atlas[(2 * 4 + 3) * 4], 0xff);
+
+        // Rotated clockwise the image's left column becomes the top row.
+        options.m_border = 0;
+        options.m_allowRotation = true;
+        GameHalloran::AtlasPacker rotated(options);
+        rotated.AddImage("img", 2, 3);
+        rotated.AddImage("bar", 4, 2);
+        rotated.AddImage("bar", 4, 2);
+        TS_ASSERT(rotated.Pack());
+        TS_ASSERT(IsValidLayout(rotated));
+        const GameHalloran::AtlasPackedImage &imageRef = rotated.GetImage(0);
+        if(imageRef.m_flipped) {
+            std::vector<U8> rotatedAtlas(rotated.GetWidth() * rotated.GetHeight() * 4, 0xff);
+            rotated.CopyImage(0, rgba, &rotatedAtlas[0]);
+            const U32 topRow = rotated.GetHeight() - 1 - imageRef.m_y;
+            TS_ASSERT_EQUALS(rotatedAtlas[(topRow * rotated.GetWidth() + imageRef.m_x) * 4], 0);
+            TS_ASSERT_EQUALS(rotatedAtlas[(topRow * rotated.GetWidth() + imageRef.m_x + 2) * 4], 20);
+            TS_ASSERT_EQUALS(rotatedAtlas[((topRow - 1) * rotated.GetWidth() + imageRef.m_x + 2) * 4], 21);
+        }
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testCreateXmlElement(void) {
+        GameHalloran::AtlasPacker packer;
+        packer.AddImage("button", 30, 10);
+        packer.AddImage("icon", 16, 16);
+        TS_ASSERT(packer.Pack());
+
+        boost::scoped_ptr<TiXmlElement> atlasElemPtr(packer.CreateXmlElement("UI", "RGBA", "tga"));
+        TS_ASSERT_EQUALS(std::string(atlasElemPtr->Value()), std::string("Atlas"));
+        TS_ASSERT_EQUALS(std::string(atlasElemPtr->Attribute("name")), std::string("UI"));
+        TS_ASSERT_EQUALS(std::string(atlasElemPtr->Attribute("mode")), std::string("RGBA"));
+        TS_ASSERT_EQUALS(std::string(atlasElemPtr->Attribute("type")), std::string("tga"));
+        int value = 0;
+        atlasElemPtr->Attribute("width", &value);
+        TS_ASSERT_EQUALS(U32(value), packer.GetWidth());
+        atlasElemPtr->Attribute("border", &value);
+        TS_ASSERT_EQUALS(value, 1);
+
+        U32 count = 0;
+        for(TiXmlElement *imageElemPtr = atlasElemPtr->FirstChildElement("Image"); imageElemPtr; imageElemPtr = imageElemPtr->NextSiblingElement("Image"), ++count) {
+            const GameHalloran::AtlasPackedImage &imageRef = packer.GetImage(count);
+            TS_ASSERT_EQUALS(std::string(imageElemPtr->Attribute("name")), imageRef.m_name);
+            TS_ASSERT_EQUALS(std::string(imageElemPtr->Attribute("flipped")), std::string("False"));
+            imageElemPtr->Attribute("x", &value);
+            TS_ASSERT_EQUALS(U32(value), imageRef.m_x);
+            imageElemPtr->Attribute("y", &value);
+            TS_ASSERT_EQUALS(U32(value), imageRef.m_y);
+            imageElemPtr->Attribute("height", &value);
+            TS_ASSERT_EQUALS(U32(value), imageRef.m_height);
+        }
+        TS_ASSERT_EQUALS(count, 2u);
+    };
+};
+
+#endif
@@ -0,0 +1,168 @@
+#pragma once
+#ifndef __BULLET_COLLISION_PAIR_TRACKER_TEST_SUITE_H
+#define __BULLET_COLLISION_PAIR_TRACKER_TEST_SUITE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file BulletCollisionPairTrackerTestSuite.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the header for the BulletCollisionPairTracker Test
+// Suite.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <cxxtest/TestSuite.h>
+
+#include "BulletCollisionPairTracker.h"
+
+// /////////////////////////////////////////////////////////////////
+// @class BulletCollisionPairTrackerTestSuite
+// @author PJ O Halloran
+//
+// This class defines a series of unit tests for the
+// BulletCollisionPairTracker class.
+//
+// /////////////////////////////////////////////////////////////////
+class BulletCollisionPairTrackerTestSuite : public CxxTest::TestSuite {
+private:
+
+    typedef GameHalloran::BulletCollisionPairTracker BulletCollisionPairTracker;
+    typedef GameHalloran::U32 U32;
+
+    enum { NUMBER_BODIES = 6 };
+
+    btCollisionObject m_bodies[NUMBER_BODIES];
+
+    // /////////////////////////////////////////////////////////////////
+    // Create a manifold between two bodies.
+    //
+    // /////////////////////////////////////////////////////////////////
+    btPersistentManifold Manifold(const U32 a, const U32 b) {
+        return (btPersistentManifold(&m_bodies[a], &m_bodies[b], 0, 0.02f, 0.02f));
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Is a pair of bodies in a list of contacts?
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool HasPair(const BulletCollisionPairTracker::ContactVec &contacts, const U32 a, const U32 b) {
+        for(BulletCollisionPairTracker::ContactVec::const_iterator i = contacts.begin(), end = contacts.end(); i != end; ++i) {
+            if((i->m_bodyAPtr == &m_bodies[a] && i->m_bodyBPtr == &m_bodies[b]) || (i->m_bodyAPtr == &m_bodies[b] && i->m_bodyBPtr == &m_bodies[a])) {
+                return (true);
+            }
+        }
+        return (false);
+    };
+
+public:
+
+    // /////////////////////////////////////////////////////////////////
+    // Constructor.
+    //
+    // /////////////////////////////////////////////////////////////////
+    BulletCollisionPairTrackerTestSuite() : CxxTest::TestSuite() {
+
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Destructor.
+    //
+    // /////////////////////////////////////////////////////////////////
+    ~BulletCollisionPairTrackerTestSuite() {
+
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testAddedAndRemoved(void) {
+        BulletCollisionPairTracker obj;
+        const btPersistentManifold m01 = Manifold(0, 1), m21 = Manifold(2, 1), m34 = Manifold(3, 4), m43 = Manifold(4, 3);
+
+        obj.BeginTick();
+        obj.AddContact(&m01);
+        obj.AddContact(&m21);
+        obj.EndTick();
+        TS_ASSERT_EQUALS(obj.GetAdded().size(), 2);
+        TS_ASSERT(obj.GetRemoved().empty());
+        TS_ASSERT(HasPair(obj.GetAdded(), 0, 1));
+        TS_ASSERT(HasPair(obj.GetAdded(), 1, 2));
+        TS_ASSERT_EQUALS(obj.GetNumberPairs(), 2);
+
+        // The bodies of a pair are ordered and the manifold is kept.
+        for(U32 i = 0; i < obj.GetAdded().size(); ++i) {
+            const BulletCollisionPairTracker::Contact &contact = obj.GetAdded()[i];
+            TS_ASSERT(contact.m_bodyAPtr < contact.m_bodyBPtr);
+            TS_ASSERT(contact.m_manifoldPtr == &m01 || contact.m_manifoldPtr == &m21);
+        }
+
+        // Same pairs again: nothing changes.
+        obj.BeginTick();
+        obj.AddContact(&m21);
+        obj.AddContact(&m01);
+        obj.EndTick();
+        TS_ASSERT(obj.GetAdded().empty());
+        TS_ASSERT(obj.GetRemoved().empty());
+
+        // One pair separates, another starts touching twice (two manifolds).
+        obj.BeginTick();
+        obj.AddContact(&m01);
+        obj.AddContact(&m34);
+        obj.AddContact(&m43);
+        obj.AddContact(NULL);
+        obj.EndTick();
+        TS_ASSERT_EQUALS(obj.GetAdded().size(), 1);
+        TS_ASSERT(HasPair(obj.GetAdded(), 3, 4));
+        TS_ASSERT_EQUALS(obj.GetAdded()[0].m_manifoldPtr, &m34);
+        TS_ASSERT_EQUALS(obj.GetRemoved().size(), 1);
+        TS_ASSERT(HasPair(obj.GetRemoved(), 1, 2));
+        TS_ASSERT(obj.GetRemoved()[0].m_manifoldPtr == NULL);
+        TS_ASSERT_EQUALS(obj.GetNumberPairs(), 2);
+
+        // Everything separates.
+        obj.BeginTick();
+        obj.EndTick();
+        TS_ASSERT(obj.GetAdded().empty());
+        TS_ASSERT_EQUALS(obj.GetRemoved().size(), 2);
+        TS_ASSERT_EQUALS(obj.GetNumberPairs(), 0);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testRemoveBody(void) {
+        BulletCollisionPairTracker obj;
+        const btPersistentManifold m01 = Manifold(0, 1), m12 = Manifold(1, 2), m23 = Manifold(2, 3), m51 = Manifold(5, 1);
+
+        obj.BeginTick();
+        obj.AddContact(&m01);
+        obj.AddContact(&m12);
+        obj.AddContact(&m23);
+        obj.AddContact(&m51);
+        obj.EndTick();
+        TS_ASSERT_EQUALS(obj.GetNumberPairs(), 4);
+
+        obj.RemoveBody(&m_bodies[1]);
+        TS_ASSERT_EQUALS(obj.GetRemoved().size(), 3);
+        TS_ASSERT(HasPair(obj.GetRemoved(), 0, 1));
+        TS_ASSERT(HasPair(obj.GetRemoved(), 1, 2));
+        TS_ASSERT(HasPair(obj.GetRemoved(), 1, 5));
+        TS_ASSERT_EQUALS(obj.GetNumberPairs(), 1);
+
+        obj.RemoveBody(&m_bodies[4]);
+        TS_ASSERT(obj.GetRemoved().empty());
+
+        // The remaining pair is still tracked.
+        obj.BeginTick();
+        obj.AddContact(&m23);
+        obj.EndTick();
+        TS_ASSERT(obj.GetAdded().empty());
+        TS_ASSERT(obj.GetRemoved().empty());
+
+        obj.Clear();
+        TS_ASSERT_EQUALS(obj.GetNumberPairs(), 0);
+    };
+};
+
+#endif
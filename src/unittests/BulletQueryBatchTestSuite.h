@@ -0,0 +1,223 @@
+#pragma once
+#ifndef __BULLET_QUERY_BATCH_TEST_SUITE_H
+#define __BULLET_QUERY_BATCH_TEST_SUITE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file BulletQueryBatchTestSuite.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the header for the BulletQueryBatch Test Suite.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <cxxtest/TestSuite.h>
+
+#include <bullet/BulletCollision/BroadphaseCollision/btDbvtBroadphase.h>
+
+#include "BulletQueryBatch.h"
+
+// /////////////////////////////////////////////////////////////////
+// @class BulletQueryBatchTestSuite
+// @author PJ O Halloran
+//
+// This class defines a series of unit tests for the
+// BulletQueryBatch class.
+//
+// The world has a static ground box with its top at y = 0, a ball of
+// radius 0.5 resting on it at (0, 0.5, 0) and a trigger box above the
+// ball at (0, 3, 0).
+//
+// /////////////////////////////////////////////////////////////////
+class BulletQueryBatchTestSuite : public CxxTest::TestSuite {
+private:
+
+    typedef GameHalloran::BulletQueryBatch BulletQueryBatch;
+    typedef GameHalloran::PhysicsRay PhysicsRay;
+    typedef GameHalloran::PhysicsRayVec PhysicsRayVec;
+    typedef GameHalloran::PhysicsRayHitVec PhysicsRayHitVec;
+    typedef GameHalloran::Point3 Point3;
+    typedef GameHalloran::F32 F32;
+    typedef GameHalloran::I32 I32;
+    typedef GameHalloran::U32 U32;
+
+    btDefaultCollisionConfiguration *m_configPtr;
+    btCollisionDispatcher *m_dispatcherPtr;
+    btDbvtBroadphase *m_broadphasePtr;
+    btCollisionWorld *m_worldPtr;
+    btBoxShape *m_groundShapePtr;
+    btSphereShape *m_ballShapePtr;
+    btBoxShape *m_triggerShapePtr;
+    btCollisionObject m_ground;
+    btCollisionObject m_ball;
+    btCollisionObject m_trigger;
+
+    // /////////////////////////////////////////////////////////////////
+    // Add an object to the world.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void AddObject(btCollisionObject &object, btCollisionShape *shapePtr, const btVector3 &pos, const short group) {
+        object.setCollisionShape(shapePtr);
+        object.setWorldTransform(btTransform(btQuaternion::getIdentity(), pos));
+        m_worldPtr->addCollisionObject(&object, group, btBroadphaseProxy::AllFilter);
+    };
+
+public:
+
+    // /////////////////////////////////////////////////////////////////
+    // Constructor.
+    //
+    // /////////////////////////////////////////////////////////////////
+    BulletQueryBatchTestSuite() : CxxTest::TestSuite(), m_configPtr(NULL), m_dispatcherPtr(NULL), m_broadphasePtr(NULL), m_worldPtr(NULL), \
+        m_groundShapePtr(NULL), m_ballShapePtr(NULL), m_triggerShapePtr(NULL) {
+
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Destructor.
+    //
+    // /////////////////////////////////////////////////////////////////
+    ~BulletQueryBatchTestSuite() {
+
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Create the world.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void setUp() {
+        m_configPtr = new btDefaultCollisionConfiguration();
+        m_dispatcherPtr = new btCollisionDispatcher(m_configPtr);
+        m_broadphasePtr = new btDbvtBroadphase();
+        m_worldPtr = new btCollisionWorld(m_dispatcherPtr, m_broadphasePtr, m_configPtr);
+        m_groundShapePtr = new btBoxShape(btVector3(10.0f, 1.0f, 10.0f));
+        m_ballShapePtr = new btSphereShape(0.5f);
+        m_triggerShapePtr = new btBoxShape(btVector3(1.0f, 1.0f, 1.0f));
+
+        AddObject(m_ground, m_groundShapePtr, btVector3(0.0f, -1.0f, 0.0f), btBroadphaseProxy::StaticFilter);
+        AddObject(m_ball, m_ballShapePtr, btVector3(0.0f, 0.5f, 0.0f), btBroadphaseProxy::DefaultFilter);
+        AddObject(m_trigger, m_triggerShapePtr, btVector3(0.0f, 3.0f, 0.0f), btBroadphaseProxy::DefaultFilter);
+        m_trigger.setCollisionFlags(m_trigger.getCollisionFlags() | btCollisionObject::CF_NO_CONTACT_RESPONSE);
+        m_worldPtr->updateAabbs();
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Destroy the world.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void tearDown() {
+        m_worldPtr->removeCollisionObject(&m_trigger);
+        m_worldPtr->removeCollisionObject(&m_ball);
+        m_worldPtr->removeCollisionObject(&m_ground);
+        delete m_triggerShapePtr;
+        delete m_ballShapePtr;
+        delete m_groundShapePtr;
+        delete m_worldPtr;
+        delete m_broadphasePtr;
+        delete m_dispatcherPtr;
+        delete m_configPtr;
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testRayCast(void) {
+        PhysicsRayVec rays;
+        rays.push_back(PhysicsRay(Point3(0.0f, 5.0f, 0.0f), Point3(0.0f, -5.0f, 0.0f)));     // Through the trigger to the ball.
+        rays.push_back(PhysicsRay(Point3(3.0f, 5.0f, 0.0f), Point3(3.0f, -5.0f, 0.0f)));     // Beside the ball to the ground.
+        rays.push_back(PhysicsRay(Point3(-5.0f, 5.0f, 0.0f), Point3(5.0f, 5.0f, 0.0f)));     // Over everything.
+        rays.push_back(PhysicsRay(Point3(0.0f, 5.0f, 0.0f), Point3(0.0f, 5.0f, 0.0f)));      // Zero length.
+
+        PhysicsRayHitVec hits;
+        BulletQueryBatch obj(*m_worldPtr, rays, NULL, hits);
+        obj.Run(boost::shared_ptr<GameHalloran::WorkerThreadPool>());
+        TS_ASSERT_EQUALS(hits.size(), rays.size());
+
+        TS_ASSERT(hits[0].m_hit);
+        TS_ASSERT_EQUALS(obj.GetHitObject(0), &m_ball);
+        TS_ASSERT_DELTA(hits[0].m_point.GetY(), 1.0f, 0.001f);
+        TS_ASSERT_DELTA(hits[0].m_normal.GetY(), 1.0f, 0.001f);
+        TS_ASSERT_DELTA(hits[0].m_fraction, 0.4f, 0.001f);
+
+        TS_ASSERT(hits[1].m_hit);
+        TS_ASSERT_EQUALS(obj.GetHitObject(1), &m_ground);
+        TS_ASSERT_DELTA(hits[1].m_point.GetX(), 3.0f, 0.001f);
+        TS_ASSERT_DELTA(hits[1].m_point.GetY(), 0.0f, 0.001f);
+
+        TS_ASSERT(!hits[2].m_hit);
+        TS_ASSERT(obj.GetHitObject(2) == NULL);
+        TS_ASSERT(!hits[3].m_hit);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testRayFilter(void) {
+        PhysicsRayVec rays;
+        rays.push_back(PhysicsRay(Point3(0.0f, 5.0f, 0.0f), Point3(0.0f, -5.0f, 0.0f), btBroadphaseProxy::DefaultFilter, btBroadphaseProxy::StaticFilter));
+        rays.push_back(PhysicsRay(Point3(0.0f, 5.0f, 0.0f), Point3(0.0f, -5.0f, 0.0f), btBroadphaseProxy::DefaultFilter, btBroadphaseProxy::KinematicFilter));
+
+        PhysicsRayHitVec hits;
+        BulletQueryBatch obj(*m_worldPtr, rays, NULL, hits);
+        obj.Run(boost::shared_ptr<GameHalloran::WorkerThreadPool>());
+
+        // Only the ground is in the mask of the first ray, nothing is in the second.
+        TS_ASSERT(hits[0].m_hit);
+        TS_ASSERT_EQUALS(obj.GetHitObject(0), &m_ground);
+        TS_ASSERT_DELTA(hits[0].m_point.GetY(), 0.0f, 0.001f);
+        TS_ASSERT(!hits[1].m_hit);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testSphereSweep(void) {
+        PhysicsRayVec rays;
+        rays.push_back(PhysicsRay(Point3(-5.0f, 0.5f, 0.0f), Point3(5.0f, 0.5f, 0.0f)));     // Along the ground into the ball.
+        rays.push_back(PhysicsRay(Point3(-5.0f, 0.5f, 2.0f), Point3(5.0f, 0.5f, 2.0f)));     // Past the ball.
+
+        btSphereShape sweepShape(0.25f);
+        PhysicsRayHitVec hits;
+        BulletQueryBatch obj(*m_worldPtr, rays, &sweepShape, hits);
+        obj.Run(boost::shared_ptr<GameHalloran::WorkerThreadPool>());
+
+        // The swept sphere touches the ball when its centre is at x = -0.75.
+        TS_ASSERT(hits[0].m_hit);
+        TS_ASSERT_EQUALS(obj.GetHitObject(0), &m_ball);
+        TS_ASSERT_DELTA(hits[0].m_fraction, 0.425f, 0.005f);
+        TS_ASSERT_DELTA(hits[0].m_point.GetX(), -0.5f, 0.005f);
+        TS_ASSERT_DELTA(hits[0].m_normal.GetX(), -1.0f, 0.01f);
+
+        // The sphere rests on the ground so only skims it.
+        TS_ASSERT(!hits[1].m_hit || obj.GetHitObject(1) == &m_ground);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testMatchesWorldRayTest(void) {
+        PhysicsRayVec rays;
+        for(I32 x = -10; x <= 10; ++x) {
+            for(I32 z = -10; z <= 10; ++z) {
+                rays.push_back(PhysicsRay(Point3(F32(x) * 0.1f, 1.5f, F32(z) * 0.1f), Point3(F32(x) * 0.15f, -1.0f, F32(z) * 0.05f)));
+            }
+        }
+
+        PhysicsRayHitVec hits;
+        BulletQueryBatch obj(*m_worldPtr, rays, NULL, hits);
+        obj.Run(boost::shared_ptr<GameHalloran::WorkerThreadPool>());
+
+        for(U32 i = 0; i < rays.size(); ++i) {
+            const btVector3 from(rays[i].m_from.GetX(), rays[i].m_from.GetY(), rays[i].m_from.GetZ());
+            const btVector3 to(rays[i].m_to.GetX(), rays[i].m_to.GetY(), rays[i].m_to.GetZ());
+            btCollisionWorld::ClosestRayResultCallback callback(from, to);
+            m_worldPtr->rayTest(from, to, callback);
+
+            TS_ASSERT_EQUALS(hits[i].m_hit, callback.hasHit());
+            TS_ASSERT_EQUALS(obj.GetHitObject(i), callback.m_collisionObject);
+            TS_ASSERT_DELTA(hits[i].m_fraction, callback.m_closestHitFraction, 0.0001f);
+        }
+    };
+};
+
+#endif
@@ -0,0 +1,214 @@
+#pragma once
+#ifndef __BULLET_SHAPE_CACHE_TEST_SUITE_H
+#define __BULLET_SHAPE_CACHE_TEST_SUITE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file BulletShapeCacheTestSuite.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the header for the BulletShapeCache Test Suite.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <cxxtest/TestSuite.h>
+
+#include "BulletShapeCache.h"
+
+// /////////////////////////////////////////////////////////////////
+// @class BulletShapeCacheTestSuite
+// @author PJ O Halloran
+//
+// This class defines a series of unit tests for the
+// BulletShapeCache class.
+//
+// /////////////////////////////////////////////////////////////////
+class BulletShapeCacheTestSuite : public CxxTest::TestSuite {
+private:
+
+    typedef GameHalloran::BulletShapeCache BulletShapeCache;
+    typedef GameHalloran::U32 U32;
+    typedef GameHalloran::F32 F32;
+
+    // /////////////////////////////////////////////////////////////////
+    // Create a bumpy grid of triangles.
+    //
+    // /////////////////////////////////////////////////////////////////
+    btTriangleMesh *CreateGridMesh(const U32 size) {
+        btTriangleMesh *meshPtr = new btTriangleMesh(false, false);
+        for(U32 x = 0; x < size; ++x) {
+            for(U32 z = 0; z < size; ++z) {
+                const btVector3 a(F32(x), F32((x + z) % 3), F32(z));
+                const btVector3 b(F32(x + 1), F32((x + z + 1) % 3), F32(z));
+                const btVector3 c(F32(x), F32((x + z + 1) % 3), F32(z + 1));
+                const btVector3 d(F32(x + 1), F32((x + z + 2) % 3), F32(z + 1));
+                meshPtr->addTriangle(a, b, c);
+                meshPtr->addTriangle(b, d, c);
+            }
+        }
+        return (meshPtr);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Cast a ray straight down on to a mesh shape.
+    //
+    // @return bool True if the ray hit the mesh.
+    //
+    // /////////////////////////////////////////////////////////////////
+    bool RayHitsMesh(btBvhTriangleMeshShape *shapePtr, const F32 x, const F32 z, F32 &hitFraction) {
+        btDefaultCollisionConfiguration config;
+        btCollisionDispatcher dispatcher(&config);
+        btDbvtBroadphase broadphase;
+        btCollisionWorld world(&dispatcher, &broadphase, &config);
+
+        btCollisionObject object;
+        object.setCollisionShape(shapePtr);
+        world.addCollisionObject(&object);
+
+        const btVector3 from(x, 10.0f, z), to(x, -10.0f, z);
+        btCollisionWorld::ClosestRayResultCallback callback(from, to);
+        world.rayTest(from, to, callback);
+        world.removeCollisionObject(&object);
+
+        hitFraction = callback.m_closestHitFraction;
+        return (callback.hasHit());
+    };
+
+public:
+
+    // /////////////////////////////////////////////////////////////////
+    // Constructor.
+    //
+    // /////////////////////////////////////////////////////////////////
+    BulletShapeCacheTestSuite() : CxxTest::TestSuite() {
+
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Destructor.
+    //
+    // /////////////////////////////////////////////////////////////////
+    ~BulletShapeCacheTestSuite() {
+
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testPrimitiveSharing(void) {
+        BulletShapeCache obj;
+        TS_ASSERT_EQUALS(obj.GetNumberShapes(), 0);
+
+        btSphereShape *sphere1Ptr = obj.AcquireSphere(0.5f);
+        btSphereShape *sphere2Ptr = obj.AcquireSphere(0.5f);
+        btSphereShape *sphere3Ptr = obj.AcquireSphere(0.25f);
+        TS_ASSERT(sphere1Ptr != NULL);
+        TS_ASSERT_EQUALS(sphere1Ptr, sphere2Ptr);
+        TS_ASSERT_DIFFERS(sphere1Ptr, sphere3Ptr);
+        TS_ASSERT_EQUALS(obj.GetReferenceCount(sphere1Ptr), 2);
+        TS_ASSERT_EQUALS(obj.GetReferenceCount(sphere3Ptr), 1);
+        TS_ASSERT_DELTA(sphere3Ptr->getRadius(), 0.25f, 0.0001f);
+
+        btBoxShape *box1Ptr = obj.AcquireBox(btVector3(1.0f, 2.0f, 3.0f));
+        btBoxShape *box2Ptr = obj.AcquireBox(btVector3(1.0f, 2.0f, 3.0f));
+        btBoxShape *box3Ptr = obj.AcquireBox(btVector3(3.0f, 2.0f, 1.0f));
+        TS_ASSERT_EQUALS(box1Ptr, box2Ptr);
+        TS_ASSERT_DIFFERS(box1Ptr, box3Ptr);
+
+        // Same dimensions, different shape types.
+        btCylinderShapeZ *cylinderPtr = obj.AcquireCylinderZ(btVector3(1.0f, 2.0f, 3.0f));
+        TS_ASSERT(static_cast<btCollisionShape *>(cylinderPtr) != static_cast<btCollisionShape *>(box1Ptr));
+        TS_ASSERT_EQUALS(obj.GetNumberShapes(), 5);
+
+        // The shape stays alive until its last reference is released.
+        TS_ASSERT(obj.Release(sphere1Ptr));
+        TS_ASSERT_EQUALS(obj.GetReferenceCount(sphere2Ptr), 1);
+        TS_ASSERT_EQUALS(obj.AcquireSphere(0.5f), sphere2Ptr);
+        TS_ASSERT(obj.Release(sphere2Ptr));
+        TS_ASSERT(obj.Release(sphere2Ptr));
+        TS_ASSERT_EQUALS(obj.GetReferenceCount(sphere2Ptr), 0);
+        TS_ASSERT_EQUALS(obj.GetNumberShapes(), 4);
+
+        // Shapes the cache did not create are left to the caller.
+        btSphereShape external(1.0f);
+        TS_ASSERT(!obj.Release(&external));
+        TS_ASSERT(!obj.Release(NULL));
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testMeshSharing(void) {
+        BulletShapeCache obj;
+        TS_ASSERT(obj.AcquireMesh("grid") == NULL);
+        TS_ASSERT(obj.AddMesh("grid", NULL, true) == NULL);
+
+        btBvhTriangleMeshShape *mesh1Ptr = obj.AddMesh("grid", CreateGridMesh(8), true);
+        TS_ASSERT(mesh1Ptr != NULL);
+        TS_ASSERT_EQUALS(obj.AcquireMesh("grid"), mesh1Ptr);
+        TS_ASSERT_EQUALS(obj.GetReferenceCount(mesh1Ptr), 2);
+
+        // Adding a named mesh which is in use keeps the existing shape.
+        TS_ASSERT_EQUALS(obj.AddMesh("grid", CreateGridMesh(2), true), mesh1Ptr);
+        TS_ASSERT_EQUALS(obj.GetReferenceCount(mesh1Ptr), 3);
+
+        // Unnamed meshes are never shared.
+        btBvhTriangleMeshShape *unnamed1Ptr = obj.AddMesh("", CreateGridMesh(2), true);
+        btBvhTriangleMeshShape *unnamed2Ptr = obj.AddMesh("", CreateGridMesh(2), true);
+        TS_ASSERT(unnamed1Ptr != NULL);
+        TS_ASSERT_DIFFERS(unnamed1Ptr, unnamed2Ptr);
+        TS_ASSERT(obj.AcquireMesh("") == NULL);
+        TS_ASSERT_EQUALS(obj.GetNumberShapes(), 3);
+
+        TS_ASSERT(obj.Release(unnamed1Ptr));
+        TS_ASSERT(obj.Release(unnamed2Ptr));
+        TS_ASSERT(!obj.HasSerializedBvh(""));
+        TS_ASSERT_EQUALS(obj.GetNumberShapes(), 1);
+
+        for(U32 i = 0; i < 3; ++i) {
+            TS_ASSERT(!obj.HasSerializedBvh("grid"));
+            TS_ASSERT(obj.Release(mesh1Ptr));
+        }
+        TS_ASSERT_EQUALS(obj.GetNumberShapes(), 0);
+        TS_ASSERT(obj.AcquireMesh("grid") == NULL);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testSerializedBvh(void) {
+        BulletShapeCache obj;
+
+        // Ray test the freshly built BVH.
+        F32 builtFraction = 0.0f, loadedFraction = 0.0f;
+        btBvhTriangleMeshShape *builtPtr = obj.AddMesh("grid", CreateGridMesh(16), true);
+        TS_ASSERT(builtPtr != NULL);
+        TS_ASSERT(builtPtr->getOwnsBvh());
+        TS_ASSERT(RayHitsMesh(builtPtr, 5.3f, 7.6f, builtFraction));
+        TS_ASSERT(obj.Release(builtPtr));
+        TS_ASSERT(obj.HasSerializedBvh("grid"));
+
+        // The BVH is loaded from the serialized data and gives the same result.
+        btBvhTriangleMeshShape *loadedPtr = obj.AddMesh("grid", CreateGridMesh(16), true);
+        TS_ASSERT(loadedPtr != NULL);
+        TS_ASSERT(!loadedPtr->getOwnsBvh());
+        TS_ASSERT(loadedPtr->getOptimizedBvh() != NULL);
+        TS_ASSERT(RayHitsMesh(loadedPtr, 5.3f, 7.6f, loadedFraction));
+        TS_ASSERT_DELTA(builtFraction, loadedFraction, 0.0001f);
+        TS_ASSERT(!RayHitsMesh(loadedPtr, -5.0f, -5.0f, loadedFraction));
+        TS_ASSERT(obj.Release(loadedPtr));
+
+        // A BVH with a different compression is rebuilt.
+        btBvhTriangleMeshShape *unquantizedPtr = obj.AddMesh("grid", CreateGridMesh(16), false);
+        TS_ASSERT(unquantizedPtr->getOwnsBvh());
+        TS_ASSERT(RayHitsMesh(unquantizedPtr, 5.3f, 7.6f, loadedFraction));
+        TS_ASSERT_DELTA(builtFraction, loadedFraction, 0.0001f);
+        TS_ASSERT(obj.Release(unquantizedPtr));
+
+        // Shapes still in use are deleted with the cache.
+        obj.AddMesh("grid", CreateGridMesh(16), true);
+        obj.AcquireSphere(1.0f);
+    };
+};
+
+#endif
@@ -0,0 +1,451 @@
+#pragma once
+#ifndef __CPROCESS_MANAGER_TEST_SUITE_H
+#define __CPROCESS_MANAGER_TEST_SUITE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file CProcessManagerTestSuite.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the header for the CProcessManager Test Suite.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include "CProcess.h"
+#include "WorkerThreadPool.h"
+
+// /////////////////////////////////////////////////////////////////
+// @class CProcessManagerTestSuite
+// @author PJ O Halloran
+//
+// This class defines a series of unit tests for the
+// CProcessManager class.
+//
+// /////////////////////////////////////////////////////////////////
+class CProcessManagerTestSuite : public CxxTest::TestSuite {
+private:
+
+    typedef GameHalloran::CProcess CProcess;
+    typedef GameHalloran::CProcessManager CProcessManager;
+    typedef GameHalloran::ProcessHandle ProcessHandle;
+    typedef GameHalloran::F32 F32;
+    typedef GameHalloran::I32 I32;
+    typedef GameHalloran::U32 U32;
+    typedef GameHalloran::WorkerThreadPool WorkerThreadPool;
+
+    static const U32 NUMBER_WORKER_THREADS = 3;
+
+    // /////////////////////////////////////////////////////////////////
+    // @class TestProcess
+    //
+    // Records the order processes are updated in and dies after a
+    // number of updates.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class TestProcess : public CProcess {
+    private:
+        std::vector<I32> *m_logPtr;
+        I32 m_id;
+        U32 m_updatesLeft;
+    public:
+        TestProcess(std::vector<I32> *logPtr, const I32 id, const U32 lifetime, const I32 type = GameHalloran::PROC_INTERPOLATOR)
+            : CProcess(type), m_logPtr(logPtr), m_id(id), m_updatesLeft(lifetime) {};
+        virtual void VOnUpdate(const F32 elapsedTime) {
+            CProcess::VOnUpdate(elapsedTime);
+            if(m_logPtr) {
+                m_logPtr->push_back(m_id);
+            }
+            if(m_updatesLeft > 0 && --m_updatesLeft == 0) {
+                VKill();
+            }
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @class ClearingProcess
+    //
+    // Clears its manager when it is updated.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class ClearingProcess : public CProcess {
+    private:
+        CProcessManager *m_managerPtr;
+    public:
+        explicit ClearingProcess(CProcessManager *managerPtr) : CProcess(GameHalloran::PROC_CONTROL), m_managerPtr(managerPtr) {};
+        virtual void VOnUpdate(const F32 elapsedTime) {
+            CProcess::VOnUpdate(elapsedTime);
+            m_managerPtr->ClearAll();
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @class ChainProcess
+    //
+    // Thread safe process which appends (stage, frame) to the log of its
+    // chain on each update and dies after a number of updates.  Only
+    // the processes of one chain write to its log so they must never
+    // run at the same time.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class ChainProcess : public CProcess {
+    private:
+        std::vector<I32> *m_logPtr;
+        const U32 *m_framePtr;
+        I32 m_stage;
+        U32 m_updatesLeft;
+        volatile U32 m_work;
+    public:
+        ChainProcess(std::vector<I32> *logPtr, const U32 *framePtr, const I32 stage, const U32 lifetime)
+            : CProcess(GameHalloran::PROC_INTERPOLATOR), m_logPtr(logPtr), m_framePtr(framePtr), m_stage(stage), m_updatesLeft(lifetime), m_work(0) {
+            SetThreadSafe(true);
+        };
+        virtual void VOnUpdate(const F32 elapsedTime) {
+            CProcess::VOnUpdate(elapsedTime);
+            m_logPtr->push_back(m_stage);
+            m_logPtr->push_back(I32(*m_framePtr));
+            for(U32 i = 0; i < 1000 * U32(m_stage + 1); ++i) {
+                m_work = m_work + i;
+            }
+            if(--m_updatesLeft == 0) {
+                VKill();
+            }
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // @class CountingProcess
+    //
+    // Process which is not thread safe and records the total size of
+    // the chain logs each frame.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class CountingProcess : public CProcess {
+    private:
+        const std::vector<std::vector<I32> > *m_logsPtr;
+    public:
+        std::vector<U32> m_totals;
+        explicit CountingProcess(const std::vector<std::vector<I32> > *logsPtr) : CProcess(GameHalloran::PROC_CONTROL), m_logsPtr(logsPtr), m_totals() {};
+        virtual void VOnUpdate(const F32 elapsedTime) {
+            CProcess::VOnUpdate(elapsedTime);
+            U32 total = 0;
+            for(U32 i = 0; i < m_logsPtr->size(); ++i) {
+                total += U32((*m_logsPtr)[i].size());
+            }
+            m_totals.push_back(total);
+        };
+    };
+
+public:
+
+    // /////////////////////////////////////////////////////////////////
+    // Set up GLFW for the worker threads.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void setUp() {
+        glfwInit();
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Shut down GLFW.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void tearDown() {
+        glfwTerminate();
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testUpdateOrder(void) {
+        std::vector<I32> log;
+        CProcessManager mgr;
+        TS_ASSERT(!mgr.HasProcesses());
+
+        for(I32 i = 0; i < 4; ++i) {
+            TS_ASSERT(mgr.Attach(boost::shared_ptr<CProcess>(new TestProcess(&log, i, 0))).IsValid());
+        }
+        TS_ASSERT(!mgr.Attach(boost::shared_ptr<CProcess>()).IsValid());
+        TS_ASSERT(mgr.HasProcesses());
+        TS_ASSERT_EQUALS(mgr.GetNumberProcesses(), 4);
+
+        mgr.UpdateProcesses(0.1f);
+        TS_ASSERT_EQUALS(log.size(), 4);
+        for(I32 i = 0; i < 4; ++i) {
+            TS_ASSERT_EQUALS(log[i], i);
+        }
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testNextProcess(void) {
+        std::vector<I32> log;
+        CProcessManager mgr;
+
+        boost::shared_ptr<CProcess> firstPtr(new TestProcess(&log, 1, 1));
+        boost::shared_ptr<CProcess> nextPtr(new TestProcess(&log, 2, 1));
+        firstPtr->SetNext(nextPtr);
+        mgr.Attach(firstPtr);
+
+        // The first process kills itself, is removed on the next update and
+        //  the next process it started runs on the update after that.
+        mgr.UpdateProcesses(0.1f);
+        TS_ASSERT(firstPtr->IsDead());
+        TS_ASSERT(firstPtr->IsAttached());
+        mgr.UpdateProcesses(0.1f);
+        TS_ASSERT(!firstPtr->IsAttached());
+        TS_ASSERT(!firstPtr->GetNext());
+        TS_ASSERT(nextPtr->IsAttached());
+        TS_ASSERT_EQUALS(log.size(), 1);
+        mgr.UpdateProcesses(0.1f);
+        TS_ASSERT_EQUALS(log.size(), 2);
+        TS_ASSERT_EQUALS(log[1], 2);
+        mgr.UpdateProcesses(0.1f);
+        TS_ASSERT(!mgr.HasProcesses());
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testIsProcessActive(void) {
+        CProcessManager mgr;
+        TS_ASSERT(!mgr.IsProcessActive(GameHalloran::PROC_INTERPOLATOR));
+        TS_ASSERT(!mgr.IsProcessActive(-1));
+        TS_ASSERT(!mgr.IsProcessActive(1000));
+
+        boost::shared_ptr<CProcess> aPtr(new TestProcess(NULL, 1, 0));
+        boost::shared_ptr<CProcess> bPtr(new TestProcess(NULL, 2, 0));
+        mgr.Attach(aPtr);
+        mgr.Attach(bPtr);
+        TS_ASSERT(mgr.IsProcessActive(GameHalloran::PROC_INTERPOLATOR));
+        TS_ASSERT(!mgr.IsProcessActive(GameHalloran::PROC_SCREEN));
+
+        // A dead process still counts while it has a next process.
+        aPtr->VKill();
+        TS_ASSERT(mgr.IsProcessActive(GameHalloran::PROC_INTERPOLATOR));
+        bPtr->SetNext(boost::shared_ptr<CProcess>(new TestProcess(NULL, 3, 0, GameHalloran::PROC_SCREEN)));
+        bPtr->VKill();
+        TS_ASSERT(mgr.IsProcessActive(GameHalloran::PROC_INTERPOLATOR));
+        bPtr->SetType(GameHalloran::PROC_MUSIC);
+        TS_ASSERT(!mgr.IsProcessActive(GameHalloran::PROC_INTERPOLATOR));
+        TS_ASSERT(mgr.IsProcessActive(GameHalloran::PROC_MUSIC));
+
+        mgr.UpdateProcesses(0.1f);
+        TS_ASSERT(!mgr.IsProcessActive(GameHalloran::PROC_MUSIC));
+        TS_ASSERT(mgr.IsProcessActive(GameHalloran::PROC_SCREEN));
+        TS_ASSERT_EQUALS(mgr.GetNumberProcesses(), 1);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testHandles(void) {
+        CProcessManager mgr;
+        CProcessManager otherMgr;
+
+        boost::shared_ptr<CProcess> aPtr(new TestProcess(NULL, 1, 1));
+        const ProcessHandle aHandle = mgr.Attach(aPtr);
+        TS_ASSERT(aHandle.IsValid());
+        TS_ASSERT_EQUALS(mgr.GetProcess(aHandle), aPtr);
+        TS_ASSERT(!mgr.GetProcess(ProcessHandle()));
+
+        // Attaching twice returns the same handle, another manager refuses it.
+        const ProcessHandle againHandle = mgr.Attach(aPtr);
+        TS_ASSERT_EQUALS(againHandle.m_slotIndex, aHandle.m_slotIndex);
+        TS_ASSERT_EQUALS(againHandle.m_generation, aHandle.m_generation);
+        TS_ASSERT(!otherMgr.Attach(aPtr).IsValid());
+        TS_ASSERT_EQUALS(mgr.GetNumberProcesses(), 1);
+
+        mgr.UpdateProcesses(0.1f);
+        mgr.UpdateProcesses(0.1f);
+        TS_ASSERT(!mgr.GetProcess(aHandle));
+
+        // The slot is reused under a new generation.
+        boost::shared_ptr<CProcess> bPtr(new TestProcess(NULL, 2, 0));
+        const ProcessHandle bHandle = mgr.Attach(bPtr);
+        TS_ASSERT_EQUALS(bHandle.m_slotIndex, aHandle.m_slotIndex);
+        TS_ASSERT_DIFFERS(bHandle.m_generation, aHandle.m_generation);
+        TS_ASSERT(!mgr.GetProcess(aHandle));
+        TS_ASSERT_EQUALS(mgr.GetProcess(bHandle), bPtr);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testClearAll(void) {
+        CProcessManager mgr;
+        boost::shared_ptr<CProcess> aPtr(new TestProcess(NULL, 1, 0));
+        boost::shared_ptr<CProcess> bPtr(new TestProcess(NULL, 2, 0));
+        mgr.Attach(aPtr);
+        mgr.UpdateProcesses(0.1f);
+        const ProcessHandle bHandle = mgr.Attach(bPtr);
+
+        mgr.ClearAll(false);
+        TS_ASSERT(!mgr.HasProcesses());
+        TS_ASSERT(!mgr.IsProcessActive(GameHalloran::PROC_INTERPOLATOR));
+        TS_ASSERT(!aPtr->IsAttached());
+        TS_ASSERT(!aPtr->IsDead());
+        TS_ASSERT(!mgr.GetProcess(bHandle));
+
+        // Cleared processes may be attached again.
+        mgr.Attach(aPtr);
+        mgr.ClearAll();
+        TS_ASSERT(aPtr->IsDead());
+        TS_ASSERT(!mgr.HasProcesses());
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testClearAllDuringUpdate(void) {
+        std::vector<I32> log;
+        CProcessManager mgr;
+        boost::shared_ptr<CProcess> aPtr(new TestProcess(&log, 1, 0));
+        boost::shared_ptr<CProcess> bPtr(new TestProcess(&log, 2, 0));
+        mgr.Attach(aPtr);
+        mgr.Attach(boost::shared_ptr<CProcess>(new ClearingProcess(&mgr)));
+        mgr.Attach(bPtr);
+
+        // The processes after the clearing process are not updated.
+        mgr.UpdateProcesses(0.1f);
+        TS_ASSERT_EQUALS(log.size(), 1);
+        TS_ASSERT(!mgr.HasProcesses());
+        TS_ASSERT(aPtr->IsDead());
+        TS_ASSERT(bPtr->IsDead());
+
+        // And the manager is still usable.
+        const ProcessHandle aHandle = mgr.Attach(boost::shared_ptr<CProcess>(new TestProcess(&log, 3, 1)));
+        mgr.UpdateProcesses(0.1f);
+        TS_ASSERT_EQUALS(log.size(), 2);
+        TS_ASSERT_EQUALS(log[1], 3);
+        TS_ASSERT(mgr.GetProcess(aHandle));
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testManyShortLivedProcesses(void) {
+        CProcessManager mgr;
+        for(U32 frame = 0; frame < 100; ++frame) {
+            for(U32 i = 0; i < 100; ++i) {
+                mgr.Attach(boost::shared_ptr<CProcess>(new TestProcess(NULL, I32(i), 1 + (i % 3))));
+            }
+            mgr.UpdateProcesses(0.016f);
+        }
+        TS_ASSERT(mgr.GetNumberProcesses() <= 300);
+        for(U32 frame = 0; frame < 4; ++frame) {
+            mgr.UpdateProcesses(0.016f);
+        }
+        TS_ASSERT(!mgr.HasProcesses());
+        TS_ASSERT(!mgr.IsProcessActive(GameHalloran::PROC_INTERPOLATOR));
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testParallelChains(void) {
+        boost::shared_ptr<WorkerThreadPool> poolPtr(new WorkerThreadPool(NUMBER_WORKER_THREADS));
+        TS_ASSERT(poolPtr->IsValid());
+        CProcessManager mgr;
+        TS_ASSERT(mgr.SetWorkerThreadPool(poolPtr));
+
+        // Chains of 3 stages which live for 1 to 3 updates each.
+        const U32 numberChains = 64;
+        U32 frame = 0;
+        std::vector<std::vector<I32> > logs(numberChains);
+        for(U32 c = 0; c < numberChains; ++c) {
+            boost::shared_ptr<CProcess> stagePtrs[3];
+            for(I32 s = 0; s < 3; ++s) {
+                stagePtrs[s].reset(new ChainProcess(&logs[c], &frame, s, 1 + (c + U32(s)) % 3));
+            }
+            stagePtrs[0]->SetNext(stagePtrs[1]);
+            stagePtrs[1]->SetNext(stagePtrs[2]);
+            mgr.Attach(stagePtrs[0]);
+        }
+        boost::shared_ptr<CountingProcess> countPtr(new CountingProcess(&logs));
+        mgr.Attach(countPtr);
+
+        for(frame = 0; frame < 16; ++frame) {
+            mgr.UpdateProcesses(0.1f);
+            if(frame == 0) {
+                TS_ASSERT(mgr.IsProcessActive(GameHalloran::PROC_INTERPOLATOR));
+            }
+        }
+        TS_ASSERT(!mgr.IsProcessActive(GameHalloran::PROC_INTERPOLATOR));
+        TS_ASSERT_EQUALS(mgr.GetNumberProcesses(), 1);
+
+        // The thread safe processes of a frame all ran before the process
+        //  which is not thread safe.
+        TS_ASSERT_EQUALS(countPtr->m_totals.size(), 16);
+        for(U32 f = 0; f < countPtr->m_totals.size(); ++f) {
+            U32 total = 0;
+            for(U32 c = 0; c < numberChains; ++c) {
+                for(U32 i = 1; i < logs[c].size(); i += 2) {
+                    total += (logs[c][i] <= I32(f)) ? 2 : 0;
+                }
+            }
+            TS_ASSERT_EQUALS(countPtr->m_totals[f], total);
+        }
+
+        // Each stage ran for its lifetime on consecutive frames, starting
+        //  the frame after the stage before it died.
+        for(U32 c = 0; c < numberChains; ++c) {
+            const std::vector<I32> &log = logs[c];
+            U32 pos = 0;
+            I32 expectedFrame = 0;
+            for(I32 s = 0; s < 3; ++s) {
+                const U32 lifetime = 1 + (c + U32(s)) % 3;
+                for(U32 u = 0; u < lifetime; ++u) {
+                    TS_ASSERT(pos + 1 < log.size());
+                    if(pos + 1 >= log.size()) {
+                        return;
+                    }
+                    TS_ASSERT_EQUALS(log[pos], s);
+                    TS_ASSERT_EQUALS(log[pos + 1], expectedFrame);
+                    pos += 2;
+                    ++expectedFrame;
+                }
+                // The dead stage is removed on the next update and its next
+                //  process starts on the one after.
+                expectedFrame += 1;
+            }
+            TS_ASSERT_EQUALS(pos, log.size());
+        }
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testParallelMatchesSerial(void) {
+        std::vector<I32> serialLog;
+        std::vector<I32> parallelLog;
+        CProcessManager serialMgr;
+        CProcessManager parallelMgr;
+        TS_ASSERT(parallelMgr.SetWorkerThreadPool(boost::shared_ptr<WorkerThreadPool>(new WorkerThreadPool(NUMBER_WORKER_THREADS))));
+
+        // Processes which are not thread safe keep their order.
+        for(I32 i = 0; i < 8; ++i) {
+            serialMgr.Attach(boost::shared_ptr<CProcess>(new TestProcess(&serialLog, i, 1 + U32(i) % 4)));
+            parallelMgr.Attach(boost::shared_ptr<CProcess>(new TestProcess(&parallelLog, i, 1 + U32(i) % 4)));
+        }
+        for(U32 frame = 0; frame < 6; ++frame) {
+            serialMgr.UpdateProcesses(0.1f);
+            parallelMgr.UpdateProcesses(0.1f);
+        }
+        TS_ASSERT(serialLog == parallelLog);
+        TS_ASSERT(!serialMgr.HasProcesses());
+        TS_ASSERT(!parallelMgr.HasProcesses());
+
+        // Back to updating on the calling thread.
+        TS_ASSERT(parallelMgr.SetWorkerThreadPool(boost::shared_ptr<WorkerThreadPool>()));
+        parallelMgr.Attach(boost::shared_ptr<CProcess>(new TestProcess(&parallelLog, 9, 1)));
+        parallelMgr.UpdateProcesses(0.1f);
+        TS_ASSERT_EQUALS(parallelLog.back(), 9);
+    };
+};
+
+#endif
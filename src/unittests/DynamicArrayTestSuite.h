@@ -22,6 +22,27 @@ using std::cout;
 using std::string;
 using std::endl;
 
+// /////////////////////////////////////////////////////////////////
+// @class LifetimeCounter
+//
+// Element type which counts the number of live instances so the
+// tests can check that every constructed element is destroyed.
+//
+// /////////////////////////////////////////////////////////////////
+class LifetimeCounter {
+public:
+    static int s_live;
+    std::string m_value;
+
+    LifetimeCounter() : m_value("default") { ++s_live; };
+    LifetimeCounter(const char *value) : m_value(value) { ++s_live; };
+    LifetimeCounter(const LifetimeCounter &rhs) : m_value(rhs.m_value) { ++s_live; };
+    ~LifetimeCounter() { --s_live; };
+    LifetimeCounter &operator=(const LifetimeCounter &rhs) { m_value = rhs.m_value; return (*this); };
+};
+
+int LifetimeCounter::s_live = 0;
+
 // /////////////////////////////////////////////////////////////////
 // @class DynamicArrayTestSuite
 // @author PJ O Halloran
@@ -39,6 +60,7 @@ private:
     typedef GameHalloran::DynamicArray<std::string>::Iterator<std::string> IteratorString;
     typedef GameHalloran::DynamicArray<int *> DynamicArrayIntPointer;
     typedef GameHalloran::DynamicArray<int *>::Iterator<int *> IteratorPointer;
+    typedef GameHalloran::DynamicArray<LifetimeCounter> DynamicArrayCounter;
     typedef GameHalloran::U32 U32;
 
     DynamicArrayInt *m_testPtr;
@@ -1232,6 +1254,131 @@ public:
         }
     };
 
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void testReserveAndShrinkToFit(void) {
+        DynamicArrayInt intArray(0);
+        TS_ASSERT_EQUALS(intArray.GetCapacity(), 0);
+
+        intArray.Reserve(64);
+        TS_ASSERT_EQUALS(intArray.GetCapacity(), 64);
+        TS_ASSERT_EQUALS(intArray.GetSize(), 0);
+
+        // Reserving less than the current capacity does nothing.
+        intArray.Reserve(8);
+        TS_ASSERT_EQUALS(intArray.GetCapacity(), 64);
+
+        for(int i = 0; i < 20; ++i) {
+            intArray.PushBack(i);
+        }
+        TS_ASSERT_EQUALS(intArray.GetCapacity(), 64);
+
+        intArray.ShrinkToFit();
+        TS_ASSERT_EQUALS(intArray.GetCapacity(), 20);
+        TS_ASSERT_EQUALS(intArray.GetSize(), 20);
+        for(int i = 0; i < 20; ++i) {
+            TS_ASSERT_EQUALS(intArray[i], i);
+        }
+
+        // An array with no capacity must still grow.
+        DynamicArrayInt emptyArray(0);
+        emptyArray.PushBack(7);
+        TS_ASSERT_EQUALS(emptyArray.GetSize(), 1);
+        TS_ASSERT_EQUALS(emptyArray[0], 7);
+    };
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void testEmplaceBack(void) {
+        DynamicArrayString strArray(1);
+
+        strArray.EmplaceBack("first");
+        strArray.EmplaceBack(3, 'x');
+        std::string &last = strArray.EmplaceBack();
+
+        TS_ASSERT_EQUALS(strArray.GetSize(), 3);
+        TS_ASSERT_EQUALS(strArray[0].compare("first"), 0);
+        TS_ASSERT_EQUALS(strArray[1].compare("xxx"), 0);
+        TS_ASSERT(last.empty());
+    };
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void testPushBackSelfReference(void) {
+        DynamicArrayString strArray(1);
+        strArray.PushBack(std::string("self"));
+
+        // Pushing an element of the array while it reallocates must copy the value first.
+        for(U32 i = 0; i < 10; ++i) {
+            strArray.PushBack(strArray[0]);
+        }
+
+        TS_ASSERT_EQUALS(strArray.GetSize(), 11);
+        for(U32 i = 0; i < 11; ++i) {
+            TS_ASSERT_EQUALS(strArray[i].compare("self"), 0);
+        }
+    };
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void testElementLifetime(void) {
+        LifetimeCounter::s_live = 0;
+        {
+            DynamicArrayCounter counterArray(2);
+
+            // Reserved storage must not construct any elements.
+            TS_ASSERT_EQUALS(LifetimeCounter::s_live, 0);
+
+            for(U32 i = 0; i < 40; ++i) {
+                counterArray.EmplaceBack("value");
+            }
+            TS_ASSERT_EQUALS(LifetimeCounter::s_live, 40);
+
+            DynamicArrayCounter::Iterator pos(counterArray.Begin() + 5);
+            counterArray.InsertAndMove(LifetimeCounter("inserted"), pos);
+            TS_ASSERT_EQUALS(LifetimeCounter::s_live, 41);
+            TS_ASSERT_EQUALS(counterArray[5].m_value.compare("inserted"), 0);
+            TS_ASSERT_EQUALS(counterArray[6].m_value.compare("value"), 0);
+
+            counterArray.PopBack();
+            TS_ASSERT_EQUALS(LifetimeCounter::s_live, 40);
+
+            counterArray.SetCapacity(10);
+            TS_ASSERT_EQUALS(LifetimeCounter::s_live, 10);
+
+            counterArray.Clear();
+            TS_ASSERT_EQUALS(LifetimeCounter::s_live, 0);
+
+            counterArray.SetSize(3);
+            TS_ASSERT_EQUALS(LifetimeCounter::s_live, 3);
+        }
+        TS_ASSERT_EQUALS(LifetimeCounter::s_live, 0);
+    };
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void testInsertAndMoveInPlace(void) {
+        DynamicArrayInt intArray(8);
+        for(int i = 0; i < 4; ++i) {
+            intArray.PushBack(i);
+        }
+
+        // Enough capacity so the elements are shifted without a reallocation.
+        DynamicArrayInt::Iterator pos(intArray.Begin() + 1);
+        intArray.InsertAndMove(10, pos);
+        TS_ASSERT_EQUALS(intArray.GetCapacity(), 8);
+        TS_ASSERT_EQUALS(intArray.GetSize(), 5);
+        TS_ASSERT_EQUALS(intArray[0], 0);
+        TS_ASSERT_EQUALS(intArray[1], 10);
+        TS_ASSERT_EQUALS(intArray[2], 1);
+        TS_ASSERT_EQUALS(intArray[4], 3);
+    };
+
 };
 
 #endif
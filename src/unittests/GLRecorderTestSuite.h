@@ -0,0 +1,259 @@
+#pragma once
+#ifndef __GL_RECORDER_TEST_SUITE_H
+#define __GL_RECORDER_TEST_SUITE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file GLRecorderTestSuite.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the header for the headless recording OpenGL backend
+// Test Suite.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <string>
+
+#include <cxxtest/TestSuite.h>
+
+#include "GLRecorder.h"
+
+// /////////////////////////////////////////////////////////////////
+// @class GLRecorderTestSuite
+// @author PJ O Halloran
+//
+// This class defines a series of unit tests for the GLRecorder.  The
+// recording functions are called directly so the tests do not depend
+// on GF_GL_RECORDING.
+//
+// /////////////////////////////////////////////////////////////////
+class GLRecorderTestSuite : public CxxTest::TestSuite {
+private:
+
+    typedef GameHalloran::GLRecorder GLRecorder;
+    typedef GameHalloran::GLRecorderStats GLRecorderStats;
+
+    static int s_resizeWidth;               ///< Width passed to the last OnResize().
+    static int s_resizeHeight;              ///< Height passed to the last OnResize().
+
+    // /////////////////////////////////////////////////////////////////
+    // Window size callback of the headless window test.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static void GLFWCALL OnResize(int width, int height) {
+        s_resizeWidth = width;
+        s_resizeHeight = height;
+    };
+
+public:
+
+    // /////////////////////////////////////////////////////////////////
+    // Start each test with a fresh recorder.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void setUp(void) {
+        GLRecorder::GetGlobalInstance().Reset();
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test objects are given unique names and can be deleted.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testObjects(void) {
+        GLRecorder &recorder = GLRecorder::GetGlobalInstance();
+        GLuint textures[3] = { 0, 0, 0 };
+        GfRecGenTextures(3, textures);
+        const GLuint program = GfRecCreateProgram();
+        TS_ASSERT(textures[0] != 0);
+        TS_ASSERT(textures[0] != textures[1] && textures[1] != textures[2] && textures[2] != program);
+        TS_ASSERT(GfRecIsTexture(textures[1]) == GL_TRUE);
+        TS_ASSERT_EQUALS(recorder.GetNumberObjects(), 4u);
+
+        GfRecDeleteTextures(2, textures);
+        TS_ASSERT(GfRecIsTexture(textures[1]) == GL_FALSE);
+        TS_ASSERT(GfRecIsTexture(textures[2]) == GL_TRUE);
+        TS_ASSERT(GfRecIsProgram(program) == GL_TRUE);
+
+        const GLRecorderStats &stats = recorder.GetStats();
+        TS_ASSERT_EQUALS(stats.m_objectsCreated, 4u);
+        TS_ASSERT_EQUALS(stats.m_objectsDeleted, 2u);
+        TS_ASSERT_EQUALS(stats.m_calls, 7u);
+        TS_ASSERT_EQUALS(stats.m_queries, 4u);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test state changes setting the value already set are counted as
+    // redundant, with texture bindings kept per texture unit.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testRedundantStateChanges(void) {
+        GLRecorder &recorder = GLRecorder::GetGlobalInstance();
+        GfRecBindTexture(GL_TEXTURE_2D, 1);
+        GfRecBindTexture(GL_TEXTURE_2D, 1);
+        GfRecActiveTexture(GL_TEXTURE1);
+        GfRecBindTexture(GL_TEXTURE_2D, 1);
+        GfRecEnable(GL_BLEND);
+        GfRecEnable(GL_BLEND);
+        GfRecDisable(GL_BLEND);
+        GfRecUseProgram(5);
+        GfRecUseProgram(5);
+
+        const GLRecorderStats &stats = recorder.GetStats();
+        TS_ASSERT_EQUALS(stats.m_stateChanges, 9u);
+        TS_ASSERT_EQUALS(stats.m_redundantStateChanges, 3u);
+        TS_ASSERT_EQUALS(stats.m_textureBinds, 3u);
+        TS_ASSERT_EQUALS(stats.m_programBinds, 2u);
+
+        GLint activeTexture(0);
+        GfRecGetIntegerv(GL_ACTIVE_TEXTURE, &activeTexture);
+        TS_ASSERT_EQUALS(activeTexture, GLint(GL_TEXTURE1));
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test uniforms are redundant only when the program, location and
+    // value are all the same.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testUniforms(void) {
+        GLRecorder &recorder = GLRecorder::GetGlobalInstance();
+        const GLuint program = GfRecCreateProgram();
+        const GLint colorLoc = GfRecGetUniformLocation(program, "u_color");
+        const GLint mvpLoc = GfRecGetUniformLocation(program, "u_mvp");
+        TS_ASSERT(colorLoc != mvpLoc);
+        TS_ASSERT_EQUALS(GfRecGetUniformLocation(program, "u_color"), colorLoc);
+
+        const GLfloat red[4] = { 1.0f, 0.0f, 0.0f, 1.0f };
+        const GLfloat green[4] = { 0.0f, 1.0f, 0.0f, 1.0f };
+        GfRecUseProgram(program);
+        recorder.ResetStats();
+        GfRecUniform4fv(colorLoc, 1, red);
+        GfRecUniform4fv(colorLoc, 1, red);
+        GfRecUniform4fv(colorLoc, 1, green);
+        GfRecUniform4fv(mvpLoc, 1, green);
+
+        const GLRecorderStats &stats = recorder.GetStats();
+        TS_ASSERT_EQUALS(stats.m_uniformUploads, 4u);
+        TS_ASSERT_EQUALS(stats.m_redundantStateChanges, 1u);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test draw calls and uploaded bytes are counted and the counts are
+    // kept per frame.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testFrameCounts(void) {
+        GLRecorder &recorder = GLRecorder::GetGlobalInstance();
+        GLuint buffer(0);
+        GfRecGenBuffers(1, &buffer);
+        GfRecBindBuffer(GL_ARRAY_BUFFER, buffer);
+        const GLfloat vertices[6] = { 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f };
+        GfRecBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+        // Mapping the buffer gives its contents.
+        GLfloat *mappedPtr = static_cast<GLfloat *>(GfRecMapBuffer(GL_ARRAY_BUFFER, GL_READ_WRITE));
+        TS_ASSERT(mappedPtr != NULL);
+        if(mappedPtr) {
+            TS_ASSERT_EQUALS(memcmp(mappedPtr, vertices, sizeof(vertices)), 0);
+        }
+        TS_ASSERT(GfRecUnmapBuffer(GL_ARRAY_BUFFER) == GL_TRUE);
+
+        const unsigned char texels[4 * 4 * 4] = { 0 };
+        GfRecTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 4, 4, 0, GL_RGBA, GL_UNSIGNED_BYTE, texels);
+        GfRecTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 2, 2, 0, GL_RGB, GL_UNSIGNED_BYTE, texels);
+        GfRecCompressedTexImage2D(GL_TEXTURE_2D, 0, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT, 4, 4, 0, 16, texels);
+        GfRecDrawArrays(GL_TRIANGLES, 0, 3);
+        GfRecDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, NULL);
+        recorder.EndFrame();
+
+        const GLRecorderStats &lastFrame = recorder.GetLastFrameStats();
+        TS_ASSERT_EQUALS(recorder.GetNumberFrames(), 1u);
+        TS_ASSERT_EQUALS(lastFrame.m_drawCalls, 2u);
+        TS_ASSERT_EQUALS(lastFrame.m_verticesDrawn, 9u);
+        TS_ASSERT_EQUALS(lastFrame.m_bufferBytesUploaded, 2 * sizeof(vertices));
+        TS_ASSERT_EQUALS(lastFrame.m_textureBytesUploaded, 64u + 12u + 16u);
+        TS_ASSERT_EQUALS(recorder.GetStats().m_calls, 0u);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test the call log and the answers to shader queries.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testCallLogAndQueries(void) {
+        GLRecorder &recorder = GLRecorder::GetGlobalInstance();
+        GfRecClear(GL_COLOR_BUFFER_BIT);
+        TS_ASSERT(recorder.GetCallLog().empty());
+
+        recorder.SetCallLogEnabled(true);
+        const GLuint shader = GfRecCreateShader(GL_VERTEX_SHADER);
+        GfRecCompileShader(shader);
+        GLint status(GL_FALSE);
+        GfRecGetShaderiv(shader, GL_COMPILE_STATUS, &status);
+        TS_ASSERT_EQUALS(status, GLint(GL_TRUE));
+        GLchar log[8] = "garbage";
+        GLsizei length(-1);
+        GfRecGetShaderInfoLog(shader, sizeof(log), &length, log);
+        TS_ASSERT_EQUALS(length, 0);
+        TS_ASSERT_EQUALS(log[0], '\0');
+        TS_ASSERT(GfRecGetError() == GL_NO_ERROR);
+        recorder.SetCallLogEnabled(false);
+
+        TS_ASSERT_EQUALS(recorder.GetCallLog().size(), 5u);
+        if(recorder.GetCallLog().size() == 5) {
+            TS_ASSERT_EQUALS(std::string(recorder.GetCallLog()[0]), std::string("glCreateShader"));
+            TS_ASSERT_EQUALS(std::string(recorder.GetCallLog()[4]), std::string("glGetError"));
+        }
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test the headless window keeps what it was opened with, calls the
+    // size callback as GLFW does and glewInit() reports OpenGL 3.2.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testHeadlessWindow(void) {
+        TS_ASSERT_EQUALS(GfRecGlfwGetWindowParam(GLFW_OPENED), GL_FALSE);
+        GfRecGlfwOpenWindowHint(GLFW_OPENGL_VERSION_MAJOR, 3);
+        GfRecGlfwOpenWindowHint(GLFW_OPENGL_VERSION_MINOR, 3);
+        GfRecGlfwOpenWindowHint(GLFW_FSAA_SAMPLES, 4);
+        TS_ASSERT_EQUALS(GfRecGlfwOpenWindow(800, 600, 8, 8, 8, 0, 16, 0, GLFW_WINDOW), GL_TRUE);
+        TS_ASSERT_EQUALS(GfRecGlfwOpenWindow(800, 600, 8, 8, 8, 0, 16, 0, GLFW_WINDOW), GL_FALSE);
+        TS_ASSERT_EQUALS(GfRecGlfwGetWindowParam(GLFW_OPENED), GL_TRUE);
+        TS_ASSERT_EQUALS(GfRecGlfwGetWindowParam(GLFW_DEPTH_BITS), 16);
+        TS_ASSERT_EQUALS(GfRecGlfwGetWindowParam(GLFW_STENCIL_BITS), 8);
+        TS_ASSERT_EQUALS(GfRecGlfwGetWindowParam(GLFW_FSAA_SAMPLES), 4);
+        TS_ASSERT_EQUALS(GfRecGlfwGetWindowParam(GLFW_OPENGL_VERSION_MINOR), 3);
+        int major(0), minor(0), rev(-1);
+        GfRecGlfwGetGLVersion(&major, &minor, &rev);
+        TS_ASSERT(major == 3 && minor == 3 && rev == 0);
+
+        s_resizeWidth = s_resizeHeight = 0;
+        GfRecGlfwSetWindowSizeCallback(OnResize);
+        TS_ASSERT(s_resizeWidth == 800 && s_resizeHeight == 600);
+        GfRecGlfwSetWindowSize(1024, 768);
+        TS_ASSERT(s_resizeWidth == 1024 && s_resizeHeight == 768);
+        int width(0), height(0);
+        GfRecGlfwGetWindowSize(&width, &height);
+        TS_ASSERT(width == 1024 && height == 768);
+
+        GfRecGlfwIconifyWindow();
+        TS_ASSERT_EQUALS(GfRecGlfwGetWindowParam(GLFW_ACTIVE), GL_FALSE);
+        GfRecGlfwRestoreWindow();
+        TS_ASSERT_EQUALS(GfRecGlfwGetWindowParam(GLFW_ACTIVE), GL_TRUE);
+
+        // The hints only applied to the window opened.
+        GfRecGlfwCloseWindow();
+        TS_ASSERT_EQUALS(GfRecGlfwGetWindowParam(GLFW_OPENED), GL_FALSE);
+        TS_ASSERT_EQUALS(GfRecGlfwOpenWindow(0, 0, 0, 0, 0, 0, 0, 0, GLFW_WINDOW), GL_TRUE);
+        TS_ASSERT_EQUALS(GfRecGlfwGetWindowParam(GLFW_FSAA_SAMPLES), 0);
+        TS_ASSERT_EQUALS(GfRecGlfwGetWindowParam(GLFW_OPENGL_VERSION_MINOR), 2);
+        GfRecGlfwCloseWindow();
+
+        TS_ASSERT_EQUALS(GfRecGlewInit(), GLenum(GLEW_OK));
+        TS_ASSERT(GLEW_VERSION_3_0 && GLEW_EXT_texture_filter_anisotropic);
+    };
+};
+
+int GLRecorderTestSuite::s_resizeWidth = 0;
+int GLRecorderTestSuite::s_resizeHeight = 0;
+
+#endif
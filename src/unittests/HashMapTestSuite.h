@@ -0,0 +1,180 @@
+#pragma once
+#ifndef __HASH_MAP_TEST_SUITE_H
+#define __HASH_MAP_TEST_SUITE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file HashMapTestSuite.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the header for the HashMap Test Suite.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <string>
+
+#include <boost/shared_ptr.hpp>
+
+#include <cxxtest/TestSuite.h>
+
+#include "HashMap.h"
+
+// /////////////////////////////////////////////////////////////////
+// @class HashMapTestSuite
+// @author PJ O Halloran
+//
+// This class defines a series of unit tests for the HashMap class.
+//
+// /////////////////////////////////////////////////////////////////
+class HashMapTestSuite : public CxxTest::TestSuite {
+private:
+
+    typedef GameHalloran::U32 U32;
+    typedef GameHalloran::U64 U64;
+    typedef GameHalloran::HashMap<U32, U32> IntMap;
+
+public:
+
+    // /////////////////////////////////////////////////////////////////
+    // Constructor.
+    //
+    // /////////////////////////////////////////////////////////////////
+    HashMapTestSuite() : CxxTest::TestSuite() {
+
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Destructor.
+    //
+    // /////////////////////////////////////////////////////////////////
+    ~HashMapTestSuite() {
+
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testConstructor(void) {
+        IntMap obj;
+        TS_ASSERT(obj.IsEmpty());
+        TS_ASSERT_EQUALS(obj.GetSize(), 0);
+        TS_ASSERT_EQUALS(obj.GetCapacity(), 0);
+        TS_ASSERT(obj.Find(1) == NULL);
+        TS_ASSERT(!obj.Contains(1));
+        TS_ASSERT(!obj.Erase(1));
+        TS_ASSERT(obj.Begin() == obj.End());
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testInsertFindErase(void) {
+        IntMap obj;
+        TS_ASSERT(obj.Insert(5, 50));
+        TS_ASSERT(obj.Insert(6, 60));
+        TS_ASSERT(!obj.Insert(5, 55));
+        TS_ASSERT_EQUALS(obj.GetSize(), 2);
+        TS_ASSERT(obj.Find(5) != NULL);
+        TS_ASSERT_EQUALS(*obj.Find(5), 50);
+        TS_ASSERT_EQUALS(*obj.Find(6), 60);
+        TS_ASSERT(obj.Find(7) == NULL);
+
+        *obj.Find(6) = 61;
+        TS_ASSERT_EQUALS(*obj.Find(6), 61);
+
+        TS_ASSERT(obj.Erase(5));
+        TS_ASSERT(!obj.Erase(5));
+        TS_ASSERT(obj.Find(5) == NULL);
+        TS_ASSERT_EQUALS(*obj.Find(6), 61);
+        TS_ASSERT_EQUALS(obj.GetSize(), 1);
+
+        obj.Clear();
+        TS_ASSERT(obj.IsEmpty());
+        TS_ASSERT(obj.Find(6) == NULL);
+        TS_ASSERT(obj.GetCapacity() > 0);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testGrowAndChurn(void) {
+        // Compare against std::map while inserting and erasing with lots of collisions.
+        IntMap obj;
+        std::map<U32, U32> reference;
+        U32 seed = 12345;
+        for(U32 i = 0; i < 20000; ++i) {
+            seed = seed * 1103515245 + 12345;
+            const U32 key = (seed >> 8) % 2048;
+            if((seed >> 4) % 3 == 0) {
+                TS_ASSERT_EQUALS(obj.Erase(key), reference.erase(key) == 1);
+            } else {
+                TS_ASSERT_EQUALS(obj.Insert(key, i), reference.insert(std::make_pair(key, i)).second);
+            }
+        }
+
+        TS_ASSERT_EQUALS(obj.GetSize(), U64(reference.size()));
+        TS_ASSERT(obj.GetSize() * 10 <= obj.GetCapacity() * 7);
+        for(U32 key = 0; key < 2048; ++key) {
+            const U32 *valuePtr = obj.Find(key);
+            std::map<U32, U32>::const_iterator found = reference.find(key);
+            if(found == reference.end()) {
+                TS_ASSERT(valuePtr == NULL);
+            } else {
+                TS_ASSERT(valuePtr != NULL);
+                if(valuePtr) {
+                    TS_ASSERT_EQUALS(*valuePtr, found->second);
+                }
+            }
+        }
+
+        U64 visited = 0;
+        for(IntMap::Iterator i = obj.Begin(), end = obj.End(); i != end; ++i) {
+            TS_ASSERT_EQUALS(reference[i.GetKey()], i.GetValue());
+            ++visited;
+        }
+        TS_ASSERT_EQUALS(visited, obj.GetSize());
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testReserve(void) {
+        IntMap obj;
+        TS_ASSERT(obj.Reserve(1000));
+        const U64 capacity = obj.GetCapacity();
+        TS_ASSERT(capacity * 7 >= 1000 * 10);
+        for(U32 i = 0; i < 1000; ++i) {
+            TS_ASSERT(obj.Insert(i, i * 2));
+        }
+        TS_ASSERT_EQUALS(obj.GetCapacity(), capacity);
+        TS_ASSERT(obj.Reserve(10));
+        TS_ASSERT_EQUALS(obj.GetCapacity(), capacity);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testPointerKeysAndSharedValues(void) {
+        GameHalloran::HashMap<const std::string *, boost::shared_ptr<std::string> > obj;
+        std::string keys[64];
+        boost::shared_ptr<std::string> value(new std::string("value"));
+        for(U32 i = 0; i < 64; ++i) {
+            TS_ASSERT(obj.Insert(&keys[i], value));
+        }
+        TS_ASSERT_EQUALS(value.use_count(), 65);
+        TS_ASSERT(obj.Find(&keys[10]) != NULL);
+
+        // Erasing and clearing releases the values.
+        for(U32 i = 0; i < 32; ++i) {
+            TS_ASSERT(obj.Erase(&keys[i]));
+        }
+        TS_ASSERT_EQUALS(value.use_count(), 33);
+        TS_ASSERT(obj.Find(&keys[10]) == NULL);
+        TS_ASSERT(obj.Find(&keys[40]) != NULL);
+        obj.Clear();
+        TS_ASSERT_EQUALS(value.use_count(), 1);
+    };
+};
+
+#endif
@@ -0,0 +1,218 @@
+#pragma once
+#ifndef __IMAGE_PROCESSING_TEST_SUITE_H
+#define __IMAGE_PROCESSING_TEST_SUITE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file ImageProcessingTestSuite.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the header for the ImageProcessing Test Suite.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include "ImageProcessing.h"
+
+// /////////////////////////////////////////////////////////////////
+// @class ImageProcessingTestSuite
+// @author PJ O Halloran
+//
+// This class defines a series of unit tests for the CPU image
+// processing functions, checking the SIMD implementation against the
+// scalar reference.
+//
+// /////////////////////////////////////////////////////////////////
+class ImageProcessingTestSuite : public CxxTest::TestSuite {
+private:
+
+    typedef GameHalloran::U8 U8;
+    typedef GameHalloran::U32 U32;
+    typedef std::vector<U8> ByteVector;
+
+    // /////////////////////////////////////////////////////////////////
+    // Create an image of pseudo random bytes.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static ByteVector CreateNoise(const U32 size, U32 seed) {
+        ByteVector bytes(size);
+        for(U32 i = 0; i < size; ++i) {
+            seed = seed * 1664525u + 1013904223u;
+            bytes[i] = U8(seed >> 24);
+        }
+        return (bytes);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Create an RGBA image of a single colour.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static ByteVector CreateSolid(const U32 width, const U32 height, const U8 colour, const U8 alpha) {
+        ByteVector rgba(width * height * 4, colour);
+        for(U32 t = 0; t < width * height; ++t) {
+            rgba[t * 4 + 3] = alpha;
+        }
+        return (rgba);
+    };
+
+public:
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testFilterNames(void) {
+        TS_ASSERT_EQUALS(GameHalloran::FindResampleFilterFromString("Kaiser"), GameHalloran::RESAMPLE_FILTER_KAISER);
+        TS_ASSERT_EQUALS(GameHalloran::FindResampleFilterFromString("box"), GameHalloran::RESAMPLE_FILTER_BOX);
+        TS_ASSERT_EQUALS(GameHalloran::FindResampleFilterFromString("lanczos"), GameHalloran::RESAMPLE_FILTER_UNKNOWN);
+        TS_ASSERT_EQUALS(std::string(GameHalloran::FindStringFromResampleFilter(GameHalloran::RESAMPLE_FILTER_KAISER)), std::string("kaiser"));
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testSolidImagesAreExact(void) {
+        // Every 8 bit value survives the trip through linear space.
+        for(U32 v = 0; v < 256; ++v) {
+            const ByteVector rgba = CreateSolid(8, 6, U8(v), U8(255 - v));
+            for(U32 filter = GameHalloran::RESAMPLE_FILTER_FIRST; filter < GameHalloran::RESAMPLE_FILTER_COUNT; ++filter) {
+                for(U32 gamma = 0; gamma < 2; ++gamma) {
+                    ByteVector half;
+                    GameHalloran::DownsampleImage(&rgba[0], 8, 6, half, GameHalloran::ResampleFilter(filter), gamma != 0);
+                    TS_ASSERT_EQUALS(half.size(), size_t(4 * 3 * 4));
+                    TS_ASSERT_EQUALS(memcmp(&half[0], &rgba[0], half.size()), 0);
+                }
+            }
+        }
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testGammaCorrectBox(void) {
+        // Black and white average to sRGB 187.5 (linear 0.5), not 128.
+        U8 rgba[16] = { 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0 };
+        ByteVector half;
+        GameHalloran::DownsampleImage(rgba, 2, 2, half, GameHalloran::RESAMPLE_FILTER_BOX, false);
+        TS_ASSERT_EQUALS(half[0], 128);
+        TS_ASSERT_EQUALS(half[3], 128);
+        GameHalloran::DownsampleImage(rgba, 2, 2, half, GameHalloran::RESAMPLE_FILTER_BOX, true);
+        TS_ASSERT(half[0] == 187 || half[0] == 188);
+        TS_ASSERT_EQUALS(half[3], 128);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testDownsampleSimdMatchesScalar(void) {
+        const U32 sizes[][2] = { { 64, 32 }, { 37, 19 }, { 1, 9 }, { 9, 1 }, { 2, 2 }, { 1, 1 } };
+        for(U32 s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+            const U32 width = sizes[s][0], height = sizes[s][1];
+            const ByteVector rgba = CreateNoise(width * height * 4, s + 1);
+            for(U32 filter = GameHalloran::RESAMPLE_FILTER_FIRST; filter < GameHalloran::RESAMPLE_FILTER_COUNT; ++filter) {
+                for(U32 gamma = 0; gamma < 2; ++gamma) {
+                    ByteVector simd, scalar;
+                    GameHalloran::DownsampleImage(&rgba[0], width, height, simd, GameHalloran::ResampleFilter(filter), gamma != 0, true);
+                    GameHalloran::DownsampleImage(&rgba[0], width, height, scalar, GameHalloran::ResampleFilter(filter), gamma != 0, false);
+                    TS_ASSERT_EQUALS(simd.size(), scalar.size());
+                    TS_ASSERT_EQUALS(memcmp(&simd[0], &scalar[0], scalar.size()), 0);
+                }
+            }
+        }
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testMipChain(void) {
+        const ByteVector rgba = CreateNoise(5 * 3 * 4, 7);
+        std::vector<ByteVector> levels;
+        GameHalloran::GenerateMipChain(&rgba[0], 5, 3, levels, GameHalloran::RESAMPLE_FILTER_KAISER, true);
+        TS_ASSERT_EQUALS(levels.size(), size_t(2));
+        TS_ASSERT_EQUALS(levels[0].size(), size_t(2 * 1 * 4));
+        TS_ASSERT_EQUALS(levels[1].size(), size_t(1 * 1 * 4));
+
+        GameHalloran::GenerateMipChain(&rgba[0], 1, 1, levels);
+        TS_ASSERT(levels.empty());
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testPremultiplyAlpha(void) {
+        U8 texel[4] = { 255, 100, 3, 128 };
+        GameHalloran::PremultiplyAlpha(texel, 1);
+        TS_ASSERT_EQUALS(texel[0], 128);
+        TS_ASSERT_EQUALS(texel[1], 50);
+        TS_ASSERT_EQUALS(texel[2], 2);
+        TS_ASSERT_EQUALS(texel[3], 128);
+
+        // Every colour and alpha pair, rounded to nearest.
+        ByteVector simd(256 * 256 * 4);
+        for(U32 c = 0; c < 256; ++c) {
+            for(U32 a = 0; a < 256; ++a) {
+                U8 *texelPtr = &simd[(c * 256 + a) * 4];
+                texelPtr[0] = texelPtr[1] = texelPtr[2] = U8(c);
+                texelPtr[3] = U8(a);
+            }
+        }
+        ByteVector scalar(simd);
+        GameHalloran::PremultiplyAlpha(&simd[0], 256 * 256, true);
+        GameHalloran::PremultiplyAlpha(&scalar[0], 256 * 256, false);
+        TS_ASSERT_EQUALS(memcmp(&simd[0], &scalar[0], scalar.size()), 0);
+        for(U32 t = 0; t < 256 * 256; ++t) {
+            const U32 expected = ((t / 256) * (t % 256) * 2 + 255) / 510;
+            if(simd[t * 4] != expected || simd[t * 4 + 3] != t % 256) {
+                TS_FAIL("Premultiplied texel is not rounded to nearest");
+                break;
+            }
+        }
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testConversions(void) {
+        const U32 numberTexels = 37;
+        const ByteVector rgb = CreateNoise(numberTexels * 3, 3);
+
+        ByteVector rgba(numberTexels * 4), rgbaScalar(numberTexels * 4);
+        GameHalloran::ConvertRgbToRgba(&rgb[0], numberTexels, &rgba[0], 200, true);
+        GameHalloran::ConvertRgbToRgba(&rgb[0], numberTexels, &rgbaScalar[0], 200, false);
+        TS_ASSERT_EQUALS(memcmp(&rgba[0], &rgbaScalar[0], rgba.size()), 0);
+        TS_ASSERT_EQUALS(rgba[4 * 36 + 2], rgb[3 * 36 + 2]);
+        TS_ASSERT_EQUALS(rgba[4 * 5 + 3], 200);
+
+        ByteVector back(numberTexels * 3), backScalar(numberTexels * 3);
+        GameHalloran::ConvertRgbaToRgb(&rgba[0], numberTexels, &back[0], true);
+        GameHalloran::ConvertRgbaToRgb(&rgba[0], numberTexels, &backScalar[0], false);
+        TS_ASSERT_EQUALS(memcmp(&back[0], &rgb[0], rgb.size()), 0);
+        TS_ASSERT_EQUALS(memcmp(&backScalar[0], &rgb[0], rgb.size()), 0);
+
+        ByteVector swapped(rgba);
+        GameHalloran::SwapRedBlue(&swapped[0], numberTexels, true);
+        TS_ASSERT_EQUALS(swapped[4 * 10], rgba[4 * 10 + 2]);
+        TS_ASSERT_EQUALS(swapped[4 * 10 + 1], rgba[4 * 10 + 1]);
+        TS_ASSERT_EQUALS(swapped[4 * 10 + 2], rgba[4 * 10]);
+        GameHalloran::SwapRedBlue(&swapped[0], numberTexels, false);
+        TS_ASSERT_EQUALS(memcmp(&swapped[0], &rgba[0], rgba.size()), 0);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testFlipImageVertical(void) {
+        U8 rows[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+        GameHalloran::FlipImageVertical(rows, 3, 3);
+        TS_ASSERT_EQUALS(rows[0], 7);
+        TS_ASSERT_EQUALS(rows[4], 5);
+        TS_ASSERT_EQUALS(rows[8], 3);
+        GameHalloran::FlipImageVertical(rows, 9, 1);
+        TS_ASSERT_EQUALS(rows[0], 7);
+    };
+};
+
+#endif
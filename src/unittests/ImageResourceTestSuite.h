@@ -0,0 +1,488 @@
+#pragma once
+#ifndef __IMAGE_RESOURCE_TEST_SUITE_H
+#define __IMAGE_RESOURCE_TEST_SUITE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file ImageResourceTestSuite.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the header for the ImageResource Test Suite.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <csetjmp>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include "png/png.h"
+#include "jpeg/jpeglib.h"
+
+#include "ResCache2.h"
+#include "ImageResource.h"
+#include "ImageLoadingPipeline.h"
+#include "WorkerThreadPool.h"
+
+// /////////////////////////////////////////////////////////////////
+// @class ImageResourceTestSuite
+// @author PJ O Halloran
+//
+// This class defines a series of unit tests for decoding PNG, JPEG
+// and BCT images from memory with the ImageResHandle class and the
+// ImageLoadingPipeline class.
+//
+// The images are encoded by the tests and served to a ResCache from
+// memory.
+//
+// /////////////////////////////////////////////////////////////////
+class ImageResourceTestSuite : public CxxTest::TestSuite {
+private:
+
+    typedef GameHalloran::U8 U8;
+    typedef GameHalloran::U32 U32;
+    typedef GameHalloran::I32 I32;
+    typedef GameHalloran::Resource Resource;
+    typedef GameHalloran::ResCache ResCache;
+    typedef GameHalloran::ImageResource ImageResource;
+    typedef GameHalloran::ImageResHandle ImageResHandle;
+    typedef GameHalloran::ImageLoadingPipeline ImageLoadingPipeline;
+    typedef GameHalloran::WorkerThreadPool WorkerThreadPool;
+    typedef std::vector<U8> ByteVector;
+
+    static const U32 NUMBER_WORKER_THREADS = 2;
+
+    // /////////////////////////////////////////////////////////////////
+    // @class MemoryResourceFile
+    //
+    // Resource file serving files held in memory.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class MemoryResourceFile : public GameHalloran::IResourceFile {
+    private:
+        std::map<std::string, ByteVector> m_files;
+    public:
+        explicit MemoryResourceFile(const std::map<std::string, ByteVector> &files) : m_files(files) {};
+        virtual bool VOpen() {
+            return (true);
+        };
+        virtual boost::optional<I32> VGetResourceSize(const Resource &r) {
+            std::map<std::string, ByteVector>::const_iterator i = m_files.find(r.GetName());
+            return ((i == m_files.end()) ? boost::optional<I32>() : boost::optional<I32>(I32(i->second.size())));
+        };
+        virtual bool VGetResource(const Resource &r, char *buffer) {
+            std::map<std::string, ByteVector>::const_iterator i = m_files.find(r.GetName());
+            if(i == m_files.end()) {
+                return (false);
+            }
+            memcpy(buffer, &i->second[0], i->second.size());
+            return (true);
+        };
+        virtual bool VGetResourceListing(const std::string &, GameHalloran::ResourceListing &) {
+            return (false);
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // libpng write callback appending to a ByteVector.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static void PngWrite(png_structp pngPtr, png_bytep data, png_size_t length) {
+        ByteVector *outPtr = static_cast<ByteVector *>(png_get_io_ptr(pngPtr));
+        outPtr->insert(outPtr->end(), data, data + length);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // libpng flush callback.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static void PngFlush(png_structp) {
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Encode top down rows of pixels as a PNG.  A grey scale image has a
+    // tRNS chunk making transparentGrey transparent unless it is
+    // negative.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static ByteVector EncodePng(const ByteVector &rows, const U32 width, const U32 height, const int colorType, const U32 channels, \
+                                const int transparentGrey = -1) {
+        ByteVector png;
+        png_structp pngPtr = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+        png_infop infoPtr = png_create_info_struct(pngPtr);
+        if(setjmp(png_jmpbuf(pngPtr))) {
+            png_destroy_write_struct(&pngPtr, &infoPtr);
+            return (ByteVector());
+        }
+        png_set_write_fn(pngPtr, &png, PngWrite, PngFlush);
+        png_set_IHDR(pngPtr, infoPtr, width, height, 8, colorType, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+        if(transparentGrey >= 0) {
+            png_color_16 transparent;
+            memset(&transparent, 0, sizeof(transparent));
+            transparent.gray = png_uint_16(transparentGrey);
+            png_set_tRNS(pngPtr, infoPtr, NULL, 0, &transparent);
+        }
+        png_write_info(pngPtr, infoPtr);
+        for(U32 y = 0; y < height; ++y) {
+            png_write_row(pngPtr, const_cast<png_bytep>(&rows[y * width * channels]));
+        }
+        png_write_end(pngPtr, NULL);
+        png_destroy_write_struct(&pngPtr, &infoPtr);
+        return (png);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Encode top down rows of pixels as a JPEG.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static ByteVector EncodeJpeg(const ByteVector &rows, const U32 width, const U32 height, const U32 channels) {
+        jpeg_compress_struct cinfo;
+        jpeg_error_mgr errorMgr;
+        cinfo.err = jpeg_std_error(&errorMgr);
+        jpeg_create_compress(&cinfo);
+        unsigned char *outPtr = NULL;
+        unsigned long outSize = 0;
+        jpeg_mem_dest(&cinfo, &outPtr, &outSize);
+        cinfo.image_width = width;
+        cinfo.image_height = height;
+        cinfo.input_components = I32(channels);
+        cinfo.in_color_space = (channels == 1) ? JCS_GRAYSCALE : JCS_RGB;
+        jpeg_set_defaults(&cinfo);
+        jpeg_set_quality(&cinfo, 95, TRUE);
+        jpeg_start_compress(&cinfo, TRUE);
+        while(cinfo.next_scanline < cinfo.image_height) {
+            JSAMPROW row = const_cast<JSAMPROW>(&rows[cinfo.next_scanline * width * channels]);
+            jpeg_write_scanlines(&cinfo, &row, 1);
+        }
+        jpeg_finish_compress(&cinfo);
+        jpeg_destroy_compress(&cinfo);
+        ByteVector jpeg(outPtr, outPtr + outSize);
+        free(outPtr);
+        return (jpeg);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Get the byte of a decoded image.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static U8 Pixel(const ImageResHandle &image, const U32 x, const U32 y, const U32 channel) {
+        const U8 *bufferPtr = reinterpret_cast<const U8 *>(image.GetImageBuffer());
+        return (bufferPtr[(y * U32(image.GetImageWidth()) + x) * U32(image.GetImageDepth()) + channel]);
+    };
+
+    std::map<std::string, ByteVector> m_files;
+    ResCache *m_cachePtr;
+
+    // /////////////////////////////////////////////////////////////////
+    // Serve the files added to m_files from a new resource cache.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void CreateCache() {
+        delete m_cachePtr;
+        m_cachePtr = new ResCache(16, new MemoryResourceFile(m_files), boost::shared_ptr<GameHalloran::GameLog>());
+        TS_ASSERT(m_cachePtr->Init());
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Get and initialize an image from the resource cache.
+    //
+    // /////////////////////////////////////////////////////////////////
+    boost::shared_ptr<ImageResHandle> LoadImage(const std::string &name, bool &initializedRef) {
+        ImageResource imgRes(name);
+        boost::shared_ptr<ImageResHandle> imagePtr = boost::static_pointer_cast<ImageResHandle>(m_cachePtr->GetHandle(&imgRes));
+        initializedRef = (imagePtr && imagePtr->VInitialize());
+        return (imagePtr);
+    };
+
+public:
+
+    // /////////////////////////////////////////////////////////////////
+    // Constructor.
+    //
+    // /////////////////////////////////////////////////////////////////
+    ImageResourceTestSuite() : CxxTest::TestSuite(), m_files(), m_cachePtr(NULL) {
+
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Destructor.
+    //
+    // /////////////////////////////////////////////////////////////////
+    ~ImageResourceTestSuite() {
+
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // The GLFW thread API needs GLFW to be initialized.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void setUp() {
+        glfwInit();
+        m_files.clear();
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Free the cache.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void tearDown() {
+        delete m_cachePtr;
+        m_cachePtr = NULL;
+        glfwTerminate();
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testImageType(void) {
+        TS_ASSERT_EQUALS(GameHalloran::FindImageTypeFromFile("textures/a.png"), GameHalloran::IMAGE_TYPE_PNG);
+        TS_ASSERT_EQUALS(GameHalloran::FindImageTypeFromFile("textures/a.jpeg"), GameHalloran::IMAGE_TYPE_JPEG);
+        TS_ASSERT_EQUALS(GameHalloran::FindImageTypeFromFile("textures/a.jpg"), GameHalloran::IMAGE_TYPE_JPEG);
+        TS_ASSERT_EQUALS(GameHalloran::FindImageTypeFromFile("textures/a.bct"), GameHalloran::IMAGE_TYPE_BCT);
+        TS_ASSERT_EQUALS(GameHalloran::FindImageTypeFromFile("textures/a.gif"), GameHalloran::IMAGE_TYPE_UNKNOWN);
+        TS_ASSERT(GameHalloran::IsImageTypePacked(GameHalloran::IMAGE_TYPE_PNG));
+        TS_ASSERT(!GameHalloran::IsImageTypePacked(GameHalloran::IMAGE_TYPE_BMP));
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testPngRgb(void) {
+        // 3x2 image, the top row red, green, blue and the bottom row grey.
+        const U8 pixels[] = { 255, 0, 0, 0, 255, 0, 0, 0, 255, 10, 20, 30, 40, 50, 60, 70, 80, 90 };
+        m_files["rgb.png"] = EncodePng(ByteVector(pixels, pixels + sizeof(pixels)), 3, 2, PNG_COLOR_TYPE_RGB, 3);
+        CreateCache();
+
+        bool initialized = false;
+        boost::shared_ptr<ImageResHandle> imagePtr = LoadImage("rgb.png", initialized);
+        TS_ASSERT(initialized);
+        TS_ASSERT_EQUALS(imagePtr->GetImageWidth(), 3);
+        TS_ASSERT_EQUALS(imagePtr->GetImageHeight(), 2);
+        TS_ASSERT_EQUALS(imagePtr->GetImageDepth(), 3);
+        TS_ASSERT_EQUALS(imagePtr->GetImageSize(), 18);
+        TS_ASSERT_EQUALS(imagePtr->GetImageFormat(), GLenum(GL_RGB));
+        TS_ASSERT_EQUALS(imagePtr->GetImageComponents(), GL_RGB);
+
+        // The rows are stored bottom up.
+        TS_ASSERT_EQUALS(Pixel(*imagePtr, 0, 1, 0), 255);
+        TS_ASSERT_EQUALS(Pixel(*imagePtr, 1, 1, 1), 255);
+        TS_ASSERT_EQUALS(Pixel(*imagePtr, 2, 1, 2), 255);
+        TS_ASSERT_EQUALS(Pixel(*imagePtr, 0, 0, 0), 10);
+        TS_ASSERT_EQUALS(Pixel(*imagePtr, 2, 0, 2), 90);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testPngGreyAndAlpha(void) {
+        const U8 grey[] = { 0, 128, 255, 64 };
+        const U8 greyAlpha[] = { 200, 100, 50, 25 };
+        m_files["grey.png"] = EncodePng(ByteVector(grey, grey + sizeof(grey)), 2, 2, PNG_COLOR_TYPE_GRAY, 1);
+        m_files["greyalpha.png"] = EncodePng(ByteVector(greyAlpha, greyAlpha + sizeof(greyAlpha)), 2, 1, PNG_COLOR_TYPE_GRAY_ALPHA, 2);
+        CreateCache();
+
+        bool initialized = false;
+        boost::shared_ptr<ImageResHandle> greyPtr = LoadImage("grey.png", initialized);
+        TS_ASSERT(initialized);
+        TS_ASSERT_EQUALS(greyPtr->GetImageDepth(), 1);
+        TS_ASSERT_EQUALS(greyPtr->GetImageFormat(), GLenum(GL_LUMINANCE));
+        TS_ASSERT_EQUALS(Pixel(*greyPtr, 0, 0, 0), 255);
+        TS_ASSERT_EQUALS(Pixel(*greyPtr, 1, 1, 0), 128);
+
+        // Grey scale with alpha is expanded to RGBA.
+        boost::shared_ptr<ImageResHandle> greyAlphaPtr = LoadImage("greyalpha.png", initialized);
+        TS_ASSERT(initialized);
+        TS_ASSERT_EQUALS(greyAlphaPtr->GetImageDepth(), 4);
+        TS_ASSERT_EQUALS(greyAlphaPtr->GetImageFormat(), GLenum(GL_RGBA));
+        TS_ASSERT_EQUALS(Pixel(*greyAlphaPtr, 1, 0, 0), 50);
+        TS_ASSERT_EQUALS(Pixel(*greyAlphaPtr, 1, 0, 2), 50);
+        TS_ASSERT_EQUALS(Pixel(*greyAlphaPtr, 1, 0, 3), 25);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testPngGreyTransparency(void) {
+        const U8 grey[] = { 0, 128, 255, 64 };
+        m_files["greytrns.png"] = EncodePng(ByteVector(grey, grey + sizeof(grey)), 2, 2, PNG_COLOR_TYPE_GRAY, 1, 128);
+        CreateCache();
+
+        // Grey scale with a transparent grey level is expanded to RGBA.
+        bool initialized = false;
+        boost::shared_ptr<ImageResHandle> imagePtr = LoadImage("greytrns.png", initialized);
+        TS_ASSERT(initialized);
+        TS_ASSERT_EQUALS(imagePtr->GetImageDepth(), 4);
+        TS_ASSERT_EQUALS(imagePtr->GetImageFormat(), GLenum(GL_RGBA));
+        if(initialized && imagePtr->GetImageDepth() == 4) {
+            TS_ASSERT_EQUALS(Pixel(*imagePtr, 0, 0, 0), 255);
+            TS_ASSERT_EQUALS(Pixel(*imagePtr, 0, 0, 2), 255);
+            TS_ASSERT_EQUALS(Pixel(*imagePtr, 0, 0, 3), 255);
+            TS_ASSERT_EQUALS(Pixel(*imagePtr, 1, 1, 0), 128);
+            TS_ASSERT_EQUALS(Pixel(*imagePtr, 1, 1, 3), 0);
+        }
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testJpeg(void) {
+        // 16x16 image, the top half red and the bottom half blue.
+        ByteVector rgb(16 * 16 * 3, 0);
+        for(U32 i = 0; i < 16 * 16; ++i) {
+            rgb[i * 3 + ((i < 16 * 8) ? 0 : 2)] = 255;
+        }
+        m_files["rgb.jpg"] = EncodeJpeg(rgb, 16, 16, 3);
+        m_files["grey.jpeg"] = EncodeJpeg(ByteVector(8 * 8, 90), 8, 8, 1);
+        CreateCache();
+
+        bool initialized = false;
+        boost::shared_ptr<ImageResHandle> rgbPtr = LoadImage("rgb.jpg", initialized);
+        TS_ASSERT(initialized);
+        TS_ASSERT_EQUALS(rgbPtr->GetImageWidth(), 16);
+        TS_ASSERT_EQUALS(rgbPtr->GetImageDepth(), 3);
+        TS_ASSERT_EQUALS(rgbPtr->GetImageFormat(), GLenum(GL_RGB));
+        TS_ASSERT_DELTA(Pixel(*rgbPtr, 4, 12, 0), 255, 8);
+        TS_ASSERT_DELTA(Pixel(*rgbPtr, 4, 12, 2), 0, 8);
+        TS_ASSERT_DELTA(Pixel(*rgbPtr, 4, 3, 0), 0, 8);
+        TS_ASSERT_DELTA(Pixel(*rgbPtr, 4, 3, 2), 255, 8);
+
+        boost::shared_ptr<ImageResHandle> greyPtr = LoadImage("grey.jpeg", initialized);
+        TS_ASSERT(initialized);
+        TS_ASSERT_EQUALS(greyPtr->GetImageDepth(), 1);
+        TS_ASSERT_EQUALS(greyPtr->GetImageFormat(), GLenum(GL_LUMINANCE));
+        TS_ASSERT_DELTA(Pixel(*greyPtr, 3, 3, 0), 90, 2);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testBct(void) {
+        ByteVector rgba(16 * 8 * 4);
+        for(U32 p = 0; p < rgba.size(); ++p) {
+            rgba[p] = U8(p * 7);
+        }
+        ByteVector bct;
+        GameHalloran::EncodeCompressedTexture(&rgba[0], 16, 8, GameHalloran::BLOCK_FORMAT_BC3, true, bct);
+        m_files["tex.bct"] = bct;
+        CreateCache();
+
+        bool initialized = false;
+        boost::shared_ptr<ImageResHandle> imagePtr = LoadImage("tex.bct", initialized);
+        TS_ASSERT(initialized);
+        TS_ASSERT(imagePtr->IsCompressed());
+        TS_ASSERT_EQUALS(imagePtr->GetBlockFormat(), GameHalloran::BLOCK_FORMAT_BC3);
+        TS_ASSERT_EQUALS(imagePtr->GetImageFormat(), GLenum(GL_COMPRESSED_RGBA_S3TC_DXT5_EXT));
+        TS_ASSERT_EQUALS(imagePtr->GetImageWidth(), 16);
+        TS_ASSERT_EQUALS(imagePtr->GetImageHeight(), 8);
+        TS_ASSERT_EQUALS(imagePtr->GetNumberMipLevels(), U32(5));
+        TS_ASSERT_EQUALS(imagePtr->GetImageSize(), I32(bct.size() - GameHalloran::COMPRESSED_TEXTURE_HEADER_SIZE));
+
+        // 16x8, 8x4, 4x2, 2x1 and 1x1.
+        GLint width, height, size;
+        const GLbyte *levelPtr = imagePtr->GetMipLevelBuffer(0, width, height, size);
+        TS_ASSERT_EQUALS(levelPtr, imagePtr->GetImageBuffer());
+        TS_ASSERT_EQUALS(size, 8 * 16);
+        levelPtr = imagePtr->GetMipLevelBuffer(3, width, height, size);
+        TS_ASSERT_EQUALS(width, 2);
+        TS_ASSERT_EQUALS(height, 1);
+        TS_ASSERT_EQUALS(size, 16);
+        TS_ASSERT_EQUALS(levelPtr, imagePtr->GetImageBuffer() + (8 + 2 + 1) * 16);
+        TS_ASSERT(imagePtr->GetMipLevelBuffer(5, width, height, size) == NULL);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testCorruptImages(void) {
+        const U8 pixels[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+        ByteVector png = EncodePng(ByteVector(pixels, pixels + sizeof(pixels)), 2, 2, PNG_COLOR_TYPE_RGB, 3);
+        png.resize(png.size() / 2);
+        m_files["truncated.png"] = png;
+        m_files["garbage.jpg"] = ByteVector(pixels, pixels + sizeof(pixels));
+        m_files["garbage.bct"] = ByteVector(pixels, pixels + sizeof(pixels));
+        m_files["garbage.png"] = ByteVector(pixels, pixels + sizeof(pixels));
+        CreateCache();
+
+        bool initialized = true;
+        boost::shared_ptr<ImageResHandle> truncatedPtr = LoadImage("truncated.png", initialized);
+        TS_ASSERT(!initialized);
+        TS_ASSERT(truncatedPtr->GetImageBuffer() == NULL);
+        TS_ASSERT(!truncatedPtr->VInitialize());
+
+        initialized = true;
+        LoadImage("garbage.jpg", initialized);
+        TS_ASSERT(!initialized);
+
+        initialized = true;
+        LoadImage("garbage.bct", initialized);
+        TS_ASSERT(!initialized);
+
+        // Decode() reports the failure instead of logging it, once.
+        ImageResource imgRes("garbage.png");
+        boost::shared_ptr<ImageResHandle> garbagePtr = boost::static_pointer_cast<ImageResHandle>(m_cachePtr->GetHandle(&imgRes));
+        std::string message;
+        TS_ASSERT(garbagePtr && !garbagePtr->Decode(message));
+        TS_ASSERT_EQUALS(message, std::string("Failed to decode the image garbage.png"));
+        message.clear();
+        TS_ASSERT(garbagePtr && !garbagePtr->Decode(message));
+        TS_ASSERT(message.empty());
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testPipelineMatchesSerial(void) {
+        std::vector<std::string> names;
+        for(U32 i = 0; i < 8; ++i) {
+            ByteVector rgba(32 * 16 * 4);
+            for(U32 p = 0; p < rgba.size(); ++p) {
+                rgba[p] = U8((p * (i + 3)) & 0xFF);
+            }
+            names.push_back(std::string("image") + char('a' + i) + ".png");
+            m_files[names.back()] = EncodePng(rgba, 32, 16, PNG_COLOR_TYPE_RGB_ALPHA, 4);
+        }
+        m_files["broken.png"] = ByteVector(10, 0);
+        CreateCache();
+
+        boost::shared_ptr<WorkerThreadPool> poolPtr(new WorkerThreadPool(NUMBER_WORKER_THREADS));
+        TS_ASSERT(poolPtr->IsValid());
+
+        ImageLoadingPipeline pipeline(m_cachePtr, poolPtr);
+        std::vector<U32> indices;
+        for(U32 i = 0; i < names.size(); ++i) {
+            indices.push_back(pipeline.AddImage(names[i]));
+        }
+        TS_ASSERT_EQUALS(pipeline.AddImage(names[0]), indices[0]);
+        const U32 brokenIndex = pipeline.AddImage("broken.png");
+        const U32 missingIndex = pipeline.AddImage("missing.png");
+        TS_ASSERT_EQUALS(pipeline.GetNumberImages(), U32(names.size() + 2));
+
+        TS_ASSERT(pipeline.Start());
+        TS_ASSERT_EQUALS(pipeline.AddImage("late.png"), ImageLoadingPipeline::INVALID_IMAGE_INDEX);
+        TS_ASSERT_EQUALS(pipeline.GetNumberImages(), U32(names.size() + 2));
+        TS_ASSERT(!pipeline.Finish());
+        TS_ASSERT(!pipeline.GetImage(ImageLoadingPipeline::INVALID_IMAGE_INDEX));
+        TS_ASSERT(pipeline.IsDecodeComplete());
+        TS_ASSERT(!pipeline.GetImage(brokenIndex));
+        TS_ASSERT(!pipeline.GetImage(missingIndex));
+
+        // Decode the same files again on this thread to compare against.
+        std::map<std::string, ByteVector> files(m_files);
+        ResCache serialCache(16, new MemoryResourceFile(files), boost::shared_ptr<GameHalloran::GameLog>());
+        TS_ASSERT(serialCache.Init());
+        for(U32 i = 0; i < names.size(); ++i) {
+            boost::shared_ptr<ImageResHandle> imagePtr = pipeline.GetImage(indices[i]);
+            TS_ASSERT(imagePtr);
+            ImageResource imgRes(names[i]);
+            boost::shared_ptr<ImageResHandle> serialPtr = boost::static_pointer_cast<ImageResHandle>(serialCache.GetHandle(&imgRes));
+            TS_ASSERT(serialPtr && serialPtr->VInitialize());
+            TS_ASSERT_EQUALS(imagePtr->GetImageSize(), serialPtr->GetImageSize());
+            TS_ASSERT_EQUALS(memcmp(imagePtr->GetImageBuffer(), serialPtr->GetImageBuffer(), size_t(serialPtr->GetImageSize())), 0);
+        }
+    };
+};
+
+#endif
@@ -17,6 +17,7 @@
 #include <cxxtest/TestSuite.h>
 
 #include "LinkedList.h"
+#include "PoolAllocater.h"
 
 using std::cout;
 using std::string;
@@ -1160,6 +1161,53 @@ public:
         }
     };
 
+    // ////////////////////////////////////////////////////////////
+    //
+    //
+    // ////////////////////////////////////////////////////////////
+    void testSharedNodeAllocater(void) {
+        if(!IsTestDataReady()) {
+            TS_FAIL("Test data not created.");
+        }
+
+        GameHalloran::PoolAllocater nodePool(LinkedListString::GetNodeSize(), 4);
+        TS_ASSERT(nodePool.IsValid());
+
+        {
+            LinkedListString firstList(&nodePool);
+            LinkedListString secondList(&nodePool);
+
+            // The head and tail nodes are part of the lists, so empty lists allocate nothing.
+            TS_ASSERT_EQUALS(nodePool.GetNumberBlocksAllocated(), 0);
+            TS_ASSERT_EQUALS(nodePool.GetNumberChunks(), 0);
+
+            for(U32 i(0); i < 10; ++i) {
+                TS_ASSERT(firstList.PushBack(std::string("first")));
+                TS_ASSERT(secondList.PushFront(std::string("second")));
+            }
+            TS_ASSERT_EQUALS(firstList.Size(), 10);
+            TS_ASSERT_EQUALS(secondList.Size(), 10);
+            TS_ASSERT_EQUALS(nodePool.GetNumberBlocksAllocated(), 20);
+
+            std::string currElem;
+            TS_ASSERT(firstList.Front(currElem));
+            TS_ASSERT_EQUALS(currElem.compare("first"), 0);
+            TS_ASSERT(secondList.Back(currElem));
+            TS_ASSERT_EQUALS(currElem.compare("second"), 0);
+
+            // Freed nodes are reused by the other list.
+            firstList.Clear();
+            TS_ASSERT_EQUALS(nodePool.GetNumberBlocksAllocated(), 10);
+            const U32 numChunks = nodePool.GetNumberChunks();
+            for(U32 i(0); i < 10; ++i) {
+                TS_ASSERT(secondList.PushBack(std::string("second")));
+            }
+            TS_ASSERT_EQUALS(nodePool.GetNumberChunks(), numChunks);
+        }
+
+        TS_ASSERT_EQUALS(nodePool.GetNumberBlocksAllocated(), 0);
+    };
+
 };
 
 #endif
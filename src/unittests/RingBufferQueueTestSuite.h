@@ -0,0 +1,382 @@
+#pragma once
+#ifndef __RING_BUFFER_QUEUE_TEST_SUITE_H
+#define __RING_BUFFER_QUEUE_TEST_SUITE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file RingBufferQueueTestSuite.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the header for the RingBufferQueue Test Suite.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <iostream>
+
+#include <cxxtest/TestSuite.h>
+
+#include "RingBufferQueue.h"
+
+using std::cout;
+using std::string;
+using std::endl;
+
+// /////////////////////////////////////////////////////////////////
+// @class RingBufferQueueTestSuite
+// @author PJ O Halloran
+//
+// This class defines a series of unit tests for the
+// RingBufferQueue class.
+//
+// /////////////////////////////////////////////////////////////////
+class RingBufferQueueTestSuite : public CxxTest::TestSuite {
+private:
+
+    typedef GameHalloran::RingBufferQueue<int> QueueInt;
+    typedef GameHalloran::RingBufferQueue<std::string> QueueString;
+    typedef GameHalloran::RingBufferQueue<int *> QueueIntPointer;
+    typedef GameHalloran::U32 U32;
+
+    QueueInt *m_testPtr;
+    QueueString *m_testStrPtr;
+    QueueIntPointer *m_testArrPtr;
+
+    bool IsTestDataReady() {
+        return (NULL != m_testPtr && NULL != m_testStrPtr && NULL != m_testArrPtr);
+    };
+
+public:
+
+    // /////////////////////////////////////////////////////////////////
+    // Constructor.
+    //
+    // /////////////////////////////////////////////////////////////////
+    RingBufferQueueTestSuite() : CxxTest::TestSuite(), m_testPtr(NULL) {
+
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Destructor.
+    //
+    // /////////////////////////////////////////////////////////////////
+    ~RingBufferQueueTestSuite() {
+
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void setUp() {
+        m_testPtr = new QueueInt;
+        m_testStrPtr = new QueueString;
+        m_testArrPtr = new QueueIntPointer;
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void tearDown() {
+        delete m_testPtr;
+        m_testPtr = NULL;
+
+        delete m_testStrPtr;
+        m_testStrPtr = NULL;
+
+        delete m_testArrPtr;
+        m_testArrPtr = NULL;
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testDefaultConstructor(void) {
+        if(!IsTestDataReady()) {
+            TS_FAIL("Test data not created.");
+        }
+
+        QueueInt defaultObj;
+        TS_ASSERT(defaultObj.IsEmpty());
+        TS_ASSERT_EQUALS(defaultObj.Size(), 0);
+
+        QueueString strObj;
+        TS_ASSERT(strObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.Size(), 0);
+
+        QueueIntPointer ptrObj;
+        TS_ASSERT(ptrObj.IsEmpty());
+        TS_ASSERT_EQUALS(ptrObj.Size(), 0);
+    };
+
+    // ////////////////////////////////////////////////////////////
+    //
+    //
+    // ////////////////////////////////////////////////////////////
+    void testCopyConstructor(void) {
+        if(!IsTestDataReady()) {
+            TS_FAIL("Test data not created.");
+        }
+
+        QueueString strObj;
+        TS_ASSERT(strObj.PushFront(std::string("one")));
+        TS_ASSERT(strObj.PushFront(std::string("two")));
+        TS_ASSERT(strObj.PushFront(std::string("three")));
+
+        TS_ASSERT(!strObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.Size(), 3);
+
+        QueueString copyObj(strObj);
+
+        TS_ASSERT(!copyObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.Size(), copyObj.Size());
+
+        std::string currElemOrig, currElemCopy;
+
+        for(U32 i(0); i < 3; ++i) {
+            TS_ASSERT(strObj.PopBack(currElemOrig));
+            TS_ASSERT(copyObj.PopBack(currElemCopy));
+            TS_ASSERT_EQUALS(currElemOrig.compare(currElemCopy.c_str()), 0);
+            TS_ASSERT_EQUALS(strObj.Size(), copyObj.Size());
+        }
+        TS_ASSERT(strObj.IsEmpty());
+        TS_ASSERT(copyObj.IsEmpty());
+    };
+
+    // ////////////////////////////////////////////////////////////
+    //
+    //
+    // ////////////////////////////////////////////////////////////
+    void testOperatorAssignment(void) {
+        if(!IsTestDataReady()) {
+            TS_FAIL("Test data not created.");
+        }
+
+        QueueString strObj;
+        TS_ASSERT(strObj.PushFront(std::string("one")));
+        TS_ASSERT(strObj.PushFront(std::string("two")));
+        TS_ASSERT(strObj.PushFront(std::string("three")));
+
+        TS_ASSERT(!strObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.Size(), 3);
+
+        QueueString copyObj;
+        copyObj = strObj;
+
+        TS_ASSERT(!copyObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.Size(), copyObj.Size());
+
+        std::string currElemOrig, currElemCopy;
+
+        for(U32 i(0); i < 3; ++i) {
+            TS_ASSERT(strObj.PopBack(currElemOrig));
+            TS_ASSERT(copyObj.PopBack(currElemCopy));
+            TS_ASSERT_EQUALS(currElemOrig.compare(currElemCopy.c_str()), 0);
+            TS_ASSERT_EQUALS(strObj.Size(), copyObj.Size());
+        }
+        TS_ASSERT(strObj.IsEmpty());
+        TS_ASSERT(copyObj.IsEmpty());
+    };
+
+    // ////////////////////////////////////////////////////////////
+    //
+    //
+    // ////////////////////////////////////////////////////////////
+    void testSizeAndIsEmpty(void) {
+        if(!IsTestDataReady()) {
+            TS_FAIL("Test data not created.");
+        }
+
+        QueueString strObj;
+
+        TS_ASSERT(strObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.Size(), 0);
+
+        TS_ASSERT(strObj.PushFront(std::string("one")));
+
+        TS_ASSERT(!strObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.Size(), 1);
+
+        TS_ASSERT(strObj.PushFront(std::string("two")));
+
+        TS_ASSERT(!strObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.Size(), 2);
+
+        TS_ASSERT(strObj.PushFront(std::string("three")));
+
+        TS_ASSERT(!strObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.Size(), 3);
+
+        std::string tmp;
+        TS_ASSERT(strObj.PopBack(tmp));
+
+        TS_ASSERT(!strObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.Size(), 2);
+
+        TS_ASSERT(strObj.PopBack(tmp));
+
+        TS_ASSERT(!strObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.Size(), 1);
+
+        TS_ASSERT(strObj.PopBack(tmp));
+
+        TS_ASSERT(strObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.Size(), 0);
+    };
+
+    // ////////////////////////////////////////////////////////////
+    //
+    //
+    // ////////////////////////////////////////////////////////////
+    void testPushFrontAndPopBack(void) {
+        if(!IsTestDataReady()) {
+            TS_FAIL("Test data not created.");
+        }
+
+        QueueString strObj;
+        TS_ASSERT(strObj.PushFront(std::string("one")));
+        TS_ASSERT(strObj.PushFront(std::string("two")));
+        TS_ASSERT(strObj.PushFront(std::string("three")));
+
+        TS_ASSERT(!strObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.Size(), 3);
+
+        std::string currElem;
+        TS_ASSERT(strObj.PopBack(currElem));
+        TS_ASSERT_EQUALS(currElem.compare("one"), 0);
+        TS_ASSERT(!strObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.Size(), 2);
+
+        TS_ASSERT(strObj.PopBack(currElem));
+        TS_ASSERT_EQUALS(currElem.compare("two"), 0);
+        TS_ASSERT(!strObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.Size(), 1);
+
+        TS_ASSERT(strObj.PopBack(currElem));
+        TS_ASSERT_EQUALS(currElem.compare("three"), 0);
+        TS_ASSERT(strObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.Size(), 0);
+
+        std::string copyElem(currElem);
+        TS_ASSERT(!strObj.PopBack(currElem));
+        TS_ASSERT_EQUALS(copyElem.compare(currElem.c_str()), 0);
+    };
+
+    // ////////////////////////////////////////////////////////////
+    //
+    //
+    // ////////////////////////////////////////////////////////////
+    void testClear(void) {
+        if(!IsTestDataReady()) {
+            TS_FAIL("Test data not created.");
+        }
+
+        QueueString strObj;
+
+        TS_ASSERT(strObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.Size(), 0);
+
+        TS_ASSERT(strObj.PushFront(std::string("one")));
+        TS_ASSERT(strObj.PushFront(std::string("two")));
+        TS_ASSERT(strObj.PushFront(std::string("three")));
+
+        TS_ASSERT(!strObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.Size(), 3);
+
+        strObj.Clear();
+
+        TS_ASSERT(strObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.Size(), 0);
+    };
+
+    // ////////////////////////////////////////////////////////////
+    //
+    //
+    // ////////////////////////////////////////////////////////////
+    void testReserveAndCapacity(void) {
+        if(!IsTestDataReady()) {
+            TS_FAIL("Test data not created.");
+        }
+
+        QueueInt defaultObj;
+        TS_ASSERT_EQUALS(defaultObj.GetCapacity(), 0);
+
+        QueueInt capacityObj(100);
+        TS_ASSERT(capacityObj.IsEmpty());
+        TS_ASSERT_EQUALS(capacityObj.GetCapacity(), 128);
+
+        // Never shrinks.
+        TS_ASSERT(capacityObj.Reserve(10));
+        TS_ASSERT_EQUALS(capacityObj.GetCapacity(), 128);
+
+        for(int i(0); i < 128; ++i) {
+            TS_ASSERT(capacityObj.PushFront(i));
+        }
+        TS_ASSERT_EQUALS(capacityObj.GetCapacity(), 128);
+
+        TS_ASSERT(capacityObj.PushFront(128));
+        TS_ASSERT_EQUALS(capacityObj.GetCapacity(), 256);
+        TS_ASSERT_EQUALS(capacityObj.Size(), 129);
+    };
+
+    // ////////////////////////////////////////////////////////////
+    //
+    //
+    // ////////////////////////////////////////////////////////////
+    void testWrapAroundAndGrowth(void) {
+        if(!IsTestDataReady()) {
+            TS_FAIL("Test data not created.");
+        }
+
+        QueueString strObj(8);
+        std::string currElem;
+        int pushed(0), popped(0);
+
+        // Move the head around the buffer so the elements wrap before it grows.
+        for(U32 round(0); round < 10; ++round) {
+            for(U32 i(0); i < 5; ++i, ++pushed) {
+                TS_ASSERT(strObj.PushFront(std::string(1, char('a' + (pushed % 26)))));
+            }
+            for(U32 i(0); i < 3; ++i, ++popped) {
+                TS_ASSERT(strObj.PopBack(currElem));
+                TS_ASSERT_EQUALS(currElem, std::string(1, char('a' + (popped % 26))));
+            }
+        }
+        TS_ASSERT_EQUALS(strObj.Size(), 20);
+        TS_ASSERT_EQUALS(strObj.GetCapacity(), 32);
+
+        while(!strObj.IsEmpty()) {
+            TS_ASSERT(strObj.PopBack(currElem));
+            TS_ASSERT_EQUALS(currElem, std::string(1, char('a' + (popped % 26))));
+            ++popped;
+        }
+        TS_ASSERT_EQUALS(pushed, popped);
+    };
+
+    // ////////////////////////////////////////////////////////////
+    //
+    //
+    // ////////////////////////////////////////////////////////////
+    void testClearKeepsCapacity(void) {
+        if(!IsTestDataReady()) {
+            TS_FAIL("Test data not created.");
+        }
+
+        QueueString strObj;
+        for(U32 i(0); i < 20; ++i) {
+            TS_ASSERT(strObj.PushFront(std::string("element")));
+        }
+        TS_ASSERT_EQUALS(strObj.GetCapacity(), 32);
+
+        strObj.Clear();
+        TS_ASSERT(strObj.IsEmpty());
+        TS_ASSERT_EQUALS(strObj.GetCapacity(), 32);
+
+        TS_ASSERT(strObj.PushFront(std::string("one")));
+        std::string currElem;
+        TS_ASSERT(strObj.PopBack(currElem));
+        TS_ASSERT_EQUALS(currElem.compare("one"), 0);
+    };
+
+};
+
+#endif
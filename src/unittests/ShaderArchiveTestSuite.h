@@ -0,0 +1,288 @@
+#pragma once
+#ifndef __SHADER_ARCHIVE_TEST_SUITE_H
+#define __SHADER_ARCHIVE_TEST_SUITE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file ShaderArchiveTestSuite.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the header for the ShaderArchive Test Suite.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include <cxxtest/TestSuite.h>
+
+#include "ShaderArchive.h"
+
+// /////////////////////////////////////////////////////////////////
+// @class ShaderArchiveTestSuite
+// @author PJ O Halloran
+//
+// This class defines a series of unit tests for the preprocessing,
+// permutations and packing of the shader archive, none of which need
+// a GPU.  It also packs the Pool3D shader manifest and checks the
+// archive against the shader files.
+//
+// /////////////////////////////////////////////////////////////////
+class ShaderArchiveTestSuite : public CxxTest::TestSuite {
+private:
+
+    typedef GameHalloran::U8 U8;
+    typedef GameHalloran::ShaderDefineList ShaderDefineList;
+    typedef GameHalloran::ShaderOptionList ShaderOptionList;
+    typedef GameHalloran::ShaderArchiveWriter ShaderArchiveWriter;
+    typedef GameHalloran::ShaderArchive ShaderArchive;
+    typedef GameHalloran::ShaderArchiveProgram ShaderArchiveProgram;
+    typedef GameHalloran::ShaderManifestProgram ShaderManifestProgram;
+    typedef GameHalloran::ShaderManifestPermutation ShaderManifestPermutation;
+
+    boost::filesystem::path m_includeDir;   ///< Directory of the test includes.
+
+    // /////////////////////////////////////////////////////////////////
+    // Write an include file.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void WriteInclude(const std::string &filename, const std::string &contents) {
+        std::ofstream out((m_includeDir / filename).string().c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+        out << contents;
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Read a shader file.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static std::string ReadShaderFile(const boost::filesystem::path &filePath) {
+        std::ifstream in(filePath.string().c_str(), std::ios::in | std::ios::binary);
+        return (std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>()));
+    };
+
+public:
+
+    // /////////////////////////////////////////////////////////////////
+    // Called before each test.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void setUp() {
+        m_includeDir = boost::filesystem::path(std::string("testdata/shaderarchive"));
+        boost::filesystem::remove_all(m_includeDir);
+        boost::filesystem::create_directories(m_includeDir);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Called after each test.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void tearDown() {
+        boost::filesystem::remove_all(m_includeDir);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test includes are expanded and only the defines a source uses are
+    // inserted, after its #version line.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testPreprocess(void) {
+        WriteInclude("lights.glsl", "#include \"consts.glsl\"\nuniform int u_numberLights;");
+        WriteInclude("consts.glsl", "const int MAX_NUMBER_LIGHTS = 8;\n");
+
+        ShaderDefineList defines;
+        defines.push_back(std::make_pair(std::string("GF_FOG"), std::string("LINEAR")));
+        defines.push_back(std::make_pair(std::string("GF_LIGHTING"), std::string()));
+        defines.push_back(std::make_pair(std::string("GF_UNUSED"), std::string("1")));
+
+        std::string out, message;
+        TS_ASSERT(GameHalloran::PreprocessShaderSource("// Header\r\n#version 150\r\n  #include \"lights.glsl\"\r\n#ifdef GF_LIGHTING\r\n#endif\r\n" \
+                  "int fog = GF_FOG;\r\nint GF_UNUSED_X;\r\n", m_includeDir, defines, out, message));
+        TS_ASSERT_EQUALS(out, std::string("// Header\r\n#version 150\r\n#define GF_FOG LINEAR\n#define GF_LIGHTING\n" \
+                                          "const int MAX_NUMBER_LIGHTS = 8;\nuniform int u_numberLights;\n#ifdef GF_LIGHTING\r\n#endif\r\n" \
+                                          "int fog = GF_FOG;\r\nint GF_UNUSED_X;\r\n"));
+
+        // Without a #version line the defines come first.
+        TS_ASSERT(GameHalloran::PreprocessShaderSource("int fog = GF_FOG;", m_includeDir, defines, out, message));
+        TS_ASSERT_EQUALS(out, std::string("#define GF_FOG LINEAR\nint fog = GF_FOG;"));
+        TS_ASSERT(GameHalloran::PreprocessShaderSource("#version 150", m_includeDir, defines, out, message));
+        TS_ASSERT_EQUALS(out, std::string("#version 150\n"));
+
+        // Missing and cyclic includes fail.
+        TS_ASSERT(!GameHalloran::PreprocessShaderSource("#include \"missing.glsl\"\n", m_includeDir, defines, out, message));
+        TS_ASSERT(!message.empty());
+        WriteInclude("cycle.glsl", "#include \"cycle.glsl\"\n");
+        TS_ASSERT(!GameHalloran::PreprocessShaderSource("#include \"cycle.glsl\"\n", m_includeDir, defines, out, message));
+        TS_ASSERT(!GameHalloran::PreprocessShaderSource("#include <lights.glsl>\n", m_includeDir, defines, out, message));
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test the permutations of a program's options and their names.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testPermutations(void) {
+        ShaderOptionList options;
+        std::vector<std::string> lighting, fog;
+        lighting.push_back("1");
+        lighting.push_back("0");
+        fog.push_back("NONE");
+        fog.push_back("LINEAR");
+        fog.push_back("EXP");
+        options.push_back(std::make_pair(std::string("GF_LIGHTING"), lighting));
+        options.push_back(std::make_pair(std::string("GF_EMPTY"), std::vector<std::string>()));
+        options.push_back(std::make_pair(std::string("GF_FOG"), fog));
+
+        std::vector<ShaderDefineList> permutations;
+        GameHalloran::GetShaderPermutations(options, permutations);
+        TS_ASSERT_EQUALS(permutations.size(), 6u);
+        TS_ASSERT_EQUALS(permutations[0].size(), 2u);
+        TS_ASSERT_EQUALS(GameHalloran::GetShaderPermutationName("shaders/Ads", permutations[0]), std::string("shaders/Ads[GF_FOG=NONE,GF_LIGHTING=1]"));
+        TS_ASSERT_EQUALS(GameHalloran::GetShaderPermutationName("shaders/Ads", permutations[5]), std::string("shaders/Ads[GF_FOG=EXP,GF_LIGHTING=0]"));
+        TS_ASSERT_EQUALS(GameHalloran::GetShaderPermutationName("shaders/Ads", ShaderDefineList()), std::string("shaders/Ads"));
+
+        GameHalloran::GetShaderPermutations(ShaderOptionList(), permutations);
+        TS_ASSERT_EQUALS(permutations.size(), 1u);
+        TS_ASSERT(permutations[0].empty());
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test programs are found after packing, identical sources are
+    // stored once and damaged archives are rejected.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testWriteAndLoad(void) {
+        ShaderArchiveWriter writer;
+        TS_ASSERT(writer.AddProgram("shaders/flat", "flat vs", "flat gs", "flat fs"));
+        TS_ASSERT(writer.AddProgram("shaders/Ads[GF_FOG=NONE]", "ads vs", NULL, "ads fs none"));
+        TS_ASSERT(writer.AddProgram("shaders/Ads[GF_FOG=LINEAR]", "ads vs", NULL, "ads fs linear"));
+        TS_ASSERT(writer.AddProgram("shaders/Ads", "ads vs", NULL, "ads fs none"));
+        TS_ASSERT(!writer.AddProgram("shaders/flat", "vs", NULL, "fs"));
+        TS_ASSERT(!writer.AddProgram("shaders/FLAT", "vs", NULL, "fs"));
+        TS_ASSERT(!writer.AddProgram("shaders/none", NULL, NULL, "fs"));
+        TS_ASSERT_EQUALS(writer.GetNumberPrograms(), 4u);
+        TS_ASSERT_EQUALS(writer.GetNumberSources(), 9u);
+        TS_ASSERT_EQUALS(writer.GetNumberSourcesStored(), 6u);
+
+        std::vector<U8> data;
+        writer.Encode(data);
+
+        ShaderArchive archive;
+        TS_ASSERT(archive.Load(&data[0], data.size()));
+        TS_ASSERT_EQUALS(archive.GetPrograms().size(), 4u);
+
+        const ShaderArchiveProgram *flatPtr = archive.Find("shaders/flat");
+        TS_ASSERT(flatPtr != NULL);
+        if(flatPtr) {
+            TS_ASSERT_EQUALS(std::string(flatPtr->m_vsSrc), std::string("flat vs"));
+            TS_ASSERT_EQUALS(std::string(flatPtr->m_gsSrc), std::string("flat gs"));
+            TS_ASSERT_EQUALS(std::string(flatPtr->m_fsSrc), std::string("flat fs"));
+        }
+        const ShaderArchiveProgram *linearPtr = archive.Find("shaders/Ads[GF_FOG=LINEAR]");
+        const ShaderArchiveProgram *defaultPtr = archive.Find("shaders/Ads");
+        TS_ASSERT(linearPtr != NULL && defaultPtr != NULL);
+        if(linearPtr && defaultPtr) {
+            TS_ASSERT(linearPtr->m_gsSrc == NULL);
+            TS_ASSERT_EQUALS(std::string(linearPtr->m_fsSrc), std::string("ads fs linear"));
+            TS_ASSERT_EQUALS(linearPtr->m_vsSrc, defaultPtr->m_vsSrc);
+        }
+        TS_ASSERT(archive.Find("shaders/missing") == NULL);
+        TS_ASSERT(archive.Find("shaders/FLAT") == NULL);
+
+        // Every truncation, trailing data and a bad magic are rejected.
+        for(size_t length = 0; length < data.size(); ++length) {
+            TS_ASSERT(!archive.Load(&data[0], length));
+        }
+        TS_ASSERT(archive.GetPrograms().empty());
+        std::vector<U8> longer(data);
+        longer.push_back(0);
+        TS_ASSERT(!archive.Load(&longer[0], longer.size()));
+        std::vector<U8> badMagic(data);
+        badMagic[0] = 'X';
+        TS_ASSERT(!archive.Load(&badMagic[0], badMagic.size()));
+
+        // An empty archive is valid.
+        ShaderArchiveWriter emptyWriter;
+        emptyWriter.Encode(data);
+        TS_ASSERT(archive.Load(&data[0], data.size()));
+        TS_ASSERT(archive.Find("shaders/flat") == NULL);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test every permutation the Pool3D shader manifest packs matches
+    // the shader files it replaces, as BuildShaderFromResourceCache()
+    // reads and preprocesses them when there is no archive.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testShippedManifest(void) {
+        const boost::filesystem::path shaderDir(std::string("../Pool3d/data/shaders"));
+        std::vector<ShaderManifestProgram> programs;
+        std::vector<ShaderManifestPermutation> permutations;
+        std::string message;
+        TS_ASSERT(GameHalloran::ReadShaderManifest(shaderDir / "shaders.xml", programs, message));
+        TS_ASSERT(GameHalloran::PreprocessShaderManifest(shaderDir, programs, permutations, message));
+        TS_ASSERT(!programs.empty());
+
+        ShaderArchiveWriter writer;
+        for(std::vector<ShaderManifestPermutation>::const_iterator i = permutations.begin(), end = permutations.end(); i != end; ++i) {
+            TS_ASSERT(writer.AddProgram(i->m_name, i->m_vsSrc.c_str(), i->m_hasGs ? i->m_gsSrc.c_str() : NULL, i->m_fsSrc.c_str()));
+        }
+        std::vector<U8> data;
+        writer.Encode(data);
+        ShaderArchive archive;
+        TS_ASSERT(archive.Load(&data[0], data.size()));
+
+        for(std::vector<ShaderManifestProgram>::const_iterator i = programs.begin(), end = programs.end(); i != end; ++i) {
+            // The program is otherwise read from shaders/<name>.vp and .fp.
+            const std::string fileName(i->m_name.substr(i->m_name.find('/') + 1));
+            TS_ASSERT_EQUALS(i->m_name.substr(0, i->m_name.find('/')), std::string("shaders"));
+            TS_ASSERT_EQUALS(i->m_vsFile, fileName + std::string(".vp"));
+            TS_ASSERT_EQUALS(i->m_fsFile, fileName + std::string(".fp"));
+            TS_ASSERT(i->m_gsFile.empty());
+            const std::string vsFileSrc(ReadShaderFile(shaderDir / i->m_vsFile));
+            const std::string fsFileSrc(ReadShaderFile(shaderDir / i->m_fsFile));
+            TS_ASSERT(!vsFileSrc.empty() && !fsFileSrc.empty());
+
+            std::vector<ShaderDefineList> defineLists;
+            GameHalloran::GetShaderPermutations(i->m_options, defineLists);
+            for(std::vector<ShaderDefineList>::const_iterator j = defineLists.begin(), jEnd = defineLists.end(); j != jEnd; ++j) {
+                std::string vsSrc, fsSrc;
+                TS_ASSERT(GameHalloran::PreprocessShaderSource(vsFileSrc, boost::filesystem::path(), *j, vsSrc, message));
+                TS_ASSERT(GameHalloran::PreprocessShaderSource(fsFileSrc, boost::filesystem::path(), *j, fsSrc, message));
+
+                const std::string permutationName(GameHalloran::GetShaderPermutationName(i->m_name, *j));
+                const ShaderArchiveProgram *programPtr = archive.Find(permutationName);
+                TS_ASSERT(programPtr != NULL);
+                if(programPtr) {
+                    TS_ASSERT_EQUALS(std::string(programPtr->m_vsSrc), vsSrc);
+                    TS_ASSERT_EQUALS(std::string(programPtr->m_fsSrc), fsSrc);
+                    TS_ASSERT(programPtr->m_gsSrc == NULL);
+                }
+            }
+
+            // The program's own name is its default permutation.
+            const ShaderArchiveProgram *defaultPtr = archive.Find(i->m_name);
+            const ShaderArchiveProgram *firstPtr = archive.Find(GameHalloran::GetShaderPermutationName(i->m_name, defineLists.front()));
+            TS_ASSERT(defaultPtr != NULL && firstPtr != NULL);
+            if(defaultPtr && firstPtr) {
+                TS_ASSERT_EQUALS(defaultPtr->m_vsSrc, firstPtr->m_vsSrc);
+                TS_ASSERT_EQUALS(defaultPtr->m_fsSrc, firstPtr->m_fsSrc);
+            }
+        }
+
+        // The fog type is only defined in the ADS fragment shader, so the
+        // vertex shader of each fog permutation is stored once.
+        const ShaderArchiveProgram *linearPtr = archive.Find("shaders/ProgrammablePhongAds[GF_ADS_FOG=FOG_LINEAR,GF_ADS_LIGHTS=0,GF_ADS_UNIFORM_BLOCKS=1]");
+        const ShaderArchiveProgram *offPtr = archive.Find("shaders/ProgrammablePhongAds[GF_ADS_FOG=FOG_OFF,GF_ADS_LIGHTS=0,GF_ADS_UNIFORM_BLOCKS=1]");
+        TS_ASSERT(linearPtr != NULL && offPtr != NULL);
+        if(linearPtr && offPtr) {
+            TS_ASSERT(std::string(linearPtr->m_fsSrc).find("#define GF_ADS_FOG FOG_LINEAR\n") != std::string::npos);
+            TS_ASSERT(std::string(linearPtr->m_vsSrc).find("GF_ADS_FOG") == std::string::npos);
+            TS_ASSERT_EQUALS(linearPtr->m_vsSrc, offPtr->m_vsSrc);
+        }
+    };
+};
+
+#endif
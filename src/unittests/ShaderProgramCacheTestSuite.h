@@ -0,0 +1,347 @@
+#pragma once
+#ifndef __SHADER_PROGRAM_CACHE_TEST_SUITE_H
+#define __SHADER_PROGRAM_CACHE_TEST_SUITE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file ShaderProgramCacheTestSuite.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the header for the ShaderProgramCache Test Suite.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <cxxtest/TestSuite.h>
+
+#include "ShaderProgramCache.h"
+#include "GLSLShader.h"
+#ifdef GF_GL_RECORDING
+#include "GLRecorder.h"
+#endif
+
+// /////////////////////////////////////////////////////////////////
+// @class ShaderProgramCacheTestSuite
+// @author PJ O Halloran
+//
+// This class defines a series of unit tests for the uniform parsing,
+// keying and entry files of the shader program cache, none of which
+// need a GPU.  With the GF_GL_RECORDING backend it also tests
+// GLSLShader storing, loading and rebuilding program binaries.
+//
+// /////////////////////////////////////////////////////////////////
+class ShaderProgramCacheTestSuite : public CxxTest::TestSuite {
+private:
+
+    typedef GameHalloran::U8 U8;
+    typedef GameHalloran::U32 U32;
+    typedef GameHalloran::U64 U64;
+    typedef GameHalloran::ShaderUniformTable ShaderUniformTable;
+    typedef GameHalloran::ShaderProgramBinary ShaderProgramBinary;
+    typedef GameHalloran::ShaderProgramCache ShaderProgramCache;
+
+    boost::filesystem::path m_cacheDir;     ///< Directory of the test caches.
+
+    // /////////////////////////////////////////////////////////////////
+    // Create an entry as the shader would after building a program.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static ShaderProgramBinary CreateBinary(const U64 sourceHash) {
+        ShaderProgramBinary binary;
+        binary.m_sourceHash = sourceHash;
+        binary.m_driverStr = "Vendor | Renderer | 4.1";
+        binary.m_format = 0x1234;
+        binary.m_buildSeconds = 0.25f;
+        for(U32 i = 0; i < 100; ++i) {
+            binary.m_binary.push_back(U8(i * 7));
+        }
+        binary.m_uniformTable.m_uniforms.push_back(std::make_pair(std::string("mvpMatrix"), GLint(0)));
+        binary.m_uniformTable.m_uniforms.push_back(std::make_pair(std::string("unused"), GLint(-1)));
+        binary.m_uniformTable.m_blocks.push_back(std::make_pair(std::string("AdsFrame"), GLuint(1)));
+        return (binary);
+    };
+
+#ifdef GF_GL_RECORDING
+    // /////////////////////////////////////////////////////////////////
+    // Count the calls to an OpenGL function in the recorder's call log.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static U32 CountCalls(const char *nameStr) {
+        const std::vector<const char *> &callLog = GameHalloran::GLRecorder::GetGlobalInstance().GetCallLog();
+        U32 count = 0;
+        for(std::vector<const char *>::const_iterator i = callLog.begin(), end = callLog.end(); i != end; ++i) {
+            if(strcmp(*i, nameStr) == 0) {
+                ++count;
+            }
+        }
+        return (count);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Build a program through the cache and count the shaders compiled
+    // and program binaries given to the driver.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static bool BuildProgram(boost::shared_ptr<ShaderProgramCache> cachePtr, const char *vsSrc, const char *fsSrc, \
+                             const GameHalloran::VSAttributeNameList &attList, U32 &compilesRef, U32 &binariesRef) {
+        GameHalloran::GLRecorder::GetGlobalInstance().ClearCallLog();
+
+        GameHalloran::GLSLShader shader;
+        std::string message;
+        shader.SetProgramCache(cachePtr);
+        const bool result = shader.Build(vsSrc, fsSrc, attList, message) && shader.IsBuilt() && \
+                            shader.GetUniform("mvpMatrix") && shader.GetUniform("color");
+
+        compilesRef = CountCalls("glCompileShader");
+        binariesRef = CountCalls("glProgramBinary");
+        return (result);
+    };
+#endif
+
+public:
+
+    // /////////////////////////////////////////////////////////////////
+    // Called before each test.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void setUp() {
+        m_cacheDir = boost::filesystem::path(std::string("testdata/shadercache"));
+        boost::filesystem::remove_all(m_cacheDir);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Called after each test.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void tearDown() {
+        boost::filesystem::remove_all(m_cacheDir);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test the uniforms and blocks found in the source of two stages.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testParseUniforms(void) {
+        const char *vsSrc = "#version 150\r\n"
+                            "in vec4 vertexPos;\r\n"
+                            "uniform mat4 mvpMatrix;\r\n"
+                            "uniform vec3 u_lightPositionArr[8];\r\n"
+                            "layout(std140) uniform AdsFrame\r\n"
+                            "{\r\n"
+                            "\tvec4 u_globalAmbient;\r\n"
+                            "};\r\n"
+                            "uniform float a;uniform float b;\r\n"
+                            "void main(void) { gl_Position = mvpMatrix * vertexPos; }\r\n";
+        const char *fsSrc = "#version 150\n"
+                            "uniform mat4 mvpMatrix;\n"
+                            "uniform AdsMaterial {\n"
+                            "    vec4 u_materialD;\n"
+                            "};\n"
+                            "uniform sampler2D texture0;\n";
+
+        ShaderUniformTable table;
+        TS_ASSERT(GameHalloran::ParseShaderUniforms(vsSrc, table));
+        TS_ASSERT(GameHalloran::ParseShaderUniforms(fsSrc, table));
+
+        TS_ASSERT_EQUALS(table.m_uniforms.size(), 5u);
+        TS_ASSERT_EQUALS(table.m_uniforms[0].first, std::string("mvpMatrix"));
+        TS_ASSERT_EQUALS(table.m_uniforms[1].first, std::string("u_lightPositionArr"));
+        TS_ASSERT_EQUALS(table.m_uniforms[2].first, std::string("a"));
+        TS_ASSERT_EQUALS(table.m_uniforms[3].first, std::string("b"));
+        TS_ASSERT_EQUALS(table.m_uniforms[4].first, std::string("texture0"));
+        TS_ASSERT_EQUALS(table.m_uniforms[0].second, -1);
+
+        TS_ASSERT_EQUALS(table.m_blocks.size(), 2u);
+        TS_ASSERT_EQUALS(table.m_blocks[0].first, std::string("AdsFrame"));
+        TS_ASSERT_EQUALS(table.m_blocks[1].first, std::string("AdsMaterial"));
+        TS_ASSERT_EQUALS(table.m_blocks[0].second, GLuint(GL_INVALID_INDEX));
+
+        // Declarations the parser does not understand fail the parse.
+        TS_ASSERT(!GameHalloran::ParseShaderUniforms("uniform vec3 a, b;\n", table));
+        TS_ASSERT(!GameHalloran::ParseShaderUniforms(NULL, table));
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test everything a program is built from changes its hash.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testSourceHash(void) {
+        std::vector<std::string> attList;
+        attList.push_back("vertexPos");
+        attList.push_back("vertexNormal");
+
+        const U64 hash = GameHalloran::HashShaderProgramSource("vs", NULL, "fs", attList);
+        TS_ASSERT_EQUALS(GameHalloran::HashShaderProgramSource("vs", NULL, "fs", attList), hash);
+        TS_ASSERT_DIFFERS(GameHalloran::HashShaderProgramSource("vs ", NULL, "fs", attList), hash);
+        TS_ASSERT_DIFFERS(GameHalloran::HashShaderProgramSource("vs", NULL, "fs2", attList), hash);
+        TS_ASSERT_DIFFERS(GameHalloran::HashShaderProgramSource("vs", "", "fs", attList), hash);
+        TS_ASSERT_DIFFERS(GameHalloran::HashShaderProgramSource("v", NULL, "sfs", attList), hash);
+
+        std::vector<std::string> swapped;
+        swapped.push_back("vertexNormal");
+        swapped.push_back("vertexPos");
+        TS_ASSERT_DIFFERS(GameHalloran::HashShaderProgramSource("vs", NULL, "fs", swapped), hash);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test entries survive encoding and damaged entries are rejected.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testEncodeDecode(void) {
+        const ShaderProgramBinary binary(CreateBinary(0x0123456789ABCDEFULL));
+        std::vector<U8> data;
+        GameHalloran::EncodeShaderProgramBinary(binary, data);
+
+        ShaderProgramBinary decoded;
+        TS_ASSERT(GameHalloran::DecodeShaderProgramBinary(&data[0], data.size(), decoded));
+        TS_ASSERT_EQUALS(decoded.m_sourceHash, binary.m_sourceHash);
+        TS_ASSERT_EQUALS(decoded.m_driverStr, binary.m_driverStr);
+        TS_ASSERT_EQUALS(decoded.m_format, binary.m_format);
+        TS_ASSERT_EQUALS(decoded.m_buildSeconds, binary.m_buildSeconds);
+        TS_ASSERT(decoded.m_binary == binary.m_binary);
+        TS_ASSERT(decoded.m_uniformTable.m_uniforms == binary.m_uniformTable.m_uniforms);
+        TS_ASSERT(decoded.m_uniformTable.m_blocks == binary.m_uniformTable.m_blocks);
+
+        // Every truncation and any trailing data is rejected.
+        for(size_t length = 0; length < data.size(); ++length) {
+            TS_ASSERT(!GameHalloran::DecodeShaderProgramBinary(&data[0], length, decoded));
+        }
+        std::vector<U8> longer(data);
+        longer.push_back(0);
+        TS_ASSERT(!GameHalloran::DecodeShaderProgramBinary(&longer[0], longer.size(), decoded));
+
+        std::vector<U8> badMagic(data);
+        badMagic[0] = 'X';
+        TS_ASSERT(!GameHalloran::DecodeShaderProgramBinary(&badMagic[0], badMagic.size(), decoded));
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test entries are stored per driver and stale or corrupt entries
+    // are not loaded.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testStoreAndLoad(void) {
+        const U64 sourceHash = 42;
+        ShaderProgramCache cache(m_cacheDir, "Vendor | Renderer | 4.1");
+        TS_ASSERT(cache.IsValid());
+
+        ShaderProgramBinary loaded;
+        TS_ASSERT(!cache.Load(sourceHash, loaded));
+
+        ShaderProgramBinary binary(CreateBinary(sourceHash));
+        binary.m_driverStr.clear();
+        TS_ASSERT(cache.Store(binary));
+        TS_ASSERT_EQUALS(binary.m_driverStr, cache.GetDriver());
+        TS_ASSERT(boost::filesystem::exists(cache.GetEntryPath(sourceHash)));
+        TS_ASSERT(cache.Load(sourceHash, loaded));
+        TS_ASSERT(loaded.m_binary == binary.m_binary);
+        TS_ASSERT(loaded.m_uniformTable.m_uniforms == binary.m_uniformTable.m_uniforms);
+        TS_ASSERT(!cache.Load(sourceHash + 1, loaded));
+
+        // A new driver does not see the entries of the old one.
+        ShaderProgramCache updated(m_cacheDir, "Vendor | Renderer | 4.2");
+        TS_ASSERT_DIFFERS(updated.GetEntryPath(sourceHash), cache.GetEntryPath(sourceHash));
+        TS_ASSERT(!updated.Load(sourceHash, loaded));
+
+        // A corrupt entry is rejected.
+        {
+            std::ofstream out(cache.GetEntryPath(sourceHash).string().c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+            out << "not a program binary";
+        }
+        TS_ASSERT(!cache.Load(sourceHash, loaded));
+        TS_ASSERT_EQUALS(cache.GetStats().m_rejected, 1u);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test the startup time saved is the build time of the programs
+    // loaded less the time taken to load them.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testStats(void) {
+        ShaderProgramCache cache(m_cacheDir, "Driver");
+        cache.RecordMiss(0.5);
+        cache.RecordHit(0.01, 0.25);
+        cache.RecordHit(0.02, 0.5);
+
+        TS_ASSERT_EQUALS(cache.GetStats().m_hits, 2u);
+        TS_ASSERT_EQUALS(cache.GetStats().m_misses, 1u);
+        TS_ASSERT_DELTA(cache.GetStats().m_hitSeconds, 0.03, 1e-9);
+        TS_ASSERT_DELTA(cache.GetStats().m_missSeconds, 0.5, 1e-9);
+        TS_ASSERT_DELTA(cache.GetStats().m_savedSeconds, 0.72, 1e-9);
+        TS_ASSERT_EQUALS(cache.GetStatsReport(), std::string("Shader programs: 2 loaded from the cache in 30.0 ms, saving 720.0 ms; " \
+                         "1 built from source in 500.0 ms; 0 cache entries rejected"));
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test a program built from source stores its binary, the next
+    // build of the same source loads the binary instead of compiling
+    // and a binary the driver refuses is rebuilt from source and
+    // replaced.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testProgramBinary(void) {
+#ifdef GF_GL_RECORDING
+        const char *vsSrc = "#version 150\n"
+                            "in vec4 vertexPos;\n"
+                            "uniform mat4 mvpMatrix;\n"
+                            "void main(void) { gl_Position = mvpMatrix * vertexPos; }\n";
+        const char *fsSrc = "#version 150\n"
+                            "uniform vec4 color;\n"
+                            "out vec4 fragColor;\n"
+                            "void main(void) { fragColor = color; }\n";
+        const std::string recorderBinary("GLRecorder program binary", 26);
+        GameHalloran::VSAttributeNameList attList;
+        attList.push_back("vertexPos");
+        const U64 sourceHash = GameHalloran::HashShaderProgramSource(vsSrc, NULL, fsSrc, attList);
+
+        GameHalloran::GLRecorder &recorder = GameHalloran::GLRecorder::GetGlobalInstance();
+        recorder.Reset();
+        recorder.SetCallLogEnabled(true);
+        boost::shared_ptr<ShaderProgramCache> cachePtr(new ShaderProgramCache(m_cacheDir, "GLRecorder"));
+        U32 compiles = 0, binaries = 0;
+
+        // The first build compiles the source and stores the driver's binary with the uniform table.
+        TS_ASSERT(BuildProgram(cachePtr, vsSrc, fsSrc, attList, compiles, binaries));
+        TS_ASSERT_EQUALS(compiles, 2u);
+        TS_ASSERT_EQUALS(binaries, 0u);
+        TS_ASSERT_EQUALS(cachePtr->GetStats().m_misses, 1u);
+        ShaderProgramBinary stored;
+        TS_ASSERT(cachePtr->Load(sourceHash, stored));
+        TS_ASSERT_EQUALS(stored.m_format, GLenum(0x6766));
+        TS_ASSERT_EQUALS(std::string(stored.m_binary.begin(), stored.m_binary.end()), recorderBinary);
+        TS_ASSERT_EQUALS(stored.m_uniformTable.m_uniforms.size(), 2u);
+
+        // The next build loads the binary without compiling.
+        TS_ASSERT(BuildProgram(cachePtr, vsSrc, fsSrc, attList, compiles, binaries));
+        TS_ASSERT_EQUALS(compiles, 0u);
+        TS_ASSERT_EQUALS(binaries, 1u);
+        TS_ASSERT_EQUALS(cachePtr->GetStats().m_hits, 1u);
+        TS_ASSERT_EQUALS(cachePtr->GetStats().m_misses, 1u);
+
+        // A binary the driver refuses, as after a driver update, is rebuilt from source and replaced.
+        stored.m_binary.assign(20, U8(0xAB));
+        TS_ASSERT(cachePtr->Store(stored));
+        TS_ASSERT(BuildProgram(cachePtr, vsSrc, fsSrc, attList, compiles, binaries));
+        TS_ASSERT_EQUALS(compiles, 2u);
+        TS_ASSERT_EQUALS(binaries, 1u);
+        TS_ASSERT_EQUALS(cachePtr->GetStats().m_rejected, 1u);
+        TS_ASSERT_EQUALS(cachePtr->GetStats().m_misses, 2u);
+        TS_ASSERT(cachePtr->Load(sourceHash, stored));
+        TS_ASSERT_EQUALS(std::string(stored.m_binary.begin(), stored.m_binary.end()), recorderBinary);
+
+        // Every program created was deleted, including the refused one.
+        TS_ASSERT_EQUALS(recorder.GetNumberObjects(), 0u);
+        recorder.SetCallLogEnabled(false);
+        recorder.Reset();
+#endif
+    };
+};
+
+#endif
@@ -0,0 +1,242 @@
+#pragma once
+#ifndef __SIZE_CLASS_POOL_ALLOCATER_TEST_SUITE_H
+#define __SIZE_CLASS_POOL_ALLOCATER_TEST_SUITE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file SizeClassPoolAllocaterTestSuite.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the header for the SizeClassPoolAllocater Test Suite.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include "SizeClassPoolAllocater.h"
+#include "PoolAllocater.h"
+#include "DefaultAllocater.h"
+
+// /////////////////////////////////////////////////////////////////
+// @class SizeClassPoolAllocaterTestSuite
+// @author PJ O Halloran
+//
+// This class defines a series of unit tests for the
+// SizeClassPoolAllocater and PoolAllocater classes.
+//
+// /////////////////////////////////////////////////////////////////
+class SizeClassPoolAllocaterTestSuite : public CxxTest::TestSuite {
+private:
+
+    typedef GameHalloran::SizeClassPoolAllocater SizeClassPool;
+    typedef GameHalloran::U32 U32;
+    typedef GameHalloran::U64 U64;
+
+    static const U32 TEST_ALLOCATER_ID = 7;                     ///< ID given to the allocaters under test.
+
+public:
+
+    // /////////////////////////////////////////////////////////////////
+    // Constructor.
+    //
+    // /////////////////////////////////////////////////////////////////
+    SizeClassPoolAllocaterTestSuite() : CxxTest::TestSuite() {
+
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Destructor.
+    //
+    // /////////////////////////////////////////////////////////////////
+    ~SizeClassPoolAllocaterTestSuite() {
+
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testPoolAllocater(void) {
+        GameHalloran::PoolAllocater invalidObj(0);
+        TS_ASSERT(!invalidObj.IsValid());
+        TS_ASSERT(invalidObj.VAlloc(1) == NULL);
+
+        GameHalloran::PoolAllocater poolObj(20, 4);
+        TS_ASSERT(poolObj.IsValid());
+        TS_ASSERT(poolObj.GetBlockSize() >= 20);
+        TS_ASSERT_EQUALS(poolObj.GetNumberChunks(), 0);
+        TS_ASSERT(poolObj.VAlloc(poolObj.GetBlockSize() + 1) == NULL);
+
+        std::vector<void *> blocks;
+        for(U32 i = 0; i < 10; ++i) {
+            void *blockPtr = poolObj.VAlloc(20);
+            TS_ASSERT(blockPtr != NULL);
+            memset(blockPtr, int(i), 20);
+            blocks.push_back(blockPtr);
+        }
+        TS_ASSERT_EQUALS(poolObj.GetNumberBlocksAllocated(), 10);
+        TS_ASSERT_EQUALS(poolObj.GetNumberChunks(), 3);
+
+        // The last freed block is the next one handed out.
+        poolObj.VDealloc(blocks[3]);
+        TS_ASSERT_EQUALS(poolObj.GetNumberBlocksAllocated(), 9);
+        TS_ASSERT_EQUALS(poolObj.VAlloc(8), blocks[3]);
+
+        for(std::vector<void *>::iterator i = blocks.begin(), end = blocks.end(); i != end; ++i) {
+            poolObj.VDealloc(*i);
+        }
+        TS_ASSERT_EQUALS(poolObj.GetNumberBlocksAllocated(), 0);
+        TS_ASSERT_EQUALS(poolObj.GetNumberChunks(), 3);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testConstructor(void) {
+        SizeClassPool poolObj(TEST_ALLOCATER_ID);
+        TS_ASSERT_EQUALS(poolObj.GetId(), U32(TEST_ALLOCATER_ID));
+        TS_ASSERT(!poolObj.IsThreadSafe());
+        TS_ASSERT_EQUALS(poolObj.GetNumberLargeBlocksAllocated(), 0);
+        for(U32 i = 0; i < SizeClassPool::NUMBER_SIZE_CLASSES; ++i) {
+            TS_ASSERT_EQUALS(poolObj.GetNumberBlocksAllocated(i), 0);
+        }
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testAllocAndDealloc(void) {
+        SizeClassPool poolObj(TEST_ALLOCATER_ID, 8);
+
+        void *smallPtr = poolObj.VAlloc(1);
+        void *mediumPtr = poolObj.VAlloc(100);
+        void *largePtr = poolObj.VAlloc(SizeClassPool::MAX_SMALL_BLOCK_SIZE + 1);
+        TS_ASSERT(smallPtr != NULL);
+        TS_ASSERT(mediumPtr != NULL);
+        TS_ASSERT(largePtr != NULL);
+        TS_ASSERT_EQUALS(poolObj.GetNumberBlocksAllocated(0), 1);
+        TS_ASSERT_EQUALS(poolObj.GetNumberLargeBlocksAllocated(), 1);
+
+        // Pooled blocks are 16 byte aligned.
+        TS_ASSERT_EQUALS(reinterpret_cast<size_t>(smallPtr) % 16, 0);
+        TS_ASSERT_EQUALS(reinterpret_cast<size_t>(mediumPtr) % 16, 0);
+
+        memset(smallPtr, 0xAB, 1);
+        memset(mediumPtr, 0xAB, 100);
+        memset(largePtr, 0xAB, SizeClassPool::MAX_SMALL_BLOCK_SIZE + 1);
+
+        poolObj.VDealloc(smallPtr);
+        poolObj.VDealloc(mediumPtr);
+        poolObj.VDealloc(largePtr);
+        poolObj.VDealloc(NULL);
+        TS_ASSERT_EQUALS(poolObj.GetNumberLargeBlocksAllocated(), 0);
+        for(U32 i = 0; i < SizeClassPool::NUMBER_SIZE_CLASSES; ++i) {
+            TS_ASSERT_EQUALS(poolObj.GetNumberBlocksAllocated(i), 0);
+        }
+
+        // Freed blocks are reused by the same size class.
+        TS_ASSERT_EQUALS(poolObj.VAlloc(2), smallPtr);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testAllocAligned(void) {
+        GameHalloran::PoolAllocater alignedPoolObj(20, 4, 64);
+        TS_ASSERT(alignedPoolObj.IsValid());
+        TS_ASSERT_EQUALS(alignedPoolObj.GetAlignment(), 64);
+        TS_ASSERT_EQUALS(alignedPoolObj.GetBlockSize(), 64);
+        TS_ASSERT(!GameHalloran::PoolAllocater(20, 4, 3).IsValid());
+        TS_ASSERT(alignedPoolObj.VAllocAligned(20, 128) == NULL);
+
+        GameHalloran::DefaultAllocater defaultObj;
+        SizeClassPool poolObj(TEST_ALLOCATER_ID, 8);
+        TS_ASSERT(poolObj.VAllocAligned(10, 3) == NULL);
+        TS_ASSERT(defaultObj.VAllocAligned(10, 3) == NULL);
+
+        std::vector<void *> blocks;
+        std::vector<void *> poolBlocks;
+        for(U32 alignment = 4; alignment <= 4096; alignment <<= 1) {
+            for(U32 i = 0; i < 6; ++i) {
+                void *blockPtr = alignedPoolObj.VAllocAligned(20, alignment);
+                if(alignment <= 64) {
+                    TS_ASSERT(blockPtr != NULL);
+                    TS_ASSERT_EQUALS(reinterpret_cast<size_t>(blockPtr) % alignment, 0);
+                    blocks.push_back(blockPtr);
+                } else {
+                    TS_ASSERT(blockPtr == NULL);
+                }
+            }
+
+            // Small and large requests.
+            const U64 sizes[] = { 1, 40, SizeClassPool::MAX_SMALL_BLOCK_SIZE * 2 };
+            for(U32 i = 0; i < 3; ++i) {
+                void *blockPtr = poolObj.VAllocAligned(sizes[i], alignment);
+                TS_ASSERT(blockPtr != NULL);
+                TS_ASSERT_EQUALS(reinterpret_cast<size_t>(blockPtr) % alignment, 0);
+                memset(blockPtr, 0xAB, size_t(sizes[i]));
+                poolBlocks.push_back(blockPtr);
+
+                blockPtr = defaultObj.VAllocAligned(sizes[i], alignment);
+                TS_ASSERT(blockPtr != NULL);
+                TS_ASSERT_EQUALS(reinterpret_cast<size_t>(blockPtr) % alignment, 0);
+                memset(blockPtr, 0xAB, size_t(sizes[i]));
+                defaultObj.VDealloc(blockPtr);
+            }
+        }
+
+        for(std::vector<void *>::iterator i = blocks.begin(), end = blocks.end(); i != end; ++i) {
+            alignedPoolObj.VDealloc(*i);
+        }
+        TS_ASSERT_EQUALS(alignedPoolObj.GetNumberBlocksAllocated(), 0);
+
+        for(std::vector<void *>::iterator i = poolBlocks.begin(), end = poolBlocks.end(); i != end; ++i) {
+            poolObj.VDealloc(*i);
+        }
+        TS_ASSERT_EQUALS(poolObj.GetNumberLargeBlocksAllocated(), 0);
+        for(U32 i = 0; i < SizeClassPool::NUMBER_SIZE_CLASSES; ++i) {
+            TS_ASSERT_EQUALS(poolObj.GetNumberBlocksAllocated(i), 0);
+        }
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testSmallObjectChurn(void) {
+        SizeClassPool poolObj(TEST_ALLOCATER_ID, 16);
+        std::vector<void *> blocks;
+
+        for(U32 round = 0; round < 10; ++round) {
+            for(U32 i = 0; i < 100; ++i) {
+                const U64 size = 1 + ((i * 37 + round) % SizeClassPool::MAX_SMALL_BLOCK_SIZE);
+                void *blockPtr = poolObj.VAlloc(size);
+                TS_ASSERT(blockPtr != NULL);
+                memset(blockPtr, int(round), size_t(size));
+                blocks.push_back(blockPtr);
+            }
+
+            // Free every other block.
+            std::vector<void *> kept;
+            for(U32 i = 0; i < blocks.size(); ++i) {
+                if(i % 2) {
+                    poolObj.VDealloc(blocks[i]);
+                } else {
+                    kept.push_back(blocks[i]);
+                }
+            }
+            blocks.swap(kept);
+        }
+
+        for(std::vector<void *>::iterator i = blocks.begin(), end = blocks.end(); i != end; ++i) {
+            poolObj.VDealloc(*i);
+        }
+        for(U32 i = 0; i < SizeClassPool::NUMBER_SIZE_CLASSES; ++i) {
+            TS_ASSERT_EQUALS(poolObj.GetNumberBlocksAllocated(i), 0);
+        }
+    };
+
+};
+
+#endif
@@ -11,10 +11,13 @@
 //
 // /////////////////////////////////////////////////////////////////
 
+#include <cstring>
+
 #include <cxxtest/TestSuite.h>
 #include <boost/scoped_ptr.hpp>
 
 #include "StackAllocater.h"
+#include "DoubleBufferedStackAllocater.h"
 
 // /////////////////////////////////////////////////////////////////
 // @class StackAllocaterTestSuite
@@ -94,7 +97,7 @@ public:
         TS_ASSERT_EQUALS(obj.GetEndMarker(), s);
         TS_ASSERT_EQUALS(obj.GetMarker(), 0);
 
-        void *blockA = obj.Alloc(10);
+        void *blockA = obj.VAlloc(10);
         TS_ASSERT(blockA != NULL);
         TS_ASSERT_EQUALS(obj.GetMarker(), 10 + m_padding);
         TS_ASSERT_EQUALS(obj.GetEndMarker(), s);
@@ -162,6 +165,93 @@ public:
 
     };
 
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void testAllocAligned(void) {
+        GameHalloran::StackAllocater obj(64 * 1024);
+        TS_ASSERT(obj.VAllocAligned(10, 0) == NULL);
+        TS_ASSERT(obj.VAllocAligned(10, 3) == NULL);
+        TS_ASSERT_EQUALS(obj.GetMarker(), 0);
+
+        for(GameHalloran::U32 alignment = 4; alignment <= 4096; alignment <<= 1) {
+            // Leave the top of the stack misaligned.
+            TS_ASSERT(obj.VAlloc(1) != NULL);
+            const GameHalloran::StackAllocater::Marker marker = obj.GetMarker();
+
+            void *blockPtr = obj.VAllocAligned(10, alignment);
+            TS_ASSERT(blockPtr != NULL);
+            TS_ASSERT_EQUALS(reinterpret_cast<size_t>(blockPtr) % alignment, 0);
+            TS_ASSERT(obj.GetMarker() >= marker + 10 + m_padding);
+            memset(blockPtr, 0xAB, 10);
+
+            // Freeing to the marker also releases the padding.
+            obj.FreeToMarker(marker);
+            TS_ASSERT_EQUALS(obj.GetMarker(), marker);
+            TS_ASSERT_EQUALS(obj.GetAvailableMemory(), obj.GetEndMarker() - marker);
+            obj.Clear();
+        }
+
+        // A failed allocation leaves the stack unchanged.
+        GameHalloran::StackAllocater smallObj(64);
+        TS_ASSERT(smallObj.VAlloc(1) != NULL);
+        const GameHalloran::StackAllocater::Marker marker = smallObj.GetMarker();
+        TS_ASSERT(smallObj.VAllocAligned(60, 4096) == NULL);
+        TS_ASSERT_EQUALS(smallObj.GetMarker(), marker);
+        TS_ASSERT_EQUALS(smallObj.GetEndMarker(), 64);
+    };
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void testAllocEndAligned(void) {
+        GameHalloran::StackAllocater obj(64 * 1024);
+        TS_ASSERT(obj.AllocEndAligned(10, 3) == NULL);
+        TS_ASSERT_EQUALS(obj.GetEndMarker(), 64 * 1024);
+
+        for(GameHalloran::U32 alignment = 4; alignment <= 4096; alignment <<= 1) {
+            TS_ASSERT(obj.AllocEnd(1) != NULL);
+            const GameHalloran::StackAllocater::Marker marker = obj.GetEndMarker();
+
+            void *blockPtr = obj.AllocEndAligned(10, alignment);
+            TS_ASSERT(blockPtr != NULL);
+            TS_ASSERT_EQUALS(reinterpret_cast<size_t>(blockPtr) % alignment, 0);
+            TS_ASSERT(obj.GetEndMarker() + 10 + m_padding <= marker);
+            memset(blockPtr, 0xAB, 10);
+
+            obj.FreeToMarker(marker);
+            TS_ASSERT_EQUALS(obj.GetEndMarker(), marker);
+            obj.Clear();
+        }
+
+        GameHalloran::StackAllocater smallObj(64);
+        TS_ASSERT(smallObj.AllocEnd(1) != NULL);
+        const GameHalloran::StackAllocater::Marker marker = smallObj.GetEndMarker();
+        TS_ASSERT(smallObj.AllocEndAligned(60, 4096) == NULL);
+        TS_ASSERT_EQUALS(smallObj.GetEndMarker(), marker);
+        TS_ASSERT_EQUALS(smallObj.GetMarker(), 0);
+    };
+
+    // ////////////////////////////////////////////////////////////
+    //
+    // ////////////////////////////////////////////////////////////
+    void testDoubleBufferedAllocAligned(void) {
+        GameHalloran::DoubleBufferedStackAllocater obj(16 * 1024);
+        TS_ASSERT(obj.IsValid());
+
+        for(GameHalloran::U32 alignment = 4; alignment <= 4096; alignment <<= 1) {
+            TS_ASSERT(obj.VAlloc(1) != NULL);
+            void *blockPtr = obj.VAllocAligned(10, alignment);
+            TS_ASSERT(blockPtr != NULL);
+            TS_ASSERT_EQUALS(reinterpret_cast<size_t>(blockPtr) % alignment, 0);
+
+            // Each buffer is allocated from in turn.
+            obj.SwapBuffers();
+            obj.ClearCurrentBuffer();
+            TS_ASSERT_EQUALS(obj.GetCurrentBufferMarker(), 0);
+        }
+    };
+
     // ////////////////////////////////////////////////////////////
     //
     // ////////////////////////////////////////////////////////////
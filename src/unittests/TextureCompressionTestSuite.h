@@ -0,0 +1,185 @@
+#pragma once
+#ifndef __TEXTURE_COMPRESSION_TEST_SUITE_H
+#define __TEXTURE_COMPRESSION_TEST_SUITE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file TextureCompressionTestSuite.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the header for the TextureCompression Test Suite.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <cstring>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include "TextureCompression.h"
+
+// /////////////////////////////////////////////////////////////////
+// @class TextureCompressionTestSuite
+// @author PJ O Halloran
+//
+// This class defines a series of unit tests for the CPU block
+// compression encoder and decoder and the BCT container.
+//
+// /////////////////////////////////////////////////////////////////
+class TextureCompressionTestSuite : public CxxTest::TestSuite {
+private:
+
+    typedef GameHalloran::U8 U8;
+    typedef GameHalloran::U32 U32;
+    typedef GameHalloran::F64 F64;
+    typedef GameHalloran::BlockFormat BlockFormat;
+    typedef std::vector<U8> ByteVector;
+
+    // /////////////////////////////////////////////////////////////////
+    // Create a smooth RGBA test image: gradients in red, green and
+    // alpha and a slow wave in blue.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static ByteVector CreateImage(const U32 width, const U32 height) {
+        ByteVector rgba(width * height * 4);
+        for(U32 y = 0; y < height; ++y) {
+            for(U32 x = 0; x < width; ++x) {
+                U8 *texelPtr = &rgba[(y * width + x) * 4];
+                texelPtr[0] = U8((x * 255) / (width > 1 ? width - 1 : 1));
+                texelPtr[1] = U8((y * 255) / (height > 1 ? height - 1 : 1));
+                texelPtr[2] = U8(128 + ((x + y) % 32) * 2);
+                texelPtr[3] = U8(255 - (x * 255) / (width > 1 ? width - 1 : 1) / 2);
+            }
+        }
+        return (rgba);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Compress and decompress an image, returning the PSNR over the
+    // channels the format keeps.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static F64 RoundTrip(const ByteVector &rgba, const U32 width, const U32 height, const BlockFormat format, ByteVector &decodedRef) {
+        ByteVector blocks(GameHalloran::GetCompressedImageSize(format, width, height));
+        GameHalloran::CompressImage(&rgba[0], width, height, format, &blocks[0]);
+        decodedRef.assign(width * height * 4, 0);
+        GameHalloran::DecompressImage(&blocks[0], width, height, format, &decodedRef[0]);
+        return (GameHalloran::ComputePsnr(&rgba[0], &decodedRef[0], width * height, GameHalloran::GetBlockFormatChannels(format)));
+    };
+
+public:
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testSizes(void) {
+        TS_ASSERT_EQUALS(GameHalloran::GetCompressedImageSize(GameHalloran::BLOCK_FORMAT_BC1, 16, 8), U32(8 * 8));
+        TS_ASSERT_EQUALS(GameHalloran::GetCompressedImageSize(GameHalloran::BLOCK_FORMAT_BC3, 16, 8), U32(8 * 16));
+        TS_ASSERT_EQUALS(GameHalloran::GetCompressedImageSize(GameHalloran::BLOCK_FORMAT_BC5, 5, 1), U32(2 * 16));
+        TS_ASSERT_EQUALS(GameHalloran::GetCompressedImageSize(GameHalloran::BLOCK_FORMAT_BC1, 1, 1), U32(8));
+        TS_ASSERT_EQUALS(GameHalloran::GetNumberMipLevels(1, 1), U32(1));
+        TS_ASSERT_EQUALS(GameHalloran::GetNumberMipLevels(256, 64), U32(9));
+        TS_ASSERT_EQUALS(GameHalloran::GetNumberMipLevels(5, 3), U32(3));
+        TS_ASSERT_EQUALS(GameHalloran::FindBlockFormatFromString("BC5"), GameHalloran::BLOCK_FORMAT_BC5);
+        TS_ASSERT_EQUALS(GameHalloran::FindBlockFormatFromString("dxt1"), GameHalloran::BLOCK_FORMAT_UNKNOWN);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testSolidBlocksAreExact(void) {
+        // A 5:6:5 representable colour and any alpha survive exactly.
+        ByteVector rgba(8 * 8 * 4);
+        for(U32 t = 0; t < 8 * 8; ++t) {
+            rgba[t * 4 + 0] = 255;
+            rgba[t * 4 + 1] = 130;
+            rgba[t * 4 + 2] = 0;
+            rgba[t * 4 + 3] = 77;
+        }
+        ByteVector decoded;
+        TS_ASSERT_EQUALS(RoundTrip(rgba, 8, 8, GameHalloran::BLOCK_FORMAT_BC3, decoded), 999.0);
+        TS_ASSERT_EQUALS(RoundTrip(rgba, 8, 8, GameHalloran::BLOCK_FORMAT_BC5, decoded), 999.0);
+        TS_ASSERT_EQUALS(RoundTrip(rgba, 8, 8, GameHalloran::BLOCK_FORMAT_BC1, decoded), 999.0);
+        TS_ASSERT_EQUALS(decoded[3], 255);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testRoundTripPsnr(void) {
+        const U32 width = 64, height = 48;
+        ByteVector rgba = CreateImage(width, height);
+        ByteVector decoded;
+
+        TS_ASSERT_LESS_THAN(35.0, RoundTrip(rgba, width, height, GameHalloran::BLOCK_FORMAT_BC1, decoded));
+        TS_ASSERT_LESS_THAN(35.0, RoundTrip(rgba, width, height, GameHalloran::BLOCK_FORMAT_BC3, decoded));
+        TS_ASSERT_LESS_THAN(40.0, GameHalloran::ComputePsnr(&rgba[3], &decoded[3], width * height, 1));
+        TS_ASSERT_LESS_THAN(40.0, RoundTrip(rgba, width, height, GameHalloran::BLOCK_FORMAT_BC5, decoded));
+        TS_ASSERT_EQUALS(decoded[2], 0);
+        TS_ASSERT_EQUALS(decoded[3], 255);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testPartialBlocks(void) {
+        const U32 width = 5, height = 3;
+        ByteVector rgba = CreateImage(width, height);
+        ByteVector decoded;
+
+        TS_ASSERT_LESS_THAN(30.0, RoundTrip(rgba, width, height, GameHalloran::BLOCK_FORMAT_BC5, decoded));
+        TS_ASSERT_EQUALS(decoded.size(), size_t(width * height * 4));
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testDownsample(void) {
+        const U8 rgba[] = { 0, 0, 0, 0, 4, 8, 12, 16, 100, 0, 0, 0,
+                            8, 8, 8, 8, 12, 16, 20, 24, 200, 0, 0, 0
+                          };
+        ByteVector half;
+        GameHalloran::DownsampleImage(rgba, 3, 2, half);
+        TS_ASSERT_EQUALS(half.size(), size_t(4));
+        TS_ASSERT_EQUALS(half[0], 6);
+        TS_ASSERT_EQUALS(half[3], 12);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testContainer(void) {
+        const U32 width = 32, height = 16;
+        ByteVector rgba = CreateImage(width, height);
+        ByteVector bct;
+        GameHalloran::EncodeCompressedTexture(&rgba[0], width, height, GameHalloran::BLOCK_FORMAT_BC1, true, bct);
+
+        GameHalloran::CompressedTextureHeader header;
+        TS_ASSERT(GameHalloran::ParseCompressedTextureHeader(&bct[0], bct.size(), header));
+        TS_ASSERT_EQUALS(header.m_format, GameHalloran::BLOCK_FORMAT_BC1);
+        TS_ASSERT_EQUALS(header.m_width, width);
+        TS_ASSERT_EQUALS(header.m_height, height);
+        TS_ASSERT_EQUALS(header.m_numberMipLevels, U32(6));
+        // 8x4 + 4x2 + 2x1 + 1x1 + 1x1 + 1x1 blocks.
+        TS_ASSERT_EQUALS(GameHalloran::GetCompressedTextureDataSize(header), U32((32 + 8 + 2 + 1 + 1 + 1) * 8));
+        TS_ASSERT_EQUALS(bct.size(), size_t(GameHalloran::COMPRESSED_TEXTURE_HEADER_SIZE + GameHalloran::GetCompressedTextureDataSize(header)));
+
+        // The top level matches compressing the image directly.
+        ByteVector blocks(GameHalloran::GetCompressedImageSize(GameHalloran::BLOCK_FORMAT_BC1, width, height));
+        GameHalloran::CompressImage(&rgba[0], width, height, GameHalloran::BLOCK_FORMAT_BC1, &blocks[0]);
+        TS_ASSERT_EQUALS(memcmp(&bct[GameHalloran::COMPRESSED_TEXTURE_HEADER_SIZE], &blocks[0], blocks.size()), 0);
+
+        ByteVector single;
+        GameHalloran::EncodeCompressedTexture(&rgba[0], width, height, GameHalloran::BLOCK_FORMAT_BC5, false, single);
+        TS_ASSERT(GameHalloran::ParseCompressedTextureHeader(&single[0], single.size(), header));
+        TS_ASSERT_EQUALS(header.m_numberMipLevels, U32(1));
+
+        // Truncated and corrupt files are rejected.
+        TS_ASSERT(!GameHalloran::ParseCompressedTextureHeader(&bct[0], bct.size() - 1, header));
+        TS_ASSERT(!GameHalloran::ParseCompressedTextureHeader(&bct[0], 10, header));
+        bct[0] = 'X';
+        TS_ASSERT(!GameHalloran::ParseCompressedTextureHeader(&bct[0], bct.size(), header));
+    };
+};
+
+#endif
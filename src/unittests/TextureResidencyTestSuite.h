@@ -0,0 +1,241 @@
+#pragma once
+#ifndef __TEXTURE_RESIDENCY_TEST_SUITE_H
+#define __TEXTURE_RESIDENCY_TEST_SUITE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file TextureResidencyTestSuite.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the header for the TextureResidency Test Suite.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include <cxxtest/TestSuite.h>
+
+#include "TextureResidency.h"
+
+// /////////////////////////////////////////////////////////////////
+// @class TextureResidencyTestSuite
+// @author PJ O Halloran
+//
+// This class defines a series of unit tests for the TextureResidency
+// class, using a backend which only tracks allocations in place of
+// OpenGL.
+//
+// /////////////////////////////////////////////////////////////////
+class TextureResidencyTestSuite : public CxxTest::TestSuite {
+private:
+
+    typedef GameHalloran::TexHandle TexHandle;
+    typedef GameHalloran::U64 U64;
+
+    // /////////////////////////////////////////////////////////////////
+    // @class StubBackend
+    //
+    // Records the bytes allocated to each texture and the order of the
+    // evictions.
+    //
+    // /////////////////////////////////////////////////////////////////
+    class StubBackend : public GameHalloran::ITextureResidencyBackend {
+    public:
+        std::map<TexHandle, U64> m_sizes;           ///< Size of each texture when reloaded.
+        std::set<TexHandle> m_allocated;            ///< Textures with GPU memory.
+        std::vector<TexHandle> m_evicted;           ///< Textures evicted, in order.
+        std::set<TexHandle> m_failReload;           ///< Textures which fail to reload.
+
+        void Allocate(const TexHandle handle, const U64 size) {
+            m_sizes[handle] = size;
+            m_allocated.insert(handle);
+        };
+
+        virtual bool VEvict(const TexHandle handle) {
+            m_evicted.push_back(handle);
+            return (m_allocated.erase(handle) == 1);
+        };
+
+        virtual boost::optional<U64> VReload(const TexHandle handle) {
+            if(m_failReload.count(handle) != 0) {
+                return (boost::optional<U64>());
+            }
+            m_allocated.insert(handle);
+            return (boost::optional<U64>(m_sizes[handle]));
+        };
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Load a texture as the TextureManager does, making room first.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static void Load(GameHalloran::TextureResidency &residencyRef, StubBackend &backendRef, const TexHandle handle, const U64 size, const bool evictable = true) {
+        residencyRef.MakeRoom(size);
+        backendRef.Allocate(handle, size);
+        residencyRef.Add(handle, size, evictable);
+    };
+
+public:
+
+    // /////////////////////////////////////////////////////////////////
+    // Test the least recently used textures are evicted to fit a new
+    // texture in the budget.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testLruEviction(void) {
+        StubBackend backend;
+        GameHalloran::TextureResidency residency(&backend, 300);
+        Load(residency, backend, 0, 100);
+        Load(residency, backend, 1, 100);
+        Load(residency, backend, 2, 100);
+        TS_ASSERT(backend.m_evicted.empty());
+        TS_ASSERT_EQUALS(residency.GetStats().m_residentBytes, 300u);
+
+        // Texture 0 is now the most recently used, so 1 then 2 are evicted.
+        TS_ASSERT(residency.Touch(0));
+        Load(residency, backend, 3, 150);
+        TS_ASSERT_EQUALS(backend.m_evicted.size(), 2u);
+        if(backend.m_evicted.size() == 2) {
+            TS_ASSERT_EQUALS(backend.m_evicted[0], 1);
+            TS_ASSERT_EQUALS(backend.m_evicted[1], 2);
+        }
+        TS_ASSERT(residency.IsResident(0));
+        TS_ASSERT(!residency.IsResident(1));
+        TS_ASSERT(!residency.IsResident(2));
+        TS_ASSERT(residency.IsResident(3));
+        TS_ASSERT_EQUALS(residency.GetStats().m_residentBytes, 250u);
+        TS_ASSERT_EQUALS(residency.GetStats().m_numberResident, 2u);
+        TS_ASSERT_EQUALS(residency.GetStats().m_numberEvicted, 2u);
+        TS_ASSERT_EQUALS(residency.GetStats().m_peakResidentBytes, 300u);
+        TS_ASSERT_EQUALS(backend.m_allocated.size(), 2u);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test an evicted texture is reloaded when used, evicting others to
+    // make room.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testReloadOnTouch(void) {
+        StubBackend backend;
+        GameHalloran::TextureResidency residency(&backend, 200);
+        Load(residency, backend, 0, 100);
+        Load(residency, backend, 1, 100);
+        TS_ASSERT(residency.Evict(0));
+        TS_ASSERT(!residency.Evict(0));
+        TS_ASSERT(!residency.IsResident(0));
+        TS_ASSERT(residency.IsManaged(0));
+
+        Load(residency, backend, 2, 100);
+        TS_ASSERT(residency.Touch(0));
+        TS_ASSERT(residency.IsResident(0));
+        TS_ASSERT_EQUALS(backend.m_allocated.count(0), 1u);
+        TS_ASSERT(!residency.IsResident(1));
+        TS_ASSERT(residency.IsResident(2));
+
+        const GameHalloran::TextureResidencyStats &stats = residency.GetStats();
+        TS_ASSERT_EQUALS(stats.m_hits, 0u);
+        TS_ASSERT_EQUALS(stats.m_misses, 1u);
+        TS_ASSERT_EQUALS(stats.m_reloads, 1u);
+        TS_ASSERT_EQUALS(stats.m_evictions, 2u);
+        TS_ASSERT_EQUALS(stats.m_residentBytes, 200u);
+
+        TS_ASSERT(residency.Touch(0));
+        TS_ASSERT_EQUALS(stats.m_hits, 1u);
+        TS_ASSERT(!residency.Touch(42));
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test textures which cannot be reloaded are counted but never
+    // evicted, even when the budget is exceeded, and that nothing is
+    // evicted for a texture which cannot fit beside them.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testNonEvictable(void) {
+        StubBackend backend;
+        GameHalloran::TextureResidency residency(&backend, 200);
+        Load(residency, backend, 0, 150, false);
+        Load(residency, backend, 1, 50);
+        TS_ASSERT(!residency.Evict(0));
+        TS_ASSERT_EQUALS(residency.GetStats().m_unevictableBytes, 150u);
+
+        TS_ASSERT(!residency.MakeRoom(100));
+        TS_ASSERT(residency.IsResident(0));
+        TS_ASSERT(residency.IsResident(1));
+        TS_ASSERT(backend.m_evicted.empty());
+
+        TS_ASSERT(residency.MakeRoom(50));
+        TS_ASSERT(!residency.IsResident(1));
+        TS_ASSERT_EQUALS(backend.m_evicted.size(), 1u);
+        TS_ASSERT_EQUALS(residency.GetStats().m_residentBytes, 150u);
+
+        // Over the budget with only textures which cannot be evicted.
+        Load(residency, backend, 2, 100, false);
+        TS_ASSERT_EQUALS(residency.GetStats().m_unevictableBytes, 250u);
+        TS_ASSERT_EQUALS(residency.GetStats().m_residentBytes, 250u);
+        residency.Remove(0);
+        TS_ASSERT_EQUALS(residency.GetStats().m_unevictableBytes, 100u);
+        residency.Clear();
+        TS_ASSERT_EQUALS(residency.GetStats().m_unevictableBytes, 0u);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test changing the budget, including to unlimited.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testSetBudget(void) {
+        StubBackend backend;
+        GameHalloran::TextureResidency residency(&backend, 0);
+        for(TexHandle i = 0; i < 4; ++i) {
+            Load(residency, backend, i, 100);
+        }
+        TS_ASSERT(backend.m_evicted.empty());
+        TS_ASSERT_EQUALS(residency.GetStats().m_residentBytes, 400u);
+
+        residency.SetBudget(250);
+        TS_ASSERT_EQUALS(residency.GetBudget(), 250u);
+        TS_ASSERT_EQUALS(residency.GetStats().m_residentBytes, 200u);
+        TS_ASSERT(!residency.IsResident(0));
+        TS_ASSERT(!residency.IsResident(1));
+        TS_ASSERT(residency.IsResident(2));
+        TS_ASSERT(residency.IsResident(3));
+
+        residency.SetBudget(0);
+        TS_ASSERT(residency.MakeRoom(1000));
+        TS_ASSERT_EQUALS(residency.GetStats().m_residentBytes, 200u);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test failed reloads, removing textures and resetting the
+    // counters.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testFailedReloadAndRemove(void) {
+        StubBackend backend;
+        GameHalloran::TextureResidency residency(&backend, 0);
+        Load(residency, backend, 0, 100);
+        Load(residency, backend, 1, 100);
+        TS_ASSERT(residency.Evict(0));
+        backend.m_failReload.insert(0);
+        TS_ASSERT(!residency.Touch(0));
+        TS_ASSERT(!residency.IsResident(0));
+        TS_ASSERT_EQUALS(residency.GetStats().m_failedReloads, 1u);
+        TS_ASSERT_EQUALS(residency.GetStats().m_numberEvicted, 1u);
+
+        residency.Remove(0);
+        residency.Remove(1);
+        TS_ASSERT(!residency.IsManaged(0));
+        TS_ASSERT(!residency.IsManaged(1));
+        TS_ASSERT_EQUALS(residency.GetStats().m_residentBytes, 0u);
+        TS_ASSERT_EQUALS(residency.GetStats().m_numberResident, 0u);
+        TS_ASSERT_EQUALS(residency.GetStats().m_numberEvicted, 0u);
+
+        residency.ResetCounters();
+        TS_ASSERT_EQUALS(residency.GetStats().m_evictions, 0u);
+        TS_ASSERT_EQUALS(residency.GetStats().m_misses, 0u);
+        TS_ASSERT_EQUALS(residency.GetStats().m_peakResidentBytes, 0u);
+    };
+};
+
+#endif
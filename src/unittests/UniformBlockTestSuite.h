@@ -0,0 +1,161 @@
+#pragma once
+#ifndef __UNIFORM_BLOCK_TEST_SUITE_H
+#define __UNIFORM_BLOCK_TEST_SUITE_H
+
+// /////////////////////////////////////////////////////////////////
+// @file UniformBlockTestSuite.h
+// @author PJ O Halloran
+// @date 18/10/2026
+//
+// File contains the header for the UniformBlock Test Suite.
+//
+// /////////////////////////////////////////////////////////////////
+
+#include <cstring>
+
+#include <cxxtest/TestSuite.h>
+
+#include "UniformBlock.h"
+
+#ifdef GF_GL_RECORDING
+#include "GLRecorder.h"
+#endif
+
+// /////////////////////////////////////////////////////////////////
+// @class UniformBlockTestSuite
+// @author PJ O Halloran
+//
+// This class defines a series of unit tests for the std140 packing
+// of the UniformBlock class.  The uploads are only tested when built
+// with the GF_GL_RECORDING backend.
+//
+// /////////////////////////////////////////////////////////////////
+class UniformBlockTestSuite : public CxxTest::TestSuite {
+private:
+
+    typedef GameHalloran::UniformBlock UniformBlock;
+    typedef GameHalloran::U32 U32;
+
+    // /////////////////////////////////////////////////////////////////
+    // Read a float from the packed block.
+    //
+    // /////////////////////////////////////////////////////////////////
+    static GLfloat ReadFloat(const UniformBlock &block, const U32 offset) {
+        GLfloat value(0.0f);
+        memcpy(&value, block.GetData() + offset, sizeof(GLfloat));
+        return (value);
+    };
+
+public:
+
+    // /////////////////////////////////////////////////////////////////
+    // Test the std140 offsets of scalars, vectors, arrays and matrices.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testStd140Layout(void) {
+        UniformBlock block("Layout");
+        const U32 f = block.AddMember("f", UniformBlock::eFloat);
+        const U32 v2 = block.AddMember("v2", UniformBlock::eVec2);
+        const U32 v3 = block.AddMember("v3", UniformBlock::eVec3);
+        const U32 i = block.AddMember("i", UniformBlock::eInt);
+        const U32 fArr = block.AddMember("fArr", UniformBlock::eFloat, 3);
+        const U32 m3 = block.AddMember("m3", UniformBlock::eMat3);
+        const U32 v3Arr = block.AddMember("v3Arr", UniformBlock::eVec3, 2);
+        const U32 m4 = block.AddMember("m4", UniformBlock::eMat4);
+        const U32 last = block.AddMember("last", UniformBlock::eFloat);
+
+        TS_ASSERT_EQUALS(block.GetNumberMembers(), 9u);
+        TS_ASSERT_EQUALS(block.GetOffset(f), 0u);
+        TS_ASSERT_EQUALS(block.GetOffset(v2), 8u);
+        TS_ASSERT_EQUALS(block.GetOffset(v3), 16u);
+        TS_ASSERT_EQUALS(block.GetOffset(i), 28u);
+        TS_ASSERT_EQUALS(block.GetOffset(fArr), 32u);
+        TS_ASSERT_EQUALS(block.GetArrayStride(fArr), 16u);
+        TS_ASSERT_EQUALS(block.GetOffset(m3), 80u);
+        TS_ASSERT_EQUALS(block.GetOffset(v3Arr), 128u);
+        TS_ASSERT_EQUALS(block.GetArrayStride(v3Arr), 16u);
+        TS_ASSERT_EQUALS(block.GetOffset(m4), 160u);
+        TS_ASSERT_EQUALS(block.GetOffset(last), 224u);
+        TS_ASSERT_EQUALS(block.GetSize(), 240u);
+
+        TS_ASSERT(block.FindMember("m3").is_initialized());
+        TS_ASSERT_EQUALS(*block.FindMember("m3"), m3);
+        TS_ASSERT(!block.FindMember("missing").is_initialized());
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test tightly packed arrays and matrices are spread out to the
+    // std140 strides.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testPacking(void) {
+        UniformBlock block("Packing");
+        const U32 v3Arr = block.AddMember("v3Arr", UniformBlock::eVec3, 4);
+        const U32 m3 = block.AddMember("m3", UniformBlock::eMat3);
+
+        const GLfloat positions[2][3] = { { 1.0f, 2.0f, 3.0f }, { 4.0f, 5.0f, 6.0f } };
+        block.SetValue(v3Arr, &positions[0][0], 2);
+        TS_ASSERT_EQUALS(ReadFloat(block, 0), 1.0f);
+        TS_ASSERT_EQUALS(ReadFloat(block, 8), 3.0f);
+        TS_ASSERT_EQUALS(ReadFloat(block, 16), 4.0f);
+        TS_ASSERT_EQUALS(ReadFloat(block, 24), 6.0f);
+        TS_ASSERT_EQUALS(ReadFloat(block, 32), 0.0f);
+
+        const GLfloat matrix[9] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f };
+        block.SetValue(m3, matrix);
+        const U32 offset = block.GetOffset(m3);
+        TS_ASSERT_EQUALS(ReadFloat(block, offset), 1.0f);
+        TS_ASSERT_EQUALS(ReadFloat(block, offset + 16), 4.0f);
+        TS_ASSERT_EQUALS(ReadFloat(block, offset + 32), 7.0f);
+        TS_ASSERT_EQUALS(ReadFloat(block, offset + 40), 9.0f);
+    };
+
+    // /////////////////////////////////////////////////////////////////
+    // Test only changed values make the block dirty, and that the
+    // changes are uploaded once.
+    //
+    // /////////////////////////////////////////////////////////////////
+    void testDirtyTracking(void) {
+        UniformBlock block("Dirty");
+        const U32 count = block.AddMember("count", UniformBlock::eInt);
+        const U32 color = block.AddMember("color", UniformBlock::eVec4);
+        TS_ASSERT(block.IsDirty());
+
+        // Values equal to the zeroed block are not changes.
+        const GLfloat black[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        const GLfloat red[4] = { 1.0f, 0.0f, 0.0f, 1.0f };
+        block.SetValue(color, black);
+        block.SetValue(count, 0);
+
+#ifdef GF_GL_RECORDING
+        GameHalloran::GLRecorder &recorder = GameHalloran::GLRecorder::GetGlobalInstance();
+        recorder.Reset();
+        TS_ASSERT(block.Bind(0));
+        TS_ASSERT(!block.IsDirty());
+        TS_ASSERT_EQUALS(recorder.GetStats().m_bufferBytesUploaded, block.GetSize());
+
+        // Setting the same values again uploads nothing.
+        recorder.ResetStats();
+        block.SetValue(count, 0);
+        block.SetValue(color, black);
+        TS_ASSERT(!block.IsDirty());
+        TS_ASSERT(block.Upload());
+        TS_ASSERT_EQUALS(recorder.GetStats().m_calls, 0u);
+
+        // Changes are uploaded with one call covering just the changed bytes.
+        block.SetValue(color, red);
+        TS_ASSERT(block.IsDirty());
+        TS_ASSERT(block.Upload());
+        TS_ASSERT(!block.IsDirty());
+        TS_ASSERT_EQUALS(recorder.GetStats().m_bufferBytesUploaded, 16u);
+        TS_ASSERT_EQUALS(recorder.GetStats().m_uniformUploads, 0u);
+        block.Free();
+#else
+        block.SetValue(color, red);
+        TS_ASSERT(block.IsDirty());
+#endif
+        TS_ASSERT_EQUALS(ReadFloat(block, block.GetOffset(color)), 1.0f);
+    };
+};
+
+#endif